@@ -9,7 +9,7 @@ import glob
 
 root_dir = os.path.dirname(__file__)
 
-supported_archs = ['pnr', 'nhm', 'snb', 'ivb', 'hsw', 'mic', 'pld', 'nhm+mic', 'snb+mic', 'ivb+mic', 'hsw+mic']
+supported_archs = ['pnr', 'nhm', 'snb', 'ivb', 'hsw', 'mic', 'pld', 'x86', 'nhm+mic', 'snb+mic', 'ivb+mic', 'hsw+mic']
 for arg in sys.argv[1:]:
 	if arg not in supported_archs:
 		print('Unsupported arch: "%s"' % arg)
@@ -39,16 +39,15 @@ erd_ref_sources = [
 
 erd_opt_sources = [
 	'erd__memory_csgto.c',
-	"erd__1111_csgto.c", "erd__2d_coefficients.c", "erd__2d_pq_integrals.c",
-	"erd__boys_table.c", "erd__jacobi_table.c", "erd__cartesian_norms.c", "erd__csgto.c",
-	"erd__dsqmin_line_segments.c", "erd__e0f0_pcgto_block.c", "erd__hrr_matrix.c",
-	"erd__hrr_step.c", "erd__hrr_transform.c", "erd__int2d_to_e000.c", "erd__int2d_to_e0f0.c",
-	"erd__move_ry.c", "erd__normalize_cartesian.c",
+	"erd__1111_csgto.c", "erd__2222_csgto.c", "erd__2d_coefficients.c", "erd__2d_pq_integrals.c",
+	"erd__boys_table.c", "erd__jacobi_table.c", "erd__cartesian_norms.c", "erd__csgto.c", "erd__ctr_4index_block.c",
+	"erd__dispatch.c", "erd__dsqmin_line_segments.c", "erd__e0f0_pcgto_block.c", "erd__hrr_matrix.c", "erd__hrr_pair_matrix.c",
+	"erd__hrr_ry_transform.c", "erd__hrr_step.c", "erd__int2d_to_e000.c", "erd__int2d_to_e0f0.c", "erd__llll_pcgto_block.c",
 	"erd__pppp_pcgto_block.c", "erd__rys_1_roots_weights.c", "erd__rys_2_roots_weights.c", "erd__rys_3_roots_weights.c",
-	"erd__rys_4_roots_weights.c", "erd__rys_5_roots_weights.c", "erd__rys_roots_weights.c", "erd__rys_x_roots_weights.c",
-	"erd__set_abcd.c", "erd__set_ij_kl_pairs.c", "erd__spherical_transform.c", "erd__sppp_pcgto_block.c",
-	"erd__sspp_pcgto_block.c", "erd__sssp_pcgto_block.c", "erd__ssss_pcgto_block.c", "erd__xyz_to_ry_abcd.c",
-	"erd__xyz_to_ry_matrix.c",
+	"erd__rys_4_roots_weights.c", "erd__rys_5_roots_weights.c", "erd__rys_roots_weights.c", "erd__rys_table.c",
+	"erd__rys_table_roots_weights.c", "erd__rys_x_roots_weights.c", "erd__ry_table.c", "erd__set_abcd.c", "erd__set_ij_kl_pairs.c",
+	"erd__set_pair_data.c", "erd__sppp_pcgto_block.c", "erd__sspp_pcgto_block.c", "erd__sssp_pcgto_block.c", "erd__ssss_pcgto_block.c",
+	"erd__store_batch.c", "erd__xyz_to_ry_matrix.c",
 	"erd_profile.c"
 ]
 
@@ -83,7 +82,15 @@ oed_sources = [
 	"oed__xyz_set_derv_sequence.f", "oed__xyz_to_ry_abc.f", "oed__xyz_to_ry_ab.f", "oed__xyz_to_ry_matrix.f"
 ]
 
-cint_sources = ["basisset.c", "erd_integral.c", "oed_integral.c", "cint_offload.c"]
+# Compiled once per ISA level for the runtime-dispatched x86 build
+erd_dispatch_sources = [
+	"erd__rys_roots_weights.c", "erd__rys_1_roots_weights.c", "erd__rys_2_roots_weights.c", "erd__rys_3_roots_weights.c",
+	"erd__rys_4_roots_weights.c", "erd__rys_5_roots_weights.c", "erd__rys_table_roots_weights.c", "erd__rys_x_roots_weights.c",
+	"erd__2d_coefficients.c", "erd__2d_pq_integrals.c", "erd__int2d_to_e0f0.c", "erd__hrr_ry_transform.c"
+]
+dispatch_isas = ['sse4', 'avx', 'avx2', 'avx512']
+
+cint_sources = ["basisset.c", "erd_integral.c", "oed_integral.c", "schwarz.c", "scheduler.c", "fock.c", "cint_offload.c"]
 
 tab = '  '
 
@@ -95,6 +102,7 @@ with open('build.ninja', 'w') as makefile:
 	print('FC_HSW = ifort -m64 -xCORE-AVX2', file = makefile)
 	print('FC_MIC = ifort -mmic', file = makefile)
 	print('FC_PLD = ifort -m64 -mavx -fma', file = makefile)
+	print('FC_X86 = ifort -m64 -xSSE4.1', file = makefile)
 	print('FC_NHM_OFFLOAD = $FC_NHM', file = makefile)
 	print('FC_SNB_OFFLOAD = $FC_SNB', file = makefile)
 	print('FC_IVB_OFFLOAD = $FC_IVB', file = makefile)
@@ -109,6 +117,11 @@ with open('build.ninja', 'w') as makefile:
 	print('CC_HSW = icc -m64 -xCORE-AVX2 -DERD_HSW ' + native_cflags, file = makefile)
 	print('CC_MIC = icc -mmic -no-opt-prefetch -DERD_MIC ' + native_cflags, file = makefile)
 	print('CC_PLD = icc -m64 -mavx -fma -DERD_PLD ' + native_cflags, file = makefile)
+	print('CC_X86 = icc -m64 -xSSE4.1 -DERD_X86 -DERD_DISPATCH ' + native_cflags, file = makefile)
+	print('CC_X86_SSE4 = $CC_X86 -DERD_ISA_SUFFIX=sse4', file = makefile)
+	print('CC_X86_AVX = icc -m64 -xAVX -DERD_X86 -DERD_DISPATCH -DERD_ISA_SUFFIX=avx ' + native_cflags, file = makefile)
+	print('CC_X86_AVX2 = icc -m64 -xCORE-AVX2 -DERD_X86 -DERD_DISPATCH -DERD_ISA_SUFFIX=avx2 ' + native_cflags, file = makefile)
+	print('CC_X86_AVX512 = icc -m64 -xCORE-AVX512 -DERD_X86 -DERD_DISPATCH -DERD_ISA_SUFFIX=avx512 ' + native_cflags, file = makefile)
 	print('CC_NHM_OFFLOAD = icc -m64 -xSSE4.2 -DERD_NHM ' + offload_cflags, file = makefile)
 	print('CC_SNB_OFFLOAD = icc -m64 -xAVX -DERD_SNB ' + offload_cflags, file = makefile)
 	print('CC_IVB_OFFLOAD = icc -m64 -xCORE-AVX-I -DERD_IVB ' + offload_cflags, file = makefile)
@@ -126,6 +139,7 @@ with open('build.ninja', 'w') as makefile:
 		'hsw': 'HSW',
 		'mic': 'MIC',
 		'pld': 'PLD',
+		'x86': 'X86',
 		'nhm+mic': 'NHM_OFFLOAD',
 		'snb+mic': 'SNB_OFFLOAD',
 		'ivb+mic': 'IVB_OFFLOAD',
@@ -184,6 +198,17 @@ with open('build.ninja', 'w') as makefile:
 				elif source_file.endswith('.F'):
 					print('build %s : COMPILE_F77 %s' % (object_file, source_file), file = makefile)
 					print(tab + 'FC = $FC_%s' % suffix[arch], file = makefile)
+				elif source_file.endswith('.c') and version == 'opt' and arch == 'x86' and os.path.basename(source_file) in erd_dispatch_sources:
+					erd_objects.remove(object_file)
+					for isa in dispatch_isas:
+						isa_object_file = os.path.join(erd_build_directory, os.path.basename(source_file) + '.' + isa + '.o')
+						erd_objects.append(isa_object_file)
+						print('build %s : COMPILE_C %s' % (isa_object_file, source_file), file = makefile)
+						print(tab + 'SOURCE = ' + source_file, file = makefile)
+						print(tab + 'DEP_FILE = ' + isa_object_file + '.d', file = makefile)
+						print(tab + 'CC = $CC_%s_%s' % (suffix[arch], isa.upper()), file = makefile)
+						print(tab + 'ARCH = %s' % arch.upper(), file = makefile)
+					continue
 				elif source_file.endswith('.c'):
 					print('build %s : COMPILE_C %s' % (object_file, source_file), file = makefile)
 					print(tab + 'SOURCE = ' + source_file, file = makefile)
@@ -282,3 +307,44 @@ with open('build.ninja', 'w') as makefile:
 			print('build %s : LINK %s %s %s' % (binary_file, object_file, screening_object_file, libs), file = makefile)
 			print(tab + 'CC = $CC_%s' % suffix[arch], file = makefile)
 			print(tab + 'ARCH = %s' % arch.upper(), file = makefile)
+
+			if version == 'opt':
+				object_file = '%s/%s/testFock.c.%s.o' % (test_directory, arch, version)
+				print('build %s : COMPILE_C %s/testFock.c include/CInt.h' % (object_file, test_directory), file = makefile)
+				print(tab + 'DEP_FILE = %s.d' % object_file, file = makefile)
+				print(tab + 'SOURCE = %s/testFock.c' % test_directory, file = makefile)
+				print(tab + 'CC = $CC_%s' % suffix[arch], file = makefile)
+				print(tab + 'CFLAGS = $CFLAGS -openmp -I%s -Iinclude' % test_directory, file = makefile)
+				print(tab + 'ARCH = %s' % arch.upper(), file = makefile)
+
+				binary_file = 'testprog/%s/Fock.%s' % (arch, version.title())
+				libs = " ".join(['lib/' + arch + '/lib' + lib + '-' + version + '.a' for lib in ['cint', 'oed', 'erd']])
+				print('build %s : LINK %s %s %s' % (binary_file, object_file, screening_object_file, libs), file = makefile)
+				print(tab + 'CC = $CC_%s' % suffix[arch], file = makefile)
+				print(tab + 'ARCH = %s' % arch.upper(), file = makefile)
+
+				object_file = '%s/%s/benchE0F0.c.%s.o' % (test_directory, arch, version)
+				print('build %s : COMPILE_C %s/benchE0F0.c' % (object_file, test_directory), file = makefile)
+				print(tab + 'DEP_FILE = %s.d' % object_file, file = makefile)
+				print(tab + 'SOURCE = %s/benchE0F0.c' % test_directory, file = makefile)
+				print(tab + 'CC = $CC_%s' % suffix[arch], file = makefile)
+				print(tab + 'CFLAGS = $CFLAGS -Iexternal/erd', file = makefile)
+				print(tab + 'ARCH = %s' % arch.upper(), file = makefile)
+
+				binary_file = 'testprog/%s/E0F0.%s' % (arch, version.title())
+				print('build %s : LINK %s lib/%s/liberd-%s.a' % (binary_file, object_file, arch, version), file = makefile)
+				print(tab + 'CC = $CC_%s' % suffix[arch], file = makefile)
+				print(tab + 'ARCH = %s' % arch.upper(), file = makefile)
+
+				object_file = '%s/%s/testRys.c.%s.o' % (test_directory, arch, version)
+				print('build %s : COMPILE_C %s/testRys.c' % (object_file, test_directory), file = makefile)
+				print(tab + 'DEP_FILE = %s.d' % object_file, file = makefile)
+				print(tab + 'SOURCE = %s/testRys.c' % test_directory, file = makefile)
+				print(tab + 'CC = $CC_%s' % suffix[arch], file = makefile)
+				print(tab + 'CFLAGS = $CFLAGS -Iexternal/erd', file = makefile)
+				print(tab + 'ARCH = %s' % arch.upper(), file = makefile)
+
+				binary_file = 'testprog/%s/Rys.%s' % (arch, version.title())
+				print('build %s : LINK %s lib/%s/liberd-%s.a' % (binary_file, object_file, arch, version), file = makefile)
+				print(tab + 'CC = $CC_%s' % suffix[arch], file = makefile)
+				print(tab + 'ARCH = %s' % arch.upper(), file = makefile)
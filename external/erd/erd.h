@@ -1,6 +1,7 @@
 #ifndef __ERD_H__
 #define __ERD_H__
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <math.h>
@@ -13,7 +14,13 @@
 #define MAX(a,b)    ((a) < (b) ? (b) : (a))
 #define MIN(a,b)    ((a) > (b) ? (b) : (a))
 #define PREFACT     9.027033336764101
-#if defined (__MIC__) || defined (__AVX512__)
+/* Runtime-dispatched builds (ERD_DISPATCH) pad every buffer for the
+   AVX2 kernels, whatever ISA level an object is compiled for. Host
+   AVX-512 builds keep the AVX padding as well: the 8-wide padding is
+   only validated on MIC, and the AVX-512 kernels do not rely on it */
+#if defined (ERD_DISPATCH)
+#define SIMDW      4
+#elif defined (__MIC__)
 #define SIMDW      8
 #elif defined (__AVX__)
 #define SIMDW      4
@@ -26,6 +33,66 @@
 #define PAD_LEN(N)  ((N+SIMDW-1)/SIMDW * SIMDW )
 #define PAD_LEN2(N) ((N+SIMDW*2-1)/(SIMDW*2) * SIMDW*2 )
 
+/* Granularity of the primitive pair blocks (see erd__e0f0_def_blocks) */
+#define ERD_BLOCK_PAIRS     8
+
+/* Arrays of the primitive pair data (see erd__set_pair_data). Pairs of
+   generally contracted shells have one more array of coefficient products
+   per contraction pair after these */
+#define ERD_PAIR_P          0
+#define ERD_PAIR_PX         1
+#define ERD_PAIR_PY         2
+#define ERD_PAIR_PZ         3
+#define ERD_PAIR_PINVHF     4
+#define ERD_PAIR_SCALE      5
+#define ERD_PAIR_BOUND      6
+#define ERD_PAIR_ARRAYS     7
+
+/* Maximum # of xyz-monomials in one ry-component of shell L (see
+   erd__xyz_to_ry_matrix) */
+#define ERD_RY_NROWMX(L)    (((L) / 2 + 1) * ((L) / 2 + 2) / 2)
+
+/* T-values the SIMD 1...5 root Rys routines bin at a time, the most
+   T-ranges of any of them and their widest vector (see rys_simd.h) */
+#define ERD_RYS_BLOCK       512
+#define ERD_RYS_MAXRANGE    10
+#define ERD_RYS_MAXSIMDW    8
+
+/* Instruction set levels of the ERD kernels (see erd__select_isa) */
+#define ERD_ISA_AUTO        0
+#define ERD_ISA_SSE4        1
+#define ERD_ISA_AVX         2
+#define ERD_ISA_AVX2        3
+#define ERD_ISA_AVX512      4
+#define ERD_ISA_MIC         5
+
+/* With ERD_DISPATCH the hot kernels are compiled once per ISA level with
+   ERD_ISA_SUFFIX set to sse4, avx, avx2 or avx512, which appends the
+   suffix to their names. All other code calls them through erd_kernels. */
+#if defined (ERD_DISPATCH) && defined (ERD_ISA_SUFFIX)
+#define ERD_ISA_NAME(name)              ERD_ISA_PASTE(name, ERD_ISA_SUFFIX)
+#define ERD_ISA_PASTE(name, suffix)     ERD_ISA_PASTE_(name, suffix)
+#define ERD_ISA_PASTE_(name, suffix)    name##_##suffix
+#define erd__rys_roots_weights          ERD_ISA_NAME(erd__rys_roots_weights)
+#define erd__rys_1_roots_weights        ERD_ISA_NAME(erd__rys_1_roots_weights)
+#define erd__rys_2_roots_weights        ERD_ISA_NAME(erd__rys_2_roots_weights)
+#define erd__rys_3_roots_weights        ERD_ISA_NAME(erd__rys_3_roots_weights)
+#define erd__rys_4_roots_weights        ERD_ISA_NAME(erd__rys_4_roots_weights)
+#define erd__rys_5_roots_weights        ERD_ISA_NAME(erd__rys_5_roots_weights)
+#define erd__rys_1_roots_weights_scalar ERD_ISA_NAME(erd__rys_1_roots_weights_scalar)
+#define erd__rys_2_roots_weights_scalar ERD_ISA_NAME(erd__rys_2_roots_weights_scalar)
+#define erd__rys_3_roots_weights_scalar ERD_ISA_NAME(erd__rys_3_roots_weights_scalar)
+#define erd__rys_4_roots_weights_scalar ERD_ISA_NAME(erd__rys_4_roots_weights_scalar)
+#define erd__rys_5_roots_weights_scalar ERD_ISA_NAME(erd__rys_5_roots_weights_scalar)
+#define erd__rys_x_roots_weights        ERD_ISA_NAME(erd__rys_x_roots_weights)
+#define erd__rys_table_roots_weights    ERD_ISA_NAME(erd__rys_table_roots_weights)
+#define erd__2d_coefficients            ERD_ISA_NAME(erd__2d_coefficients)
+#define erd__2d_pq_integrals            ERD_ISA_NAME(erd__2d_pq_integrals)
+#define erd__int2d_to_e0f0              ERD_ISA_NAME(erd__int2d_to_e0f0)
+#define erd__int2d_to_e0f0_scalar       ERD_ISA_NAME(erd__int2d_to_e0f0_scalar)
+#define erd__hrr_ry_transform           ERD_ISA_NAME(erd__hrr_ry_transform)
+#endif
+
 /*******************************************************************/
 // C functions
 
@@ -33,10 +100,6 @@
 #pragma offload_attribute(push, target(mic))
 #endif
 
-void erd__move_ry(uint32_t nindex, uint32_t notmove, uint32_t move, uint32_t nry,
-    uint32_t index, const double x[restrict static notmove * move * nry],
-    uint32_t ixoff[restrict static nindex], double y[restrict static notmove * move * nry]);
-
 void erd__set_ij_kl_pairs(
     uint32_t npgtoa, uint32_t npgtob, uint32_t npgtoc, uint32_t npgtod,
     double minalphaa, double minalphab, double minalphac, double minalphad,
@@ -44,7 +107,7 @@ void erd__set_ij_kl_pairs(
     double xb, double yb, double zb,
     double xc, double yc, double zc,
     double xd, double yd, double zd,
-    double rnabsq, double rncdsq, double prefact,
+    double rnabsq, double rncdsq, double prefact, double tol,
     const double alphaa[restrict static npgtoa],
     const double alphab[restrict static npgtob],
     const double alphac[restrict static npgtoc],
@@ -54,13 +117,11 @@ void erd__set_ij_kl_pairs(
     double rhoab[restrict static npgtoa*npgtob],
     double rhocd[restrict static npgtoc*npgtod]);
 
-int erd__transpose_batch(int nrow, int ncol, double *batch, double *obatch);
+void erd__store_batch(uint32_t n1, uint32_t n2, uint32_t n3, uint32_t n4,
+    const uint32_t s[restrict static 4], const double x[restrict],
+    const size_t ld[restrict static 4], double y[restrict]);
 
-void erd__e0f0_def_blocks(uint32_t zmax,
-    uint32_t npgtoa, uint32_t npgtob, uint32_t npgtoc, uint32_t npgtod,
-    uint32_t shellp, uint32_t shellq,
-    uint32_t nij, uint32_t nkl, uint32_t ngqp, uint32_t ngqscr, uint32_t nxyzt,
-    uint32_t memory, uint32_t nint2d[restrict static 1]);
+int erd__transpose_batch(int nrow, int ncol, double *batch, double *obatch);
 
 void erd__pppp_pcgto_block(uint32_t nij, uint32_t nkl,
     double x1, double y1, double z1,
@@ -86,6 +147,20 @@ void erd__pppp_pcgto_block(uint32_t nij, uint32_t nkl,
     const double rho12[restrict static nij], const double rho34[restrict static nkl],
     double cbatch[restrict static 81]);
 
+void erd__llll_pcgto_block(uint32_t nij, uint32_t nkl,
+    const uint32_t shell[restrict static 4], const uint32_t lshell[restrict static 4], const uint32_t npgto[restrict static 4],
+    double x1, double y1, double z1,
+    double x2, double y2, double z2,
+    double x3, double y3, double z3,
+    double x4, double y4, double z4,
+    const double alpha1[restrict static 1], const double alpha2[restrict static 1], const double alpha3[restrict static 1], const double alpha4[restrict static 1],
+    const double cc1[restrict static 1], const double cc2[restrict static 1], const double cc3[restrict static 1], const double cc4[restrict static 1],
+    const uint32_t prim1[restrict static nij], const uint32_t prim2[restrict static nij], const uint32_t prim3[restrict static nkl], const uint32_t prim4[restrict static nkl],
+    const double norm1[restrict static 1], const double norm2[restrict static 1], const double norm3[restrict static 1], const double norm4[restrict static 1],
+    const double rho12[restrict static nij], const double rho34[restrict static nkl],
+    double factor,
+    double cbatch[restrict static 1]);
+
 void erd__sppp_pcgto_block(uint32_t nij, uint32_t nkl,
     uint32_t shell1, uint32_t shell3, uint32_t shellp,
     double x1, double y1, double z1,
@@ -137,16 +212,6 @@ void erd__ssss_pcgto_block(uint32_t nij, uint32_t nkl,
     const double rho12[restrict static nij], const double rho34[restrict static nkl],
     double cbatch[restrict static 1]);
 
-void erd__xyz_to_ry_abcd(uint32_t nxyza, uint32_t nxyzb, uint32_t nxyzc, uint32_t nxyzd,
-    uint32_t nrya, uint32_t nryb, uint32_t nryc, uint32_t nryd,
-    uint32_t shella, uint32_t shellb, uint32_t shellc, uint32_t shelld,
-    uint32_t nrowa[restrict static 1], uint32_t nrowb[restrict static 1], uint32_t nrowc[restrict static 1], uint32_t nrowd[restrict static 1],
-    uint32_t nrota[restrict static 1], uint32_t nrotb[restrict static 1], uint32_t nrotc[restrict static 1], uint32_t nrotd[restrict static 1],
-    uint32_t z00a[restrict static 1], uint32_t z00b[restrict static 1], uint32_t z00c[restrict static 1], uint32_t z00d[restrict static 1],
-    uint32_t i0a1[restrict static 1], uint32_t i0b1[restrict static 1], uint32_t i0c1[restrict static 1], uint32_t i0d1[restrict static 1],
-    uint32_t i0a2[restrict static 1], uint32_t i0b2[restrict static 1], uint32_t i0c2[restrict static 1], uint32_t i0d2[restrict static 1],
-    uint32_t icore[restrict static 1], double zcore[restrict static 1]);
-
 void erd__xyz_to_ry_matrix(
     uint32_t nxyz,
     uint32_t nrowmx,
@@ -155,7 +220,9 @@ void erd__xyz_to_ry_matrix(
     uint32_t row[restrict static nrowmx*(2*l+1)],
     double tmat[restrict static nrowmx*(2*l+1)]);
 
-void erd__spherical_transform(uint32_t m, uint32_t nrow, uint32_t nry, uint32_t lrow[restrict static nry], uint32_t row[restrict], const double rot[restrict], const double x[restrict], double y[restrict]);
+void erd__ry_table_size(uint32_t maxshell, size_t nindex[restrict static 1], size_t nvalue[restrict static 1]);
+
+void erd__ry_table(uint32_t maxshell, uint32_t index[restrict], double value[restrict]);
 
 void erd__hrr_step(uint32_t nabo, uint32_t mrowin,
     uint32_t mrowout, uint32_t nxyzx,
@@ -173,10 +240,22 @@ void erd__hrr_matrix(uint32_t nrothrr, uint32_t ncolhrr,
     uint32_t *nrowout_ptr, uint32_t *nrow,
     uint32_t *row, double *t);
 
-void erd__hrr_transform(uint32_t m, uint32_t nrow,
-    uint32_t nxyza, uint32_t nxyzb,
-    const uint32_t lrow[restrict static nxyzb], const uint32_t row[restrict],
-    const double rot[restrict], const double x[restrict], double y[restrict]);
+void erd__hrr_matrix_size(uint32_t nxyzet, uint32_t shellp, uint32_t shellb, uint32_t nabcoor,
+    uint32_t ncolhrr[restrict static 1], uint32_t nrothrr[restrict static 1], uint32_t nrowhrr[restrict static 1]);
+
+void erd__hrr_pair_size(uint32_t shella, uint32_t shellb, uint32_t nabcoor,
+    size_t nindex[restrict static 1], size_t nvalue[restrict static 1]);
+
+void erd__hrr_pair_matrix(uint32_t A, uint32_t B,
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 1],
+    uint32_t index[restrict], double value[restrict]);
+
+void erd__hrr_ry_transform(uint32_t m, uint32_t nxyzx, uint32_t nxyzy,
+    uint32_t nrowhrr, const uint32_t *restrict lrowhrr, const uint32_t *restrict rowhrr, const double *restrict thrr,
+    uint32_t nryx, uint32_t nrowx, const uint32_t *restrict lrowx, const uint32_t *restrict rowx, const double *restrict rotx, const double *restrict normx,
+    uint32_t nryy, uint32_t nrowy, const uint32_t *restrict lrowy, const uint32_t *restrict rowy, const double *restrict roty, const double *restrict normy,
+    size_t sx, size_t sy, const size_t lane[restrict static m],
+    const double x[restrict], double y[restrict]);
 
 double erd__dsqmin_line_segments(double xp0, double yp0,
     double zp0, double xp1,
@@ -197,25 +276,63 @@ void erd__set_abcd(
     uint32_t *restrict ncolhrr, uint32_t *restrict nrothrr,
     uint32_t *restrict nxyzhrr, bool *restrict empty);
 
-void erd__normalize_cartesian(uint32_t m, uint32_t l, const double norm[restrict static l+1], double batch[restrict]);
-
 void erd__cartesian_norms(uint32_t length, double norm[restrict static length+1]);
 
 void erd__e0f0_pcgto_block(
     uint32_t A, uint32_t B, uint32_t C, uint32_t D,
     uint32_t nij, uint32_t nkl,
     uint32_t nxyzet, uint32_t nxyzft,
-    uint32_t nxyzp, uint32_t nxyzq,
     const uint32_t shell[restrict static 1],
     const double xyz0[restrict static 1],
-    const double *restrict alpha[restrict static 1],
-    const double *restrict cc[restrict static 1],
     int **vrrtab,
-    const uint32_t prima[restrict static nij], const uint32_t primb[restrict static nij], const uint32_t primc[restrict static nkl], const uint32_t primd[restrict static nkl],
-    const double norma[restrict static nij], const double normb[restrict static nij], const double normc[restrict static nkl], const double normd[restrict static nkl],
-    const double rhoab[restrict static nij], const double rhocd[restrict static nkl],
+    double factor, bool contract,
+    const double pairab[restrict static 1], uint32_t npairab,
+    const double paircd[restrict static 1], uint32_t npaircd,
+    void *restrict scratch,
     double batch[restrict static 1]);
 
+size_t erd__e0f0_scratch_size(uint32_t nij, uint32_t nkl, uint32_t shellp, uint32_t shellq);
+
+size_t erd__rys_scratch_size(uint32_t nt, uint32_t ngqp);
+
+void erd__e0f0_def_blocks(size_t block_size, uint32_t nij, uint32_t nkl,
+    uint32_t shellp, uint32_t shellq, uint32_t nxyzt,
+    uint32_t mij[restrict static 1], uint32_t mkl[restrict static 1]);
+
+void erd__ctr_4index_block(uint32_t nxyzt, uint32_t nij, uint32_t nkl,
+    uint32_t nrs, uint32_t ntu,
+    const double ccab[restrict], size_t ldab,
+    const double cccd[restrict], size_t ldcd,
+    const double batch[restrict static 1],
+    double work[restrict static 1],
+    double ctr[restrict static 1]);
+
+size_t erd__scratch_csgto(uint32_t npgto1, uint32_t npgto2, uint32_t npgto3, uint32_t npgto4,
+    uint32_t ncgto1, uint32_t ncgto2, uint32_t ncgto3, uint32_t ncgto4,
+    uint32_t shell1, uint32_t shell2, uint32_t shell3, uint32_t shell4,
+    bool spheric);
+
+size_t erd__pair_data_size(uint32_t npair, uint32_t nctr);
+
+void erd__set_pair_data(uint32_t npair,
+    const uint32_t prima[restrict static npair], const uint32_t primb[restrict static npair], const double rho[restrict static npair],
+    const double xyza[restrict static 3], const double xyzb[restrict static 3],
+    uint32_t shella, uint32_t shellb,
+    uint32_t npgtoa, uint32_t npgtob, uint32_t ncgtoa, uint32_t ncgtob,
+    const double alphaa[restrict], const double alphab[restrict],
+    const double cca[restrict], const double ccb[restrict],
+    const double norma[restrict], const double normb[restrict],
+    double data[restrict]);
+
+uint32_t erd__shell_pair_data(uint32_t A, uint32_t B,
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    double tol, double data[restrict], double bound[restrict static 1]);
+
+uint32_t erd__screen_pair_data(uint32_t npair, const double data[restrict static 1],
+    double bound, double tol);
+
 void erd__2d_coefficients(uint32_t mij, uint32_t mkl, uint32_t ngqp,
     const double *restrict p, const double *restrict q,
     const double *restrict px, const double *restrict py, const double *restrict pz,
@@ -241,6 +358,11 @@ int erd__int2d_to_e0f0 (int shella, int shellp, int shellc, int shellq,
                         double *int2dx, double *int2dy, double *int2dz,
                         int **vrrtab, double *batch);
 
+int erd__int2d_to_e0f0_scalar (int shella, int shellp, int shellc, int shellq,
+                               int ngqexq, int nxyzet, int nxyzft,
+                               double *int2dx, double *int2dy, double *int2dz,
+                               int **vrrtab, double *batch);
+
 int erd__int2d_to_e000 (int shella, int shellp, int ngqp, int nexq, int ngqexq,
                         int nxyzet, int nxyzp,
                         double *int2dx, double *int2dy, double *int2dz,
@@ -249,23 +371,82 @@ int erd__int2d_to_e000 (int shella, int shellp, int ngqp, int nexq, int ngqexq,
 
 void erd__rys_roots_weights(uint32_t nt, uint32_t ngqp, uint32_t nmom,
                             const double tval[restrict],
-                            double rts[restrict], double wts[restrict]);
+                            double rts[restrict], double wts[restrict],
+                            void *restrict scratch);
+
+void erd__rys_1_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict],
+                              void *restrict scratch);
+
+void erd__rys_1_roots_weights_scalar(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
+
+void erd__rys_2_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict],
+                              void *restrict scratch);
 
-void erd__rys_1_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
+void erd__rys_2_roots_weights_scalar(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
 
-void erd__rys_2_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
+void erd__rys_3_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict],
+                              void *restrict scratch);
 
-void erd__rys_3_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
+void erd__rys_3_roots_weights_scalar(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
 
-void erd__rys_4_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
+void erd__rys_4_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict],
+                              void *restrict scratch);
 
-void erd__rys_5_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
+void erd__rys_4_roots_weights_scalar(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
+
+void erd__rys_5_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict],
+                              void *restrict scratch);
+
+void erd__rys_5_roots_weights_scalar(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
+
+void erd__rys_table_roots_weights(uint32_t nt, uint32_t ngqp,
+    const double tval[restrict], double rts[restrict], double wts[restrict]);
 
 void erd__rys_x_roots_weights(int nt, int ntgqp, int ngqp,
     int nmom, const double tval[restrict],
     const double ryszero[restrict],
     double rts[restrict], double wts[restrict]);
 
+int erd__select_isa(int isa);
+
+/* Bytes of primitive block scratch erd__csgto aims to keep in cache (see
+   erd__select_block_size) */
+extern size_t erd_block_size;
+
+size_t erd__select_block_size(size_t cache);
+
+#if defined (ERD_DISPATCH) && !defined (ERD_ISA_SUFFIX)
+/* Kernels of the ISA level chosen by erd__select_isa */
+typedef struct {
+    __typeof__(erd__rys_roots_weights) *rys_roots_weights;
+    __typeof__(erd__2d_coefficients) *coefficients_2d;
+    __typeof__(erd__2d_pq_integrals) *pq_integrals_2d;
+    __typeof__(erd__int2d_to_e0f0) *int2d_to_e0f0;
+    __typeof__(erd__hrr_ry_transform) *hrr_ry_transform;
+} erd_kernels_t;
+
+extern erd_kernels_t erd_kernels;
+
+#define erd__rys_roots_weights          (*erd_kernels.rys_roots_weights)
+#define erd__2d_coefficients            (*erd_kernels.coefficients_2d)
+#define erd__2d_pq_integrals            (*erd_kernels.pq_integrals_2d)
+#define erd__int2d_to_e0f0              (*erd_kernels.int2d_to_e0f0)
+#define erd__hrr_ry_transform           (*erd_kernels.hrr_ry_transform)
+
+extern __typeof__(erd__int2d_to_e0f0_scalar) erd__int2d_to_e0f0_scalar_sse4;
+#define erd__int2d_to_e0f0_scalar       erd__int2d_to_e0f0_scalar_sse4
+extern __typeof__(erd__rys_1_roots_weights_scalar) erd__rys_1_roots_weights_scalar_sse4;
+#define erd__rys_1_roots_weights_scalar erd__rys_1_roots_weights_scalar_sse4
+extern __typeof__(erd__rys_2_roots_weights_scalar) erd__rys_2_roots_weights_scalar_sse4;
+#define erd__rys_2_roots_weights_scalar erd__rys_2_roots_weights_scalar_sse4
+extern __typeof__(erd__rys_3_roots_weights_scalar) erd__rys_3_roots_weights_scalar_sse4;
+#define erd__rys_3_roots_weights_scalar erd__rys_3_roots_weights_scalar_sse4
+extern __typeof__(erd__rys_4_roots_weights_scalar) erd__rys_4_roots_weights_scalar_sse4;
+#define erd__rys_4_roots_weights_scalar erd__rys_4_roots_weights_scalar_sse4
+extern __typeof__(erd__rys_5_roots_weights_scalar) erd__rys_5_roots_weights_scalar_sse4;
+#define erd__rys_5_roots_weights_scalar erd__rys_5_roots_weights_scalar_sse4
+#endif
+
 #ifdef __INTEL_OFFLOAD
 #pragma offload_attribute(pop)
 #endif
@@ -19,6 +19,7 @@
 /*                ERD__SSPP_PCGTO_BLOCK */
 /*                ERD__SPPP_PCGTO_BLOCK */
 /*                ERD__PPPP_PCGTO_BLOCK */
+/*                ERD__LLLL_PCGTO_BLOCK */
 /*                ERD__CTR_4INDEX_BLOCK */
 /*                ERD__CTR_RS_EXPAND */
 /*                ERD__CTR_TU_EXPAND */
@@ -28,7 +29,10 @@
 /*                electron repulsion integrals on up to four different */
 /*                centers between spherical gaussian type shells. */
 /*                Special fast routine for integrals involving s- and */
-/*                p-type shells only! */
+/*                p-type shells only! L-shells (SP-shells of shared */
+/*                exponents, LSHELL = 1) are p-shells whose s-part is */
+/*                evaluated along with the p-part, their 4 functions */
+/*                (s,x,y,z) following each other in the batch. */
 /*                  Input (x = 1,2,3 and 4): */
 /*                    IMAX,ZMAX    =  maximum int,flp memory */
 /*                    NALPHA       =  total # of exponents */
@@ -88,11 +92,13 @@ ERD_OFFLOAD void erd__1111_csgto(
     uint32_t A, uint32_t B, uint32_t C, uint32_t D,
     const uint32_t npgto[restrict static 1],
     const uint32_t shell[restrict static 1],
+    const uint32_t lshell[restrict static 1],
     const double xyz0[restrict static 1],
     const double *restrict alpha[restrict static 1],
     const double minalpha[restrict static 1],
     const double *restrict cc[restrict static 1],
     const double *restrict norm[restrict static 1],
+    double tol,
     uint32_t buffer_capacity, uint32_t integrals_count[restrict static 1], double integrals_ptr[restrict static 81])
 {
     uint32_t shell1 = shell[A], shell2 = shell[B], shell3 = shell[C], shell4 = shell[D];
@@ -109,7 +115,8 @@ ERD_OFFLOAD void erd__1111_csgto(
     const bool atomic = ((A ^ B) | (B ^ C) | (C ^ D)) == 0;
     const uint32_t shellp = shell1 + shell2;
     const uint32_t shellt = shellp + shell3 + shell4;
-    if (atomic && ((shellt % 2) == 1)) {
+    const bool lquartet = (lshell[A] | lshell[B] | lshell[C] | lshell[D]) != 0;
+    if (atomic && !lquartet && ((shellt % 2) == 1)) {
         *integrals_count = 0;
         ERD_PROFILE_END(erd__1111_csgto)
         return;
@@ -137,10 +144,10 @@ ERD_OFFLOAD void erd__1111_csgto(
     const double *restrict cc1 = cc[A], *restrict cc2 = cc[B], *restrict cc3 = cc[C], *restrict cc4 = cc[D];
     const double *restrict norm1 = norm[A], *restrict norm2 = norm[B], *restrict norm3 = norm[C], *restrict norm4 = norm[D];
 
-    const uint32_t nxyz1 = 2 * shell1 + 1;
-    const uint32_t nxyz2 = 2 * shell2 + 1;
-    const uint32_t nxyz3 = 2 * shell3 + 1;
-    const uint32_t nxyz4 = 2 * shell4 + 1;
+    const uint32_t nxyz1 = lshell[A] ? 4 : 2 * shell1 + 1;
+    const uint32_t nxyz2 = lshell[B] ? 4 : 2 * shell2 + 1;
+    const uint32_t nxyz3 = lshell[C] ? 4 : 2 * shell3 + 1;
+    const uint32_t nxyz4 = lshell[D] ? 4 : 2 * shell4 + 1;
     const uint32_t nxyzt = nxyz1 * nxyz2 * nxyz3 * nxyz4;
     const double x12 = x1 - x2;
     const double y12 = y1 - y2;
@@ -163,7 +170,7 @@ ERD_OFFLOAD void erd__1111_csgto(
                          minalpha[A], minalpha[B], minalpha[C], minalpha[D],
                          x1, y1, z1, x2, y2, z2,
                          x3, y3, z3, x4, y4, z4,
-                         rn12sq, rn34sq, PREFACT,
+                         rn12sq, rn34sq, PREFACT, tol,
                          alpha1, alpha2, alpha3, alpha4, 
                          &nij, &nkl,
                          prim1, prim2, prim3, prim4,
@@ -174,6 +181,32 @@ ERD_OFFLOAD void erd__1111_csgto(
         ERD_PROFILE_END(erd__1111_csgto)
         return;
     }
+    /* ...quartets with L-shells: all parts at once, with their own SPNORM */
+    if (lquartet) {
+        for (uint32_t i = 0; i < nxyzt; i++) {
+            integrals_ptr[i] = 0.0;
+        }
+        const uint32_t shells[4] = { shell1, shell2, shell3, shell4 };
+        const uint32_t lshells[4] = { lshell[A], lshell[B], lshell[C], lshell[D] };
+        const uint32_t npgtos[4] = { npgto1, npgto2, npgto3, npgto4 };
+        ERD_PROFILE_START(erd__llll_pcgto_block)
+        erd__llll_pcgto_block(nij, nkl,
+            shells, lshells, npgtos,
+            x1, y1, z1, x2, y2, z2,
+            x3, y3, z3, x4, y4, z4,
+            alpha1, alpha2, alpha3, alpha4,
+            cc1, cc2, cc3, cc4,
+            prim1, prim2, prim3, prim4,
+            norm1, norm2, norm3, norm4,
+            rhoab, rhocd,
+            PREFACT,
+            integrals_ptr);
+        ERD_PROFILE_END(erd__llll_pcgto_block)
+        *integrals_count = nxyzt;
+        ERD_PROFILE_END(erd__1111_csgto)
+        return;
+    }
+
     /* 
      * ...decide on the primitive [12|34] block size and return array sizes and pointers for the primitive [12|34] generation.
      *    Perform also some preparation steps for contraction.
@@ -0,0 +1,590 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <assert.h>
+
+#include "boys.h"
+#include "erd.h"
+#include "erdutil.h"
+#include "xyz.h"
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(push, target(mic))
+#endif
+
+
+/* Cartesian d-shell norms, as set up by ERD__CARTESIAN_NORMS: 4 for
+   the mixed monomials and 4/sqrt(3) for x^2, y^2 and z^2 */
+#define D_NORM_MIXED    4.0
+#define D_NORM_SQUARE   2.3094010767585034
+
+/* Cartesian -> spherical transformation of the d-shell including the
+   cartesian normalization, as set up by ERD__XYZ_TO_RY_MATRIX. The
+   x^2-y^2 row is sqrt(3)/2 times the square norm, which is exactly 2 */
+static const double d_spherical[5][6] = {
+    {  2.0, 0.0, 0.0, -2.0, 0.0, 0.0 },
+    {  0.0, 0.0, D_NORM_MIXED, 0.0, 0.0, 0.0 },
+    { -0.5 * D_NORM_SQUARE, 0.0, 0.0, -0.5 * D_NORM_SQUARE, 0.0, D_NORM_SQUARE },
+    {  0.0, 0.0, 0.0, 0.0, D_NORM_MIXED, 0.0 },
+    {  0.0, D_NORM_MIXED, 0.0, 0.0, 0.0, 0.0 }
+};
+
+static const double d_cartesian[6] = {
+    D_NORM_SQUARE, D_NORM_MIXED, D_NORM_MIXED, D_NORM_SQUARE, D_NORM_MIXED, D_NORM_SQUARE
+};
+
+
+/* One HRR step on the electron whose e0-part spans the shells la...shellp:
+       batch (outer,e0,b,inner) --> batch (outer,e0',b+1,inner)
+   with e0' one shell shorter, using (e,b+1i) = (e+1i,b) + AB_i (e,b) */
+static ERD_FORCE_INLINE void hrr_step(uint32_t outer, uint32_t inner,
+    uint32_t la, uint32_t shellp, uint32_t shellb,
+    const double ab[restrict static 3],
+    const double *restrict x, double *restrict y)
+{
+    const uint32_t nex = NXYZ_BELOW(shellp - shellb + 1) - NXYZ_BELOW(la);
+    const uint32_t ney = nex - NXYZ(shellp - shellb);
+    const uint32_t nbx = NXYZ(shellb);
+    const uint32_t nby = NXYZ(shellb + 1);
+    for (uint32_t o = 0; o < outer; o++) {
+        for (uint32_t e = 0; e < ney; e++) {
+            const uint32_t xyze = NXYZ_BELOW(la) + e;
+            for (uint32_t b = 0; b < nby; b++) {
+                const uint32_t xyzb = NXYZ_BELOW(shellb + 1) + b;
+                const uint32_t axis = xyz_axis[xyzb];
+                const uint32_t bx = xyz_lower[xyzb][axis] - NXYZ_BELOW(shellb);
+                const uint32_t ex = xyz_raise[xyze][axis] - NXYZ_BELOW(la);
+                for (uint32_t i = 0; i < inner; i++) {
+                    y[((o * ney + e) * nby + b) * inner + i] =
+                        x[((o * nex + ex) * nbx + bx) * inner + i] + ab[axis] * x[((o * nex + e) * nbx + bx) * inner + i];
+                }
+            }
+        }
+    }
+}
+
+
+/* Cartesian -> spherical transformation or cartesian normalization of a
+   d-shell: batch (outer,xyz,inner) --> batch (outer,ry,inner) */
+static ERD_FORCE_INLINE void d_transform(uint32_t outer, uint32_t inner, bool spheric,
+    const double *restrict x, double *restrict y)
+{
+    if (spheric) {
+        for (uint32_t o = 0; o < outer; o++) {
+            for (uint32_t r = 0; r < 5; r++) {
+                for (uint32_t i = 0; i < inner; i++) {
+                    double sum = 0.0;
+                    for (uint32_t xyz = 0; xyz < 6; xyz++) {
+                        sum += d_spherical[r][xyz] * x[(o * 6 + xyz) * inner + i];
+                    }
+                    y[(o * 5 + r) * inner + i] = sum;
+                }
+            }
+        }
+    } else {
+        for (uint32_t o = 0; o < outer; o++) {
+            for (uint32_t xyz = 0; xyz < 6; xyz++) {
+                for (uint32_t i = 0; i < inner; i++) {
+                    y[(o * 6 + xyz) * inner + i] = d_cartesian[xyz] * x[(o * 6 + xyz) * inner + i];
+                }
+            }
+        }
+    }
+}
+
+
+/* Number of primitive quartets evaluated together, one per SIMD lane */
+#define IJKL_BLOCK 8
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : D_CLASS_KERNEL */
+/*  DESCRIPTION : Contracted (ab|cd) batch of one fixed shell class with */
+/*                la >= lb, lc >= ld, at least one d-shell and a total */
+/*                angular momentum of at most 4. The [e0|f0] primitives */
+/*                are generated by the Obara-Saika recurrences from */
+/*                Fm (T) with m = 0,...,la+lb+lc+ld for IJKL_BLOCK */
+/*                primitive quartets at a time and contracted on the */
+/*                fly, the HRR, the cartesian -> spherical */
+/*                transformation (or */
+/*                cartesian normalization) and the final ordering are */
+/*                then done on the small contracted batch. All shells */
+/*                are compile time constants in the instantiations */
+/*                below, so the recurrences unroll. */
+/*                  Input: */
+/*                    NIJ(KL)      =  # of ij (kl) primitive pairs to */
+/*                                    be evaluated */
+/*                    PAIRAB(CD)   =  primitive pair data of the AB (CD) */
+/*                                    shell pair holding NPAIRAB(CD) */
+/*                                    pairs (see ERD__SET_PAIR_DATA) */
+/*                    XYZA(C)      =  coordinates of centers A (C) */
+/*                    AB,CD        =  center differences A-B and C-D */
+/*                    FACTOR       =  overall prefactor including SPNORM */
+/*                    STRIDE       =  batch strides of the A,B,C,D ry- */
+/*                                    components */
+/*                  Output: */
+/*                    BATCH        =  contracted (ab|cd) batch */
+/* ------------------------------------------------------------------------ */
+static ERD_FORCE_INLINE void d_class_kernel(
+    uint32_t la, uint32_t lb, uint32_t lc, uint32_t ld,
+    bool spheric,
+    uint32_t nij, uint32_t nkl,
+    const double *restrict pairab, uint32_t npairab,
+    const double *restrict paircd, uint32_t npaircd,
+    const double xyza[restrict static 3], const double xyzc[restrict static 3],
+    const double ab[restrict static 3], const double cd[restrict static 3],
+    double factor,
+    const uint32_t stride[restrict static 4],
+    double *restrict batch)
+{
+    const uint32_t shellp = la + lb;
+    const uint32_t shellq = lc + ld;
+    const uint32_t shellt = shellp + shellq;
+    const uint32_t nxyze = NXYZ_BELOW(shellp + 1);
+    const uint32_t nxyzf = NXYZ_BELOW(shellq + 1);
+    const uint32_t ne = nxyze - NXYZ_BELOW(la);
+    const uint32_t nf = nxyzf - NXYZ_BELOW(lc);
+
+    const size_t simd_npairab = PAD_LEN(npairab);
+    const double *restrict p = &pairab[ERD_PAIR_P * simd_npairab];
+    const double *restrict ppx = &pairab[ERD_PAIR_PX * simd_npairab];
+    const double *restrict ppy = &pairab[ERD_PAIR_PY * simd_npairab];
+    const double *restrict ppz = &pairab[ERD_PAIR_PZ * simd_npairab];
+    const double *restrict pinvhf = &pairab[ERD_PAIR_PINVHF * simd_npairab];
+    const double *restrict scalep = &pairab[ERD_PAIR_SCALE * simd_npairab];
+    const size_t simd_npaircd = PAD_LEN(npaircd);
+    const double *restrict q = &paircd[ERD_PAIR_P * simd_npaircd];
+    const double *restrict qqx = &paircd[ERD_PAIR_PX * simd_npaircd];
+    const double *restrict qqy = &paircd[ERD_PAIR_PY * simd_npaircd];
+    const double *restrict qqz = &paircd[ERD_PAIR_PZ * simd_npaircd];
+    const double *restrict qinvhf = &paircd[ERD_PAIR_PINVHF * simd_npaircd];
+    const double *restrict scaleq = &paircd[ERD_PAIR_SCALE * simd_npaircd];
+
+    /* ...the contracted [e0|f0] with e0 = la...shellp and f0 = lc...shellq,
+          summed separately over the lanes */
+    ERD_SIMD_ALIGN double e0f0[ne * nf][IJKL_BLOCK];
+    for (uint32_t i = 0; i < ne * nf; i++) {
+        for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+            e0f0[i][k] = 0.0;
+        }
+    }
+    const uint32_t nijkl = nij * nkl;
+    for (uint32_t ijkl0 = 0; ijkl0 < nijkl; ijkl0 += IJKL_BLOCK) {
+        const uint32_t nk = MIN(IJKL_BLOCK, nijkl - ijkl0);
+
+        /* ...[e0|f0]^(m) with v[f][m][e][k] */
+        ERD_SIMD_ALIGN double v[nxyzf][shellt + 1][nxyze][IJKL_BLOCK];
+        ERD_SIMD_ALIGN double pa[3][IJKL_BLOCK], qc[3][IJKL_BLOCK], wp[3][IJKL_BLOCK], wq[3][IJKL_BLOCK];
+        ERD_SIMD_ALIGN double rhop[IJKL_BLOCK], rhoq[IJKL_BLOCK], u2[IJKL_BLOCK], u3[IJKL_BLOCK], u4[IJKL_BLOCK];
+        /* ...the lanes past the last quartet repeat it with zero scale */
+        uint32_t lane_ij[IJKL_BLOCK], lane_kl[IJKL_BLOCK];
+        uint32_t ij = ijkl0 / nkl;
+        uint32_t kl = ijkl0 % nkl;
+        for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+            lane_ij[k] = ij;
+            lane_kl[k] = kl;
+            if (k + 1 < nk) {
+                kl++;
+                if (kl == nkl) {
+                    kl = 0;
+                    ij++;
+                }
+            }
+        }
+        for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+            const uint32_t ij = lane_ij[k];
+            const uint32_t kl = lane_kl[k];
+            const double pval = p[ij];
+            const double qval = q[kl];
+            const double pqmult = pval * qval;
+            const double pqplus = pval + qval;
+            const double pqpinv = 1.0 / pqplus;
+            const double pqx = ppx[ij] - qqx[kl];
+            const double pqy = ppy[ij] - qqy[kl];
+            const double pqz = ppz[ij] - qqz[kl];
+            const double t = (pqx * pqx + pqy * pqy + pqz * pqz) * pqmult * pqpinv;
+            const double scale = (k < nk) ? factor * scalep[ij] * scaleq[kl] / (pqmult * __builtin_sqrt(pqplus)) : 0.0;
+            pa[0][k] = ppx[ij] - xyza[0];
+            pa[1][k] = ppy[ij] - xyza[1];
+            pa[2][k] = ppz[ij] - xyza[2];
+            qc[0][k] = qqx[kl] - xyzc[0];
+            qc[1][k] = qqy[kl] - xyzc[1];
+            qc[2][k] = qqz[kl] - xyzc[2];
+            wp[0][k] = -qval * pqpinv * pqx;
+            wp[1][k] = -qval * pqpinv * pqy;
+            wp[2][k] = -qval * pqpinv * pqz;
+            wq[0][k] = pval * pqpinv * pqx;
+            wq[1][k] = pval * pqpinv * pqy;
+            wq[2][k] = pval * pqpinv * pqz;
+            rhop[k] = qval * pqpinv;
+            rhoq[k] = pval * pqpinv;
+            u2[k] = 0.5 * pqpinv;
+            u3[k] = pinvhf[ij];
+            u4[k] = qinvhf[kl];
+            if (shellt == 2) {
+                const struct Boys012 boys = boys012(t, scale);
+                v[0][0][0][k] = boys.f0;
+                v[0][1][0][k] = boys.f1;
+                v[0][2][0][k] = boys.f2;
+            } else if (shellt == 3) {
+                const struct Boys0123 boys = boys0123(t, scale);
+                v[0][0][0][k] = boys.f0;
+                v[0][1][0][k] = boys.f1;
+                v[0][2][0][k] = boys.f2;
+                v[0][3][0][k] = boys.f3;
+            } else {
+                const struct Boys01234 boys = boys01234(t, scale);
+                v[0][0][0][k] = boys.f0;
+                v[0][1][0][k] = boys.f1;
+                v[0][2][0][k] = boys.f2;
+                v[0][3][0][k] = boys.f3;
+                v[0][4][0][k] = boys.f4;
+            }
+        }
+
+        /* ...[e0|00]^(m) = PA_i [e0-1i|00]^(m) + WP_i [e0-1i|00]^(m+1) +
+              (e_i-1)/2p ([e0-2i|00]^(m) - rho/p [e0-2i|00]^(m+1)) */
+        for (uint32_t shell = 1; shell <= shellp; shell++) {
+            for (uint32_t e = NXYZ_BELOW(shell); e < NXYZ_BELOW(shell + 1); e++) {
+                const uint32_t axis = xyz_axis[e];
+                const uint32_t e1 = xyz_lower[e][axis];
+                const uint32_t e2 = xyz_lower[e1][axis];
+                const double n1 = (double)xyz_exponent[e1][axis];
+                for (uint32_t m = 0; m <= shellt - shell; m++) {
+                    for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+                        v[0][m][e][k] = pa[axis][k] * v[0][m][e1][k] + wp[axis][k] * v[0][m + 1][e1][k] +
+                            n1 * u3[k] * (v[0][m][e2][k] - rhop[k] * v[0][m + 1][e2][k]);
+                    }
+                }
+            }
+        }
+
+        /* ...[e0|f0]^(m) = QC_i [e0|f0-1i]^(m) + WQ_i [e0|f0-1i]^(m+1) +
+              (f_i-1)/2q ([e0|f0-2i]^(m) - rho/q [e0|f0-2i]^(m+1)) +
+              e_i/2(p+q) [e0-1i|f0-1i]^(m+1), only for the e0 that are
+              still needed for the [e0|f0] with e0 >= la */
+        for (uint32_t shellf = 1; shellf <= shellq; shellf++) {
+            const uint32_t shell0 = (la + shellf > shellq) ? la + shellf - shellq : 0;
+            for (uint32_t f = NXYZ_BELOW(shellf); f < NXYZ_BELOW(shellf + 1); f++) {
+                const uint32_t axis = xyz_axis[f];
+                const uint32_t f1 = xyz_lower[f][axis];
+                const uint32_t f2 = xyz_lower[f1][axis];
+                const double n1 = (double)xyz_exponent[f1][axis];
+                for (uint32_t shell = shell0; shell <= shellp; shell++) {
+                    for (uint32_t e = NXYZ_BELOW(shell); e < NXYZ_BELOW(shell + 1); e++) {
+                        const uint32_t e1 = xyz_lower[e][axis];
+                        const double n2 = (double)xyz_exponent[e][axis];
+                        for (uint32_t m = 0; m <= shellt - shellf - shell; m++) {
+                            for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+                                v[f][m][e][k] = qc[axis][k] * v[f1][m][e][k] + wq[axis][k] * v[f1][m + 1][e][k] +
+                                    n1 * u4[k] * (v[f2][m][e][k] - rhoq[k] * v[f2][m + 1][e][k]);
+                            }
+                            /* ...[e0-1i|f0-1i] below shell0 is not set */
+                            if (n2 != 0.0) {
+                                for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+                                    v[f][m][e][k] += n2 * u2[k] * v[f1][m + 1][e1][k];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        for (uint32_t e = 0; e < ne; e++) {
+            for (uint32_t f = 0; f < nf; f++) {
+                for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+                    e0f0[e * nf + f][k] += v[NXYZ_BELOW(lc) + f][0][NXYZ_BELOW(la) + e][k];
+                }
+            }
+        }
+    }
+
+    /* ...HRR on the contracted batch, first for the AB- then for the
+          CD-part: batch (e0,f0) --> batch (a,b,f0) --> batch (a,b,c,d) */
+    const uint32_t nxyza = NXYZ(la), nxyzb = NXYZ(lb), nxyzc = NXYZ(lc), nxyzd = NXYZ(ld);
+    const uint32_t nxyzt = nxyza * nxyzb * nxyzc * nxyzd;
+    const uint32_t nwork = ne * nf + nxyzt;
+    double work[3][nwork];
+    for (uint32_t i = 0; i < ne * nf; i++) {
+        double sum = 0.0;
+        for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+            sum += e0f0[i][k];
+        }
+        work[2][i] = sum;
+    }
+    double *x = work[2];
+    double *y = work[0];
+    for (uint32_t shellb = 0; shellb < lb; shellb++) {
+        hrr_step(1, nf, la, shellp, shellb, ab, x, y);
+        x = y;
+        y = (y == work[0]) ? work[1] : work[0];
+    }
+    for (uint32_t shelld = 0; shelld < ld; shelld++) {
+        hrr_step(nxyza * nxyzb, 1, lc, shellq, shelld, cd, x, y);
+        x = y;
+        y = (y == work[0]) ? work[1] : work[0];
+    }
+
+    /* ...d-shell transformations: batch (a,b,c,d) --> batch (a',b',c',d') */
+    const uint32_t nrya = (la == 2 && spheric) ? 5 : nxyza;
+    const uint32_t nryb = (lb == 2 && spheric) ? 5 : nxyzb;
+    const uint32_t nryc = (lc == 2 && spheric) ? 5 : nxyzc;
+    const uint32_t nryd = (ld == 2 && spheric) ? 5 : nxyzd;
+    if (ld == 2) {
+        d_transform(nxyza * nxyzb * nxyzc, 1, spheric, x, y);
+        x = y;
+        y = (y == work[0]) ? work[1] : work[0];
+    }
+    if (lc == 2) {
+        d_transform(nxyza * nxyzb, nryd, spheric, x, y);
+        x = y;
+        y = (y == work[0]) ? work[1] : work[0];
+    }
+    if (lb == 2) {
+        d_transform(nxyza, nryc * nryd, spheric, x, y);
+        x = y;
+        y = (y == work[0]) ? work[1] : work[0];
+    }
+    if (la == 2) {
+        d_transform(1, nryb * nryc * nryd, spheric, x, y);
+        x = y;
+    }
+
+    /* ...final positioning: batch (a',b',c',d') --> batch (1,2,3,4) */
+    for (uint32_t a = 0; a < nrya; a++) {
+        for (uint32_t b = 0; b < nryb; b++) {
+            for (uint32_t c = 0; c < nryc; c++) {
+                for (uint32_t d = 0; d < nryd; d++) {
+                    batch[a * stride[0] + b * stride[1] + c * stride[2] + d * stride[3]] =
+                        x[((a * nryb + b) * nryc + c) * nryd + d];
+                }
+            }
+        }
+    }
+}
+
+
+#define ERD_2222_CLASS(la, lb, lc, ld) \
+static void erd__2222_##la##lb##lc##ld( \
+    bool spheric, uint32_t nij, uint32_t nkl, \
+    const double *restrict pairab, uint32_t npairab, \
+    const double *restrict paircd, uint32_t npaircd, \
+    const double xyza[restrict static 3], const double xyzc[restrict static 3], \
+    const double ab[restrict static 3], const double cd[restrict static 3], \
+    double factor, const uint32_t stride[restrict static 4], double *restrict batch) \
+{ \
+    d_class_kernel(la, lb, lc, ld, spheric, nij, nkl, pairab, npairab, paircd, npaircd, \
+        xyza, xyzc, ab, cd, factor, stride, batch); \
+}
+
+ERD_2222_CLASS(2, 0, 0, 0)
+ERD_2222_CLASS(2, 1, 0, 0)
+ERD_2222_CLASS(2, 0, 1, 0)
+ERD_2222_CLASS(2, 2, 0, 0)
+ERD_2222_CLASS(2, 1, 1, 0)
+ERD_2222_CLASS(2, 0, 2, 0)
+ERD_2222_CLASS(2, 0, 1, 1)
+
+typedef __typeof__(erd__2222_2000) *d_class_kernel_t;
+
+/* Indexed by the canonical shells la >= lb, lc >= ld, la + lb >= lc + ld */
+static const d_class_kernel_t d_class_kernels[3][3][3][3] = {
+    [2][0][0][0] = erd__2222_2000,
+    [2][1][0][0] = erd__2222_2100,
+    [2][0][1][0] = erd__2222_2010,
+    [2][2][0][0] = erd__2222_2200,
+    [2][1][1][0] = erd__2222_2110,
+    [2][0][2][0] = erd__2222_2020,
+    [2][0][1][1] = erd__2222_2011
+};
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__2222_CSGTO */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : ERD__SET_IJ_KL_PAIRS */
+/*                ERD__SET_PAIR_DATA */
+/*                ERD__SCREEN_PAIR_DATA */
+/*  DESCRIPTION : This operation calculates a batch of contracted */
+/*                electron repulsion integrals on up to four different */
+/*                centers between spherical or cartesian gaussian type */
+/*                shells. */
+/*                Special fast routine for integrals involving s-, p- */
+/*                and d-type shells with at least one d-shell and a */
+/*                total angular momentum of at most 4, that is the */
+/*                classes (ds|ss), (dp|ss), (ds|ps), (dd|ss), (dp|ps), */
+/*                (ds|ds), (ds|pp) and their permutations. Each class */
+/*                has its own kernel doing the primitive evaluation, */
+/*                contraction, HRR and d-shell transformation without */
+/*                going through the general ERD__CSGTO pipeline. The */
+/*                primitive pairs are taken and screened exactly as in */
+/*                ERD__CSGTO. */
+/*                  Input: */
+/*                    A,B,C,D      =  the shell indices */
+/*                    NPGTO        =  # of primitives per shell */
+/*                    SHELL        =  the shell types */
+/*                    XYZ0         =  the x,y,z-coordinates of the */
+/*                                    shell centers */
+/*                    ALPHA        =  primitive exponents per shell */
+/*                    MINALPHA     =  smallest exponent per shell */
+/*                    CC           =  contraction coefficients per shell */
+/*                    NORM         =  primitive norms per shell */
+/*                    SPHERIC      =  is true, if spherical integrals */
+/*                                    are wanted, false if cartesian */
+/*                                    ones */
+/*                    PAIRAB(CD)   =  cached primitive pair data of the */
+/*                                    shells A,B (C,D) holding */
+/*                                    NPAIRAB(CD) pairs, or NULL */
+/*                    TOL          =  primitive screening tolerance */
+/*                  Output: */
+/*                    NBATCH       =  # of integrals in batch */
+/*                    BATCH        =  full batch of contracted (12|34) */
+/*                                    integrals */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__2222_csgto(
+    uint32_t A, uint32_t B, uint32_t C, uint32_t D,
+    const uint32_t npgto[restrict static 1], const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    bool spheric,
+    const double *restrict pairab, uint32_t npairab, const double *restrict paircd, uint32_t npaircd,
+    double tol,
+    uint32_t buffer_capacity, uint32_t integrals_count[restrict static 1], double integrals_ptr[restrict static 1])
+{
+#ifdef __ERD_PROFILE__
+    #ifdef _OPENMP
+        const int tid = omp_get_thread_num();
+    #else
+        const int tid = 0;
+    #endif
+#endif
+    ERD_PROFILE_START(erd__2222_csgto)
+
+    const uint32_t shell1 = shell[A], shell2 = shell[B], shell3 = shell[C], shell4 = shell[D];
+    const uint32_t shellt = shell1 + shell2 + shell3 + shell4;
+    const uint32_t mxshell = max4x32u(shell1, shell2, shell3, shell4);
+    const bool atomic = ((A ^ B) | (B ^ C) | (C ^ D)) == 0;
+    if (atomic && (((shellt % 2) == 1) || (spheric && (2 * mxshell > shellt)))) {
+        *integrals_count = 0;
+        ERD_PROFILE_END(erd__2222_csgto)
+        return;
+    }
+
+    /* ...the batch strides of the 1,2,3,4 ry-components */
+    const uint32_t shells[4] = { shell1, shell2, shell3, shell4 };
+    uint32_t batch_stride[4];
+    uint32_t nxyzt = 1;
+    for (uint32_t i = 0; i < 4; i++) {
+        batch_stride[i] = nxyzt;
+        nxyzt *= spheric ? 2 * shells[i] + 1 : (shells[i] + 1) * (shells[i] + 2) / 2;
+    }
+    assert(nxyzt <= buffer_capacity);
+
+    /* ...order the shells as la >= lb, lc >= ld and la + lb >= lc + ld
+          and carry the strides and pair data along */
+    uint32_t index[4] = { A, B, C, D };
+    uint32_t position[4] = { 0, 1, 2, 3 };
+    if (shell[index[0]] < shell[index[1]]) {
+        ERD_SWAP(index[0], index[1]);
+        ERD_SWAP(position[0], position[1]);
+    }
+    if (shell[index[2]] < shell[index[3]]) {
+        ERD_SWAP(index[2], index[3]);
+        ERD_SWAP(position[2], position[3]);
+    }
+    const uint32_t preshellp = shell[index[0]] + shell[index[1]];
+    const uint32_t preshellq = shell[index[2]] + shell[index[3]];
+    if ((preshellp < preshellq) || ((preshellp == preshellq) && (shell[index[0]] < shell[index[2]]))) {
+        ERD_SWAP(index[0], index[2]);
+        ERD_SWAP(index[1], index[3]);
+        ERD_SWAP(position[0], position[2]);
+        ERD_SWAP(position[1], position[3]);
+        ERD_SWAP(pairab, paircd);
+        ERD_SWAP(npairab, npaircd);
+    }
+    const uint32_t a = index[0], b = index[1], c = index[2], d = index[3];
+    const uint32_t stride[4] = {
+        batch_stride[position[0]], batch_stride[position[1]], batch_stride[position[2]], batch_stride[position[3]]
+    };
+    const d_class_kernel_t kernel = d_class_kernels[shell[a]][shell[b]][shell[c]][shell[d]];
+    assert(kernel != NULL);
+
+    const double *xyza = &xyz0[a*4], *xyzb = &xyz0[b*4], *xyzc = &xyz0[c*4], *xyzd = &xyz0[d*4];
+    const double ab[3] = { xyza[0] - xyzb[0], xyza[1] - xyzb[1], xyza[2] - xyzb[2] };
+    const double cd[3] = { xyzc[0] - xyzd[0], xyzc[1] - xyzd[1], xyzc[2] - xyzd[2] };
+
+    /* ...the ij and kl primitive pair data, from the shell pair cache
+          if given, otherwise set up here */
+    const uint32_t npgtoa = npgto[a], npgtob = npgto[b], npgtoc = npgto[c], npgtod = npgto[d];
+    const uint32_t npgtoab = (pairab == NULL) ? npgtoa * npgtob : 0;
+    const uint32_t npgtocd = (paircd == NULL) ? npgtoc * npgtod : 0;
+    ERD_SIMD_ALIGN double pairdataab[erd__pair_data_size(npgtoab, 1)];
+    ERD_SIMD_ALIGN double pairdatacd[erd__pair_data_size(npgtocd, 1)];
+    if ((pairab == NULL) || (paircd == NULL)) {
+        ERD_PROFILE_START(erd__2222_set_ij_kl_pairs)
+        ERD_SIMD_ALIGN uint32_t prima[PAD_LEN(npgtoa * npgtob)], primb[PAD_LEN(npgtoa * npgtob)];
+        ERD_SIMD_ALIGN uint32_t primc[PAD_LEN(npgtoc * npgtod)], primd[PAD_LEN(npgtoc * npgtod)];
+        ERD_SIMD_ALIGN double rhoab[PAD_LEN(npgtoa * npgtob)];
+        ERD_SIMD_ALIGN double rhocd[PAD_LEN(npgtoc * npgtod)];
+        uint32_t mij, mkl;
+        erd__set_ij_kl_pairs(npgtoa, npgtob, npgtoc, npgtod,
+            minalpha[a], minalpha[b], minalpha[c], minalpha[d],
+            xyza[0], xyza[1], xyza[2], xyzb[0], xyzb[1], xyzb[2],
+            xyzc[0], xyzc[1], xyzc[2], xyzd[0], xyzd[1], xyzd[2],
+            ab[0] * ab[0] + ab[1] * ab[1] + ab[2] * ab[2],
+            cd[0] * cd[0] + cd[1] * cd[1] + cd[2] * cd[2],
+            PREFACT, tol,
+            alpha[a], alpha[b], alpha[c], alpha[d],
+            &mij, &mkl,
+            prima, primb, primc, primd,
+            rhoab, rhocd);
+        if (pairab == NULL) {
+            npairab = mij;
+            erd__set_pair_data(npairab, prima, primb, rhoab, xyza, xyzb, shell[a], shell[b],
+                npgtoa, npgtob, 1, 1,
+                alpha[a], alpha[b], cc[a], cc[b], norm[a], norm[b], pairdataab);
+            pairab = pairdataab;
+        }
+        if (paircd == NULL) {
+            npaircd = mkl;
+            erd__set_pair_data(npaircd, primc, primd, rhocd, xyzc, xyzd, shell[c], shell[d],
+                npgtoc, npgtod, 1, 1,
+                alpha[c], alpha[d], cc[c], cc[d], norm[c], norm[d], pairdatacd);
+            paircd = pairdatacd;
+        }
+        ERD_PROFILE_END(erd__2222_set_ij_kl_pairs)
+    }
+    if (npairab * npaircd == 0) {
+        *integrals_count = 0;
+        ERD_PROFILE_END(erd__2222_csgto)
+        return;
+    }
+    const uint32_t nij = erd__screen_pair_data(npairab, pairab, paircd[ERD_PAIR_BOUND * PAD_LEN(npaircd)], tol);
+    const uint32_t nkl = erd__screen_pair_data(npaircd, paircd, pairab[ERD_PAIR_BOUND * PAD_LEN(npairab)], tol);
+    if (nij * nkl == 0) {
+        *integrals_count = 0;
+        ERD_PROFILE_END(erd__2222_csgto)
+        return;
+    }
+
+    /* ...the overall norm factor SPNORM: each p-type shell -> * 2.0 */
+    double spnorm = 1.0;
+    for (uint32_t i = 0; i < 4; i++) {
+        if (shells[i] == 1) {
+            spnorm += spnorm;
+        }
+    }
+
+    ERD_PROFILE_START(erd__2222_pcgto_block)
+    kernel(spheric, nij, nkl, pairab, npairab, paircd, npaircd,
+        xyza, xyzc, ab, cd, PREFACT * spnorm, stride, integrals_ptr);
+    ERD_PROFILE_END(erd__2222_pcgto_block)
+
+    *integrals_count = nxyzt;
+    ERD_PROFILE_END(erd__2222_csgto)
+}
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(pop)
+#endif
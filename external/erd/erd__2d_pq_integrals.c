@@ -70,7 +70,9 @@
 /*                    INT2Dx      =  all 2D PQ integrals for each */
 /*                                   cartesian component (x = X,Y,Z) */
 /* ------------------------------------------------------------------------ */
-int erd__2d_pq_integrals (int shellp, int shellq,
+/* The VRR for shells P and Q, inlined into erd__2d_pq_integrals for the */
+/* general case and into the class kernels below with constant shells. */
+static ERD_FORCE_INLINE int pq_integrals_kernel (int shellp, int shellq,
                           int ngqexq, double *b00,
                           double *b01, double *b10, double *c00x,
                           double *c00y, double *c00z,
@@ -477,6 +479,64 @@ int erd__2d_pq_integrals (int shellp, int shellq,
 }
 
 
+
+/* Kernel of the class (P|Q): shells, VRR case and trip counts are */
+/* compile-time constants */
+#define ERD_PQ_CLASS(P, Q) \
+static int pq_integrals_##P##Q (int ngqexq, double *b00, double *b01, double *b10, \
+                                double *c00x, double *c00y, double *c00z, \
+                                double *d00x, double *d00y, double *d00z, \
+                                double *int2dx, double *int2dy, double *int2dz) \
+{ \
+    return pq_integrals_kernel(P, Q, ngqexq, b00, b01, b10, c00x, c00y, c00z, d00x, d00y, d00z, \
+                               MIN(2, Q) * 3 + MIN(2, P) + 1, int2dx, int2dy, int2dz); \
+}
+
+#define ERD_PQ_CLASSES(P) \
+    ERD_PQ_CLASS(P, 0) ERD_PQ_CLASS(P, 1) ERD_PQ_CLASS(P, 2) \
+    ERD_PQ_CLASS(P, 3) ERD_PQ_CLASS(P, 4) ERD_PQ_CLASS(P, 5) \
+    ERD_PQ_CLASS(P, 6) ERD_PQ_CLASS(P, 7) ERD_PQ_CLASS(P, 8)
+
+ERD_PQ_CLASSES(0) ERD_PQ_CLASSES(1) ERD_PQ_CLASSES(2)
+ERD_PQ_CLASSES(3) ERD_PQ_CLASSES(4) ERD_PQ_CLASSES(5)
+ERD_PQ_CLASSES(6) ERD_PQ_CLASSES(7) ERD_PQ_CLASSES(8)
+
+#define ERD_PQ_ENTRIES(P) \
+    { pq_integrals_##P##0, pq_integrals_##P##1, pq_integrals_##P##2, \
+      pq_integrals_##P##3, pq_integrals_##P##4, pq_integrals_##P##5, \
+      pq_integrals_##P##6, pq_integrals_##P##7, pq_integrals_##P##8 }
+
+typedef int (*pq_class_kernel_t) (int ngqexq, double *b00, double *b01, double *b10,
+                                  double *c00x, double *c00y, double *c00z,
+                                  double *d00x, double *d00y, double *d00z,
+                                  double *int2dx, double *int2dy, double *int2dz);
+
+/* Indexed by [shellp][shellq] for shells up to g on every center */
+static const pq_class_kernel_t pq_class_kernels[9][9] = {
+    ERD_PQ_ENTRIES(0), ERD_PQ_ENTRIES(1), ERD_PQ_ENTRIES(2),
+    ERD_PQ_ENTRIES(3), ERD_PQ_ENTRIES(4), ERD_PQ_ENTRIES(5),
+    ERD_PQ_ENTRIES(6), ERD_PQ_ENTRIES(7), ERD_PQ_ENTRIES(8)
+};
+
+
+int erd__2d_pq_integrals (int shellp, int shellq,
+                          int ngqexq, double *b00,
+                          double *b01, double *b10, double *c00x,
+                          double *c00y, double *c00z,
+                          double *d00x, double *d00y,
+                          double *d00z, int case2d,
+                          double *int2dx, double *int2dy,
+                          double *int2dz)
+{
+    if ((shellp <= 8) && (shellq <= 8))
+    {
+        return pq_class_kernels[shellp][shellq](ngqexq, b00, b01, b10, c00x, c00y, c00z,
+                                                d00x, d00y, d00z, int2dx, int2dy, int2dz);
+    }
+    return pq_integrals_kernel(shellp, shellq, ngqexq, b00, b01, b10, c00x, c00y, c00z,
+                               d00x, d00y, d00z, case2d, int2dx, int2dy, int2dz);
+}
+
 #ifdef __INTEL_OFFLOAD
 #pragma offload_attribute(pop)
 #endif
@@ -9,12 +9,61 @@
 #include "erd.h"
 #include "erdutil.h"
 
+/* The second HRR and transformation stage of a batch (XY|XY) for its
+   diagonal elements (rx,ry|rx,ry) only: the invariant elements l = (rx,ry)
+   of batch (l,e0) are the ry-components of the other side, and just the
+   monomials of the rx- and ry-rows of the transformation matrices pass
+   through the HRR. The arguments are those of ERD__HRR_RY_TRANSFORM, less
+   M, NXYZY and LANE. */
+ERD_OFFLOAD static void hrr_ry_diagonal(uint32_t nxyzx,
+    uint32_t nrowhrr, const uint32_t *restrict lrowhrr, const uint32_t *restrict rowhrr, const double *restrict thrr,
+    uint32_t nryx, uint32_t nrowx, const uint32_t *restrict lrowx, const uint32_t *restrict rowx, const double *restrict rotx, const double *restrict normx,
+    uint32_t nryy, uint32_t nrowy, const uint32_t *restrict lrowy, const uint32_t *restrict rowy, const double *restrict roty, const double *restrict normy,
+    size_t sx, size_t sy,
+    const double x[restrict], double y[restrict])
+{
+    const uint32_t m = nryx * nryy;
+    for (uint32_t ry = 0; ry < nryy; ry++) {
+        const uint32_t my = (roty != NULL) ? lrowy[ry] : 1;
+        for (uint32_t rx = 0; rx < nryx; rx++) {
+            const uint32_t l = rx + nryx * ry;
+            const uint32_t mx = (rotx != NULL) ? lrowx[rx] : 1;
+            double sum = 0.0;
+            for (uint32_t j = 0; j < my; j++) {
+                const uint32_t b = (roty != NULL) ? rowy[ry * nrowy + j] : ry;
+                const double wy = (roty != NULL) ? roty[ry * nrowy + j] : ((normy != NULL) ? normy[b] : 1.0);
+                for (uint32_t i = 0; i < mx; i++) {
+                    const uint32_t a = (rotx != NULL) ? rowx[rx * nrowx + i] : rx;
+                    const double wx = (rotx != NULL) ? rotx[rx * nrowx + i] : ((normx != NULL) ? normx[a] : 1.0);
+                    const uint32_t n = a + nxyzx * b;
+                    /* ...the (a,b) column of the HRR, or the e0-element
+                       itself if the y-part is an s-shell */
+                    double e = 0.0;
+                    if (lrowhrr != NULL) {
+                        const uint32_t *rown = &rowhrr[n * nrowhrr];
+                        const double *tb = &thrr[b * nrowhrr];
+                        for (uint32_t k = 0; k < lrowhrr[b]; k++) {
+                            e += tb[k] * x[(rown[k] - 1) * m + l];
+                        }
+                    } else {
+                        e = x[n * m + l];
+                    }
+                    sum += wx * wy * e;
+                }
+            }
+            y[rx * sx + ry * sy] = sum;
+        }
+    }
+}
+
+
 /* ------------------------------------------------------------------------ */
 /*  OPERATION   : ERD__CSGTO */
 /*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
 /*  MODULE-ID   : ERD */
 /*  SUBROUTINES : ERD__SET_ABCD */
 /*                ERD__SET_IJ_KL_PAIRS */
+/*                ERD__SCREEN_PAIR_DATA */
 /*                ERD__E0F0_DEF_BLOCKS */
 /*                ERD__PREPARE_CTR */
 /*                ERD__E0F0_PCGTO_BLOCK */
@@ -23,13 +72,8 @@
 /*                ERD__CTR_TU_EXPAND */
 /*                ERD__CTR_4INDEX_REORDER */
 /*                ERD__TRANSPOSE_BATCH */
-/*                ERD__XYZ_TO_RY_ABCD */
-/*                ERD__CARTESIAN_NORMS */
 /*                ERD__HRR_MATRIX */
-/*                ERD__HRR_TRANSFORM */
-/*                ERD__SPHERICAL_TRANSFORM */
-/*                ERD__NORMALIZE_CARTESIAN */
-/*                ERD__MOVE_RY */
+/*                ERD__HRR_RY_TRANSFORM */
 /*  DESCRIPTION : This operation calculates a batch of contracted */
 /*                electron repulsion integrals on up to four different */
 /*                centers between spherical or cartesian gaussian type */
@@ -79,10 +123,22 @@
 /*                    SPHERIC      =  is true, if spherical integrals */
 /*                                    are wanted, false if cartesian */
 /*                                    ones are wanted */
+/*                    HRRAB(CD)_   =  int and flp HRR matrix data of */
+/*                    INDEX,VALUE     the AB (CD) shell pair (see */
+/*                                    ERD__HRR_PAIR_MATRIX), or NULL */
+/*                                    to build it here */
+/*                    RYINDEX      =  int and flp tables of the */
+/*                    RYVALUE         cartesian -> spherical matrices */
+/*                                    and cartesian norms of all shells */
+/*                                    (see ERD__RY_TABLE) */
 /*                    SCREEN       =  is true, if screening will be */
 /*                                    done at primitive integral level */
 /*                    ICORE        =  int output_buffer space */
 /*                    ZCORE (part) =  flp output_buffer space */
+/*                    SCRATCH      =  arena of at least ERD__SCRATCH_CSGTO */
+/*                                    bytes, aligned to ERD_SCRATCH_ALIGN, */
+/*                                    for all the temporaries of the */
+/*                                    batch */
 /*                  Output: */
 /*                    NBATCH       =  # of integrals in batch */
 /*                    NFIRST       =  first address location inside the */
@@ -148,14 +204,45 @@
 /*                inclusion in evaluating the primitive cartesian */
 /*                [E0|F0] integrals will be essential for numerical */
 /*                stability during contraction. */
+/*                If DST is given, the finished batch is not left at the */
+/*                head of the flp array but stored into DST with index */
+/*                strides LD (see ERD__STORE_BATCH). The final ry-move */
+/*                of the A-part is then done by the store itself. */
+/*                Primitive pairs whose contribution is estimated to be */
+/*                below TOL are skipped (see ERD__SCREEN_PAIR_DATA), a */
+/*                non-positive TOL evaluates all primitive pairs. */
+/*                For generally contracted shells (NCGTOx > 1) the */
+/*                primitive [e0|f0] blocks are evaluated once and */
+/*                contracted into all rstu contraction quadruplets by */
+/*                ERD__CTR_4INDEX_BLOCK, after which each quadruplet */
+/*                goes through the HRR and transformation stages into */
+/*                its place in the final batch. The contractions of a */
+/*                shell follow each other there, each spanning the */
+/*                ry-components of the shell, just as consecutive */
+/*                shells of one contraction would. */
+/*                ERD__CSGTO_DIAGONAL evaluates only the diagonal */
+/*                elements (ab|ab) of a batch (AB|AB), as needed for */
+/*                Schwarz bounds, into batch (1,2) at the head of the */
+/*                flp array. It contracts only the rstu quadruplets */
+/*                with tu = rs, and the AB-part HRR and transformation */
+/*                stage produces the single diagonal element of each */
+/*                [c'd'] component. */
 /* ------------------------------------------------------------------------ */
-ERD_OFFLOAD void erd__csgto(
+ERD_OFFLOAD static inline void erd__csgto_batch(
     uint32_t A, uint32_t B, uint32_t C, uint32_t D,
-    const uint32_t npgto[restrict static 1], const uint32_t shell[restrict static 1], const double xyz0[restrict static 1],
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
     const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
     int **vrrtab,
+    const uint32_t ryindex[restrict static 1], const double ryvalue[restrict static 1],
     bool spheric,
-    uint32_t buffer_capacity, uint32_t output_length[restrict static 1], double output_buffer[restrict static 1])
+    const double *restrict pairab, uint32_t npairab, const double *restrict paircd, uint32_t npaircd,
+    const uint32_t *restrict hrrab_index, const double *restrict hrrab_value,
+    const uint32_t *restrict hrrcd_index, const double *restrict hrrcd_value,
+    double tol,
+    uint32_t buffer_capacity, uint32_t output_length[restrict static 1], double output_buffer[restrict static 1],
+    void *restrict scratch,
+    double *restrict dst, const size_t *restrict ld, bool diagonal)
 {
 #ifdef __ERD_PROFILE__
     #ifdef _OPENMP
@@ -198,6 +285,7 @@ ERD_OFFLOAD void erd__csgto(
     double xd = xyz0[D*4], yd = xyz0[D*4+1], zd = xyz0[D*4+2];
     const uint32_t shella = shell[A], shellb = shell[B], shellc = shell[C], shelld = shell[D];
     const uint32_t npgtoa = npgto[A], npgtob = npgto[B], npgtoc = npgto[C], npgtod = npgto[D];
+    const uint32_t ncgtoa = ncgto[A], ncgtob = ncgto[B], ncgtoc = ncgto[C], ncgtod = ncgto[D];
     const double *restrict alphaa = alpha[A], *restrict alphab = alpha[B], *restrict alphac = alpha[C], *restrict alphad = alpha[D];
     const double *restrict cca = cc[A], *restrict ccb = cc[B], *restrict ccc = cc[C], *restrict ccd = cc[D];
     const double *restrict norma = norm[A], *restrict normb = norm[B], *restrict normc = norm[C], *restrict normd = norm[D];
@@ -222,7 +310,6 @@ ERD_OFFLOAD void erd__csgto(
 /*                each p-type shell -> * 2.0. */
     const uint32_t shellp = shella + shellb;
     const uint32_t shellq = shellc + shelld;
-    const uint32_t mxshell = max4x32u(shella, shellb, shellc, shelld);
     const uint32_t nxyzp = (shellp + 1) * (shellp + 2) / 2;
     const uint32_t nxyzq = (shellq + 1) * (shellq + 2) / 2;
     // spnorm
@@ -244,86 +331,217 @@ ERD_OFFLOAD void erd__csgto(
 
    
 /*             ...enter the cartesian contracted (e0|f0) batch */
-/*                generation. Set the ij and kl primitive exponent */
-/*                pairs and the corresponding exponential prefactors. */
-    const uint32_t npgtoab = npgtoa * npgtob;
-    const uint32_t npgtocd = npgtoc * npgtod;
-    const uint32_t nxyzt = nxyzet * nxyzft;
+/*                generation. Take the ij and kl primitive pair data */
+/*                from the shell pair cache if given, otherwise set the */
+/*                ij and kl primitive exponent pairs and the */
+/*                corresponding exponential prefactors here. */
+    if (indexa >= 2) {
+        ERD_SWAP(pairab, paircd);
+        ERD_SWAP(npairab, npaircd);
+        ERD_SWAP(hrrab_index, hrrcd_index);
+        ERD_SWAP(hrrab_value, hrrcd_value);
+    }
+    const uint32_t npgtoab = (pairab == NULL) ? npgtoa * npgtob : 0;
+    const uint32_t npgtocd = (paircd == NULL) ? npgtoc * npgtod : 0;
+    const uint32_t nrs = ncgtoa * ncgtob;
+    const uint32_t ntu = ncgtoc * ncgtod;
+    const uint32_t nctr = nrs * ntu;
 
-    ERD_SIMD_ALIGN uint32_t prima[PAD_LEN(npgtoab)], primb[PAD_LEN(npgtoab)], primc[PAD_LEN(npgtocd)], primd[PAD_LEN(npgtocd)];
-    ERD_SIMD_ALIGN double rhoab[PAD_LEN(npgtoab)];
-    ERD_SIMD_ALIGN double rhocd[PAD_LEN(npgtocd)];
-    uint32_t nij, nkl;
-    ERD_PROFILE_START(erd__set_ij_kl_pairs)
-    erd__set_ij_kl_pairs(npgtoa, npgtob, npgtoc, npgtod,
-        minalpha[A], minalpha[B], minalpha[C], minalpha[D],
-        xa, ya, za,
-        xb, yb, zb,
-        xc, yc, zc,
-        xd, yd, zd,
-        rnabsq, rncdsq, PREFACT,
-        alphaa, alphab, alphac, alphad,
-        &nij, &nkl,
-        prima, primb, primc, primd,
-        rhoab, rhocd);
-    ERD_PROFILE_END(erd__set_ij_kl_pairs)
+    char *arena = scratch;
+    double *pairdataab = erd__scratch_alloc(&arena, sizeof(double) * erd__pair_data_size(npgtoab, nrs));
+    double *pairdatacd = erd__scratch_alloc(&arena, sizeof(double) * erd__pair_data_size(npgtocd, ntu));
+    char *const arena_pairs = arena;
+    if ((pairab == NULL) || (paircd == NULL)) {
+        uint32_t *prima = erd__scratch_alloc(&arena, sizeof(uint32_t) * PAD_LEN(npgtoa * npgtob));
+        uint32_t *primb = erd__scratch_alloc(&arena, sizeof(uint32_t) * PAD_LEN(npgtoa * npgtob));
+        uint32_t *primc = erd__scratch_alloc(&arena, sizeof(uint32_t) * PAD_LEN(npgtoc * npgtod));
+        uint32_t *primd = erd__scratch_alloc(&arena, sizeof(uint32_t) * PAD_LEN(npgtoc * npgtod));
+        double *rhoab = erd__scratch_alloc(&arena, sizeof(double) * PAD_LEN(npgtoa * npgtob));
+        double *rhocd = erd__scratch_alloc(&arena, sizeof(double) * PAD_LEN(npgtoc * npgtod));
+        uint32_t mij, mkl;
+        ERD_PROFILE_START(erd__set_ij_kl_pairs)
+        erd__set_ij_kl_pairs(npgtoa, npgtob, npgtoc, npgtod,
+            minalpha[A], minalpha[B], minalpha[C], minalpha[D],
+            xa, ya, za,
+            xb, yb, zb,
+            xc, yc, zc,
+            xd, yd, zd,
+            rnabsq, rncdsq, PREFACT, tol,
+            alphaa, alphab, alphac, alphad,
+            &mij, &mkl,
+            prima, primb, primc, primd,
+            rhoab, rhocd);
+/*             ...the contraction pairs of the pair data run over */
+/*                the contractions of the higher numbered shell first, */
+/*                as in the shell pair cache (see ERD__SHELL_PAIR_DATA). */
+        if (pairab == NULL) {
+            npairab = mij;
+            if ((nrs > 1) && (A < B)) {
+                erd__set_pair_data(npairab, primb, prima, rhoab,
+                    &xyz0[B*4], &xyz0[A*4], shellb, shella,
+                    npgtob, npgtoa, ncgtob, ncgtoa,
+                    alphab, alphaa, ccb, cca, normb, norma,
+                    pairdataab);
+            } else {
+                erd__set_pair_data(npairab, prima, primb, rhoab,
+                    &xyz0[A*4], &xyz0[B*4], shella, shellb,
+                    npgtoa, npgtob, ncgtoa, ncgtob,
+                    alphaa, alphab, cca, ccb, norma, normb,
+                    pairdataab);
+            }
+            pairab = pairdataab;
+        }
+        if (paircd == NULL) {
+            npaircd = mkl;
+            if ((ntu > 1) && (C < D)) {
+                erd__set_pair_data(npaircd, primd, primc, rhocd,
+                    &xyz0[D*4], &xyz0[C*4], shelld, shellc,
+                    npgtod, npgtoc, ncgtod, ncgtoc,
+                    alphad, alphac, ccd, ccc, normd, normc,
+                    pairdatacd);
+            } else {
+                erd__set_pair_data(npaircd, primc, primd, rhocd,
+                    &xyz0[C*4], &xyz0[D*4], shellc, shelld,
+                    npgtoc, npgtod, ncgtoc, ncgtod,
+                    alphac, alphad, ccc, ccd, normc, normd,
+                    pairdatacd);
+            }
+            paircd = pairdatacd;
+        }
+        ERD_PROFILE_END(erd__set_ij_kl_pairs)
+        arena = arena_pairs;
+    }
+    if (npairab * npaircd == 0) {
+        *output_length = 0;
+        ERD_PROFILE_END(erd__csgto)
+        return;
+    }
 
+/*             ...primitive screening of the ij pairs against the */
+/*                largest kl pair bound and vice versa. The pairs are */
+/*                ordered by decreasing bound, so the first one of each */
+/*                list holds its largest bound. */
+    const uint32_t nij = erd__screen_pair_data(npairab, pairab, paircd[ERD_PAIR_BOUND * PAD_LEN(npaircd)], tol);
+    const uint32_t nkl = erd__screen_pair_data(npaircd, paircd, pairab[ERD_PAIR_BOUND * PAD_LEN(npairab)], tol);
     if (nij * nkl == 0) {
         *output_length = 0;
         ERD_PROFILE_END(erd__csgto)
         return;
     }
 
-/*             ...decide on the primitive [e0|f0] block size and */
-/*                return array sizes and pointers for the primitive */
-/*                [e0|f0] generation. Perform also some preparation */
-/*                steps for contraction. */
-
-    ERD_PROFILE_START(erd__prepare_ctr)
-    const double factor = PREFACT * spnorm;
-    const uint32_t npmin = min4x32u(npgtoa, npgtob, npgtoc, npgtod);
-    ERD_SIMD_ALIGN double scaled_norm[PAD_LEN(npmin)];
-    if (npgtoa == npmin) {
-        for (uint32_t i = 0; i < npgtoa; i++) {
-            scaled_norm[i] = factor * norma[i];
-        }
-        norma = &scaled_norm[0];
-    } else if (npgtob == npmin) {
-        for (uint32_t i = 0; i < npgtob; i++) {
-            scaled_norm[i] = factor * normb[i];
+/*             ...evaluate unnormalized rescaled [e0|f0] in blocks */
+/*                over ij and kl pairs and add to final contracted */
+/*                (e0|f0). The overall prefactor and the s- and p-shell */
+/*                norms SPNORM are applied during the evaluation. The */
+/*                blocks are sized by ERD__E0F0_DEF_BLOCKS so that the */
+/*                2D integrals and VRR coefficients of a block stay in */
+/*                cache. A block starts at its first pair in the pair */
+/*                data, whose arrays keep the stride of all pairs. */
+    const uint32_t nxyzt = nxyzet * nxyzft;
+    uint32_t mij, mkl;
+    double *ctr = NULL;
+    ERD_PROFILE_START(erd__e0f0_pcgto_block)
+    erd__e0f0_def_blocks(erd_block_size, nij, nkl, shellp, shellq,
+        (nctr > 1) ? nxyzt : 0, &mij, &mkl);
+    if ((nctr > 1) && diagonal) {
+/*             ...the diagonal of a batch (XY|XY) only needs the rstu */
+/*                quadruplets with tu = rs, batch (nxyzt,rs). */
+        const size_t simd_npairab = PAD_LEN(npairab);
+        const size_t simd_npaircd = PAD_LEN(npaircd);
+        ctr = erd__scratch_alloc(&arena, sizeof(double) * nrs * nxyzt);
+        memset(ctr, 0, sizeof(double) * nrs * nxyzt);
+        char *stage = arena;
+        double *batch = erd__scratch_alloc(&stage, sizeof(double) * nxyzt * mij * mkl);
+        double *work = erd__scratch_alloc(&stage, sizeof(double) * mij);
+        for (uint32_t ij = 0; ij < nij; ij += mij) {
+            for (uint32_t kl = 0; kl < nkl; kl += mkl) {
+                const uint32_t bij = min32u(mij, nij - ij);
+                const uint32_t bkl = min32u(mkl, nkl - kl);
+                erd__e0f0_pcgto_block(
+                                       A, B, C, D,
+                                       bij, bkl,
+                                       nxyzet, nxyzft,
+                                       shell, xyz0,
+                                       vrrtab,
+                                       PREFACT * spnorm, false,
+                                       &pairab[ij], npairab, &paircd[kl], npaircd,
+                                       stage, batch);
+                ERD_PROFILE_START(erd__ctr_4index_block)
+                for (uint32_t rs = 0; rs < nrs; rs++) {
+                    erd__ctr_4index_block(nxyzt, bij, bkl, 1, 1,
+                                           &pairab[(ERD_PAIR_ARRAYS + rs) * simd_npairab + ij], simd_npairab,
+                                           &paircd[(ERD_PAIR_ARRAYS + rs) * simd_npaircd + kl], simd_npaircd,
+                                           batch, work, &ctr[rs * nxyzt]);
+                }
+                ERD_PROFILE_END(erd__ctr_4index_block)
+            }
         }
-        normb = &scaled_norm[0];
-    } else if (npgtoc == npmin) {
-        for (uint32_t i = 0; i < npgtoc; i++) {
-            scaled_norm[i] = factor * normc[i];
+    } else if (nctr > 1) {
+/*             ...general contractions: each block of primitive [e0|f0] */
+/*                integrals is contracted into all rstu quadruplets of */
+/*                the batch (nxyzt,rs,tu). The coefficient products of */
+/*                the pairs follow the ERD_PAIR_ARRAYS arrays of the */
+/*                pair data; a pair of segmented shells has them in its */
+/*                scale factors instead. */
+        const size_t simd_npairab = PAD_LEN(npairab);
+        const size_t simd_npaircd = PAD_LEN(npaircd);
+        ctr = erd__scratch_alloc(&arena, sizeof(double) * nctr * nxyzt);
+        memset(ctr, 0, sizeof(double) * nctr * nxyzt);
+        char *stage = arena;
+        double *batch = erd__scratch_alloc(&stage, sizeof(double) * nxyzt * mij * mkl);
+        double *work = erd__scratch_alloc(&stage, sizeof(double) * mij * ntu);
+        for (uint32_t ij = 0; ij < nij; ij += mij) {
+            for (uint32_t kl = 0; kl < nkl; kl += mkl) {
+                const uint32_t bij = min32u(mij, nij - ij);
+                const uint32_t bkl = min32u(mkl, nkl - kl);
+                erd__e0f0_pcgto_block(
+                                       A, B, C, D,
+                                       bij, bkl,
+                                       nxyzet, nxyzft,
+                                       shell, xyz0,
+                                       vrrtab,
+                                       PREFACT * spnorm, false,
+                                       &pairab[ij], npairab, &paircd[kl], npaircd,
+                                       stage, batch);
+                ERD_PROFILE_START(erd__ctr_4index_block)
+                erd__ctr_4index_block(nxyzt, bij, bkl, nrs, ntu,
+                                       (nrs > 1) ? &pairab[ERD_PAIR_ARRAYS * simd_npairab + ij] : NULL, simd_npairab,
+                                       (ntu > 1) ? &paircd[ERD_PAIR_ARRAYS * simd_npaircd + kl] : NULL, simd_npaircd,
+                                       batch, work, ctr);
+                ERD_PROFILE_END(erd__ctr_4index_block)
+            }
         }
-        normc = &scaled_norm[0];
+    } else if ((mij == nij) && (mkl == nkl)) {
+        erd__e0f0_pcgto_block(
+                               A, B, C, D,
+                               nij, nkl,
+                               nxyzet, nxyzft,
+                               shell, xyz0,
+                               vrrtab,
+                               PREFACT * spnorm, true,
+                               pairab, npairab, paircd, npaircd,
+                               arena, output_buffer);
     } else {
-        for (uint32_t i = 0; i < npgtod; i++) {
-            scaled_norm[i] = factor * normd[i];
+        char *stage = arena;
+        double *partial = erd__scratch_alloc(&stage, sizeof(double) * nxyzt);
+        memset(output_buffer, 0, sizeof(double) * nxyzt);
+        for (uint32_t ij = 0; ij < nij; ij += mij) {
+            for (uint32_t kl = 0; kl < nkl; kl += mkl) {
+                erd__e0f0_pcgto_block(
+                                       A, B, C, D,
+                                       min32u(mij, nij - ij), min32u(mkl, nkl - kl),
+                                       nxyzet, nxyzft,
+                                       shell, xyz0,
+                                       vrrtab,
+                                       PREFACT * spnorm, true,
+                                       &pairab[ij], npairab, &paircd[kl], npaircd,
+                                       stage, partial);
+                for (uint32_t n = 0; n < nxyzt; n++) {
+                    output_buffer[n] += partial[n];
+                }
+            }
         }
-        normd = &scaled_norm[0];
     }
-    ERD_PROFILE_END(erd__prepare_ctr)
-
-/*             ...evaluate unnormalized rescaled [e0|f0] in blocks */
-/*                over ij and kl pairs and add to final contracted */
-/*                (e0|f0). The keyword REORDER indicates, if the */
-/*                primitive [e0|f0] blocks need to be transposed */
-/*                before being contracted. */
-    ERD_PROFILE_START(erd__e0f0_pcgto_block)
-    erd__e0f0_pcgto_block(
-                           A, B, C, D,
-                           nij, nkl,
-                           nxyzet, nxyzft, nxyzp, nxyzq,
-                           shell, xyz0,
-                           alpha,
-                           cc,
-                           vrrtab,
-                           prima, primb, primc, primd,
-                           norma, normb, normc, normd,
-                           rhoab, rhocd,
-                           output_buffer);
     ERD_PROFILE_END(erd__e0f0_pcgto_block)
 /*             ...the unnormalized cartesian (e0|f0) contracted batch is */
 /*                ready. Expand the contraction indices (if necessary): */
@@ -351,61 +569,39 @@ ERD_OFFLOAD void erd__csgto(
 /*                following dimension inequality: */
 /*                              NXYZT =< NXYZHRR */
 
-    uint32_t in = 0;
-    uint32_t out = nxyzhrr;
-
 /*             ...enter the HRR contraction and cartesian -> spherical */
 /*                transformation / cartesian normalization section. */
-/*                The sequence of events is to apply the HRR followed */
-/*                by cartesian -> spherical transformations or cartesian */
-/*                normalizations and immediate final positioning of */
-/*                the finished parts to correspond with the contraction */
-/*                indices i,j,k,l. First we do the f0-part followed */
-/*                by the e0-part, which hence gives rise to the sequence */
+/*                Each side is done in one pass by ERD__HRR_RY_TRANSFORM, */
+/*                which applies the HRR followed by the cartesian -> */
+/*                spherical transformations or cartesian normalizations */
+/*                and the immediate final positioning of the finished */
+/*                parts. First we do the f0-part followed by the e0-part */
 /*                (where ' means spherical or cartesian normalization */
-/*                and [] means the indices are in correspondence): */
-/*                   batch (ijkl,e0,f0) --> batch (ijkl,e0,cd) */
-/*                   batch (ijkl,e0,c,d) --> batch (ijkl,e0,c,d') */
-/*                   batch (ijkl,e0,c,d') --> batch (ijkl[d'],e0,c) */
-/*                   batch (ijkl[d'],e0,c) --> batch (ijkl[d'],e0,c') */
-/*                   batch (ijkl[d'],e0,c') --> batch (ijkl[c'd'],e0) */
-/*                   batch (ijkl[c'd'],e0) --> batch (ijkl[c'd'],ab) */
-/*                   batch (ijkl[c'd'],a,b) --> batch (ijkl[c'd'],a,b') */
-/*                   batch (ijkl[c'd'],a,b') --> batch (ijkl[b'c'd'],a) */
-/*                   batch (ijkl[b'c'd'],a) --> batch (ijkl[b'c'd'],a') */
-/*                   batch (ijkl[b'c'd'],a') --> batch (ijkl[a'b'c'd']) */
+/*                and [] means the indices are in final order): */
+/*                   batch (e0,f0) --> batch ([c'd'],e0) */
+/*                   batch ([c'd'],e0) --> batch ([a'b'c'd']) */
 /*                The space partitioning of the flp array will be */
 /*                as follows: */
-/*                  |  Zone 1  |  Zone 2  |  Zone 3  |  Zone 4  | */
-/*                 Zone 1 and 2:  2 batches of MXSIZE maximum size */
-/*                                (set previously) */
-/*                       Zone 3:  cart -> spher transformation data */
-/*                                             or */
-/*                                cartesian normalization factors */
-/*                       Zone 4:  HRR contraction data */
-/*                Determine memory allocation offsets for the entire HRR */
-/*                procedure + cartesian -> spherical transformations or */
-/*                cartesian normalizations and generate the transformation */
-/*                matrices + associated data for those shells > p-shell. */
-/*                The offsets are as follows (x=A,B,C,D): */
-/*                    IN = offset for input HRR batch */
-/*                   OUT = offset for output HRR batch */
-/*                ZSROTx = offset for x-part transformation matrix */
-/*               ISNROWx = offset for # of non-zero XYZ contribution row */
-/*                         labels for x-part transformation matrix */
-/*                ISROWx = offset for non-zero XYZ contribution row */
-/*                         labels for x-part transformation matrix */
-/*                 ZHROT = offset for HRR transformation matrix */
-/*                IHNROW = offset for # of nonzero row labels for */
-/*                         each HRR matrix column */
-/*                 IHROW = offset for nonzero row labels for the HRR */
-/*                         matrix */
-/*                 IHSCR = int output_buffer space for HRR matrix */
-/*                         assembly */
+/*                  |  Zone 1  |  Zone 2  |  Zone 3  | */
+/*                 Zone 1 and 2:  2 batches of NXYZHRR maximum size */
+/*                                (set previously), holding the (e0,f0) */
+/*                                and the final batch in zone 1 and the */
+/*                                ([c'd'],e0) batch in zone 2 */
+/*                       Zone 3:  HRR contraction data */
+/*                The cartesian -> spherical transformation matrices + */
+/*                associated data or the cartesian normalizations of */
+/*                the shells are located in the tables set up once by */
+/*                ERD__RY_TABLE (x=A,B,C,D): */
+/*                  ROTx = x-part transformation matrix */
+/*                 LROWx = # of non-zero XYZ contribution row labels */
+/*                         for x-part transformation matrix */
+/*                  ROWx = non-zero XYZ contribution row labels for */
+/*                         x-part transformation matrix */
+/*             CARTNORMx = x-part cartesian normalization factors */
 /*                In case of s- or p-shells no transformation matrix is */
 /*                generated, hence if we have s- and/or p-shells, then */
-/*                no call to the cartesian -> spherical transformation */
-/*                or cartesian normalization routines needs to be done. */
+/*                no cartesian -> spherical transformation or cartesian */
+/*                normalization needs to be done. */
 /*                All integrals have already been multiplied by a factor */
 /*                SPNORM, which has the following value for each s- and */
 /*                p-shell: */
@@ -414,206 +610,264 @@ ERD_OFFLOAD void erd__csgto(
 /*                This factor was introduced together with the overall */
 /*                prefactor during evaluation of the primitive integrals */
 /*                in order to save multiplications. */
-    const uint32_t nrowmx = (mxshell / 2 + 1) * (mxshell / 2 + 2) / 2;
-    const uint32_t nrymx = 2*mxshell + 1;
-    const uint32_t nrotmx = nrowmx * nrymx;
-    ERD_SIMD_ALIGN double fbuffer[spheric ? PAD_LEN(nrotmx * 4) : 0];
-    ERD_SIMD_ALIGN uint32_t ibuffer[spheric ? PAD_LEN(nrotmx * 4 + nrya + nryb + nryc + nryd) : 0];
+    const uint32_t *lrowa = &ryindex[ryindex[2 * shella]], *lrowb = &ryindex[ryindex[2 * shellb]];
+    const uint32_t *lrowc = &ryindex[ryindex[2 * shellc]], *lrowd = &ryindex[ryindex[2 * shelld]];
+    const uint32_t *rowa = &lrowa[PAD_LEN(2 * shella + 1)], *rowb = &lrowb[PAD_LEN(2 * shellb + 1)];
+    const uint32_t *rowc = &lrowc[PAD_LEN(2 * shellc + 1)], *rowd = &lrowd[PAD_LEN(2 * shelld + 1)];
+    const double *rota = &ryvalue[ryindex[2 * shella + 1]], *rotb = &ryvalue[ryindex[2 * shellb + 1]];
+    const double *rotc = &ryvalue[ryindex[2 * shellc + 1]], *rotd = &ryvalue[ryindex[2 * shelld + 1]];
+    const uint32_t nrowa = ERD_RY_NROWMX(shella), nrowb = ERD_RY_NROWMX(shellb);
+    const uint32_t nrowc = ERD_RY_NROWMX(shellc), nrowd = ERD_RY_NROWMX(shelld);
+    const double *cartnorma = &rota[PAD_LEN(nrowa * (2 * shella + 1))], *cartnormb = &rotb[PAD_LEN(nrowb * (2 * shellb + 1))];
+    const double *cartnormc = &rotc[PAD_LEN(nrowc * (2 * shellc + 1))], *cartnormd = &rotd[PAD_LEN(nrowd * (2 * shelld + 1))];
 
-    ERD_SIMD_ALIGN double cartnorm[spheric ? 0 : PAD_LEN(mxshell + 1)];
-    uint32_t isrowa, isrowb, isrowc, isrowd;
-    uint32_t nrota, nrotb, nrotc, nrotd, nrowa, nrowb, nrowc, nrowd;
-    uint32_t zsrota, zsrotb, zsrotc, zsrotd;
-    uint32_t isnrowa, isnrowb, isnrowc, isnrowd;
-    if (mxshell > 1) {
-        if (spheric) {
-            ERD_PROFILE_START(erd__xyz_to_ry_abcd)
-            erd__xyz_to_ry_abcd(nxyza, nxyzb, nxyzc, nxyzd,
-                                 nrya, nryb, nryc, nryd,
-                                 shella, shellb, shellc, shelld,
-                                 &nrowa, &nrowb, &nrowc, &nrowd,
-                                 &nrota, &nrotb, &nrotc, &nrotd,
-                                 &zsrota, &zsrotb, &zsrotc, &zsrotd,
-                                 &isnrowa, &isnrowb, &isnrowc, &isnrowd,
-                                 &isrowa, &isrowb, &isrowc, &isrowd,
-                                 ibuffer, fbuffer);
-            ERD_PROFILE_END(erd__xyz_to_ry_abcd)
-        } else {
-            erd__cartesian_norms(mxshell, cartnorm);
+    const double *sphrota = (spheric && (shella > 1)) ? rota : NULL;
+    const double *sphrotb = (spheric && (shellb > 1)) ? rotb : NULL;
+    const double *sphrotc = (spheric && (shellc > 1)) ? rotc : NULL;
+    const double *sphrotd = (spheric && (shelld > 1)) ? rotd : NULL;
+    const double *normxa = (!spheric && (shella > 1)) ? cartnorma : NULL;
+    const double *normxb = (!spheric && (shellb > 1)) ? cartnormb : NULL;
+    const double *normxc = (!spheric && (shellc > 1)) ? cartnormc : NULL;
+    const double *normxd = (!spheric && (shelld > 1)) ? cartnormd : NULL;
+
+/*             ...strides of the final 1,2,3,4 indices: those of the */
+/*                caller array, if the batch is stored there directly, */
+/*                or those of the batch (1,2,3,4) at the start of the */
+/*                flp array. Each contraction of a shell spans the */
+/*                ry-components of the shell in its index. */
+    uint32_t nry[4];
+    nry[indexa] = nrya * ncgtoa;
+    nry[indexb] = nryb * ncgtob;
+    nry[indexc] = nryc * ncgtoc;
+    nry[indexd] = nryd * ncgtod;
+    size_t stride[4];
+    if (diagonal) {
+/*             ...the diagonal of a batch (XY|XY) is stored as batch */
+/*                (1,2): the A- and C-part are the same shell, at the */
+/*                first index if it is shell 1 or 3. */
+        const bool afirst = (indexa % 2) == 0;
+        stride[indexa] = afirst ? 1 : nry[indexb];
+        stride[indexb] = afirst ? nry[indexa] : 1;
+        stride[indexc] = 0;
+        stride[indexd] = 0;
+    } else if (dst != NULL) {
+        for (uint32_t i = 0; i < 4; i++) {
+            stride[i] = ld[i];
+        }
+    } else {
+        stride[0] = 1;
+        for (uint32_t i = 1; i < 4; i++) {
+            stride[i] = stride[i - 1] * nry[i - 1];
         }
     }
+    const uint32_t nrycd = nryc * nryd;
 
-/*             ...do the first stage of processing the integrals: */
-/*                   batch (ijkl,e0,f0) --> batch (ijkl,e0,cd) */
-/*                   batch (ijkl,e0,c,d) --> batch (ijkl,e0,c,d') */
-/*                   batch (ijkl,e0,c,d') --> batch (ijkl[d'],e0,c) */
-/*                   batch (ijkl[d'],e0,c) --> batch (ijkl[d'],e0,c') */
-/*                   batch (ijkl[d'],e0,c') --> batch (ijkl[c'd'],e0) */
-    uint32_t ixoff[4] = { 1, 1, 1, 1 };
-    if (shelld != 0) {
-        uint32_t pos1, pos2, nrowhrr;
-        ERD_SIMD_ALIGN double t[PAD_LEN(nrothrr*2)];
-        ERD_SIMD_ALIGN uint32_t row[PAD_LEN(nrothrr*2)];
-        ERD_SIMD_ALIGN uint32_t nrow[PAD_LEN(ncolhrr*2)];
+/*             ...the HRR matrices of the CD and AB pairs, if not set */
+/*                up in advance, and the lanes of the two stages. */
+    const bool cachedcd = (hrrcd_index != NULL) || (shelld == 0);
+    const bool cachedab = (hrrab_index != NULL) || (shellb == 0);
+    double *tcd = erd__scratch_alloc(&arena, sizeof(double) * (cachedcd ? 0 : PAD_LEN(nrothrr*2)));
+    uint32_t *rowcd = erd__scratch_alloc(&arena, sizeof(uint32_t) * (cachedcd ? 0 : PAD_LEN(nrothrr*2)));
+    uint32_t *nrowcd = erd__scratch_alloc(&arena, sizeof(uint32_t) * (cachedcd ? 0 : PAD_LEN(ncolhrr*2)));
+    double *tab = erd__scratch_alloc(&arena, sizeof(double) * (cachedab ? 0 : PAD_LEN(nrothrr*2)));
+    uint32_t *rowab = erd__scratch_alloc(&arena, sizeof(uint32_t) * (cachedab ? 0 : PAD_LEN(nrothrr*2)));
+    uint32_t *nrowab = erd__scratch_alloc(&arena, sizeof(uint32_t) * (cachedab ? 0 : PAD_LEN(ncolhrr*2)));
+    uint32_t nrowhrrcd = 0, nrowhrrab = 0;
+    const uint32_t *lrowhrrcd = NULL, *rowhrrcd = NULL;
+    const uint32_t *lrowhrrab = NULL, *rowhrrab = NULL;
+    const double *thrrcd = NULL, *thrrab = NULL;
+    if (shelld == 0) {
+        /* ...no HRR, f0 is the c-part */
+    } else if (hrrcd_index != NULL) {
+        nrowhrrcd = hrrcd_index[0];
+        lrowhrrcd = &hrrcd_index[1];
+        rowhrrcd = &hrrcd_index[PAD_LEN(nxyzd + 1)];
+        thrrcd = hrrcd_value;
+    } else {
+        uint32_t pos1 = 0, pos2 = 0;
         ERD_PROFILE_START(erd__hrr_matrix)
         erd__hrr_matrix(nrothrr, ncolhrr, nxyzft, nxyzc, nxyzq,
                          shellc, shelld, shellq,
                          ncdcoor, cdx, cdy, cdz,
-                         &pos1, &pos2, &nrowhrr,
-                         nrow, row, t);
+                         &pos1, &pos2, &nrowhrrcd,
+                         nrowcd, rowcd, tcd);
         ERD_PROFILE_END(erd__hrr_matrix)
-
-        ERD_PROFILE_START(erd__hrr_transform)
-        erd__hrr_transform(nxyzet, nrowhrr, nxyzc, nxyzd,
-                            &nrow[pos1],
-                            &row[pos2],
-                            &t[pos2], &output_buffer[in],
-                            &output_buffer[out]);
-        ERD_PROFILE_END(erd__hrr_transform)
-
-        ERD_SWAP(in, out);
-        if (shelld > 1) {
-            if (spheric) {
-                ERD_PROFILE_START(erd__spherical_transform)
-                erd__spherical_transform(nxyzet * nxyzc, nrowd, nryd,
-                                          (uint32_t*)&ibuffer[isnrowd], (uint32_t*)&ibuffer[isrowd],
-                                          &fbuffer[zsrotd], &output_buffer[in],
-                                          &output_buffer[out]);
-                ERD_PROFILE_END(erd__spherical_transform)
-
-                ERD_SWAP(in, out);
-            } else {
-                erd__normalize_cartesian(nxyzet * nxyzc, shelld, cartnorm, &output_buffer[in]);
-            }
-        }
+        lrowhrrcd = &nrowcd[pos1];
+        rowhrrcd = &rowcd[pos2];
+        thrrcd = &tcd[pos2];
     }
-    if (nryd > 1) {
-        const uint32_t batch_size = nxyzet * nxyzc * nryd;
-        const uint32_t notmove = ixoff[indexd];
-        const uint32_t move = batch_size / (notmove * nryd);
-        if (move > 1) {
-            ERD_PROFILE_START(erd__move_ry)
-            erd__move_ry(4, notmove, move, nryd, indexd, &output_buffer[in], ixoff, &output_buffer[out]);
-            ERD_PROFILE_END(erd__move_ry)
-
-            ERD_SWAP(in, out);
-        }
-    }
-    if (shellc > 1) {
-        if (spheric) {
-            ERD_PROFILE_START(erd__spherical_transform)
-            erd__spherical_transform(nxyzet * nryd, nrowc, nryc,
-                                      (uint32_t*)&ibuffer[isnrowc], (uint32_t*)&ibuffer[isrowc],
-                                      &fbuffer[zsrotc], &output_buffer[in],
-                                      &output_buffer[out]);
-            ERD_PROFILE_END(erd__spherical_transform)
-
-            ERD_SWAP(in, out);
-        } else {
-            erd__normalize_cartesian(nxyzet * nryd, shellc, cartnorm, &output_buffer[in]);
-        }
-    }
-    if (nryc > 1) {
-        const uint32_t batch_size = nryd * nxyzet * nryc;
-        const uint32_t notmove = ixoff[indexc];
-        const uint32_t move = batch_size / (notmove * nryc);
-        if (move > 1) {
-            ERD_PROFILE_START(erd__move_ry)
-            erd__move_ry(4, notmove, move, nryc, indexc, &output_buffer[in], ixoff, &output_buffer[out]);
-            ERD_PROFILE_END(erd__move_ry)
-
-            ERD_SWAP(in, out);
-        }
-    }
-
-    /*
-     * ...do the second stage of processing the integrals:
-     *    batch (ijkl[c'd'],e0) --> batch (ijkl[c'd'],ab)
-     *    batch (ijkl[c'd'],a,b) --> batch (ijkl[c'd'],a,b')
-     *    batch (ijkl[c'd'],a,b') --> batch (ijkl[b'c'd'],a)
-     *    batch (ijkl[b'c'd'],a) --> batch (ijkl[b'c'd'],a')
-     *    batch (ijkl[b'c'd'],a') --> batch (ijkl[a'b'c'd'])
-     */
-    if (shellb != 0) {
-        uint32_t pos1, pos2, nrowhrr;
-        ERD_SIMD_ALIGN double t[nrothrr*2];
-        ERD_SIMD_ALIGN uint32_t row[nrothrr*2];
-        ERD_SIMD_ALIGN uint32_t nrow[ncolhrr*2];
+    if (shellb == 0) {
+        /* ...no HRR, e0 is the a-part */
+    } else if (hrrab_index != NULL) {
+        nrowhrrab = hrrab_index[0];
+        lrowhrrab = &hrrab_index[1];
+        rowhrrab = &hrrab_index[PAD_LEN(nxyzb + 1)];
+        thrrab = hrrab_value;
+    } else {
+        uint32_t pos1 = 0, pos2 = 0;
         ERD_PROFILE_START(erd__hrr_matrix)
         erd__hrr_matrix(nrothrr, ncolhrr, nxyzet, nxyza, nxyzp,
                          shella, shellb, shellp,
                          nabcoor, abx, aby, abz,
-                         &pos1, &pos2, &nrowhrr,
-                         nrow, row, t);
+                         &pos1, &pos2, &nrowhrrab,
+                         nrowab, rowab, tab);
         ERD_PROFILE_END(erd__hrr_matrix)
+        lrowhrrab = &nrowab[pos1];
+        rowhrrab = &rowab[pos2];
+        thrrab = &tab[pos2];
+    }
+    size_t *lanecd = erd__scratch_alloc(&arena, sizeof(size_t) * nxyzet);
+    for (uint32_t e = 0; e < nxyzet; e++) {
+        lanecd[e] = (size_t)e * nrycd;
+    }
+    size_t *laneab = erd__scratch_alloc(&arena, sizeof(size_t) * nrycd);
+    for (uint32_t rd = 0; rd < nryd; rd++) {
+        for (uint32_t rc = 0; rc < nryc; rc++) {
+            laneab[rc + nryc * rd] = rc * stride[indexc] + rd * stride[indexd];
+        }
+    }
 
-        ERD_PROFILE_START(erd__hrr_transform)
-        erd__hrr_transform(nryc * nryd, nrowhrr, nxyza, nxyzb,
-                            &nrow[pos1],
-                            &row[pos2],
-                            &t[pos2], &output_buffer[in],
-                            &output_buffer[out]);
-        ERD_PROFILE_END(erd__hrr_transform)
-
-        ERD_SWAP(in, out);
-        if (shellb > 1) {
-            if (spheric) {
-                ERD_PROFILE_START(erd__spherical_transform)
-                erd__spherical_transform(nryc * nryd * nxyza, nrowb, nryb,
-                                          (uint32_t*)&ibuffer[isnrowb], (uint32_t*)&ibuffer[isrowb],
-                                          &fbuffer[zsrotb], &output_buffer[in], &output_buffer[out]);
-                ERD_PROFILE_END(erd__spherical_transform)
+/*             ...run each rstu contraction quadruplet through both */
+/*                stages into its place in the final batch. With a */
+/*                single quadruplet the (e0,f0) batch is in zone 1. */
+/*                The contraction pairs rs (tu) run over the */
+/*                contractions of the higher numbered shell of the pair */
+/*                first (see ERD__SHELL_PAIR_DATA). */
+    double *zone2 = (nctr == 1) ? &output_buffer[nxyzhrr] : erd__scratch_alloc(&arena, sizeof(double) * nxyzhrr);
+    double *final = (dst != NULL) ? dst : output_buffer;
+    const uint32_t ncgtohiab = (A >= B) ? ncgtoa : ncgtob;
+    const uint32_t ncgtohicd = (C >= D) ? ncgtoc : ncgtod;
+    for (uint32_t tu = 0; tu < ntu; tu++) {
+        const uint32_t thi = tu % ncgtohicd, ulo = tu / ncgtohicd;
+        const uint32_t t = (C >= D) ? thi : ulo;
+        const uint32_t u = (C >= D) ? ulo : thi;
+        for (uint32_t rs = (diagonal ? tu : 0); rs < (diagonal ? tu + 1 : nrs); rs++) {
+            const uint32_t rhi = rs % ncgtohiab, slo = rs / ncgtohiab;
+            const uint32_t r = (A >= B) ? rhi : slo;
+            const uint32_t s = (A >= B) ? slo : rhi;
+            const double *input = (nctr == 1) ? output_buffer :
+                                  &ctr[(diagonal ? rs : rs + (size_t)nrs * tu) * nxyzt];
+            const size_t offset = diagonal ? r * nrya * stride[indexa] + s * nryb * stride[indexb] :
+                                  r * nrya * stride[indexa] + s * nryb * stride[indexb] +
+                                  t * nryc * stride[indexc] + u * nryd * stride[indexd];
 
-                ERD_SWAP(in, out);
-            } else {
-                erd__normalize_cartesian(nryc * nryd * nxyza, shellb, cartnorm, &output_buffer[in]);
+/*             ...do the first stage of processing the integrals: */
+/*                   batch (e0,f0) --> batch ([c'd'],e0) */
+            {
+                ERD_PROFILE_START(erd__hrr_ry_transform)
+                erd__hrr_ry_transform(nxyzet, nxyzc, nxyzd,
+                                       nrowhrrcd, lrowhrrcd, rowhrrcd, thrrcd,
+                                       nryc, nrowc, lrowc, rowc, sphrotc, normxc,
+                                       nryd, nrowd, lrowd, rowd, sphrotd, normxd,
+                                       1, nryc, lanecd,
+                                       input, zone2);
+                ERD_PROFILE_END(erd__hrr_ry_transform)
             }
-        }
-    }
-    if (nryb > 1) {
-        const uint32_t batch_size = nryc * nryd * nxyza * nryb;
-        const uint32_t notmove = ixoff[indexb];
-        const uint32_t move = batch_size / (notmove * nryb);
-        if (move > 1) {
-            ERD_PROFILE_START(erd__move_ry)
-            erd__move_ry(4, notmove, move, nryb, indexb, &output_buffer[in], ixoff, &output_buffer[out]);
-            ERD_PROFILE_END(erd__move_ry)
 
-            ERD_SWAP(in, out);
+/*             ...do the second stage of processing the integrals: */
+/*                   batch ([c'd'],e0) --> batch ([a'b'c'd']) */
+/*                straight into the caller array, if given, or only */
+/*                for the diagonal elements [a'b'a'b']. */
+            {
+                ERD_PROFILE_START(erd__hrr_ry_transform)
+                if (diagonal) {
+                    hrr_ry_diagonal(nxyza,
+                                    nrowhrrab, lrowhrrab, rowhrrab, thrrab,
+                                    nrya, nrowa, lrowa, rowa, sphrota, normxa,
+                                    nryb, nrowb, lrowb, rowb, sphrotb, normxb,
+                                    stride[indexa], stride[indexb],
+                                    zone2, &final[offset]);
+                } else {
+                    erd__hrr_ry_transform(nrycd, nxyza, nxyzb,
+                                           nrowhrrab, lrowhrrab, rowhrrab, thrrab,
+                                           nrya, nrowa, lrowa, rowa, sphrota, normxa,
+                                           nryb, nrowb, lrowb, rowb, sphrotb, normxb,
+                                           stride[indexa], stride[indexb], laneab,
+                                           zone2, &final[offset]);
+                }
+                ERD_PROFILE_END(erd__hrr_ry_transform)
+            }
         }
     }
-    if (shella > 1) {
-        if (spheric) {
-            ERD_PROFILE_START(erd__spherical_transform)
-            erd__spherical_transform(nryb * nryc * nryd, nrowa, nrya,
-                                      &ibuffer[isnrowa], (uint32_t*)&ibuffer[isrowa],
-                                      &fbuffer[zsrota], &output_buffer[in],
-                                      &output_buffer[out]);
-            ERD_PROFILE_END(erd__spherical_transform)
 
-            ERD_SWAP(in, out);
-        } else {
-            erd__normalize_cartesian(nryb * nryc * nryd, shella, cartnorm, &output_buffer[in]);
-        }
-    }
-    const uint32_t batch_size = nryb * nryc * nryd * nrya;
-    if (nrya > 1) {
-        const uint32_t notmove = ixoff[indexa];
-        const uint32_t move = batch_size / (notmove * nrya);
-        if (move > 1) {
-            ERD_PROFILE_START(erd__move_ry)
-            erd__move_ry(4, notmove, move, nrya, indexa, &output_buffer[in], ixoff, &output_buffer[out]);
-            ERD_PROFILE_END(erd__move_ry)
+    *output_length = diagonal ? nrya * nryb * nrs : nrya * nryb * nrycd * nctr;
+    ERD_PROFILE_END(erd__csgto)
+}
 
-            ERD_SWAP(in, out);
-        }
-    }
+ERD_OFFLOAD void erd__csgto(
+    uint32_t A, uint32_t B, uint32_t C, uint32_t D,
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    int **vrrtab,
+    const uint32_t ryindex[restrict static 1], const double ryvalue[restrict static 1],
+    bool spheric,
+    const double *restrict pairab, uint32_t npairab, const double *restrict paircd, uint32_t npaircd,
+    const uint32_t *restrict hrrab_index, const double *restrict hrrab_value,
+    const uint32_t *restrict hrrcd_index, const double *restrict hrrcd_value,
+    double tol,
+    uint32_t buffer_capacity, uint32_t output_length[restrict static 1], double output_buffer[restrict static 1],
+    void *restrict scratch)
+{
+    erd__csgto_batch(A, B, C, D,
+        npgto, ncgto, shell, xyz0,
+        alpha, minalpha, cc, norm,
+        vrrtab, ryindex, ryvalue, spheric,
+        pairab, npairab, paircd, npaircd,
+        hrrab_index, hrrab_value, hrrcd_index, hrrcd_value,
+        tol,
+        buffer_capacity, output_length, output_buffer,
+        scratch, NULL, NULL, false);
+}
 
-    if (in != 0) {
-        memcpy(output_buffer, &output_buffer[in], batch_size * sizeof(double));
-    }
+ERD_OFFLOAD void erd__csgto_into(
+    uint32_t A, uint32_t B, uint32_t C, uint32_t D,
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    int **vrrtab,
+    const uint32_t ryindex[restrict static 1], const double ryvalue[restrict static 1],
+    bool spheric,
+    const double *restrict pairab, uint32_t npairab, const double *restrict paircd, uint32_t npaircd,
+    const uint32_t *restrict hrrab_index, const double *restrict hrrab_value,
+    const uint32_t *restrict hrrcd_index, const double *restrict hrrcd_value,
+    double tol,
+    uint32_t buffer_capacity, uint32_t output_length[restrict static 1], double output_buffer[restrict static 1],
+    void *restrict scratch,
+    double dst[restrict static 1], const size_t ld[restrict static 4])
+{
+    erd__csgto_batch(A, B, C, D,
+        npgto, ncgto, shell, xyz0,
+        alpha, minalpha, cc, norm,
+        vrrtab, ryindex, ryvalue, spheric,
+        pairab, npairab, paircd, npaircd,
+        hrrab_index, hrrab_value, hrrcd_index, hrrcd_value,
+        tol,
+        buffer_capacity, output_length, output_buffer,
+        scratch, dst, ld, false);
+}
 
-    /* ...set final pointer to integrals in ZCORE array. */
-    *output_length = batch_size;
-    ERD_PROFILE_END(erd__csgto)
+ERD_OFFLOAD void erd__csgto_diagonal(
+    uint32_t A, uint32_t B,
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    int **vrrtab,
+    const uint32_t ryindex[restrict static 1], const double ryvalue[restrict static 1],
+    bool spheric,
+    const double *restrict pairab, uint32_t npairab,
+    const uint32_t *restrict hrrab_index, const double *restrict hrrab_value,
+    double tol,
+    uint32_t buffer_capacity, uint32_t output_length[restrict static 1], double output_buffer[restrict static 1],
+    void *restrict scratch)
+{
+    erd__csgto_batch(A, B, A, B,
+        npgto, ncgto, shell, xyz0,
+        alpha, minalpha, cc, norm,
+        vrrtab, ryindex, ryvalue, spheric,
+        pairab, npairab, pairab, npairab,
+        hrrab_index, hrrab_value, hrrab_index, hrrab_value,
+        tol,
+        buffer_capacity, output_length, output_buffer,
+        scratch, NULL, NULL, true);
 }
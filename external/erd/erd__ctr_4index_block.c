@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "erd.h"
+#include "erdutil.h"
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__CTR_4INDEX_BLOCK */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation performs a four indexed contraction */
+/*                on a block of primitive integrals and adds the result */
+/*                to a previously initialized batch of contracted */
+/*                integrals of generally contracted shells: */
+/*                   cbatch (nxyzt,rs,tu) += sum ccab (ij,rs) * */
+/*                                           sum cccd (kl,tu) * */
+/*                                           pbatch (kl,ij,nxyzt) */
+/*                The primitive integrals of a block are computed once */
+/*                and enter all rs,tu contraction pairs. The kl sum is */
+/*                done first into the small scratch array WORK, which */
+/*                is then contracted over ij for each nxyzt element. */
+/*                  Input: */
+/*                    NXYZT        =  # of integrals per primitive */
+/*                                    quartet */
+/*                    NIJ(KL)      =  # of ij (kl) primitive pairs in */
+/*                                    the block */
+/*                    NRS(TU)      =  # of rs (tu) contraction pairs */
+/*                    CCAB(CD)     =  the coefficient products of the */
+/*                                    ij (kl) primitive pairs of the */
+/*                                    block, one array per contraction */
+/*                                    pair with leading dimension */
+/*                                    LDAB(CD), or NULL for a single */
+/*                                    contraction pair, whose */
+/*                                    coefficients are already in the */
+/*                                    primitive integrals */
+/*                    BATCH        =  the block of primitive integrals */
+/*                                    as batch (kl,ij,nxyzt) */
+/*                    WORK         =  scratch of NIJ*NTU elements */
+/*                  Output: */
+/*                    CTR          =  updated batch of contracted */
+/*                                    integrals as batch (nxyzt,rs,tu) */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__ctr_4index_block(uint32_t nxyzt, uint32_t nij, uint32_t nkl,
+    uint32_t nrs, uint32_t ntu,
+    const double ccab[restrict], size_t ldab,
+    const double cccd[restrict], size_t ldcd,
+    const double batch[restrict static 1],
+    double work[restrict static 1],
+    double ctr[restrict static 1])
+{
+    const size_t nijkl = (size_t)nij * nkl;
+    for (uint32_t n = 0; n < nxyzt; n++) {
+        const double *restrict block = &batch[n * nijkl];
+
+/*             ...contract kl: work (ij,tu) = sum cccd (kl,tu) * */
+/*                                            batch (kl,ij,n). */
+        for (uint32_t tu = 0; tu < ntu; tu++) {
+            for (uint32_t ij = 0; ij < nij; ij++) {
+                const double *restrict row = &block[ij * nkl];
+                double sum = 0.0;
+                if (cccd == NULL) {
+                    for (uint32_t kl = 0; kl < nkl; kl++) {
+                        sum += row[kl];
+                    }
+                } else {
+                    const double *restrict cc = &cccd[tu * ldcd];
+                    for (uint32_t kl = 0; kl < nkl; kl++) {
+                        sum += cc[kl] * row[kl];
+                    }
+                }
+                work[tu * nij + ij] = sum;
+            }
+        }
+
+/*             ...contract ij: ctr (n,rs,tu) += sum ccab (ij,rs) * */
+/*                                               work (ij,tu). */
+        for (uint32_t tu = 0; tu < ntu; tu++) {
+            const double *restrict column = &work[tu * nij];
+            for (uint32_t rs = 0; rs < nrs; rs++) {
+                double sum = 0.0;
+                if (ccab == NULL) {
+                    for (uint32_t ij = 0; ij < nij; ij++) {
+                        sum += column[ij];
+                    }
+                } else {
+                    const double *restrict cc = &ccab[rs * ldab];
+                    for (uint32_t ij = 0; ij < nij; ij++) {
+                        sum += cc[ij] * column[ij];
+                    }
+                }
+                ctr[(rs + (size_t)nrs * tu) * nxyzt + n] += sum;
+            }
+        }
+    }
+}
@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#if defined (ERD_DISPATCH)
+#include <cpuid.h>
+#endif
+
+#include "erd.h"
+#include "erdutil.h"
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(push, target(mic))
+#endif
+
+
+#if defined (ERD_DISPATCH)
+
+#define ERD_DECLARE_KERNELS(suffix) \
+    extern __typeof__(*erd_kernels.rys_roots_weights) erd__rys_roots_weights_##suffix; \
+    extern __typeof__(*erd_kernels.coefficients_2d) erd__2d_coefficients_##suffix; \
+    extern __typeof__(*erd_kernels.pq_integrals_2d) erd__2d_pq_integrals_##suffix; \
+    extern __typeof__(*erd_kernels.int2d_to_e0f0) erd__int2d_to_e0f0_##suffix; \
+    extern __typeof__(*erd_kernels.hrr_ry_transform) erd__hrr_ry_transform_##suffix;
+
+#define ERD_KERNELS(suffix) { \
+    erd__rys_roots_weights_##suffix, erd__2d_coefficients_##suffix, erd__2d_pq_integrals_##suffix, \
+    erd__int2d_to_e0f0_##suffix, erd__hrr_ry_transform_##suffix }
+
+ERD_DECLARE_KERNELS(sse4)
+ERD_DECLARE_KERNELS(avx)
+ERD_DECLARE_KERNELS(avx2)
+ERD_DECLARE_KERNELS(avx512)
+
+/* Indexed by ERD_ISA_SSE4 - 1 ... ERD_ISA_AVX512 - 1 */
+static const erd_kernels_t isa_kernels[] = {
+    ERD_KERNELS(sse4), ERD_KERNELS(avx), ERD_KERNELS(avx2), ERD_KERNELS(avx512)
+};
+
+/* The library itself is compiled for SSE4.1, so it starts out with those kernels */
+erd_kernels_t erd_kernels = ERD_KERNELS(sse4);
+
+
+/* Highest ISA level that both the CPU and the OS (saving of the YMM and
+   ZMM state, XCR0 bits 1-2 and 5-7) support */
+static int cpu_isa(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return ERD_ISA_SSE4;
+    }
+    const bool fma = (ecx & bit_FMA) != 0;
+    if (!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX)) {
+        return ERD_ISA_SSE4;
+    }
+    uint32_t xcr0, xcr0_high;
+    __asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0_high) : "c" (0));
+    if ((xcr0 & 0x06) != 0x06) {
+        return ERD_ISA_SSE4;
+    }
+    if (__get_cpuid_max(0, NULL) < 7) {
+        return ERD_ISA_AVX;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    /* EBX bit 5 is AVX2, bit 16 AVX-512F */
+    if (!fma || !(ebx & (1u << 5))) {
+        return ERD_ISA_AVX;
+    }
+    if (!(ebx & (1u << 16)) || ((xcr0 & 0xE6) != 0xE6)) {
+        return ERD_ISA_AVX2;
+    }
+    return ERD_ISA_AVX512;
+}
+
+#endif
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__SELECT_ISA */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation selects the instruction set level of */
+/*                the Rys root, 2D coefficient, 2D PQ integral, */
+/*                int2d_to_e0f0 and HRR/ry transform kernels. Builds with */
+/*                ERD_DISPATCH carry these kernels for every level and */
+/*                use the requested one, limited to what the CPU */
+/*                supports; ERD_ISA_AUTO picks the highest. Other builds */
+/*                have one level fixed at compile time. The selection */
+/*                is process-wide. */
+/*                  Input: */
+/*                    ISA          =  requested level (ERD_ISA_xxx) */
+/*                  Output: */
+/*                    (return)     =  level in use */
+/* ------------------------------------------------------------------------ */
+int erd__select_isa(int isa)
+{
+#if defined (ERD_DISPATCH)
+    const int supported = cpu_isa();
+    if ((isa == ERD_ISA_AUTO) || (isa > supported)) {
+        isa = supported;
+    }
+    erd_kernels = isa_kernels[isa - ERD_ISA_SSE4];
+    return isa;
+#else
+    (void)isa;
+    #if defined (__MIC__)
+    return ERD_ISA_MIC;
+    #elif defined (__AVX512F__)
+    return ERD_ISA_AVX512;
+    #elif defined (__AVX2__) && defined (__FMA__)
+    return ERD_ISA_AVX2;
+    #elif defined (__AVX__)
+    return ERD_ISA_AVX;
+    #else
+    return ERD_ISA_SSE4;
+    #endif
+#endif
+}
+
+/* A quarter of a 256 KB L2 cache */
+size_t erd_block_size = 64 * 1024;
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__SELECT_BLOCK_SIZE */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation sets the size of the primitive blocks */
+/*                of ERD__CSGTO from the size of the cache they should */
+/*                stay in, usually the L2 cache. A block gets a quarter */
+/*                of the cache: its 2D integrals are swept once per */
+/*                output component, and the rest is left for the pair */
+/*                data, the HRR matrices, the batch and the tables. The */
+/*                selection is process-wide. */
+/*                  Input: */
+/*                    CACHE        =  cache size in bytes, 0 for the */
+/*                                    default of 256 KB */
+/*                  Output: */
+/*                    (return)     =  primitive block size in bytes */
+/* ------------------------------------------------------------------------ */
+size_t erd__select_block_size(size_t cache)
+{
+    if (cache == 0) {
+        cache = 256 * 1024;
+    }
+    erd_block_size = cache / 4;
+    return erd_block_size;
+}
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(pop)
+#endif
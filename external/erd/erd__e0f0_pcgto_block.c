@@ -10,6 +10,120 @@
 #include "erd.h"
 #include "erdutil.h"
 
+/* Scratch arena bytes erd__rys_roots_weights takes for NT T-values and
+   NGQP roots: the bins of the SIMD 1...5 root routines at any vector width
+   up to ERD_RYS_MAXSIMDW, or the zeroth moments of the general routine */
+ERD_OFFLOAD size_t erd__rys_scratch_size(uint32_t nt, uint32_t ngqp)
+{
+    if (ngqp <= 5) {
+        const size_t mb = nt < ERD_RYS_BLOCK ? nt : ERD_RYS_BLOCK;
+        const size_t mp = mb + ERD_RYS_MAXRANGE * ERD_RYS_MAXSIMDW;
+        return 2 * ERD_SCRATCH_SIZE(sizeof(int) * mb)
+            + ERD_SCRATCH_SIZE(sizeof(double) * mp)
+            + 2 * ERD_SCRATCH_SIZE(sizeof(double) * ngqp * mp);
+    } else if (ngqp > 10) {
+        return ERD_SCRATCH_SIZE(sizeof(double) * nt);
+    } else {
+        return 0;
+    }
+}
+
+
+/* Scratch arena bytes erd__e0f0_pcgto_block takes for NIJ x NKL exponent
+   pairs of the P and Q shells SHELLP and SHELLQ. The Rys roots routine
+   shares its space with the VRR coefficients and the y- and z-2D integrals,
+   which are set up after it. */
+ERD_OFFLOAD size_t erd__e0f0_scratch_size(uint32_t nij, uint32_t nkl, uint32_t shellp, uint32_t shellq)
+{
+    const uint32_t ngqp = (shellp + shellq) / 2 + 1;
+    const size_t simd_nijkl = PAD_LEN(nij * nkl);
+    const size_t simd_mgqijkl = PAD_LEN(ngqp * nij * nkl);
+    const size_t nint2d = simd_mgqijkl * (shellp + 1) * (shellq + 1);
+    const size_t rys = erd__rys_scratch_size(nij * nkl, ngqp);
+    const size_t vrr = 2 * ERD_SCRATCH_SIZE(sizeof(double) * nint2d)
+        + 9 * ERD_SCRATCH_SIZE(sizeof(double) * simd_mgqijkl);
+    return ERD_SCRATCH_SIZE(sizeof(double) * nint2d)
+        + 2 * ERD_SCRATCH_SIZE(sizeof(double) * simd_nijkl)
+        + ERD_SCRATCH_SIZE(sizeof(double) * simd_mgqijkl)
+        + (rys > vrr ? rys : vrr);
+}
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__E0F0_DEF_BLOCKS */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : ERD__E0F0_SCRATCH_SIZE */
+/*  DESCRIPTION : This operation determines the block sizes of the ij */
+/*                and kl primitive pairs, such that the scratch of one */
+/*                call to ERD__E0F0_PCGTO_BLOCK, which grows as the */
+/*                product of both, stays within BLOCK_SIZE bytes, */
+/*                together with the primitive batch of the block if the */
+/*                batch is not contracted on the fly. The */
+/*                larger of the two blocks is halved until it fits, but */
+/*                not below ERD_BLOCK_PAIRS pairs, and all blocks but */
+/*                the last are a multiple of ERD_BLOCK_PAIRS pairs. If */
+/*                all pairs fit, a single block is returned. */
+/*                  Input: */
+/*                    BLOCK_SIZE   =  scratch bytes aimed for */
+/*                    NIJ(KL)      =  total # of ij (kl) primitive */
+/*                                    pairs */
+/*                    SHELLP(Q)    =  the shell types P=A+B and Q=C+D */
+/*                    NXYZT        =  # of integrals per primitive */
+/*                                    quartet in the primitive batch, */
+/*                                    0 for a contracted batch */
+/*                  Output: */
+/*                    MIJ(KL)      =  # of ij (kl) primitive pairs per */
+/*                                    block */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__e0f0_def_blocks(size_t block_size, uint32_t nij, uint32_t nkl,
+    uint32_t shellp, uint32_t shellq, uint32_t nxyzt,
+    uint32_t mij[restrict static 1], uint32_t mkl[restrict static 1])
+{
+    uint32_t blockij = nij, blockkl = nkl;
+    while (erd__e0f0_scratch_size(blockij, blockkl, shellp, shellq)
+        + ERD_SCRATCH_SIZE(sizeof(double) * nxyzt * blockij * blockkl) > block_size) {
+        if ((blockij >= blockkl) && (blockij > ERD_BLOCK_PAIRS)) {
+            blockij = (blockij / 2 + ERD_BLOCK_PAIRS - 1) / ERD_BLOCK_PAIRS * ERD_BLOCK_PAIRS;
+        } else if (blockkl > ERD_BLOCK_PAIRS) {
+            blockkl = (blockkl / 2 + ERD_BLOCK_PAIRS - 1) / ERD_BLOCK_PAIRS * ERD_BLOCK_PAIRS;
+        } else {
+            break;
+        }
+    }
+    *mij = blockij;
+    *mkl = blockkl;
+}
+
+
+/* The [E0|F0] batch of every exponent quadruplet: as erd__int2d_to_e0f0,
+   but summing the products of the 2D integrals only over the NGQP roots
+   of each of the NEXQ quadruplets, into batch (nexq,nxyzt) */
+ERD_OFFLOAD static void int2d_to_e0f0_pcgto(uint32_t shella, uint32_t shellp, uint32_t shellc,
+    uint32_t ngqp, uint32_t nexq, uint32_t ngqexq, uint32_t nxyzet, uint32_t nxyzft,
+    const double int2dx[restrict], const double int2dy[restrict], const double int2dz[restrict],
+    int **vrrtab, double batch[restrict])
+{
+    const int *tabe = vrrtab[shella];
+    const int *tabf = vrrtab[shellc];
+    for (uint32_t kf = 0; kf < nxyzft; kf++) {
+        for (uint32_t ke = 0; ke < nxyzet; ke++) {
+            const double *restrict x = &int2dx[(size_t)(tabe[ke * 4 + 0] + tabf[kf * 4 + 0] * (shellp + 1)) * ngqexq];
+            const double *restrict y = &int2dy[(size_t)(tabe[ke * 4 + 1] + tabf[kf * 4 + 1] * (shellp + 1)) * ngqexq];
+            const double *restrict z = &int2dz[(size_t)(tabe[ke * 4 + 2] + tabf[kf * 4 + 2] * (shellp + 1)) * ngqexq];
+            double *restrict out = &batch[(size_t)(kf * nxyzet + ke) * nexq];
+            for (uint32_t m = 0; m < nexq; m++) {
+                double sum = 0.0;
+                for (uint32_t g = 0; g < ngqp; g++) {
+                    sum += x[m * ngqp + g] * y[m * ngqp + g] * z[m * ngqp + g];
+                }
+                out[m] = sum;
+            }
+        }
+    }
+}
+
+
 /* ------------------------------------------------------------------------ */
 /*  OPERATION   : ERD_E0F0_PCGTO_BLOCK */
 /*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
@@ -35,6 +149,9 @@
 /*                present block. */
 /*                On exit, the batch elements will be stored as: */
 /*                             batch (kl,ij,nxyzt) */
+/*                or, if CONTRACT is true, summed over all ij and kl */
+/*                as batch (nxyzt), the pair scales then holding the */
+/*                contraction coefficients. */
 /*                  Input: */
 /*                    NBATCH       =  size of the primitive cartesian */
 /*                                    integral batch */
@@ -94,16 +211,18 @@
 /*                    TSTEP        =  difference between two consecutive */
 /*                                    T's in Fm (T) table */
 /*                    TVSTEP       =  Inverse of TSTEP */
-/*                    PRIMx        =  i,j,k,l labels of primitives for */
-/*                                    the respective contraction shells */
-/*                                    x = A,B,C,D */
-/*                    NORMx        =  the normalization factors due to */
-/*                                    the primitive exponents for the */
-/*                                    contraction shells x = A,B,C,D */
-/*                    RHOAB(CD)    =  the complete set of NIJ (NKL) */
-/*                                    exponential prefactors between */
-/*                                    contraction shells A and B */
-/*                                    (C and D) */
+/*                    FACTOR       =  overall scaling factor for all */
+/*                                    integrals (prefactor * s/p norms) */
+/*                    CONTRACT     =  is true, if the batch is to be */
+/*                                    summed over the exponent pairs */
+/*                    PAIRAB(CD)   =  the primitive pair data of the */
+/*                                    NPAIRAB (NPAIRCD) pairs between */
+/*                                    contraction shells A and B (C and */
+/*                                    D) as set by ERD__SET_PAIR_DATA. */
+/*                                    It holds the P (Q), Px (Qx), */
+/*                                    PINVHF (QINVHF) and SCALEP (SCALEQ) */
+/*                                    arrays below. Only the leading NIJ */
+/*                                    (NKL) pairs are evaluated */
 /*                    P            =  will hold current MIJ exponent */
 /*                                    sums for contraction shells A */
 /*                                    and B */
@@ -165,6 +284,11 @@
 /*                    INT2Dx       =  will hold all current 2D integrals */
 /*                                    for each cartesian component */
 /*                                    (x = X,Y,Z) */
+/*                    SCRATCH      =  arena of at least */
+/*                                    ERD__E0F0_SCRATCH_SIZE bytes, */
+/*                                    aligned to ERD_SCRATCH_ALIGN, from */
+/*                                    which all the arrays above from */
+/*                                    RTS on are taken */
 /*                  Output: */
 /*                    BATCH        =  current batch of primitive */
 /*                                    cartesian [E0|F0] integrals */
@@ -173,15 +297,13 @@ ERD_OFFLOAD void erd__e0f0_pcgto_block(
     uint32_t A, uint32_t B, uint32_t C, uint32_t D,
     uint32_t nij, uint32_t nkl,
     uint32_t nxyzet, uint32_t nxyzft,
-    uint32_t nxyzp, uint32_t nxyzq,
     const uint32_t shell[restrict static 1],
     const double xyz0[restrict static 1],
-    const double *restrict alpha[restrict static 1],
-    const double *restrict cc[restrict static 1],
     int **vrrtab,
-    const uint32_t prima[restrict static nij], const uint32_t primb[restrict static nij], const uint32_t primc[restrict static nkl], const uint32_t primd[restrict static nkl],
-    const double norma[restrict static nij], const double normb[restrict static nij], const double normc[restrict static nkl], const double normd[restrict static nkl],
-    const double rhoab[restrict static nij], const double rhocd[restrict static nkl],
+    double factor, bool contract,
+    const double pairab[restrict static 1], uint32_t npairab,
+    const double paircd[restrict static 1], uint32_t npaircd,
+    void *restrict scratch,
     double output_buffer[restrict])
 {
 #ifdef __ERD_PROFILE__   
@@ -191,114 +313,39 @@ ERD_OFFLOAD void erd__e0f0_pcgto_block(
     const int tid = 0;
     #endif
 #endif
-    double xa = xyz0[A*4], ya = xyz0[A*4+1], za = xyz0[A*4+2];
-    double xb = xyz0[B*4], yb = xyz0[B*4+1], zb = xyz0[B*4+2];
-    double xc = xyz0[C*4], yc = xyz0[C*4+1], zc = xyz0[C*4+2];
-    double xd = xyz0[D*4], yd = xyz0[D*4+1], zd = xyz0[D*4+2];
     const uint32_t shella = shell[A], shellb = shell[B], shellc = shell[C], shelld = shell[D];
     const uint32_t shellp = shella + shellb;
     const uint32_t shellq = shellc + shelld;
     const uint32_t shellt = shellp + shellq;
     const uint32_t ngqp = shellt / 2 + 1;
     
-/*            ...predetermine 2D integral case. This is done in */
-/*               order to distinguish the P- and Q-shell combinations */
-/*               for efficient evaluation of the 2D integrals and */
-/*               their VRR coefficients. The cases distinguished */
-/*               are summarized in the following table, indicating */
-/*               the value of CASE2D: */
-/*                                Q-shell */
-/*                              s    p   >p */
-/*                            --------------- */
-/*                           | */
-/*                         s |  1    4    7 */
-/*                           | */
-/*                P-shell  p |  2    5    8 */
-/*                           | */
-/*                        >p |  3    6    9 */
-/*                           | */   
-/*             ...predetermine in 'K2' loops the quantities associated */
-/*                with the A,B-part and C,D-part. Set the atom equality */
-/*                case CASEAT here to exploit simplifications due to */
-/*                center equalities later on: */
-/*                     CASEAT = 1  -->    atomic (AA|AA) integrals */
-/*                            = 2  -->  2-center (AA|CC) integrals */
-/*                            = 3  -->  3-center (AB|CC) integrals */
-/*                            = 4  -->  3-center (AA|CD) integrals */
-/*                            = 5  -->  4-center (AB|CD) integrals */
     const uint32_t case2d = min32u(2, shellq) * 3 + min32u(2, shellp) + 1;
     const uint32_t nijkl = nij * nkl;
     const uint32_t mgqijkl = ngqp * nijkl;
     
-    const double *restrict alphaa = alpha[A], *restrict alphab = alpha[B];
-    const double *restrict cca = cc[A], *restrict ccb = cc[B];
-    const size_t simd_nij = PAD_LEN(nij);
-    ERD_SIMD_ALIGN double p[simd_nij], px[simd_nij], py[simd_nij], pz[simd_nij], pinvhf[simd_nij], scalep[simd_nij];
-    ERD_SIMD_ZERO_TAIL_64f(p, simd_nij);
-    ERD_SIMD_ZERO_TAIL_64f(px, simd_nij);
-    ERD_SIMD_ZERO_TAIL_64f(py, simd_nij);
-    ERD_SIMD_ZERO_TAIL_64f(pz, simd_nij);
-    ERD_SIMD_ZERO_TAIL_64f(pinvhf, simd_nij);
-    ERD_SIMD_ZERO_TAIL_64f(scalep, simd_nij);
-    #pragma simd
-    #pragma vector aligned
-    for (uint32_t ij = 0; ij < nij; ++ij) {        
-        const uint32_t i = prima[ij];
-        const uint32_t j = primb[ij];
-        const double expa = alphaa[i];
-        const double expb = alphab[j];
-        const double pval = expa + expb;
-        const double pinv = 1.0 / pval;
-        p[ij] = pval;
-        px[ij] = (expa * xa + expb * xb) * pinv;
-        py[ij] = (expa * ya + expb * yb) * pinv;
-        pz[ij] = (expa * za + expb * zb) * pinv;
-        pinvhf[ij] = pinv * 0.5;
-        scalep[ij] = norma[i] * normb[j] * rhoab[ij] * cca[i] * ccb[j];
-    }
+    const size_t simd_npairab = PAD_LEN(npairab);
+    const double *restrict p = &pairab[ERD_PAIR_P * simd_npairab];
+    const double *restrict px = &pairab[ERD_PAIR_PX * simd_npairab];
+    const double *restrict py = &pairab[ERD_PAIR_PY * simd_npairab];
+    const double *restrict pz = &pairab[ERD_PAIR_PZ * simd_npairab];
+    const double *restrict pinvhf = &pairab[ERD_PAIR_PINVHF * simd_npairab];
+    const double *restrict scalep = &pairab[ERD_PAIR_SCALE * simd_npairab];
 
-    const double *restrict alphac = alpha[C], *restrict alphad = alpha[D];
-    const double *restrict ccc = cc[C], *restrict ccd = cc[D];
-    const size_t simd_nkl = PAD_LEN(nkl);
-    ERD_SIMD_ALIGN double q[simd_nkl], qx[simd_nkl], qy[simd_nkl], qz[simd_nkl], qinvhf[simd_nkl], scaleq[simd_nkl];
-    ERD_SIMD_ZERO_TAIL_64f(q, simd_nkl);
-    ERD_SIMD_ZERO_TAIL_64f(qx, simd_nkl);
-    ERD_SIMD_ZERO_TAIL_64f(qy, simd_nkl);
-    ERD_SIMD_ZERO_TAIL_64f(qz, simd_nkl);
-    ERD_SIMD_ZERO_TAIL_64f(qinvhf, simd_nkl);
-    ERD_SIMD_ZERO_TAIL_64f(scaleq, simd_nkl);
-    #pragma simd
-    #pragma vector aligned
-    for (uint32_t kl = 0; kl < nkl; ++kl) {
-        const uint32_t k = primc[kl];
-        const uint32_t l = primd[kl];
-        const double expc = alphac[k];
-        const double expd = alphad[l];
-        double qval = expc + expd;
-        const double qinv = 1.0 / qval;
-        q[kl] = qval;
-        qx[kl] = (expc * xc + expd * xd) * qinv;
-        qy[kl] = (expc * yc + expd * yd) * qinv;
-        qz[kl] = (expc * zc + expd * zd) * qinv;
-        qinvhf[kl] = qinv * 0.5;
-        scaleq[kl] = normc[k] * normd[l] * rhocd[kl] * ccc[k] * ccd[l];
-    }
+    const size_t simd_npaircd = PAD_LEN(npaircd);
+    const double *restrict q = &paircd[ERD_PAIR_P * simd_npaircd];
+    const double *restrict qx = &paircd[ERD_PAIR_PX * simd_npaircd];
+    const double *restrict qy = &paircd[ERD_PAIR_PY * simd_npaircd];
+    const double *restrict qz = &paircd[ERD_PAIR_PZ * simd_npaircd];
+    const double *restrict qinvhf = &paircd[ERD_PAIR_PINVHF * simd_npaircd];
+    const double *restrict scaleq = &paircd[ERD_PAIR_SCALE * simd_npaircd];
 
-/*             ...the 'K4' loop over all ij- and kl-exponent pairs */
-/*                in present ij and kl block to calculate all T's */
-/*                and scaling factors for the cases: */
-/*                     CASEAT = 1  -->    atomic (AA|AA) integrals */
-/*                            = 2  -->  2-center (AA|CC) integrals */
-/*                            = 3  -->  3-center (AB|CC) integrals */
-/*                            = 4  -->  3-center (AA|CD) integrals */
-/*                            = 5  -->  4-center (AB|CD) integrals */
-/*                4-center (AB|CD) integrals are checked first */
-/*                (most common occurence in large systems). */
     const size_t simd_mgqijkl = PAD_LEN(mgqijkl);
     const size_t simd_nijkl = PAD_LEN(nijkl);
     const uint32_t nint2d = simd_mgqijkl * (shellp + 1) * (shellq + 1);
-    ERD_SIMD_ALIGN double int2dx[nint2d];
-    ERD_SIMD_ALIGN double tval[simd_nijkl], pqpinv[simd_nijkl];
+    char *arena = scratch;
+    double *restrict int2dx = erd__scratch_alloc(&arena, sizeof(double) * nint2d);
+    double *restrict tval = erd__scratch_alloc(&arena, sizeof(double) * simd_nijkl);
+    double *restrict pqpinv = erd__scratch_alloc(&arena, sizeof(double) * simd_nijkl);
     ERD_SIMD_ZERO_TAIL_64f(tval, simd_nijkl);
     ERD_SIMD_ZERO_TAIL_64f(pqpinv, simd_nijkl);
     uint32_t m = 0;
@@ -307,7 +354,7 @@ ERD_OFFLOAD void erd__e0f0_pcgto_block(
         const double pxval = px[ij];
         const double pyval = py[ij];
         const double pzval = pz[ij];
-        const double pscale = scalep[ij];
+        const double pscale = factor * scalep[ij];
         for (uint32_t kl = 0; kl < nkl; ++kl) {
             const double qval = q[kl];
             const double pqmult = pval * qval;
@@ -338,11 +385,11 @@ ERD_OFFLOAD void erd__e0f0_pcgto_block(
 
 
 /*             ...calculate all roots and weights. */
-    ERD_SIMD_ALIGN double rts[simd_mgqijkl];
+    double *restrict rts = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
     ERD_SIMD_ZERO_TAIL_64f(rts, simd_mgqijkl);
     const uint32_t nmom = (ngqp << 1) - 1;
     ERD_PROFILE_START(erd__rys_roots_weights)
-    erd__rys_roots_weights(nijkl, ngqp, nmom, tval, rts, int2dx);
+    erd__rys_roots_weights(nijkl, ngqp, nmom, tval, rts, int2dx, arena);
     ERD_PROFILE_END(erd__rys_roots_weights)
 /*             ...perform the following steps: */
 /*                1) generate all VRR coefficients. */
@@ -359,7 +406,15 @@ ERD_OFFLOAD void erd__e0f0_pcgto_block(
 /*                for the special s-shell cases. Note, that the case */
 /*                in which both P- and Q-shells are s-shells cannot */
 /*                arise, as this case is dealt with in separate routines. */
-    ERD_SIMD_ALIGN double b00[simd_mgqijkl], b01[simd_mgqijkl], b10[simd_mgqijkl], c00x[simd_mgqijkl], c00y[simd_mgqijkl], c00z[simd_mgqijkl], d00x[simd_mgqijkl], d00y[simd_mgqijkl], d00z[simd_mgqijkl];
+    double *restrict b00 = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
+    double *restrict b01 = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
+    double *restrict b10 = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
+    double *restrict c00x = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
+    double *restrict c00y = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
+    double *restrict c00z = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
+    double *restrict d00x = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
+    double *restrict d00y = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
+    double *restrict d00z = erd__scratch_alloc(&arena, sizeof(double) * simd_mgqijkl);
     ERD_SIMD_ZERO_TAIL_64f(b00, simd_mgqijkl);
     ERD_SIMD_ZERO_TAIL_64f(b01, simd_mgqijkl);
     ERD_SIMD_ZERO_TAIL_64f(b10, simd_mgqijkl);
@@ -379,7 +434,8 @@ ERD_OFFLOAD void erd__e0f0_pcgto_block(
                           d00x, d00y, d00z);
     ERD_PROFILE_END(erd__2d_coefficients)
 
-    ERD_SIMD_ALIGN double int2dy[nint2d], int2dz[nint2d];
+    double *restrict int2dy = erd__scratch_alloc(&arena, sizeof(double) * nint2d);
+    double *restrict int2dz = erd__scratch_alloc(&arena, sizeof(double) * nint2d);
     ERD_PROFILE_START(erd__2d_pq_integrals)
     erd__2d_pq_integrals(shellp, shellq, simd_mgqijkl,
                           b00, b01, b10, c00x, c00y, c00z, d00x,
@@ -388,8 +444,14 @@ ERD_OFFLOAD void erd__e0f0_pcgto_block(
     ERD_PROFILE_END(erd__2d_pq_integrals)
     
     ERD_PROFILE_START(erd__int2d_to_e0f0)
-    erd__int2d_to_e0f0(shella, shellp, shellc, shellq,
-                        simd_mgqijkl, nxyzet, nxyzft,
-                        int2dx, int2dy, int2dz, vrrtab, output_buffer);
+    if (contract) {
+        erd__int2d_to_e0f0(shella, shellp, shellc, shellq,
+                            simd_mgqijkl, nxyzet, nxyzft,
+                            int2dx, int2dy, int2dz, vrrtab, output_buffer);
+    } else {
+        int2d_to_e0f0_pcgto(shella, shellp, shellc,
+                            ngqp, nijkl, simd_mgqijkl, nxyzet, nxyzft,
+                            int2dx, int2dy, int2dz, vrrtab, output_buffer);
+    }
     ERD_PROFILE_END(erd__int2d_to_e0f0)
 }
@@ -121,3 +121,54 @@ ERD_OFFLOAD void erd__hrr_matrix(uint32_t nrothrr, uint32_t ncolhrr,
     *in2_ptr = in2;
     *nrowout_ptr = nrowout;
 }
+
+/**
+ * @brief Sizes of the HRR transformation matrix construction
+ * @details This operation returns the work array sizes that @a erd__hrr_matrix needs for the (e0| --> (ab| transformation of a shell pair, and the # of nonzero row labels of the final matrix.
+ * @param[in]  nxyzet             Monomial dimension of the (e0| part.
+ * @param[in]  shellp             Sheel type for shell P=A+B.
+ * @param[in]  shellb             Sheel type for shell B.
+ * @param[in]  nabcoor            # of nonzero coordinate differences between nuclear centers A and B.
+ * @param[out] ncolhrr            Maximum # of columns of the @a t and @a row matrix during construction.
+ * @param[out] nrothrr            Maximum # of elements of the @a t and @a row matrix during construction.
+ * @param[out] nrowhrr            # of nonzero row labels of the final matrix.
+ */
+ERD_OFFLOAD void erd__hrr_matrix_size(uint32_t nxyzet, uint32_t shellp, uint32_t shellb, uint32_t nabcoor,
+    uint32_t ncolhrr[restrict static 1], uint32_t nrothrr[restrict static 1], uint32_t nrowhrr[restrict static 1])
+{
+    uint32_t nxyzgo = nxyzet;
+    uint32_t nxyzho = 1;
+    uint32_t nxyzi = (shellp + 1) * (shellp + 2) / 2;
+    uint32_t shellg = shellp;
+    uint32_t nrow = 1;
+    uint32_t ncol = nxyzet;
+    uint32_t nrot = nxyzet;
+    for (uint32_t shellh = 1; shellh <= shellb; shellh++) {
+        nxyzgo -= nxyzi;
+        nxyzho += shellh + 1;
+        const uint32_t ngho = nxyzgo * nxyzho;
+        switch (nabcoor) {
+            case 3:
+            {
+                const uint32_t m = shellh / 3 + 1;
+                nrow += m * m;
+                if (shellh % 3 == 2)
+                    nrow += m;
+                break;
+            }
+            case 2:
+                nrow += shellh / 2 + 1;
+                break;
+            case 1:
+                nrow += 1;
+                break;
+        }
+        ncol = max32u(ngho, ncol);
+        nrot = max32u(nrow * ngho, nrot);
+        nxyzi -= shellg + 1;
+        --shellg;
+    }
+    *ncolhrr = ncol;
+    *nrothrr = nrot;
+    *nrowhrr = nrow;
+}
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "erd.h"
+#include "erdutil.h"
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__HRR_PAIR_SIZE */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : ERD__HRR_MATRIX_SIZE */
+/*  DESCRIPTION : This operation returns the # of int and flp words of */
+/*                the HRR matrix data of a shell pair set up by */
+/*                ERD__HRR_PAIR_MATRIX. */
+/*                  Input: */
+/*                    SHELLA(B)    =  shell types, SHELLA >= SHELLB */
+/*                    NABCOOR      =  # of nonzero coordinate */
+/*                                    differences between A and B */
+/*                  Output: */
+/*                    NINDEX       =  # of int words */
+/*                    NVALUE       =  # of flp words */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__hrr_pair_size(uint32_t shella, uint32_t shellb, uint32_t nabcoor,
+    size_t nindex[restrict static 1], size_t nvalue[restrict static 1])
+{
+    const uint32_t shellp = shella + shellb;
+    const uint32_t nxyza = (shella + 1) * (shella + 2) / 2;
+    const uint32_t nxyzb = (shellb + 1) * (shellb + 2) / 2;
+    const uint32_t nxyzet = (shellp + 1) * (shellp + 2) * (shellp + 3) / 6 - shella * (shella + 1) * (shella + 2) / 6;
+    uint32_t ncolhrr, nrothrr, nrowhrr;
+    erd__hrr_matrix_size(nxyzet, shellp, shellb, nabcoor, &ncolhrr, &nrothrr, &nrowhrr);
+    *nindex = PAD_LEN(nxyzb + 1) + PAD_LEN(nrowhrr * nxyza * nxyzb);
+    *nvalue = PAD_LEN(nrowhrr * nxyzb);
+}
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__HRR_PAIR_MATRIX */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : ERD__HRR_MATRIX */
+/*  DESCRIPTION : This operation sets up the HRR transformation matrix */
+/*                (e0| --> (ab| of the shell pair A,B, which depends */
+/*                only on the two shell types and on A-B. ERD__CSGTO */
+/*                takes it from here for the pairs that are set up in */
+/*                advance instead of calling ERD__HRR_MATRIX for every */
+/*                batch. The pair must be given in the order ERD__SET_ABCD */
+/*                uses: SHELLA > SHELLB, or SHELLA = SHELLB and A > B. */
+/*                The int data is NROWHRR, LROW (B) and, starting SIMD */
+/*                aligned, ROW (I,A,B), the flp data is T (I,B), with */
+/*                LROW, ROW and T as used by ERD__HRR_RY_TRANSFORM. */
+/*                  Input: */
+/*                    A,B          =  shell pair */
+/*                    SHELL        =  shell types */
+/*                    XYZ0         =  shell centers */
+/*                  Output: */
+/*                    INDEX        =  int data (see ERD__HRR_PAIR_SIZE) */
+/*                    VALUE        =  flp data (see ERD__HRR_PAIR_SIZE) */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__hrr_pair_matrix(uint32_t A, uint32_t B,
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 1],
+    uint32_t index[restrict], double value[restrict])
+{
+    const uint32_t shella = shell[A], shellb = shell[B];
+    const uint32_t shellp = shella + shellb;
+    const uint32_t nxyza = (shella + 1) * (shella + 2) / 2;
+    const uint32_t nxyzb = (shellb + 1) * (shellb + 2) / 2;
+    const uint32_t nxyzp = (shellp + 1) * (shellp + 2) / 2;
+    const uint32_t nxyzet = (shellp + 1) * (shellp + 2) * (shellp + 3) / 6 - shella * (shella + 1) * (shella + 2) / 6;
+    const double abx = xyz0[A*4] - xyz0[B*4];
+    const double aby = xyz0[A*4+1] - xyz0[B*4+1];
+    const double abz = xyz0[A*4+2] - xyz0[B*4+2];
+    const uint32_t nabcoor = (uint32_t)(abx != 0.0) + (uint32_t)(aby != 0.0) + (uint32_t)(abz != 0.0);
+
+    uint32_t ncolhrr, nrothrr, nrowhrr;
+    erd__hrr_matrix_size(nxyzet, shellp, shellb, nabcoor, &ncolhrr, &nrothrr, &nrowhrr);
+    uint32_t pos1, pos2;
+    ERD_SIMD_ALIGN double t[PAD_LEN(nrothrr*2)];
+    ERD_SIMD_ALIGN uint32_t row[PAD_LEN(nrothrr*2)];
+    ERD_SIMD_ALIGN uint32_t nrow[PAD_LEN(ncolhrr*2)];
+    erd__hrr_matrix(nrothrr, ncolhrr, nxyzet, nxyza, nxyzp,
+                     shella, shellb, shellp,
+                     nabcoor, abx, aby, abz,
+                     &pos1, &pos2, &nrowhrr,
+                     nrow, row, t);
+
+    index[0] = nrowhrr;
+    memcpy(&index[1], &nrow[pos1], nxyzb * sizeof(uint32_t));
+    memcpy(&index[PAD_LEN(nxyzb + 1)], &row[pos2], nrowhrr * nxyza * nxyzb * sizeof(uint32_t));
+    memcpy(value, &t[pos2], nrowhrr * nxyzb * sizeof(double));
+}
@@ -0,0 +1,217 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "erd.h"
+#include "erdutil.h"
+
+
+/* Invariant elements handled together: one AVX-512 vector, two AVX2 ones */
+#define HRR_RY_LANES 8
+
+
+/* One block of NL <= LANES invariant elements starting at L0. The block
+   passes through the HRR (or a plain copy), the y- and x-part ry steps in
+   the two LANES-wide buffers W0 and W1, and is then scattered to Y. */
+static ERD_FORCE_INLINE void hrr_ry_block(const uint32_t lanes, uint32_t nl, uint32_t l0,
+    uint32_t m, uint32_t nxyzx, uint32_t nxyzy,
+    uint32_t nrowhrr, const uint32_t *restrict lrowhrr, const uint32_t *restrict rowhrr, const double *restrict thrr,
+    uint32_t nryx, uint32_t nrowx, const uint32_t *restrict lrowx, const uint32_t *restrict rowx, const double *restrict rotx, const double *restrict normx,
+    uint32_t nryy, uint32_t nrowy, const uint32_t *restrict lrowy, const uint32_t *restrict rowy, const double *restrict roty, const double *restrict normy,
+    size_t sx, size_t sy, const size_t *restrict lane,
+    const double *restrict x, double *restrict y,
+    double *restrict w0, double *restrict w1)
+{
+/*             ...HRR: w0 (l,x,y) = sum x (l,i) * t (i,xy) over the */
+/*                nonzero elements of each column, in registers. */
+    if (lrowhrr != NULL) {
+        uint32_t n = 0;
+        for (uint32_t b = 0; b < nxyzy; b++) {
+            const uint32_t mrow = lrowhrr[b];
+            const double *tb = &thrr[b * nrowhrr];
+            for (uint32_t a = 0; a < nxyzx; a++) {
+                const uint32_t *rown = &rowhrr[n * nrowhrr];
+                double acc[lanes];
+                for (uint32_t l = 0; l < lanes; l++) {
+                    acc[l] = 0.0;
+                }
+                for (uint32_t i = 0; i < mrow; i++) {
+                    const double *xi = &x[(rown[i] - 1) * m + l0];
+                    const double t1 = tb[i];
+                    for (uint32_t l = 0; l < nl; l++) {
+                        acc[l] += t1 * xi[l];
+                    }
+                }
+                for (uint32_t l = 0; l < lanes; l++) {
+                    w0[n * lanes + l] = acc[l];
+                }
+                n++;
+            }
+        }
+    } else {
+        for (uint32_t n = 0; n < nxyzx * nxyzy; n++) {
+            for (uint32_t l = 0; l < nl; l++) {
+                w0[n * lanes + l] = x[n * m + l0 + l];
+            }
+        }
+    }
+    double *restrict src = w0;
+    double *restrict dst = w1;
+
+/*             ...y-part: w1 (l,x,ry) = sum w0 (l,x,y) * roty (y,ry), */
+/*                or the cartesian normalization in place. */
+    if (roty != NULL) {
+        for (uint32_t r = 0; r < nryy; r++) {
+            const uint32_t mrow = lrowy[r];
+            for (uint32_t a = 0; a < nxyzx; a++) {
+                double acc[lanes];
+                for (uint32_t l = 0; l < lanes; l++) {
+                    acc[l] = 0.0;
+                }
+                for (uint32_t i = 0; i < mrow; i++) {
+                    const double *si = &src[(a + nxyzx * rowy[r * nrowy + i]) * lanes];
+                    const double rot1 = roty[r * nrowy + i];
+                    for (uint32_t l = 0; l < lanes; l++) {
+                        acc[l] += rot1 * si[l];
+                    }
+                }
+                for (uint32_t l = 0; l < lanes; l++) {
+                    dst[(a + nxyzx * r) * lanes + l] = acc[l];
+                }
+            }
+        }
+        ERD_SWAP(src, dst);
+    } else if (normy != NULL) {
+        for (uint32_t b = 0; b < nxyzy; b++) {
+            const double scalar = normy[b];
+            for (uint32_t l = 0; l < nxyzx * lanes; l++) {
+                src[b * nxyzx * lanes + l] *= scalar;
+            }
+        }
+    }
+
+/*             ...x-part: w (l,rx,ry) = sum w (l,x,ry) * rotx (x,rx), */
+/*                or the cartesian normalization in place. */
+    if (rotx != NULL) {
+        for (uint32_t ry = 0; ry < nryy; ry++) {
+            for (uint32_t r = 0; r < nryx; r++) {
+                const uint32_t mrow = lrowx[r];
+                double acc[lanes];
+                for (uint32_t l = 0; l < lanes; l++) {
+                    acc[l] = 0.0;
+                }
+                for (uint32_t i = 0; i < mrow; i++) {
+                    const double *si = &src[(rowx[r * nrowx + i] + nxyzx * ry) * lanes];
+                    const double rot1 = rotx[r * nrowx + i];
+                    for (uint32_t l = 0; l < lanes; l++) {
+                        acc[l] += rot1 * si[l];
+                    }
+                }
+                for (uint32_t l = 0; l < lanes; l++) {
+                    dst[(r + nryx * ry) * lanes + l] = acc[l];
+                }
+            }
+        }
+        ERD_SWAP(src, dst);
+    } else if (normx != NULL) {
+        for (uint32_t ry = 0; ry < nryy; ry++) {
+            for (uint32_t a = 0; a < nxyzx; a++) {
+                const double scalar = normx[a];
+                for (uint32_t l = 0; l < lanes; l++) {
+                    src[(a + nxyzx * ry) * lanes + l] *= scalar;
+                }
+            }
+        }
+    }
+
+/*             ...move the ry-components into their final places. */
+    for (uint32_t ry = 0; ry < nryy; ry++) {
+        for (uint32_t rx = 0; rx < nryx; rx++) {
+            const double *s = &src[(rx + nryx * ry) * lanes];
+            double *yr = &y[rx * sx + ry * sy];
+            for (uint32_t l = 0; l < nl; l++) {
+                yr[lane[l0 + l]] = s[l];
+            }
+        }
+    }
+}
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__HRR_RY_TRANSFORM */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation performs for one side XY (= AB or CD) */
+/*                of a batch of contracted cartesian gaussian integrals */
+/*                the HRR transformation, the cartesian -> spherical */
+/*                transformations or cartesian normalizations of the */
+/*                x- and y-parts and the positioning of the resulting */
+/*                ry-components in one pass: */
+/*                   X (l,e0) --> Y (lane(l) + rx*SX + ry*SY) */
+/*                The invariant elements l are taken in blocks of */
+/*                HRR_RY_LANES, which go through all steps in two small */
+/*                buffers, so X is read and Y written only once. */
+/*                  Input: */
+/*                    M            =  # of invariant elements l */
+/*                    NXYZX(Y)     =  # of cartesian monomials of the */
+/*                                    x- and y-part */
+/*                    NROWHRR      =  maximum # of nonzero row elements */
+/*                                    per column in the HRR matrix */
+/*                    LROWHRR,     =  the HRR matrix as set up by */
+/*                    ROWHRR,THRR     ERD__HRR_MATRIX. If LROWHRR is */
+/*                                    NULL the y-part is an s-shell and */
+/*                                    X holds the NXYZX columns (l,x) */
+/*                    NRYX(Y)      =  # of ry-components of the x- and */
+/*                                    y-part */
+/*                    NROWX(Y),    =  cartesian -> spherical matrix of */
+/*                    LROWX(Y),       the x- and y-part as set up by */
+/*                    ROWX(Y),        ERD__RY_TABLE, or ROTX(Y) = NULL */
+/*                    ROTX(Y)         if it has none */
+/*                    NORMX(Y)     =  cartesian normalizations of the */
+/*                                    x- and y-part if ROTX(Y) = NULL, */
+/*                                    or NULL if they are not needed */
+/*                    SX(Y)        =  stride of the rx- (ry-) component */
+/*                                    in Y */
+/*                    LANE (L)     =  offset in Y of invariant element l */
+/*                    X            =  batch (l,e0) */
+/*                  Output: */
+/*                    Y            =  transformed and positioned batch */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__hrr_ry_transform(uint32_t m, uint32_t nxyzx, uint32_t nxyzy,
+    uint32_t nrowhrr, const uint32_t *restrict lrowhrr, const uint32_t *restrict rowhrr, const double *restrict thrr,
+    uint32_t nryx, uint32_t nrowx, const uint32_t *restrict lrowx, const uint32_t *restrict rowx, const double *restrict rotx, const double *restrict normx,
+    uint32_t nryy, uint32_t nrowy, const uint32_t *restrict lrowy, const uint32_t *restrict rowy, const double *restrict roty, const double *restrict normy,
+    size_t sx, size_t sy, const size_t lane[restrict static m],
+    const double x[restrict], double y[restrict])
+{
+    ERD_SIMD_ALIGN double w0[nxyzx * nxyzy * HRR_RY_LANES];
+    ERD_SIMD_ALIGN double w1[nxyzx * nxyzy * HRR_RY_LANES];
+    uint32_t l0 = 0;
+    for (; l0 + HRR_RY_LANES <= m; l0 += HRR_RY_LANES) {
+        hrr_ry_block(HRR_RY_LANES, HRR_RY_LANES, l0, m, nxyzx, nxyzy,
+            nrowhrr, lrowhrr, rowhrr, thrr,
+            nryx, nrowx, lrowx, rowx, rotx, normx,
+            nryy, nrowy, lrowy, rowy, roty, normy,
+            sx, sy, lane, x, y, w0, w1);
+    }
+/*             ...a remainder of at least half a block is padded to a */
+/*                full one, smaller ones go element by element. */
+    if (m - l0 >= HRR_RY_LANES / 2) {
+        memset(w0, 0, sizeof(w0));
+        hrr_ry_block(HRR_RY_LANES, m - l0, l0, m, nxyzx, nxyzy,
+            nrowhrr, lrowhrr, rowhrr, thrr,
+            nryx, nrowx, lrowx, rowx, rotx, normx,
+            nryy, nrowy, lrowy, rowy, roty, normy,
+            sx, sy, lane, x, y, w0, w1);
+        l0 = m;
+    }
+    for (; l0 < m; l0++) {
+        hrr_ry_block(1, 1, l0, m, nxyzx, nxyzy,
+            nrowhrr, lrowhrr, rowhrr, thrr,
+            nryx, nrowx, lrowx, rowx, rotx, normx,
+            nryy, nrowy, lrowy, rowy, roty, normy,
+            sx, sy, lane, x, y, w0, w1);
+    }
+}
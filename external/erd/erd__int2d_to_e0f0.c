@@ -4,6 +4,7 @@
 #include <immintrin.h>
 
 #include "erd.h"
+#include "erdutil.h"
 
 #ifdef __INTEL_OFFLOAD
 #pragma offload_attribute(push, target(mic))
@@ -120,11 +121,254 @@
 /*                                   to all current exponent quadruplets */
 /* ------------------------------------------------------------------------ */
 
+/* The compiler-vectorized triple loop: the reference for the explicit
+   x86 kernels below and the fallback for other targets */
+int erd__int2d_to_e0f0_scalar (int shella, int shellp, int shellc, int shellq,
+                               int ngqexq, int nxyzet, int nxyzft,
+                               double *int2dx, double *int2dy, double *int2dz,
+                               int **vrrtab, double *batch)
+{
+    uint64_t m;
+    int *tabe;
+    int *tabf;
+    int ke;
+    int kf;
+    uint64_t indx;
+    uint64_t indy;
+    uint64_t indz;
+    uint64_t indb;
+    int xe, ye, ze, xf, yf, zf;   
+    int m1;
+    double sum = 0;
+
+    tabe = vrrtab[shella];
+    tabf = vrrtab[shellc];
+    indb = 0;
+    for (kf = 0; kf < nxyzft; kf++)
+    {
+        xf = tabf[kf * 4 + 0];
+        yf = tabf[kf * 4 + 1];
+        zf = tabf[kf * 4 + 2];
+        for(ke = 0; ke < nxyzet; ke++)
+        {
+            xe = tabe[ke * 4 + 0];
+            ye = tabe[ke * 4 + 1];
+            ze = tabe[ke * 4 + 2];
+            indx = (xe + xf * (shellp + 1)) * ngqexq;
+            indy = (ye + yf * (shellp + 1)) * ngqexq;
+            indz = (ze + zf * (shellp + 1)) * ngqexq;
+            //indb = kf * nxyzet + ke;
+            sum = 0.0;
+            for(m = 0; m < ngqexq; m+=SIMDW)
+            {
+#pragma vector aligned
+                for(m1 = 0; m1 < SIMDW; m1++)
+                {
+                    sum += int2dx[m + m1 + indx]
+                        * int2dy[m + m1 + indy]
+                        * int2dz[m + m1 + indz];
+                }
+            }
+            batch[indb++] = sum;
+        }
+    }
+    return 0;
+}
+
+
+#if !defined (__MIC__)
+#if defined (__AVX2__) && defined (__FMA__)
+/* Sums of the four accumulators a, b, c, d in the four lanes */
+static inline __m256d reduce4_pd (__m256d a, __m256d b, __m256d c, __m256d d)
+{
+    const __m256d ab = _mm256_hadd_pd(a, b);
+    const __m256d cd = _mm256_hadd_pd(c, d);
+    return _mm256_add_pd(_mm256_permute2f128_pd(ab, cd, 0x20),
+                         _mm256_permute2f128_pd(ab, cd, 0x31));
+}
+#endif
+
+
+/* The x, y and z rows of output (ke, kf) in the 2D integral arrays */
+static ERD_FORCE_INLINE void row_offsets (const int *tabe, const int *tabf, int ke, int kf,
+                                          int shellp, int ngqexq,
+                                          uint64_t *indx, uint64_t *indy, uint64_t *indz)
+{
+    *indx = (uint64_t)(tabe[ke * 4 + 0] + tabf[kf * 4 + 0] * (shellp + 1)) * ngqexq;
+    *indy = (uint64_t)(tabe[ke * 4 + 1] + tabf[kf * 4 + 1] * (shellp + 1)) * ngqexq;
+    *indz = (uint64_t)(tabe[ke * 4 + 2] + tabf[kf * 4 + 2] * (shellp + 1)) * ngqexq;
+}
+
+
+/* The [E0|F0] assembly for the monomial tables tabe and tabf. It is
+   inlined into erd__int2d_to_e0f0 for the general case and into the
+   class kernels below with constant shells and tables. */
+static ERD_FORCE_INLINE int int2d_to_e0f0_kernel (int shellp, int ngqexq, int nxyzet, int nxyzft,
+                                                  const double *int2dx, const double *int2dy,
+                                                  const double *int2dz,
+                                                  const int *tabe, const int *tabf, double *batch)
+{
+#if defined (__AVX2__) && defined (__FMA__)
+    /* Four (ke, kf) outputs at a time: four independent FMA chains share
+       each pass over the roots, and one reduction stores all four sums.
+       The 2D rows are gathered by the vrrtable indices with unaligned
+       loads, as ngqexq is only a multiple of SIMDW. */
+    const int nout = nxyzet * nxyzft;
+    const int nout4 = nout & ~3;
+    for (int indb = 0; indb < nout4; indb += 4)
+    {
+        uint64_t indx[4], indy[4], indz[4];
+        for (int i = 0; i < 4; i++)
+        {
+            row_offsets(tabe, tabf, (indb + i) % nxyzet, (indb + i) / nxyzet,
+                        shellp, ngqexq, &indx[i], &indy[i], &indz[i]);
+        }
+        const double *x0 = &int2dx[indx[0]], *y0 = &int2dy[indy[0]], *z0 = &int2dz[indz[0]];
+        const double *x1 = &int2dx[indx[1]], *y1 = &int2dy[indy[1]], *z1 = &int2dz[indz[1]];
+        const double *x2 = &int2dx[indx[2]], *y2 = &int2dy[indy[2]], *z2 = &int2dz[indz[2]];
+        const double *x3 = &int2dx[indx[3]], *y3 = &int2dy[indy[3]], *z3 = &int2dz[indz[3]];
+        int m = 0;
+    #if defined (__AVX512F__)
+        __m512d sum0 = _mm512_setzero_pd(), sum1 = _mm512_setzero_pd();
+        __m512d sum2 = _mm512_setzero_pd(), sum3 = _mm512_setzero_pd();
+        for (; m + 8 <= ngqexq; m += 8)
+        {
+            sum0 = _mm512_fmadd_pd(_mm512_mul_pd(_mm512_loadu_pd(&x0[m]), _mm512_loadu_pd(&y0[m])), _mm512_loadu_pd(&z0[m]), sum0);
+            sum1 = _mm512_fmadd_pd(_mm512_mul_pd(_mm512_loadu_pd(&x1[m]), _mm512_loadu_pd(&y1[m])), _mm512_loadu_pd(&z1[m]), sum1);
+            sum2 = _mm512_fmadd_pd(_mm512_mul_pd(_mm512_loadu_pd(&x2[m]), _mm512_loadu_pd(&y2[m])), _mm512_loadu_pd(&z2[m]), sum2);
+            sum3 = _mm512_fmadd_pd(_mm512_mul_pd(_mm512_loadu_pd(&x3[m]), _mm512_loadu_pd(&y3[m])), _mm512_loadu_pd(&z3[m]), sum3);
+        }
+        __m256d acc0 = _mm256_add_pd(_mm512_castpd512_pd256(sum0), _mm512_extractf64x4_pd(sum0, 1));
+        __m256d acc1 = _mm256_add_pd(_mm512_castpd512_pd256(sum1), _mm512_extractf64x4_pd(sum1, 1));
+        __m256d acc2 = _mm256_add_pd(_mm512_castpd512_pd256(sum2), _mm512_extractf64x4_pd(sum2, 1));
+        __m256d acc3 = _mm256_add_pd(_mm512_castpd512_pd256(sum3), _mm512_extractf64x4_pd(sum3, 1));
+    #else
+        __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+        __m256d acc2 = _mm256_setzero_pd(), acc3 = _mm256_setzero_pd();
+    #endif
+        for (; m + 4 <= ngqexq; m += 4)
+        {
+            acc0 = _mm256_fmadd_pd(_mm256_mul_pd(_mm256_loadu_pd(&x0[m]), _mm256_loadu_pd(&y0[m])), _mm256_loadu_pd(&z0[m]), acc0);
+            acc1 = _mm256_fmadd_pd(_mm256_mul_pd(_mm256_loadu_pd(&x1[m]), _mm256_loadu_pd(&y1[m])), _mm256_loadu_pd(&z1[m]), acc1);
+            acc2 = _mm256_fmadd_pd(_mm256_mul_pd(_mm256_loadu_pd(&x2[m]), _mm256_loadu_pd(&y2[m])), _mm256_loadu_pd(&z2[m]), acc2);
+            acc3 = _mm256_fmadd_pd(_mm256_mul_pd(_mm256_loadu_pd(&x3[m]), _mm256_loadu_pd(&y3[m])), _mm256_loadu_pd(&z3[m]), acc3);
+        }
+        __m256d sum = reduce4_pd(acc0, acc1, acc2, acc3);
+        for (; m < ngqexq; m++)
+        {
+            sum = _mm256_add_pd(sum, _mm256_set_pd(x3[m] * y3[m] * z3[m], x2[m] * y2[m] * z2[m],
+                                                   x1[m] * y1[m] * z1[m], x0[m] * y0[m] * z0[m]));
+        }
+        _mm256_storeu_pd(&batch[indb], sum);
+    }
+    /* The remainder loop starts at the constant nout4, so its trip count
+       is a known 0...3 in the class kernels */
+    for (int indb = nout4; indb < nout; indb++)
+    {
+        uint64_t indx, indy, indz;
+        row_offsets(tabe, tabf, indb % nxyzet, indb / nxyzet, shellp, ngqexq, &indx, &indy, &indz);
+        __m256d acc = _mm256_setzero_pd();
+        int m = 0;
+        for (; m + 4 <= ngqexq; m += 4)
+        {
+            acc = _mm256_fmadd_pd(_mm256_mul_pd(_mm256_loadu_pd(&int2dx[indx + m]), _mm256_loadu_pd(&int2dy[indy + m])),
+                                  _mm256_loadu_pd(&int2dz[indz + m]), acc);
+        }
+        const __m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+        double sum = _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+        for (; m < ngqexq; m++)
+        {
+            sum += int2dx[indx + m] * int2dy[indy + m] * int2dz[indz + m];
+        }
+        batch[indb] = sum;
+    }
+#else
+    int indb = 0;
+    for (int kf = 0; kf < nxyzft; kf++)
+    {
+        for (int ke = 0; ke < nxyzet; ke++)
+        {
+            uint64_t indx, indy, indz;
+            row_offsets(tabe, tabf, ke, kf, shellp, ngqexq, &indx, &indy, &indz);
+            double sum = 0.0;
+            for (int m = 0; m < ngqexq; m += SIMDW)
+            {
+#pragma vector aligned
+                for (int m1 = 0; m1 < SIMDW; m1++)
+                {
+                    sum += int2dx[m + m1 + indx]
+                        * int2dy[m + m1 + indy]
+                        * int2dz[m + m1 + indz];
+                }
+            }
+            batch[indb++] = sum;
+        }
+    }
+#endif
+    return 0;
+}
+
+
+/* Monomials (x, y, z, offset) of the shells 0 to 4 in vrrtable order,
+   so that the class kernels see constant tables */
+static const int xyz_table[] = {
+    0, 0, 0, 0,
+    1, 0, 0, 0,  0, 1, 0, 4,  0, 0, 1, 8,
+    2, 0, 0, 0,  1, 1, 0, 4,  1, 0, 1, 8,  0, 2, 0, 12,  0, 1, 1, 16,  0, 0, 2, 20,
+    3, 0, 0, 0,  2, 1, 0, 4,  2, 0, 1, 8,  1, 2, 0, 12,  1, 1, 1, 16,  1, 0, 2, 20,
+    0, 3, 0, 24, 0, 2, 1, 28, 0, 1, 2, 32, 0, 0, 3, 36,
+    4, 0, 0, 0,  3, 1, 0, 4,  3, 0, 1, 8,  2, 2, 0, 12,  2, 1, 1, 16,  2, 0, 2, 20,
+    1, 3, 0, 24, 1, 2, 1, 28, 1, 1, 2, 32, 1, 0, 3, 36, 0, 4, 0, 40, 0, 3, 1, 44,
+    0, 2, 2, 48, 0, 1, 3, 52, 0, 0, 4, 56
+};
+
+/* # of monomials of the shells below l, and of the shells l0 to l1 */
+#define NXYZ_BELOW(l)       ((l) * ((l) + 1) * ((l) + 2) / 6)
+#define NXYZ_RANGE(l0, l1)  (NXYZ_BELOW((l1) + 1) - NXYZ_BELOW(l0))
+
+/* Kernel of the class (la lb|lc ld): shells, trip counts and index
+   tables are compile-time constants */
+#define ERD_E0F0_CLASS(la, lb, lc, ld) \
+static int int2d_to_e0f0_##la##lb##lc##ld (int ngqexq, const double *int2dx, const double *int2dy, \
+                                          const double *int2dz, double *batch) \
+{ \
+    return int2d_to_e0f0_kernel(la + lb, ngqexq, NXYZ_RANGE(la, la + lb), NXYZ_RANGE(lc, lc + ld), \
+                                int2dx, int2dy, int2dz, &xyz_table[4 * NXYZ_BELOW(la)], \
+                                &xyz_table[4 * NXYZ_BELOW(lc)], batch); \
+}
+
+#define ERD_E0F0_CLASSES_CD(la, lb) \
+    ERD_E0F0_CLASS(la, lb, 0, 0) ERD_E0F0_CLASS(la, lb, 0, 1) ERD_E0F0_CLASS(la, lb, 0, 2) \
+    ERD_E0F0_CLASS(la, lb, 1, 0) ERD_E0F0_CLASS(la, lb, 1, 1) ERD_E0F0_CLASS(la, lb, 1, 2) \
+    ERD_E0F0_CLASS(la, lb, 2, 0) ERD_E0F0_CLASS(la, lb, 2, 1) ERD_E0F0_CLASS(la, lb, 2, 2)
+
+ERD_E0F0_CLASSES_CD(0, 0) ERD_E0F0_CLASSES_CD(0, 1) ERD_E0F0_CLASSES_CD(0, 2)
+ERD_E0F0_CLASSES_CD(1, 0) ERD_E0F0_CLASSES_CD(1, 1) ERD_E0F0_CLASSES_CD(1, 2)
+ERD_E0F0_CLASSES_CD(2, 0) ERD_E0F0_CLASSES_CD(2, 1) ERD_E0F0_CLASSES_CD(2, 2)
+
+#define ERD_E0F0_ENTRIES_CD(la, lb) \
+    { { int2d_to_e0f0_##la##lb##00, int2d_to_e0f0_##la##lb##01, int2d_to_e0f0_##la##lb##02 }, \
+      { int2d_to_e0f0_##la##lb##10, int2d_to_e0f0_##la##lb##11, int2d_to_e0f0_##la##lb##12 }, \
+      { int2d_to_e0f0_##la##lb##20, int2d_to_e0f0_##la##lb##21, int2d_to_e0f0_##la##lb##22 } }
+
+typedef int (*e0f0_class_kernel_t) (int ngqexq, const double *int2dx, const double *int2dy,
+                                    const double *int2dz, double *batch);
+
+/* Indexed by [shella][shellb][shellc][shelld] for shells up to d */
+static const e0f0_class_kernel_t e0f0_class_kernels[3][3][3][3] = {
+    { ERD_E0F0_ENTRIES_CD(0, 0), ERD_E0F0_ENTRIES_CD(0, 1), ERD_E0F0_ENTRIES_CD(0, 2) },
+    { ERD_E0F0_ENTRIES_CD(1, 0), ERD_E0F0_ENTRIES_CD(1, 1), ERD_E0F0_ENTRIES_CD(1, 2) },
+    { ERD_E0F0_ENTRIES_CD(2, 0), ERD_E0F0_ENTRIES_CD(2, 1), ERD_E0F0_ENTRIES_CD(2, 2) }
+};
+#endif
+
+
 int erd__int2d_to_e0f0 (int shella, int shellp, int shellc, int shellq,
                         int ngqexq, int nxyzet, int nxyzft,
                         double *int2dx, double *int2dy, double *int2dz,
                         int **vrrtab, double *batch)
 {
+#if defined (__MIC__)
     uint64_t m;
     int *tabe;
     int *tabf;
@@ -138,7 +382,6 @@ int erd__int2d_to_e0f0 (int shella, int shellp, int shellc, int shellq,
     tabe = vrrtab[shella];
     tabf = vrrtab[shellc];
     indb = 0;
-#if defined (__MIC__)
     __m512i zero512 = _mm512_setzero_epi32();
     int indxyz[16] __attribute__((aligned(64)));
     __m512i ngqexq512 = _mm512_set1_epi32(ngqexq);
@@ -171,41 +414,17 @@ int erd__int2d_to_e0f0 (int shella, int shellp, int shellc, int shellq,
             batch[indb++] = _mm512_reduce_add_pd(sum512);
         }
     }
+    return 0;
 #else
-    int xe, ye, ze, xf, yf, zf;   
-    int m1;
-    double sum = 0;
-
-    for (kf = 0; kf < nxyzft; kf++)
+    const int shellb = shellp - shella;
+    const int shelld = shellq - shellc;
+    if ((shella <= 2) && (shellb <= 2) && (shellc <= 2) && (shelld <= 2))
     {
-        xf = tabf[kf * 4 + 0];
-        yf = tabf[kf * 4 + 1];
-        zf = tabf[kf * 4 + 2];
-        for(ke = 0; ke < nxyzet; ke++)
-        {
-            xe = tabe[ke * 4 + 0];
-            ye = tabe[ke * 4 + 1];
-            ze = tabe[ke * 4 + 2];
-            indx = (xe + xf * (shellp + 1)) * ngqexq;
-            indy = (ye + yf * (shellp + 1)) * ngqexq;
-            indz = (ze + zf * (shellp + 1)) * ngqexq;
-            //indb = kf * nxyzet + ke;
-            sum = 0.0;
-            for(m = 0; m < ngqexq; m+=SIMDW)
-            {
-#pragma vector aligned
-                for(m1 = 0; m1 < SIMDW; m1++)
-                {
-                    sum += int2dx[m + m1 + indx]
-                        * int2dy[m + m1 + indy]
-                        * int2dz[m + m1 + indz];
-                }
-            }
-            batch[indb++] = sum;
-        }
+        return e0f0_class_kernels[shella][shellb][shellc][shelld](ngqexq, int2dx, int2dy, int2dz, batch);
     }
+    return int2d_to_e0f0_kernel(shellp, ngqexq, nxyzet, nxyzft, int2dx, int2dy, int2dz,
+                                vrrtab[shella], vrrtab[shellc], batch);
 #endif
-    return 0;
 }
 
 
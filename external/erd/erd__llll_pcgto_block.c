@@ -0,0 +1,492 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "boys.h"
+#include "erd.h"
+#include "erdutil.h"
+#include "xyz.h"
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(push, target(mic))
+#endif
+
+
+/* Number of primitive quartets evaluated together, one per SIMD lane */
+#define IJKL_BLOCK 8
+
+/* Part pairs of a center pair: (s,s), (s,p), (p,s), (p,p) of two L-shells,
+   which need 1 + 4 + 3 + 9 [e0| monomials */
+#define MAX_PART_PAIRS 4
+#define MAX_PART_E0    17
+
+
+/* The parts (s- and/or p-) of the two shells of a center pair, each part
+   pair with its e0 = la...la+lb monomials in the contracted [e0|f0] */
+struct PartPairs {
+    uint32_t count;
+    uint32_t la[MAX_PART_PAIRS], lb[MAX_PART_PAIRS];
+    uint32_t e0[MAX_PART_PAIRS], ne[MAX_PART_PAIRS], offset[MAX_PART_PAIRS];
+    uint32_t total;
+};
+
+static void set_part_pairs(uint32_t shella, uint32_t lshella, uint32_t shellb, uint32_t lshellb,
+    struct PartPairs *pairs)
+{
+    pairs->count = 0;
+    pairs->total = 0;
+    for (uint32_t la = lshella ? 0 : shella; la <= shella; la++) {
+        for (uint32_t lb = lshellb ? 0 : shellb; lb <= shellb; lb++) {
+            const uint32_t n = pairs->count++;
+            pairs->la[n] = la;
+            pairs->lb[n] = lb;
+            pairs->e0[n] = NXYZ_BELOW(la);
+            pairs->ne[n] = NXYZ_BELOW(la + lb + 1) - NXYZ_BELOW(la);
+            pairs->offset[n] = pairs->total;
+            pairs->total += pairs->ne[n];
+        }
+    }
+}
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : L_CLASS_KERNEL */
+/*  DESCRIPTION : Contracted [e0|f0] batches of all part quartets of a */
+/*                quartet of s-, p- and L-shells with shellp = e0 and */
+/*                shellq = f0 shells at most. The [e0|f0] primitives */
+/*                are generated by the Obara-Saika recurrences once per */
+/*                primitive quartet, for IJKL_BLOCK quartets at a time, */
+/*                from e0 = la and f0 = lc of the lowest parts on, and */
+/*                contracted into each part quartet with its own */
+/*                coefficient products. */
+/*                  Input: */
+/*                    NIJ(KL)      =  # of ij (kl) primitive pairs */
+/*                    P,PX,PY,PZ   =  exponent sums and product centers */
+/*                                    of the ij pairs, same for Q and */
+/*                                    the kl pairs */
+/*                    SCALEP(Q)    =  exponential prefactors of the ij */
+/*                                    (kl) pairs */
+/*                    WAB(CD)      =  coefficient products of the ij */
+/*                                    (kl) pairs for each part pair */
+/*                    XYZA(C)      =  coordinates of centers 1 (3) */
+/*                    FACTOR       =  overall prefactor */
+/*                  Output: */
+/*                    E0F0         =  contracted [e0|f0] of the part */
+/*                                    pairs as e0f0 (e0,f0) */
+/* ------------------------------------------------------------------------ */
+static ERD_FORCE_INLINE void l_class_kernel(uint32_t shellp, uint32_t shellq,
+    uint32_t nij, uint32_t nkl,
+    const double p[restrict static 1], const double ppx[restrict static 1], const double ppy[restrict static 1], const double ppz[restrict static 1],
+    const double scalep[restrict static 1],
+    const double q[restrict static 1], const double qqx[restrict static 1], const double qqy[restrict static 1], const double qqz[restrict static 1],
+    const double scaleq[restrict static 1],
+    const struct PartPairs *restrict pairsab, size_t ldab, const double *restrict wab,
+    const struct PartPairs *restrict pairscd, size_t ldcd, const double *restrict wcd,
+    const double xyza[restrict static 3], const double xyzc[restrict static 3],
+    double factor,
+    double *restrict e0f0)
+{
+    const uint32_t shellt = shellp + shellq;
+    const uint32_t nxyze = NXYZ_BELOW(shellp + 1);
+    const uint32_t nxyzf = NXYZ_BELOW(shellq + 1);
+    const uint32_t la = pairsab->la[0];
+    const uint32_t ntotal = pairsab->total * pairscd->total;
+
+    /* ...the contracted [e0|f0], summed separately over the lanes */
+    ERD_SIMD_ALIGN double sum[ntotal][IJKL_BLOCK];
+    for (uint32_t i = 0; i < ntotal; i++) {
+        for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+            sum[i][k] = 0.0;
+        }
+    }
+    const uint32_t nijkl = nij * nkl;
+    for (uint32_t ijkl0 = 0; ijkl0 < nijkl; ijkl0 += IJKL_BLOCK) {
+        const uint32_t nk = MIN(IJKL_BLOCK, nijkl - ijkl0);
+
+        /* ...[e0|f0]^(m) with v[f][m][e][k] */
+        ERD_SIMD_ALIGN double v[nxyzf][shellt + 1][nxyze][IJKL_BLOCK];
+        ERD_SIMD_ALIGN double pa[3][IJKL_BLOCK], qc[3][IJKL_BLOCK], wp[3][IJKL_BLOCK], wq[3][IJKL_BLOCK];
+        ERD_SIMD_ALIGN double rhop[IJKL_BLOCK], rhoq[IJKL_BLOCK], u2[IJKL_BLOCK], u3[IJKL_BLOCK], u4[IJKL_BLOCK];
+        ERD_SIMD_ALIGN double lanewab[MAX_PART_PAIRS][IJKL_BLOCK], lanewcd[MAX_PART_PAIRS][IJKL_BLOCK];
+        /* ...the lanes past the last quartet repeat it with zero scale */
+        uint32_t lane_ij[IJKL_BLOCK], lane_kl[IJKL_BLOCK];
+        uint32_t ij = ijkl0 / nkl;
+        uint32_t kl = ijkl0 % nkl;
+        for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+            lane_ij[k] = ij;
+            lane_kl[k] = kl;
+            if (k + 1 < nk) {
+                kl++;
+                if (kl == nkl) {
+                    kl = 0;
+                    ij++;
+                }
+            }
+        }
+        for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+            const uint32_t ij = lane_ij[k];
+            const uint32_t kl = lane_kl[k];
+            const double pval = p[ij];
+            const double qval = q[kl];
+            const double pqmult = pval * qval;
+            const double pqplus = pval + qval;
+            const double pqpinv = 1.0 / pqplus;
+            const double pqx = ppx[ij] - qqx[kl];
+            const double pqy = ppy[ij] - qqy[kl];
+            const double pqz = ppz[ij] - qqz[kl];
+            const double t = (pqx * pqx + pqy * pqy + pqz * pqz) * pqmult * pqpinv;
+            const double scale = (k < nk) ? factor * scalep[ij] * scaleq[kl] / (pqmult * __builtin_sqrt(pqplus)) : 0.0;
+            pa[0][k] = ppx[ij] - xyza[0];
+            pa[1][k] = ppy[ij] - xyza[1];
+            pa[2][k] = ppz[ij] - xyza[2];
+            qc[0][k] = qqx[kl] - xyzc[0];
+            qc[1][k] = qqy[kl] - xyzc[1];
+            qc[2][k] = qqz[kl] - xyzc[2];
+            wp[0][k] = -qval * pqpinv * pqx;
+            wp[1][k] = -qval * pqpinv * pqy;
+            wp[2][k] = -qval * pqpinv * pqz;
+            wq[0][k] = pval * pqpinv * pqx;
+            wq[1][k] = pval * pqpinv * pqy;
+            wq[2][k] = pval * pqpinv * pqz;
+            rhop[k] = qval * pqpinv;
+            rhoq[k] = pval * pqpinv;
+            u2[k] = 0.5 * pqpinv;
+            u3[k] = 0.5 / pval;
+            u4[k] = 0.5 / qval;
+            for (uint32_t n = 0; n < pairsab->count; n++) {
+                lanewab[n][k] = wab[n * ldab + ij];
+            }
+            for (uint32_t n = 0; n < pairscd->count; n++) {
+                lanewcd[n][k] = wcd[n * ldcd + kl];
+            }
+            if (shellt == 1) {
+                const struct Boys01 boys = boys01(t, scale);
+                v[0][0][0][k] = boys.f0;
+                v[0][1][0][k] = boys.f1;
+            } else if (shellt == 2) {
+                const struct Boys012 boys = boys012(t, scale);
+                v[0][0][0][k] = boys.f0;
+                v[0][1][0][k] = boys.f1;
+                v[0][2][0][k] = boys.f2;
+            } else if (shellt == 3) {
+                const struct Boys0123 boys = boys0123(t, scale);
+                v[0][0][0][k] = boys.f0;
+                v[0][1][0][k] = boys.f1;
+                v[0][2][0][k] = boys.f2;
+                v[0][3][0][k] = boys.f3;
+            } else {
+                const struct Boys01234 boys = boys01234(t, scale);
+                v[0][0][0][k] = boys.f0;
+                v[0][1][0][k] = boys.f1;
+                v[0][2][0][k] = boys.f2;
+                v[0][3][0][k] = boys.f3;
+                v[0][4][0][k] = boys.f4;
+            }
+        }
+
+        /* ...[e0|00]^(m) = PA_i [e0-1i|00]^(m) + WP_i [e0-1i|00]^(m+1) +
+              (e_i-1)/2p ([e0-2i|00]^(m) - rho/p [e0-2i|00]^(m+1)) */
+        for (uint32_t shell = 1; shell <= shellp; shell++) {
+            for (uint32_t e = NXYZ_BELOW(shell); e < NXYZ_BELOW(shell + 1); e++) {
+                const uint32_t axis = xyz_axis[e];
+                const uint32_t e1 = xyz_lower[e][axis];
+                const uint32_t e2 = xyz_lower[e1][axis];
+                const double n1 = (double)xyz_exponent[e1][axis];
+                for (uint32_t m = 0; m <= shellt - shell; m++) {
+                    for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+                        v[0][m][e][k] = pa[axis][k] * v[0][m][e1][k] + wp[axis][k] * v[0][m + 1][e1][k] +
+                            n1 * u3[k] * (v[0][m][e2][k] - rhop[k] * v[0][m + 1][e2][k]);
+                    }
+                }
+            }
+        }
+
+        /* ...[e0|f0]^(m) = QC_i [e0|f0-1i]^(m) + WQ_i [e0|f0-1i]^(m+1) +
+              (f_i-1)/2q ([e0|f0-2i]^(m) - rho/q [e0|f0-2i]^(m+1)) +
+              e_i/2(p+q) [e0-1i|f0-1i]^(m+1), only for the e0 that are
+              still needed for the [e0|f0] with e0 >= la */
+        for (uint32_t shellf = 1; shellf <= shellq; shellf++) {
+            const uint32_t shell0 = (la + shellf > shellq) ? la + shellf - shellq : 0;
+            for (uint32_t f = NXYZ_BELOW(shellf); f < NXYZ_BELOW(shellf + 1); f++) {
+                const uint32_t axis = xyz_axis[f];
+                const uint32_t f1 = xyz_lower[f][axis];
+                const uint32_t f2 = xyz_lower[f1][axis];
+                const double n1 = (double)xyz_exponent[f1][axis];
+                for (uint32_t shell = shell0; shell <= shellp; shell++) {
+                    for (uint32_t e = NXYZ_BELOW(shell); e < NXYZ_BELOW(shell + 1); e++) {
+                        const uint32_t e1 = xyz_lower[e][axis];
+                        const double n2 = (double)xyz_exponent[e][axis];
+                        for (uint32_t m = 0; m <= shellt - shellf - shell; m++) {
+                            for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+                                v[f][m][e][k] = qc[axis][k] * v[f1][m][e][k] + wq[axis][k] * v[f1][m + 1][e][k] +
+                                    n1 * u4[k] * (v[f2][m][e][k] - rhoq[k] * v[f2][m + 1][e][k]);
+                            }
+                            /* ...[e0-1i|f0-1i] below shell0 is not set */
+                            if (n2 != 0.0) {
+                                for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+                                    v[f][m][e][k] += n2 * u2[k] * v[f1][m + 1][e1][k];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /* ...contract into every part quartet with its coefficients */
+        for (uint32_t nab = 0; nab < pairsab->count; nab++) {
+            for (uint32_t ncd = 0; ncd < pairscd->count; ncd++) {
+                ERD_SIMD_ALIGN double w[IJKL_BLOCK];
+                for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+                    w[k] = lanewab[nab][k] * lanewcd[ncd][k];
+                }
+                for (uint32_t e = 0; e < pairsab->ne[nab]; e++) {
+                    const uint32_t row = (pairsab->offset[nab] + e) * pairscd->total + pairscd->offset[ncd];
+                    for (uint32_t f = 0; f < pairscd->ne[ncd]; f++) {
+                        const double *restrict x = v[pairscd->e0[ncd] + f][0][pairsab->e0[nab] + e];
+                        for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+                            sum[row + f][k] += w[k] * x[k];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < ntotal; i++) {
+        double s = 0.0;
+        for (uint32_t k = 0; k < IJKL_BLOCK; k++) {
+            s += sum[i][k];
+        }
+        e0f0[i] = s;
+    }
+}
+
+
+#define ERD_LLLL_CLASS(shellp, shellq) \
+static void erd__llll_##shellp##shellq( \
+    uint32_t nij, uint32_t nkl, \
+    const double p[restrict static 1], const double ppx[restrict static 1], const double ppy[restrict static 1], const double ppz[restrict static 1], \
+    const double scalep[restrict static 1], \
+    const double q[restrict static 1], const double qqx[restrict static 1], const double qqy[restrict static 1], const double qqz[restrict static 1], \
+    const double scaleq[restrict static 1], \
+    const struct PartPairs *restrict pairsab, size_t ldab, const double *restrict wab, \
+    const struct PartPairs *restrict pairscd, size_t ldcd, const double *restrict wcd, \
+    const double xyza[restrict static 3], const double xyzc[restrict static 3], \
+    double factor, double *restrict e0f0) \
+{ \
+    l_class_kernel(shellp, shellq, nij, nkl, p, ppx, ppy, ppz, scalep, q, qqx, qqy, qqz, scaleq, \
+        pairsab, ldab, wab, pairscd, ldcd, wcd, xyza, xyzc, factor, e0f0); \
+}
+
+ERD_LLLL_CLASS(0, 1)
+ERD_LLLL_CLASS(0, 2)
+ERD_LLLL_CLASS(1, 0)
+ERD_LLLL_CLASS(1, 1)
+ERD_LLLL_CLASS(1, 2)
+ERD_LLLL_CLASS(2, 0)
+ERD_LLLL_CLASS(2, 1)
+ERD_LLLL_CLASS(2, 2)
+
+typedef __typeof__(erd__llll_11) *l_class_kernel_t;
+
+/* Indexed by the e0 and f0 shells shellp = l1 + l2 and shellq = l3 + l4 */
+static const l_class_kernel_t l_class_kernels[3][3] = {
+    [0][1] = erd__llll_01,
+    [0][2] = erd__llll_02,
+    [1][0] = erd__llll_10,
+    [1][1] = erd__llll_11,
+    [1][2] = erd__llll_12,
+    [2][0] = erd__llll_20,
+    [2][1] = erd__llll_21,
+    [2][2] = erd__llll_22
+};
+
+
+/* Exponent sums, product centers, exponential prefactors and per part
+   pair coefficient products WAB (ldab,part pair) of the ij pairs */
+static void set_pair_parts(uint32_t nij,
+    const double xyza[restrict static 3], const double xyzb[restrict static 3],
+    const double alphaa[restrict static 1], const double alphab[restrict static 1],
+    const double cca[restrict static 1], const double ccb[restrict static 1],
+    const double norma[restrict static 1], const double normb[restrict static 1],
+    uint32_t offseta, uint32_t offsetb,
+    const uint32_t prima[restrict static 1], const uint32_t primb[restrict static 1],
+    const double rho[restrict static 1],
+    const struct PartPairs *restrict pairs, size_t ldw,
+    double p[restrict static 1], double px[restrict static 1], double py[restrict static 1], double pz[restrict static 1],
+    double scale[restrict static 1], double *restrict w)
+{
+    const double xab = xyza[0] - xyzb[0];
+    const double yab = xyza[1] - xyzb[1];
+    const double zab = xyza[2] - xyzb[2];
+    for (uint32_t ij = 0; ij < nij; ij++) {
+        const uint32_t i = prima[ij];
+        const uint32_t j = primb[ij];
+        const double pval = alphaa[i] + alphab[j];
+        const double aval = alphaa[i] / pval;
+        p[ij] = pval;
+        px[ij] = aval * xab + xyzb[0];
+        py[ij] = aval * yab + xyzb[1];
+        pz[ij] = aval * zab + xyzb[2];
+        scale[ij] = rho[ij];
+    }
+/*             ...each p-part also carries its SPNORM factor 2. */
+    for (uint32_t n = 0; n < pairs->count; n++) {
+        const uint32_t la = pairs->la[n], lb = pairs->lb[n];
+        const double *restrict ca = &cca[la * offseta], *restrict na = &norma[la * offseta];
+        const double *restrict cb = &ccb[lb * offsetb], *restrict nb = &normb[lb * offsetb];
+        const double spnorm = (double)(1 << (la + lb));
+        for (uint32_t ij = 0; ij < nij; ij++) {
+            const uint32_t i = prima[ij];
+            const uint32_t j = primb[ij];
+            w[n * ldw + ij] = spnorm * ca[i] * na[i] * cb[j] * nb[j];
+        }
+    }
+}
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__LLLL_PCGTO_BLOCK */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation evaluates the contracted batch of a */
+/*                quartet of s-, p- and L-shells (SP-shells of shared */
+/*                exponents) with at least one L-shell. All s- and */
+/*                p-parts of the L-shells are done together: the */
+/*                primitive pair data, the Fm (T) values and the */
+/*                Obara-Saika [e0|f0] of a primitive quartet are */
+/*                computed once and contracted into every part quartet */
+/*                with its own coefficients. The HRR on the small */
+/*                contracted batches then splits them into the parts, */
+/*                which are placed into the batch at the end. */
+/*                The batch is ordered as (first index varying */
+/*                fastest): */
+/*                    batch (n1,n2,n3,n4) */
+/*                with n = 1 for s-, 3 (x,y,z) for p- and 4 (s,x,y,z) */
+/*                for L-shells. */
+/*                  Input: */
+/*                    NIJ(KL)      =  # of ij (kl) primitive pairs */
+/*                    SHELL        =  the shell types of shells 1,2,3,4 */
+/*                                    with L-shells as p-shells */
+/*                    LSHELL       =  is 1 for the L-shells */
+/*                    NPGTO        =  # of primitives of shells 1,2,3,4 */
+/*                    Xx,Yx,Zx     =  the x,y,z-coordinates for centers */
+/*                                    x = 1,2,3,4 */
+/*                    ALPHAx       =  the primitive exponents */
+/*                    CCx          =  contraction coefficients, those */
+/*                                    of the s-part first for L-shells */
+/*                    PRIMx        =  i,j,k,l labels of the primitives */
+/*                    NORMx        =  the primitive norms, those of the */
+/*                                    s-part first for L-shells */
+/*                    RHO12(34)    =  exponential prefactors of the ij */
+/*                                    (kl) pairs */
+/*                    FACTOR       =  overall prefactor */
+/*                  Output: */
+/*                    CBATCH       =  updated contracted batch */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__llll_pcgto_block(uint32_t nij, uint32_t nkl,
+    const uint32_t shell[restrict static 4], const uint32_t lshell[restrict static 4], const uint32_t npgto[restrict static 4],
+    double x1, double y1, double z1,
+    double x2, double y2, double z2,
+    double x3, double y3, double z3,
+    double x4, double y4, double z4,
+    const double alpha1[restrict static 1], const double alpha2[restrict static 1], const double alpha3[restrict static 1], const double alpha4[restrict static 1],
+    const double cc1[restrict static 1], const double cc2[restrict static 1], const double cc3[restrict static 1], const double cc4[restrict static 1],
+    const uint32_t prim1[restrict static nij], const uint32_t prim2[restrict static nij], const uint32_t prim3[restrict static nkl], const uint32_t prim4[restrict static nkl],
+    const double norm1[restrict static 1], const double norm2[restrict static 1], const double norm3[restrict static 1], const double norm4[restrict static 1],
+    const double rho12[restrict static nij], const double rho34[restrict static nkl],
+    double factor,
+    double cbatch[restrict static 1])
+{
+    const double xyz[4][3] = { { x1, y1, z1 }, { x2, y2, z2 }, { x3, y3, z3 }, { x4, y4, z4 } };
+    const uint32_t shellp = shell[0] + shell[1];
+    const uint32_t shellq = shell[2] + shell[3];
+    const l_class_kernel_t kernel = l_class_kernels[shellp][shellq];
+    assert(kernel != NULL);
+
+/*             ...the part pairs, pair data and coefficient products */
+/*                of the 1,2 and 3,4 center pairs. The p-part of an */
+/*                L-shell has its coefficients and norms after the */
+/*                NPGTO ones of the s-part. */
+    struct PartPairs pairsab, pairscd;
+    set_part_pairs(shell[0], lshell[0], shell[1], lshell[1], &pairsab);
+    set_part_pairs(shell[2], lshell[2], shell[3], lshell[3], &pairscd);
+    const size_t ldab = PAD_LEN(nij);
+    const size_t ldcd = PAD_LEN(nkl);
+    ERD_SIMD_ALIGN double p[ldab], px[ldab], py[ldab], pz[ldab], scalep[ldab], wab[pairsab.count * ldab];
+    ERD_SIMD_ALIGN double q[ldcd], qx[ldcd], qy[ldcd], qz[ldcd], scaleq[ldcd], wcd[pairscd.count * ldcd];
+    set_pair_parts(nij, xyz[0], xyz[1], alpha1, alpha2, cc1, cc2, norm1, norm2,
+        lshell[0] ? npgto[0] : 0, lshell[1] ? npgto[1] : 0,
+        prim1, prim2, rho12, &pairsab, ldab, p, px, py, pz, scalep, wab);
+    set_pair_parts(nkl, xyz[2], xyz[3], alpha3, alpha4, cc3, cc4, norm3, norm4,
+        lshell[2] ? npgto[2] : 0, lshell[3] ? npgto[3] : 0,
+        prim3, prim4, rho34, &pairscd, ldcd, q, qx, qy, qz, scaleq, wcd);
+
+/*             ...the contracted [e0|f0] of all part quartets as */
+/*                e0f0 (e0 of the part pairs, f0 of the part pairs). */
+    double e0f0[MAX_PART_E0 * MAX_PART_E0];
+    kernel(nij, nkl, p, px, py, pz, scalep, q, qx, qy, qz, scaleq,
+        &pairsab, ldab, wab, &pairscd, ldcd, wcd, xyz[0], xyz[2], factor, e0f0);
+
+/*             ...HRR on each part quartet and final positioning: */
+/*                   (a,b+1i) = (a+1i,b) + AB_i (a,b) */
+/*                and likewise for (c,d). Within an L-shell the s-part */
+/*                comes first. */
+    uint32_t nfunc[4], stride[4];
+    uint32_t nbatch = 1;
+    for (uint32_t i = 0; i < 4; i++) {
+        nfunc[i] = lshell[i] ? 4 : 2 * shell[i] + 1;
+        stride[i] = nbatch;
+        nbatch *= nfunc[i];
+    }
+    const double ab[3] = { x1 - x2, y1 - y2, z1 - z2 };
+    const double cd[3] = { x3 - x4, y3 - y4, z3 - z4 };
+    for (uint32_t nab = 0; nab < pairsab.count; nab++) {
+        const uint32_t la = pairsab.la[nab], lb = pairsab.lb[nab];
+        const uint32_t nxyza = NXYZ(la), nxyzb = NXYZ(lb);
+        const uint32_t offseta = (lshell[0] && la == 1) ? stride[0] : 0;
+        const uint32_t offsetb = (lshell[1] && lb == 1) ? stride[1] : 0;
+        for (uint32_t ncd = 0; ncd < pairscd.count; ncd++) {
+            const uint32_t lc = pairscd.la[ncd], ld = pairscd.lb[ncd];
+            const uint32_t nxyzc = NXYZ(lc), nxyzd = NXYZ(ld);
+            const uint32_t offsetc = (lshell[2] && lc == 1) ? stride[2] : 0;
+            const uint32_t offsetd = (lshell[3] && ld == 1) ? stride[3] : 0;
+            const double *restrict x = &e0f0[pairsab.offset[nab] * pairscd.total + pairscd.offset[ncd]];
+            const uint32_t nf = pairscd.ne[ncd];
+
+            /* ...batch (e0,f0) --> batch (a,b,f0) */
+            double y[9][MAX_PART_E0];
+            for (uint32_t a = 0; a < nxyza; a++) {
+                for (uint32_t b = 0; b < nxyzb; b++) {
+                    const uint32_t e = (lb == 0) ? a : xyz_raise[NXYZ_BELOW(la) + a][b] - NXYZ_BELOW(la);
+                    const double t = (lb == 0) ? 0.0 : ab[b];
+                    for (uint32_t f = 0; f < nf; f++) {
+                        y[a * nxyzb + b][f] = x[e * pairscd.total + f] + t * x[a * pairscd.total + f];
+                    }
+                }
+            }
+
+            /* ...batch (a,b,f0) --> batch (a,b,c,d) --> batch (1,2,3,4) */
+            for (uint32_t c = 0; c < nxyzc; c++) {
+                for (uint32_t d = 0; d < nxyzd; d++) {
+                    const uint32_t f = (ld == 0) ? c : xyz_raise[NXYZ_BELOW(lc) + c][d] - NXYZ_BELOW(lc);
+                    const double t = (ld == 0) ? 0.0 : cd[d];
+                    const size_t cdpos = offsetc + c * stride[2] + offsetd + d * stride[3];
+                    for (uint32_t a = 0; a < nxyza; a++) {
+                        for (uint32_t b = 0; b < nxyzb; b++) {
+                            const double *restrict yab = y[a * nxyzb + b];
+                            cbatch[cdpos + offseta + a * stride[0] + offsetb + b * stride[1]] += yab[f] + t * yab[c];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(pop)
+#endif
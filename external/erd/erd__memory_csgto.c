@@ -43,6 +43,7 @@
 /*                    ZMIN,ZOPT    =  minimum/optimum flp memory */
 /* ------------------------------------------------------------------------ */
 ERD_OFFLOAD size_t erd__memory_csgto(uint32_t npgto1, uint32_t npgto2, uint32_t npgto3, uint32_t npgto4,
+    uint32_t ncgto1, uint32_t ncgto2, uint32_t ncgto3, uint32_t ncgto4,
     uint32_t shell1, uint32_t shell2, uint32_t shell3, uint32_t shell4,
     double x1, double y1, double z1,
     double x2, double y2, double z2,
@@ -84,5 +85,109 @@ ERD_OFFLOAD size_t erd__memory_csgto(uint32_t npgto1, uint32_t npgto2, uint32_t
         nxyzhrr = min32u(nhrr1st, nhrr2nd);
     }
 
-    return PAD_LEN(nxyzt) + 2 * nxyzhrr;
+    const size_t size = PAD_LEN(nxyzt) + 2 * nxyzhrr;
+    const size_t nbatch = (size_t)ncgto1 * ncgto2 * ncgto3 * ncgto4 * nry1 * nry2 * nry3 * nry4;
+    return (size < nbatch) ? nbatch : size;
+}
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__SCRATCH_CSGTO */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : ERD__SET_ABCD */
+/*                ERD__E0F0_SCRATCH_SIZE */
+/*  DESCRIPTION : This operation calculates the size in bytes of the */
+/*                scratch arena ERD__CSGTO takes for a batch of */
+/*                contracted electron repulsion integrals between */
+/*                cartesian or spherical gaussian type shells on four */
+/*                different centers, which bounds the size for any */
+/*                centers. The primitive pair data, the 2D integrals */
+/*                and VRR coefficients of the primitive batch and the */
+/*                HRR matrices are all taken from the arena in turn, */
+/*                so its size is that of the pair data plus the largest */
+/*                of the later stages. */
+/*                  Input (x = 1,2,3 and 4): */
+/*                    NPGTOx       =  # of primitives per contraction */
+/*                                    for csh x */
+/*                    NCGTOx       =  # of contractions for csh x */
+/*                    SHELLx       =  the shell type for csh x */
+/*                    SPHERIC      =  is true, if spherical integrals */
+/*                                    are wanted, false if cartesian */
+/*                                    ones are wanted */
+/*                The size holds for any primitive block size (see */
+/*                ERD__E0F0_DEF_BLOCKS), the space of the partial */
+/*                batches of the blocks included. For generally */
+/*                contracted shells the contracted batches of all */
+/*                contraction quadruplets stay in the arena from the */
+/*                primitive stage through the HRR stages. */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD size_t erd__scratch_csgto(uint32_t npgto1, uint32_t npgto2, uint32_t npgto3, uint32_t npgto4,
+    uint32_t ncgto1, uint32_t ncgto2, uint32_t ncgto3, uint32_t ncgto4,
+    uint32_t shell1, uint32_t shell2, uint32_t shell3, uint32_t shell4,
+    bool spheric)
+{
+    const uint32_t npgto[4] = { npgto1, npgto2, npgto3, npgto4 };
+    const uint32_t ncgto[4] = { ncgto1, ncgto2, ncgto3, ncgto4 };
+    const uint32_t shell[4] = { shell1, shell2, shell3, shell4 };
+    const double xyz0[16] = {
+        1.0, 1.0, 1.0, 0.0,
+        2.0, 2.0, 2.0, 0.0,
+        3.0, 3.0, 3.0, 0.0,
+        4.0, 4.0, 4.0, 0.0
+    };
+    uint32_t A = 0, B = 1, C = 2, D = 3;
+    uint32_t indexa, indexb, indexc, indexd;
+    uint32_t nxyza, nxyzb, nxyzc, nxyzd;
+    uint32_t nxyzet, nxyzft;
+    uint32_t nrya, nryb, nryc, nryd;
+    uint32_t nabcoor, ncdcoor;
+    uint32_t ncolhrr, nrothrr, nxyzhrr;
+    bool empty;
+    erd__set_abcd(
+        &A, &B, &C, &D,
+        shell, xyz0, spheric,
+        &indexa, &indexb, &indexc, &indexd,
+        &nxyza, &nxyzb, &nxyzc, &nxyzd,
+        &nxyzet, &nxyzft,
+        &nrya, &nryb, &nryc, &nryd,
+        &nabcoor, &ncdcoor,
+        &ncolhrr, &nrothrr, &nxyzhrr, &empty);
+
+    const uint32_t npgtoab = npgto[A] * npgto[B];
+    const uint32_t npgtocd = npgto[C] * npgto[D];
+    const uint32_t nrs = ncgto[A] * ncgto[B];
+    const uint32_t ntu = ncgto[C] * ncgto[D];
+    const uint32_t nctr = nrs * ntu;
+    const uint32_t nxyzt = nxyzet * nxyzft;
+    const size_t pairs = ERD_SCRATCH_SIZE(sizeof(double) * erd__pair_data_size(npgtoab, nrs))
+        + ERD_SCRATCH_SIZE(sizeof(double) * erd__pair_data_size(npgtocd, ntu));
+    const size_t prims = 2 * ERD_SCRATCH_SIZE(sizeof(uint32_t) * PAD_LEN(npgtoab))
+        + 2 * ERD_SCRATCH_SIZE(sizeof(uint32_t) * PAD_LEN(npgtocd))
+        + ERD_SCRATCH_SIZE(sizeof(double) * PAD_LEN(npgtoab))
+        + ERD_SCRATCH_SIZE(sizeof(double) * PAD_LEN(npgtocd));
+    size_t e0f0 = erd__e0f0_scratch_size(npgtoab, npgtocd,
+        shell[A] + shell[B], shell[C] + shell[D]);
+    if (nctr == 1) {
+        e0f0 += ERD_SCRATCH_SIZE(sizeof(double) * nxyzt);
+    } else {
+        e0f0 += ERD_SCRATCH_SIZE(sizeof(double) * (size_t)nxyzt * npgtoab * npgtocd)
+            + ERD_SCRATCH_SIZE(sizeof(double) * (size_t)npgtoab * ntu);
+    }
+    const size_t hrr = ERD_SCRATCH_SIZE(sizeof(double) * PAD_LEN(nrothrr * 2))
+        + ERD_SCRATCH_SIZE(sizeof(uint32_t) * PAD_LEN(nrothrr * 2))
+        + ERD_SCRATCH_SIZE(sizeof(uint32_t) * PAD_LEN(ncolhrr * 2));
+    const size_t lanes = ERD_SCRATCH_SIZE(sizeof(size_t) * nxyzet)
+        + ERD_SCRATCH_SIZE(sizeof(size_t) * nryc * nryd);
+    const size_t zone = (nctr == 1) ? 0 : ERD_SCRATCH_SIZE(sizeof(double) * nxyzhrr);
+    const size_t ctr = (nctr == 1) ? 0 : ERD_SCRATCH_SIZE(sizeof(double) * (size_t)nctr * nxyzt);
+
+    size_t size = e0f0;
+    if (size < 2 * hrr + lanes + zone) {
+        size = 2 * hrr + lanes + zone;
+    }
+    size += ctr;
+    if (size < prims) {
+        size = prims;
+    }
+    return pairs + size;
 }
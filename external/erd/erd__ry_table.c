@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "erd.h"
+#include "erdutil.h"
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__RY_TABLE_SIZE */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation returns the # of int and flp words of */
+/*                the tables set up by ERD__RY_TABLE for all shells up */
+/*                to MAXSHELL. */
+/*                  Input: */
+/*                    MAXSHELL     =  largest shell type */
+/*                  Output: */
+/*                    NINDEX       =  # of int words */
+/*                    NVALUE       =  # of flp words */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__ry_table_size(uint32_t maxshell, size_t nindex[restrict static 1], size_t nvalue[restrict static 1]) {
+    size_t ni = PAD_LEN(2 * (maxshell + 1));
+    size_t nv = 0;
+    for (uint32_t l = 0; l <= maxshell; l++) {
+        const uint32_t nry = 2 * l + 1;
+        const uint32_t nrot = ERD_RY_NROWMX(l) * nry;
+        ni += PAD_LEN(nry) + PAD_LEN(nrot);
+        nv += PAD_LEN(nrot) + PAD_LEN((l + 1) * (l + 2) / 2);
+    }
+    *nindex = ni;
+    *nvalue = nv;
+}
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__RY_TABLE */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : ERD__XYZ_TO_RY_MATRIX */
+/*                ERD__CARTESIAN_NORMS */
+/*  DESCRIPTION : This operation sets up once the cartesian -> spherical */
+/*                transformation matrices and the cartesian monomial */
+/*                normalization factors of all shells up to MAXSHELL, */
+/*                which ERD__CSGTO would otherwise regenerate for every */
+/*                batch. The data of shell L starts at the int offset */
+/*                INDEX (2*L) and the flp offset INDEX (2*L+1): */
+/*                    INDEX:  LROW (R), padded to SIMD length, followed */
+/*                            by ROW (I,R) with I = 1,...,NROWMX */
+/*                    VALUE:  ROT (I,R) with I = 1,...,NROWMX, padded to */
+/*                            SIMD length, followed by the cartesian */
+/*                            norm of each xyz-monomial */
+/*                with LROW, ROW and ROT as used by */
+/*                ERD__HRR_RY_TRANSFORM. The row labels are 0-based */
+/*                and the unused row slots are zero, every block starts */
+/*                SIMD aligned. s- and p-shells have no matrix. */
+/*                  Input: */
+/*                    MAXSHELL     =  largest shell type */
+/*                  Output: */
+/*                    INDEX        =  int table (see ERD__RY_TABLE_SIZE) */
+/*                    VALUE        =  flp table (see ERD__RY_TABLE_SIZE) */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__ry_table(uint32_t maxshell, uint32_t index[restrict], double value[restrict]) {
+    size_t nindex, nvalue;
+    erd__ry_table_size(maxshell, &nindex, &nvalue);
+    memset(index, 0, nindex * sizeof(uint32_t));
+    memset(value, 0, nvalue * sizeof(double));
+
+    double partial[maxshell + 2];
+    erd__cartesian_norms(maxshell + 1, partial);
+
+    uint32_t ioff = PAD_LEN(2 * (maxshell + 1));
+    uint32_t zoff = 0;
+    for (uint32_t l = 0; l <= maxshell; l++) {
+        const uint32_t nxyz = (l + 1) * (l + 2) / 2;
+        const uint32_t nry = 2 * l + 1;
+        const uint32_t nrowmx = ERD_RY_NROWMX(l);
+        const uint32_t nrot = nrowmx * nry;
+        index[2 * l] = ioff;
+        index[2 * l + 1] = zoff;
+
+        uint32_t *lrow = &index[ioff];
+        uint32_t *row = &index[ioff + PAD_LEN(nry)];
+        double *rot = &value[zoff];
+        if (l > 1) {
+            erd__xyz_to_ry_matrix(nxyz, nrowmx, l, lrow, row, rot);
+            for (uint32_t r = 0; r < nry; r++) {
+                for (uint32_t i = 0; i < lrow[r]; i++) {
+                    row[r * nrowmx + i] -= 1;
+                }
+            }
+        }
+
+        /* ...cartesian norms in the x^p y^q z^r monomial order */
+        double *norm = &value[zoff + PAD_LEN(nrot)];
+        uint32_t xyz = 0;
+        for (int32_t x = l; x >= 0; x--) {
+            const int32_t ybeg = l - x;
+            for (int32_t y = ybeg; y >= 0; y--) {
+                norm[xyz++] = partial[x] * partial[y] * partial[ybeg - y];
+            }
+        }
+
+        ioff += PAD_LEN(nry) + PAD_LEN(nrot);
+        zoff += PAD_LEN(nrot) + PAD_LEN(nxyz);
+    }
+}
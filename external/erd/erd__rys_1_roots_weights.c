@@ -3,12 +3,20 @@
 #include <assert.h>
 
 #include "erd.h"
+#include "rys_simd.h"
 
 #ifdef __INTEL_OFFLOAD
 #pragma offload_attribute(push, target(mic))
 #endif
 
 
+/* T-range of T >= 3e-7 by (int) MIN (T + 1, 34) - 1 */
+static const int jump1[34] = {
+    1, 2, 2, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 7
+};
+
+
 /* ------------------------------------------------------------------------ */
 /*  OPERATION   : ERD__RYS_1_ROOTS_WEIGHTS */
 /*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
@@ -36,12 +44,9 @@
 /*                    RTS          =  all NT quadrature roots */
 /*                    WTS          =  all NT quadrature weights */
 /* ------------------------------------------------------------------------ */
-void erd__rys_1_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]) {
-    int jump1[34] =
-        { 1, 2, 2, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6,
-        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7
-    };
-
+/* The scalar loop over T: the reference for the SIMD version below and
+   the fallback for other targets */
+void erd__rys_1_roots_weights_scalar(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]) {
     double e;
     int n;
     double t, x, f1, r1, w1;
@@ -177,6 +182,154 @@ void erd__rys_1_roots_weights(int nt, const double tval[restrict], double rts[re
     }
 }
 
+
+#if defined (RYS_SIMD)
+/*             ...T-range: T essentially 0 */
+static ERD_FORCE_INLINE void rys1_range0 (rys_vd t, rys_vd r[1], rys_vd w[1])
+{
+    rys_vd r1;
+    r1 = .5 - t * .2;
+    w[0] = 1. - t * .333333333333333;
+    r[0] = r1 / (r1 + 1.);
+}
+
+
+/*             ...T-range: 0 < T < 1 */
+static ERD_FORCE_INLINE void rys1_range1 (rys_vd t, rys_vd r[1], rys_vd w[1])
+{
+    rys_vd f1, r1, w1;
+    f1 = ((((((((t * -8.36313918003957e-8 + 1.21222603512827e-6) * t -
+                1.15662609053481e-5) * t + 9.25197374512647e-5) * t -
+              6.40994113129432e-4) * t + .00378787044215009) * t -
+            .0185185172458485) * t + .0714285713298222) * t -
+          .199999999997023) * t + .333333333333318;
+    w1 = (t + t) * f1 + rys_exp (-t);
+    r1 = f1 / (w1 - f1);
+    w[0] = w1;
+    r[0] = r1 / (r1 + 1.);
+}
+
+
+/*             ...T-range: 1 =< T < 3 */
+static ERD_FORCE_INLINE void rys1_range2 (rys_vd t, rys_vd r[1], rys_vd w[1])
+{
+    rys_vd x, f1, r1, w1;
+    x = t - 2.;
+    f1 = ((((((((((x * -1.61702782425558e-10 + 1.96215250865776e-9) * x -
+                  2.14234468198419e-8) * x + 2.17216556336318e-7) * x -
+                1.98850171329371e-6) * x + 1.62429321438911e-5) * x -
+              1.16740298039895e-4) * x + 7.24888732052332e-4) * x -
+            .00379490003707156) * x + .0161723488664661) * x -
+          .0529428148329736) * x + .115702180856167;
+    w1 = (t + t) * f1 + rys_exp (-t);
+    r1 = f1 / (w1 - f1);
+    w[0] = w1;
+    r[0] = r1 / (r1 + 1.);
+}
+
+
+/*             ...T-range: 3 =< T < 5 */
+static ERD_FORCE_INLINE void rys1_range3 (rys_vd t, rys_vd r[1], rys_vd w[1])
+{
+    rys_vd x, f1, r1, w1;
+    x = t - 4.;
+    f1 = ((((((((((x * -2.62453564772299e-11 + 3.24031041623823e-10) * x
+                  - 3.614965656163e-9) * x + 3.760256799971e-8) * x -
+                3.553558319675e-7) * x + 3.022556449731e-6) * x -
+              2.290098979647e-5) * x + 1.526537461148e-4) * x -
+            8.81947375894379e-4) * x + .00433207949514611) * x -
+          .0175257821619926) * x + .0528406320615584;
+    w1 = (t + t) * f1 + rys_exp (-t);
+    r1 = f1 / (w1 - f1);
+    w[0] = w1;
+    r[0] = r1 / (r1 + 1.);
+}
+
+
+/*             ...T-range: 5 =< T < 10 */
+static ERD_FORCE_INLINE void rys1_range4 (rys_vd t, rys_vd r[1], rys_vd w[1])
+{
+    rys_vd x, f1, r1, w1, e;
+    e = rys_exp (-t);
+    x = 1. / t;
+    w1 = ((((((x * .46897511375022 - .69955602298985) * x +
+              .53689283271887) * x - .32883030418398) * x +
+            .24645596956002) * x - .49984072848436) * x -
+          3.1501078774085e-6) * e + rys_sqrt (x * .785398163397448);
+    f1 = (w1 - e) / (t + t);
+    r1 = f1 / (w1 - f1);
+    w[0] = w1;
+    r[0] = r1 / (r1 + 1.);
+}
+
+
+/*             ...T-range: 10 =< T < 15 */
+static ERD_FORCE_INLINE void rys1_range5 (rys_vd t, rys_vd r[1], rys_vd w[1])
+{
+    rys_vd x, f1, r1, w1, e;
+    e = rys_exp (-t);
+    x = 1. / t;
+    w1 = (((x * -.18784686463512 + .22991849164985) * x - .49893752514047)
+          * x - 2.1916512131607e-5) * e + rys_sqrt (x * .785398163397448);
+    f1 = (w1 - e) / (t + t);
+    r1 = f1 / (w1 - f1);
+    w[0] = w1;
+    r[0] = r1 / (r1 + 1.);
+}
+
+
+/*             ...T-range: 15 =< T < 33 */
+static ERD_FORCE_INLINE void rys1_range6 (rys_vd t, rys_vd r[1], rys_vd w[1])
+{
+    rys_vd x, f1, r1, w1, e;
+    e = rys_exp (-t);
+    x = 1. / t;
+    w1 = ((x * .1962326414943 - .4969524146449) * x - 6.0156581186481e-5)
+        * e + rys_sqrt (x * .785398163397448);
+    f1 = (w1 - e) / (t + t);
+    r1 = f1 / (w1 - f1);
+    w[0] = w1;
+    r[0] = r1 / (r1 + 1.);
+}
+
+
+/*             ...T-range: T >= 33 */
+static ERD_FORCE_INLINE void rys1_range7 (rys_vd t, rys_vd r[1], rys_vd w[1])
+{
+    w[0] = rys_sqrt (.785398163397448 / t);
+    r[0] = .5 / t;
+}
+
+
+/* Index of the T-range of T in rys1_kernels */
+static ERD_FORCE_INLINE int rys1_range (double t)
+{
+    if (t <= 3e-7) {
+        return 0;
+    }
+    return jump1[(int) MIN ((t + 1.0), 34.) - 1];
+}
+
+static const rys_range_kernel_t rys1_kernels[8] = {
+    rys1_range0, rys1_range1, rys1_range2, rys1_range3, rys1_range4,
+    rys1_range5, rys1_range6, rys1_range7
+};
+#endif
+
+
+/* Bins the T's by T-range and evaluates each bin RYS_SIMDW T's at a time
+   with the formulas of the scalar loop */
+void erd__rys_1_roots_weights(int nt, const double tval[restrict], double rts[restrict], double wts[restrict],
+                              void *restrict scratch)
+{
+#if defined (RYS_SIMD)
+    rys_simd_roots_weights(1, 8, rys1_range, rys1_kernels, nt, tval, rts, wts, scratch);
+#else
+    (void)scratch;
+    erd__rys_1_roots_weights_scalar(nt, tval, rts, wts);
+#endif
+}
+
 #ifdef __INTEL_OFFLOAD
 #pragma offload_attribute(pop)
 #endif
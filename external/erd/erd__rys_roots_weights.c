@@ -17,6 +17,7 @@
 /*                ERD__RYS_3_ROOTS_WEIGHTS */
 /*                ERD__RYS_4_ROOTS_WEIGHTS */
 /*                ERD__RYS_5_ROOTS_WEIGHTS */
+/*                ERD__RYS_TABLE_ROOTS_WEIGHTS */
 /*                ERD__RYS_X_ROOTS_WEIGHTS */
 /*  DESCRIPTION : This routine calculates NGQP-point Gaussian quadrature */
 /*                rules on [0,1] over the Rys weight functions: */
@@ -25,8 +26,10 @@
 /*                              Rys      2*sqrt(x) */
 /*                for a set of NT T-exponents. Special interpolation */
 /*                routines are provided for low number of roots and */
-/*                weigths (NGQP < 6). On exit, NT x NGQP = NTGQP roots */
-/*                and weights have been produced. */
+/*                weigths (NGQP < 6), tabulated fits for 6 <= NGQP <= 10 */
+/*                and the general moment based routine for higher ones. */
+/*                On exit, NT x NGQP = NTGQP roots and weights have been */
+/*                produced. */
 /*                  Input: */
 /*                    NT           =  # of T-exponents */
 /*                    NTGQP        =  # of roots times # of T-exponents */
@@ -35,8 +38,11 @@
 /*                    NMOM         =  # of necessary moment integrals */
 /*                                    to calculate the quadrature roots */
 /*                    TVAL         =  the T-exponents */
-/*                    RYSZERO      =  will hold the zeroth Rys moments */
-/*                                    for all T-exponents */
+/*                    SCRATCH      =  scratch arena of at least */
+/*                                    ERD__RYS_SCRATCH_SIZE bytes, which */
+/*                                    holds the binned T-exponents of */
+/*                                    the NGQP < 6 routines or the zeroth */
+/*                                    Rys moments RYSZERO */
 /*                    FTABLE       =  Fm (T) table for interpolation */
 /*                                    in low T region */
 /*                    MGRID        =  maximum m in Fm (T) table */
@@ -67,30 +73,39 @@
 /* ------------------------------------------------------------------------ */
 ERD_OFFLOAD void erd__rys_roots_weights(uint32_t nt, uint32_t ngqp, uint32_t nmom,
                             const double tval[restrict],
-                            double rts[restrict], double wts[restrict])
+                            double rts[restrict], double wts[restrict],
+                            void *restrict scratch)
 {
     switch (ngqp) {
 #if 1
         case 1:
-            erd__rys_1_roots_weights(nt, tval, rts, wts);
+            erd__rys_1_roots_weights(nt, tval, rts, wts, scratch);
             return;
         case 2:
-            erd__rys_2_roots_weights(nt, tval, rts, wts);
+            erd__rys_2_roots_weights(nt, tval, rts, wts, scratch);
             return;
         case 3:
-            erd__rys_3_roots_weights(nt, tval, rts, wts);
+            erd__rys_3_roots_weights(nt, tval, rts, wts, scratch);
             return;
         case 4:
-            erd__rys_4_roots_weights(nt, tval, rts, wts);
+            erd__rys_4_roots_weights(nt, tval, rts, wts, scratch);
             return;
         case 5:
-            erd__rys_5_roots_weights(nt, tval, rts, wts);
+            erd__rys_5_roots_weights(nt, tval, rts, wts, scratch);
+            return;
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+        case 10:
+            erd__rys_table_roots_weights(nt, ngqp, tval, rts, wts);
             return;
 #endif
         default:
         {
-            ERD_SIMD_ALIGN double ryszero[nt];
-            /* ...# of roots and weights >= 6. Accumulate all zeroth Rys moments and call the general routine. */
+            char *arena = scratch;
+            double *restrict ryszero = erd__scratch_alloc(&arena, sizeof(double) * nt);
+            /* ...# of roots and weights > 10. Accumulate all zeroth Rys moments and call the general routine. */
             for (int n = 0; n < nt; n++) {
                 const double t = tval[n];
                 if (t == 0.0) {
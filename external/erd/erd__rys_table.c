@@ -0,0 +1,3252 @@
+#include "rys.h"
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(push, target(mic))
+#endif
+
+/* NGQP = 6: roots (6) and weights (6) on [0,68), one polynomial of degree 14 per interval */
+static const double rys_table_6[17][RYS_TABLE_NCOEF][12] = {
+	{
+		{ 0x1.B982A3A38620Fp-7, 0x1.E3DB61AC99CA5p-4, 0x1.3DA8DEE4BE413p-2, 0x1.1B5920A47B971p-1, 0x1.9556036DB9502p-1, 0x1.EA0DFF2B90802p-1,
+		  0x1.CD54578DD0DCBp-3, 0x1.6757D07F862C1p-3, 0x1.BDA563215970Ep-4, 0x1.C9E99C05FCEE2p-5, 0x1.9306DE4D8C995p-6, 0x1.0A59D2E1078A1p-7 },
+		{ -0x1.02A9D719AA47Bp-9, -0x1.0166640840F59p-6, -0x1.103E98470C435p-5, -0x1.46C87B2F91CFBp-5, -0x1.C595A94136ABFp-6, -0x1.D0332ABB86ACBp-8,
+		  -0x1.5CDC566795AA6p-6, -0x1.6FCEA6D720F4Ep-5, -0x1.F724BA9644DE7p-5, -0x1.C0D8EB71ECAA9p-5, -0x1.1D9697D716A16p-5, -0x1.CF643B31A917Fp-7 },
+		{ 0x1.C0AC4D9BE8ACFp-13, 0x1.684B26819FC55p-10, 0x1.96E4C91225BE1p-10, -0x1.9A116DC8A35EAp-12, -0x1.02669317FE764p-9, -0x1.B5BED7EE7CCF5p-11,
+		  0x1.2E54D8B58D4ECp-9, 0x1.5A06184955621p-7, 0x1.823AE2C00329Cp-6, 0x1.FA5D9A99B1B90p-6, 0x1.AB29E4D5AD894p-6, 0x1.9888F76E90110p-7 },
+		{ -0x1.54326483CF738p-16, -0x1.6037B9BF6C20Ap-14, 0x1.7B08E45001C0Cp-15, 0x1.61F4F6FAFED00p-13, -0x1.1FDB5054B550Ep-15, -0x1.54D1013137DDAp-14,
+		  -0x1.0DF047ABE09A6p-12, -0x1.15DA342C3239Ap-9, -0x1.D02B85F6ED8B2p-8, -0x1.A128B8003C245p-7, -0x1.BB4715EB10B4Dp-7, -0x1.E57B638E57476p-8 },
+		{ 0x1.D88F351B16A1Ep-20, 0x1.36004852A301Ap-19, -0x1.8999B86550804p-17, 0x1.036A9372FE0EFp-18, 0x1.47CC9FF56BFCDp-17, -0x1.BBEBC0544D59Ap-18,
+		  0x1.DB2A2E9EA9A35p-16, 0x1.8ED7145D83067p-12, 0x1.D6BBBDD3CCBD6p-10, 0x1.140EB3E5130E5p-8, 0x1.63F95768F4351p-8, 0x1.B49FAFF7A0004p-9 },
+		{ -0x1.3211028A24000p-23, 0x1.E69EC2A10B444p-23, 0x1.CCD351F0C2AABp-22, -0x1.593FA50A55D55p-20, 0x1.2BC64803BF222p-20, -0x1.C34FBA7468889p-22,
+		  -0x1.97D4331B630CDp-19, -0x1.065CD3C2C974Fp-14, -0x1.A29730098515Cp-12, -0x1.349E37E39431Cp-10, -0x1.D523FBFC22AD4p-10, -0x1.3C8FA126728D2p-10 },
+		{ 0x1.72315FEC64000p-27, -0x1.6440CDA9D6666p-25, 0x1.10C5E4838BBBCp-24, -0x1.7D24CA9BEDDDEp-25, 0x1.07593AE10CCCDp-26, -0x1.E8C999E72AAABp-27,
+		  0x1.54A9C11940111p-22, 0x1.4122A4CAEEB22p-17, 0x1.4E2B23D2F2BB6p-14, 0x1.2C963E78A9C00p-12, 0x1.0716A346F96F7p-11, 0x1.810B4AA0F1F0Ep-12 },
+		{ -0x1.9FBE5637BBBBCp-31, 0x1.D0455A4FBBBBCp-29, -0x1.1448FB299999Ap-27, 0x1.955BCA35DDDDEp-27, -0x1.3BBA8CD0CCCCDp-27, 0x1.38E848E666666p-30,
+		  -0x1.15A46F34AEEEFp-25, -0x1.7160AFBFBD333p-20, -0x1.E6A64871A8089p-17, -0x1.046FD3AC1C64Dp-14, -0x1.016D7E90AC38Cp-13, -0x1.93BB747CAFDEFp-14 },
+		{ 0x1.A5E5648777777p-35, -0x1.DB71288888889p-34, -0x1.6319A44444444p-37, 0x1.25C2CB0555555p-31, -0x1.1B6CA65CCCCCDp-30, 0x1.45C80B1DDDDDEp-32,
+		  0x1.BA13B9D355555p-29, 0x1.92224D102AAABp-23, 0x1.46E34687843BCp-19, 0x1.9786265B30ACDp-17, 0x1.BF7B03208C75Ep-16, 0x1.74449EC8B170Dp-16 },
+		{ -0x1.7703F21111111p-39, -0x1.D3D02B3333333p-37, 0x1.4914AA1111111p-34, -0x1.0DB9F25555555p-33, -0x1.EFA42CCCCCCCDp-38, 0x1.23AB877777777p-35,
+		  -0x1.59AB7A6CCCCCDp-32, -0x1.A0998ACFB3333p-26, -0x1.988E384040889p-22, -0x1.232F29908B222p-19, -0x1.5E372310D22ABp-18, -0x1.327BB5B1C1889p-18 },
+		{ 0x1.2F76F77777777p-45, 0x1.0F8C0AAAAAAABp-39, -0x1.E371FDDDDDDDEp-38, -0x1.45912B3333333p-37, 0x1.04A67AAAAAAABp-37, -0x1.8A78BBBBBBBBCp-41,
+		  0x1.FD6926CCCCCCDp-36, 0x1.9C37F6B444444p-29, 0x1.DE2357777BBBCp-25, 0x1.7F57228009111p-22, 0x1.F2E088FF34222p-21, 0x1.C7EFBB0EA8111p-21 },
+		{ 0x1.4035000000000p-45, 0x1.6D36666666666p-44, 0x1.B1BAEEEEEEEEFp-42, 0x1.68E1000000000p-39, 0x1.9035EEEEEEEEFp-39, 0x1.3942AAAAAAAABp-39,
+		  -0x1.3F446AAAAAAABp-39, -0x1.865F3A6EEEEEFp-32, -0x1.07064412EEEEFp-27, -0x1.D36F25B5EEEEFp-25, -0x1.4584BE9FF7777p-23, -0x1.34B255BF6EEEFp-23 },
+		{ 0x1.AE97BBBBBBBBCp-45, 0x1.DF08444444444p-42, 0x1.42A2444444444p-40, 0x1.0E98555555555p-39, 0x1.60C2888888889p-39, 0x1.A0D9777777777p-39,
+		  0x1.2096DDDDDDDDEp-40, 0x1.6AD5E66666666p-35, 0x1.1223F83777777p-30, 0x1.0A7F99699999Ap-27, 0x1.89BBD26466666p-26, 0x1.817B36CF00000p-26 },
+		{ -0x1.334DDDDDDDDDEp-47, -0x1.49B5555555555p-44, -0x1.AF6CCCCCCCCCDp-43, -0x1.7CDDDDDDDDDDEp-42, -0x1.036BBBBBBBBBCp-41, -0x1.2A8CCCCCCCCCDp-41,
+		  -0x1.6B12222222222p-43, -0x1.4F475DDDDDDDEp-38, -0x1.1CD4FE2222222p-33, -0x1.2D9EDC2AAAAABp-30, -0x1.D72077CCCCCCDp-29, -0x1.DB441E799999Ap-29 },
+		{ -0x1.0ABAAAAAAAAABp-46, -0x1.1F93333333333p-43, -0x1.6D20000000000p-42, -0x1.3AF199999999Ap-41, -0x1.B127777777777p-41, -0x1.FDE1111111111p-41,
+		  -0x1.04C0888888889p-42, 0x1.2F8CCCCCCCCCDp-42, 0x1.06DE600000000p-36, 0x1.2D61048888889p-33, 0x1.EB9DA61111111p-32, 0x1.FB46B7199999Ap-32 }
+	},
+	{
+		{ 0x1.4FB2C96CC761Cp-7, 0x1.771870090E1D9p-4, 0x1.0026C25615CFEp-2, 0x1.E4CD1E2E5A98Dp-2, 0x1.74E82FF49563Fp-1, 0x1.E0B2865341CA6p-1,
+		  0x1.858E3F5E70852p-3, 0x1.D9197203529BCp-4, 0x1.62744FC5F37A8p-5, 0x1.57DFB8F33A69Ep-7, 0x1.E5E3BA4B94CB0p-10, 0x1.220142DB244E9p-12 },
+		{ -0x1.5888A90AA8FFBp-10, -0x1.6CDF8E22D5869p-7, -0x1.B75395B3C8B04p-6, -0x1.42DC2B8658413p-5, -0x1.237DA6BAB5EF7p-5, -0x1.7D95E94D80B8Dp-7,
+		  -0x1.D94649BFCE958p-7, -0x1.407B5B92F4842p-6, -0x1.05685F998CA82p-6, -0x1.DE9633663DEFCp-8, -0x1.18CCDBE73EA25p-9, -0x1.D8E71020DAD7Ap-12 },
+		{ 0x1.06BBA72D5FC6Dp-13, 0x1.EAD7673E466FAp-11, 0x1.9FCF95748E861p-10, 0x1.3F5BA466EE622p-11, -0x1.E6FF87C90C904p-10, -0x1.8D9D20CFD4260p-10,
+		  0x1.49B0D1D83D9BCp-10, 0x1.D64BE8500C5C0p-9, 0x1.34299651D6951p-8, 0x1.A9E3DECA36C3Fp-9, 0x1.68A5F13BC8A55p-10, 0x1.8BF62134DEF0Ap-12 },
+		{ -0x1.61089780338A9p-17, -0x1.0193F15DBF340p-14, -0x1.AC6532BA0A52Dp-16, 0x1.366E7B4ED0616p-13, 0x1.60EB6C3D9DA2Fp-14, -0x1.3E76352CF5FBCp-13,
+		  -0x1.E3958FEBFF55Ep-14, -0x1.2F4DF40D0DAA4p-11, -0x1.26C6FF879E4EEp-10, -0x1.20C8CE43142CBp-10, -0x1.4B0EBDB3571C2p-11, -0x1.C30358EB9D476p-13 },
+		{ 0x1.B52E8C8C96217p-21, 0x1.833E3387571D5p-19, -0x1.7C2F6A5CD76E6p-18, -0x1.15BE7590EA580p-17, 0x1.32DB2A0E5E56Fp-16, -0x1.6B71C75F9FEEFp-17,
+		  0x1.62A753A7BE0DEp-17, 0x1.6432B2BEBAA13p-14, 0x1.EA2DC6DEA9F33p-13, 0x1.443FA21D6E8DFp-12, 0x1.E05627AA01011p-13, 0x1.8774F13FB0B1Cp-14 },
+		{ -0x1.00C1D9DBC2D9Ap-24, -0x1.95CA9E0C98CCDp-25, 0x1.4AF4B07CF24CDp-21, -0x1.C5FAA5F7CEDDEp-21, 0x1.6A54951560889p-23, -0x1.1A0008CA94000p-22,
+		  -0x1.01793932B6AABp-20, -0x1.853C0F47A172Bp-17, -0x1.6D404AB3376BDp-15, -0x1.3A7D2C6EA6A50p-14, -0x1.2280352FCB01Ep-14, -0x1.1359418BFE8CEp-15 },
+		{ 0x1.1B2BAFF51599Ap-28, -0x1.3D618B0F9EEEFp-27, -0x1.4393235EDBBBCp-26, 0x1.A1E805D556666p-24, -0x1.8B9EEB1E75DDEp-23, 0x1.2FDE607BE999Ap-24,
+		  0x1.6C013FBACD555p-24, 0x1.90ECE9398CA44p-20, 0x1.F156A8C0C4651p-18, 0x1.0E81C4120A26Ap-16, 0x1.2EC7F62BAA85Cp-16, 0x1.4648BB4DAEF4Fp-17 },
+		{ -0x1.2DA0528EEEEEFp-32, 0x1.622C1940AAAABp-30, -0x1.75D77EBB33333p-29, 0x1.03E10BF955555p-28, -0x1.A956B7F444444p-27, 0x1.EE9E5E3AAAAABp-27,
+		  -0x1.FD1D73D844444p-28, -0x1.8844D36D7999Ap-23, -0x1.395F369CD0666p-20, -0x1.A40D7A1DC4100p-19, -0x1.16196136690E9p-18, -0x1.4E6D178BEA4BBp-19 },
+		{ 0x1.375FB94111111p-36, -0x1.B1CB27B111111p-34, 0x1.B94B808EEEEEFp-32, -0x1.27E0845666666p-30, 0x1.9FA567ADDDDDEp-30, 0x1.A5D216C555555p-30,
+		  0x1.5DD0509DDDDDEp-31, 0x1.6ED8B79B71111p-26, 0x1.70ED9A3357555p-23, 0x1.2A25579EE0555p-21, 0x1.C989F81375FABp-21, 0x1.2E42B7BE062DEp-21 },
+		{ -0x1.F85081999999Ap-41, 0x1.ABCFF08888889p-38, -0x1.BE9F69DDDDDDEp-37, 0x1.CC175AAAAAAABp-37, 0x1.117A271111111p-32, 0x1.549B391111111p-34,
+		  -0x1.CD2C671111111p-35, -0x1.49766EEECCCCDp-29, -0x1.989B81A0E2222p-26, -0x1.869EAADE85DDEp-24, -0x1.55445FD174777p-23, -0x1.E8F60B1BE3D11p-24 },
+		{ 0x1.401F19999999Ap-46, -0x1.53467BBBBBBBCp-42, -0x1.3E67600000000p-39, 0x1.70F3C11111111p-37, -0x1.87F74AAAAAAABp-38, -0x1.323CA77777777p-37,
+		  0x1.04EAC44444444p-38, 0x1.1C0B26ADDDDDEp-32, 0x1.ABEC1EB344444p-29, 0x1.DBCE24EA5999Ap-27, 0x1.D20223D126222p-26, 0x1.6601A5AE74889p-26 },
+		{ 0x1.8221555555555p-46, 0x1.90A7777777777p-43, 0x1.DB18111111111p-41, 0x1.2701DDDDDDDDEp-41, -0x1.C693333333333p-40, 0x1.6BD1111111111p-42,
+		  0x1.6881111111111p-44, -0x1.D5EFE8CCCCCCDp-36, -0x1.A933BC2EEEEEFp-32, -0x1.0EA7A95777777p-29, -0x1.24FFA8C300000p-28, -0x1.DE0593B357777p-29 },
+		{ 0x1.3FDFBBBBBBBBCp-45, 0x1.69A399999999Ap-42, 0x1.D3CE666666666p-41, 0x1.9612AAAAAAAABp-40, 0x1.3213DDDDDDDDEp-39, 0x1.7D49BBBBBBBBCp-39,
+		  0x1.7215DDDDDDDDEp-41, 0x1.BC746AAAAAAABp-39, 0x1.951C682222222p-35, 0x1.21EDF7EEEEEEFp-32, 0x1.56DB43A4CCCCDp-31, 0x1.26ABA68866666p-31 },
+		{ -0x1.D0B3333333333p-48, -0x1.01E2222222222p-44, -0x1.5A96666666666p-43, -0x1.3362222222222p-42, -0x1.B65999999999Ap-42, -0x1.2C7999999999Ap-41,
+		  -0x1.047999999999Ap-43, -0x1.8DBF333333333p-42, -0x1.8013DDDDDDDDEp-38, -0x1.34891E6666666p-35, -0x1.8D256EAAAAAABp-34, -0x1.66A7AD899999Ap-34 },
+		{ -0x1.8972222222222p-47, -0x1.B830000000000p-44, -0x1.2627777777777p-42, -0x1.0E3EEEEEEEEEFp-41, -0x1.90FEEEEEEEEEFp-41, -0x1.F605555555555p-41,
+		  -0x1.B1FBBBBBBBBBCp-43, -0x1.D55EEEEEEEEEFp-44, 0x1.2770555555555p-41, 0x1.240EACCCCCCCDp-38, 0x1.93CE63999999Ap-37, 0x1.7AE2462222222p-37 }
+	},
+	{
+		{ 0x1.07997BC5A8DCCp-7, 0x1.2962797DE0BC8p-4, 0x1.9EE610A8F9361p-3, 0x1.97A31A775DAEBp-2, 0x1.4D2817A372D5Ep-1, 0x1.D0F4748A7E85Dp-1,
+		  0x1.531A64F26CF8Cp-3, 0x1.650C547041EAEp-4, 0x1.87325B5422D23p-6, 0x1.B84CB488D1F11p-9, 0x1.07533C1E52C66p-12, 0x1.A840B6B0628A4p-17 },
+		{ -0x1.E103D2F68F288p-11, -0x1.07738D24B30C8p-7, -0x1.56A116393042Fp-6, -0x1.22EA047170035p-5, -0x1.5381CE6A2E4F0p-5, -0x1.45B80DFB22CFAp-6,
+		  -0x1.58C112461C6A7p-7, -0x1.4C3814E49D626p-7, -0x1.6FAF2D0892B63p-8, -0x1.8EE1FD28830A4p-10, -0x1.B94CEE2D200E6p-13, -0x1.308C7AF717398p-16 },
+		{ 0x1.4618C926F53ACp-14, 0x1.4B31DEBC59D9Dp-11, 0x1.5F7124AB8A9F3p-10, 0x1.4905DD94E101Cp-10, -0x1.F1ABE0CF4E88Bp-11, -0x1.5F2BC359086D3p-9,
+		  0x1.8E01C42124147p-11, 0x1.87402E3BE7254p-10, 0x1.55282858ADD40p-10, 0x1.1223A9F540750p-11, 0x1.C7FD3EF28C075p-14, 0x1.D0808D5980206p-17 },
+		{ -0x1.898E1B6F6B2EEp-18, -0x1.58EE35889915Ap-15, -0x1.A4315908317E1p-15, 0x1.0C505CEA5A572p-14, 0x1.AD3B9A3570DC2p-13, -0x1.DB4685F472FFEp-13,
+		  -0x1.ED0F85C94BC13p-15, -0x1.9F31BAD9A1BA8p-13, -0x1.04E401691018Bp-12, -0x1.29A4D8789E114p-13, -0x1.5F879DC8F56FDp-15, -0x1.EBA6E821C8579p-18 },
+		{ 0x1.B1B576421C033p-22, 0x1.1E6A8FE6640D5p-19, -0x1.0C6FEAE14479Ap-20, -0x1.6C30ABC809911p-17, 0x1.0BD120CED566Fp-17, -0x1.BC93F8FCD2A66p-19,
+		  0x1.30A79D69CC173p-18, 0x1.96D73EB344F8Fp-16, 0x1.644F00928E1F3p-15, 0x1.14B89A287821Fp-15, 0x1.B9BBCE605F8EAp-17, 0x1.921BA2A091228p-19 },
+		{ -0x1.CCAA3CF818A22p-26, -0x1.5EC77D83FC666p-24, 0x1.4FE0282EF1111p-22, 0x1.177E26C6F8444p-22, -0x1.0F35063E4B111p-19, 0x1.5355A4A85DEEFp-19,
+		  -0x1.7EA258EB11444p-22, -0x1.76590F1C24311p-19, -0x1.BC051C20394F3p-18, -0x1.C6E3BE548AA08p-18, -0x1.D934D476EDDE7p-19, -0x1.0D42E4F79895Bp-20 },
+		{ 0x1.F63FF6FBC0889p-30, 0x1.E0A279FAB3333p-30, -0x1.76818953F5555p-26, 0x1.21AFAFFED5555p-24, -0x1.4EB4E70576666p-24, 0x1.D9B0892179111p-22,
+		  0x1.E78907C180000p-26, 0x1.47B1442E2E800p-22, 0x1.0095111061091p-20, 0x1.51CD6A04ED717p-20, 0x1.BC7FD91E610A9p-21, 0x1.322175CCEDB6Fp-22 },
+		{ -0x1.5BFE06D6AAAABp-34, 0x1.15028247BBBBCp-31, 0x1.A363747DDDDDEp-30, -0x1.3723620888889p-28, 0x1.E6512AD5BBBBCp-26, 0x1.049FD49C55555p-25,
+		  -0x1.F15CBC6777777p-30, -0x1.1494ACDC71111p-25, -0x1.1687B57463555p-23, -0x1.CC0B981214666p-23, -0x1.752AA075A0700p-23, -0x1.2EE3B2BC6D93Cp-24 },
+		{ 0x1.019A3D5AAAAABp-37, -0x1.6675468000000p-36, 0x1.E1CFA4B333333p-34, 0x1.97603EEEEEEEFp-34, 0x1.AEA5604BBBBBCp-30, -0x1.24E1E4399999Ap-29,
+		  0x1.800AA64CCCCCDp-33, 0x1.BC241235EEEEFp-29, 0x1.1CC6560929111p-26, 0x1.2215DE2F2A333p-25, 0x1.1BDB54DFE6D9Ap-25, 0x1.098EA41542540p-26 },
+		{ -0x1.82D725DDDDDDEp-41, -0x1.AA9AB9999999Ap-41, -0x1.81ADE1999999Ap-36, 0x1.2D58251111111p-35, -0x1.8C5AB8EEEEEEFp-32, -0x1.BD2974F777777p-31,
+		  -0x1.E8EA3BBBBBBBCp-37, -0x1.5BA3F13111111p-32, -0x1.15003FDCE6666p-29, -0x1.558C549C4BBBCp-28, -0x1.8B61FF7C94EEFp-28, -0x1.A25F2E6D90EABp-29 },
+		{ -0x1.4AA6277777777p-44, -0x1.1886366666666p-40, -0x1.FCEF511111111p-40, -0x1.7658688888889p-37, -0x1.1B82FD1111111p-35, -0x1.A1E599999999Ap-34,
+		  -0x1.0493555555555p-41, 0x1.06F5652AAAAABp-35, 0x1.0155444622222p-32, 0x1.79AE54DE80000p-31, 0x1.FC4F3436B5555p-31, 0x1.2B4D524221222p-31 },
+		{ 0x1.3C4F777777777p-46, 0x1.7E4ECCCCCCCCDp-43, 0x1.EF3F777777777p-42, 0x1.5FD4888888889p-41, 0x1.6B3DBBBBBBBBCp-38, 0x1.2CFC444444444p-41,
+		  0x1.45DCCCCCCCCCDp-42, -0x1.635D155555555p-39, -0x1.C773D7CCCCCCDp-36, -0x1.89A1745222222p-34, -0x1.2F1ABE5C11111p-33, -0x1.8797374802222p-34 },
+		{ 0x1.006C111111111p-45, 0x1.1F57111111111p-42, 0x1.8C65555555555p-41, 0x1.9709111111111p-40, 0x1.60D6222222222p-39, 0x1.1DC2000000000p-38,
+		  0x1.3918666666666p-41, 0x1.3513888888889p-41, 0x1.9320B00000000p-39, 0x1.85D9902222222p-37, 0x1.52573C5DDDDDEp-36, 0x1.DA0F486B9999Ap-37 },
+		{ -0x1.629BBBBBBBBBCp-48, -0x1.8F4EEEEEEEEEFp-45, -0x1.1208888888889p-43, -0x1.0B4AAAAAAAAABp-42, -0x1.D866666666666p-42, -0x1.538CCCCCCCCCDp-42,
+		  -0x1.B32EEEEEEEEEFp-44, -0x1.59F999999999Ap-44, -0x1.5F6099999999Ap-42, -0x1.7FAD144444444p-40, -0x1.764E0BAAAAAABp-39, -0x1.1B56D91222222p-39 },
+		{ -0x1.32C9111111111p-47, -0x1.57D8888888889p-44, -0x1.DBA0000000000p-43, -0x1.CCFBBBBBBBBBCp-42, -0x1.6FDEEEEEEEEEFp-41, -0x1.E2C8888888889p-41,
+		  -0x1.791999999999Ap-43, -0x1.99FCCCCCCCCCDp-44, -0x1.C99999999999Ap-54, 0x1.4981F77777777p-43, 0x1.6E6AFEEEEEEEFp-42, 0x1.270D88B333333p-42 }
+	},
+	{
+		{ 0x1.A8A04C5B1D92Bp-8, 0x1.E14EE8CDEC037p-5, 0x1.536378B0F670Bp-3, 0x1.54687EDC11A5Dp-2, 0x1.21A4EBF5B3997p-1, 0x1.B6365C34D768Fp-1,
+		  0x1.2D64B623FA1C7p-3, 0x1.253FAE9AD38C4p-4, 0x1.0C7BFA8841E64p-6, 0x1.AEA3292E24184p-10, 0x1.0F5430E037844p-14, 0x1.05C122E607614p-20 },
+		{ -0x1.5D0ABBD8AF6AFp-11, -0x1.858F76CD6E9DEp-8, -0x1.08C9A92EC0E87p-6, -0x1.EC29DEF3AE29Bp-6, -0x1.5DBC8023B3D0Dp-5, -0x1.0F5FA9F2E1817p-5,
+		  -0x1.0861BCBED5A05p-7, -0x1.8594AA2367BF6p-8, -0x1.3D6F0EDEA6862p-9, -0x1.D62E3AA5B9085p-12, -0x1.1CF18D85E1127p-15, -0x1.1FDE1DBBE11CCp-20 },
+		{ 0x1.A7AA7F702C8D4p-15, 0x1.C34A252200479p-12, 0x1.0FD829570F5D2p-10, 0x1.725178A7F421Ep-10, 0x1.45073DE4EF372p-12, -0x1.F1DFF43D5FF57p-9,
+		  0x1.0259B10D9D812p-11, 0x1.79562A74B8B0Cp-11, 0x1.E5F75CA42DD53p-12, 0x1.00AF490AE2FD9p-13, 0x1.C77FF0FE475CBp-17, 0x1.7307DC95EABC6p-21 },
+		{ -0x1.CEDE009ED3334p-19, -0x1.C1A86DD20AAA7p-16, -0x1.93DED646545A6p-15, -0x1.0AAA6380D9E37p-18, 0x1.9201E9F7AF0CAp-13, -0x1.35BA5E3EAA239p-14,
+		  -0x1.145E14F89B9E4p-15, -0x1.50BCDCB0C39CEp-14, -0x1.2CE7A83F4B058p-14, -0x1.B8A678E5128FCp-16, -0x1.1902593042C8Ep-18, -0x1.596982CEE58F7p-22 },
+		{ 0x1.EA350C0F1BE91p-23, 0x1.9A99D95D9D809p-20, 0x1.555E62BDCD422p-20, -0x1.66B75C3A642C4p-18, -0x1.29E5AA9B694C4p-17, 0x1.A57135BB35E00p-15,
+		  0x1.36933E1B64380p-19, 0x1.170642FCED919p-17, 0x1.530DDACCF6B5Fp-17, 0x1.4F85650D3D5EEp-18, 0x1.2619F397E65FCp-20, 0x1.FEE6CB737BFB9p-24 },
+		{ -0x1.539BB38160DDEp-27, -0x1.206DAD224C889p-25, 0x1.7F4106C22C889p-23, 0x1.88C9C5C65F555p-21, -0x1.7B30D62FE999Ap-21, 0x1.E39B6C231B911p-18,
+		  -0x1.F47651BF9D99Ap-24, -0x1.C214982D10844p-21, -0x1.69ED9F21EEABCp-20, -0x1.D0D4818D09547p-21, -0x1.0DB7533F34A25p-22, -0x1.3B5D8B6AD7E71p-25 },
+		{ 0x1.0DA4205A95DDEp-30, 0x1.1FD7C61AE6666p-28, -0x1.62A000C6FBBBCp-28, 0x1.519A370295555p-27, 0x1.D7C303C940889p-23, -0x1.077C75A58CCCDp-23,
+		  0x1.D2FD86D697777p-27, 0x1.46D05CE67FBBCp-24, 0x1.5D5A6AB8CD9DEp-23, 0x1.24FC0D0A7B355p-23, 0x1.BA51896B02397p-25, 0x1.4F432208FC653p-27 },
+		{ -0x1.765009B6EEEEFp-34, -0x1.BFC2543CCCCCDp-32, -0x1.CD6E93CDDDDDEp-32, -0x1.7C16C902CCCCDp-28, -0x1.9342625800000p-29, -0x1.58DAC2E700000p-23,
+		  -0x1.06AC2FE111111p-30, -0x1.DE0CE9E011111p-28, -0x1.4725694ABA222p-26, -0x1.596F4FCE3F99Ap-26, -0x1.49EB3FE6BB8ABp-27, -0x1.39982379C37FEp-29 },
+		{ -0x1.160E627000000p-37, -0x1.C864927333333p-34, -0x1.72AD3C6DDDDDEp-32, -0x1.082548A555555p-31, -0x1.2946781400000p-28, -0x1.2178B79733333p-26,
+		  -0x1.1FE9796222222p-34, 0x1.74BF18099999Ap-31, 0x1.2C1ED0111DDDEp-29, 0x1.7F27FAE872222p-29, 0x1.C45B1E2676555p-30, 0x1.062AE85EB1A3Cp-31 },
+		{ -0x1.06EF133333333p-41, -0x1.76FB3B7777777p-39, -0x1.A2B2540000000p-37, -0x1.5295D6CCCCCCDp-35, -0x1.E2FF0AAAAAAABp-38, 0x1.65EBFCD111111p-30,
+		  -0x1.807D75DDDDDDEp-37, -0x1.B917EAEEEEEEFp-35, -0x1.ED06EDCE66666p-33, -0x1.8DEFC85F2EEEFp-32, -0x1.1F420D5AC0000p-32, -0x1.8C8CFF1F7E19Ap-34 },
+		{ 0x1.020E66EEEEEEFp-43, 0x1.175F755555555p-40, 0x1.FF79E9999999Ap-39, 0x1.0F2271999999Ap-37, 0x1.BEBD57BBBBBBCp-35, 0x1.17B7E6AAAAAABp-31,
+		  0x1.5706EAAAAAAABp-41, 0x1.FCDE233333333p-39, 0x1.90F0B0D99999Ap-36, 0x1.89A558D088889p-35, 0x1.545CB12AC8889p-35, 0x1.11E5685300222p-36 },
+		{ 0x1.37CE888888889p-45, 0x1.72556EEEEEEEFp-42, 0x1.0F23800000000p-40, 0x1.5A173BBBBBBBCp-39, 0x1.A982777777777p-39, 0x1.4573D33333333p-35,
+		  0x1.36DE888888889p-41, -0x1.5CFCAAAAAAAABp-42, -0x1.4C5732AAAAAABp-39, -0x1.738E723777777p-38, -0x1.799BB11000000p-38, -0x1.5B9F11A90CCCDp-39 },
+		{ 0x1.91B8222222222p-46, 0x1.CCF1DDDDDDDDEp-43, 0x1.433C222222222p-41, 0x1.403B333333333p-40, 0x1.E832222222222p-40, -0x1.0820CCCCCCCCDp-38,
+		  0x1.13CD99999999Ap-41, 0x1.2941333333333p-42, 0x1.3468088888889p-42, 0x1.50B5908888889p-41, 0x1.8B274D4444444p-41, 0x1.99B089DAEEEEFp-42 },
+		{ -0x1.2CF999999999Ap-48, -0x1.5616666666666p-45, -0x1.E47999999999Ap-44, -0x1.E83DDDDDDDDDEp-43, -0x1.7ABDDDDDDDDDEp-42, -0x1.0F2B333333333p-39,
+		  -0x1.863BBBBBBBBBCp-44, -0x1.9055555555555p-45, -0x1.1469111111111p-45, -0x1.2FF4844444444p-44, -0x1.9A909EEEEEEEFp-44, -0x1.DD21F4C000000p-45 },
+		{ -0x1.E67EEEEEEEEEFp-48, -0x1.16D7777777777p-44, -0x1.8556666666666p-43, -0x1.843AAAAAAAAABp-42, -0x1.45C3333333333p-41, -0x1.EA1999999999Ap-41,
+		  -0x1.48F8888888889p-43, -0x1.4820000000000p-44, -0x1.25A3333333333p-46, 0x1.5667777777777p-48, 0x1.7A7D955555555p-47, 0x1.E6A8F9BBBBBBCp-48 }
+	},
+	{
+		{ 0x1.5D04E18605767p-8, 0x1.8C752C114CB73p-5, 0x1.18F34A8EC2EF6p-3, 0x1.1C93DD39DD0EAp-2, 0x1.EE89E73591B7Cp-2, 0x1.8CB8EDC09DCF2p-1,
+		  0x1.0FE98C978F2A8p-3, 0x1.FC540F2528FEAp-5, 0x1.A859F01272DC6p-7, 0x1.1C471722321A4p-10, 0x1.EDC73D6CF41BDp-16, 0x1.6D17EBA0B6EB8p-23 },
+		{ -0x1.05552B197466Dp-11, -0x1.26BFFEEF69223p-8, -0x1.9AD551FFEC091p-7, -0x1.923A147B5D655p-6, -0x1.43397E26445DEp-5, -0x1.8215CB68C1B3Fp-5,
+		  -0x1.A51E5515A90D6p-8, -0x1.F46E0429BB365p-9, -0x1.37AA3F9454842p-10, -0x1.57AC89C9658B3p-13, -0x1.10E565E24A863p-17, -0x1.D128BB6A17651p-24 },
+		{ 0x1.22CAAA7B35A38p-15, 0x1.3EECE3F7652E1p-12, 0x1.9E9DEE52FD053p-11, 0x1.5931951A394B2p-10, 0x1.4387B12C7F846p-10, -0x1.56B4051893DA4p-9,
+		  0x1.687A4140D598Cp-12, 0x1.93D31764DE914p-12, 0x1.9D1CF12C9BD8Fp-13, 0x1.42E6E050F33C9p-15, 0x1.6144C2CB2CD1Ap-19, 0x1.D46B83400828Ap-25 },
+		{ -0x1.01FD8A691F983p-19, -0x1.065FCF0ADB537p-16, -0x1.1061333847BF2p-15, -0x1.4D17C1945902Bp-16, 0x1.F326DF804BD62p-14, 0x1.01D68479A0B5Ap-11,
+		  -0x1.274BB0EFB2CBBp-16, -0x1.3EFAF8B4EB0E5p-15, -0x1.BC7CF43B7B578p-16, -0x1.C5F9DD68DA223p-18, -0x1.55EDC652C8217p-21, -0x1.624EDD1EFF108p-26 },
+		{ 0x1.4FF1B64B7A8ABp-23, 0x1.49D7EFA4B2511p-20, 0x1.32C92276D9EE6p-19, 0x1.111574612A089p-21, -0x1.01F9327C54333p-17, 0x1.09EB1744DA764p-14,
+		  0x1.AF57C745EE7EFp-20, 0x1.A5E32113A51A6p-19, 0x1.7A7F9F1FA1180p-19, 0x1.0B4B7EF72BDD7p-20, 0x1.1D1BF645CF580p-23, 0x1.BD8E8CD42BACFp-28 },
+		{ -0x1.155A2DE399000p-27, -0x1.D157066D07BBCp-25, -0x1.726D1D678E222p-25, 0x1.C3FE22087A666p-23, 0x1.99C80FDF92AABp-23, -0x1.20D4D07506EEFp-17,
+		  -0x1.22DEAB5E62222p-24, -0x1.33C3435136A66p-22, -0x1.6C0AB67CCC789p-22, -0x1.411A7B8B2ACA2p-23, -0x1.BA12415E9D78Fp-26, -0x1.E424BAB4F3CB5p-30 },
+		{ -0x1.7D931F403BBBCp-31, -0x1.205BC64DA3333p-27, -0x1.2D913790D4444p-25, -0x1.9C4259861999Ap-24, -0x1.031E729B8E666p-23, -0x1.E52CF2F96399Ap-20,
+		  -0x1.D681B38973333p-28, 0x1.EBBDDDE8DF333p-26, 0x1.5F8093F724555p-25, 0x1.683D87F9D5D9Ap-26, 0x1.3733DA3FD7BC0p-28, 0x1.CEE6956FBC602p-32 },
+		{ -0x1.36DB83B733333p-34, -0x1.2A8AA47E66666p-31, -0x1.4C83545CCCCCDp-30, -0x1.F052BC6222222p-29, -0x1.5DCACEACCCCCDp-26, 0x1.2BEAFB12A6666p-23,
+		  -0x1.5C6AC5BBBBBBCp-30, -0x1.87CD3732EEEEFp-30, -0x1.B1AA5A7077777p-29, -0x1.535595C01AEEFp-29, -0x1.8E2D354765BBCp-31, -0x1.8C335FAA67A11p-34 },
+		{ 0x1.7C9BE11333333p-36, 0x1.B25CB5799999Ap-33, 0x1.4BAE79EDDDDDEp-31, 0x1.C35F3B3777777p-30, 0x1.39B8E797BBBBCp-28, 0x1.B52DC70B11111p-25,
+		  0x1.A6D7CDA888889p-33, 0x1.0A7EF28555555p-34, 0x1.2CAE1EC844444p-32, 0x1.450C59C8EEEEFp-32, 0x1.E247EAFC64889p-34, 0x1.33AF0B470F4EFp-36 },
+		{ 0x1.7112204444444p-39, 0x1.C47F818000000p-36, 0x1.6BB245BBBBBBCp-34, 0x1.B369011111111p-33, 0x1.5B093C2444444p-31, -0x1.702DCF6000000p-30,
+		  0x1.34381D0000000p-35, -0x1.EAD1986EEEEEFp-36, -0x1.B6B899DDDDDDEp-35, -0x1.4F4536C888889p-35, -0x1.142CBFCB11111p-36, -0x1.B518B7A1D5333p-39 },
+		{ -0x1.3143EBBBBBBBCp-42, -0x1.6E5D7CCCCCCCDp-39, -0x1.1EE3CCCCCCCCDp-37, -0x1.5EEAE55555555p-36, -0x1.37C4731111111p-34, -0x1.745FE02222222p-30,
+		  -0x1.B9BAF9999999Ap-40, 0x1.6070C5DDDDDDEp-40, 0x1.D4D3255555555p-39, 0x1.0EF8BF7555555p-38, 0x1.2426B7089999Ap-39, 0x1.1DF56822F199Ap-41 },
+		{ -0x1.1E0D555555555p-44, -0x1.5A8D6AAAAAAABp-41, -0x1.1EE8BBBBBBBBCp-39, -0x1.7EEEDDDDDDDDEp-38, -0x1.182F677777777p-36, -0x1.BCFD422222222p-36,
+		  -0x1.3BFFAAAAAAAABp-41, 0x1.129059999999Ap-41, 0x1.5FB599999999Ap-43, -0x1.8043F2AAAAAABp-42, -0x1.260B11FBBBBBCp-42, -0x1.5AA45EE5EEEEFp-44 },
+		{ 0x1.3D58888888889p-46, 0x1.5CA2AAAAAAAABp-43, 0x1.E99B777777777p-42, 0x1.DA2B333333333p-41, 0x1.B306222222222p-40, 0x1.3969155555555p-35,
+		  0x1.B106666666666p-42, 0x1.FC4D333333333p-43, 0x1.984C444444444p-44, 0x1.CDCD4CCCCCCCDp-45, 0x1.21EFCE6666666p-45, 0x1.889D5F5BBBBBCp-47 },
+		{ -0x1.F091111111111p-50, -0x1.0EC6666666666p-46, -0x1.4748888888889p-45, -0x1.949999999999Ap-45, 0x1.2E73333333333p-44, 0x1.A5F199999999Ap-40,
+		  -0x1.19CEEEEEEEEEFp-44, -0x1.89F4444444444p-45, -0x1.1D45555555555p-46, -0x1.989AAAAAAAAABp-48, -0x1.1398155555555p-48, -0x1.B7C34D2222222p-50 },
+		{ -0x1.89FBBBBBBBBBCp-48, -0x1.B4C4444444444p-45, -0x1.359DDDDDDDDDEp-43, -0x1.33A2222222222p-42, -0x1.0114444444444p-41, -0x1.99A0000000000p-40,
+		  -0x1.23F4444444444p-43, -0x1.1DF3BBBBBBBBCp-44, -0x1.FF0CCCCCCCCCDp-47, -0x1.2EF999999999Ap-50, 0x1.A49F111111111p-52, 0x1.B28F9A2222222p-53 }
+	},
+	{
+		{ 0x1.23E8CD8EFDB9Ep-8, 0x1.4BDAA675D90DAp-5, 0x1.D738627227E74p-4, 0x1.DF1413BA33973p-3, 0x1.A3A23CA8BAF08p-2, 0x1.59748D3DB9043p-1,
+		  0x1.F055B1957408Cp-4, 0x1.C840A56DED129p-5, 0x1.6E81B4DA5E45Fp-7, 0x1.C77BDD5E1E6EDp-11, 0x1.5187ACC92D011p-16, 0x1.37E2BCA48517Cp-24 },
+		{ -0x1.8D07970C7B610p-12, -0x1.C242AF8BD21A6p-9, -0x1.3DE0989742342p-7, -0x1.3F95D965CDED9p-6, -0x1.113181DD498EFp-5, -0x1.9E6B294523B57p-5,
+		  -0x1.55EEB22176835p-8, -0x1.5B8288DDE0908p-9, -0x1.545553D415C6Cp-11, -0x1.1D551E81C5AA5p-14, -0x1.45E3B37FB2F80p-19, -0x1.33CD66A9CA398p-26 },
+		{ 0x1.B56DA9D5FEDD9p-16, 0x1.E9BBA549F7917p-13, 0x1.4F46076A81069p-11, 0x1.3BD1C10711F3Ep-10, 0x1.C9C1AEBC50FAAp-10, 0x1.D7ECFD9991BEEp-11,
+		  0x1.1A607367FB776p-12, 0x1.C3B65E6421C98p-13, 0x1.6B2E21BBF67A2p-14, 0x1.C881A3C82419Dp-17, 0x1.6DA47946DDC0Fp-21, 0x1.F392DE91A42ACp-28 },
+		{ -0x1.26B4FFAF5A094p-20, -0x1.347966BD87C34p-17, -0x1.5E4DF03E32321p-16, -0x1.647F635303F53p-16, 0x1.73FD1DB673D7Dp-15, 0x1.0B274715092B6p-11,
+		  -0x1.2686A4074A0A6p-17, -0x1.5908D9486E934p-16, -0x1.A12D06AD956E1p-17, -0x1.46AA8E5CCA798p-19, -0x1.40B8F3160932Dp-23, -0x1.2D537A4795968p-29 },
+		{ 0x1.727616E44BC44p-25, 0x1.40E76AED954BCp-22, 0x1.F7A7FDE9FAF77p-23, -0x1.0A7215377F411p-19, -0x1.A564A04991A9Ap-17, -0x1.D2267E09BFD29p-15,
+		  0x1.FB883D1103111p-22, 0x1.A99E554375ABCp-20, 0x1.375757C960755p-20, 0x1.337BDCEB3D42Dp-22, 0x1.987CE3F655322p-26, 0x1.2712F9BA54DBBp-31 },
+		{ -0x1.7D32840422666p-27, -0x1.9D31891FFFDDEp-24, -0x1.066EC2FF86B33p-22, -0x1.AFB760FAAEAABp-22, -0x1.358133A638DDEp-21, -0x1.D0CEF4241299Ap-18,
+		  -0x1.199CF47A6BEEFp-23, -0x1.2D3049C697666p-24, -0x1.F67443B7DF4CDp-25, -0x1.B535D32786B9Ap-26, -0x1.D1DC9F9393EE6p-29, -0x1.076F3F9D24B0Bp-33 },
+		{ 0x1.E2664E7577777p-31, 0x1.09E6944B24CCDp-27, 0x1.674A64E7B6666p-26, 0x1.74941F6382222p-25, 0x1.1D6E5391BC444p-23, 0x1.E8857E5238555p-20,
+		  0x1.97D1EB4AF7777p-28, 0x1.AD6884F4F999Ap-28, 0x1.08D9CD6579777p-27, 0x1.EE5BCC591C222p-29, 0x1.2BC7D2AB1C044p-31, 0x1.B957548D95E57p-36 },
+		{ 0x1.81B16FEE77777p-33, 0x1.D6D48DBBBBBBCp-30, 0x1.806C101700000p-28, 0x1.DC942E9255555p-27, 0x1.F8A0527166666p-26, 0x1.9F7D13F9E6666p-25,
+		  0x1.356EE6A777777p-29, -0x1.BFA5408422222p-30, -0x1.0B21A6B986666p-29, -0x1.54D70040C2222p-31, -0x1.7520A4C15F333p-34, -0x1.4F8960981B822p-38 },
+		{ -0x1.3F7757B777777p-36, -0x1.87FEEFFF77777p-33, -0x1.452AF52D55555p-31, -0x1.A7A04D3CCCCCDp-30, -0x1.1B54869333333p-28, -0x1.A749466CB3333p-25,
+		  -0x1.CAB1C26EEEEEFp-34, 0x1.A8F05CA222222p-34, 0x1.08105CB9BBBBCp-33, 0x1.BA409F8AAAAABp-35, 0x1.60E6A37E8AAABp-37, 0x1.CBB7B8D125AABp-41 },
+		{ -0x1.31EF42199999Ap-38, -0x1.6B94FF199999Ap-35, -0x1.1E2E6C8CCCCCDp-33, -0x1.633DF24AAAAABp-32, -0x1.BD2CE54EEEEEFp-31, 0x1.F431114000000p-30,
+		  -0x1.F6766CCCCCCCDp-35, 0x1.7FFF2BDDDDDDEp-36, 0x1.696367CEEEEEFp-36, 0x1.DBA464B333333p-42, -0x1.2058B68BAAAABp-40, -0x1.26FBDCAAC1111p-43 },
+		{ 0x1.03C1015555555p-41, 0x1.3BB1960000000p-38, 0x1.057878EEEEEEFp-36, 0x1.6766F26666666p-35, 0x1.1D0754EEEEEEFp-33, 0x1.3EF17BF555555p-30,
+		  0x1.5DF6066666666p-39, -0x1.CAA8E00000000p-40, -0x1.D171FE2222222p-41, 0x1.4D36A5DDDDDDEp-42, 0x1.52A22A9222222p-43, 0x1.6B703943FBBBCp-46 },
+		{ 0x1.EDC2555555555p-44, 0x1.26CB488888889p-40, 0x1.D288F33333333p-39, 0x1.1F42144444444p-37, 0x1.5EBB89999999Ap-36, -0x1.F125C88888889p-34,
+		  0x1.C2E6444444444p-40, -0x1.003D99999999Ap-41, -0x1.6AFD588888889p-41, -0x1.68188D1111111p-43, -0x1.9911A2BBBBBBCp-46, -0x1.9FA1AC4222222p-49 },
+		{ 0x1.C602222222222p-49, 0x1.49ECCCCCCCCCDp-46, -0x1.2955555555555p-47, -0x1.635D555555555p-42, -0x1.4D9F333333333p-39, -0x1.78B1F77777777p-36,
+		  0x1.6317777777777p-42, 0x1.F5C3BBBBBBBBCp-43, 0x1.4474111111111p-44, 0x1.565FCCCCCCCCDp-47, 0x1.016F488888889p-49, 0x1.AE875E9111111p-52 },
+		{ -0x1.594EEEEEEEEEFp-48, -0x1.915BBBBBBBBBCp-45, -0x1.2EE6666666666p-43, -0x1.5A64CCCCCCCCDp-42, -0x1.71EF777777777p-41, 0x1.E62C444444444p-39,
+		  -0x1.BC4EEEEEEEEEFp-44, -0x1.6BFBBBBBBBBBCp-46, 0x1.FE4EEEEEEEEEFp-48, 0x1.1487333333333p-49, -0x1.3818CCCCCCCCDp-54, -0x1.C1904CCCCCCCDp-55 },
+		{ -0x1.38F999999999Ap-48, -0x1.5D03333333333p-45, -0x1.E89BBBBBBBBBCp-44, -0x1.E09DDDDDDDDDEp-43, -0x1.6C3BBBBBBBBBCp-42, -0x1.60F1111111111p-42,
+		  -0x1.0964444444444p-43, -0x1.F7F7777777777p-45, -0x1.B392222222222p-47, -0x1.087BBBBBBBBBCp-50, 0x1.21CCCCCCCCCCDp-59, 0x1.B89D844444444p-58 }
+	},
+	{
+		{ 0x1.F1221922933F1p-9, 0x1.1AA3F3E8BFB56p-5, 0x1.9188F3C4E1A92p-4, 0x1.989EC46D0BAF6p-3, 0x1.66A33EA2EADDFp-2, 0x1.2912770A1BD14p-1,
+		  0x1.C9BBE8DF6590Ap-4, 0x1.A2B71CCF47705p-5, 0x1.4C9C7B0792731p-7, 0x1.9489073F5E94Ep-11, 0x1.1EB85AF21D12Ap-16, 0x1.D1D68B12D6368p-25 },
+		{ -0x1.2CBCF1526A87Ep-12, -0x1.55C77A4F8175Ep-9, -0x1.E4F4090BD9FE0p-8, -0x1.EC57C48F237C9p-7, -0x1.AE05AEC910654p-6, -0x1.5F3DF26A56C4Cp-5,
+		  -0x1.15CF7A89DB42Bp-8, -0x1.04EF283B39EBAp-9, -0x1.B71C10F6171E3p-12, -0x1.277666A78EC7Cp-15, -0x1.F3E68E1B038ECp-21, -0x1.24DDF35FB2DFDp-28 },
+		{ 0x1.4E23CAF728647p-16, 0x1.7A5866922E3A5p-13, 0x1.0A24FB342E483p-11, 0x1.09B1918035634p-10, 0x1.BF7D240B894DFp-10, 0x1.4387B7A42130Ap-9,
+		  0x1.CD7234C58F39Dp-13, 0x1.065746D926FE1p-13, 0x1.2DCFC39944BB8p-15, 0x1.25BDE20B92CB7p-18, 0x1.73093BFAA9DC5p-23, 0x1.5A6897A21F9F9p-30 },
+		{ -0x1.0D84335F626D9p-20, -0x1.2A9C9B40594B3p-17, -0x1.8E77D15E5787Dp-16, -0x1.61E681F02AA9Bp-15, -0x1.AA972B1278A06p-15, 0x1.4A3102C9C21C3p-15,
+		  -0x1.1B1952D9FF1C1p-17, -0x1.5B26DFBDBE96Ep-17, -0x1.5353E75D06AE7p-18, -0x1.C387E79B5CA0Dp-21, -0x1.5FEEEB06DF9ABp-25, -0x1.944DD5FE8B1BCp-32 },
+		{ 0x1.4A254E47BBAABp-28, -0x1.851C0C81BAAABp-30, -0x1.44E6B139AE8CDp-22, -0x1.EBE426A5D3CABp-20, -0x1.0B0DD99229E33p-17, -0x1.54108155B29B5p-15,
+		  -0x1.00927023C5000p-23, 0x1.03141E48339F7p-20, 0x1.6D1DA50723F3Cp-21, 0x1.1920BD0F7166Bp-23, 0x1.F048FA4C68616p-28, 0x1.5D3C4841EB1F4p-34 },
+		{ 0x1.5A952BCD49BBCp-29, 0x1.E0392C651999Ap-26, 0x1.E527348484889p-24, 0x1.8CC0DFCE84777p-22, 0x1.463C4EC17E5DEp-20, 0x1.7788A42E37E22p-18,
+		  0x1.2181829CA0000p-26, -0x1.1B05C102F0111p-24, -0x1.C9AA4D96C2E66p-25, -0x1.9D3BB6CF48AABp-27, -0x1.CA275397A4311p-31, -0x1.D11B3B6BC45A0p-37 },
+		{ 0x1.2C96EA2057777p-31, 0x1.4D3A8D2B2EEEFp-28, 0x1.BC4CD77394444p-27, 0x1.85FAE2CFC7777p-26, 0x1.A903600AFBBBCp-26, -0x1.88D9AB4842222p-25,
+		  0x1.281B354855555p-27, -0x1.424DF087DDDDEp-33, -0x1.6B8253360EEEFp-31, 0x1.1314A02FBA666p-32, 0x1.0A42874027777p-34, 0x1.140C681C73780p-39 },
+		{ -0x1.3DA0540077777p-33, -0x1.75730958DDDDEp-30, -0x1.1EB159DD4CCCDp-28, -0x1.5460A8A311111p-27, -0x1.A0BE926C11111p-26, -0x1.DB606A956EEEFp-24,
+		  -0x1.9EEC57819999Ap-30, 0x1.EC79BD2CCCCCDp-32, 0x1.F23C70BD9999Ap-32, 0x1.301EBD9B2AAABp-35, -0x1.8AB3B4C486666p-38, -0x1.64E552339F99Ap-42 },
+		{ 0x1.B70A204CCCCCDp-39, 0x1.124432F777777p-35, 0x1.E9100A4AAAAABp-34, 0x1.87AA058333333p-32, 0x1.9D2E271000000p-30, 0x1.241574DC77777p-26,
+		  -0x1.1E93104CCCCCDp-35, 0x1.C340C74000000p-36, 0x1.378030FD55555p-35, 0x1.AF2EC148AAAABp-37, 0x1.A51E1116EEEEFp-40, 0x1.F5D136A6FC444p-45 },
+		{ 0x1.88684A8CCCCCDp-39, 0x1.D1F7E46666666p-36, 0x1.6AD8A4C888889p-34, 0x1.AD36B72666666p-33, 0x1.CCFBB5999999Ap-32, -0x1.FBE71CCCCCCCDp-37,
+		  0x1.3316DD2222222p-35, -0x1.1E10EB0000000p-36, -0x1.3E8EFB3DDDDDEp-36, -0x1.1098B853BBBBCp-38, -0x1.3DE06A7933333p-42, -0x1.38FC7D3573333p-47 },
+		{ -0x1.7D52866666666p-42, -0x1.CE7C122222222p-39, -0x1.7AF5DDBBBBBBCp-37, -0x1.F325D7DDDDDDEp-36, -0x1.5F9FC8AAAAAABp-34, -0x1.972AD16EEEEEFp-32,
+		  -0x1.98E9B88888889p-39, 0x1.11670F7777777p-40, 0x1.4B23B46666666p-40, 0x1.1278174CCCCCDp-42, 0x1.71FED98000000p-46, 0x1.2E0B8B9866666p-50 },
+		{ -0x1.9D2DE66666666p-46, -0x1.E06D333333333p-43, -0x1.621AB33333333p-41, -0x1.62EE4CCCCCCCDp-40, -0x1.E6DE666666666p-41, 0x1.CC16300000000p-35,
+		  -0x1.53FBDDDDDDDDEp-42, 0x1.7B30DDDDDDDDEp-42, 0x1.410DE00000000p-42, 0x1.D34B188888889p-45, 0x1.D4D6C2AAAAAABp-50, -0x1.D82F5D5DDDDDEp-54 },
+		{ 0x1.95FE222222222p-46, 0x1.D9A0AAAAAAAABp-43, 0x1.6600DDDDDDDDEp-41, 0x1.9860555555555p-40, 0x1.BF33DDDDDDDDEp-39, 0x1.A6DE222222222p-39,
+		  0x1.049E444444444p-41, 0x1.0B8D777777777p-43, -0x1.1ED8CCCCCCCCDp-46, -0x1.BB5D444444444p-48, -0x1.06F2000000000p-52, 0x1.D5A3A3BBBBBBCp-57 },
+		{ -0x1.56A1111111111p-49, -0x1.8E4CCCCCCCCCDp-46, -0x1.2743333333333p-44, -0x1.4FA999999999Ap-43, -0x1.9557777777777p-42, -0x1.BA82AAAAAAAABp-40,
+		  -0x1.12B999999999Ap-44, -0x1.0D91111111111p-45, -0x1.145EEEEEEEEEFp-47, -0x1.167B333333333p-50, -0x1.0FE5BBBBBBBBCp-54, -0x1.65C00CCCCCCCDp-59 },
+		{ -0x1.23E2222222222p-48, -0x1.4C44444444444p-45, -0x1.DBD0000000000p-44, -0x1.E6A1111111111p-43, -0x1.AE35555555555p-42, -0x1.0072222222222p-41,
+		  -0x1.F953333333333p-44, -0x1.B894444444444p-45, -0x1.3B07777777777p-47, -0x1.3141111111111p-51, -0x1.47B3333333333p-58, 0x1.50A399999999Ap-62 }
+	},
+	{
+		{ 0x1.AF5C5E3FD6FBBp-9, 0x1.EA827DEA0FD36p-6, 0x1.5C7374124E603p-4, 0x1.62A767A006591p-3, 0x1.375E64AA47292p-2, 0x1.0222DD1D7CAA8p-1,
+		  0x1.AA550926E9C39p-4, 0x1.85A1117F48A65p-5, 0x1.34DBC3E200894p-7, 0x1.762983CFE4E54p-11, 0x1.071EEDA587A09p-16, 0x1.A2C152D089F4Ep-25 },
+		{ -0x1.CAD3B55B8AEC4p-13, -0x1.04D9D7CAC1FE9p-9, -0x1.728B89F276C83p-8, -0x1.7904BED59DB13p-7, -0x1.4ACB1BDF73D4Bp-6, -0x1.11CBE0A1919C1p-5,
+		  -0x1.C5B8C41A74581p-9, -0x1.A07C201605298p-10, -0x1.4D651BF18A017p-12, -0x1.9B36AF4D1A753p-16, -0x1.2B1C2317F90B5p-21, -0x1.018B00ED8ED0Dp-29 },
+		{ 0x1.DE695F0AB2AFEp-17, 0x1.0FCD81FDC2D23p-13, 0x1.8183FC0EA5BC8p-12, 0x1.871EC01F638ACp-11, 0x1.55313183C3A2Ep-10, 0x1.160F3285FAB7Bp-9,
+		  0x1.62728D94A27FBp-13, 0x1.546D9D417C111p-14, 0x1.2B60935D18ABEp-16, 0x1.ADEEA6B4F79F3p-20, 0x1.8B39DEA63436Dp-25, 0x1.F8AD15278FB2Ep-33 },
+		{ -0x1.C47EB6F21EF84p-21, -0x1.00076CE7FD197p-17, -0x1.67BE2AD3AB1D9p-16, -0x1.6655F2F7E3EC1p-15, -0x1.2CB509EA8F472p-14, -0x1.B2BFEF81F1EFFp-14,
+		  -0x1.0FF0BCFB3B7DCp-17, -0x1.52FB5CF3D2306p-18, -0x1.AFAD27E151BEFp-20, -0x1.C192A3A6D4CC7p-23, -0x1.2333CAB8BC359p-27, -0x1.03B9437AEC02Fp-34 },
+		{ 0x1.1773BFB971A44p-25, 0x1.3341A1AF09711p-22, 0x1.924F5DAA0F3DEp-21, 0x1.55FBE61CA689Ap-20, 0x1.621A3F28B86ABp-20, -0x1.33C013E087000p-19,
+		  0x1.B7CC642D1C5DEp-23, 0x1.B4925B4736E55p-22, 0x1.DEBD923664DEFp-23, 0x1.44C96C86BCEA2p-25, 0x1.EBFF513BD3702p-30, 0x1.F7204587F467Fp-37 },
+		{ 0x1.5A837B052E222p-30, 0x1.C9C0D7FEB5DDEp-27, 0x1.ADD74AEA10444p-25, 0x1.43C402D256222p-23, 0x1.E29CBDB4A4AABp-22, 0x1.CE4072D3C5EEFp-20,
+		  0x1.9069DC3C3BBBCp-26, -0x1.4EBBEA9AD4666p-25, -0x1.0772F491D3A22p-25, -0x1.8EFE620B03844p-28, -0x1.4638E60390100p-32, -0x1.75CAA3EA74ECDp-39 },
+		{ -0x1.7D24775A18889p-32, -0x1.D2B02024D4444p-29, -0x1.82ED9AC6A0000p-27, -0x1.FBFD1E75ABBBCp-26, -0x1.506C1466BB333p-24, -0x1.33FA12A0B4444p-22,
+		  -0x1.E190F65173333p-29, 0x1.B1D5880B71111p-29, 0x1.916212A46B333p-29, 0x1.483614B8BFBBCp-31, 0x1.28E457E474800p-35, 0x1.9D0005F067000p-42 },
+		{ 0x1.B766C6F000000p-37, 0x1.1F82FD24CCCCDp-33, 0x1.0CED91BEEEEEFp-31, 0x1.9F20975266666p-30, 0x1.52889BAD55555p-28, 0x1.AEA5546C77777p-26,
+		  -0x1.A73B223333333p-36, -0x1.55D6564000000p-34, -0x1.3E4C2911DDDDEp-34, -0x1.7FFBF49ACCCCDp-36, -0x1.1463BBC666666p-39, -0x1.4CDF2AC751111p-45 },
+		{ 0x1.554D590555555p-38, 0x1.8A6DF95EEEEEFp-35, 0x1.217F976AAAAABp-33, 0x1.34BADDB444444p-32, 0x1.159EB05AAAAABp-31, 0x1.07DAF3B333333p-32,
+		  0x1.36D3210EEEEEFp-34, -0x1.C4C685F333333p-36, -0x1.E86C32499999Ap-36, -0x1.2D395C5C44444p-38, -0x1.6BE203DF33333p-44, 0x1.9EEFECD355555p-49 },
+		{ -0x1.0A38900000000p-40, -0x1.3B4A105555555p-37, -0x1.E9DD800000000p-36, -0x1.249DAC5555555p-34, -0x1.563D8BE666666p-33, -0x1.F7E2311555555p-32,
+		  -0x1.68F50DDDDDDDEp-37, 0x1.117512CCCCCCDp-38, 0x1.2F090AD555555p-38, 0x1.98A53C3BBBBBCp-41, 0x1.7D12DA599999Ap-46, -0x1.62C2CD5888889p-52 },
+		{ 0x1.40FCCBBBBBBBCp-45, 0x1.933FFAAAAAAABp-42, 0x1.6A92CEEEEEEEFp-40, 0x1.0F4BFD5555555p-38, 0x1.C10941999999Ap-37, 0x1.3CE931999999Ap-34,
+		  -0x1.12F3C88888889p-42, -0x1.26F7D77777777p-42, -0x1.C155600000000p-44, -0x1.A440EAAAAAAABp-48, 0x1.4D46082222222p-50, 0x1.33D6D40888889p-54 },
+		{ 0x1.2EC0666666666p-46, 0x1.5B95666666666p-43, 0x1.F377333333333p-42, 0x1.F852AAAAAAAABp-41, 0x1.737B000000000p-40, -0x1.11550CCCCCCCDp-38,
+		  0x1.ABC1111111111p-42, 0x1.822A666666666p-45, -0x1.CE37222222222p-45, -0x1.D3964CCCCCCCDp-47, -0x1.CE71E00000000p-51, -0x1.EA9AFC4444444p-57 },
+		{ 0x1.324D777777777p-47, 0x1.635CEEEEEEEEFp-44, 0x1.E4FBBBBBBBBBCp-43, 0x1.D5DD555555555p-42, 0x1.7662EEEEEEEEFp-41, 0x1.6CF3333333333p-40,
+		  0x1.5B71BBBBBBBBCp-42, 0x1.6A87777777777p-43, 0x1.786DBBBBBBBBCp-45, 0x1.4819333333333p-48, 0x1.87CEB33333333p-53, 0x1.1CB49DDDDDDDEp-59 },
+		{ -0x1.036CCCCCCCCCDp-49, -0x1.2660000000000p-46, -0x1.9C2EEEEEEEEEFp-45, -0x1.921DDDDDDDDDEp-44, -0x1.3E68888888889p-43, -0x1.560EEEEEEEEEFp-43,
+		  -0x1.08D999999999Ap-44, -0x1.EC6CCCCCCCCCDp-46, -0x1.8F86666666666p-48, -0x1.0822222222222p-51, -0x1.A722222222222p-57, -0x1.503A222222222p-63 },
+		{ -0x1.D2D2222222222p-49, -0x1.0F84CCCCCCCCDp-45, -0x1.7DFDDDDDDDDDEp-44, -0x1.860DDDDDDDDDEp-43, -0x1.5901111111111p-42, -0x1.271999999999Ap-41,
+		  -0x1.C772222222222p-44, -0x1.A023333333333p-45, -0x1.5378888888889p-47, -0x1.A7DBBBBBBBBBCp-51, -0x1.32D4CCCCCCCCDp-56, -0x1.F05999999999Ap-65 }
+	},
+	{
+		{ 0x1.7CAB75AD4807Cp-9, 0x1.B0DE9B27CC574p-6, 0x1.3381C91DC936Dp-4, 0x1.38FC78F2146C5p-3, 0x1.12CB974999375p-2, 0x1.C7AAAFE1925FAp-2,
+		  0x1.907E642CCED14p-4, 0x1.6DF8D7912F4C0p-5, 0x1.22076ADF3F4E6p-7, 0x1.5F2E167100DE3p-11, 0x1.ED75980D53292p-17, 0x1.87CA96E392D21p-25 },
+		{ -0x1.662950A471D63p-13, -0x1.974581400E25Ep-10, -0x1.21513959EDB60p-8, -0x1.267686021B5C5p-7, -0x1.028446DEB54DAp-6, -0x1.AC9D045580183p-6,
+		  -0x1.78D62A17DA6CBp-9, -0x1.5887720B6DFBBp-10, -0x1.11581E83AF987p-12, -0x1.4BA904396E911p-16, -0x1.D3D1404D01768p-22, -0x1.76AD5BD52D056p-30 },
+		{ 0x1.4FF804219E0DAp-17, 0x1.7E00E7BDE1020p-14, 0x1.0F50DF1736962p-12, 0x1.140B607B7470Ep-11, 0x1.E45E7DE08C85Bp-11, 0x1.90E404772D8BBp-10,
+		  0x1.0911AE4D502B1p-13, 0x1.E7FE52BA6DAD7p-15, 0x1.8903AA9CDC1AFp-17, 0x1.E9E11A2FB12C4p-21, 0x1.6AB58D56B3B68p-26, 0x1.42812466BF3A0p-34 },
+		{ -0x1.353FFB691A3B5p-21, -0x1.5F6944DB190AFp-18, -0x1.F27F52719E988p-17, -0x1.F9E5CE332FD4Bp-16, -0x1.B9A8C9FF4E791p-15, -0x1.690D1B7638620p-14,
+		  -0x1.948FB4F6041F7p-18, -0x1.8855187F43C50p-19, -0x1.5F25566263B25p-21, -0x1.01C0D0E5E1DF9p-24, -0x1.E380CE48405BBp-30, -0x1.3477C2A6D5965p-37 },
+		{ 0x1.04843BA19A233p-25, 0x1.270509CE23244p-22, 0x1.9F3EEC320D066p-21, 0x1.9F291BDEEDA11p-20, 0x1.5F9F5AB930E11p-19, 0x1.083574E577189p-18,
+		  0x1.1D6FC3C73F5BCp-22, 0x1.6BACA8A2ADBBCp-23, 0x1.D7D3B7D30BFDEp-25, 0x1.EDD1FB2692266p-28, 0x1.3BCF92BD345EFp-32, 0x1.0B64D366DEFB1p-39 },
+		{ -0x1.236512BF90444p-30, -0x1.4217CE9506666p-27, -0x1.ABC4E98AABBBCp-26, -0x1.79AABEF197777p-25, -0x1.CC6257E08F777p-25, 0x1.1123DA75DBBBCp-26,
+		  -0x1.7265EAEE53333p-28, -0x1.B218612B7D555p-27, -0x1.E608C7CF6CEEFp-28, -0x1.47671F9698333p-30, -0x1.E26263DA88B33p-35, -0x1.C815CC5EDD3BCp-42 },
+		{ -0x1.A0C7BEB5B3333p-35, -0x1.0859E60EFBBBCp-31, -0x1.D081C6CDC4444p-30, -0x1.438EC55B5999Ap-28, -0x1.B9399925E2222p-27, -0x1.6F9F348605555p-25,
+		  -0x1.0557353C6EEEFp-30, 0x1.49F85A333BBBCp-30, 0x1.0D2A719FEEEEFp-30, 0x1.9137285C06666p-33, 0x1.394E3BF22D111p-37, 0x1.3DFF041ADAEEFp-44 },
+		{ 0x1.FD38045B33333p-37, 0x1.31404F0111111p-33, 0x1.E543AAE3BBBBCp-32, 0x1.2A7B0872AAAABp-30, 0x1.665438CC88889p-29, 0x1.0EED70E311111p-27,
+		  0x1.77C182D666666p-33, -0x1.F5B15C599999Ap-34, -0x1.E8D8C69955555p-34, -0x1.7EB70C6F88889p-36, -0x1.39B74B63C4444p-40, -0x1.5CB64568C4444p-47 },
+		{ -0x1.A003860CCCCCDp-40, -0x1.F3B2F22666666p-37, -0x1.8F7259C000000p-35, -0x1.F22491B777777p-34, -0x1.352E4DE000000p-32, -0x1.01B90EC6EEEEFp-30,
+		  -0x1.D2C102BBBBBBCp-37, 0x1.14C666EEEEEEFp-37, 0x1.227D7F5DDDDDEp-37, 0x1.E232EC8CCCCCDp-40, 0x1.B1467CACCCCCDp-44, 0x1.200A8C4822222p-50 },
+		{ 0x1.128F8AAAAAAABp-45, 0x1.6CEC244444444p-42, 0x1.5FCACDDDDDDDEp-40, 0x1.19E20B3333333p-38, 0x1.DDB4B37777777p-37, 0x1.3235234444444p-34,
+		  -0x1.1397044444444p-41, -0x1.60F1C88888889p-43, -0x1.1BEE522222222p-44, -0x1.F414DC4444444p-46, -0x1.D7058A4444444p-49, -0x1.3A9D461333333p-54 },
+		{ 0x1.C0B1777777777p-50, 0x1.F025777777777p-47, 0x1.B1BD333333333p-45, 0x1.CCF4EEEEEEEEFp-44, 0x1.0109555555555p-44, -0x1.785DFDDDDDDDEp-39,
+		  -0x1.A3ECB33333333p-43, -0x1.2C824CCCCCCCDp-42, -0x1.2542B77777777p-43, -0x1.53B8033333333p-46, -0x1.6421866666666p-51, 0x1.4198B9999999Ap-60 },
+		{ 0x1.16B0000000000p-48, 0x1.3A50444444444p-45, 0x1.A852EEEEEEEEFp-44, 0x1.82B4888888889p-43, 0x1.0D9DBBBBBBBBCp-42, 0x1.3A6FBBBBBBBBCp-42,
+		  0x1.A067777777777p-43, 0x1.F8DE444444444p-44, 0x1.33C0F77777777p-45, 0x1.2CFBD55555555p-48, 0x1.4A464CCCCCCCDp-53, 0x1.CA3C088888889p-62 },
+		{ 0x1.5B62000000000p-47, 0x1.90BFDDDDDDDDEp-44, 0x1.1BCFDDDDDDDDEp-42, 0x1.2411DDDDDDDDEp-41, 0x1.0493333333333p-40, 0x1.C025777777777p-40,
+		  0x1.609AAAAAAAAABp-42, 0x1.39D4444444444p-43, 0x1.ECDC888888889p-46, 0x1.1820444444444p-49, 0x1.58B199999999Ap-55, 0x1.2E3A000000000p-63 },
+		{ -0x1.E100000000000p-50, -0x1.14B999999999Ap-46, -0x1.8ACAAAAAAAAABp-45, -0x1.92FDDDDDDDDDEp-44, -0x1.663EEEEEEEEEFp-43, -0x1.332999999999Ap-42,
+		  -0x1.F05DDDDDDDDDEp-45, -0x1.C74AAAAAAAAABp-46, -0x1.6AB0000000000p-48, -0x1.C446666666666p-52, -0x1.3B6AAAAAAAAABp-57, -0x1.3E03333333333p-65 },
+		{ -0x1.9E92222222222p-49, -0x1.DCEDDDDDDDDDEp-46, -0x1.50EBBBBBBBBBCp-44, -0x1.5865555555555p-43, -0x1.2EDAAAAAAAAABp-42, -0x1.F458888888889p-42,
+		  -0x1.ABA7777777777p-44, -0x1.821999999999Ap-45, -0x1.36F3333333333p-47, -0x1.748AAAAAAAAABp-51, -0x1.FAC8888888889p-57, -0x1.86C0000000000p-65 }
+	},
+	{
+		{ 0x1.549AA363960D9p-9, 0x1.834F56A1872ECp-6, 0x1.132458F323D82p-4, 0x1.180B7F60285F5p-3, 0x1.EBBF8C10B25F5p-3, 0x1.97B63C7164376p-2,
+		  0x1.7AD4CF031DD90p-4, 0x1.5A2C4C3480F10p-5, 0x1.1254ED9A01C34p-7, 0x1.4C2887C19E2E7p-11, 0x1.D2B152FC79DA3p-17, 0x1.7278935556F1Ep-25 },
+		{ -0x1.1ED0F46D2B813p-13, -0x1.462569FF315ACp-10, -0x1.CF61FEA1D823Bp-9, -0x1.D7A391643EBB8p-8, -0x1.9E1691C8D4BD8p-7, -0x1.5751E8EFC49D2p-6,
+		  -0x1.3F02279C685F1p-9, -0x1.238541E25DF93p-10, -0x1.CE16B04D8C064p-13, -0x1.17CBE83C88E46p-16, -0x1.894023D3BBF77p-22, -0x1.3863F331491B9p-30 },
+		{ 0x1.E2E29F5771399p-18, 0x1.128C660204219p-14, 0x1.861111451A95Cp-13, 0x1.8D00EDB0C0A5Fp-12, 0x1.5C8A09B79F932p-11, 0x1.20EF4C605E997p-10,
+		  0x1.92CE1835587B7p-14, 0x1.705E51FA38AE0p-15, 0x1.246D40CF59258p-17, 0x1.632CFFD896595p-21, 0x1.F5E0DF269D13Dp-27, 0x1.935F3AAA8FF84p-35 },
+		{ -0x1.9573BBC0F5CD7p-22, -0x1.CD03C0670A85Ap-19, -0x1.4771E4CFD6CE6p-17, -0x1.4D2CD327F5DD5p-16, -0x1.2459BBCBF673Bp-15, -0x1.E42261F7A50AEp-15,
+		  -0x1.19A580A2F8CC6p-18, -0x1.0362A93ABD734p-19, -0x1.A236DBC7D91E1p-22, -0x1.050289E12BA60p-25, -0x1.830545C0162D6p-31, -0x1.57642399FCCCDp-39 },
+		{ 0x1.4F87893AE9200p-26, 0x1.7D5821FB7CF89p-23, 0x1.0E983E7EBF7BCp-21, 0x1.12D690DF7B9DEp-20, 0x1.E0B24EBE08911p-20, 0x1.8ADBD9190CCABp-19,
+		  0x1.95211B9EBDEEFp-23, 0x1.86C65CBEE6622p-24, 0x1.59FC95B859155p-26, 0x1.F36B240534EEFp-30, 0x1.C87365B6C62EFp-35, 0x1.1582FC6C907DEp-42 },
+		{ -0x1.03FD9A78F1111p-30, -0x1.26CFB77E64889p-27, -0x1.A0384F3D5AAABp-26, -0x1.A2A8694ED3BBCp-25, -0x1.67400F736BBBCp-24, -0x1.1951BE60B6AABp-23,
+		  -0x1.0E273814FAAABp-27, -0x1.47BB0896CAAABp-28, -0x1.93032BDAA2222p-30, -0x1.940931CD7199Ap-33, -0x1.F0B2ABAF9EEEFp-38, -0x1.8CE092539A000p-45 },
+		{ 0x1.2D41BDC15DDDEp-35, 0x1.50DDE97755555p-32, 0x1.CC65834E22222p-31, 0x1.B1FF2F1EEEEEFp-30, 0x1.424A080C2AAABp-29, 0x1.253327C8DDDDEp-29,
+		  0x1.91DA8BA377777p-33, 0x1.58F619FB22222p-32, 0x1.6A0ECB4ED1111p-33, 0x1.D94074CB15555p-36, 0x1.5208BDF8C2222p-40, 0x1.2D0E30CF56EEFp-47 },
+		{ 0x1.3875C1AAAAAABp-41, 0x1.A3997B0888889p-38, 0x1.9153F48000000p-36, 0x1.2F4FB09555555p-34, 0x1.B5B6404444444p-33, 0x1.6C974D1BBBBBCp-31,
+		  0x1.5C6A585555555p-36, -0x1.E06CF64CCCCCDp-36, -0x1.7DA43A2888889p-36, -0x1.16EB9E8FBBBBCp-38, -0x1.A5C07BA400000p-43, -0x1.8CB691249999Ap-50 },
+		{ -0x1.5551D72222222p-42, -0x1.9733148888889p-39, -0x1.3F7B640000000p-37, -0x1.8022573333333p-36, -0x1.B9A09FD555555p-35, -0x1.2C6B281555555p-33,
+		  -0x1.154C206666666p-38, 0x1.8B1CAE4444444p-39, 0x1.733B7EE222222p-39, 0x1.1A5DE52CCCCCDp-41, 0x1.B85EE91BBBBBCp-46, 0x1.B3FA19E6EEEEFp-53 },
+		{ 0x1.25354DDDDDDDEp-45, 0x1.5F10011111111p-42, 0x1.16B6FD5555555p-40, 0x1.5574708888889p-39, 0x1.95B1CBBBBBBBCp-38, 0x1.27A65F3333333p-36,
+		  0x1.6217AAAAAAAABp-43, -0x1.AAD9ACCCCCCCDp-42, -0x1.3D8BBD999999Ap-42, -0x1.D5B5BC4444444p-45, -0x1.7458D38888889p-49, -0x1.891E08BBBBBBCp-56 },
+		{ -0x1.065C200000000p-46, -0x1.25C9FBBBBBBBCp-43, -0x1.B094800000000p-42, -0x1.CBEA777777777p-41, -0x1.C020F11111111p-40, -0x1.E844C22222222p-39,
+		  -0x1.CCA4044444444p-42, -0x1.5FE9733333333p-43, -0x1.229CD11111111p-46, 0x1.FA16333333333p-51, 0x1.36ABA44444444p-53, 0x1.ECB8C1999999Ap-60 },
+		{ 0x1.B07C222222222p-48, 0x1.EE7C666666666p-45, 0x1.6025666666666p-43, 0x1.69F2BBBBBBBBCp-42, 0x1.449FDDDDDDDDEp-41, 0x1.2301444444444p-40,
+		  0x1.CEB9555555555p-43, 0x1.A432444444444p-44, 0x1.4A17222222222p-46, 0x1.7C26222222222p-50, 0x1.C0CF111111111p-56, -0x1.C58CCCCCCCCCDp-67 },
+		{ 0x1.392CEEEEEEEEFp-47, 0x1.5887DDDDDDDDEp-44, 0x1.EF70888888889p-43, 0x1.F38CCCCCCCCCDp-42, 0x1.B70BDDDDDDDDEp-41, 0x1.6ABD777777777p-40,
+		  0x1.4C5A444444444p-42, 0x1.2D78444444444p-43, 0x1.D0A7DDDDDDDDEp-46, 0x1.24B7DDDDDDDDEp-49, 0x1.925CCCCCCCCCDp-55, 0x1.49EA888888889p-63 },
+		{ -0x1.B0BDDDDDDDDDEp-50, -0x1.EE97777777777p-47, -0x1.5EA5555555555p-45, -0x1.6543333333333p-44, -0x1.39B999999999Ap-43, -0x1.040BBBBBBBBBCp-42,
+		  -0x1.D8CCCCCCCCCCDp-45, -0x1.AD6CCCCCCCCCDp-46, -0x1.540999999999Ap-48, -0x1.95E2222222222p-52, -0x1.1D43333333333p-57, -0x1.BF80000000000p-66 },
+		{ -0x1.7D3AAAAAAAAABp-49, -0x1.A413333333333p-46, -0x1.2DE4444444444p-44, -0x1.309999999999Ap-43, -0x1.0BD3BBBBBBBBCp-42, -0x1.BC58888888889p-42,
+		  -0x1.954999999999Ap-44, -0x1.7094444444444p-45, -0x1.1D6D555555555p-47, -0x1.68F2222222222p-51, -0x1.F428888888889p-57, -0x1.911EEEEEEEEEFp-65 }
+	},
+	{
+		{ 0x1.342A784C3A8BDp-9, 0x1.5E6C7337DC9A1p-6, 0x1.F1E064089D72Ap-5, 0x1.FABFA0ED57D8Bp-4, 0x1.BCEA69A304F58p-3, 0x1.70E1FE7A73392p-2,
+		  0x1.6857303F06BEDp-4, 0x1.4946AEE7420D0p-5, 0x1.04F0E2FE2787Dp-7, 0x1.3BF1A01827E13p-11, 0x1.BBE881A33FDD9p-17, 0x1.60613921DF7ADp-25 },
+		{ -0x1.D595CC3BC7134p-14, -0x1.0AFD2642C79F8p-10, -0x1.7B556A480E07Dp-9, -0x1.8217DCCB3FB90p-8, -0x1.52FB82F02168Fp-7, -0x1.190D7994EEA73p-6,
+		  -0x1.128B741337BF9p-9, -0x1.F5C13F580746Ep-11, -0x1.8DA0BA201D033p-13, -0x1.E172DDD05CEF2p-17, -0x1.523B193C8CBF2p-22, -0x1.0C8125D21F4D1p-30 },
+		{ 0x1.65C4A697E15F1p-18, 0x1.96D3D201923D2p-15, 0x1.2101B4B8F6611p-13, 0x1.2627EA43F67E3p-12, 0x1.02431C09774C5p-11, 0x1.AC3FF110069CBp-11,
+		  0x1.39C155CCDF600p-14, 0x1.1EB9D5E537385p-15, 0x1.C68259283D196p-18, 0x1.133A965A9F9C9p-21, 0x1.82E2265C19EEBp-27, 0x1.3369E92BA9F93p-35 },
+		{ -0x1.1081396505B97p-22, -0x1.35DECCF3D0FC3p-19, -0x1.B8409ABEFD013p-18, -0x1.C015DC8880231p-17, -0x1.896429B62C560p-16, -0x1.46210F86D0F48p-15,
+		  -0x1.8E45CB0D555BCp-19, -0x1.6C3932FC34009p-20, -0x1.2122457D886DBp-22, -0x1.5F294D87D6331p-26, -0x1.F01F868274195p-32, -0x1.8E72BD23D28BAp-40 },
+		{ 0x1.9E61392385644p-27, 0x1.D72D7ADC17CEFp-24, 0x1.4EAEAD9268755p-22, 0x1.54933F8E46155p-21, 0x1.2AE7A2EC399BCp-20, 0x1.EF3C53A63AAABp-20,
+		  0x1.08BDE14E900CDp-23, 0x1.E6F7D4B975A22p-25, 0x1.8762FEEDF7F77p-27, 0x1.E5D6F7B0D5555p-31, 0x1.6488C35752DDEp-36, 0x1.352C66DD25C00p-44 },
+		{ -0x1.3815CECED5555p-31, -0x1.62C4976A0BBBCp-28, -0x1.F7B1CCC39EEEFp-27, -0x1.0001F6EFB4889p-25, -0x1.C07B74A7E4444p-25, -0x1.71E2E9110EEEFp-24,
+		  -0x1.64B999C9BBBBCp-28, -0x1.5367918AC8889p-29, -0x1.248B01A7D6666p-31, -0x1.95E7CF52CCCCDp-35, -0x1.5F9F36B252222p-40, -0x1.8B6B3EB3C5555p-48 },
+		{ 0x1.C2D393C29999Ap-36, 0x1.FFCEEB0933333p-33, 0x1.6A421EC0A2222p-31, 0x1.6E3FA7E7BBBBCp-30, 0x1.3D8977F766666p-29, 0x1.FF5E883466666p-29,
+		  0x1.C7F75A8A22222p-33, 0x1.FE2FB399DDDDEp-34, 0x1.1C7DA763EEEEFp-35, 0x1.070C99C355555p-38, 0x1.2ED3CBA244444p-43, 0x1.C363A08FCCCCDp-51 },
+		{ -0x1.1084ABD555555p-40, -0x1.333EC4B777777p-37, -0x1.AC3BFFD555555p-36, -0x1.A44EB14444444p-35, -0x1.575A3E2AAAAABp-34, -0x1.D616E8CCCCCCDp-34,
+		  -0x1.905F464444444p-38, -0x1.C5300D4444444p-38, -0x1.A256537777777p-39, -0x1.034938E000000p-41, -0x1.64B4DD3333333p-46, -0x1.2DA5D49911111p-53 },
+		{ 0x1.26310DDDDDDDEp-46, 0x1.30D4666666666p-43, 0x1.5A9B611111111p-42, 0x1.7106F77777777p-42, -0x1.D6C86EEEEEEEFp-42, -0x1.46ED7DDDDDDDEp-38,
+		  0x1.76E1DDDDDDDDEp-46, 0x1.4E16A6EEEEEEFp-41, 0x1.A715AE4444444p-42, 0x1.236943DDDDDDEp-44, 0x1.A6C6437777777p-49, 0x1.7611B0C444444p-56 },
+		{ -0x1.17D7AAAAAAAABp-48, -0x1.3672E66666666p-45, -0x1.8118444444444p-44, -0x1.2ACAAAAAAAAABp-43, -0x1.7C83333333333p-44, 0x1.01A33BBBBBBBCp-41,
+		  -0x1.FA11444444444p-43, -0x1.8FBA888888889p-43, -0x1.35D91EEEEEEEFp-44, -0x1.639AE33333333p-47, -0x1.E39D7CCCCCCCDp-52, -0x1.A36EBF3333333p-59 },
+		{ -0x1.78EA7BBBBBBBCp-47, -0x1.A81D2AAAAAAABp-44, -0x1.31F2C22222222p-42, -0x1.3878666666666p-41, -0x1.17A47BBBBBBBCp-40, -0x1.E64F222222222p-40,
+		  -0x1.982FC44444444p-42, -0x1.664EC00000000p-43, -0x1.E8DDA66666666p-46, -0x1.CB86CCCCCCCCDp-50, -0x1.ABB4000000000p-57, 0x1.5DC84CCCCCCCDp-63 },
+		{ 0x1.7F6A222222222p-48, 0x1.B9AE000000000p-45, 0x1.3834888888889p-43, 0x1.3F9C888888889p-42, 0x1.189C000000000p-41, 0x1.D7A7DDDDDDDDEp-41,
+		  0x1.B490888888889p-43, 0x1.8C8AAAAAAAAABp-44, 0x1.38DF000000000p-46, 0x1.61FECCCCCCCCDp-50, 0x1.E47B777777777p-56, 0x1.21ADBBBBBBBBCp-64 },
+		{ 0x1.1428000000000p-47, 0x1.3617DDDDDDDDEp-44, 0x1.BD15777777777p-43, 0x1.C208000000000p-42, 0x1.8B38888888889p-41, 0x1.4785555555555p-40,
+		  0x1.37D4EEEEEEEEFp-42, 0x1.1F96222222222p-43, 0x1.BD86000000000p-46, 0x1.14A6666666666p-49, 0x1.8002AAAAAAAABp-55, 0x1.32F8EEEEEEEEFp-63 },
+		{ -0x1.825DDDDDDDDDEp-50, -0x1.BD1BBBBBBBBBCp-47, -0x1.3A1999999999Ap-45, -0x1.4117777777777p-44, -0x1.188CCCCCCCCCDp-43, -0x1.D257777777777p-43,
+		  -0x1.BBC8888888889p-45, -0x1.9684444444444p-46, -0x1.4741111111111p-48, -0x1.7F0EEEEEEEEEFp-52, -0x1.1C80000000000p-57, -0x1.BCC6666666666p-66 },
+		{ -0x1.5141111111111p-49, -0x1.7B0EEEEEEEEEFp-46, -0x1.0FDD555555555p-44, -0x1.12FBBBBBBBBBCp-43, -0x1.E32CCCCCCCCCDp-43, -0x1.90B3333333333p-42,
+		  -0x1.7CE0000000000p-44, -0x1.5F12222222222p-45, -0x1.1003BBBBBBBBCp-47, -0x1.5122222222222p-51, -0x1.D215555555555p-57, -0x1.70A0000000000p-65 }
+	},
+	{
+		{ 0x1.195E6F0F3A3C6p-9, 0x1.3FF3B8875280Ap-6, 0x1.C6953C09C030Ep-5, 0x1.CEAEF963368CBp-4, 0x1.963A362997086p-3, 0x1.50CE59E728EC0p-2,
+		  0x1.58513E363ABBAp-4, 0x1.3AA25B5282DB5p-5, 0x1.F2ACE59E30D52p-8, 0x1.2DE50AE6DBB0Ap-11, 0x1.A82B3009CE94Ep-17, 0x1.50B5C60EBD193p-25 },
+		{ -0x1.87783E1CC5C57p-14, -0x1.BD268D8A6A891p-11, -0x1.3C3B4849B93BBp-9, -0x1.41DDE207A832Bp-8, -0x1.1A97C99D35542p-7, -0x1.D499823ABD2A8p-7,
+		  -0x1.DF0CD8CD434A1p-10, -0x1.B5C081F3CD610p-11, -0x1.5AE7A127666D5p-13, -0x1.A407291CF6654p-17, -0x1.27131E9BA2AC8p-22, -0x1.D477FF803763Ep-31 },
+		{ 0x1.10537E57D3829p-18, 0x1.35AB5659412D0p-15, 0x1.B7F92C830D9BBp-14, 0x1.BFD03F6B789C7p-13, 0x1.892BF2C14F3B8p-12, 0x1.45FB35052FAFAp-11,
+		  0x1.F3E095C445B33p-15, 0x1.C8C92342AE195p-16, 0x1.69FDF5FA4AD91p-18, 0x1.B64D999178711p-22, 0x1.33EC36A7F8A93p-27, 0x1.E8E5ADF516873p-36 },
+		{ -0x1.7AE11B964D5DAp-23, -0x1.AED562B1BC1F6p-20, -0x1.320F7D63CD58Fp-18, -0x1.3783894E3629Ap-17, -0x1.118097975B36Bp-16, -0x1.C585B1EDFF730p-16,
+		  -0x1.21C66CDFECDD1p-19, -0x1.08CF9CB832BB5p-20, -0x1.A3C48E3016CDCp-23, -0x1.FC6040A78069Ep-27, -0x1.654BF6A466FE0p-32, -0x1.1BE19A6D3A15Cp-40 },
+		{ 0x1.07840C84E5BDEp-27, 0x1.2BA6475B8BCCDp-24, 0x1.A9BBBD6402555p-23, 0x1.B14FF7E858333p-22, 0x1.7C6DB0B2852EFp-21, 0x1.3B6557E81D066p-20,
+		  0x1.60ABC6203AD55p-24, 0x1.4276E3B076800p-25, 0x1.FFC51AED67EEFp-28, 0x1.368F1C4C045DEp-31, 0x1.B62DA197C9333p-37, 0x1.5ED91D2FFF889p-45 },
+		{ -0x1.6E29F5DCC7777p-32, -0x1.A05CB3DF15555p-29, -0x1.27C2C14D93BBCp-27, -0x1.2CFEC873F1111p-26, -0x1.08362FA9ED555p-25, -0x1.B5EBE1D5BEEEFp-25,
+		  -0x1.B8BF5C6748889p-29, -0x1.948AD3FD7BBBCp-30, -0x1.43B5364E0EEEFp-32, -0x1.8EB0D51FACCCDp-36, -0x1.208CC17E9BBBCp-41, -0x1.E64D121415555p-50 },
+		{ 0x1.F9F40BB755555p-37, 0x1.1F9DCCB1DDDDEp-33, 0x1.987C4CD4CCCCDp-32, 0x1.9F7AD3CA11111p-31, 0x1.6C54D616AAAABp-30, 0x1.2D44007677777p-29,
+		  0x1.15C9FD9AAAAABp-33, 0x1.048461FE66666p-34, 0x1.B439593088889p-37, 0x1.216791E444444p-40, 0x1.D6A2D260CCCCDp-46, 0x1.E1C4F99488889p-54 },
+		{ -0x1.529CC10888889p-41, -0x1.80B553BBBBBBCp-38, -0x1.10C6AE8000000p-36, -0x1.14AF84C444444p-35, -0x1.E2C8EDD555555p-35, -0x1.8AC18D1111111p-34,
+		  -0x1.469216EEEEEEFp-38, -0x1.54220D3333333p-39, -0x1.56C3EE2222222p-41, -0x1.1F41950000000p-44, -0x1.2FB23D999999Ap-49, -0x1.A0076E5DDDDDEp-57 },
+		{ 0x1.041441999999Ap-45, 0x1.2753033333333p-42, 0x1.A051F77777777p-41, 0x1.A217D08888889p-40, 0x1.666E9BBBBBBBCp-39, 0x1.18AF44CCCCCCDp-38,
+		  0x1.A0FB2EEEEEEEFp-42, 0x1.EB65EEEEEEEEFp-43, 0x1.22DD944444444p-44, 0x1.1D906BBBBBBBCp-47, 0x1.51C8B5999999Ap-52, 0x1.FFCB8C8888889p-60 },
+		{ -0x1.1810C66666666p-47, -0x1.3EC7AEEEEEEEFp-44, -0x1.C2BE777777777p-43, -0x1.C688DDDDDDDDEp-42, -0x1.8A7FFBBBBBBBCp-41, -0x1.3C4C266666666p-40,
+		  -0x1.363119999999Ap-42, -0x1.2DCD7BBBBBBBCp-43, -0x1.0A107DDDDDDDEp-45, -0x1.86BEC00000000p-49, -0x1.5FA9ACCCCCCCDp-54, -0x1.AB509BBBBBBBCp-62 },
+		{ -0x1.3E2BD11111111p-47, -0x1.6CC7A22222222p-44, -0x1.0293444444444p-42, -0x1.06EAB9999999Ap-41, -0x1.CFA899999999Ap-41, -0x1.816AA66666666p-40,
+		  -0x1.81B94CCCCCCCDp-42, -0x1.5C27AAAAAAAABp-43, -0x1.0A57844444444p-45, -0x1.44E6D55555555p-49, -0x1.A41FC00000000p-55, -0x1.2D9E377777777p-63 },
+		{ 0x1.5A77444444444p-48, 0x1.8BB7555555555p-45, 0x1.18E5111111111p-43, 0x1.1D58888888889p-42, 0x1.F6E1333333333p-42, 0x1.A121BBBBBBBBCp-41,
+		  0x1.9DDD111111111p-43, 0x1.7D91BBBBBBBBCp-44, 0x1.2AF4777777777p-46, 0x1.7154666666666p-50, 0x1.F402444444444p-56, 0x1.87EE444444444p-64 },
+		{ 0x1.EFFD555555555p-48, 0x1.1C0EAAAAAAAABp-44, 0x1.92BBBBBBBBBBCp-43, 0x1.991399999999Ap-42, 0x1.67E599999999Ap-41, 0x1.2A0E222222222p-40,
+		  0x1.2CD8666666666p-42, 0x1.1120666666666p-43, 0x1.A82BBBBBBBBBCp-46, 0x1.085F111111111p-49, 0x1.69E1BBBBBBBBCp-55, 0x1.2476CCCCCCCCDp-63 },
+		{ -0x1.60ADDDDDDDDDEp-50, -0x1.9368888888889p-47, -0x1.1E42222222222p-45, -0x1.22A2222222222p-44, -0x1.0021111111111p-43, -0x1.A882222222222p-43,
+		  -0x1.A5B3333333333p-45, -0x1.8653333333333p-46, -0x1.31FAAAAAAAAABp-48, -0x1.7D9DDDDDDDDDEp-52, -0x1.03DAAAAAAAAABp-57, -0x1.A17999999999Ap-66 },
+		{ -0x1.2EEBBBBBBBBBCp-49, -0x1.5AD3333333333p-46, -0x1.EBE6666666666p-45, -0x1.F3A5555555555p-44, -0x1.B76AAAAAAAAABp-43, -0x1.6C07777777777p-42,
+		  -0x1.6F46666666666p-44, -0x1.4D6EEEEEEEEEFp-45, -0x1.0336666666666p-47, -0x1.424EEEEEEEEEFp-51, -0x1.BAE7777777777p-57, -0x1.64A3333333333p-65 }
+	},
+	{
+		{ 0x1.02DBFFD63B27Fp-9, 0x1.265B1A7A69648p-6, 0x1.A237604D095F1p-5, 0x1.A9AB37789AE5Ep-4, 0x1.75BAACD209455p-3, 0x1.35DC904291FF6p-2,
+		  0x1.4A41F277D72ACp-4, 0x1.2DC959EA0CF58p-5, 0x1.DE5007A2DCD5Cp-8, 0x1.2191351246AB1p-11, 0x1.96D92AE4DB098p-17, 0x1.42F5FE65535DAp-25 },
+		{ -0x1.4B5709DF932B5p-14, -0x1.78C6881C13F25p-11, -0x1.0BA88F6B23B36p-9, -0x1.106D93FF3AF40p-8, -0x1.DE5F954084967p-8, -0x1.8C9F70B3D78B8p-7,
+		  -0x1.A6BACFCBFD07Dp-10, -0x1.824968FE0C206p-11, -0x1.321EBDD1F75A0p-13, -0x1.72A56473DA53Bp-17, -0x1.046209841DBFAp-22, -0x1.9D63DCFCA2FA9p-31 },
+		{ 0x1.A81D797582622p-19, 0x1.E245C88676DBEp-16, 0x1.569A4DED44196p-14, 0x1.5CB534CEFB801p-13, 0x1.3228AE0E61C8Dp-12, 0x1.FBAD567158CA1p-12,
+		  0x1.95D20B4978F08p-15, 0x1.72D5D8D297C83p-16, 0x1.25E0210888231p-18, 0x1.63D22523A2596p-22, 0x1.F3EFE88712FE2p-28, 0x1.8CDB80ACBB9E9p-36 },
+		{ -0x1.0F6EE7874D819p-23, -0x1.34A76744E9FD1p-20, -0x1.B687DDD0955AFp-19, -0x1.BE585D43D3F83p-18, -0x1.87E1F0068F6F7p-17, -0x1.44E99B666A9B9p-16,
+		  -0x1.B0DFCECB16B8Dp-20, -0x1.8B8EFA52FFB5Ap-21, -0x1.3978815FB364Dp-23, -0x1.7B8D7A9D02EE4p-27, -0x1.0AA5DC212D206p-32, -0x1.A75C8ACEFB56Bp-41 },
+		{ 0x1.5B6DD4D4805DEp-28, 0x1.8B1216C6BFB33p-25, 0x1.18A7ACA04D044p-23, 0x1.1DA7E4714A800p-22, 0x1.F5998D79F3AABp-22, 0x1.9FE0D5A28419Ap-21,
+		  0x1.E4CEF12DAE333p-25, 0x1.BB08FC33AA444p-26, 0x1.5F20DF885C333p-28, 0x1.A938773317777p-32, 0x1.2AD1A161B7000p-37, 0x1.DAB81963CC111p-46 },
+		{ -0x1.BCA943D896666p-33, -0x1.F9A2835A84444p-30, -0x1.67327A63F999Ap-28, -0x1.6D983402E8889p-27, -0x1.40FAD44F57777p-26, -0x1.0A1E22436AAABp-25,
+		  -0x1.17356045A6666p-29, -0x1.FE7AE95911111p-31, -0x1.94E47898C8889p-33, -0x1.EAFE2B5C2AAABp-37, -0x1.59DB5DC548889p-42, -0x1.140903EF15555p-50 },
+		{ 0x1.1C5377F0EEEEFp-37, 0x1.434ED8D0AAAABp-34, 0x1.CB561BAACCCCDp-33, 0x1.D37E2B0022222p-32, 0x1.9A67D48D33333p-31, 0x1.5431F4D177777p-30,
+		  0x1.46EDF8FCCCCCDp-34, 0x1.2B89BEC555555p-35, 0x1.DD82737A22222p-38, 0x1.240B571222222p-41, 0x1.A1ADA4C111111p-47, 0x1.57768DA888889p-55 },
+		{ -0x1.65611B0000000p-42, -0x1.965C514444444p-39, -0x1.20A2AA6666666p-37, -0x1.25A9CE1111111p-36, -0x1.01AFFFB333333p-35, -0x1.AAC20E3333333p-35,
+		  -0x1.67D3B2EEEEEEFp-39, -0x1.4E4DA62222222p-40, -0x1.11C4B1999999Ap-42, -0x1.5FCDEEEEEEEEFp-46, -0x1.0F4BBE6666666p-51, -0x1.FFE44A2222222p-60 },
+		{ 0x1.3E75A55555555p-46, 0x1.6C914DDDDDDDEp-43, 0x1.0231291111111p-41, 0x1.06B94E6666666p-40, 0x1.CCAF7CCCCCCCDp-40, 0x1.7C442BBBBBBBCp-39,
+		  0x1.5418622222222p-42, 0x1.414EE22222222p-43, 0x1.0CDDE55555555p-45, 0x1.6443FBBBBBBBCp-49, 0x1.1C2DECCCCCCCDp-54, 0x1.1E54B11111111p-62 },
+		{ -0x1.FFCC844444444p-48, -0x1.22DB555555555p-44, -0x1.9BA9EEEEEEEEFp-43, -0x1.A482C88888889p-42, -0x1.6FAD19999999Ap-41, -0x1.30AD1DDDDDDDEp-40,
+		  -0x1.2DFFF33333333p-42, -0x1.1260377777777p-43, -0x1.BEE6BBBBBBBBCp-46, -0x1.0AF96CCCCCCCDp-49, -0x1.8CDD955555555p-55, -0x1.4706400000000p-63 },
+		{ -0x1.1CE9733333333p-47, -0x1.4BD559999999Ap-44, -0x1.D4458CCCCCCCDp-43, -0x1.DDD8733333333p-42, -0x1.A4446AAAAAAABp-41, -0x1.5C88844444444p-40,
+		  -0x1.693B111111111p-42, -0x1.4E8CC44444444p-43, -0x1.0A3FECCCCCCCDp-45, -0x1.44CB5DDDDDDDEp-49, -0x1.C3D7D55555555p-55, -0x1.67CE000000000p-63 },
+		{ 0x1.3F19000000000p-48, 0x1.6B20888888889p-45, 0x1.00D8444444444p-43, 0x1.06C5CCCCCCCCDp-42, 0x1.CB8AAAAAAAAABp-42, 0x1.7DA3DDDDDDDDEp-41,
+		  0x1.8EED777777777p-43, 0x1.6883DDDDDDDDEp-44, 0x1.23D0000000000p-46, 0x1.5487AAAAAAAABp-50, 0x1.EE95BBBBBBBBCp-56, 0x1.7CFF99999999Ap-64 },
+		{ 0x1.BE46AAAAAAAABp-48, 0x1.03BF555555555p-44, 0x1.6EFB99999999Ap-43, 0x1.764F555555555p-42, 0x1.4906888888889p-41, 0x1.10DD777777777p-40,
+		  0x1.1AA4666666666p-42, 0x1.05B4444444444p-43, 0x1.A07F111111111p-46, 0x1.FBF4CCCCCCCCDp-50, 0x1.6394CCCCCCCCDp-55, 0x1.1C41333333333p-63 },
+		{ -0x1.4594444444444p-50, -0x1.72E2222222222p-47, -0x1.0626666666666p-45, -0x1.0C74444444444p-44, -0x1.D51DDDDDDDDDEp-44, -0x1.85ACCCCCCCCCDp-43,
+		  -0x1.9728888888889p-45, -0x1.6F93333333333p-46, -0x1.2ABDDDDDDDDDEp-48, -0x1.5A52222222222p-52, -0x1.FA75555555555p-58, -0x1.84ACCCCCCCCCDp-66 },
+		{ -0x1.1083333333333p-49, -0x1.3D1AAAAAAAAABp-46, -0x1.C070000000000p-45, -0x1.C93EEEEEEEEEFp-44, -0x1.91CDDDDDDDDDEp-43, -0x1.4D47777777777p-42,
+		  -0x1.596AAAAAAAAABp-44, -0x1.3F9BBBBBBBBBCp-45, -0x1.FC2999999999Ap-48, -0x1.3564444444444p-51, -0x1.B1FDDDDDDDDDEp-57, -0x1.5A08888888889p-65 }
+	},
+	{
+		{ 0x1.DF5E8471BDF6Fp-10, 0x1.108D3E723054Ep-6, 0x1.833CC177FA821p-5, 0x1.8A234654900F3p-4, 0x1.5A0BA98163E4Cp-3, 0x1.1EE8AB814026Cp-2,
+		  0x1.3DCA60259E04Ep-4, 0x1.2264EBBE7664Ap-5, 0x1.CC41ABED95E93p-8, 0x1.16A2DCE8BA5CEp-11, 0x1.877D6E98F5E48p-17, 0x1.36C4EFAF87E93p-25 },
+		{ -0x1.1C121596FF1DBp-14, -0x1.4306370A115BBp-11, -0x1.CAF2AC6553921p-10, -0x1.D320535794EC4p-9, -0x1.9A20C8E22FC09p-8, -0x1.540A468355CF8p-7,
+		  -0x1.78A4002AB9A6Ap-10, -0x1.582BC212C656Ap-11, -0x1.10BE9ECCB1ABAp-13, -0x1.4A3C4844C7ECAp-17, -0x1.CFFCF514B662Fp-23, -0x1.7051B41FAB48Bp-31 },
+		{ 0x1.50AD22E67758Ap-19, 0x1.7ED7F52F42DA6p-16, 0x1.0FF81A2A50C4Ap-14, 0x1.14D0C8F008D0Cp-13, 0x1.E613E44ED822Ep-13, 0x1.9302B21A3B79Dp-12,
+		  0x1.4ECAAAA2DB320p-15, 0x1.31EE01FFD0605p-16, 0x1.E4E11BA827F97p-19, 0x1.258AECE0AC338p-22, 0x1.9C6F1847BFC96p-28, 0x1.47651A836572Ap-36 },
+		{ -0x1.8F06138E43BC0p-24, -0x1.C5BD91150F81Ap-21, -0x1.425571EEFF429p-19, -0x1.4813E2138025Cp-18, -0x1.200BC72ECF89Cp-17, -0x1.DDA45C86973D3p-17,
+		  -0x1.4AA88C2D98180p-20, -0x1.2E2720CEF90FCp-21, -0x1.DEE4BC06C1A1Ap-24, -0x1.21EB4F7191457p-27, -0x1.9757F3C8463C4p-33, -0x1.435AECF105FEFp-41 },
+		{ 0x1.D8EAA2050219Ap-29, 0x1.0CE20AA835733p-25, 0x1.7E0658EB2B800p-24, 0x1.84D5147FDF99Ap-23, 0x1.55632E7A2FB33p-22, 0x1.1B0BF51C1D9DEp-21,
+		  0x1.56E79053B3000p-25, 0x1.39581FC753666p-26, 0x1.F0A26B14A1333p-29, 0x1.2CA9B5A2FFDDEp-32, 0x1.A6727C1FD1333p-38, 0x1.4F5B90B7C699Ap-46 },
+		{ -0x1.183F65FACCCCDp-33, -0x1.3EAD4F36E1111p-30, -0x1.C4C56DE9C8889p-29, -0x1.CCD6D48E37777p-28, -0x1.949B8FCD7DDDEp-27, -0x1.4F765F62F5555p-26,
+		  -0x1.6DC6EAF8E6666p-30, -0x1.4E410CD5C8889p-31, -0x1.08E7511495555p-33, -0x1.40C76CF1EEEEFp-37, -0x1.C2CADE1944444p-43, -0x1.65FC57C2EEEEFp-51 },
+		{ 0x1.4C0353C0AAAABp-38, 0x1.798AC8AE88889p-35, 0x1.0C33C403BBBBCp-33, 0x1.10FB01719999Ap-32, 0x1.DF5721AFBBBBCp-32, 0x1.8D6AF10066666p-31,
+		  0x1.8CC6200666666p-35, 0x1.6AA7E77111111p-36, 0x1.1F89666D55555p-38, 0x1.5C74CB119999Ap-42, 0x1.EA4BB71444444p-48, 0x1.866211699999Ap-56 },
+		{ -0x1.7F9E564444444p-43, -0x1.B4444F3333333p-40, -0x1.35ED36DDDDDDEp-38, -0x1.3B6D131111111p-37, -0x1.14EDCD1111111p-36, -0x1.CB28A1BBBBBBCp-36,
+		  -0x1.81E686EEEEEEFp-40, -0x1.613A99999999Ap-41, -0x1.18B9988888889p-43, -0x1.566FA80000000p-47, -0x1.E60462AAAAAABp-53, -0x1.8A5A1AAAAAAABp-61 },
+		{ 0x1.94EAA9999999Ap-47, 0x1.CA33C11111111p-44, 0x1.45AEBDDDDDDDEp-42, 0x1.4B2B9BBBBBBBCp-41, 0x1.22218BBBBBBBCp-40, 0x1.E196EDDDDDDDEp-40,
+		  0x1.19B8AAAAAAAABp-42, 0x1.001C2AAAAAAABp-43, 0x1.982C022222222p-46, 0x1.EC54933333333p-50, 0x1.6B22D77777777p-55, 0x1.2184DBBBBBBBCp-63 },
+		{ -0x1.CBB3666666666p-48, -0x1.03B6E66666666p-44, -0x1.708F111111111p-43, -0x1.77C95DDDDDDDEp-42, -0x1.49A1800000000p-41, -0x1.115BC88888889p-40,
+		  -0x1.1FD9BBBBBBBBCp-42, -0x1.070D0CCCCCCCDp-43, -0x1.A3404CCCCCCCDp-46, -0x1.F6FD59999999Ap-50, -0x1.6444BBBBBBBBCp-55, -0x1.198B3BBBBBBBCp-63 },
+		{ -0x1.10057DDDDDDDEp-47, -0x1.3295F11111111p-44, -0x1.B43C2AAAAAAABp-43, -0x1.BB5E5DDDDDDDEp-42, -0x1.8385D11111111p-41, -0x1.4236177777777p-40,
+		  -0x1.5F17D55555555p-42, -0x1.3E0DA22222222p-43, -0x1.F9E1F33333333p-46, -0x1.2E05C66666666p-49, -0x1.BBBF488888889p-55, -0x1.58CA59999999Ap-63 },
+		{ 0x1.28C6666666666p-48, 0x1.4E5A222222222p-45, 0x1.DA8D111111111p-44, 0x1.E3F8CCCCCCCCDp-43, 0x1.A866222222222p-42, 0x1.600DBBBBBBBBCp-41,
+		  0x1.7E3B777777777p-43, 0x1.5D5DBBBBBBBBCp-44, 0x1.1648EEEEEEEEFp-46, 0x1.4D1CDDDDDDDDEp-50, 0x1.D866222222222p-56, 0x1.735DDDDDDDDDEp-64 },
+		{ 0x1.A8AF111111111p-48, 0x1.DF9ECCCCCCCCDp-45, 0x1.553999999999Ap-43, 0x1.5AF3777777777p-42, 0x1.2F5C222222222p-41, 0x1.F84B555555555p-41,
+		  0x1.1281777777777p-42, 0x1.F180444444444p-44, 0x1.8BE5333333333p-46, 0x1.D8E1333333333p-50, 0x1.59E4AAAAAAAABp-55, 0x1.0D5C444444444p-63 },
+		{ -0x1.2FEAAAAAAAAABp-50, -0x1.554AAAAAAAAABp-47, -0x1.E480000000000p-46, -0x1.EE37777777777p-45, -0x1.B133333333333p-44, -0x1.6771111111111p-43,
+		  -0x1.861DDDDDDDDDEp-45, -0x1.64CCCCCCCCCCDp-46, -0x1.1C44444444444p-48, -0x1.53BAAAAAAAAABp-52, -0x1.E39999999999Ap-58, -0x1.7B80000000000p-66 },
+		{ -0x1.02D2AAAAAAAABp-49, -0x1.24C2AAAAAAAABp-46, -0x1.A08EEEEEEEEEFp-45, -0x1.A7ACCCCCCCCCDp-44, -0x1.7296666666666p-43, -0x1.33EE666666666p-42,
+		  -0x1.4F3999999999Ap-44, -0x1.2FE4444444444p-45, -0x1.E3BCCCCCCCCCDp-48, -0x1.211A222222222p-51, -0x1.A505555555555p-57, -0x1.4874444444444p-65 }
+	},
+	{
+		{ 0x1.BE4F2BDCB7E48p-10, 0x1.FB829796E7E15p-7, 0x1.68880393111F3p-5, 0x1.6EF4B43D21BC3p-4, 0x1.422E2B0E96D65p-3, 0x1.0B1F3E92DEDBAp-2,
+		  0x1.32A2F0F4CD032p-4, 0x1.1833A659E32BAp-5, 0x1.BC1A24390C733p-8, 0x1.0CDB3DB4724F5p-11, 0x1.79BFC9C56AFCBp-17, 0x1.2BDC96F9033DDp-25 },
+		{ -0x1.EC7AABFC3D96Ap-15, -0x1.18016E1E368ECp-11, -0x1.8DD3E0A229FCEp-10, -0x1.94EAB53A80DF4p-9, -0x1.63826479E93A9p-8, -0x1.26C15F8778202p-7,
+		  -0x1.525B8577FB055p-10, -0x1.35302A5199B9Bp-11, -0x1.EA0B30CCC6AD4p-14, -0x1.28AB4CEB45E24p-17, -0x1.A0D3A0DC343F6p-23, -0x1.4AE1C11663F89p-31 },
+		{ 0x1.0FB670895D747p-19, 0x1.34F8C01F42B6Bp-16, 0x1.B6FB73721ACC4p-15, 0x1.BECE05C1B77DAp-14, 0x1.884942B866A17p-13, 0x1.453F4EEAD5C02p-12,
+		  0x1.18051F002C39Dp-15, 0x1.FFC27B05EE361p-17, 0x1.958DACDB51D54p-19, 0x1.EB09E095889E7p-23, 0x1.58F5C326B7F3Bp-28, 0x1.11D550B4AFF78p-36 },
+		{ -0x1.2BD223B9DFA56p-24, -0x1.54EF2C12100A7p-21, -0x1.E464E9069FE7Cp-20, -0x1.ED06A4F0846A4p-19, -0x1.B0DE145EAD74Dp-18, -0x1.66E4C0BFD1A0Cp-17,
+		  -0x1.017D5A034876Bp-20, -0x1.D6956839910EFp-22, -0x1.74EC35BD4211Ap-24, -0x1.C3879EFE97BDEp-28, -0x1.3D3464C010D26p-33, -0x1.F79A0138A915Ep-42 },
+		{ 0x1.4AD639963A666p-29, 0x1.78340DDAA619Ap-26, 0x1.0B4080EE55C00p-24, 0x1.1003AAC1EB622p-23, 0x1.DDA59B315F800p-23, 0x1.8C053E900C99Ap-22,
+		  0x1.F138B552C3777p-26, 0x1.C65B56BDBFDDEp-27, 0x1.68104779CB111p-29, 0x1.B3F5DF75EB333p-33, 0x1.32447576AF111p-38, 0x1.E63D0BB216444p-47 },
+		{ -0x1.6D11392FE8889p-34, -0x1.9F20AE04D1111p-31, -0x1.26E74D2100000p-29, -0x1.2C289A5324444p-28, -0x1.0788986673333p-27, -0x1.B4FEC0DC04444p-27,
+		  -0x1.EDD33EA29999Ap-31, -0x1.C3411900D5555p-32, -0x1.659B311B80000p-34, -0x1.B0FD017C44444p-38, -0x1.302EF48D6EEEFp-43, -0x1.E2F0D3D6AAAABp-52 },
+		{ 0x1.92A0597E66666p-39, 0x1.C9D6E67AEEEEFp-36, 0x1.453E50E2AAAABp-34, 0x1.4B09E7FAAAAABp-33, 0x1.22A5B174CCCCDp-32, 0x1.E1F41F7E66666p-32,
+		  0x1.F265166666666p-36, 0x1.C76DE87777777p-37, 0x1.68EE65C666666p-39, 0x1.B516177333333p-43, 0x1.33056E499999Ap-48, 0x1.E7996B3888889p-57 },
+		{ -0x1.AA2C904444444p-44, -0x1.E4C5B04444444p-41, -0x1.584E313333333p-39, -0x1.5E7683DDDDDDEp-38, -0x1.33B6311111111p-37, -0x1.FE39A9DDDDDDEp-37,
+		  -0x1.9D7FD88888889p-41, -0x1.793DABBBBBBBCp-42, -0x1.2BBF411111111p-44, -0x1.6A493EEEEEEEFp-48, -0x1.FC1C344444444p-54, -0x1.94A9A33333333p-62 },
+		{ 0x1.18AF022222222p-47, 0x1.3D47233333333p-44, 0x1.C5D4C44444444p-43, 0x1.CE60377777777p-42, 0x1.9384266666666p-41, 0x1.4F86D33333333p-40,
+		  0x1.ED06E66666666p-43, 0x1.C44D111111111p-44, 0x1.64D9DDDDDDDDEp-46, 0x1.9F33444444444p-50, 0x1.3D9A2CCCCCCCDp-55, 0x1.E340CEEEEEEEFp-64 },
+		{ -0x1.A2466AAAAAAABp-48, -0x1.D791C00000000p-45, -0x1.50DB222222222p-43, -0x1.5627844444444p-42, -0x1.2C39088888889p-41, -0x1.F24EFBBBBBBBCp-41,
+		  -0x1.13B1C88888889p-42, -0x1.FC3E444444444p-44, -0x1.8DCC911111111p-46, -0x1.E8C4888888889p-50, -0x1.5A390CCCCCCCDp-55, -0x1.11C66AAAAAAABp-63 },
+		{ -0x1.F5F76EEEEEEEFp-48, -0x1.1A84711111111p-44, -0x1.95ABA22222222p-43, -0x1.9D7B2AAAAAAABp-42, -0x1.6766B33333333p-41, -0x1.2B6D0CCCCCCCDp-40,
+		  -0x1.52F3444444444p-42, -0x1.365F19999999Ap-43, -0x1.E9B9555555555p-46, -0x1.1BEAF77777777p-49, -0x1.B5277BBBBBBBCp-55, -0x1.4B66822222222p-63 },
+		{ 0x1.124CDDDDDDDDEp-48, 0x1.34D3888888889p-45, 0x1.B99EAAAAAAAABp-44, 0x1.C03F111111111p-43, 0x1.8973333333333p-42, 0x1.4684BBBBBBBBCp-41,
+		  0x1.6F35777777777p-43, 0x1.530E666666666p-44, 0x1.0882888888889p-46, 0x1.46D6AAAAAAAABp-50, 0x1.CDA8AAAAAAAABp-56, 0x1.6DA6888888889p-64 },
+		{ 0x1.88C8CCCCCCCCDp-48, 0x1.BA6A000000000p-45, 0x1.3D3F555555555p-43, 0x1.4347111111111p-42, 0x1.1924222222222p-41, 0x1.D455111111111p-41,
+		  0x1.0916AAAAAAAABp-42, 0x1.E49599999999Ap-44, 0x1.7EBAEEEEEEEEFp-46, 0x1.BCC4444444444p-50, 0x1.54EC222222222p-55, 0x1.0345000000000p-63 },
+		{ -0x1.183CCCCCCCCCDp-50, -0x1.3B14444444444p-47, -0x1.C300000000000p-46, -0x1.C964444444444p-45, -0x1.91A2222222222p-44, -0x1.4D4DDDDDDDDDEp-43,
+		  -0x1.76A0000000000p-45, -0x1.5AA8888888889p-46, -0x1.0D62222222222p-48, -0x1.4F26666666666p-52, -0x1.D7F5555555555p-58, -0x1.769BBBBBBBBBCp-66 },
+		{ -0x1.DFCAAAAAAAAABp-50, -0x1.0E62AAAAAAAABp-46, -0x1.8360000000000p-45, -0x1.8AACCCCCCCCCDp-44, -0x1.5760000000000p-43, -0x1.1DF2222222222p-42,
+		  -0x1.43D1111111111p-44, -0x1.278AAAAAAAAABp-45, -0x1.D362222222222p-48, -0x1.0FFDDDDDDDDDEp-51, -0x1.9F96666666666p-57, -0x1.3CCD555555555p-65 }
+	},
+	{
+		{ 0x1.A183DEB5B4E9Fp-10, 0x1.DAC47D4B1BB52p-7, 0x1.51456EB2DEFF6p-5, 0x1.57480372FF174p-4, 0x1.2D64FEFD22491p-3, 0x1.F3C6D82B9173Ap-3,
+		  0x1.2894807A16D64p-4, 0x1.0F032645A181Fp-5, 0x1.AD8993ACD515Ap-8, 0x1.0409FE4747F2Ap-11, 0x1.6D5C4E2E783E7p-17, 0x1.220707A70FE49p-25 },
+		{ -0x1.AEFBBC9A88297p-15, -0x1.EA15267F1323Fp-12, -0x1.5C26A3D1696F6p-10, -0x1.625ADA452765Ap-9, -0x1.371DEE70A69A8p-8, -0x1.01F3043783FF3p-7,
+		  -0x1.3225ADE9618E3p-10, -0x1.17C12FC3C0911p-11, -0x1.BB64B978A052Ep-14, -0x1.0C6D6993EFFC0p-17, -0x1.792579FE837D9p-23, -0x1.2B62186A86D08p-31 },
+		{ 0x1.BCE2D333F934Ap-20, 0x1.F9E448C505C2Cp-17, 0x1.6761B15C23B59p-15, 0x1.6DC9235FFE7E7p-14, 0x1.412727ADF0197p-13, 0x1.0A452DA485968p-12,
+		  0x1.DA08CB3784684p-16, 0x1.B12B20AAF9F11p-17, 0x1.5745B8E1FFCD4p-19, 0x1.9FA1279C4E0B0p-23, 0x1.23FBFB5BF4C79p-28, 0x1.CF8FA1B4354A6p-37 },
+		{ -0x1.CB3CB8DCECE2Fp-25, -0x1.051AFC3325C2Cp-21, -0x1.72F97D2D64051p-20, -0x1.7995D1D6095ABp-19, -0x1.4B8341A547ADAp-18, -0x1.12DC0E024D1AAp-17,
+		  -0x1.97C57FB1AC573p-21, -0x1.749E375A8D251p-22, -0x1.2749BD2243A73p-24, -0x1.6587DFD8CE722p-28, -0x1.F656ADA0C5AD5p-34, -0x1.8EC31FEB71711p-42 },
+		{ 0x1.DA0D258178777p-30, 0x1.0D8737EB5B3BCp-26, 0x1.7EF1083AAA777p-25, 0x1.85C3F44D5F333p-24, 0x1.5634EB8020F77p-23, 0x1.1BB9DF0723111p-22,
+		  0x1.704F543967555p-26, 0x1.508EF13B04EEFp-27, 0x1.0AB63F01E7DDEp-29, 0x1.42EE612939555p-33, 0x1.C5B9B521D2000p-39, 0x1.682C2CC6B9777p-47 },
+		{ -0x1.E95ADCF6E2222p-35, -0x1.163AACC602222p-31, -0x1.8B4DC4F0A6666p-30, -0x1.9259146A88889p-29, -0x1.614103515999Ap-28, -0x1.24E2A919C6666p-27,
+		  -0x1.56343694CCCCDp-31, -0x1.38B3FA12A2222p-32, -0x1.EF9D46C333333p-35, -0x1.2C0AD1E15DDDEp-38, -0x1.A590B5C29999Ap-44, -0x1.4EA4EEC933333p-52 },
+		{ 0x1.F8C2355DDDDDEp-40, 0x1.1EFCACC377777p-36, 0x1.97BF6452AAAABp-35, 0x1.9F0390E444444p-34, 0x1.6C5F960C44444p-33, 0x1.2E1AE8E555555p-32,
+		  0x1.42BDB13EEEEEFp-36, 0x1.26EA7B3111111p-37, 0x1.D373215111111p-40, 0x1.1AF9016BBBBBCp-43, 0x1.8DA0EA8000000p-49, 0x1.3BA0A47DDDDDEp-57 },
+		{ -0x1.E6F8211111111p-45, -0x1.15137E2222222p-41, -0x1.89A6C6AAAAAABp-40, -0x1.90C1608888889p-39, -0x1.5FC5722222222p-38, -0x1.23B1748888889p-37,
+		  -0x1.AE30F11111111p-42, -0x1.89424EEEEEEEFp-43, -0x1.3900422222222p-45, -0x1.77091BBBBBBBCp-49, -0x1.0B580AAAAAAABp-54, -0x1.A5DF755555555p-63 },
+		{ 0x1.AD8499999999Ap-48, 0x1.E8DA244444444p-45, 0x1.5A5E533333333p-43, 0x1.6077AEEEEEEEFp-42, 0x1.35F4E88888889p-41, 0x1.00B759999999Ap-40,
+		  0x1.C1FB066666666p-43, 0x1.9BB7D9999999Ap-44, 0x1.42D12EEEEEEEFp-46, 0x1.8B932CCCCCCCDp-50, 0x1.11770CCCCCCCDp-55, 0x1.B7F0F33333333p-64 },
+		{ -0x1.86FB800000000p-48, -0x1.B6CAE22222222p-45, -0x1.37E5777777777p-43, -0x1.3C3A222222222p-42, -0x1.16CCDDDDDDDDEp-41, -0x1.CD462EEEEEEEFp-41,
+		  -0x1.0B0EA00000000p-42, -0x1.E762A66666666p-44, -0x1.7D7F2EEEEEEEFp-46, -0x1.DB7F111111111p-50, -0x1.4097266666666p-55, -0x1.02FD000000000p-63 },
+		{ -0x1.D3E0CCCCCCCCDp-48, -0x1.0A72022222222p-44, -0x1.78EC955555555p-43, -0x1.7FBB3BBBBBBBCp-42, -0x1.5167A66666666p-41, -0x1.17752AAAAAAABp-40,
+		  -0x1.4741DBBBBBBBCp-42, -0x1.2B2B266666666p-43, -0x1.D65CE66666666p-46, -0x1.1F0B4EEEEEEEFp-49, -0x1.8FF6444444444p-55, -0x1.4146377777777p-63 },
+		{ 0x1.03A1333333333p-48, 0x1.225B000000000p-45, 0x1.9CD8CCCCCCCCDp-44, 0x1.A22DDDDDDDDDEp-43, 0x1.710FBBBBBBBBCp-42, 0x1.3122111111111p-41,
+		  0x1.64B5CCCCCCCCDp-43, 0x1.4558777777777p-44, 0x1.FBA1777777777p-47, 0x1.3E7D111111111p-50, 0x1.A908AAAAAAAABp-56, 0x1.58B7BBBBBBBBCp-64 },
+		{ 0x1.6DB0444444444p-48, 0x1.A0A8666666666p-45, 0x1.26A0AAAAAAAABp-43, 0x1.2C0C888888889p-42, 0x1.07AE666666666p-41, 0x1.B4EEEEEEEEEEFp-41,
+		  0x1.FF9D777777777p-43, 0x1.D360000000000p-44, 0x1.704AAAAAAAAABp-46, 0x1.C019BBBBBBBBCp-50, 0x1.39EF555555555p-55, 0x1.F79999999999Ap-64 },
+		{ -0x1.0A51111111111p-50, -0x1.289AAAAAAAAABp-47, -0x1.A5D999999999Ap-46, -0x1.AACCCCCCCCCCDp-45, -0x1.7922222222222p-44, -0x1.3798888888889p-43,
+		  -0x1.6C67777777777p-45, -0x1.4C36666666666p-46, -0x1.020DDDDDDDDDEp-48, -0x1.468EEEEEEEEEFp-52, -0x1.AE1BBBBBBBBBCp-58, -0x1.5E8CCCCCCCCCDp-66 },
+		{ -0x1.BE5DDDDDDDDDEp-50, -0x1.FCC999999999Ap-47, -0x1.67BAAAAAAAAABp-45, -0x1.6E6CCCCCCCCCDp-44, -0x1.41E5555555555p-43, -0x1.0AC2222222222p-42,
+		  -0x1.385F777777777p-44, -0x1.1D3CCCCCCCCCDp-45, -0x1.C242222222222p-48, -0x1.115E666666666p-51, -0x1.8066666666666p-57, -0x1.340999999999Ap-65 }
+	},
+	{
+		{ 0x1.88360F45D884Ap-10, 0x1.BDFE662F4899Dp-7, 0x1.3CD49E4AF0885p-5, 0x1.4279F3B99A518p-4, 0x1.1B20D0812FBE1p-3, 0x1.D57CBB8DC6BBEp-3,
+		  0x1.1F73CD2F1B875p-4, 0x1.06ABE49DA1A70p-5, 0x1.A051547B088E4p-8, 0x1.F81262E71B010p-12, 0x1.621DB237DF3CCp-17, 0x1.1919F4DAECAD7p-25 },
+		{ -0x1.7C5373A894229p-15, -0x1.B07A91A23728Ep-12, -0x1.333AC80A9BDC7p-10, -0x1.38B4513019B73p-9, -0x1.128C6D186C866p-8, -0x1.C742A65AEF875p-8,
+		  -0x1.16BDDE3D325B0p-10, -0x1.FD6C660AECBF4p-12, -0x1.93B3B6C4E2536p-14, -0x1.E8CC02D097A97p-18, -0x1.57629D4D74FCCp-23, -0x1.10954A86B8A6Dp-31 },
+		{ 0x1.70CD0B4E15689p-20, 0x1.A35F94FA5483Bp-17, 0x1.29EB6CA565646p-15, 0x1.2F3A7D45DF29Ep-14, 0x1.0A3A9855B48A7p-13, 0x1.B976EEE3C03A1p-13,
+		  0x1.95714341985F6p-16, 0x1.727D617C30FF5p-17, 0x1.2599F9494A882p-19, 0x1.637D1951D2758p-23, 0x1.F3782A9F3A7B2p-29, 0x1.8C7C0F4FBB50Ap-37 },
+		{ -0x1.65A00ADBDAD04p-25, -0x1.96AA42C4CC36Fp-22, -0x1.20E44A3D35504p-20, -0x1.260A2BD0B21F3p-19, -0x1.02294DD328A50p-18, -0x1.AC163CDBD563Ep-18,
+		  -0x1.47A157AA08544p-21, -0x1.2B62BB1B65E09p-22, -0x1.DA81E53448091p-25, -0x1.1F43790C5052Fp-28, -0x1.939C93DECE455p-34, -0x1.40643FD171033p-42 },
+		{ 0x1.5AC9C05A1B5DEp-30, 0x1.8A578A7EE8889p-27, 0x1.1823337CAD4CDp-25, 0x1.1D21258E2BC44p-24, 0x1.F4AD371906CCDp-24, 0x1.9F1D566C22EEFp-23,
+		  0x1.15FD4CA00F111p-26, 0x1.FC0C762021111p-28, 0x1.929CD0F50DDDEp-30, 0x1.E77A540230CCDp-34, 0x1.56756224D0222p-39, 0x1.0FD8F9BBDF111p-47 },
+		{ -0x1.504A432E6EEEFp-35, -0x1.7E678D06D1111p-32, -0x1.0FA83F87EAAABp-30, -0x1.147F815A26666p-29, -0x1.E5852E8784444p-29, -0x1.928C5E2122222p-28,
+		  -0x1.E547BF8B55555p-32, -0x1.BB71F35B11111p-33, -0x1.5F6A789B44444p-35, -0x1.A97D8B2433333p-39, -0x1.2AE903239999Ap-44, -0x1.DA8EC0A99999Ap-53 },
+		{ 0x1.45BFEC45DDDDEp-40, 0x1.7269045DDDDDEp-37, 0x1.0723770555555p-35, 0x1.0BD3B1F6EEEEFp-34, 0x1.D64A2175DDDDEp-34, 0x1.85EC1C26EEEEFp-33,
+		  0x1.AD4B648888889p-37, 0x1.885278BBBBBBCp-38, 0x1.36E0DB9DDDDDEp-40, 0x1.785B537111111p-44, 0x1.0884143BBBBBCp-49, 0x1.A3EB365111111p-58 },
+		{ -0x1.1C83BF7777777p-45, -0x1.433DE6EEEEEEFp-42, -0x1.CB41600000000p-41, -0x1.D384033333333p-40, -0x1.9A4691999999Ap-39, -0x1.54402AAAAAAABp-38,
+		  -0x1.9882EAAAAAAABp-43, -0x1.73D6EEEEEEEEFp-44, -0x1.295BE66666666p-46, -0x1.6212D9999999Ap-50, -0x1.039E5DDDDDDDEp-55, -0x1.9672911111111p-64 },
+		{ 0x1.5B24D33333333p-48, 0x1.9184C00000000p-45, 0x1.1BECB77777777p-43, 0x1.218B755555555p-42, 0x1.FF5DA44444444p-42, 0x1.A6B7866666666p-41,
+		  0x1.A692CCCCCCCCDp-43, 0x1.7C75088888889p-44, 0x1.3154377777777p-46, 0x1.797A600000000p-50, 0x1.E9DEBBBBBBBBCp-56, 0x1.8A56D9999999Ap-64 },
+		{ -0x1.648A911111111p-48, -0x1.98D4777777777p-45, -0x1.229AE66666666p-43, -0x1.273D4CCCCCCCDp-42, -0x1.0486866666666p-41, -0x1.AED059999999Ap-41,
+		  -0x1.01B9EEEEEEEEFp-42, -0x1.D94AB33333333p-44, -0x1.7277044444444p-46, -0x1.CB27733333333p-50, -0x1.301F3BBBBBBBCp-55, -0x1.EC5B666666666p-64 },
+		{ -0x1.AD56AEEEEEEEFp-48, -0x1.F28C19999999Ap-45, -0x1.605EA22222222p-43, -0x1.6791EAAAAAAABp-42, -0x1.3DB1933333333p-41, -0x1.0683FDDDDDDDEp-40,
+		  -0x1.3D8ED55555555p-42, -0x1.1E91E66666666p-43, -0x1.CB0F5DDDDDDDEp-46, -0x1.1ADFACCCCCCCDp-49, -0x1.71AF3BBBBBBBCp-55, -0x1.2933377777777p-63 },
+		{ 0x1.D941DDDDDDDDEp-49, 0x1.0F9AEEEEEEEEFp-45, 0x1.8264888888889p-44, 0x1.885A666666666p-43, 0x1.5A97222222222p-42, 0x1.1E66777777777p-41,
+		  0x1.585AEEEEEEEEFp-43, 0x1.3C6E444444444p-44, 0x1.EDEACCCCCCCCDp-47, 0x1.33EF222222222p-50, 0x1.92D7BBBBBBBBCp-56, 0x1.4757777777777p-64 },
+		{ 0x1.4FE0CCCCCCCCDp-48, 0x1.8596AAAAAAAABp-45, 0x1.1387111111111p-43, 0x1.192999999999Ap-42, 0x1.F07ACCCCCCCCDp-42, 0x1.9A5F555555555p-41,
+		  0x1.F025111111111p-43, 0x1.C0C9111111111p-44, 0x1.66B7333333333p-46, 0x1.B8E5BBBBBBBBCp-50, 0x1.2269777777777p-55, 0x1.D25D555555555p-64 },
+		{ -0x1.E237777777777p-51, -0x1.1528888888889p-47, -0x1.8AA2222222222p-46, -0x1.9077777777777p-45, -0x1.6236666666666p-44, -0x1.247EEEEEEEEEFp-43,
+		  -0x1.5F84444444444p-45, -0x1.435BBBBBBBBBCp-46, -0x1.F6D7777777777p-49, -0x1.3BD8888888889p-52, -0x1.96D1111111111p-58, -0x1.4C26666666666p-66 },
+		{ -0x1.9A81111111111p-50, -0x1.DB9BBBBBBBBBCp-47, -0x1.5086666666666p-45, -0x1.5765555555555p-44, -0x1.2F09111111111p-43, -0x1.F510000000000p-43,
+		  -0x1.2ECAAAAAAAAABp-44, -0x1.1264444444444p-45, -0x1.B5E8888888889p-48, -0x1.0CAD555555555p-51, -0x1.63F5555555555p-57, -0x1.1D9EEEEEEEEEFp-65 }
+	}
+};
+
+/* NGQP = 7: roots (7) and weights (7) on [0,76), one polynomial of degree 14 per interval */
+static const double rys_table_7[19][RYS_TABLE_NCOEF][14] = {
+	{
+		{ 0x1.4F46C2A608837p-7, 0x1.7171E0DBDF6D8p-4, 0x1.EB4CCCCED057Cp-3, 0x1.C0D0439D878D6p-2, 0x1.4E8734709F92Ap-1, 0x1.B04794774499Fp-1, 0x1.EFFACCF81E0D0p-1,
+		  0x1.94E4785DE67C5p-3, 0x1.4E40AF8A89863p-3, 0x1.CDE7BD26D5842p-4, 0x1.122D9C30DD077p-4, 0x1.207345042759Bp-5, 0x1.0E9CEA9F8D8C8p-6, 0x1.7BEECDC007076p-8 },
+		{ -0x1.5708BA7455A3Cp-10, -0x1.5F150786691FFp-7, -0x1.8DD65B6C6791Fp-6, -0x1.13DBE030DA194p-5, -0x1.05755A971F0FAp-5, -0x1.37ECB59B8A747p-6, -0x1.24F57DDA99B0Dp-8,
+		  -0x1.0533F96FB53F9p-6, -0x1.161288DBD6F12p-5, -0x1.A298A9FE271D4p-5, -0x1.B27817ADEEEDEp-5, -0x1.544D85CAAF24Ep-5, -0x1.A15C04889A072p-6, -0x1.53C53D9F69D79p-7 },
+		{ 0x1.0499289764354p-13, 0x1.C678C8E65D441p-11, 0x1.54AD2AD7283A9p-10, 0x1.0736614C06A77p-11, -0x1.F9D4BD4A9F809p-11, -0x1.6EAE92FAAC329p-10, -0x1.E4C011BC1D5B3p-12,
+		  0x1.8039765F1ABEBp-10, 0x1.B6DD0DF9D7816p-8, 0x1.0C373784D1F8Dp-6, 0x1.9AA2F2A63808Bp-6, 0x1.B4681D4821866p-6, 0x1.4C9B4A69058D7p-6, 0x1.327830C2DC5B6p-7 },
+		{ -0x1.5B84F84C3F7D4p-17, -0x1.BD1000DC16A91p-15, -0x1.8FA408F0408AEp-17, 0x1.8FB3B35A1008Cp-14, 0x1.2DF31D0C0171Cp-14, -0x1.C7FB92EB09EF5p-15, -0x1.52E785EB319DBp-15,
+		  -0x1.24DA257DECE3Dp-13, -0x1.2BBC2388A97DCp-10, -0x1.11B18A6FD99DBp-8, -0x1.2169534269137p-7, -0x1.8C79C0A830F33p-7, -0x1.6AC0C1C03E634p-7, -0x1.7343941911746p-8 },
+		{ 0x1.AB004D23B1AC4p-21, 0x1.211237D7C395Ep-19, -0x1.33E2DDA9ABE5Ep-18, -0x1.21FD8B5D52C44p-18, 0x1.DC1615D240DABp-18, 0x1.C7FEA2487F6EFp-20, -0x1.9D059D77E0666p-19,
+		  0x1.BAF9A8374B55Ap-17, 0x1.7122F8DB81A4Dp-13, 0x1.DD87F569B0B30p-11, 0x1.4D01095A7F33Dp-9, 0x1.1B6060A8BF056p-8, 0x1.2F1F9EEEC6311p-8, 0x1.536EAD4C9D6A8p-9 },
+		{ -0x1.ED00C4984E2ABp-25, 0x1.21B9C81F11111p-31, 0x1.9C761F5258DDEp-22, -0x1.D4649FF92CCCDp-22, -0x1.6938D7D515555p-23, 0x1.E928AE825EEEFp-22, -0x1.AF599EDBA7777p-23,
+		  -0x1.48431D5390C44p-20, -0x1.A3B640EB3469Ep-16, -0x1.713CF2677DC94p-13, -0x1.47F7CB4C93D05p-11, -0x1.50F58DF9EF477p-10, -0x1.9C91554A72858p-10, -0x1.F33C0EB74FA95p-11 },
+		{ 0x1.0CEF592071DDEp-28, -0x1.5C21C218DDDDEp-27, -0x1.6ECE61E9C4444p-29, 0x1.414D7FA47EEEFp-25, -0x1.C5589AD72CCCDp-25, 0x1.15D29D42AEEEFp-25, -0x1.61E7D72E44444p-27,
+		  0x1.DB4ADCAE93777p-24, 0x1.BEDDAC3E83711p-19, 0x1.02B96FE2F5A4Dp-15, 0x1.1CA261634BD31p-13, 0x1.58F718F088CB0p-12, 0x1.DB13C29504147p-12, 0x1.33692DF90F88Ep-12 },
+		{ -0x1.1525C3D6DDDDEp-32, 0x1.2FE3E299BBBBCp-30, -0x1.249DD00666666p-29, 0x1.18D1829777777p-29, -0x1.B76116F111111p-31, 0x1.F5CBE04444444p-35, -0x1.1CA5286666666p-32,
+		  -0x1.50A5B6D311111p-27, -0x1.C1BF0297C3BBCp-22, -0x1.4D7F24F09319Ap-18, -0x1.BBF04E1C185EFp-16, -0x1.373813B426EF3p-14, -0x1.DB0A5DCABEF77p-14, -0x1.45E08A1FF73F2p-14 },
+		{ 0x1.0B80B5C333333p-36, -0x1.31AF870CCCCCDp-34, 0x1.92DC2EECCCCCDp-33, -0x1.608B722CCCCCDp-32, 0x1.93FF856222222p-32, -0x1.EE2B5DBBBBBBCp-33, 0x1.DC6523BBBBBBCp-36,
+		  0x1.D37B43519999Ap-31, 0x1.AECC46427DDDEp-25, 0x1.8FA032A77C889p-21, 0x1.3B747A6F31555p-18, 0x1.F7378614EF0EFp-17, 0x1.A4561FF2D18CDp-16, 0x1.2F6A22D7A228Bp-16 },
+		{ -0x1.ECF9A3BBBBBBCp-41, 0x1.95BD677777777p-40, -0x1.2F60066666666p-40, -0x1.3191622222222p-37, 0x1.41661F7777777p-36, -0x1.CC3E455555555p-36, 0x1.0607733333333p-39,
+		  -0x1.41523DD555555p-34, -0x1.8AC2C8C644444p-28, -0x1.C0B677CB33333p-24, -0x1.9CCB10056C444p-21, -0x1.7136486755D55p-19, -0x1.4DE3A686C7733p-18, -0x1.F7F4B1534FF77p-19 },
+		{ -0x1.B566444444444p-48, -0x1.D107222222222p-43, -0x1.44359CCCCCCCDp-39, 0x1.D441A22222222p-41, -0x1.57CE022222222p-38, -0x1.1C70AAAAAAAABp-38, -0x1.CF4F19999999Ap-39,
+		  0x1.6E69DB3333333p-38, 0x1.5ADBB4FCCCCCDp-31, 0x1.DAF2C71600000p-27, 0x1.F560E67540000p-24, 0x1.F08194F06C444p-22, 0x1.E182B0B30D99Ap-21, 0x1.79CB6C5F46A22p-21 },
+		{ 0x1.AEE8000000000p-46, 0x1.A0FF111111111p-43, 0x1.7B63666666666p-41, 0x1.18D3777777777p-40, 0x1.53E3111111111p-40, 0x1.153799999999Ap-39, 0x1.2C2A777777777p-39,
+		  -0x1.2F5AAAAAAAAABp-45, -0x1.2445471111111p-34, -0x1.DBC0170000000p-30, -0x1.1C14EBB444444p-26, -0x1.33D887A4D1111p-24, -0x1.3D650F4BF999Ap-23, -0x1.0197B2ABE2222p-23 },
+		{ 0x1.43A4222222222p-45, 0x1.650D555555555p-42, 0x1.CD35777777777p-41, 0x1.92B7555555555p-40, 0x1.29ED99999999Ap-39, 0x1.77F599999999Ap-39, 0x1.A5CC000000000p-39,
+		  0x1.8AE1777777777p-41, 0x1.070D822222222p-37, 0x1.C7256EEEEEEEFp-33, 0x1.2EE27C999999Ap-29, 0x1.63AECC699999Ap-27, 0x1.832DA76B9999Ap-26, 0x1.43BF620380000p-26 },
+		{ -0x1.D288888888889p-48, -0x1.F846666666666p-45, -0x1.49E5555555555p-43, -0x1.2233333333333p-42, -0x1.A2FDDDDDDDDDEp-42, -0x1.099BBBBBBBBBCp-41, -0x1.2C2DDDDDDDDDEp-41,
+		  -0x1.12D6666666666p-43, -0x1.C9E5111111111p-41, -0x1.B10AA66666666p-36, -0x1.408BBA6666666p-32, -0x1.96EDC3FBBBBBCp-30, -0x1.D2DA1E4666666p-29, -0x1.91C9300EEEEEFp-29 },
+		{ -0x1.8AF2222222222p-47, -0x1.B02CCCCCCCCCDp-44, -0x1.1950888888889p-42, -0x1.F325555555555p-42, -0x1.6A5EEEEEEEEEFp-41, -0x1.C826666666666p-41, -0x1.0154444444444p-40,
+		  -0x1.C5BCCCCCCCCCDp-43, -0x1.1B50000000000p-43, 0x1.5D3FDDDDDDDDEp-39, 0x1.2E30711111111p-35, 0x1.99BBDC0000000p-33, 0x1.E9EC497777777p-32, 0x1.AF1EEFEAAAAABp-32 }
+	},
+	{
+		{ 0x1.077450C3CB3BAp-7, 0x1.2646EF755364Cp-4, 0x1.922A6AE0198FEp-3, 0x1.7E9A7624ACEFDp-2, 0x1.2C37EBDCA8AD0p-1, 0x1.99B8290034E2Ep-1, 0x1.EA42D7589C9AAp-1,
+		  0x1.5DACF2D425457p-3, 0x1.D7A2678C8B7E8p-4, 0x1.B2C227329306Ep-5, 0x1.1B637DB7ADA58p-6, 0x1.185092AC425ACp-8, 0x1.DA7D6224871CBp-11, 0x1.6AB7850BFBBF6p-13 },
+		{ -0x1.DF59EDEC00E22p-11, -0x1.001DCFB0C8E0Ap-7, -0x1.3CEECBB77B276p-6, -0x1.F6CA521DA479Ap-6, -0x1.1C543BCF3B43Dp-5, -0x1.9CB27246FCCE7p-6, -0x1.C58F5C8CE92BDp-8,
+		  -0x1.75FD70AA26AFAp-7, -0x1.128599A757DEEp-6, -0x1.0CA81FE321DEAp-6, -0x1.4186E4F993850p-7, -0x1.034F457E9477Dp-8, -0x1.407D9ED11A670p-10, -0x1.37853E956599Fp-12 },
+		{ 0x1.44B0BC8E5F07Fp-14, 0x1.39BFFC8011EE4p-11, 0x1.2CAC987DEF5ECp-10, 0x1.EF70DDB0469D3p-11, -0x1.97687C65E981Ap-12, -0x1.AE074615F776Dp-10, -0x1.A1F566884AFB1p-11,
+		  0x1.C71F37BB9FB65p-11, 0x1.5AD07C8B4AE5Fp-9, 0x1.0E46E8D7FBCBBp-8, 0x1.E0A97CEEA959Bp-9, 0x1.14809D30A0C86p-9, 0x1.CBA16FD166CF1p-11, 0x1.0FA43986083CAp-12 },
+		{ -0x1.83FE5CB9D63CAp-18, -0x1.35B5B58B726E2p-15, -0x1.21E17C1661E1Ep-15, 0x1.A200131BE3ED7p-15, 0x1.DD811F2FC46FEp-14, -0x1.2BE1D644A677Ap-16, -0x1.399720354E5E2p-14,
+		  -0x1.2391C83BDF5E6p-14, -0x1.85561FF0AFD33p-12, -0x1.BE45D1A1649B4p-11, -0x1.162F0BBD5108Bp-10, -0x1.AF5796FDCED70p-11, -0x1.CB51477988884p-12, -0x1.3FB9A2DF0D750p-13 },
+		{ 0x1.AD3921BBB9F15p-22, 0x1.E0CC0C022DDCDp-20, -0x1.6035CBD94799Ap-20, -0x1.A1A7A62D68D44p-18, 0x1.4C329432FCAEFp-19, 0x1.07C2DED4EC09Ap-17, -0x1.7FD98FE663C00p-18,
+		  0x1.7762F60BE4EC9p-18, 0x1.8FF89DD2E47A3p-15, 0x1.42BD73AC4C2EBp-13, 0x1.0DFDBDD3EE748p-12, 0x1.0EC4EAEEAEC08p-12, 0x1.6474DD9D234FAp-13, 0x1.1D213012EF720p-14 },
+		{ -0x1.C25D4F464F333p-26, -0x1.D91177BEB999Ap-25, 0x1.098F45F4D6AABp-22, 0x1.821057FA7EEEFp-25, -0x1.7109B51CD3777p-21, 0x1.77AA4CAF49111p-21, -0x1.56F285BF76EEFp-22,
+		  -0x1.DEB4977EF1CCDp-22, -0x1.7FFC5B53DA0E6p-18, -0x1.A54E800EB2EE3p-16, -0x1.C99CD99B49E0Ap-15, -0x1.1FB49103F5674p-14, -0x1.C756F4381D160p-15, -0x1.9A5BF136E64ADp-16 },
+		{ 0x1.C17E4F787A222p-30, -0x1.0EB70137B3333p-30, -0x1.015D489D5AAABp-26, 0x1.1AAF6CC0F999Ap-25, -0x1.4E4E509BD999Ap-26, -0x1.F6503B98DDDDEp-28, -0x1.67FF4D9D88889p-28,
+		  0x1.2B44DA0A2CCCDp-25, 0x1.5CC32B4D85400p-21, 0x1.F9A768915224Dp-19, 0x1.5B35A2581F665p-17, 0x1.0ADBC2CCA2B0Ap-16, 0x1.F0488BB0A1331p-17, 0x1.EFCC3CF599E97p-18 },
+		{ -0x1.B16B5A8222222p-34, 0x1.565123BCCCCCDp-32, 0x1.C5EFE8BBBBBBCp-35, -0x1.1AE04DC2AAAABp-29, 0x1.570B34BB77777p-28, -0x1.BB89566000000p-28, 0x1.C961D9599999Ap-30,
+		  -0x1.714DD1EE00000p-29, -0x1.2E0B8851DEEEFp-24, -0x1.1A7DF7EBA5222p-21, -0x1.DFB887962C2EFp-20, -0x1.B93FC44AA775Ep-19, -0x1.D8F92F5960A95p-19, -0x1.025E66347B82Fp-19 },
+		{ 0x1.8ACA959333333p-38, -0x1.05F29AD111111p-35, 0x1.3E6A41D111111p-34, -0x1.D7CB3E3333333p-34, 0x1.5A4530199999Ap-33, -0x1.F64B4E6AAAAABp-32, 0x1.3F1BB31555555p-32,
+		  0x1.BDFAC14888889p-33, 0x1.F5CE3AE280000p-28, 0x1.28819B4B9E222p-24, 0x1.3162550599089p-22, 0x1.4A0F6F533E9DEp-21, 0x1.9132B11DA50B3p-21, 0x1.D9E15AA542B11p-22 },
+		{ -0x1.78F1677777777p-42, 0x1.C3216DDDDDDDEp-40, -0x1.0D9DC26666666p-37, 0x1.44B3E00000000p-36, -0x1.7DE7473333333p-35, 0x1.4DA5480000000p-36, 0x1.CAE0DA2222222p-36,
+		  -0x1.1432137777777p-36, -0x1.91A488219999Ap-31, -0x1.2650EE854CCCDp-27, -0x1.69840E3F7DDDEp-25, -0x1.C3D0300D2E222p-24, -0x1.330079939099Ap-23, -0x1.8437DABE63FDEp-24 },
+		{ -0x1.4AD49DDDDDDDEp-46, -0x1.A90B1DDDDDDDEp-42, -0x1.4DE9044444444p-41, -0x1.0CC2D11111111p-39, -0x1.0BD7CEEEEEEEFp-38, 0x1.9B47044444444p-39, -0x1.07156AAAAAAABp-39,
+		  0x1.C512666666666p-42, 0x1.33FB9E7BBBBBCp-34, 0x1.159B555066666p-30, 0x1.90ABDDFBE2222p-28, 0x1.1D6C2D760EEEFp-26, 0x1.AC49D677CB99Ap-26, 0x1.1F786925DC000p-26 },
+		{ 0x1.56EE666666666p-46, 0x1.88C799999999Ap-43, 0x1.149A333333333p-41, 0x1.ACC6666666666p-41, 0x1.E456CCCCCCCCDp-40, 0x1.2619666666666p-39, 0x1.28D3222222222p-39,
+		  0x1.6461111111111p-42, -0x1.BC3F922222222p-38, -0x1.F327E6DDDDDDEp-34, -0x1.A1A0ABF99999Ap-31, -0x1.4EB445C377777p-29, -0x1.122199ACB3333p-28, -0x1.83B0335D2BBBCp-29 },
+		{ 0x1.F108666666666p-46, 0x1.172B555555555p-42, 0x1.75AC666666666p-41, 0x1.6316666666666p-40, 0x1.0FD3111111111p-39, 0x1.607CEEEEEEEEFp-39, 0x1.A019BBBBBBBBCp-39,
+		  0x1.3F0F555555555p-41, 0x1.1D38911111111p-40, 0x1.B7465F7777777p-37, 0x1.9CA3954CCCCCDp-34, 0x1.6F9A7CD111111p-32, 0x1.45A4E8DE88889p-31, 0x1.E24D354E22222p-32 },
+		{ -0x1.6891111111111p-48, -0x1.8E8EEEEEEEEEFp-45, -0x1.0B8BBBBBBBBBCp-43, -0x1.F41DDDDDDDDDEp-43, -0x1.8375555555555p-42, -0x1.0165555555555p-41, -0x1.2A7CCCCCCCCCDp-41,
+		  -0x1.C7CCCCCCCCCCDp-44, -0x1.22AA222222222p-43, -0x1.7DD4AAAAAAAABp-40, -0x1.94941CCCCCCCDp-37, -0x1.8FEFC3999999Ap-35, -0x1.7E713E6222222p-34, -0x1.282CB865DDDDEp-34 },
+		{ -0x1.2F3C444444444p-47, -0x1.5436666666666p-44, -0x1.CA5AAAAAAAAABp-43, -0x1.ADF1111111111p-42, -0x1.4938888888889p-41, -0x1.B3E5555555555p-41, -0x1.FE01111111111p-41,
+		  -0x1.81BBBBBBBBBBCp-43, -0x1.114C444444444p-43, 0x1.0E90888888889p-44, 0x1.5E47AEEEEEEEFp-40, 0x1.8211422222222p-38, 0x1.88F5B36666666p-37, 0x1.3B23BADDDDDDEp-37 }
+	},
+	{
+		{ 0x1.A8B4015380445p-8, 0x1.DDE7E2B5B110Fp-5, 0x1.4BBBD2C19F623p-3, 0x1.43EF4E1C08A7Cp-2, 0x1.085B4B64DDEFAp-1, 0x1.7C9171F06A711p-1, 0x1.E12EE7E6EEC54p-1,
+		  0x1.350EA4887092Bp-3, 0x1.7012B6210DBBBp-4, 0x1.0495698A183C4p-5, 0x1.B8120411EE2ADp-8, 0x1.C86FF68F2758Cp-11, 0x1.45E29F29217ADp-14, 0x1.A0D0CF1F542E9p-18 },
+		{ -0x1.5BA1184C8EAA4p-11, -0x1.7CEE44D370D03p-8, -0x1.F1EF89D88507Cp-7, -0x1.B22E178166FA1p-6, -0x1.1DAEB6F74FCA6p-5, -0x1.0360DB2223887p-5, -0x1.6F8002F01BDD3p-7,
+		  -0x1.1AA97227E5B0Ap-7, -0x1.35FAAC74734E6p-7, -0x1.B447870F6CF07p-8, -0x1.54A69F73306B3p-9, -0x1.31C7DCA4A6FD3p-11, -0x1.649520FD138B1p-14, -0x1.4D14F48DB0792p-17 },
+		{ 0x1.A81532BD22D52p-15, 0x1.B3988B32B0F4Ep-12, 0x1.E4B13795D0A83p-11, 0x1.218FE4673E267p-10, 0x1.382E6BA926259p-12, -0x1.8BC77599DB8BCp-10, -0x1.711ECB5D47B90p-10,
+		  0x1.23BA0F3ED9176p-11, 0x1.40CF6A1FD66FDp-10, 0x1.60AD9AC19078Dp-10, 0x1.90CBA4A4EFC4Bp-11, 0x1.044C67482E274p-12, 0x1.B48C8B106BD09p-15, 0x1.1242D5E45FC34p-17 },
+		{ -0x1.CAA3930659499p-19, -0x1.A0727D375211Fp-16, -0x1.3A01906479C25p-15, 0x1.88F1ADC1A0989p-18, 0x1.BC1D6BD1A66CAp-14, 0x1.1B965B89B4F02p-14, -0x1.15E24CE616915p-13,
+		  -0x1.40BACF1CF19FEp-15, -0x1.2E50A6A072ADBp-13, -0x1.DBE78C569D779p-13, -0x1.78B05073AAD6Ap-13, -0x1.50EAD755766EDp-14, -0x1.7FAA2575205B3p-16, -0x1.33F5D7D4FD9F3p-18 },
+		{ 0x1.CA29D3D049989p-23, 0x1.4D4BF10D8B5A2p-20, 0x1.65D22F37EF155p-22, -0x1.28F75C724671Ap-18, -0x1.175837DC1E09Ap-18, 0x1.9BE406546CE6Fp-17, -0x1.1669A100CDDCDp-17,
+		  0x1.63DC865EFA16Fp-19, 0x1.0799C4E793BB2p-16, 0x1.1F3778427F45Ep-15, 0x1.310FDC9D45C73p-15, 0x1.68D4DCDADC3D5p-16, 0x1.0B71699CB31FDp-17, 0x1.08012F5EA60EDp-19 },
+		{ -0x1.B9E6F3DD49DDEp-27, -0x1.B4D301BF3E222p-25, 0x1.8DA25B26AFBBCp-24, 0x1.103EBB00EF99Ap-22, -0x1.142E6D764F444p-21, -0x1.4790A0FC82222p-25, -0x1.57FC0A18D1111p-25,
+		  -0x1.8FA8BBBA4BDDEp-23, -0x1.B12FAB31D6EEFp-20, -0x1.3DA761D7BF55Ap-18, -0x1.B7D955CDC218Fp-18, -0x1.4DCE436BD9491p-18, -0x1.37CBE294FC8FCp-19, -0x1.6F647025DC7A6p-21 },
+		{ 0x1.8F2344D8C3333p-31, 0x1.2D0D54DE80000p-30, -0x1.50C8A457EAAABp-27, 0x1.B5D6149377777p-29, 0x1.6316E623EDDDEp-25, -0x1.E1D2EE566EEEFp-24, 0x1.4563978201111p-24,
+		  0x1.B118867DA0000p-27, 0x1.53B6126395111p-23, 0x1.472E045B6C9BCp-21, 0x1.2058DBB375D95p-20, 0x1.11FB0D00FFB71p-20, 0x1.3A15A68FF38B5p-21, 0x1.AF3445F19215Fp-23 },
+		{ -0x1.590AD1B19999Ap-35, 0x1.DA99B11111111p-35, 0x1.1C7B17E666666p-31, -0x1.AE40C1E800000p-30, 0x1.3767B64000000p-29, -0x1.32CAA6C9DDDDEp-28, 0x1.9B8ED279DDDDEp-27,
+		  -0x1.D3AA751333333p-31, -0x1.FF403A40D5555p-27, -0x1.3CEAE415E6EEFp-24, -0x1.5CA79A0EB02ABp-23, -0x1.9645B8EA76F33p-23, -0x1.177F5E75A3344p-23, -0x1.B63769EAB7B4Bp-25 },
+		{ 0x1.6A85272666666p-39, -0x1.24DA106666666p-38, 0x1.08E91D5555555p-37, 0x1.11A412A222222p-33, -0x1.7B0FC41BBBBBCp-32, 0x1.12EDBA4666666p-30, 0x1.17E4965666666p-30,
+		  0x1.11E6201555555p-34, 0x1.72EC2236AAAABp-30, 0x1.22DB25D6BDDDEp-27, 0x1.88C124CC1B777p-26, 0x1.13A055C262155p-25, 0x1.BE83C04696211p-26, 0x1.891058D146C11p-27 },
+		{ -0x1.8E19488888889p-44, 0x1.F708633333333p-41, -0x1.1F2EA00000000p-40, 0x1.1FFE688888889p-38, 0x1.2692222222222p-39, 0x1.BD5F3D999999Ap-34, 0x1.732D555555555p-36,
+		  -0x1.034F83BBBBBBCp-38, -0x1.064197DBBBBBCp-33, -0x1.FD73125DDDDDEp-31, -0x1.9F65E32637777p-29, -0x1.598A10E9D6AABp-28, -0x1.440D7AB246555p-28, -0x1.3BC1FD4372AABp-29 },
+		{ -0x1.9CB2D11111111p-46, -0x1.49C5955555555p-42, -0x1.1BC599999999Ap-41, -0x1.23D2AEEEEEEEFp-39, 0x1.82B7D11111111p-40, -0x1.1A41B77777777p-37, -0x1.89A3D66666666p-37,
+		  -0x1.9D9F800000000p-42, 0x1.561A373333333p-37, 0x1.A9E85A4AAAAABp-34, 0x1.9ECC5E4CEEEEFp-32, 0x1.93399C6717777p-31, 0x1.AF5D6F3299DDEp-31, 0x1.CB89471F07BBCp-32 },
+		{ 0x1.059E666666666p-46, 0x1.2F46DDDDDDDDEp-43, 0x1.8F18EEEEEEEEFp-42, 0x1.A22E666666666p-41, 0x1.1A1D111111111p-40, 0x1.4100000000000p-42, 0x1.71DEEEEEEEEEFp-41,
+		  0x1.69E1BBBBBBBBCp-42, -0x1.5ED02AAAAAAABp-41, -0x1.542424CCCCCCDp-37, -0x1.88941E2EEEEEFp-35, -0x1.B8206A8A66666p-34, -0x1.08E2A18DB3333p-33, -0x1.31184DA7FBBBCp-34 },
+		{ 0x1.9089BBBBBBBBCp-46, 0x1.BE54444444444p-43, 0x1.3433555555555p-41, 0x1.2A4B555555555p-40, 0x1.D3A6888888889p-40, 0x1.4C30222222222p-39, 0x1.89BA000000000p-39,
+		  0x1.17EC444444444p-41, 0x1.AA52AAAAAAAABp-42, 0x1.2D160CCCCCCCDp-40, 0x1.64AF3D5555555p-38, 0x1.C4EE5F2EEEEEFp-37, 0x1.2F27AFE8CCCCDp-36, 0x1.763B88A4CCCCDp-37 },
+		{ -0x1.1B66666666666p-48, -0x1.3F5AAAAAAAAABp-45, -0x1.B786666666666p-44, -0x1.A944444444444p-43, -0x1.5317777777777p-42, -0x1.CF6EEEEEEEEEFp-42, -0x1.270CCCCCCCCCDp-41,
+		  -0x1.8B02222222222p-44, -0x1.11BCCCCCCCCCDp-44, -0x1.FE5DDDDDDDDDEp-44, -0x1.40E4488888889p-41, -0x1.CDEC22EEEEEEFp-40, -0x1.57346C199999Ap-39, -0x1.C525F12000000p-40 },
+		{ -0x1.E9C5555555555p-48, -0x1.1165555555555p-44, -0x1.798CCCCCCCCCDp-43, -0x1.6D5BBBBBBBBBCp-42, -0x1.23EA222222222p-41, -0x1.9915555555555p-41, -0x1.F616666666666p-41,
+		  -0x1.55CDDDDDDDDDEp-43, -0x1.A828888888889p-44, -0x1.089AAAAAAAAABp-45, 0x1.B44C000000000p-45, 0x1.A3944AAAAAAABp-43, 0x1.564E393333333p-42, 0x1.DCB8202222222p-43 }
+	},
+	{
+		{ 0x1.5D74D3906F15Ep-8, 0x1.8ACF0C38B331Dp-5, 0x1.1477B3CEFE0FDp-3, 0x1.122BA5CE80832p-2, 0x1.CB4C1F557541Ap-2, 0x1.596D4886466A0p-1, 0x1.D23506604F6B7p-1,
+		  0x1.15BB7F27C92ECp-3, 0x1.32C2200A4B2E5p-4, 0x1.7075D63D2AB63p-6, 0x1.D2F5096CFB5E2p-9, 0x1.2CAC64015E3FEp-12, 0x1.88C083782181Dp-17, 0x1.4968FA3D7E7ACp-22 },
+		{ -0x1.04008BF7E144Bp-11, -0x1.21334375E0493p-8, -0x1.86F181E55CBFBp-7, -0x1.6AA013FE313B8p-6, -0x1.0AE0254DFF5D6p-5, -0x1.2B31B01B84833p-5, -0x1.3224229675ECAp-6,
+		  -0x1.BCCE8CF68DA7Ap-8, -0x1.8265D77DE04D0p-8, -0x1.A23E22A96BCB0p-9, -0x1.DAD967D9B10FCp-11, -0x1.0D8E82BA9171Cp-13, -0x1.38605F508B685p-17, -0x1.CA2B74A1A3FECp-22 },
+		{ 0x1.1FB11B527BDD2p-15, 0x1.32B80F68C1DC0p-12, 0x1.75F8B327312B5p-11, 0x1.143C30A268AE8p-10, 0x1.A4EC99393FE37p-11, -0x1.B88F1AC2AA968p-11, -0x1.379D2B2DDE07Bp-9,
+		  0x1.8CB1D269F02B4p-12, 0x1.4DDB48AAA35A6p-11, 0x1.18A90654BD42Cp-11, 0x1.C165A9F7BF29Bp-13, 0x1.688A2259432D0p-15, 0x1.34210818517EEp-18, 0x1.54B751B9096FEp-22 },
+		{ -0x1.1D6382A8C82B4p-19, -0x1.1886574871497p-16, -0x1.0F33FD6E617D8p-15, -0x1.47B5546A78A0Ap-16, 0x1.F1BA0AFB72656p-15, 0x1.324B964D93E7Cp-13, -0x1.794436A07D27Ep-13,
+		  -0x1.7F05FD2ABB1A5p-16, -0x1.0CF88D915488Cp-14, -0x1.39CE46E7012F3p-14, -0x1.569A0CCE03F49p-15, -0x1.7A358E672E7FBp-17, -0x1.C6892D78C6204p-20, -0x1.61181D493BC0Ep-23 },
+		{ 0x1.0194F0C98CA1Ep-23, 0x1.B452066B94C55p-21, 0x1.B9EEF90101355p-21, -0x1.0AC30D6030AABp-19, -0x1.B61EA9CD14111p-18, 0x1.656F1A1958089p-18, 0x1.18EDEBC511333p-22,
+		  0x1.6F168CC0F9B9Ap-20, 0x1.953EFCC3201F7p-18, 0x1.401A0F655625Bp-17, 0x1.CF2923179E8CBp-18, 0x1.52D69F1FEB27Ap-19, 0x1.11ED98A051FC3p-21, 0x1.1B9CD235732D0p-24 },
+		{ -0x1.B8EECC82D6222p-28, -0x1.1EE313B848889p-25, 0x1.6DC1366914444p-26, 0x1.D8906A8FD3BBCp-23, 0x1.80A4D17F3EEEFp-25, -0x1.3D298523D7666p-20, 0x1.3007B257BAEEFp-19,
+		  -0x1.669BC80790444p-24, -0x1.210CEDEB84955p-21, -0x1.2E99C01AE813Cp-20, -0x1.1B685046ABA66p-20, -0x1.0BCA6D9408C14p-21, -0x1.1A1952B26042Ep-23, -0x1.75EB5392896A7p-26 },
+		{ 0x1.D06F8F0557777p-32, 0x1.0288DC1FC8889p-29, -0x1.051F15B4F7777p-29, -0x1.106A007A51111p-28, 0x1.7DA24C8DF8889p-25, -0x1.E8E60AA5CCCCDp-26, 0x1.5862900A7D555p-22,
+		  0x1.A0C42A1653333p-28, 0x1.8928E5F3C8889p-25, 0x1.0BE4176554DDEp-23, 0x1.3F65B0DD0F3DEp-23, 0x1.7DE06863C10F7p-24, 0x1.FE912C172D0E0p-26, 0x1.A352CB71BB327p-28 },
+		{ -0x1.19EA42E333333p-37, 0x1.3A0F024444444p-34, 0x1.3CF99053BBBBCp-31, 0x1.BCD7E21DDDDDEp-32, -0x1.01327AE222222p-30, 0x1.08694620DDDDEp-26, 0x1.EB7CD6C59999Ap-27,
+		  -0x1.83DC900888889p-33, -0x1.08A7452D66666p-28, -0x1.C81E8949F0000p-27, -0x1.50D40C4476444p-26, -0x1.F30BA862E5BBCp-27, -0x1.9DC9A7B2DDF89p-28, -0x1.99E413D6CAD75p-30 },
+		{ 0x1.0F1E1B2AAAAABp-40, -0x1.E012422222222p-42, -0x1.737D7B1111111p-37, 0x1.295C9A4888889p-34, -0x1.0EDA379111111p-34, 0x1.311A00C444444p-31, -0x1.5E9C80FDDDDDEp-29,
+		  0x1.AB29D4C444444p-36, 0x1.4C98419CCCCCDp-32, 0x1.6CDB27C8CCCCDp-30, 0x1.4D52B1CA9BBBCp-29, 0x1.2DDB0A19BFDDEp-29, 0x1.3073D28D20FBCp-30, 0x1.6387C0A6C92C4p-32 },
+		{ -0x1.DD543AAAAAAABp-43, -0x1.8BD384CCCCCCDp-40, -0x1.3F7E1A6666666p-38, -0x1.FB5A1D5555555p-37, -0x1.C719111111111p-45, -0x1.94666BBBBBBBCp-33, -0x1.3E1D3F1DDDDDEp-31,
+		  -0x1.B2C8191111111p-39, -0x1.9CC3852222222p-36, -0x1.18FCC79AAAAABp-33, -0x1.3894433CCCCCDp-32, -0x1.54E7707806666p-32, -0x1.9AF59A84B2CCDp-33, -0x1.1563871A74F77p-34 },
+		{ -0x1.6021E00000000p-45, -0x1.BB46D11111111p-42, -0x1.2E07288888889p-40, -0x1.475A3CCCCCCCDp-39, -0x1.7E0E3CCCCCCCDp-38, -0x1.00012EEEEEEEFp-36, -0x1.B119322222222p-35,
+		  -0x1.A7B0177777777p-41, 0x1.BD51533333333p-40, 0x1.A5908A0000000p-37, 0x1.1763E17000000p-35, 0x1.69ADD97277777p-35, 0x1.00767D6AF4444p-35, 0x1.897E811189777p-37 },
+		{ 0x1.BF47777777777p-47, 0x1.00D099999999Ap-43, 0x1.5EBD888888889p-42, 0x1.65F4666666666p-41, 0x1.003E111111111p-40, 0x1.A842444444444p-39, 0x1.0F3A800000000p-38,
+		  0x1.486E555555555p-42, 0x1.9FCC444444444p-45, -0x1.1D80333333333p-40, -0x1.DAD2008888889p-39, -0x1.69DB801333333p-38, -0x1.297D443588889p-38, -0x1.FEE44E3133333p-40 },
+		{ 0x1.458CCCCCCCCCDp-46, 0x1.7432222222222p-43, 0x1.02D9111111111p-41, 0x1.FE0E000000000p-41, 0x1.ADCD777777777p-40, 0x1.4566666666666p-39, 0x1.0AB6888888889p-38,
+		  0x1.EEC3111111111p-42, 0x1.21EC000000000p-42, 0x1.8986444444444p-43, 0x1.95E54EEEEEEEFp-42, 0x1.587DBC2222222p-41, 0x1.437A1F8000000p-41, 0x1.33172D0311111p-42 },
+		{ -0x1.CBC0000000000p-49, -0x1.04ADDDDDDDDDEp-45, -0x1.6AF8888888889p-44, -0x1.64A8888888889p-43, -0x1.2687777777777p-42, -0x1.C3D999999999Ap-42, -0x1.C868888888889p-42,
+		  -0x1.5CDAAAAAAAAABp-44, -0x1.9C3999999999Ap-45, -0x1.95AAAAAAAAAABp-46, -0x1.545C000000000p-45, -0x1.44F05BBBBBBBCp-44, -0x1.5C4802BBBBBBCp-44, -0x1.6C86C44444444p-45 },
+		{ -0x1.89EBBBBBBBBBCp-48, -0x1.C1F1111111111p-45, -0x1.3887777777777p-43, -0x1.3406EEEEEEEEFp-42, -0x1.FF16666666666p-42, -0x1.783BBBBBBBBBCp-41, -0x1.E9DDDDDDDDDDEp-41,
+		  -0x1.2CC3BBBBBBBBCp-43, -0x1.55A0000000000p-44, -0x1.B6B7777777777p-46, -0x1.425DDDDDDDDDEp-50, 0x1.05EE111111111p-47, 0x1.4CE0BEEEEEEEFp-47, 0x1.79755FEEEEEEFp-48 }
+	},
+	{
+		{ 0x1.247206EA57906p-8, 0x1.4B18C1DEDE990p-5, 0x1.D1E210D15BE56p-4, 0x1.D1F225D972F63p-3, 0x1.8C4011753C4B3p-2, 0x1.32EDE65A399A9p-1, 0x1.B984873BAD6B5p-1,
+		  0x1.F964F88616E3Fp-4, 0x1.0B202D3D40D5Ap-4, 0x1.233171577B8A1p-6, 0x1.36162FF527E65p-9, 0x1.25DB0F6C197CAp-13, 0x1.AE8BA91737516p-19, 0x1.BFDD894E676C3p-26 },
+		{ -0x1.8F5868731EF81p-12, -0x1.C03B0E85E88D6p-9, -0x1.353F9A3B81CCEp-7, -0x1.2A2B610852EE1p-6, -0x1.D8B3E26ECCC93p-6, -0x1.37BCA814780E9p-5, -0x1.ED2A0F8087B6Bp-6,
+		  -0x1.6915C3EB63B4Cp-8, -0x1.0394892BD1D86p-8, -0x1.C11F3F7CA76A0p-10, -0x1.8F00B43F30C34p-12, -0x1.44E1FFCA63888p-15, -0x1.B2D64D2176E86p-20, -0x1.D66B68CBA78EAp-26 },
+		{ 0x1.92A5D05FD6418p-16, 0x1.B7600F5EBD716p-13, 0x1.1B764FB61B1C4p-11, 0x1.DAE9BD96CC62Bp-11, 0x1.0A3E30C4A51D3p-10, 0x1.31C8125693DF9p-14, -0x1.A229CD3162D8Fp-9,
+		  0x1.19E71AB30125Bp-12, 0x1.7C57092170948p-12, 0x1.04296AD8D3A2Bp-12, 0x1.3FE06D1937ADFp-14, 0x1.5FBE666B2CF6Dp-17, 0x1.4F51B01301BE9p-21, 0x1.250A36A8BAAE1p-26 },
+		{ -0x1.6D0A39EBA2E3Fp-20, -0x1.789ED24C1A6A5p-17, -0x1.A2229E043404Fp-16, -0x1.C51DE752E00D1p-16, 0x1.010F9883732DDp-16, 0x1.30DF0A173BFF6p-13, -0x1.2E316ACFBF9C1p-15,
+		  -0x1.E0ED8740453FFp-17, -0x1.0A4F59A3A8F81p-15, -0x1.EA49F2D88EF83p-16, -0x1.8D8BB9CCC74C8p-17, -0x1.27150A67D89AEp-19, -0x1.8E0359822CEE6p-23, -0x1.0909959523593p-27 },
+		{ 0x1.5328AFCD7BB66p-24, 0x1.4420F772AA6ABp-21, 0x1.198677E17F022p-20, 0x1.986CDA04DA222p-24, -0x1.FC79917CEE266p-19, -0x1.121618034529Ap-18, 0x1.54978FB5A005Ap-15,
+		  0x1.CDE64E7509B77p-21, 0x1.5B6932718FB49p-19, 0x1.A484CF0358D85p-19, 0x1.BF4A9AED4D5FDp-20, 0x1.B5A4ABA69FAD0p-22, 0x1.90F60AD8D30ABp-25, 0x1.7E674EB0A3B6Ap-29 },
+		{ -0x1.205BEA9DC599Ap-29, -0x1.3002023E72222p-27, 0x1.04A7C81E0D555p-25, 0x1.B07478F4EF99Ap-23, 0x1.DFA3AEA668889p-22, -0x1.A3D272B9DD555p-22, 0x1.43C2E9E97F99Ap-18,
+		  -0x1.76A1322F76EEFp-26, -0x1.C6F3D3E106DDEp-23, -0x1.67D54703D7066p-22, -0x1.DC7625F46233Cp-23, -0x1.26AB46EEBBB6Ep-24, -0x1.6240983063B74p-27, -0x1.CDFB588F4C670p-31 },
+		{ 0x1.0C0BF43B6CCCDp-32, 0x1.9B7C620891111p-30, 0x1.E402CE51EEEEFp-31, -0x1.8817A15CF7777p-29, 0x1.EDFE7658AEEEFp-27, 0x1.E99593B534444p-24, -0x1.B29511838999Ap-23,
+		  0x1.0770587AF3333p-28, 0x1.011A9EB303777p-26, 0x1.072AD8DF8A555p-25, 0x1.C66AF5FBEE5DEp-26, 0x1.67D10BA6F183Cp-27, 0x1.18089147BF5B4p-29, 0x1.E1DE816D4AA1Fp-33 },
+		{ -0x1.0E8D164733333p-35, -0x1.01CA3C7222222p-32, -0x1.15BE908555555p-31, -0x1.41A3073DDDDDEp-30, -0x1.39090DF8EEEEFp-28, -0x1.E8159C2000000p-29, -0x1.DAA43347CCCCDp-24,
+		  -0x1.7EB943F333333p-32, -0x1.238E77A822222p-30, -0x1.7F80A7E348889p-29, -0x1.9FB4E59B7E666p-29, -0x1.99C730B351222p-30, -0x1.9323B2D2422EFp-32, -0x1.BB35ED7AFB537p-35 },
+		{ -0x1.F749E99DDDDDEp-39, -0x1.43FE9CC000000p-35, -0x1.08FCC54BBBBBCp-33, -0x1.12FF41BCCCCCDp-32, -0x1.EB2C7CB99999Ap-32, -0x1.46E2175911111p-29, -0x1.1C05795888889p-27,
+		  -0x1.AAF6C3A222222p-35, 0x1.BB354F3888889p-34, 0x1.3B54958533333p-32, 0x1.7538D64980000p-32, 0x1.B6D9D0FA86EEFp-33, 0x1.0B0852DE42089p-34, 0x1.6D0A64DA42622p-37 },
+		{ -0x1.669A911111111p-44, -0x1.3EBEC77777777p-41, -0x1.B162ABBBBBBBCp-40, -0x1.AE4B9F7777777p-38, -0x1.4DE2D4CCCCCCDp-37, -0x1.0B06A00000000p-38, 0x1.45B8AB0EEEEEFp-30,
+		  -0x1.C97F566666666p-39, -0x1.60B978AAAAAABp-38, -0x1.708EA21111111p-36, -0x1.2CBE4A9444444p-35, -0x1.B7ABF5A72AAABp-36, -0x1.48112A2653BBCp-37, -0x1.106E796FC4089p-39 },
+		{ 0x1.5C23BDDDDDDDEp-45, 0x1.9892DDDDDDDDEp-42, 0x1.3FC7E11111111p-40, 0x1.9109855555555p-39, 0x1.8AB9D00000000p-38, 0x1.E1076D5555555p-36, 0x1.3A54B9DDDDDDEp-32,
+		  0x1.187BCCCCCCCCDp-43, -0x1.1F4CF33333333p-43, 0x1.98AAB9DDDDDDEp-40, 0x1.D81D10F777777p-39, 0x1.A2DFFF29DDDDEp-39, 0x1.7880F502FBBBCp-40, 0x1.73E3E661B0889p-42 },
+		{ 0x1.3610AAAAAAAABp-46, 0x1.6720777777777p-43, 0x1.03DC4CCCCCCCDp-41, 0x1.1400E66666666p-40, 0x1.0FF75DDDDDDDEp-39, 0x1.AECF666666666p-39, 0x1.8D86266666666p-37,
+		  0x1.AC72444444444p-42, 0x1.8598222222222p-44, -0x1.64EC777777777p-43, -0x1.79BCBCCCCCCCDp-42, -0x1.7CDA672AAAAABp-42, -0x1.952E5CC800000p-43, -0x1.D304D5F64CCCDp-45 },
+		{ 0x1.1342444444444p-46, 0x1.2F43BBBBBBBBCp-43, 0x1.ACB2444444444p-42, 0x1.AC00EEEEEEEEFp-41, 0x1.6973555555555p-40, 0x1.0A17777777777p-39, -0x1.EFDE666666666p-40,
+		  0x1.C518444444444p-42, 0x1.EA16CCCCCCCCDp-43, 0x1.3AADDDDDDDDDEp-44, 0x1.5B20800000000p-45, 0x1.4DFCAEEEEEEEFp-45, 0x1.9BE2119111111p-46, 0x1.1092FE73BBBBCp-47 },
+		{ -0x1.8D0CCCCCCCCCDp-49, -0x1.C5F999999999Ap-46, -0x1.3E61111111111p-44, -0x1.4025555555555p-43, -0x1.110999999999Ap-42, -0x1.A202222222222p-42, -0x1.3BBF777777777p-40,
+		  -0x1.4400000000000p-44, -0x1.5436666666666p-45, -0x1.9362222222222p-47, -0x1.2F1CCCCCCCCCDp-48, -0x1.224819999999Ap-48, -0x1.9F2BF80000000p-49, -0x1.3A6E3BEAAAAABp-50 },
+		{ -0x1.5114444444444p-48, -0x1.7495555555555p-45, -0x1.071199999999Ap-43, -0x1.0690888888889p-42, -0x1.BB34444444444p-42, -0x1.53BEEEEEEEEEFp-41, -0x1.CEC8888888889p-41,
+		  -0x1.12F2222222222p-43, -0x1.2929111111111p-44, -0x1.473EEEEEEEEEFp-46, -0x1.5DE4444444444p-49, 0x1.E712222222222p-53, 0x1.7275FBBBBBBBCp-52, 0x1.3E39A0CCCCCCDp-53 }
+	},
+	{
+		{ 0x1.F05E99042CFA5p-9, 0x1.1946596CD5565p-5, 0x1.8CAF5E58E0E9Cp-4, 0x1.8E65A53E795AAp-3, 0x1.55669A9E219E7p-2, 0x1.0CAB978B16288p-1, 0x1.946924EA2B40Bp-1,
+		  0x1.D03F8753BAC30p-4, 0x1.DF73BA49D74A9p-5, 0x1.F04FA4C379610p-7, 0x1.E148925372386p-10, 0x1.814185C7EA946p-14, 0x1.918B97C75529Ap-20, 0x1.53FDD579854DFp-28 },
+		{ -0x1.394A3C1C6A4BAp-12, -0x1.61950C9899050p-9, -0x1.EE04CDBB74BC6p-8, -0x1.E7A5671480BBCp-7, -0x1.948686969ADD3p-6, -0x1.283C86F6A3053p-5, -0x1.559E37A30FA2Cp-5,
+		  -0x1.2C2811AD4AE53p-8, -0x1.71F6470C53CDFp-9, -0x1.045AD655E4B4Fp-10, -0x1.756910E7D3167p-13, -0x1.D9F0624D379A4p-17, -0x1.B1A3E57E9B92Fp-22, -0x1.9BBA2271BB699p-29 },
+		{ 0x1.27461BE9A637Cp-16, 0x1.47576DB0D6EA1p-13, 0x1.B6B83BE533C4Bp-12, 0x1.8E9B14598378Ep-11, 0x1.13C940C8AF097p-10, 0x1.B6CA5FBAA7753p-11, -0x1.1D16BB217139Ep-9,
+		  0x1.A859DF46E5A47p-13, 0x1.CE52005EC481Ap-13, 0x1.0A77A0BB48FE8p-13, 0x1.0E401DC00FB3Ap-15, 0x1.C3BD1DF991857p-19, 0x1.12DE239B4C30Dp-23, 0x1.9037AC179BEF1p-30 },
+		{ -0x1.AB4FB56F536BEp-21, -0x1.C17DBCE92544Dp-18, -0x1.06978C61D9500p-16, -0x1.4AA001650AEF6p-16, 0x1.03BA37F660C5Ep-19, 0x1.CB79D56297034p-14, 0x1.91DC44ADD0F34p-12,
+		  -0x1.0C30BDAF3E516p-17, -0x1.2695B11788B8Cp-16, -0x1.CF4509EF875D0p-17, -0x1.2692042537E75p-18, -0x1.394A28ED12B46p-21, -0x1.0257EF7F94FB5p-25, -0x1.24E08A0A80AEAp-31 },
+		{ 0x1.04DDD1F25B8B3p-24, 0x1.0F84134EDACEFp-21, 0x1.354B3956C4D33p-20, 0x1.71083EBA2DD33p-20, -0x1.20A05D1162666p-23, -0x1.2555BD5511633p-18, 0x1.77EA4C02EDD4Dp-15,
+		  0x1.833D5DE31ED9Ap-21, 0x1.38688ACAE4CA2p-20, 0x1.2458DB15C1C3Ep-20, 0x1.F2202EEEA7C20p-22, 0x1.6A87759DFAF81p-24, 0x1.A1C4E2DC6FE2Ep-28, 0x1.65960C76EBA60p-33 },
+		{ -0x1.8A9E8CB5E2444p-29, -0x1.7DBCBB64EAAABp-26, -0x1.5B4D48B553777p-25, -0x1.C29198FD2CCCDp-27, 0x1.B7B0C530B0000p-24, -0x1.00BF150FB4000p-23, -0x1.A068BD42DD889p-18,
+		  -0x1.A92433BD76EEFp-26, -0x1.72CC54D5FE99Ap-24, -0x1.D03A4260C3111p-24, -0x1.E0B16ADA023BCp-25, -0x1.AA2FBDB4A699Ep-27, -0x1.39B2179198394p-30, -0x1.7A62AB1F8DCE6p-35 },
+		{ -0x1.949CAA4DAAAABp-32, -0x1.026D0763F2222p-28, -0x1.C042E71888889p-27, -0x1.1F3014A134CCDp-25, -0x1.2AF35BDD25DDEp-24, -0x1.84FCE4A4FF777p-24, -0x1.3001CC3470111p-20,
+		  -0x1.5534BBF92CCCDp-28, 0x1.1022B142EDDDEp-27, 0x1.AB7FA4299B111p-27, 0x1.D071DC4B01111p-28, 0x1.D2F9FEACF1466p-30, 0x1.ABAB68BD9CA0Dp-33, 0x1.61392BCDAE2F9p-37 },
+		{ -0x1.8001D86CCCCCDp-36, -0x1.960FDEC777777p-33, -0x1.FFCCE4A19999Ap-32, -0x1.003043AAEEEEFp-30, -0x1.6AFA0C519999Ap-29, -0x1.64463F279999Ap-27, 0x1.A37274C26AAABp-24,
+		  -0x1.15D0E91DDDDDEp-31, -0x1.06E367B444444p-32, -0x1.2156CFD4AAAABp-31, -0x1.23EF8FD804444p-31, -0x1.AFB99498B6666p-33, -0x1.0906B8903CBBCp-35, -0x1.27DBE9DE25DB3p-39 },
+		{ 0x1.2FF7756EEEEEFp-37, 0x1.5F419C5666666p-34, 0x1.05C3C18111111p-32, 0x1.2C510CBB33333p-31, 0x1.562372EC44444p-30, 0x1.9780B0FF33333p-29, 0x1.EF7E59CE55555p-26,
+		  0x1.AD3D9B8EEEEEFp-34, -0x1.2F3327999999Ap-37, 0x1.9C02B22000000p-37, 0x1.8DB7CDB3BBBBCp-35, 0x1.9149F0874AAABp-36, 0x1.36B79A3BBFDDEp-38, 0x1.C2A085EED8622p-42 },
+		{ 0x1.03E5DAE666666p-40, 0x1.343DEA2222222p-37, 0x1.DAE52A7777777p-36, 0x1.0FDCEC2AAAAABp-34, 0x1.1ED962A222222p-33, 0x1.9128ECF777777p-32, -0x1.34C5944AAAAABp-30,
+		  0x1.0E2EF6CCCCCCDp-36, -0x1.EC6EBE6666666p-38, -0x1.C4EDD8CCCCCCDp-37, -0x1.06FE48B3BBBBCp-37, -0x1.8C705165DDDDEp-39, -0x1.587AD92175555p-41, -0x1.3A7FCFA7E0222p-44 },
+		{ -0x1.0922FEEEEEEEFp-43, -0x1.35C646EEEEEEFp-40, -0x1.D3F82DDDDDDDEp-39, -0x1.07823B7777777p-37, -0x1.1B4F06AAAAAABp-36, -0x1.9A57046666666p-35, -0x1.833E7F9555555p-31,
+		  -0x1.52C4E11111111p-40, 0x1.7E2CAAAAAAAABp-43, 0x1.67FCE5999999Ap-41, 0x1.25D6733333333p-41, 0x1.3A844A3444444p-42, 0x1.6168494A77777p-44, 0x1.950B30052BBBCp-47 },
+		{ -0x1.2B36E66666666p-46, -0x1.6989111111111p-43, -0x1.21D2A22222222p-41, -0x1.6893B33333333p-40, -0x1.AE91088888889p-39, -0x1.332F044444444p-37, -0x1.F0A1DDDDDDDDEp-41,
+		  -0x1.E51F777777777p-44, 0x1.1A16AAAAAAAABp-42, 0x1.BB59BBBBBBBBCp-43, 0x1.C038F77777777p-47, -0x1.B8DEEBBBBBBBCp-46, -0x1.58E4D74666666p-47, -0x1.E4081F7E88889p-50 },
+		{ 0x1.D02D111111111p-47, 0x1.028D777777777p-43, 0x1.6DD4888888889p-42, 0x1.6E29333333333p-41, 0x1.374CEEEEEEEEFp-40, 0x1.03E9000000000p-39, 0x1.44D0B77777777p-36,
+		  0x1.8D29777777777p-42, 0x1.B209DDDDDDDDEp-43, 0x1.0BC7888888889p-44, 0x1.B9B7BBBBBBBBCp-47, 0x1.F3FC622222222p-49, 0x1.4A029D7777777p-50, 0x1.0E96200CCCCCDp-52 },
+		{ -0x1.0327777777777p-49, -0x1.1E88888888889p-46, -0x1.8853333333333p-45, -0x1.7364444444444p-44, -0x1.1328888888889p-43, -0x1.D3EEEEEEEEEEFp-44, 0x1.9262222222222p-43,
+		  -0x1.0B33333333333p-44, -0x1.43ACCCCCCCCCDp-45, -0x1.B28CCCCCCCCCDp-47, -0x1.2F7F777777777p-49, -0x1.B3AB333333333p-52, -0x1.30BA755555555p-53, -0x1.2B41BD0000000p-55 },
+		{ -0x1.164EEEEEEEEEFp-48, -0x1.36B8888888889p-45, -0x1.B7C6666666666p-44, -0x1.B843333333333p-43, -0x1.75A7777777777p-42, -0x1.20B5DDDDDDDDEp-41, -0x1.32D2AAAAAAAABp-40,
+		  -0x1.F32999999999Ap-44, -0x1.05ECCCCCCCCCDp-44, -0x1.1C94CCCCCCCCDp-46, -0x1.1E77777777777p-49, -0x1.9F2999999999Ap-54, 0x1.AB54666666666p-57, 0x1.2478AD5555555p-58 }
+	},
+	{
+		{ 0x1.AA8D4CF9E4C2Ep-9, 0x1.E39F5EC2C3F01p-6, 0x1.555775FD2F2CFp-4, 0x1.5762F31A373D8p-3, 0x1.27282001A5F98p-2, 0x1.D3866617327BAp-2, 0x1.670FC51ADE893p-1,
+		  0x1.ADD313CD1F4D6p-4, 0x1.B769E29261741p-5, 0x1.BCBD1FD7CBE07p-7, 0x1.9E14BBE6369E5p-10, 0x1.34071BD6E5C9Ap-14, 0x1.146C5E4B67E59p-20, 0x1.2D4ED7EC837B4p-29 },
+		{ -0x1.EF86B3CC354B3p-13, -0x1.187C935E12512p-9, -0x1.8A9A48F85CDC2p-8, -0x1.8A8A0A2F35AEAp-7, -0x1.4F596245AD993p-6, -0x1.036B2BEBBF79Ap-5, -0x1.70C37823D75EEp-5,
+		  -0x1.F82B3155E30A1p-9, -0x1.15D735D11777Ap-9, -0x1.463EA93AC44DFp-11, -0x1.7B2E17B55B534p-14, -0x1.7E7623D214F44p-18, -0x1.0691770F05A74p-23, -0x1.20757D6DB1EB3p-31 },
+		{ 0x1.D4A89CF11411Dp-17, 0x1.06FC55ADD27B7p-13, 0x1.6AC4033E157B0p-12, 0x1.5D6D7BA059165p-11, 0x1.13F5F679B38B1p-10, 0x1.63CE3A58C9282p-10, 0x1.196A2B454F963p-11,
+		  0x1.613300C394213p-13, 0x1.210A865420853p-13, 0x1.0DC7526CB4F95p-14, 0x1.D0E7BA96955DDp-17, 0x1.43479EE26D17Bp-20, 0x1.27368C84F50AFp-25, 0x1.C7AA8D385C974p-33 },
+		{ -0x1.00997DE50B308p-21, -0x1.11B4FBCE90440p-18, -0x1.4C1B9B4FFBFBFp-17, -0x1.D44325EF6273Cp-17, -0x1.556E456AC4C2Fp-18, 0x1.D3BBB3C8811BAp-15, 0x1.A724CEAFAECA9p-12,
+		  -0x1.103E7E2B95692p-18, -0x1.63FF44DD4B4B5p-17, -0x1.041C20016F408p-17, -0x1.178DC80E3EDCEp-19, -0x1.CA0EFED7C4699p-23, -0x1.F72BA9A6F944Dp-28, -0x1.09BC013C33B64p-34 },
+		{ 0x1.025AA029ED400p-26, 0x1.D996DC9262FBCp-24, 0x1.3B31F7EE81333p-23, -0x1.4C1636333319Ap-22, -0x1.465A6BCE7C989p-19, -0x1.506E23A329A09p-17, -0x1.3C1C414856F93p-15,
+		  0x1.882D1E55E8800p-23, 0x1.6DD96B6C0E822p-21, 0x1.39EF110F92D26p-21, 0x1.96DD871DF8E09p-23, 0x1.A5740F1AE1C89p-26, 0x1.3860D45208E83p-30, 0x1.F9EDDAD2D4FE2p-37 },
+		{ -0x1.46E7DD8408111p-28, -0x1.6B9291B78E000p-25, -0x1.EC35E5BC23BBCp-24, -0x1.CD8F5998DC889p-23, -0x1.696D59D010AABp-22, -0x1.36182AA89B333p-21, -0x1.5B54311569622p-18,
+		  -0x1.1FE31C810AEEFp-24, -0x1.86A19B9B90444p-26, -0x1.D0816B288D555p-27, -0x1.477BCA95394CDp-27, -0x1.30C34953A3F00p-29, -0x1.603F86F5C8626p-33, -0x1.B8AA620100CEAp-39 },
+		{ 0x1.63006BCACEEEFp-32, 0x1.8F3F21E6D7777p-29, 0x1.1710A3F97BBBCp-27, 0x1.1D2F375A4EEEFp-26, 0x1.1C6E3D49E6666p-25, 0x1.B211AA0F03BBCp-24, 0x1.340E77ADDDBBCp-20,
+		  0x1.4F1841F9F7777p-29, 0x1.E87731C8DDDDEp-30, 0x1.2EFE5600AEEEFp-29, 0x1.776B46BFCBDDEp-30, 0x1.567A6FB7A599Ap-32, 0x1.B9B9209AD2A00p-36, 0x1.67784FB0D1E53p-41 },
+		{ 0x1.4F12D35B11111p-34, 0x1.8C75335977777p-31, 0x1.3146D28700000p-29, 0x1.5F82805D88889p-28, 0x1.6BDD79B766666p-27, 0x1.638AAF7044444p-26, 0x1.71C8B3B5E6666p-25,
+		  0x1.3FA6C22266666p-30, -0x1.24F1D99E22222p-31, -0x1.D258EB4333333p-31, -0x1.531C8E496AAABp-32, -0x1.B14D3156EAAABp-35, -0x1.06591DADAC889p-38, -0x1.0A2D1FC3D2E44p-43 },
+		{ -0x1.B8EF2A4444444p-38, -0x1.06B8048111111p-34, -0x1.9B59EC9BBBBBCp-33, -0x1.E9CD1B8AAAAABp-32, -0x1.11D7E53777777p-30, -0x1.5E92FB0622222p-29, -0x1.EC91CA30EEEEFp-26,
+		  -0x1.79AEB95DDDDDEp-35, 0x1.C47E519111111p-36, 0x1.534CEA1333333p-35, 0x1.25A0E85644444p-36, 0x1.0B044C5FDDDDEp-38, 0x1.E284899F20000p-42, 0x1.64FFC562A2DDEp-46 },
+		{ -0x1.D98677B333333p-40, -0x1.1572EFD99999Ap-36, -0x1.A4EB717777777p-35, -0x1.E079BE3333333p-34, -0x1.FF1B1F9111111p-33, -0x1.1F79FA8888889p-31, 0x1.5F334E6EEEEEFp-31,
+		  -0x1.CAA8963333333p-36, 0x1.0B7432EEEEEEFp-37, 0x1.ADE84E2666666p-37, 0x1.7D10E40CCCCCDp-39, -0x1.1054CE1111111p-45, -0x1.91200A90EEEEFp-45, -0x1.C1D3B5E9BBBBCp-49 },
+		{ 0x1.2BF94DDDDDDDEp-43, 0x1.658A13BBBBBBCp-40, 0x1.199E3A2222222p-38, 0x1.5889A6EEEEEEFp-37, 0x1.9FC2EBBBBBBBCp-36, 0x1.3550F83333333p-34, 0x1.58E7B8DDDDDDEp-31,
+		  0x1.67D99DDDDDDDEp-41, -0x1.620BA00000000p-41, -0x1.1EA2366666666p-41, -0x1.182A6E6666666p-45, 0x1.139BE4CCCCCCDp-45, 0x1.C46A873222222p-48, 0x1.0F11DB1B6AAABp-51 },
+		{ 0x1.7DF4C88888889p-45, 0x1.BF44955555555p-42, 0x1.5232D55555555p-40, 0x1.7EFCDDDDDDDDEp-39, 0x1.90650CCCCCCCDp-38, 0x1.B92B088888889p-37, -0x1.9A5A2AAAAAAABp-35,
+		  0x1.B7DFA22222222p-41, -0x1.E68DDDDDDDDDEp-45, -0x1.2485022222222p-42, -0x1.7600DBBBBBBBCp-44, -0x1.6F80B44444444p-47, -0x1.EDAAB35555555p-51, -0x1.2F35347000000p-54 },
+		{ 0x1.0F6199999999Ap-47, 0x1.2BD6EEEEEEEEFp-44, 0x1.8FC6EEEEEEEEFp-43, 0x1.5D40000000000p-42, 0x1.954D555555555p-42, -0x1.A3AD555555555p-42, -0x1.5D164CCCCCCCDp-37,
+		  0x1.609A222222222p-42, 0x1.9A7C888888889p-43, 0x1.F5F5111111111p-45, 0x1.1A97EEEEEEEEFp-47, 0x1.3019222222222p-51, 0x1.321D511111111p-54, 0x1.36A7EA8000000p-57 },
+		{ -0x1.758BBBBBBBBBCp-49, -0x1.AD67777777777p-46, -0x1.36CCCCCCCCCCDp-44, -0x1.476CCCCCCCCCDp-43, -0x1.327CCCCCCCCCDp-42, -0x1.1A91111111111p-41, 0x1.482AAAAAAAAABp-40,
+		  -0x1.3FF6666666666p-44, -0x1.E7B7777777777p-46, -0x1.457BBBBBBBBBCp-49, 0x1.83FBBBBBBBBBCp-51, 0x1.8C95555555555p-54, -0x1.1D52EEEEEEEEFp-58, -0x1.4172E00000000p-60 },
+		{ -0x1.D2D5555555555p-49, -0x1.07B2222222222p-45, -0x1.733DDDDDDDDDEp-44, -0x1.7120000000000p-43, -0x1.39C0000000000p-42, -0x1.D6A7777777777p-42, -0x1.1F11111111111p-41,
+		  -0x1.CE0EEEEEEEEEFp-44, -0x1.D9E8888888889p-45, -0x1.E6C0000000000p-47, -0x1.DA6DDDDDDDDDEp-50, -0x1.5433333333333p-54, -0x1.1FC4444444444p-63, 0x1.3169377777777p-63 }
+	},
+	{
+		{ 0x1.7372B5493DC52p-9, 0x1.A5320DEC07D8Ep-6, 0x1.295B9A08CBE7Dp-4, 0x1.2B477DA94617Ep-3, 0x1.0175ECBD15E68p-2, 0x1.988308D3F61DEp-2, 0x1.3B5CA7F983233p-1,
+		  0x1.90F1DB5E95CF3p-4, 0x1.98969AF9892F1p-5, 0x1.9AA68E2D1D902p-7, 0x1.79928C4739D97p-10, 0x1.12AD853E134DDp-14, 0x1.D7955677A658Bp-21, 0x1.C4F47F9E3E6C0p-30 },
+		{ -0x1.85FF0FB53AA29p-13, -0x1.BA10ABC070C96p-10, -0x1.37D6A2AB150ACp-8, -0x1.396614ECBE3D8p-7, -0x1.0CEA86E8F9AA9p-6, -0x1.A885C587259AFp-6, -0x1.4305536A7B2F8p-5,
+		  -0x1.A611AEA2F7E1Ap-9, -0x1.B7422CB905580p-10, -0x1.CDA77CBB45FFEp-12, -0x1.C96E0F68011B7p-15, -0x1.76C4E9DB35BEBp-19, -0x1.87B798D3BF347p-25, -0x1.1690FD169B8AAp-33 },
+		{ 0x1.778949152E33Ep-17, 0x1.A88703C24FD14p-14, 0x1.29AD049F20751p-12, 0x1.27EADB91D7D29p-11, 0x1.F1CD572614E8Fp-11, 0x1.78C069148B80Dp-10, 0x1.F24CB2560161Ap-10,
+		  0x1.2E9B17A276A50p-13, 0x1.74A537C380547p-14, 0x1.02A7EB2A3D6F4p-15, 0x1.63E829495A5D9p-18, 0x1.9CA24D113C262p-22, 0x1.364567D3D6A01p-27, 0x1.507C1510E0B71p-35 },
+		{ -0x1.F9525C025D45Bp-22, -0x1.18A2859C46134p-18, -0x1.79DCC668E38BBp-17, -0x1.5AB9F7D9E3C8Ep-16, -0x1.EB8DF32C976E3p-16, -0x1.B1421576B441Bp-16, 0x1.02A3D3B55BE8Bp-14,
+		  -0x1.2870C613A8E24p-18, -0x1.930785EE26229p-18, -0x1.E5A984FD413B2p-19, -0x1.CE79FA2C0CF1Ep-21, -0x1.49A27AB0ECE23p-24, -0x1.2264ADE6B2172p-29, -0x1.7AC01232661E5p-37 },
+		{ -0x1.76C050E974AABp-29, -0x1.56296718EF4CDp-25, -0x1.BE131FC5F459Ap-23, -0x1.9D5A96DC7B7DEp-21, -0x1.4865DC1081055p-19, -0x1.032B46225BEC4p-17, -0x1.106BD1574699Ep-15,
+		  -0x1.259FD5688B3BCp-23, 0x1.EEE2ED9FB8E22p-22, 0x1.C4DDBBA5A3F4Dp-22, 0x1.F315CDA53CB8Bp-24, 0x1.89106C9DA4634p-27, 0x1.84800C7B32D4Cp-32, 0x1.3872FC05C7712p-39 },
+		{ 0x1.29C357535F777p-30, 0x1.81BA2EBA42EEFp-27, 0x1.5CCC153BDC889p-25, 0x1.EE9ADAF982222p-24, 0x1.4A67502920333p-22, 0x1.D99F5FB0A0555p-21, 0x1.F0E888674BE66p-19,
+		  0x1.1C7980703999Ap-27, -0x1.B84063C04199Ap-26, -0x1.BD23684C01111p-26, -0x1.18C7CC9BF5E66p-27, -0x1.0A1DB094D9055p-30, -0x1.53590A3F6333Cp-35, -0x1.92DC7E31E8A24p-42 },
+		{ 0x1.45F25BA25EEEFp-32, 0x1.71E647E7CCCCDp-29, 0x1.057D68F884444p-27, 0x1.076783657BBBCp-26, 0x1.C3E89849C1111p-26, 0x1.602975C7B0000p-25, 0x1.175FFA90E999Ap-24,
+		  0x1.606A5E6588889p-28, -0x1.DA48DD5D11111p-32, -0x1.6974EC49E7777p-30, -0x1.B61C0A5A4999Ap-33, 0x1.4752A4A150CCDp-36, 0x1.92D3F07353800p-39, 0x1.DD4104F18859Ap-45 },
+		{ -0x1.0135562A55555p-34, -0x1.2BE0EBF044444p-31, -0x1.C2279F4688889p-30, -0x1.F970622088889p-29, -0x1.07D8097C9999Ap-27, -0x1.3308E2D877777p-26, -0x1.571505CEFBBBCp-24,
+		  -0x1.866DA69000000p-31, 0x1.72859C5C44444p-33, 0x1.385C396C44444p-32, 0x1.043DB2A7CCCCDp-34, 0x1.B3E7BC9CCCCCDp-41, -0x1.67C0EE4993333p-42, -0x1.356A97F99D555p-47 },
+		{ -0x1.27A5405DDDDDEp-41, -0x1.3960603333333p-38, -0x1.612C72AAAAAABp-37, -0x1.B96145DDDDDDEp-38, 0x1.160582F333333p-34, 0x1.4A2C1D7CCCCCDp-31, 0x1.434803A688889p-27,
+		  -0x1.48FE5AAAAAAABp-35, 0x1.FFCF22BBBBBBCp-37, 0x1.BCC32C1CCCCCDp-36, 0x1.3DBAD2F7BBBBCp-37, 0x1.68DEF2B255555p-40, 0x1.4E31CCF2A6666p-44, 0x1.A2B4C21E92222p-50 },
+		{ 0x1.4B628B4CCCCCDp-40, 0x1.845B6E7777777p-37, 0x1.2607BD3BBBBBCp-35, 0x1.4C50260888889p-34, 0x1.561497FBBBBBCp-33, 0x1.61D3CA7333333p-32, 0x1.7F670BBBBBBBCp-32,
+		  0x1.2554024444444p-36, -0x1.9498686666666p-38, -0x1.45799B4000000p-37, -0x1.7C486C5111111p-39, -0x1.3ACC8D5E66666p-42, -0x1.9E241F6555555p-47, -0x1.EAF587C62AAABp-53 },
+		{ -0x1.BBA18D5555555p-44, -0x1.087A380000000p-40, -0x1.9D21ECCCCCCCDp-39, -0x1.F0ED9BBBBBBBCp-38, -0x1.204D5C6666666p-36, -0x1.88D209BBBBBBCp-35, -0x1.01FB5FD555555p-32,
+		  -0x1.22B7377777777p-40, 0x1.55FD333333333p-45, 0x1.44D8091111111p-42, 0x1.7FB8504444444p-44, 0x1.51FE8F0000000p-47, 0x1.6D4E3DE222222p-51, 0x1.C838A8CF77777p-56 },
+		{ -0x1.64FB000000000p-47, -0x1.A3DF111111111p-44, -0x1.41D0111111111p-42, -0x1.6D81EEEEEEEEFp-41, -0x1.6A3D6EEEEEEEFp-40, -0x1.0D12A22222222p-39, 0x1.A37799999999Ap-36,
+		  -0x1.3120888888889p-44, 0x1.BC5CDDDDDDDDEp-43, 0x1.8FE1EAAAAAAABp-43, 0x1.A2550CCCCCCCDp-45, 0x1.1F8135DDDDDDEp-48, 0x1.2304B11111111p-54, -0x1.78905D2AAAAABp-59 },
+		{ 0x1.B7E2CCCCCCCCDp-47, 0x1.00BAEEEEEEEEFp-43, 0x1.716399999999Ap-42, 0x1.87D2444444444p-41, 0x1.710E99999999Ap-40, 0x1.611D888888889p-39, 0x1.0E8C99999999Ap-38,
+		  0x1.8861DDDDDDDDEp-42, 0x1.4936AAAAAAAABp-43, 0x1.9263777777777p-46, -0x1.99F7777777777p-52, -0x1.B98B99999999Ap-53, -0x1.D612666666666p-60, 0x1.95E7611111111p-62 },
+		{ -0x1.C34AAAAAAAAABp-50, -0x1.01FBBBBBBBBBCp-46, -0x1.6E24444444444p-45, -0x1.760AAAAAAAAABp-44, -0x1.4FA3333333333p-43, -0x1.3AA3333333333p-42, -0x1.1BE2222222222p-40,
+		  -0x1.DD26666666666p-45, -0x1.06A7777777777p-45, -0x1.3552222222222p-47, -0x1.7FB999999999Ap-50, -0x1.B26F777777777p-54, -0x1.ACC3BBBBBBBBCp-59, -0x1.10E27BBBBBBBCp-64 },
+		{ -0x1.9CE3333333333p-49, -0x1.DE53333333333p-46, -0x1.4F8CCCCCCCCCDp-44, -0x1.54D1111111111p-43, -0x1.271E666666666p-42, -0x1.D963333333333p-42, -0x1.44DCCCCCCCCCDp-41,
+		  -0x1.B1FBBBBBBBBBCp-44, -0x1.AFC2222222222p-45, -0x1.AFE999999999Ap-47, -0x1.7065555555555p-50, -0x1.D4BEEEEEEEEEFp-55, -0x1.20C3333333333p-61, 0x1.873D555555555p-68 }
+	},
+	{
+		{ 0x1.4812BCA797F04p-9, 0x1.74050A60AE98Bp-6, 0x1.06A730BF4C747p-4, 0x1.085F79A513027p-3, 0x1.C6EE956BA71A7p-3, 0x1.69065380B0A55p-2, 0x1.16EC314EFD77Cp-1,
+		  0x1.78C723916BD45p-4, 0x1.7FB4BCF900F27p-5, 0x1.811526CDDFC57p-7, 0x1.6127C4B845785p-10, 0x1.FF8AB25C2B68Dp-15, 0x1.B3645DD4A41C3p-21, 0x1.9906E2AAC097Fp-30 },
+		{ -0x1.33E39F28FB898p-13, -0x1.5D1C794E2F1A7p-10, -0x1.ECE50A10FCEC3p-9, -0x1.F00253E3A1CC3p-8, -0x1.AA990413BCCB8p-7, -0x1.5249ED69F81D7p-6, -0x1.04DF064EAFC52p-5,
+		  -0x1.61C3F1CED5B45p-9, -0x1.69A944BF28535p-10, -0x1.6E007D53BE75Dp-12, -0x1.548C58F0F58FCp-15, -0x1.F966B747BF756p-20, -0x1.C15B9FFA1354Bp-26, -0x1.D22426076AE83p-35 },
+		{ 0x1.1AAD97C742046p-17, 0x1.405950E567AEAp-14, 0x1.C3BDF2214E8FAp-13, 0x1.C5A032A426C42p-12, 0x1.84B0E18F188B7p-11, 0x1.32029CF63EA66p-10, 0x1.CEF4104BABA1Dp-10,
+		  0x1.E6367E3E2BA87p-14, 0x1.035D93DE09C05p-14, 0x1.1E2ED60FB0E22p-16, 0x1.30587CCCD562Ep-19, 0x1.10EA98584E8CAp-23, 0x1.3D1C861EDB7B1p-29, 0x1.F4F9119507B95p-38 },
+		{ -0x1.CE74580723626p-22, -0x1.05194F06F4268p-18, -0x1.6D422ECE18B68p-17, -0x1.69821B53C36EAp-16, -0x1.2DBBA450FE8D7p-15, -0x1.C1EBD49EA16F4p-15, -0x1.1E086DC4266E3p-14,
+		  -0x1.3ED407350461Bp-18, -0x1.BD1DB59C64399p-19, -0x1.64365104A7DC4p-20, -0x1.0FCE376014BA3p-22, -0x1.4EE2F69DC63B6p-26, -0x1.011BDE47F5305p-31, -0x1.0A2E99E946F14p-39 },
+		{ 0x1.A37C3B6A12C89p-27, 0x1.CA990D5CC4822p-24, 0x1.2920546327E89p-22, 0x1.F5A1849993D55p-22, 0x1.1B080C20A9000p-21, -0x1.AA663039F199Ap-25, -0x1.12D496C62D755p-18,
+		  0x1.18BE6425B1DDEp-24, 0x1.E2FB96ECF059Ap-23, 0x1.5DCCDB25C354Dp-23, 0x1.5D8FD40A6C180p-25, 0x1.F368D5CFAA47Cp-29, 0x1.A9385AD4B8CBEp-34, 0x1.ED17436A4368Dp-42 },
+		{ 0x1.0DA2EB142C889p-30, 0x1.48EE0E6E05111p-27, 0x1.0CA1962B2A666p-25, 0x1.511B188116222p-24, 0x1.8AF16E9DB6666p-23, 0x1.E7FE8B92CD99Ap-22, 0x1.94816D5934AABp-20,
+		  0x1.309A2F01FDDDEp-26, -0x1.37E9AFCCB4000p-26, -0x1.55297B808399Ap-26, -0x1.7B4E9EAA7C444p-28, -0x1.20583F333CFBCp-31, -0x1.0633A988327CDp-36, -0x1.56BB8797372B3p-44 },
+		{ -0x1.5B2F620D7999Ap-33, -0x1.9E3CCE8BAEEEFp-30, -0x1.4512504E1CCCDp-28, -0x1.842A6E62E999Ap-27, -0x1.B12489EE3CCCDp-26, -0x1.038D598D93BBCp-24, -0x1.C0D2C510C8889p-23,
+		  -0x1.F458D61CDDDDEp-30, 0x1.47D11B5BCCCCDp-30, 0x1.A7837A1B75555p-30, 0x1.F81E56F7A7777p-32, 0x1.9F687524B7BBCp-35, 0x1.AB19A81362222p-40, 0x1.5FA42E0D1FEABp-47 },
+		{ -0x1.87654FBBBBBBCp-43, 0x1.EF56446666666p-40, 0x1.D9D4B74CCCCCDp-36, 0x1.37FE69CEEEEEFp-33, 0x1.343381F222222p-31, 0x1.300EE18E22222p-29, 0x1.D412CC20EEEEFp-27,
+		  -0x1.85700A9333333p-34, -0x1.A2E5755555555p-43, 0x1.C92902B99999Ap-37, -0x1.30C35FD555555p-41, -0x1.EC74B63A66666p-41, -0x1.3B04079808889p-44, -0x1.0B3715B4E6EEFp-50 },
+		{ 0x1.83DA46CAAAAABp-39, 0x1.C0DE784CCCCCDp-36, 0x1.4AD891899999Ap-34, 0x1.658F994111111p-33, 0x1.571331B888889p-32, 0x1.3F1CB5A777777p-31, 0x1.FB2E78FBBBBBCp-31,
+		  0x1.7DBC0DB333333p-35, -0x1.AF651C0000000p-37, -0x1.6B94EA8CCCCCDp-36, -0x1.7BF5D1E555555p-38, -0x1.C127B8219999Ap-42, -0x1.3B37E744CCCCDp-48, 0x1.631766AC6EEEFp-54 },
+		{ -0x1.A664197777777p-42, -0x1.EF2AFC6666666p-39, -0x1.77645CBBBBBBCp-37, -0x1.AABDF5DDDDDDEp-36, -0x1.C064E88888889p-35, -0x1.F761414444444p-34, -0x1.8F522F0000000p-32,
+		  -0x1.46D33EAAAAAABp-38, 0x1.47154C4444444p-40, 0x1.2B6BC7EEEEEEFp-39, 0x1.41169BDDDDDDEp-41, 0x1.8869DDF777777p-45, 0x1.2034DCE222222p-51, -0x1.7BF1B0199999Ap-57 },
+		{ -0x1.D3CAC44444444p-48, -0x1.E240333333333p-45, -0x1.D8FF800000000p-44, -0x1.8C6C000000000p-46, 0x1.9C8A955555555p-41, 0x1.53E6B66666666p-38, 0x1.6DB38B3333333p-35,
+		  -0x1.1C85D11111111p-41, -0x1.4999111111111p-43, 0x1.DB5ADDDDDDDDEp-46, 0x1.590BE22222222p-46, 0x1.8BB7980000000p-49, 0x1.3ACC120000000p-53, 0x1.353ED2FDDDDDEp-59 },
+		{ 0x1.8DB7222222222p-47, 0x1.CA61888888889p-44, 0x1.4B79911111111p-42, 0x1.59D6222222222p-41, 0x1.3742000000000p-40, 0x1.F39A333333333p-40, -0x1.9306666666666p-43,
+		  0x1.474A777777777p-42, 0x1.591F555555555p-44, -0x1.6B67111111111p-46, -0x1.7650444444444p-47, -0x1.4BFCF33333333p-50, -0x1.5B28700000000p-55, -0x1.98174B3333333p-62 },
+		{ 0x1.0899BBBBBBBBCp-47, 0x1.2E72000000000p-44, 0x1.A5CA000000000p-43, 0x1.A3D2444444444p-42, 0x1.5C15777777777p-41, 0x1.003CAAAAAAAABp-40, 0x1.7895555555555p-40,
+		  0x1.3F91555555555p-42, 0x1.5138444444444p-43, 0x1.7F66888888889p-45, 0x1.92BB777777777p-48, 0x1.719EEEEEEEEEFp-52, 0x1.E152222222222p-58, 0x1.8D4A6AAAAAAABp-65 },
+		{ -0x1.9BD3333333333p-50, -0x1.D8CEEEEEEEEEFp-47, -0x1.4E16666666666p-45, -0x1.4E62222222222p-44, -0x1.1A40000000000p-43, -0x1.A968888888889p-43, -0x1.0011111111111p-42,
+		  -0x1.D6BDDDDDDDDDEp-45, -0x1.DB82222222222p-46, -0x1.D006666666666p-48, -0x1.98B3333333333p-51, -0x1.0A71111111111p-55, -0x1.A43999999999Ap-62, -0x1.79DAAAAAAAAABp-69 },
+		{ -0x1.636DDDDDDDDDEp-49, -0x1.96C2222222222p-46, -0x1.1E69111111111p-44, -0x1.219199999999Ap-43, -0x1.F0D2222222222p-43, -0x1.899EEEEEEEEEFp-42, -0x1.360EEEEEEEEEFp-41,
+		  -0x1.91B5555555555p-44, -0x1.951999999999Ap-45, -0x1.A268888888889p-47, -0x1.7C44444444444p-50, -0x1.1BADDDDDDDDDEp-54, -0x1.05FAAAAAAAAABp-60, -0x1.E08999999999Ap-70 }
+	},
+	{
+		{ 0x1.2594AB2ADF688p-9, 0x1.4CE8650DE01E4p-6, 0x1.D614E028993E4p-5, 0x1.D92A2C3498867p-4, 0x1.971E1544FB460p-3, 0x1.431756080C1F1p-2, 0x1.F345DD596C6E0p-2,
+		  0x1.646AD18A99992p-4, 0x1.6AEFBBC10FAB3p-5, 0x1.6C29C58CA1F4Dp-7, 0x1.4DD984D2D46CAp-10, 0x1.E347F23F3C008p-15, 0x1.9ADFEF9CDD339p-21, 0x1.80F63EF3F7156p-30 },
+		{ -0x1.EE449AD05755Ap-14, -0x1.183CBE88ADD5Fp-10, -0x1.8BB3D0D43EB6Bp-9, -0x1.8E4996BDE69AFp-8, -0x1.56AD5841551FFp-7, -0x1.0FEDEBAB86400p-6, -0x1.A422DC3859BB7p-6,
+		  -0x1.2C0C3B761D95Dp-9, -0x1.31B059DA7807Bp-10, -0x1.330DF6E1CFAD7p-12, -0x1.1A05D444DF3EBp-15, -0x1.998992471CC90p-20, -0x1.5E2256C8E0D39p-26, -0x1.4C30436875325p-35 },
+		{ 0x1.9E8AB50CC1D43p-18, 0x1.D608455ACB2A4p-15, 0x1.4BCAD72EFF789p-13, 0x1.4DDC4125E7371p-12, 0x1.1F19A2860E477p-11, 0x1.C73AA748DC226p-11, 0x1.5EE43CF90AD77p-10,
+		  0x1.79574DEF3579Fp-14, 0x1.832BE891DE4D2p-15, 0x1.8ADCA0C1BFA68p-17, 0x1.742C1E15F04BBp-20, 0x1.19D2FCFDD366Bp-24, 0x1.02D7E2AF290A0p-30, 0x1.1C5B692C30D53p-39 },
+		{ -0x1.5348ED7D58C64p-22, -0x1.80797ED6775DAp-19, -0x1.0F0C58E21A699p-17, -0x1.101EB44F0B831p-16, -0x1.D230D6759884Ep-16, -0x1.6EE516D451E93p-15, -0x1.15AA9E6FF8C62p-14,
+		  -0x1.FEB3885414F9Ep-19, -0x1.158FD1B9087C0p-19, -0x1.3CD5DD6FC06D6p-21, -0x1.5FF25D23509C7p-24, -0x1.4A9CFEDA9E751p-28, -0x1.904B9BFDB91F2p-34, -0x1.417F8581EA99Dp-42 },
+		{ 0x1.EB02B67F672CDp-27, 0x1.15307B0BCE3DEp-23, 0x1.83AFF8ACDD155p-22, 0x1.7FA08106E42EFp-21, 0x1.403EB677AB333p-20, 0x1.DEAAE3A3F5D11p-20, 0x1.3795A8EC86D11p-19,
+		  0x1.2D34B0E7791DEp-23, 0x1.C761E7DFFCF77p-24, 0x1.8783DFCC65C66p-25, 0x1.371E1CFACD7DEp-27, 0x1.858A728C2A689p-31, 0x1.29553E9DB32B3p-36, 0x1.25A5F7F943906p-44 },
+		{ -0x1.57345319D8889p-32, -0x1.745EDAEA2DDDEp-29, -0x1.D9A80CA39999Ap-28, -0x1.7F6B1466C2222p-27, -0x1.7A283DA080000p-27, 0x1.0C36C3881DDDEp-27, 0x1.F463F010C3BBCp-24,
+		  -0x1.6F1D6A6444444p-32, -0x1.DDEE6DDCC999Ap-28, -0x1.78D22289F3BBCp-28, -0x1.7E13F9E928000p-30, -0x1.0EF86336E2D55p-33, -0x1.C0DD654259333p-39, -0x1.E0CC67CE0A111p-47 },
+		{ -0x1.81285C303BBBCp-35, -0x1.CB489AEF22222p-32, -0x1.67678075CCCCDp-30, -0x1.A94965D1F7777p-29, -0x1.CF6510DBD999Ap-28, -0x1.054EE63662222p-26, -0x1.749B2BF9F999Ap-25,
+		  -0x1.B5CD8A6F44444p-31, 0x1.3F80F619A2222p-31, 0x1.7D4022BA7999Ap-31, 0x1.A7763A5D6DDDEp-33, 0x1.3A876B5BE0000p-36, 0x1.0FC702F67C222p-41, 0x1.38531B8557CCDp-49 },
+		{ 0x1.10C7EFA333333p-37, 0x1.40B52AC555555p-34, 0x1.E8A3C41CCCCCDp-33, 0x1.16BD0B6EEEEEFp-31, 0x1.236E5FCB33333p-30, 0x1.3CDF33AD9999Ap-29, 0x1.C39BB43111111p-28,
+		  0x1.C86A667555555p-34, -0x1.9F744BC666666p-35, -0x1.2BE45D2E66666p-34, -0x1.5B75F6B2EEEEFp-36, -0x1.0BBE33E3DDDDEp-39, -0x1.E80430C980000p-45, -0x1.38AA85B04AAABp-52 },
+		{ -0x1.3BE0452AAAAABp-41, -0x1.761001AAAAAABp-38, -0x1.211D072222222p-36, -0x1.5234213BBBBBCp-35, -0x1.708961C000000p-34, -0x1.AF2432D555555p-33, -0x1.6924A5E000000p-31,
+		  -0x1.6E55F60000000p-38, 0x1.525422CCCCCCDp-39, 0x1.FB1FF5B333333p-39, 0x1.3805DD6444444p-40, 0x1.07760CD555555p-43, 0x1.14E78727BBBBCp-48, 0x1.C8A07900AAAABp-56 },
+		{ -0x1.6EACF33333333p-46, -0x1.90B23BBBBBBBCp-43, -0x1.0054A33333333p-41, -0x1.9312DBBBBBBBCp-41, -0x1.F34F666666666p-42, 0x1.9857311111111p-39, 0x1.27706F1111111p-35,
+		  -0x1.BDC6800000000p-41, -0x1.0D50888888889p-47, 0x1.A7FF655555555p-43, 0x1.BDFC73BBBBBBCp-45, 0x1.A03E788888889p-49, -0x1.C018155555555p-56, -0x1.943A003333333p-60 },
+		{ -0x1.2122EEEEEEEEFp-51, 0x1.B177777777777p-52, 0x1.208999999999Ap-47, 0x1.C86C000000000p-45, 0x1.79F099999999Ap-43, 0x1.E0BC888888889p-42, -0x1.3B67333333333p-43,
+		  -0x1.D5C0D55555555p-43, -0x1.FC0DC00000000p-43, -0x1.0ACA944444444p-43, -0x1.D067B44444444p-46, -0x1.18CF155555555p-49, -0x1.5D2A95999999Ap-55, -0x1.2C06844444444p-68 },
+		{ 0x1.1713BBBBBBBBCp-48, 0x1.3AA7777777777p-45, 0x1.B258AAAAAAAABp-44, 0x1.A4AC222222222p-43, 0x1.50A2666666666p-42, 0x1.C46C888888889p-42, 0x1.B341DDDDDDDDEp-42,
+		  0x1.9061DDDDDDDDEp-43, 0x1.CE2DDDDDDDDDEp-44, 0x1.260BCCCCCCCCDp-45, 0x1.6BB2111111111p-48, 0x1.7461555555555p-52, 0x1.C10DAAAAAAAABp-58, 0x1.1EEB000000000p-67 },
+		{ 0x1.1071111111111p-47, 0x1.2A10444444444p-44, 0x1.A97E666666666p-43, 0x1.AAD4888888889p-42, 0x1.71D8EEEEEEEEFp-41, 0x1.28D4888888889p-40, 0x1.D8D4000000000p-40,
+		  0x1.386F777777777p-42, 0x1.3D96444444444p-43, 0x1.3304CCCCCCCCDp-45, 0x1.272D333333333p-48, 0x1.9601111111111p-53, 0x1.4B78666666666p-59, 0x1.81C1555555555p-68 },
+		{ -0x1.7315555555555p-50, -0x1.A673333333333p-47, -0x1.29CBBBBBBBBBCp-45, -0x1.2C01111111111p-44, -0x1.02D7777777777p-43, -0x1.9C02222222222p-43, -0x1.457AAAAAAAAABp-42,
+		  -0x1.BBAAAAAAAAAABp-45, -0x1.C2B3333333333p-46, -0x1.CA3999999999Ap-48, -0x1.A735555555555p-51, -0x1.392CCCCCCCCCDp-55, -0x1.191999999999Ap-61, -0x1.4FF3333333333p-70 },
+		{ -0x1.49A5555555555p-49, -0x1.6915555555555p-46, -0x1.015BBBBBBBBBCp-44, -0x1.01B2222222222p-43, -0x1.BCB2222222222p-43, -0x1.6191111111111p-42, -0x1.1087777777777p-41,
+		  -0x1.7CE7777777777p-44, -0x1.841EEEEEEEEEFp-45, -0x1.7958888888889p-47, -0x1.6C8999999999Ap-50, -0x1.FD5DDDDDDDDDEp-55, -0x1.A3BCCCCCCCCCDp-61, -0x1.8354444444444p-70 }
+	},
+	{
+		{ 0x1.099FEA1F03272p-9, 0x1.2D34F7ACC4FBFp-6, 0x1.A951926B0FA5Cp-5, 0x1.AC1BD1D8445B2p-4, 0x1.7059ECC2D267Ep-3, 0x1.2453AF59CBDC8p-2, 0x1.C3BC686F0B149p-2,
+		  0x1.5305C6EBE23C7p-4, 0x1.59385866FC2CFp-5, 0x1.5A611BE6372F5p-7, 0x1.3D88BF80C6AB0p-10, 0x1.CBA238739C3BFp-15, 0x1.86B9F721635EEp-21, 0x1.6DFE458B670DDp-30 },
+		{ -0x1.94BF10F35D1B2p-14, -0x1.CAF6F06E359C9p-11, -0x1.440A2484966C2p-9, -0x1.462A1E4569227p-8, -0x1.18A2C9E9C5287p-7, -0x1.BD6D68F02C24Cp-7, -0x1.58282D666EE1Bp-6,
+		  -0x1.024B7EC0CF841p-9, -0x1.0707A5D89CA10p-10, -0x1.07F10EFD8FF4Ep-12, -0x1.E403491100E71p-16, -0x1.5E69E064605B1p-20, -0x1.2A0A0225B0262p-26, -0x1.177D76060B3ADp-35 },
+		{ 0x1.343A3978CCB43p-18, 0x1.5D8370794B02Fp-15, 0x1.ED8524E021BC4p-14, 0x1.F0BD9DA1A77D2p-13, 0x1.AB6113271AFF0p-12, 0x1.532357AB49887p-11, 0x1.05FAA5A6C3157p-10,
+		  0x1.27096A474B69Dp-14, 0x1.2CB451745EA10p-15, 0x1.2E4ED9DF3A3E7p-17, 0x1.1611E7F1537C0p-20, 0x1.94C2100147F3Bp-25, 0x1.5B71F6980C532p-31, 0x1.4C4DDD58203B4p-40 },
+		{ -0x1.D3B9DD895B5D8p-23, -0x1.092B0C7D8B890p-19, -0x1.765C9584123BCp-18, -0x1.78B2AC3B126F6p-17, -0x1.43F1C61620901p-16, -0x1.00D70FA25B426p-15, -0x1.8C0B5065894E9p-15,
+		  -0x1.74A6E5381078Dp-19, -0x1.7F18EC8F9FF93p-20, -0x1.884560EDD1106p-22, -0x1.7418BE9028AEFp-25, -0x1.1C65FA60731AEp-29, -0x1.089BD84775A79p-35, -0x1.2760683D242A3p-44 },
+		{ 0x1.5B34869A5E822p-27, 0x1.897C3B4D18111p-24, 0x1.1574F45608222p-22, 0x1.16A89665A9889p-21, 0x1.DDBA5667FEC89p-21, 0x1.788A53F97C4ABp-20, 0x1.1E4FD204594EFp-19,
+		  0x1.DE93D68CEDDDEp-24, 0x1.051A8B4144111p-24, 0x1.2BEF5E1898666p-26, 0x1.4F588C21CF911p-29, 0x1.3C370D35F7D9Ap-33, 0x1.7D8981C5D9289p-39, 0x1.2AFB01D27EC11p-47 },
+		{ -0x1.CF75579187777p-32, -0x1.05DA9BF60BBBCp-28, -0x1.6EEE6429A4444p-27, -0x1.6C60AFFB0E666p-26, -0x1.323FEA441199Ap-25, -0x1.D0D40DF510000p-25, -0x1.4004A2C52CCCDp-24,
+		  -0x1.08679BAC64444p-28, -0x1.8DB4D1BFE8889p-29, -0x1.53B6FDCAE4444p-30, -0x1.0BD825830F777p-32, -0x1.4B95B46153333p-36, -0x1.F06577D60F333p-42, -0x1.D49FE98DFD111p-50 },
+		{ 0x1.50F39767DDDDEp-37, 0x1.7269046755555p-34, 0x1.E7034D2466666p-33, 0x1.AA702DCB77777p-32, 0x1.108AD9A6CCCCDp-31, 0x1.2F2A4904CCCCDp-32, -0x1.A37512A488889p-30,
+		  0x1.61B242C888889p-37, 0x1.80EBFECD9999Ap-33, 0x1.2D2D98FC6EEEFp-33, 0x1.2ED07FEB66666p-35, 0x1.A7D5CCE3FBBBCp-39, 0x1.56A654DADEEEFp-44, 0x1.5A72274FDA222p-52 },
+		{ 0x1.1A901B9111111p-40, 0x1.4F8D1D9DDDDDEp-37, 0x1.044FA97333333p-35, 0x1.2FC5730CCCCCDp-34, 0x1.43F1C0B777777p-33, 0x1.605222399999Ap-32, 0x1.CE8EDB4000000p-31,
+		  0x1.6C15CC2222222p-36, -0x1.EEECAE8000000p-37, -0x1.2C3A8FB99999Ap-36, -0x1.4B1B050444444p-38, -0x1.E3997D6EEEEEFp-42, -0x1.94428D6822222p-47, -0x1.ACA7FE0000000p-55 },
+		{ -0x1.BBDC8F999999Ap-43, -0x1.03B2E65555555p-39, -0x1.8768063333333p-38, -0x1.B6AD21BBBBBBCp-37, -0x1.BD75C94444444p-36, -0x1.CC0F221111111p-35, -0x1.22BDECC444444p-33,
+		  -0x1.88AF7D999999Ap-39, 0x1.8212D08888889p-40, 0x1.09F9642AAAAABp-39, 0x1.2D34440000000p-41, 0x1.C10013A222222p-45, 0x1.821F4B2BBBBBCp-50, 0x1.B1BE633E66666p-58 },
+		{ 0x1.FEECCAAAAAAABp-47, 0x1.2D47A22222222p-43, 0x1.D413DDDDDDDDEp-42, 0x1.119C100000000p-40, 0x1.26DA8BBBBBBBCp-39, 0x1.4B3C5D5555555p-38, 0x1.E096688888889p-37,
+		  -0x1.92BDDDDDDDDDEp-48, -0x1.06C9DBBBBBBBCp-42, -0x1.A8F91CCCCCCCDp-43, -0x1.B83C455555555p-45, -0x1.44BBDECCCCCCDp-48, -0x1.1ECCC47777777p-53, -0x1.5F69864CCCCCDp-61 },
+		{ -0x1.5E17155555555p-47, -0x1.8B56955555555p-44, -0x1.1C2A6CCCCCCCDp-42, -0x1.224EE22222222p-41, -0x1.0381133333333p-40, -0x1.BEF3AEEEEEEEFp-40, -0x1.B536155555555p-39,
+		  -0x1.842CB77777777p-42, -0x1.79A52AAAAAAABp-43, -0x1.397D0CCCCCCCDp-45, -0x1.9B61888888889p-49, -0x1.ACDDDDDDDDDDEp-60, 0x1.36EABDDDDDDDEp-58, 0x1.6B1782AAAAAABp-65 },
+		{ 0x1.452C111111111p-48, 0x1.7591DDDDDDDDEp-45, 0x1.06CE222222222p-43, 0x1.096A777777777p-42, 0x1.CB9CEEEEEEEEFp-42, 0x1.717A777777777p-41, 0x1.2B4BBBBBBBBBCp-40,
+		  0x1.9729DDDDDDDDEp-43, 0x1.A1A5777777777p-44, 0x1.B0DCAAAAAAAABp-46, 0x1.8A3AAAAAAAAABp-49, 0x1.2615888888889p-53, 0x1.C86BDDDDDDDDEp-60, 0x1.5F40444444444p-70 },
+		{ 0x1.DD5999999999Ap-48, 0x1.0C08666666666p-44, 0x1.7D1ECCCCCCCCDp-43, 0x1.7D08CCCCCCCCDp-42, 0x1.47A9777777777p-41, 0x1.0446EEEEEEEEFp-40, 0x1.91CB333333333p-40,
+		  0x1.2581777777777p-42, 0x1.2DCF333333333p-43, 0x1.242B99999999Ap-45, 0x1.154F777777777p-48, 0x1.8B87BBBBBBBBCp-53, 0x1.4B6EAAAAAAAABp-59, 0x1.3779111111111p-68 },
+		{ -0x1.4D61111111111p-50, -0x1.7F00000000000p-47, -0x1.0D2EEEEEEEEEFp-45, -0x1.0F6BBBBBBBBBCp-44, -0x1.D446666666666p-44, -0x1.747EEEEEEEEEFp-43, -0x1.1F26666666666p-42,
+		  -0x1.A1B3333333333p-45, -0x1.A8F5555555555p-46, -0x1.B213333333333p-48, -0x1.807BBBBBBBBBCp-51, -0x1.19E3333333333p-55, -0x1.C086666666666p-62, -0x1.ACE4444444444p-71 },
+		{ -0x1.229EEEEEEEEEFp-49, -0x1.4698888888889p-46, -0x1.D01CCCCCCCCCDp-45, -0x1.D024444444444p-44, -0x1.8F23333333333p-43, -0x1.3D0999999999Ap-42, -0x1.EA2CCCCCCCCCDp-42,
+		  -0x1.6618888888889p-44, -0x1.70A8888888889p-45, -0x1.66CBBBBBBBBBCp-47, -0x1.55D7777777777p-50, -0x1.EB40000000000p-55, -0x1.A090000000000p-61, -0x1.85ADDDDDDDDDEp-70 }
+	},
+	{
+		{ 0x1.E50DEA7803B03p-10, 0x1.1303EE726FABAp-6, 0x1.8455BE2E64F9Dp-5, 0x1.86E1E4048B414p-4, 0x1.50523D1311E76p-3, 0x1.0AE85ADB12CB9p-2, 0x1.9C749BD226EE5p-2,
+		  0x1.43F28C3759134p-4, 0x1.49DE7E7BE04EAp-5, 0x1.4AF9E76AEAD2Ep-7, 0x1.2F69ABD4F6CCAp-10, 0x1.B730C6A6629B0p-15, 0x1.75583E1ED83BAp-21, 0x1.5DB4843C8989Cp-30 },
+		{ -0x1.516D974A3D23Ap-14, -0x1.7EA0FE14C17F8p-11, -0x1.0E252A4EEAF25p-9, -0x1.0FEAD1EDCD423p-8, -0x1.D3EC6ACC12B3Fp-8, -0x1.7359254B13B84p-7, -0x1.1EEC9212B77C7p-6,
+		  -0x1.C2B55693D9E71p-10, -0x1.CAF2F5C398023p-11, -0x1.CC7E5023200EFp-13, -0x1.A626785E5B103p-16, -0x1.318A038AF0A3Cp-20, -0x1.03BDEBDF7E53Fp-26, -0x1.E6A1E4E4E2943p-36 },
+		{ 0x1.D5717405177E7p-19, 0x1.0A29F8557B4E8p-15, 0x1.77D5EF3C13678p-14, 0x1.7A4CD03EE545Ap-13, 0x1.457E619E8879Fp-12, 0x1.02500B908B12Dp-11, 0x1.8F2AB454E404Bp-11,
+		  0x1.D647C066A9C36p-15, 0x1.DEEB2826F197Cp-16, 0x1.E09DA62092D03p-18, 0x1.B8BB30B7F0A0Dp-21, 0x1.3F255EBA0EDC4p-25, 0x1.0F8A751941DC4p-31, 0x1.FDA2E10F6E09Ap-41 },
+		{ -0x1.466A712F430FDp-23, -0x1.722367FDF74A9p-20, -0x1.055262C3EC0B1p-18, -0x1.0707241B08237p-17, -0x1.C49A74789A932p-17, -0x1.67287AB8B15F5p-16, -0x1.1573F8213CEDDp-15,
+		  -0x1.10760F175446Bp-19, -0x1.15BCECBD4E6BAp-20, -0x1.174F5C6329F46p-22, -0x1.010D94A18CF40p-25, -0x1.767886166C469p-30, -0x1.41D761F4134A9p-36, -0x1.34608D6B8598Fp-45 },
+		{ 0x1.C493C0141A19Ap-28, 0x1.0095960FA0C89p-24, 0x1.6A41D2EC6E19Ap-23, 0x1.6C8AFFF47D9BCp-22, 0x1.398783D787933p-21, 0x1.F1478F7394A66p-21, 0x1.7F9FD03CE8622p-20,
+		  0x1.4A09A1A7A5555p-24, 0x1.5327E4992E777p-25, 0x1.5AF806D666111p-27, 0x1.48940DBB8D333p-30, 0x1.F4BA1032A6EEFp-35, 0x1.CEF7E948F4800p-41, 0x1.FC66E579FF000p-50 },
+		{ -0x1.349D8149BF777p-32, -0x1.5DCEF09DF3333p-29, -0x1.ED7E84CAC1111p-28, -0x1.EFF2308C9AAABp-27, -0x1.A997E37E53333p-26, -0x1.502AD3AFB999Ap-25, -0x1.0108D4A058889p-24,
+		  -0x1.9067B2CF44444p-29, -0x1.B0C22B4B37777p-30, -0x1.E87B66F8EAAABp-32, -0x1.0AC496F584444p-34, -0x1.E940D76F75555p-39, -0x1.1D5F702B60000p-44, -0x1.A9988AE297777p-53 },
+		{ 0x1.857F836C11111p-37, 0x1.B8A290F911111p-34, 0x1.3582B0A811111p-32, 0x1.34C4BCFCEEEEFp-31, 0x1.05AA98A277777p-30, 0x1.93E7887CEEEEFp-30, 0x1.242654EA9999Ap-29,
+		  0x1.ADF20DD5DDDDEp-34, 0x1.2CF0028222222p-34, 0x1.E035C19DDDDDEp-36, 0x1.6986C0DB77777p-38, 0x1.B0F7E07C66666p-42, 0x1.3A409E4488889p-47, 0x1.1B868833D999Ap-55 },
+		{ -0x1.478EEB8888889p-42, -0x1.6D5C135555555p-39, -0x1.F1518A2222222p-38, -0x1.D3F6727777777p-37, -0x1.632D8F3333333p-36, -0x1.AA8233BBBBBBCp-36, -0x1.4D5D548888889p-37,
+		  -0x1.D97AD11111111p-41, -0x1.F7A92C4444444p-39, -0x1.6FF0228888889p-39, -0x1.694B7EA222222p-41, -0x1.F0EC69E222222p-45, -0x1.88CD2CE000000p-50, -0x1.7BA31A599999Ap-58 },
+		{ -0x1.15B9633333333p-47, -0x1.56CB955555555p-44, -0x1.20F6DEEEEEEEFp-42, -0x1.73720CCCCCCCDp-41, -0x1.B6D9D66666666p-40, -0x1.05A234CCCCCCDp-38, -0x1.6C54451111111p-37,
+		  -0x1.3BE5511111111p-43, 0x1.A1F98CCCCCCCDp-42, 0x1.7976C9999999Ap-42, 0x1.88576EEEEEEEFp-44, 0x1.1533E9EEEEEEFp-47, 0x1.C04A255555555p-53, 0x1.BF42553777777p-61 },
+		{ -0x1.93F2111111111p-49, -0x1.BF033BBBBBBBCp-46, -0x1.224E5DDDDDDDEp-44, -0x1.F57E333333333p-44, -0x1.3125444444444p-43, -0x1.9687777777777p-45, 0x1.497DD55555555p-41,
+		  -0x1.C979555555555p-43, -0x1.600FC00000000p-43, -0x1.3084C22222222p-44, -0x1.E859488888889p-47, -0x1.31A7E91111111p-50, -0x1.D5A601999999Ap-56, -0x1.D0DD384444444p-64 },
+		{ -0x1.1FB7866666666p-47, -0x1.495C4CCCCCCCDp-44, -0x1.CFC2733333333p-43, -0x1.D63719999999Ap-42, -0x1.97C4D9999999Ap-41, -0x1.494E400000000p-40, -0x1.09DD133333333p-39,
+		  -0x1.709F266666666p-42, -0x1.6960555555555p-43, -0x1.4D84444444444p-45, -0x1.0FF9888888889p-48, -0x1.1CE82AAAAAAABp-53, -0x1.33B1555555555p-61, 0x1.67559DDDDDDDEp-68 },
+		{ 0x1.2C1F111111111p-48, 0x1.5686333333333p-45, 0x1.E2E9777777777p-44, 0x1.E799777777777p-43, 0x1.A49ECCCCCCCCDp-42, 0x1.4EC3333333333p-41, 0x1.04F9000000000p-40,
+		  0x1.85E8444444444p-43, 0x1.8F42000000000p-44, 0x1.8B27111111111p-46, 0x1.6862666666666p-49, 0x1.E9F6000000000p-54, 0x1.8822888888889p-60, 0x1.20C5333333333p-69 },
+		{ 0x1.AB2FDDDDDDDDEp-48, 0x1.E81EEEEEEEEEFp-45, 0x1.56CF555555555p-43, 0x1.59A6444444444p-42, 0x1.2923333333333p-41, 0x1.D7D5DDDDDDDDEp-41, 0x1.6C60666666666p-40,
+		  0x1.1AFB555555555p-42, 0x1.1E0AEEEEEEEEFp-43, 0x1.1BBF333333333p-45, 0x1.097D555555555p-48, 0x1.7D23777777777p-53, 0x1.4845333333333p-59, 0x1.35F4666666666p-68 },
+		{ -0x1.2F4CCCCCCCCCDp-50, -0x1.5ACBBBBBBBBBCp-47, -0x1.E86CCCCCCCCCDp-46, -0x1.ECF999999999Ap-45, -0x1.A8A4444444444p-44, -0x1.50D1111111111p-43, -0x1.0407777777777p-42,
+		  -0x1.8C7BBBBBBBBBCp-45, -0x1.98B1111111111p-46, -0x1.97B5555555555p-48, -0x1.7AD1111111111p-51, -0x1.08D2222222222p-55, -0x1.C6BDDDDDDDDDEp-62, -0x1.AC46666666666p-71 },
+		{ -0x1.04F6EEEEEEEEFp-49, -0x1.2A06666666666p-46, -0x1.A2D8888888889p-45, -0x1.A62CCCCCCCCCDp-44, -0x1.6B0BBBBBBBBBCp-43, -0x1.2058888888889p-42, -0x1.BD8999999999Ap-42,
+		  -0x1.5978888888889p-44, -0x1.5D40000000000p-45, -0x1.5A91111111111p-47, -0x1.43F7777777777p-50, -0x1.D12CCCCCCCCCDp-55, -0x1.8DEAAAAAAAAABp-61, -0x1.7514444444444p-70 }
+	},
+	{
+		{ 0x1.BE400359169E5p-10, 0x1.FA073EF156050p-7, 0x1.6544A6F8326B2p-5, 0x1.679CA0F34F1ECp-4, 0x1.356A635ABC544p-3, 0x1.EB1C303CCB90Dp-3, 0x1.7B7588DB9297Dp-2,
+		  0x1.36B830A608249p-4, 0x1.3C663AD0821ACp-5, 0x1.3D760E621E005p-7, 0x1.2305F094B8780p-10, 0x1.A541A6554D98Fp-15, 0x1.661962E2E6AE8p-21, 0x1.4F6CACD40CE7Bp-30 },
+		{ -0x1.1D9997BA31D2Fp-14, -0x1.43DBA8C958786p-11, -0x1.C94D9BCF4DAFAp-10, -0x1.CC4D93BBEEEC6p-9, -0x1.8C0D456CF1409p-8, -0x1.3A4F753A973FCp-7, -0x1.E5B51F3A29F98p-7,
+		  -0x1.8DB88B87FE041p-10, -0x1.94FDBEE23FA43p-11, -0x1.9659BF82CD800p-13, -0x1.7482A71C1E1A9p-16, -0x1.0D9AE531A2D0Cp-20, -0x1.CA5EAC59EFE51p-27, -0x1.AD593562DE855p-36 },
+		{ 0x1.6D910C0EA36DAp-19, 0x1.9E89664ACA3F1p-16, 0x1.24AC4160ADA75p-14, 0x1.2697BD0C9BC4Dp-13, 0x1.FAF1B0E36FFE0p-13, 0x1.9250B6AAD6043p-12, 0x1.36D9D6058D5C1p-11,
+		  0x1.7DCF7B2BE1162p-15, 0x1.84CAE418CE69Fp-16, 0x1.861A66D6A6017p-18, 0x1.659FE81B0D1D0p-21, 0x1.02D773AFC6092p-25, 0x1.B8196B4B5CFADp-32, 0x1.9C49F1423C997p-41 },
+		{ -0x1.D3E7AFC251525p-24, -0x1.094AB80B51C83p-20, -0x1.769AB64371EEDp-19, -0x1.790F8E84F8384p-18, -0x1.446D758B13C7Bp-17, -0x1.0177870EFB4A1p-16, -0x1.8DDC678B5BB63p-16,
+		  -0x1.973DE23DBCD22p-20, -0x1.9EB9F9E642877p-21, -0x1.A03492E4E1884p-23, -0x1.7DADFA9D987DEp-26, -0x1.14665E7C0FF5Cp-30, -0x1.D661030846AEFp-37, -0x1.B975B518CC515p-46 },
+		{ 0x1.2B597E395CEABp-28, 0x1.5372871C9FC44p-25, 0x1.DF4F3F9A2CA66p-24, 0x1.E27153BC76B77p-23, 0x1.9F15E4BECC089p-22, 0x1.4964FA27A6DDEp-21, 0x1.FCF30F93D5444p-21,
+		  0x1.C7DE21DB71DDEp-25, 0x1.D0A5C1A6F4222p-26, 0x1.D32B31297A111p-28, 0x1.ADC39B334F222p-31, 0x1.38CF73E3AC666p-35, 0x1.0C7A3A678CC44p-41, 0x1.00624120FE5DEp-50 },
+		{ -0x1.7E3CA45ACEEEFp-33, -0x1.B16BADCFDEEEFp-30, -0x1.31F9CDC946666p-28, -0x1.33EE9A6D08889p-27, -0x1.08E0ABE051111p-26, -0x1.A438B9F4F8889p-26, -0x1.445E541957777p-25,
+		  -0x1.05922CF477777p-29, -0x1.0C499D7466666p-30, -0x1.115CA2B6C4444p-32, -0x1.01209A7326666p-35, -0x1.83A7820226666p-40, -0x1.60241B4A11111p-46, -0x1.75B58B29DDDDEp-55 },
+		{ 0x1.E2AEB1519999Ap-38, 0x1.119896A366666p-34, 0x1.821C2356AAAABp-33, 0x1.8442637288889p-32, 0x1.4D8596C6EEEEFp-31, 0x1.07EF9D4FCCCCDp-30, 0x1.9566D3F777777p-30,
+		  0x1.2BB43C0BBBBBCp-34, 0x1.3EDDED9777777p-35, 0x1.5D8093E911111p-37, 0x1.6ED2C3A2AAAABp-40, 0x1.40BB2DA4CCCCDp-44, 0x1.621CDF6000000p-50, 0x1.EC64156333333p-59 },
+		{ -0x1.1D95CDAAAAAABp-42, -0x1.4369023333333p-39, -0x1.C74853CCCCCCDp-38, -0x1.C7D97F8888889p-37, -0x1.84C81FDDDDDDEp-36, -0x1.2FBA5F3333333p-35, -0x1.C542DD8888889p-35,
+		  -0x1.241BF00000000p-39, -0x1.7ABB466666666p-40, -0x1.1576E48888889p-41, -0x1.88BBC04444444p-44, -0x1.C15576AAAAAABp-48, -0x1.3A2A7DEEEEEEFp-53, -0x1.0EE96C5111111p-61 },
+		{ 0x1.B1250EEEEEEEFp-47, 0x1.EDBE833333333p-44, 0x1.57F1EEEEEEEEFp-42, 0x1.54E0544444444p-41, 0x1.1C0C3BBBBBBBCp-40, 0x1.A868455555555p-40, 0x1.1A6ED55555555p-39,
+		  0x1.05D9E22222222p-42, 0x1.734FAEEEEEEEFp-43, 0x1.2B06F00000000p-44, 0x1.BEF5033333333p-47, 0x1.0A51377777777p-50, 0x1.80DC944444444p-56, 0x1.57754D999999Ap-64 },
+		{ -0x1.9A54FBBBBBBBCp-48, -0x1.CEBC2AAAAAAABp-45, -0x1.4540CCCCCCCCDp-43, -0x1.459AC44444444p-42, -0x1.14EC733333333p-41, -0x1.AFB7488888889p-41, -0x1.4014511111111p-40,
+		  -0x1.148DE66666666p-42, -0x1.2416A22222222p-43, -0x1.4899488888889p-45, -0x1.567D911111111p-48, -0x1.3881DBBBBBBBCp-52, -0x1.6055666666666p-58, -0x1.01EE677777777p-66 },
+		{ -0x1.EBF219999999Ap-48, -0x1.1ECD422222222p-44, -0x1.92CF444444444p-43, -0x1.98DCEAAAAAAABp-42, -0x1.608F3BBBBBBBCp-41, -0x1.186F4EEEEEEEFp-40, -0x1.B280BBBBBBBBCp-40,
+		  -0x1.5490B33333333p-42, -0x1.5D63888888889p-43, -0x1.60B7733333333p-45, -0x1.384CE22222222p-48, -0x1.ADC999999999Ap-53, -0x1.52D52AAAAAAABp-59, -0x1.100D911111111p-68 },
+		{ 0x1.13F9888888889p-48, 0x1.37F9333333333p-45, 0x1.B806AAAAAAAABp-44, 0x1.BB24CCCCCCCCDp-43, 0x1.7C9F555555555p-42, 0x1.2E3E777777777p-41, 0x1.D423555555555p-41,
+		  0x1.77D1111111111p-43, 0x1.798BBBBBBBBBCp-44, 0x1.82BA000000000p-46, 0x1.5765DDDDDDDDEp-49, 0x1.01E3EEEEEEEEFp-53, 0x1.AD2199999999Ap-60, 0x1.85DC666666666p-69 },
+		{ 0x1.7E6AAAAAAAAABp-48, 0x1.BDB5BBBBBBBBCp-45, 0x1.392C222222222p-43, 0x1.3D4D99999999Ap-42, 0x1.1150000000000p-41, 0x1.B20799999999Ap-41, 0x1.4ED2AAAAAAAABp-40,
+		  0x1.09C4888888889p-42, 0x1.11C1DDDDDDDDEp-43, 0x1.166E222222222p-45, 0x1.F761111111111p-49, 0x1.66F4444444444p-53, 0x1.2CF8AAAAAAAABp-59, 0x1.1B89BBBBBBBBCp-68 },
+		{ -0x1.193CCCCCCCCCDp-50, -0x1.3E1999999999Ap-47, -0x1.C091111111111p-46, -0x1.C3AEEEEEEEEEFp-45, -0x1.83B5555555555p-44, -0x1.33BCCCCCCCCCDp-43, -0x1.DC57777777777p-43,
+		  -0x1.7F77777777777p-45, -0x1.8100000000000p-46, -0x1.8C9BBBBBBBBBCp-48, -0x1.5F7BBBBBBBBBCp-51, -0x1.0B87777777777p-55, -0x1.C16EEEEEEEEEFp-62, -0x1.A293333333333p-71 },
+		{ -0x1.D32CCCCCCCCCDp-50, -0x1.1028000000000p-46, -0x1.7EBBBBBBBBBBCp-45, -0x1.836999999999Ap-44, -0x1.4DB1111111111p-43, -0x1.08FC444444444p-42, -0x1.98EAAAAAAAAABp-42,
+		  -0x1.44CEEEEEEEEEFp-44, -0x1.4E5999999999Ap-45, -0x1.535CCCCCCCCCDp-47, -0x1.3356666666666p-50, -0x1.B737777777777p-55, -0x1.6FCEEEEEEEEEFp-61, -0x1.5A2CCCCCCCCCDp-70 }
+	},
+	{
+		{ 0x1.9D31CA5D9CD4Ap-10, 0x1.D48B7358CA964p-7, 0x1.4ACDCA234A51Dp-5, 0x1.4CF952CB381C2p-4, 0x1.1E7EF3D2F7496p-3, 0x1.C6BB4954A2C50p-3, 0x1.5F59DDBD9DCB6p-2,
+		  0x1.2AFD6EC755DE4p-4, 0x1.3074953211B56p-5, 0x1.317A25B316783p-7, 0x1.180985F52752Fp-10, 0x1.955AABCB4972Fp-15, 0x1.5894BFEE3707Bp-21, 0x1.42C3288392BABp-30 },
+		{ -0x1.E9B644BF374C6p-15, -0x1.15A7F841A9ABEp-11, -0x1.88105782E0BB7p-10, -0x1.8AA2C091135F9p-9, -0x1.538CFAB4F97D9p-8, -0x1.0D7877015E1E2p-7, -0x1.A06A8182CAF5Fp-7,
+		  -0x1.625BC567F767Cp-10, -0x1.68D606526FE38p-11, -0x1.6A0C07D4F6332p-13, -0x1.4BE55EC952208p-16, -0x1.E06B7CFACDAEBp-21, -0x1.98647BF0FB19Fp-27, -0x1.7E888DA06E6BFp-36 },
+		{ 0x1.22331A4975CDBp-19, 0x1.4912E7A14D3B6p-16, 0x1.D0AB0A18359E0p-15, 0x1.D3B7603E1C0A6p-14, 0x1.926E2A94E6B33p-13, 0x1.3F5F5690A0A43p-12, 0x1.ED87A8EB9CB4Cp-12,
+		  0x1.3AFC37C741AFEp-15, 0x1.40BE42472EA87p-16, 0x1.41D1E6D1E0FB9p-18, 0x1.2704FD13589A9p-21, 0x1.AB0AD0C69F903p-26, 0x1.6B04E94C701C4p-32, 0x1.5409374DBACA6p-41 },
+		{ -0x1.57F06A95B3607p-24, -0x1.860319AC3A3E5p-21, -0x1.135BA0633C054p-19, -0x1.152A08E4BAFDBp-18, -0x1.DCF3DC9385022p-18, -0x1.7A83877AF438Bp-17, -0x1.2475EBD634AB5p-16,
+		  -0x1.37185BD750F5Cp-20, -0x1.3CC8C61E6A209p-21, -0x1.3DDA4115E40DAp-23, -0x1.2363D6E199F24p-26, -0x1.A5CE51CC891C9p-31, -0x1.6697B0AA200D5p-37, -0x1.4FEF440C6EC91p-46 },
+		{ 0x1.979E4E1FAB5DEp-29, 0x1.CE38AF2480EEFp-26, 0x1.4656CFC746622p-24, 0x1.487AB1C5E5666p-23, 0x1.1AA0B89377B33p-22, 0x1.C097018A40DDEp-22, 0x1.5A9A2A5868B77p-21,
+		  0x1.429A1B6739BBCp-25, 0x1.4886DDDC14AABp-26, 0x1.49B060002E777p-28, 0x1.2E53378C51EEFp-31, 0x1.B5D4C2CFCCDDEp-36, 0x1.747EC142F399Ap-42, 0x1.5D796080B5333p-51 },
+		{ -0x1.E2FD9F967DDDEp-34, -0x1.11D81DA844444p-30, -0x1.82AD887FE4444p-29, -0x1.85357097B3333p-28, -0x1.4EDF8F32DEEEFp-27, -0x1.09BF73F515555p-26, -0x1.9AA1598A4EEEFp-26,
+		  -0x1.57FD763695555p-30, -0x1.5E87E203C4444p-31, -0x1.603FFEF9C8889p-33, -0x1.43C1EC342AAABp-36, -0x1.D69C2E3E2AAABp-41, -0x1.92E00064D5555p-47, -0x1.7EA0F00122222p-56 },
+		{ 0x1.1DAF67AD55555p-38, 0x1.43F2A77ECCCCDp-35, 0x1.C9675F9733333p-34, 0x1.CC5C486E22222p-33, 0x1.8C09C98CEEEEFp-32, 0x1.3A36F837DDDDEp-31, 0x1.E54B794F77777p-31,
+		  0x1.7433D0DAAAAABp-35, 0x1.7CE58F2000000p-36, 0x1.823B7DD222222p-38, 0x1.6860245777777p-41, 0x1.0C3AAE2666666p-45, 0x1.DD6F16FCCCCCDp-52, 0x1.E7875B6333333p-61 },
+		{ -0x1.4780511111111p-43, -0x1.735E564444444p-40, -0x1.061CAEEEEEEEFp-38, -0x1.07AD6DDDDDDDEp-37, -0x1.C55630CCCCCCDp-37, -0x1.6734C1999999Ap-36, -0x1.14A21D8888889p-35,
+		  -0x1.6435B9999999Ap-40, -0x1.768AC66666666p-41, -0x1.911999999999Ap-43, -0x1.98022BBBBBBBCp-46, -0x1.55F6B0CCCCCCDp-50, -0x1.66E18C0000000p-56, -0x1.D307384444444p-65 },
+		{ 0x1.54B8044444444p-47, 0x1.7FD2A9999999Ap-44, 0x1.0ED63AAAAAAABp-42, 0x1.0F8B3AAAAAAABp-41, 0x1.D2A2522222222p-41, 0x1.711E522222222p-40, 0x1.1A4AD55555555p-39,
+		  0x1.047E822222222p-42, 0x1.0F787BBBBBBBCp-43, 0x1.21A8C66666666p-45, 0x1.268FF77777777p-48, 0x1.EEFDBBBBBBBBCp-53, 0x1.F519ACCCCCCCDp-59, 0x1.493F966666666p-67 },
+		{ -0x1.89DB733333333p-48, -0x1.BB11622222222p-45, -0x1.38AAB77777777p-43, -0x1.3AD1F33333333p-42, -0x1.0E78555555555p-41, -0x1.ACBAF77777777p-41, -0x1.4AAA444444444p-40,
+		  -0x1.0DEDD33333333p-42, -0x1.1489333333333p-43, -0x1.19676AAAAAAABp-45, -0x1.0395711111111p-48, -0x1.85EC488888889p-53, -0x1.5A02666666666p-59, -0x1.5E82888888889p-68 },
+		{ -0x1.D653111111111p-48, -0x1.07A7A00000000p-44, -0x1.74C2D11111111p-43, -0x1.7567955555555p-42, -0x1.4202711111111p-41, -0x1.0033F9999999Ap-40, -0x1.8B605DDDDDDDEp-40,
+		  -0x1.4A8E377777777p-42, -0x1.4D99E66666666p-43, -0x1.4E8E733333333p-45, -0x1.345B3BBBBBBBCp-48, -0x1.C488D55555555p-53, -0x1.6BAC6AAAAAAABp-59, -0x1.59A2EAAAAAAABp-68 },
+		{ 0x1.0002555555555p-48, 0x1.1F1F666666666p-45, 0x1.9577DDDDDDDDEp-44, 0x1.986F111111111p-43, 0x1.5F25555555555p-42, 0x1.16B1777777777p-41, 0x1.AF02666666666p-41,
+		  0x1.6745888888889p-43, 0x1.6ED9555555555p-44, 0x1.71C2888888889p-46, 0x1.4F6C111111111p-49, 0x1.EC4D333333333p-54, 0x1.A150444444444p-60, 0x1.8489DDDDDDDDEp-69 },
+		{ 0x1.6ECEAAAAAAAABp-48, 0x1.9C2B99999999Ap-45, 0x1.236E666666666p-43, 0x1.241399999999Ap-42, 0x1.F779BBBBBBBBCp-42, 0x1.9068AAAAAAAABp-41, 0x1.34F6000000000p-40,
+		  0x1.0264222222222p-42, 0x1.04F5DDDDDDDDEp-43, 0x1.060AAAAAAAAABp-45, 0x1.E2ED99999999Ap-49, 0x1.6354AAAAAAAABp-53, 0x1.20EF555555555p-59, 0x1.143CEEEEEEEEFp-68 },
+		{ -0x1.062999999999Ap-50, -0x1.2501111111111p-47, -0x1.9DECCCCCCCCCDp-46, -0x1.A0ECCCCCCCCCDp-45, -0x1.6671111111111p-44, -0x1.1C86666666666p-43, -0x1.B7F3333333333p-43,
+		  -0x1.6E90000000000p-45, -0x1.76D5555555555p-46, -0x1.79C4444444444p-48, -0x1.5676666666666p-51, -0x1.F824444444444p-56, -0x1.AA0CCCCCCCCCDp-62, -0x1.8E2AAAAAAAAABp-71 },
+		{ -0x1.BF08888888889p-50, -0x1.F732222222222p-47, -0x1.63D6666666666p-45, -0x1.64CBBBBBBBBBCp-44, -0x1.3366EEEEEEEEFp-43, -0x1.E8D2222222222p-43, -0x1.794AAAAAAAAABp-42,
+		  -0x1.3B8DDDDDDDDDEp-44, -0x1.3ECEEEEEEEEEFp-45, -0x1.402999999999Ap-47, -0x1.26A4444444444p-50, -0x1.B15BBBBBBBBBCp-55, -0x1.626BBBBBBBBBCp-61, -0x1.5165555555555p-70 }
+	},
+	{
+		{ 0x1.80B2C53EBA9D2p-10, 0x1.B43B366F82AE7p-7, 0x1.33FD63ED99F90p-5, 0x1.36029C8A09046p-4, 0x1.0ABCD15C2260Dp-3, 0x1.A75EEC023C978p-3, 0x1.471EB3F9C9E3Dp-2,
+		  0x1.207EED30DC182p-4, 0x1.25C4F7DC1C0E7p-5, 0x1.26C15A2083C47p-7, 0x1.0E355011F3C27p-10, 0x1.87207406CB872p-15, 0x1.4C7C98488ED53p-21, 0x1.376F0CDA74C00p-30 },
+		{ -0x1.A87EA4A9D878Cp-15, -0x1.E15BD21CAF144p-12, -0x1.53D9CF5A0D209p-10, -0x1.561489678F438p-9, -0x1.2654C3B0E44B1p-8, -0x1.D32AF2BD53E17p-8, -0x1.68F5BDBD9027Cp-7,
+		  -0x1.3E57175EBDBA3p-10, -0x1.4428CAE358C16p-11, -0x1.453F4905963AFp-13, -0x1.2A292C55C6AD9p-16, -0x1.AF969204B9F06p-21, -0x1.6EE1C306A4534p-27, -0x1.57A6ADF1A5260p-36 },
+		{ 0x1.D4686E946B39Ap-20, 0x1.0993C3163A0BEp-16, 0x1.7701FEDF12D5Fp-15, 0x1.7977C352B861Ep-14, 0x1.44C7766F31408p-13, 0x1.01BF6B189C5BDp-12, 0x1.8E4CF40D618A7p-12,
+		  0x1.07743658124DCp-15, 0x1.0C451208C97C2p-16, 0x1.0D2B8D2991962p-18, 0x1.ED81F6CA88943p-22, 0x1.652D3155C9525p-26, 0x1.2FA066D8D503Cp-32, 0x1.1C66B64E16AB9p-41 },
+		{ -0x1.026E914C178ECp-24, -0x1.250CF6000C63Cp-21, -0x1.9DCD35E9DB535p-20, -0x1.A08420038B7A6p-19, -0x1.66607C4D92E07p-18, -0x1.1C6944759AF83p-17, -0x1.B781032AE24F3p-17,
+		  -0x1.E4834B52D4304p-21, -0x1.ED5EAE598C66Bp-22, -0x1.EF06AFE1644E6p-24, -0x1.C5CD3000CE222p-27, -0x1.4870A9D832EA2p-31, -0x1.173322437EB40p-37, -0x1.0585FAB24D380p-46 },
+		{ 0x1.1D2A620D31D11p-29, 0x1.435D8CB7536EFp-26, 0x1.C89B872610444p-25, 0x1.CB9A5087AF3BCp-24, 0x1.8B73032DFF777p-23, 0x1.39D50330F7889p-22, 0x1.E4F7D55D85F77p-22,
+		  0x1.D3CDD1776B111p-26, 0x1.DC5BBC224E889p-27, 0x1.DDF6AA0E7999Ap-29, 0x1.B62B4D594FDDEp-32, 0x1.3D23090970333p-36, 0x1.0D9B2BA81399Ap-42, 0x1.F920D3B567BBCp-52 },
+		{ -0x1.3AAA080B6EEEFp-34, -0x1.64D0C2C3E8889p-31, -0x1.F7D72055C0000p-30, -0x1.FB251987AAAABp-29, -0x1.B45AC3D233333p-28, -0x1.5A4B413864444p-27, -0x1.0B9083E71DDDEp-26,
+		  -0x1.D097E42144444p-31, -0x1.D91D7D9CB3333p-32, -0x1.DAC3BB2277777p-34, -0x1.B35287E6BBBBCp-37, -0x1.3B2CF1EE1999Ap-41, -0x1.0C13FAFC08889p-47, -0x1.F6C56BD922222p-57 },
+		{ 0x1.5AFD378AAAAABp-39, 0x1.8978982CCCCCDp-36, 0x1.15CBF31C00000p-34, 0x1.179E3208CCCCDp-33, 0x1.E12B2BBCCCCCDp-33, 0x1.7DD9CCAE22222p-32, 0x1.2706D86B33333p-31,
+		  0x1.D4C73F6AAAAABp-36, 0x1.DD8F055222222p-37, 0x1.DFAB66A888889p-39, 0x1.B87A0C4555555p-42, 0x1.3F9D404222222p-46, 0x1.10F86C0DDDDDEp-52, 0x1.01E6685666666p-61 },
+		{ -0x1.6EFF146666666p-44, -0x1.A03EF2AAAAAABp-41, -0x1.25D052CCCCCCDp-39, -0x1.27BD3E6666666p-38, -0x1.FCDB737777777p-38, -0x1.93C2E4CCCCCCDp-37, -0x1.37E4D6AAAAAABp-36,
+		  -0x1.844DA55555555p-41, -0x1.8BDBFDDDDDDDEp-42, -0x1.91A8177777777p-44, -0x1.7428D9999999Ap-47, -0x1.132C933333333p-51, -0x1.E616DAAAAAAABp-58, -0x1.E411166666666p-67 },
+		{ 0x1.E264622222222p-48, 0x1.1057533333333p-44, 0x1.834C8EEEEEEEFp-43, 0x1.83E58EEEEEEEFp-42, 0x1.4DD3B33333333p-41, 0x1.0953B22222222p-40, 0x1.993D9DDDDDDDEp-40,
+		  0x1.CF10555555555p-43, 0x1.DC879BBBBBBBCp-44, 0x1.D75A7BBBBBBBCp-46, 0x1.B18B1BBBBBBBCp-49, 0x1.4F21911111111p-53, 0x1.10898AAAAAAABp-59, 0x1.133F79999999Ap-68 },
+		{ -0x1.679A622222222p-48, -0x1.9557777777777p-45, -0x1.1F8F6AAAAAAABp-43, -0x1.212199999999Ap-42, -0x1.F1E9EAAAAAAABp-42, -0x1.8B6FC88888889p-41, -0x1.3115777777777p-40,
+		  -0x1.02F2933333333p-42, -0x1.0B09C66666666p-43, -0x1.07B3622222222p-45, -0x1.EB23888888889p-49, -0x1.6244D55555555p-53, -0x1.28992EEEEEEEFp-59, -0x1.1BD3444444444p-68 },
+		{ -0x1.B03A000000000p-48, -0x1.E65F6EEEEEEEFp-45, -0x1.5B32622222222p-43, -0x1.5A9B488888889p-42, -0x1.2A7B19999999Ap-41, -0x1.DB4B2EEEEEEEFp-41, -0x1.6E79CCCCCCCCDp-40,
+		  -0x1.3EC9088888889p-42, -0x1.46BE0AAAAAAABp-43, -0x1.41A3A66666666p-45, -0x1.25A9F9999999Ap-48, -0x1.C276800000000p-53, -0x1.636A0CCCCCCCDp-59, -0x1.5A9D266666666p-68 },
+		{ 0x1.D7CB555555555p-49, 0x1.09A7777777777p-45, 0x1.7924EEEEEEEEFp-44, 0x1.7B37333333333p-43, 0x1.4696111111111p-42, 0x1.036B222222222p-41, 0x1.903A666666666p-41,
+		  0x1.58EFCCCCCCCCDp-43, 0x1.6455666666666p-44, 0x1.5E5E444444444p-46, 0x1.473D111111111p-49, 0x1.D52B777777777p-54, 0x1.86DD333333333p-60, 0x1.74A8444444444p-69 },
+		{ 0x1.5248222222222p-48, 0x1.7CB7777777777p-45, 0x1.0F65333333333p-43, 0x1.0F06222222222p-42, 0x1.D2D8000000000p-42, 0x1.73AC222222222p-41, 0x1.1E95333333333p-40,
+		  0x1.F2A9DDDDDDDDEp-43, 0x1.FDE3111111111p-44, 0x1.F761DDDDDDDDEp-46, 0x1.CC0DBBBBBBBBCp-49, 0x1.5FA8222222222p-53, 0x1.1672CCCCCCCCDp-59, 0x1.0F7FDDDDDDDDEp-68 },
+		{ -0x1.E1E8888888889p-51, -0x1.0F1BBBBBBBBBCp-47, -0x1.8117777777777p-46, -0x1.8337777777777p-45, -0x1.4D8999999999Ap-44, -0x1.08FAAAAAAAAABp-43, -0x1.98A6666666666p-43,
+		  -0x1.5FDCCCCCCCCCDp-45, -0x1.6C6BBBBBBBBBCp-46, -0x1.64CAAAAAAAAABp-48, -0x1.4EE2222222222p-51, -0x1.DDB3333333333p-56, -0x1.8CF1111111111p-62, -0x1.7BD999999999Ap-71 },
+		{ -0x1.9D4CCCCCCCCCDp-50, -0x1.D146666666666p-47, -0x1.4B4BBBBBBBBBCp-45, -0x1.4AF0000000000p-44, -0x1.1D0EEEEEEEEEFp-43, -0x1.C5DCCCCCCCCCDp-43, -0x1.5DF7777777777p-42,
+		  -0x1.3097777777777p-44, -0x1.36D5DDDDDDDDEp-45, -0x1.33A5555555555p-47, -0x1.1944CCCCCCCCDp-50, -0x1.ACB999999999Ap-55, -0x1.5458888888889p-61, -0x1.4B92222222222p-70 }
+	},
+	{
+		{ 0x1.67E10B19BF58Ap-10, 0x1.98165C36E14A5p-7, 0x1.201E9749B5550p-5, 0x1.2202716870C61p-4, 0x1.F30EB0FF1DBCDp-4, 0x1.8C0E79AFA5835p-3, 0x1.3203F2AFFCDB6p-2,
+		  0x1.1708CAA379F26p-4, 0x1.1C228EB655069p-5, 0x1.1D16AA07CD99Fp-7, 0x1.0558B71D7F1A0p-10, 0x1.7A4CA7D896530p-15, 0x1.41951FB7FF468p-21, 0x1.2D38557C548A7p-30 },
+		{ -0x1.737CF2AEFC6DCp-15, -0x1.A5405F301ED14p-12, -0x1.2969E67D70191p-10, -0x1.2B5D5C4A92672p-9, -0x1.0193F8416BD8Ap-8, -0x1.98D522C5815D1p-8, -0x1.3BE30B07F5350p-7,
+		  -0x1.2009133D3E280p-10, -0x1.254CF669BBC54p-11, -0x1.2648F19515EF1p-13, -0x1.0DC6EE937AE91p-16, -0x1.8680AD469C402p-21, -0x1.4BF4C5ED27349p-27, -0x1.36EFD4273DA68p-36 },
+		{ 0x1.7F78B86CAA568p-20, 0x1.B2D717E8D74D5p-17, 0x1.3301F62A03154p-15, 0x1.35058889ED31Ep-14, 0x1.09E310C2FFD7Ap-13, 0x1.A6054D26E8012p-13, 0x1.4613A8431612Ep-12,
+		  0x1.BDFD891D6781Cp-16, 0x1.C6249655CC207p-17, 0x1.C7AAC081D551Fp-19, 0x1.A1B8275AD78E0p-22, 0x1.2E531B2B41927p-26, 0x1.00FF918A775E3p-32, 0x1.E1735AED2E070p-42 },
+		{ -0x1.8BD773951FD00p-25, -0x1.C0DE07A113EC9p-22, -0x1.3CE93FC8B1FDDp-20, -0x1.3EFD73C4C32D4p-19, -0x1.1276C69E492DCp-18, -0x1.B3A25F8A100DAp-18, -0x1.50986B15BD47Ep-17,
+		  -0x1.7FA5CA84F005Ap-21, -0x1.86A91B79AAB2Bp-22, -0x1.87F8BD4991E2Bp-24, -0x1.67541AEA13DA2p-27, -0x1.041075502D6E6p-31, -0x1.BA25DD8FDA8CDp-38, -0x1.9E26CA97D3A8Dp-47 },
+		{ 0x1.989C54F820222p-30, 0x1.CF58CC87A0666p-27, 0x1.472251299A4CDp-25, 0x1.4947AFF50A889p-24, 0x1.1B514FC6936EFp-23, 0x1.C1AFDBBE25800p-23, 0x1.5B740887BEF77p-22,
+		  0x1.5A853F217ECCDp-26, 0x1.60DADBF5C4889p-27, 0x1.620A168B01DDEp-29, 0x1.448E44F201BBCp-32, 0x1.D5CBC47ADC444p-37, 0x1.8F5CE9C9B6444p-43, 0x1.761407D99C000p-52 },
+		{ -0x1.A5CD10F7B7777p-35, -0x1.DE4DD64ED5555p-32, -0x1.51B1B4749BBBCp-30, -0x1.53E8CDACB3333p-29, -0x1.24769807B5555p-28, -0x1.D033F6300CCCDp-28, -0x1.66AB45D655555p-27,
+		  -0x1.41F54E9A9999Ap-31, -0x1.47D8503211111p-32, -0x1.48F2BF3A33333p-34, -0x1.2D8F1860CCCCDp-37, -0x1.B4847DE7BBBBCp-42, -0x1.7316A908AAAABp-48, -0x1.5B9E57EB33333p-57 },
+		{ 0x1.B3129ADAAAAABp-40, 0x1.ED5A448DDDDDEp-37, 0x1.5C52022800000p-35, 0x1.5E9AC1BE22222p-34, 0x1.2DAA54FB33333p-33, 0x1.DECF1A1BBBBBCp-33, 0x1.71F406CDDDDDEp-32,
+		  0x1.2FA3B6DBBBBBCp-36, 0x1.3534374BBBBBCp-37, 0x1.3646FBCBBBBBCp-39, 0x1.1C78C47444444p-42, 0x1.9BE4CEFDDDDDEp-47, 0x1.5E37075777777p-53, 0x1.4845C12444444p-62 },
+		{ -0x1.A39DB66666666p-45, -0x1.DC495D1111111p-42, -0x1.504CBC8888889p-40, -0x1.5280EFBBBBBBCp-39, -0x1.2340C3BBBBBBCp-38, -0x1.CE4DDDDDDDDDEp-38, -0x1.652B5EAAAAAABp-37,
+		  -0x1.948BB11111111p-42, -0x1.9C6FD77777777p-43, -0x1.9F5CA00000000p-45, -0x1.7A1F133333333p-48, -0x1.148F133333333p-52, -0x1.D283E44444444p-59, -0x1.BABD733333333p-68 },
+		{ 0x1.7285555555555p-48, 0x1.A4CB955555555p-45, 0x1.27CDA88888889p-43, 0x1.2A349AAAAAAABp-42, 0x1.009C200000000p-41, 0x1.96C5844444444p-41, 0x1.3A418CCCCCCCDp-40,
+		  0x1.A7ABE22222222p-43, 0x1.AE6B5BBBBBBBCp-44, 0x1.AE12977777777p-46, 0x1.8A712CCCCCCCDp-49, 0x1.194F022222222p-53, 0x1.EB60C00000000p-60, 0x1.CE4859999999Ap-69 },
+		{ -0x1.5238EEEEEEEEFp-48, -0x1.7901222222222p-45, -0x1.09B9755555555p-43, -0x1.0B75866666666p-42, -0x1.CC29B33333333p-42, -0x1.6CCB911111111p-41, -0x1.1A3A2EEEEEEEFp-40,
+		  -0x1.F6D0044444444p-43, -0x1.FEBFE66666666p-44, -0x1.FC483BBBBBBBCp-46, -0x1.DD13A22222222p-49, -0x1.51C44CCCCCCCDp-53, -0x1.28E6F77777777p-59, -0x1.118B3DDDDDDDEp-68 },
+		{ -0x1.93D42AAAAAAABp-48, -0x1.CAD9088888889p-45, -0x1.41F4955555555p-43, -0x1.44D179999999Ap-42, -0x1.17A0C88888889p-41, -0x1.BB41000000000p-41, -0x1.56424CCCCCCCDp-40,
+		  -0x1.3428733333333p-42, -0x1.38BC311111111p-43, -0x1.39568EEEEEEEFp-45, -0x1.1E39688888889p-48, -0x1.98E39DDDDDDDEp-53, -0x1.619AC00000000p-59, -0x1.4DBF733333333p-68 },
+		{ 0x1.C19199999999Ap-49, 0x1.F2E8444444444p-46, 0x1.5F7D444444444p-44, 0x1.61C0777777777p-43, 0x1.3043555555555p-42, 0x1.E244888888889p-42, 0x1.7547DDDDDDDDEp-41,
+		  0x1.4FD4111111111p-43, 0x1.54EA000000000p-44, 0x1.5276000000000p-46, 0x1.3F84222222222p-49, 0x1.C269555555555p-54, 0x1.8F6CCCCCCCCCDp-60, 0x1.6E51AAAAAAAABp-69 },
+		{ 0x1.3B9B777777777p-48, 0x1.669EAAAAAAAABp-45, 0x1.F755555555555p-44, 0x1.FBD3555555555p-43, 0x1.B542AAAAAAAABp-42, 0x1.5AB1BBBBBBBBCp-41, 0x1.0B9C222222222p-40,
+		  0x1.E1BE666666666p-43, 0x1.E8AC222222222p-44, 0x1.EAB6444444444p-46, 0x1.BF4A000000000p-49, 0x1.4049BBBBBBBBCp-53, 0x1.12FF777777777p-59, 0x1.0479BBBBBBBBCp-68 },
+		{ -0x1.CD95555555555p-51, -0x1.FD9999999999Ap-48, -0x1.66D8888888889p-46, -0x1.691AAAAAAAAABp-45, -0x1.3684444444444p-44, -0x1.EC00000000000p-44, -0x1.7D06666666666p-43,
+		  -0x1.5718888888889p-45, -0x1.5C13333333333p-46, -0x1.587DDDDDDDDDEp-48, -0x1.47A0000000000p-51, -0x1.CB5999999999Ap-56, -0x1.9BF3333333333p-62, -0x1.77D8888888889p-71 },
+		{ -0x1.8135555555555p-50, -0x1.B5CAAAAAAAAABp-47, -0x1.3347777777777p-45, -0x1.3606EEEEEEEEFp-44, -0x1.0AFAAAAAAAAABp-43, -0x1.A77BBBBBBBBBCp-43, -0x1.46CEEEEEEEEEFp-42,
+		  -0x1.2621111111111p-44, -0x1.2A4A222222222p-45, -0x1.2BF6EEEEEEEEFp-47, -0x1.110F777777777p-50, -0x1.87B4444444444p-55, -0x1.4E9AAAAAAAAABp-61, -0x1.3DA999999999Ap-70 }
+	},
+	{
+		{ 0x1.52117708AD191p-10, 0x1.7F5AD2BF31FECp-7, 0x1.0EA85F92D20BCp-5, 0x1.106EE6A7EEC63p-4, 0x1.D4CFBD8AD0197p-4, 0x1.740D99195EEC0p-3, 0x1.1F7812864BF3Fp-2,
+		  0x1.0E7254B61D954p-4, 0x1.1363E8E4CB70Cp-5, 0x1.145080F091D6Ap-7, 0x1.FA9B3A26196C2p-11, 0x1.6EA81A7AC37D7p-15, 0x1.37AF6F17C0F61p-21, 0x1.23F3137AF8AECp-30 },
+		{ -0x1.47D2E0086779Dp-15, -0x1.73BCEB640ECBEp-12, -0x1.0674B9C4AABB1p-10, -0x1.082D7AD161A6Ap-9, -0x1.C69AE6580BF2Dp-9, -0x1.68C75E281AD10p-8, -0x1.16C20272B3717p-7,
+		  -0x1.06405224F495Bp-10, -0x1.0B0B8C80C6C63p-11, -0x1.0BF0F9275EA44p-13, -0x1.EB4130A13103Fp-17, -0x1.638BBC963ED9Dp-21, -0x1.2E3D83000452Cp-27, -0x1.1B1A416FE9A08p-36 },
+		{ 0x1.3DE3C1F8576E1p-20, 0x1.687922512CFA7p-17, 0x1.FD016846A134Bp-16, 0x1.002C1A0116CC6p-14, 0x1.B8D44435E59C6p-14, 0x1.5DD8995CCEE9Fp-13, 0x1.0E4F86405873Fp-12,
+		  0x1.7D74D49261A99p-16, 0x1.846DE3A41F7A4p-17, 0x1.85BB98F4B20AEp-19, 0x1.6546AF03CB48Bp-22, 0x1.02942C1451494p-26, 0x1.B79F4A3B1347Bp-33, 0x1.9BC91972060FAp-42 },
+		{ -0x1.3441B43AB5CB1p-25, -0x1.5D8CBC4EDA8A2p-22, -0x1.ED94C2094D533p-21, -0x1.F0D1A69F9339Ap-20, -0x1.AB78800DE323Ap-19, -0x1.533EA41C1420Fp-18, -0x1.061E919A3B92Bp-17,
+		  -0x1.343F607B4D33Cp-21, -0x1.39E1D94B511C0p-22, -0x1.3AEF8328C421Ep-24, -0x1.20B53D31F0837p-27, -0x1.A1E7B698378C4p-32, -0x1.634013187BE9Ap-38, -0x1.4CC189FDC02E2p-47 },
+		{ 0x1.2AEA63E90A889p-30, 0x1.52F516D40AA22p-27, 0x1.DE9FC85040AABp-26, 0x1.E1C38EC31A889p-25, 0x1.9E8460F018777p-24, 0x1.48F6EFAEDB222p-23, 0x1.FC5A553E73444p-23,
+		  0x1.058B24B5E3555p-26, 0x1.0A530F7222AABp-27, 0x1.0B37DEE89E666p-29, 0x1.E9EDD3AB70444p-33, 0x1.62962271CEAABp-37, 0x1.2D6CC15445555p-43, 0x1.1A56BF133EAABp-52 },
+		{ -0x1.21DDE31A37777p-35, -0x1.48B24D1F88889p-32, -0x1.D0229F2F80000p-31, -0x1.D32E11114CCCDp-30, -0x1.91F804FB51111p-29, -0x1.3F01932888889p-28, -0x1.ECF6C784D1111p-28,
+		  -0x1.C89225D233333p-32, -0x1.D0EAC9AB66666p-33, -0x1.D27A366A00000p-35, -0x1.ABA162DA55555p-38, -0x1.357F73BA77777p-42, -0x1.07191A8ABBBBCp-48, -0x1.ECE1053FBBBBCp-58 },
+		{ 0x1.18C849B222222p-40, 0x1.3E633C0800000p-37, 0x1.C194A663BBBBCp-36, 0x1.C4869F7222222p-35, 0x1.855CD25B33333p-34, 0x1.3500DB1000000p-33, 0x1.DD80E21222222p-33,
+		  0x1.93E5729BBBBBCp-37, 0x1.9B523A2222222p-38, 0x1.9CA7642888889p-40, 0x1.7A4DD6799999Ap-43, 0x1.11D3B48EEEEEFp-47, 0x1.D15429A666666p-54, 0x1.B4022DA888889p-63 },
+		{ -0x1.EA8894CCCCCCDp-46, -0x1.15CECC4444444p-42, -0x1.885E8CCCCCCCDp-41, -0x1.8AE9980000000p-40, -0x1.53DDB80000000p-39, -0x1.0DC2B2EEEEEEFp-38, -0x1.A0C1A77777777p-38,
+		  -0x1.806BE66666666p-43, -0x1.8651400000000p-44, -0x1.89F7D11111111p-46, -0x1.655BE66666666p-49, -0x1.05C4711111111p-53, -0x1.AB0B377777777p-60, -0x1.98CE555555555p-69 },
+		{ 0x1.2A55888888889p-48, 0x1.587D8AAAAAAABp-45, 0x1.E500E44444444p-44, 0x1.EAFB2EEEEEEEFp-43, 0x1.A4C6711111111p-42, 0x1.4CC8BBBBBBBBCp-41, 0x1.0229288888889p-40,
+		  0x1.8DB82CCCCCCCDp-43, 0x1.8E76BBBBBBBBCp-44, 0x1.97D6B11111111p-46, 0x1.72E73DDDDDDDEp-49, 0x1.08FAB9999999Ap-53, 0x1.EA168CCCCCCCDp-60, 0x1.B53FF55555555p-69 },
+		{ -0x1.32E3488888889p-48, -0x1.5FC6CCCCCCCCDp-45, -0x1.EFDDDDDDDDDDEp-44, -0x1.F383555555555p-43, -0x1.ACB7B77777777p-42, -0x1.53B0155555555p-41, -0x1.0734D55555555p-40,
+		  -0x1.E4C0E66666666p-43, -0x1.EFA17BBBBBBBCp-44, -0x1.ED02622222222p-46, -0x1.CB018CCCCCCCDp-49, -0x1.47189DDDDDDDEp-53, -0x1.25653BBBBBBBCp-59, -0x1.0B68F11111111p-68 },
+		{ -0x1.70C399999999Ap-48, -0x1.ABCCC88888889p-45, -0x1.2D02DBBBBBBBCp-43, -0x1.30FF0CCCCCCCDp-42, -0x1.05378AAAAAAABp-41, -0x1.9CFB111111111p-41, -0x1.408F511111111p-40,
+		  -0x1.2AE8F11111111p-42, -0x1.2C1EB33333333p-43, -0x1.3267288888889p-45, -0x1.16374EEEEEEEFp-48, -0x1.8EC1FBBBBBBBCp-53, -0x1.6EBBB77777777p-59, -0x1.47BE977777777p-68 },
+		{ 0x1.9728EEEEEEEEFp-49, 0x1.D368000000000p-46, 0x1.498A222222222p-44, 0x1.4BFFBBBBBBBBCp-43, 0x1.1CC8777777777p-42, 0x1.C320EEEEEEEEFp-42, 0x1.5DCBBBBBBBBBCp-41,
+		  0x1.43C8222222222p-43, 0x1.4B69AAAAAAAABp-44, 0x1.48C7222222222p-46, 0x1.3382777777777p-49, 0x1.B4F5333333333p-54, 0x1.8C27333333333p-60, 0x1.66DC111111111p-69 },
+		{ 0x1.208CCCCCCCCCDp-48, 0x1.4E72666666666p-45, 0x1.D6CA888888889p-44, 0x1.DCCD111111111p-43, 0x1.9880EEEEEEEEFp-42, 0x1.4308444444444p-41, 0x1.F547777777777p-41,
+		  0x1.D304222222222p-43, 0x1.D606666666666p-44, 0x1.DE91777777777p-46, 0x1.B250EEEEEEEEFp-49, 0x1.37FCEEEEEEEEFp-53, 0x1.1CDB111111111p-59, 0x1.FEC7DDDDDDDDEp-69 },
+		{ -0x1.9E9BBBBBBBBBCp-51, -0x1.DCF7777777777p-48, -0x1.506AAAAAAAAABp-46, -0x1.52F7777777777p-45, -0x1.2290000000000p-44, -0x1.CC17777777777p-44, -0x1.650AAAAAAAAABp-43,
+		  -0x1.4A6EEEEEEEEEFp-45, -0x1.52B8888888889p-46, -0x1.4EE3333333333p-48, -0x1.3B0999999999Ap-51, -0x1.BE02222222222p-56, -0x1.99AEEEEEEEEEFp-62, -0x1.7065555555555p-71 },
+		{ -0x1.60B7777777777p-50, -0x1.986999999999Ap-47, -0x1.1F85DDDDDDDDEp-45, -0x1.2318888888889p-44, -0x1.F2F0000000000p-44, -0x1.8AA6666666666p-43, -0x1.321CCCCCCCCCDp-42,
+		  -0x1.1D02AAAAAAAABp-44, -0x1.1F64444444444p-45, -0x1.23FF777777777p-47, -0x1.08F8000000000p-50, -0x1.7D36666666666p-55, -0x1.5A2DDDDDDDDDEp-61, -0x1.371F777777777p-70 }
+	},
+	{
+		{ 0x1.3EC0028485FEDp-10, 0x1.6972E3F6193F8p-7, 0x1.FE62134F6046Dp-6, 0x1.00DD97A5A6A7Cp-4, 0x1.BA05B2B614BC9p-4, 0x1.5ECAFE109B634p-3, 0x1.0F0ACFA331B94p-2,
+		  0x1.069B1C5E5DF95p-4, 0x1.0B67FF96393B2p-5, 0x1.0C4DBBA9B684Fp-7, 0x1.EBEB4275BF45Dp-11, 0x1.6406D31E0BE05p-15, 0x1.2EA6254847C2Dp-21, 0x1.1B7C439F912AAp-30 },
+		{ -0x1.236DB928B5282p-15, -0x1.4A77ABD9B0D52p-12, -0x1.D2A2CFD38B6E9p-11, -0x1.D5B274621B007p-10, -0x1.94227781E73DCp-9, -0x1.40B997D4AB731p-8, -0x1.EF9EBD822F33Bp-8,
+		  -0x1.E03192F5B3C5Cp-11, -0x1.E8F8AEC98E171p-12, -0x1.EA9CC4DE90F19p-14, -0x1.C1C126D20FF50p-17, -0x1.45829522CB4EDp-21, -0x1.14B52966AB129p-27, -0x1.032FC8CC6C37Fp-36 },
+		{ 0x1.0A72F26E4FCFDp-20, 0x1.2E24455942ECEp-17, 0x1.AAA37C2F0C219p-16, 0x1.AD6FF560EE464p-15, 0x1.717E99263DEC6p-14, 0x1.253BF887DEC38p-13, 0x1.C5236B6F9F1FCp-13,
+		  0x1.494690A85757Ep-16, 0x1.4F4B708A16D2Ap-17, 0x1.506B7FAE7CC79p-19, 0x1.346730900D3ABp-22, 0x1.BE69F119F245Dp-27, 0x1.7B7C1B85DE435p-33, 0x1.6374BB9CBC4DDp-42 },
+		{ -0x1.E738968F8EC1Ep-26, -0x1.143E6B31A3415p-22, -0x1.8611D07D2BF02p-21, -0x1.88A0E0357DF73p-20, -0x1.51D2D50C04875p-19, -0x1.0C1992AD54EF1p-18, -0x1.9E4C44D32C424p-18,
+		  -0x1.F5C0DBE1A5666p-22, -0x1.FEECDBB145744p-23, -0x1.0051E7196F466p-24, -0x1.D5F292A583CCDp-28, -0x1.541FF44D47CEFp-32, -0x1.21219AC98016Fp-38, -0x1.0ED2D7D95E6C4p-47 },
+		{ 0x1.BD759688B1CCDp-31, 0x1.F921B4664A000p-28, 0x1.64A2973219DDEp-26, 0x1.66F981013099Ap-25, 0x1.34DE0876A3111p-24, 0x1.EA3D6A1ACC000p-24, 0x1.7AC96839E1AABp-23,
+		  0x1.91672872EF333p-27, 0x1.98BD8F14A1111p-28, 0x1.9A1CB7A32C444p-30, 0x1.77F55341EB777p-33, 0x1.10199D4B5EEEFp-37, 0x1.CE9C407AE999Ap-44, 0x1.B1516EB7A1111p-53 },
+		{ -0x1.974B6C81BBBBCp-36, -0x1.CDDAC18AC4444p-33, -0x1.461496AC5999Ap-31, -0x1.483830BD95555p-30, -0x1.1A67B6DBD5555p-29, -0x1.C03D176B22222p-29, -0x1.5A558F3884444p-28,
+		  -0x1.4A5AABAD33333p-32, -0x1.5064A21411111p-33, -0x1.51859F289999Ap-35, -0x1.3569D366DDDDEp-38, -0x1.BFE03F779999Ap-43, -0x1.7CBA3DE744444p-49, -0x1.649ED00E22222p-58 },
+		{ 0x1.73CF9DA666666p-41, 0x1.A59C64B777777p-38, 0x1.29AB14D777777p-36, 0x1.2B9F762EEEEEFp-35, 0x1.01CCD78800000p-34, 0x1.992F11E444444p-34, 0x1.3C28771666666p-33,
+		  0x1.12FDF29BBBBBCp-37, 0x1.1804DDC888889p-38, 0x1.18F46A4CCCCCDp-40, 0x1.019290C444444p-43, 0x1.74BB276666666p-48, 0x1.3CEB585111111p-54, 0x1.28D19E7DDDDDEp-63 },
+		{ -0x1.20A4E91111111p-46, -0x1.475782AAAAAABp-43, -0x1.CE34277777777p-42, -0x1.D143444444444p-41, -0x1.9046B66666666p-40, -0x1.3DA7200000000p-39, -0x1.EAE7E44444444p-39,
+		  -0x1.0B8F5DDDDDDDEp-44, -0x1.0EDD666666666p-45, -0x1.120FEEEEEEEEFp-47, -0x1.F21BEEEEEEEEFp-51, -0x1.6C46D55555555p-55, -0x1.3736333333333p-61, -0x1.205A800000000p-70 },
+		{ 0x1.040E99999999Ap-48, 0x1.2A9BD11111111p-45, 0x1.A4E8088888889p-44, 0x1.A651B33333333p-43, 0x1.6B40B55555555p-42, 0x1.20B519999999Ap-41, 0x1.BE6C155555555p-41,
+		  0x1.79073DDDDDDDEp-43, 0x1.7FA1377777777p-44, 0x1.8269CCCCCCCCDp-46, 0x1.5E26000000000p-49, 0x1.0803FBBBBBBBCp-53, 0x1.B5E6044444444p-60, 0x1.9F99ECCCCCCCDp-69 },
+		{ -0x1.22F1FBBBBBBBCp-48, -0x1.49D4DDDDDDDDEp-45, -0x1.D1A2F33333333p-44, -0x1.D457B33333333p-43, -0x1.9338A66666666p-42, -0x1.40107BBBBBBBCp-41, -0x1.EE74377777777p-41,
+		  -0x1.D6B6222222222p-43, -0x1.E060911111111p-44, -0x1.DF5A777777777p-46, -0x1.BA5AEEEEEEEEFp-49, -0x1.3EC84CCCCCCCDp-53, -0x1.0EE5C88888889p-59, -0x1.FE0DB33333333p-69 },
+		{ -0x1.5E1B222222222p-48, -0x1.93E6555555555p-45, -0x1.1C84C44444444p-43, -0x1.1D6F444444444p-42, -0x1.EAE9D11111111p-42, -0x1.862D911111111p-41, -0x1.2DB3FBBBBBBBCp-40,
+		  -0x1.210BA44444444p-42, -0x1.25FD6AAAAAAABp-43, -0x1.2885088888889p-45, -0x1.0C04444444444p-48, -0x1.949DD55555555p-53, -0x1.507B8CCCCCCCDp-59, -0x1.3F0C066666666p-68 },
+		{ 0x1.83E6CCCCCCCCDp-49, 0x1.B7DB777777777p-46, 0x1.365899999999Ap-44, 0x1.37FF555555555p-43, 0x1.0CA3666666666p-42, 0x1.AA7E000000000p-42, 0x1.4973444444444p-41,
+		  0x1.3AC9555555555p-43, 0x1.4144666666666p-44, 0x1.3FD2222222222p-46, 0x1.281EEEEEEEEEFp-49, 0x1.AAABBBBBBBBBCp-54, 0x1.6AFF555555555p-60, 0x1.561D333333333p-69 },
+		{ 0x1.1146CCCCCCCCDp-48, 0x1.3BC1DDDDDDDDEp-45, 0x1.BCC9111111111p-44, 0x1.BE5E222222222p-43, 0x1.7FD4666666666p-42, 0x1.310599999999Ap-41, 0x1.D7B0000000000p-41,
+		  0x1.C3B4AAAAAAAABp-43, 0x1.CB5AEEEEEEEEFp-44, 0x1.CFA2AAAAAAAABp-46, 0x1.A289555555555p-49, 0x1.3BAD99999999Ap-53, 0x1.0704666666666p-59, 0x1.F297DDDDDDDDEp-69 },
+		{ -0x1.8C3999999999Ap-51, -0x1.C162222222222p-48, -0x1.3CEBBBBBBBBBCp-46, -0x1.3E6AAAAAAAAABp-45, -0x1.1234444444444p-44, -0x1.B35BBBBBBBBBCp-44, -0x1.504DDDDDDDDDEp-43,
+		  -0x1.4184444444444p-45, -0x1.4833333333333p-46, -0x1.45CEEEEEEEEEFp-48, -0x1.2ECEEEEEEEEEFp-51, -0x1.B422222222222p-56, -0x1.7351111111111p-62, -0x1.5E8EEEEEEEEEFp-71 },
+		{ -0x1.4D6AAAAAAAAABp-50, -0x1.819DDDDDDDDDEp-47, -0x1.0F8EEEEEEEEEFp-45, -0x1.109999999999Ap-44, -0x1.D4D2222222222p-44, -0x1.7486666666666p-43, -0x1.2003333333333p-42,
+		  -0x1.13BC444444444p-44, -0x1.1863333333333p-45, -0x1.1B1BBBBBBBBBCp-47, -0x1.FECCCCCCCCCCDp-51, -0x1.80D7777777777p-55, -0x1.40F8888888889p-61, -0x1.303F777777777p-70 }
+	},
+	{
+		{ 0x1.2D8532D063141p-10, 0x1.55E938810320Fp-7, 0x1.E2CB7A0CD0B27p-6, 0x1.E5F6417E953E2p-5, 0x1.A22110D5C0977p-4, 0x1.4BD4C6D170657p-3, 0x1.00642C3296D26p-2,
+		  0x1.FED1D7DC3E942p-5, 0x1.04142275F72C8p-5, 0x1.04F392F0C465Dp-7, 0x1.DE706E7298410p-11, 0x1.5A454924C1572p-15, 0x1.265B0D7D98E80p-21, 0x1.13B79AC13AB55p-30 },
+		{ -0x1.04C639C8FBF55p-15, -0x1.27B4F29917B5Ap-12, -0x1.A18D62A34D0F3p-11, -0x1.A44A99823C3C8p-10, -0x1.69A00E8F5AC25p-9, -0x1.1EFD365445C55p-8, -0x1.BB7CD6D40C2B1p-8,
+		  -0x1.B9CA3E2644B17p-11, -0x1.C1DDA3644484Fp-12, -0x1.C36020C30F4EDp-14, -0x1.9DC905938B572p-17, -0x1.2B7A316BE60D2p-21, -0x1.FD27DFFBD91DCp-28, -0x1.DCEA8F24B9B66p-37 },
+		{ 0x1.C311B00F77005p-21, 0x1.FF7E2E01CDFD2p-18, 0x1.6920554EE75CCp-16, 0x1.6B7EC9F408FB9p-15, 0x1.38C1C7672C98Cp-14, 0x1.F069E16F17D9Ep-14, 0x1.7F8E9048A0636p-13,
+		  0x1.1E9105B7D5059p-16, 0x1.23CE091E5274Fp-17, 0x1.24C8BB4DF85ACp-19, 0x1.0C66B78231320p-22, 0x1.8482D85479E15p-27, 0x1.4A4360DA91126p-33, 0x1.3559E04F11463p-42 },
+		{ -0x1.861D227D899C4p-26, -0x1.BA5F4A34306C4p-23, -0x1.3853509244F64p-21, -0x1.3A5FD120D2DCDp-20, -0x1.0E7E14213EF80p-19, -0x1.AD54A71E6A3C9p-19, -0x1.4BB9916832C5Ap-18,
+		  -0x1.9D119D9F1D489p-22, -0x1.A49E9B96E3C9Ap-23, -0x1.A607F8AFB5EBCp-25, -0x1.82E279075AE6Fp-28, -0x1.18020C9086A89p-32, -0x1.DC0E17ACBE1EFp-39, -0x1.BDE95534D5E77p-48 },
+		{ 0x1.51655392EB000p-31, 0x1.7E97A02710BBCp-28, 0x1.0E1E8F1384889p-26, 0x1.0FE42EC2D099Ap-25, 0x1.D3E10781ECCCDp-25, 0x1.7350279413777p-24, 0x1.1EE5B2A99DAABp-23,
+		  0x1.3897C75B5F333p-27, 0x1.3E4E953B96AABp-28, 0x1.3F600C7A6C000p-30, 0x1.24C71F8DB999Ap-33, 0x1.A7CBD772A4889p-38, 0x1.68421B2FA4444p-44, 0x1.5172622023777p-53 },
+		{ -0x1.23D165F162222p-36, -0x1.4AE8CBF980000p-33, -0x1.D3428FEC44444p-32, -0x1.D653433D08889p-31, -0x1.94ACD2A308889p-30, -0x1.412763FCCCCCDp-29, -0x1.F0486A829999Ap-29,
+		  -0x1.E6BDBD6533333p-33, -0x1.EFA3DA779999Ap-34, -0x1.F14D884E66666p-36, -0x1.C7E31CA800000p-39, -0x1.49F2CA58AAAABp-43, -0x1.187B4DC855555p-49, -0x1.06B89AE766666p-58 },
+		{ 0x1.F7ABA90000000p-42, 0x1.1D9203F99999Ap-38, 0x1.933F95C000000p-37, 0x1.95E2C24666666p-36, 0x1.5D3C963777777p-35, 0x1.152912FCCCCCDp-34, 0x1.AC4B1D8000000p-34,
+		  0x1.7E3865199999Ap-38, 0x1.8547274888889p-39, 0x1.868780E222222p-41, 0x1.661A443333333p-44, 0x1.0327A0D555555p-48, 0x1.B80AD90888889p-55, 0x1.9C8353A666666p-64 },
+		{ -0x1.554349999999Ap-47, -0x1.8065988888889p-44, -0x1.0F33755555555p-42, -0x1.10DE4EEEEEEEFp-41, -0x1.D5AE9EEEEEEEFp-41, -0x1.74D28AAAAAAABp-40, -0x1.2003600000000p-39,
+		  0x1.DB3B333333333p-48, 0x1.44C6222222222p-48, 0x1.26B1DDDDDDDDEp-50, 0x1.CB14CCCCCCCCDp-54, 0x1.44AF777777777p-58, 0x1.73D6AAAAAAAABp-64, 0x1.2B90444444444p-73 },
+		{ 0x1.D8FF555555555p-49, 0x1.0BE0C00000000p-45, 0x1.770DAEEEEEEEFp-44, 0x1.7C87D11111111p-43, 0x1.4519844444444p-42, 0x1.00EE022222222p-41, 0x1.8F2119999999Ap-41,
+		  0x1.6BB8733333333p-43, 0x1.6CED0AAAAAAABp-44, 0x1.732AF11111111p-46, 0x1.4A8D111111111p-49, 0x1.E31C555555555p-54, 0x1.CC8D733333333p-60, 0x1.919039999999Ap-69 },
+		{ -0x1.09E56EEEEEEEFp-48, -0x1.35C999999999Ap-45, -0x1.B6D6844444444p-44, -0x1.BA5EDDDDDDDDEp-43, -0x1.7C47D55555555p-42, -0x1.2D8A266666666p-41, -0x1.D2474CCCCCCCDp-41,
+		  -0x1.C58DAAAAAAAABp-43, -0x1.D679A22222222p-44, -0x1.D511088888889p-46, -0x1.A93159999999Ap-49, -0x1.3413333333333p-53, -0x1.0A17955555555p-59, -0x1.EE78B33333333p-69 },
+		{ -0x1.51DCD55555555p-48, -0x1.7E51CCCCCCCCDp-45, -0x1.0BA56AAAAAAABp-43, -0x1.0FB49DDDDDDDEp-42, -0x1.D02019999999Ap-42, -0x1.6EC98CCCCCCCDp-41, -0x1.1CE7000000000p-40,
+		  -0x1.19FDA66666666p-42, -0x1.1B99ACCCCCCCDp-43, -0x1.2046E00000000p-45, -0x1.00A2F77777777p-48, -0x1.77206EEEEEEEFp-53, -0x1.62F02EEEEEEEFp-59, -0x1.36FC177777777p-68 },
+		{ 0x1.60FE222222222p-49, 0x1.9D1C000000000p-46, 0x1.24D9CCCCCCCCDp-44, 0x1.273F333333333p-43, 0x1.FB92222222222p-43, 0x1.9267555555555p-42, 0x1.3729333333333p-41,
+		  0x1.2EC5111111111p-43, 0x1.3B23555555555p-44, 0x1.3A1CAAAAAAAABp-46, 0x1.1BA0DDDDDDDDEp-49, 0x1.9C24444444444p-54, 0x1.646A444444444p-60, 0x1.4B28666666666p-69 },
+		{ 0x1.0812000000000p-48, 0x1.2AAB99999999Ap-45, 0x1.A276AAAAAAAABp-44, 0x1.A8AE666666666p-43, 0x1.6AE2666666666p-42, 0x1.1EE0AAAAAAAABp-41, 0x1.BD74888888889p-41,
+		  0x1.B86DDDDDDDDDEp-43, 0x1.BBBCAAAAAAAABp-44, 0x1.C2C2000000000p-46, 0x1.9185555555555p-49, 0x1.2552888888889p-53, 0x1.134CAAAAAAAABp-59, 0x1.E505777777777p-69 },
+		{ -0x1.65ECCCCCCCCCDp-51, -0x1.A548888888889p-48, -0x1.2AF4444444444p-46, -0x1.2D75555555555p-45, -0x1.0315555555555p-44, -0x1.9AB5555555555p-44, -0x1.3DA4444444444p-43,
+		  -0x1.347999999999Ap-45, -0x1.426AAAAAAAAABp-46, -0x1.4153333333333p-48, -0x1.20B2222222222p-51, -0x1.A4F3333333333p-56, -0x1.6CE2222222222p-62, -0x1.52DDDDDDDDDDEp-71 },
+		{ -0x1.4268888888889p-50, -0x1.6C91111111111p-47, -0x1.FF0EEEEEEEEEFp-46, -0x1.0341111111111p-44, -0x1.BB3DDDDDDDDDEp-44, -0x1.5E81111111111p-43, -0x1.1004444444444p-42,
+		  -0x1.0CBEEEEEEEEEFp-44, -0x1.0F1C444444444p-45, -0x1.1342AAAAAAAABp-47, -0x1.EAC0000000000p-51, -0x1.6646666666666p-55, -0x1.4DFAAAAAAAAABp-61, -0x1.2790888888889p-70 }
+	}
+};
+
+/* NGQP = 8: roots (8) and weights (8) on [0,80), one polynomial of degree 14 per interval */
+static const double rys_table_8[20][RYS_TABLE_NCOEF][16] = {
+	{
+		{ 0x1.0737627A45D66p-7, 0x1.232E78B101386p-4, 0x1.869B739D101B3p-3, 0x1.6A51A85DC6EA1p-2, 0x1.14CCB5E2755D3p-1, 0x1.73775B61A357Dp-1, 0x1.C266F3265D592p-1, 0x1.F3CD70E1F555Ep-1,
+		  0x1.6881282380FA3p-3, 0x1.35BF54F8813B7p-3, 0x1.CD81348E524EEp-4, 0x1.2F5597BFD0B89p-4, 0x1.67F3807EA5379p-5, 0x1.8906426E54EA8p-6, 0x1.84ED7FF3188B5p-7, 0x1.1CEABCF17B695p-8 },
+		{ -0x1.DDE9351CBACD0p-11, -0x1.F2AD23D988219p-8, -0x1.2778AA7CF25DDp-6, -0x1.BE2CDCFFE5F22p-6, -0x1.EFADFB7AB9BFDp-6, -0x1.969F5EDD5E547p-6, -0x1.B8AB6F538E8A2p-7, -0x1.88221DFADA16Cp-9,
+		  -0x1.94BA844D36C20p-7, -0x1.AD18C3EEB66E0p-6, -0x1.57CE7EADA9BFDp-5, -0x1.8C041FB048BF6p-5, -0x1.631BF3B217421p-5, -0x1.0597E584D6B15p-5, -0x1.3CFCCD854C7BDp-6, -0x1.03A8F551BA89Cp-7 },
+		{ 0x1.42D4C3BFE098Fp-14, 0x1.295D7715ED436p-11, 0x1.05108C9437B9Ap-10, 0x1.8B8626DAC789Bp-11, -0x1.645A4DDC31A1Fp-13, -0x1.08762520E894Cp-10, -0x1.F880882063FB8p-11, -0x1.1FC571F2F6CEAp-12,
+		  0x1.01AC78A7A817Bp-10, 0x1.217E9CEBBF616p-8, 0x1.768D4CBF51E49p-7, 0x1.3DF21FB3A4029p-6, 0x1.86D259D63EAF6p-6, 0x1.6F4E83C9F6A42p-6, 0x1.07FBDAEFBFF6Cp-6, 0x1.DC125EE568DA3p-8 },
+		{ -0x1.7FD4F0FE7FFDBp-18, -0x1.185B82E094FD4p-15, -0x1.9F4FB0D761AA1p-16, 0x1.462A6F648F7E6p-15, 0x1.35480026649C9p-14, 0x1.12862ADC73A66p-16, -0x1.79B83BEAFDF36p-15, -0x1.69D0BDE236E1Ep-16,
+		  -0x1.557528CEF8C9Ap-14, -0x1.56112A57C2178p-11, -0x1.495B75FA50C37p-9, -0x1.831970694A8B2p-8, -0x1.361D2E5DFFA9Cp-7, -0x1.667BE38FD3D6Fp-7, -0x1.2A67B98C4C287p-7, -0x1.2471E7A3CF467p-8 },
+		{ 0x1.A61B7B40C45E6p-22, 0x1.8FFB0A9715000p-20, -0x1.76A23B7CC9222p-20, -0x1.0C496F317955Ep-18, 0x1.031DB93D7F59Ap-20, 0x1.2C8C6B0758255p-18, -0x1.1F0E4C076C99Ap-21, -0x1.95312C6AE9555p-20,
+		  0x1.C3659FE58C7F3p-18, 0x1.6EED2F41CE31Ep-14, 0x1.F445F1FA7ECA4p-12, 0x1.859FD7C6682BAp-10, 0x1.888DF718D79CDp-9, 0x1.0F82A63E639F8p-8, 0x1.00D4EDB0665D1p-8, 0x1.0EAFF70391CD7p-9 },
+		{ -0x1.B656C96699111p-26, -0x1.281D98ACDC000p-25, 0x1.9D80B4445ACCDp-23, -0x1.75813B55C0000p-27, -0x1.5B4F0D7048CCDp-22, 0x1.42465AA9E1111p-23, 0x1.2749C565A3333p-23, -0x1.94AB3DE4BEEEFp-24,
+		  -0x1.25810C8771089p-21, -0x1.6D7049EF2CEABp-17, -0x1.539504BA977A5p-14, -0x1.532F0AF64EA1Bp-12, -0x1.A21B4EA07865Ap-11, -0x1.52902C0216867p-10, -0x1.664851EEE3940p-10, -0x1.927D1EBCC48B3p-11 },
+		{ 0x1.B13732F822AABp-30, -0x1.046324302AAABp-29, -0x1.26E1D4D97BBBCp-27, 0x1.496033996CCCDp-26, -0x1.B2181082CCCCDp-28, -0x1.F7E4CBCECCCCDp-27, 0x1.03E1869566666p-26, -0x1.5D8D90B3CCCCDp-28,
+		  0x1.760652E59BBBCp-25, 0x1.5681609FD7E22p-20, 0x1.A4CABEE2CB766p-17, 0x1.0688A9C4CB7A7p-14, 0x1.83335CBA9A2B8p-13, 0x1.687F3FD3A4B7Ap-12, 0x1.A53262D917447p-12, 0x1.F483AA5AC5798p-13 },
+		{ -0x1.985E33B555555p-34, 0x1.5FD67F2CCCCCDp-32, -0x1.CC6395CEEEEEFp-33, -0x1.916340C555555p-31, 0x1.D8BDE8399999Ap-30, -0x1.B50D713777777p-30, 0x1.9A74458000000p-31, -0x1.D0A6B5DDDDDDEp-33,
+		  -0x1.D35B354ECCCCDp-29, -0x1.30D082AE10000p-23, -0x1.E2B3DE9F0F666p-20, -0x1.7018E7E0E5A00p-17, -0x1.3EBE3E796203Cp-15, -0x1.500521FE7E449p-14, -0x1.AC98878EA13F3p-14, -0x1.0B9C816D123B1p-14 },
+		{ 0x1.6F75B93DDDDDEp-38, -0x1.B541330000000p-36, 0x1.FEF327BBBBBBCp-35, -0x1.3B44A8F777777p-34, 0x1.8E659DDDDDDDEp-35, -0x1.4CA3DDDDDDDDEp-42, -0x1.A531600000000p-38, -0x1.63E3511111111p-40,
+		  0x1.1F380AFBBBBBCp-32, 0x1.034269AA5999Ap-26, 0x1.02E607CA6999Ap-22, 0x1.D9A91364B0111p-20, 0x1.D9EB8E5467AEFp-18, 0x1.172345870BB91p-16, 0x1.80E95AF570DF3p-16, 0x1.F6432BCB3E326p-17 },
+		{ -0x1.55A490CCCCCCDp-42, 0x1.1AAB633333333p-40, -0x1.2B131BBBBBBBCp-38, 0x1.A4E2B00000000p-38, -0x1.A46C75DDDDDDEp-37, 0x1.ED68D55555555p-38, -0x1.12D7DCCCCCCCDp-37, -0x1.72C7B33333333p-39,
+		  -0x1.64A7128888889p-36, -0x1.A7A86B83BBBBCp-30, -0x1.05AA7ADE40000p-25, -0x1.1A74B43A46666p-22, -0x1.41FB994C2A555p-20, -0x1.A2F88F9E31222p-19, -0x1.35A3C0B1A2E89p-18, -0x1.A419DD14A0C00p-19 },
+		{ -0x1.919AF33333333p-46, -0x1.7B31C44444444p-42, -0x1.D5EAAAAAAAAABp-41, -0x1.86CC377777777p-40, -0x1.69DB911111111p-39, -0x1.53C3666666666p-39, -0x1.16D8C88888889p-38, -0x1.09B81BBBBBBBCp-38,
+		  0x1.93A0A22222222p-41, 0x1.4BD5BD3777777p-33, 0x1.F51DBAA6EEEEFp-29, 0x1.3A987DB748889p-25, 0x1.938350278999Ap-23, 0x1.1F0B97A3B6889p-21, 0x1.C362242DB1889p-21, 0x1.3CFC31A485B33p-21 },
+		{ 0x1.56F1888888889p-46, 0x1.78CE000000000p-43, 0x1.08DD333333333p-41, 0x1.B3A6000000000p-41, 0x1.6BAFCCCCCCCCDp-40, 0x1.BC88000000000p-40, 0x1.0B6D888888889p-39, 0x1.2904EEEEEEEEFp-39,
+		  0x1.5433DDDDDDDDEp-42, -0x1.ED92344444444p-37, -0x1.C84A1F4CCCCCDp-32, -0x1.48E0747777777p-28, -0x1.D52FD16BCCCCDp-26, -0x1.697DA6152AAABp-24, -0x1.2C472CC8FAAABp-23, -0x1.B2D204D7D3333p-24 },
+		{ 0x1.F53C666666666p-46, 0x1.13AFBBBBBBBBCp-42, 0x1.6B32222222222p-41, 0x1.49F5DDDDDDDDEp-40, 0x1.EFF4000000000p-40, 0x1.43F3111111111p-39, 0x1.82B3333333333p-39, 0x1.A840AAAAAAAABp-39,
+		  0x1.4B0F555555555p-41, 0x1.0A18B33333333p-39, 0x1.92876CCCCCCCDp-35, 0x1.454A938888889p-31, 0x1.FEDBF74CCCCCDp-29, 0x1.A707341955555p-27, 0x1.7135FAFB88889p-26, 0x1.12BF6CBC3BBBCp-26 },
+		{ -0x1.694999999999Ap-48, -0x1.8824444444444p-45, -0x1.0317777777777p-43, -0x1.D806666666666p-43, -0x1.61E1111111111p-42, -0x1.CE91111111111p-42, -0x1.1341111111111p-41, -0x1.2E26666666666p-41,
+		  -0x1.D8ECCCCCCCCCDp-44, -0x1.F4D2222222222p-43, -0x1.5F3D6EEEEEEEFp-38, -0x1.3EE87EEEEEEEFp-34, -0x1.134A043BBBBBCp-31, -0x1.E9764AAAAAAABp-30, -0x1.C0861BDCCCCCDp-29, -0x1.56E87B6222222p-29 },
+		{ -0x1.31AD555555555p-47, -0x1.500AAAAAAAAABp-44, -0x1.BC9DDDDDDDDDEp-43, -0x1.928DDDDDDDDDEp-42, -0x1.2E6CCCCCCCCCDp-41, -0x1.8C7BBBBBBBBBCp-41, -0x1.D80AAAAAAAAABp-41, -0x1.02FE666666666p-40,
+		  -0x1.8EF5555555555p-43, -0x1.69CBBBBBBBBBCp-43, 0x1.72FCCCCCCCCCDp-42, 0x1.15C3D11111111p-37, 0x1.079693BBBBBBCp-34, 0x1.F0F63BDDDDDDEp-33, 0x1.D95F3BB333333p-32, 0x1.71A1EAA666666p-32 }
+	},
+	{
+		{ 0x1.A87F71840EFA6p-8, 0x1.DA4649C2B3231p-5, 0x1.447533CF554B2p-3, 0x1.35E412C9BA2E3p-2, 0x1.EB8D6D0E7ABC9p-2, 0x1.581780E7827B1p-1, 0x1.B27978362B747p-1, 0x1.F01311785E8B3p-1,
+		  0x1.3CD24A43DFCF1p-3, 0x1.CC85108E0585Ap-4, 0x1.EBABFE7E69C6Fp-5, 0x1.8B3287683725Dp-6, 0x1.F4D1A72F1FBA3p-8, 0x1.0DDC9386F4DAAp-9, 0x1.1068408845EC6p-11, 0x1.F228B970A3E66p-14 },
+		{ -0x1.5AD0A724FE7E1p-11, -0x1.7559605D80C2Ep-8, -0x1.D7288601D7E02p-7, -0x1.87257F27894E9p-6, -0x1.EC3E2CF85860Ap-6, -0x1.D308974C48C7Dp-6, -0x1.244C3D121FE0Fp-6, -0x1.20B311E7250A0p-8,
+		  -0x1.2E0D4B50FCB6Fp-7, -0x1.D237D288F1308p-7, -0x1.032362F58CC6Fp-6, -0x1.77B1E5521242Ep-7, -0x1.7EB4CFA7F2B17p-8, -0x1.2DD1C157B7B23p-9, -0x1.95F3FAECC29E7p-11, -0x1.B9DA15BE4F749p-13 },
+		{ 0x1.A68770017BC70p-15, 0x1.A2C698FEE6124p-12, 0x1.B1AA60878E2EEp-11, 0x1.D52E3B371F27Ep-11, 0x1.1A8EA4658EA46p-12, -0x1.A12F64D43EC8Cp-11, -0x1.427B697421B5Ap-10, -0x1.D6C6ABCE84BEAp-12,
+		  0x1.45725F14062D2p-11, 0x1.0151816C59886p-9, 0x1.C4904621CD80Bp-9, 0x1.E20FC44FAD4EFp-9, 0x1.5A7BB1E238D3Dp-9, 0x1.706BECF91CC32p-10, 0x1.39CA7C686067Dp-11, 0x1.8BAAE52DA15DAp-13 },
+		{ -0x1.C698680F08E98p-19, -0x1.829635211ADEBp-16, -0x1.F0FFF36509A28p-16, 0x1.2F0CF578225D1p-17, 0x1.1F4B55C256179p-14, 0x1.CD73CA91F25A7p-15, -0x1.5811B49A6DFD2p-15, -0x1.41AB2697634A4p-15,
+		  -0x1.714DB3555326Fp-15, -0x1.FD855FD316263p-13, -0x1.4748CC8AD62BAp-11, -0x1.E4C231DEAF6ADp-11, -0x1.D29A6B557C915p-11, -0x1.3F94ACE7D05E7p-11, -0x1.4CEFB8C4E62A2p-12, -0x1.DC3D7AD684D38p-14 },
+		{ 0x1.C5FC962D641A2p-23, 0x1.26B0B8DE224C4p-20, 0x1.D4F543425CCCDp-28, -0x1.AF4BC3E0F74DEp-19, -0x1.21F06F3564AABp-19, 0x1.3B0B510AA619Ap-18, 0x1.01D117E6C12ABp-19, -0x1.7A1E47C82D7BCp-19,
+		  0x1.A6912DAE4B8CDp-19, 0x1.CFAADE068F60Bp-16, 0x1.A14609CA70F8Ep-14, 0x1.9C9CAAF7FE13Bp-13, 0x1.0027A45471A37p-12, 0x1.B556A6C15AADCp-13, 0x1.0F52919EC83E7p-13, 0x1.B0E6A27DC799Dp-15 },
+		{ -0x1.AEB0550236000p-27, -0x1.5164647648666p-25, 0x1.866263F5D7BBCp-24, 0x1.2B7A3D91C8CCDp-23, -0x1.1325F5DBC9555p-22, -0x1.29CBF8CF50889p-23, 0x1.86DDA5F1EEAABp-22, -0x1.734324D4EE666p-23,
+		  -0x1.DFD4588FA3BBCp-23, -0x1.8BAE18DF656DEp-19, -0x1.E2CDC4B9A6D8Dp-17, -0x1.351BCBF06109Bp-15, -0x1.E13E16B22053Fp-15, -0x1.F3050F69D03A2p-15, -0x1.68E829DA3CB39p-15, -0x1.3CB3B4383BB18p-16 },
+		{ 0x1.8701129ED0000p-31, 0x1.1BDEC3D266666p-31, -0x1.F55DDA3D5999Ap-28, 0x1.74E565F7DDDDEp-28, 0x1.0EC3EA95C6666p-26, -0x1.0007902BB5555p-25, 0x1.520CE3D4C8889p-26, -0x1.0987478C91111p-27,
+		  0x1.0C17BFB070000p-26, 0x1.406FC48159777p-22, 0x1.020E5485911EFp-19, 0x1.A18FB94DCA06Bp-18, 0x1.8E5B8EFF703ECp-17, 0x1.EB4B1A4892409p-17, 0x1.96E883D5EFD38p-17, 0x1.8431F5CBF700Bp-18 },
+		{ -0x1.568498CD55555p-35, 0x1.3020839111111p-34, 0x1.1AEEEFC555555p-32, -0x1.0504F27000000p-30, 0x1.13A99E4777777p-30, -0x1.5AE21C8888889p-35, -0x1.333A6F1555555p-31, -0x1.1400C51111111p-34,
+		  -0x1.274A6E5266666p-30, -0x1.F0552EC888889p-26, -0x1.01F72770F3333p-22, -0x1.026B757B23333p-20, -0x1.2865A8DBB3BDEp-19, -0x1.AB18D290DF98Dp-19, -0x1.8F0653572A4ADp-19, -0x1.99C19273E1501p-20 },
+		{ 0x1.21E8BDF333333p-39, -0x1.22452F5555555p-37, 0x1.02E06C6666666p-37, 0x1.14663ACCCCCCDp-35, -0x1.E5FB448000000p-34, 0x1.9C65B7C444444p-33, -0x1.87A3303BBBBBCp-33, 0x1.4EDE5ECCCCCCDp-35,
+		  0x1.4158270CCCCCDp-34, 0x1.71B5107266666p-29, 0x1.E683CA519BBBCp-26, 0x1.287AD0E98F555p-23, 0x1.921E2F82E1B33p-22, 0x1.4D580B5D43A89p-21, 0x1.5AC2D5C1BFECDp-21, 0x1.7C06391EA02C0p-22 },
+		{ -0x1.1F366BBBBBBBCp-43, 0x1.A6D3088888889p-42, -0x1.3C63388888889p-39, 0x1.E737AAAAAAAABp-40, -0x1.619E2CCCCCCCDp-38, 0x1.D56B266666666p-39, -0x1.0CB371999999Ap-36, 0x1.1E0F800000000p-39,
+		  -0x1.7BC636EEEEEEFp-38, -0x1.0A50ACB444444p-32, -0x1.B39C211A44444p-29, -0x1.3E022ADB48889p-26, -0x1.F6AED79AC1555p-25, -0x1.D90DE9C57FBBCp-24, -0x1.0EDEC9F94FD11p-23, -0x1.3A791A2FE4F55p-24 },
+		{ -0x1.9D42377777777p-46, -0x1.3DD2000000000p-42, -0x1.4155D11111111p-41, -0x1.CAB1333333333p-40, -0x1.61A059999999Ap-40, -0x1.10F4533333333p-38, -0x1.CD11266666666p-39, -0x1.D837733333333p-39,
+		  -0x1.6DC4F77777777p-42, 0x1.699CFDDDDDDDEp-36, 0x1.73C42F1000000p-32, 0x1.40FDFA8388889p-29, 0x1.23E2887DC2222p-27, 0x1.341EC9BC4D555p-26, 0x1.8097A201A6666p-26, 0x1.D5F2C36461EEFp-27 },
+		{ 0x1.156CEEEEEEEEFp-46, 0x1.38CB333333333p-43, 0x1.A086CCCCCCCCDp-42, 0x1.8F80444444444p-41, 0x1.34F1BBBBBBBBCp-40, 0x1.9247DDDDDDDDEp-40, 0x1.1401AAAAAAAABp-39, 0x1.2AA4EEEEEEEEFp-39,
+		  0x1.785C222222222p-42, -0x1.A717C88888889p-40, -0x1.2EE663DDDDDDEp-35, -0x1.3243A59111111p-32, -0x1.3C9CDE76CCCCDp-30, -0x1.72C59379AAAABp-29, -0x1.F3C3BB09D1111p-29, -0x1.3F772424F2222p-29 },
+		{ 0x1.8964AAAAAAAABp-46, 0x1.BBCC000000000p-43, 0x1.2D2EEEEEEEEEFp-41, 0x1.1C9B99999999Ap-40, 0x1.B760AAAAAAAABp-40, 0x1.3018EEEEEEEEFp-39, 0x1.77F8AAAAAAAABp-39, 0x1.A5AACCCCCCCCDp-39,
+		  0x1.1C6ACCCCCCCCDp-41, 0x1.305AEEEEEEEEFp-41, 0x1.00F1A00000000p-38, 0x1.172084CCCCCCDp-35, 0x1.436D945DDDDDEp-33, 0x1.A03C433EEEEEFp-32, 0x1.2CB65B22EEEEFp-31, 0x1.9063425A00000p-32 },
+		{ -0x1.1FE0000000000p-48, -0x1.3D64444444444p-45, -0x1.AC0AAAAAAAAABp-44, -0x1.9466666666666p-43, -0x1.3A60000000000p-42, -0x1.AF06666666666p-42, -0x1.0B05555555555p-41, -0x1.2C51111111111p-41,
+		  -0x1.98FDDDDDDDDDEp-44, -0x1.75F4444444444p-44, -0x1.A801DDDDDDDDEp-42, -0x1.F76FBBBBBBBBCp-39, -0x1.46F5DB5555555p-36, -0x1.CE020C2222222p-35, -0x1.65820D4222222p-34, -0x1.EF76955666666p-35 },
+		{ -0x1.E09EEEEEEEEEFp-48, -0x1.0EE2222222222p-44, -0x1.6FF4444444444p-43, -0x1.5B11111111111p-42, -0x1.0D1A222222222p-41, -0x1.7258888888889p-41, -0x1.C9B0000000000p-41, -0x1.015B333333333p-40,
+		  -0x1.5A9AAAAAAAAABp-43, -0x1.0CAEEEEEEEEEFp-43, -0x1.9960000000000p-45, 0x1.7201BBBBBBBBCp-42, 0x1.26F7066666666p-39, 0x1.C542C4CCCCCCDp-38, 0x1.72D2755555555p-37, 0x1.0931E16AAAAABp-37 }
+	},
+	{
+		{ 0x1.5D6B9FC40CAE7p-8, 0x1.88A5D90615BC0p-5, 0x1.0FDBE78017925p-3, 0x1.08B0710515627p-2, 0x1.AFA4F03F40AB6p-2, 0x1.39887B736CDB6p-1, 0x1.9D8A6F9707B5Dp-1, 0x1.EA75F9E5EC1B3p-1,
+		  0x1.1B84E2AFFA725p-3, 0x1.71A8B8CE0AADBp-4, 0x1.3AD62005BF392p-5, 0x1.611F958456397p-7, 0x1.0B4CEBFD7A6BDp-9, 0x1.23A32D610F4C0p-12, 0x1.0A59CC4FFA5D2p-15, 0x1.ECB3FF0F20668p-19 },
+		{ -0x1.0368511C00ADEp-11, -0x1.1CAC0C0DB4C20p-8, -0x1.762FDA23F0476p-7, -0x1.4C36E8924F8C5p-6, -0x1.CE879311BA407p-6, -0x1.FA2D7F732CFCCp-6, -0x1.7B71A3332A283p-6, -0x1.BB75D06ABB12Ap-8,
+		  -0x1.D6670986F1A04p-8, -0x1.19A7C597C2A4Fp-7, -0x1.D6800BF7C578Cp-8, -0x1.DBBC7F5DD3FB9p-9, -0x1.2C5362C812381p-10, -0x1.010E38759A7A8p-12, -0x1.58EA955A0F1F7p-15, -0x1.A1F34D39D5A04p-18 },
+		{ 0x1.1F71CFD6437BCp-15, 0x1.2A4DA9F4ED184p-12, 0x1.578D473306F39p-11, 0x1.CF636AEBE3288p-11, 0x1.410BFF1EEB3B4p-11, -0x1.84F0DAD665721p-12, -0x1.6E3C29EC8DC08p-10, -0x1.8FA8CBC98647Fp-11,
+		  0x1.B5B0AEF884B87p-12, 0x1.0341AC5573F37p-10, 0x1.505D1CAA2196Ep-10, 0x1.E9725FC21346Ep-11, 0x1.B51F6FD192359p-12, 0x1.05A72A00BED5Ap-13, 0x1.DC9A217E1B7CCp-16, 0x1.6894506DCB8E2p-18 },
+		{ -0x1.1A205434830FBp-19, -0x1.07C5EF3900C02p-16, -0x1.C42C74B1B1402p-16, -0x1.66E8B43F57022p-17, 0x1.6FC15371FE474p-15, 0x1.5A53477AAAC8Cp-14, -0x1.21CD44386371Ap-17, -0x1.214920FD1553Fp-14,
+		  -0x1.B060BE794F662p-16, -0x1.B607DCDD153B9p-14, -0x1.94E3E817475FEp-13, -0x1.95813E7637A35p-13, -0x1.E985C33F83301p-14, -0x1.863953D004D21p-15, -0x1.CC95346ABAA1Dp-17, -0x1.A477E91722E70p-19 },
+		{ 0x1.0128E750C56D1p-23, 0x1.9186F1D041ACDp-21, 0x1.28837BD09C489p-21, -0x1.CD2A0DCAEDC44p-20, -0x1.E6A5DDFCA4689p-19, 0x1.CE16489416D55p-20, 0x1.A971CE100D555p-18, -0x1.4CCED15E3DC44p-18,
+		  0x1.B172A49DE2B11p-20, 0x1.575CFD3EAFDCEp-17, 0x1.B5130E2859712p-16, 0x1.22F5FDD8B4DF2p-15, 0x1.C9F7668724BADp-16, 0x1.D515E7171C30Ap-17, 0x1.5AB110342B8ADp-18, 0x1.73E6625546BE3p-20 },
+		{ -0x1.C0EF8B1849DDEp-28, -0x1.027B6E9F44444p-25, 0x1.B53721F455DDEp-26, 0x1.30300BF992222p-23, -0x1.25AF928345555p-25, -0x1.BE5AB41FEA666p-22, 0x1.E556565A01555p-22, -0x1.017CE25851DDEp-22,
+		  -0x1.B47FAAAAD8222p-24, -0x1.FC92C4811F4CDp-21, -0x1.B1C66F60A1522p-19, -0x1.75966D571623Cp-18, -0x1.753400E50C739p-18, -0x1.DDF548A771B20p-19, -0x1.AEA29BD171061p-20, -0x1.09AB14DC0B858p-21 },
+		{ 0x1.743713E18CCCDp-32, 0x1.D0F41EF94CCCDp-31, -0x1.FF8935F937777p-29, -0x1.E8BE974588889p-29, 0x1.294EA5A6D5555p-26, -0x1.5E0FAD1C33333p-27, -0x1.ECC7AAE62AAABp-27, 0x1.05BD99F333333p-30,
+		  0x1.AE15D85175555p-28, 0x1.67DE845A8BBBCp-24, 0x1.91F60834CB511p-22, 0x1.B62CD610A8B77p-21, 0x1.0FDE04C3D2AFEp-20, 0x1.A9C323715BE16p-21, 0x1.C96583B2E0287p-22, 0x1.3EE2BD1DEE436p-23 },
+		{ -0x1.3293C1B4CCCCDp-36, -0x1.5E6E995555555p-38, 0x1.DEF75D0EEEEEFp-33, -0x1.639F706444444p-32, -0x1.5EB32D0222222p-31, 0x1.55FB924333333p-29, -0x1.2D64DB0155555p-28, 0x1.04EE66B111111p-29,
+		  -0x1.AB3A289777777p-32, -0x1.E9AE4D6EAAAABp-28, -0x1.5F4685B946EEFp-25, -0x1.DC04971D7D333p-24, -0x1.6847E70897A66p-23, -0x1.528EC0FF08880p-23, -0x1.A9A0E4D6B7A51p-24, -0x1.4A665484EC7FAp-25 },
+		{ 0x1.E4C94A2222222p-41, -0x1.FC5D81DDDDDDEp-40, -0x1.D264B93333333p-38, 0x1.4277C10000000p-35, -0x1.0EF94FDDDDDDEp-34, 0x1.0422240000000p-34, -0x1.A09C95A222222p-33, 0x1.22A019C444444p-32,
+		  0x1.9F808E5DDDDDEp-36, 0x1.424627AD55555p-31, 0x1.23CA4D47EAAABp-28, 0x1.E3D0389D60000p-27, 0x1.B7B55EF249333p-26, 0x1.E7DEC65491266p-26, 0x1.6121AF011165Ep-26, 0x1.2D62C79EB36BCp-27 },
+		{ -0x1.EFF7E66666666p-45, 0x1.E2C2111111111p-45, -0x1.21A5CAAAAAAABp-41, -0x1.14E37BBBBBBBCp-39, 0x1.6970533333333p-38, -0x1.4B84EF7777777p-36, 0x1.66AEA00000000p-36, 0x1.52F0EB3333333p-36,
+		  -0x1.FFAFF11111111p-40, -0x1.9DDA4C2222222p-35, -0x1.CF6D47319999Ap-32, -0x1.CF815C1BE6666p-30, -0x1.F2D8219DB8889p-29, -0x1.421B52DD38444p-28, -0x1.08B749A33C4CDp-28, -0x1.EB6CD57433EEFp-30 },
+		{ -0x1.74F819999999Ap-46, -0x1.DDC3D11111111p-43, -0x1.2107422222222p-41, -0x1.3BC5622222222p-40, -0x1.CCAD222222222p-40, -0x1.843E333333333p-39, 0x1.F93A222222222p-44, -0x1.7D54C44444444p-39,
+		  -0x1.134F288888889p-41, 0x1.C642D9999999Ap-39, 0x1.5F49759DDDDDEp-35, 0x1.A4CA95B777777p-33, 0x1.08E97A1C1999Ap-31, 0x1.8921D3A192222p-31, 0x1.6A4A0D58B6889p-31, 0x1.6A4AD88AA9777p-32 },
+		{ 0x1.C389555555555p-47, 0x1.00F8555555555p-43, 0x1.5CA3222222222p-42, 0x1.5A33BBBBBBBBCp-41, 0x1.0756000000000p-40, 0x1.ACB0222222222p-40, 0x1.033E444444444p-39, 0x1.1FEF666666666p-39,
+		  0x1.5BCE444444444p-42, -0x1.0CBCCCCCCCCCDp-44, -0x1.F7B3BCCCCCCCDp-39, -0x1.6B48D2A222222p-36, -0x1.08B11E2A22222p-34, -0x1.BE08479800000p-34, -0x1.C79DA16AC4444p-34, -0x1.E6A49E7B6AAABp-35 },
+		{ 0x1.47A6CCCCCCCCDp-46, 0x1.6C61333333333p-43, 0x1.F6DC222222222p-42, 0x1.E439555555555p-41, 0x1.85E6AAAAAAAABp-40, 0x1.1670444444444p-39, 0x1.6422888888889p-39, 0x1.A009555555555p-39,
+		  0x1.001CBBBBBBBBCp-41, 0x1.7179BBBBBBBBCp-42, 0x1.0911C44444444p-41, 0x1.338F511111111p-39, 0x1.F5D02ECCCCCCDp-38, 0x1.DA89362000000p-37, 0x1.0A21F44688889p-36, 0x1.2D954C0C33333p-37 },
+		{ -0x1.CDA2222222222p-49, -0x1.03F6666666666p-45, -0x1.656DDDDDDDDDEp-44, -0x1.5973333333333p-43, -0x1.1588888888889p-42, -0x1.8DACCCCCCCCCDp-42, -0x1.013DDDDDDDDDEp-41, -0x1.2A58888888889p-41,
+		  -0x1.6795555555555p-44, -0x1.FAEEEEEEEEEEFp-45, -0x1.EC6999999999Ap-45, -0x1.003B088888889p-42, -0x1.D66DBEEEEEEEFp-41, -0x1.F341944444444p-40, -0x1.33301FFBBBBBCp-39, -0x1.70FE28C888889p-40 },
+		{ -0x1.8FD3333333333p-48, -0x1.BD0DDDDDDDDDEp-45, -0x1.32F4CCCCCCCCDp-43, -0x1.27EDDDDDDDDDEp-42, -0x1.DB95555555555p-42, -0x1.5391111111111p-41, -0x1.B6FEEEEEEEEEFp-41, -0x1.FE2CCCCCCCCCDp-41,
+		  -0x1.38A199999999Ap-43, -0x1.A69999999999Ap-44, -0x1.787AAAAAAAAABp-45, 0x1.C344444444444p-48, 0x1.801EDDDDDDDDEp-44, 0x1.D39C677777777p-43, 0x1.371C9B0000000p-42, 0x1.876A7A5555555p-43 }
+	},
+	{
+		{ 0x1.248FF139CA231p-8, 0x1.49DCAD5C7A257p-5, 0x1.CC10123DA0E38p-4, 0x1.C557AC979935Cp-3, 0x1.78A2CB93DB14Cp-2, 0x1.197B92B576CA6p-1, 0x1.82FCCCC453516p-1, 0x1.E1A4CC78D4C84p-1,
+		  0x1.0129C227DAACEp-3, 0x1.3897851CFA3E3p-4, 0x1.CAAA1E5688AB5p-6, 0x1.913CA0DBFDFEDp-8, 0x1.9DB25209339F7p-11, 0x1.FB659BCDD619Ap-15, 0x1.97A8E39FBA206p-19, 0x1.29EC35F69CC04p-23 },
+		{ -0x1.8E02D8FC4E4BCp-12, -0x1.BA1437AC34897p-9, -0x1.2A45797FFACCDp-7, -0x1.151F39CADD98Ep-6, -0x1.9FAD21CE15D27p-6, -0x1.00F4445EC6F1Dp-5, -0x1.D4DD2522A7CFBp-6, -0x1.628CBCF7F4334p-7,
+		  -0x1.7A5351AF66609p-8, -0x1.70D018F82A951p-8, -0x1.E9137591C85C2p-9, -0x1.77971DAB06468p-10, -0x1.46201311B6DE0p-12, -0x1.48555B98C61D4p-15, -0x1.A985DD650830Ep-19, -0x1.D31C3C81ACD86p-23 },
+		{ 0x1.93EEE91A6985Fp-16, 0x1.AFC8ED83315D0p-13, 0x1.0A6362D0EB69Fp-11, 0x1.9D88CD5761B0Fp-11, 0x1.9DCEC291FC7AEp-11, 0x1.146D4010E72E5p-13, -0x1.4C2E96A4F40E5p-10, -0x1.57FEA4988E29Ep-10,
+		  0x1.34FF7F2A52761p-12, 0x1.1F81E77F93043p-11, 0x1.25824ED00C2EBp-11, 0x1.3BB5BFB2CF8CFp-12, 0x1.7BC17E4DE856Dp-14, 0x1.0D2F7E9C0AA5Ep-16, 0x1.F3E7E4876D882p-20, 0x1.7A8633329CFAEp-23 },
+		{ -0x1.6CF4A5CCB0502p-20, -0x1.6ACDA278FA027p-17, -0x1.711D493DBA458p-16, -0x1.46946DBE72866p-16, 0x1.0917FD9ED9A93p-16, 0x1.4D697CEFB94D5p-14, 0x1.CF644CF2CB2ECp-15, -0x1.E84C2A9731928p-14,
+		  -0x1.0E1C808B5273Fp-16, -0x1.A51F68512CC9Fp-15, -0x1.2A349751A7F5Fp-14, -0x1.B0EAD0823B0E8p-15, -0x1.5DF29A2129DC4p-16, -0x1.4F231BF0EA11Fp-18, -0x1.A71FFA8A9FFC3p-21, -0x1.A342835557CACp-24 },
+		{ 0x1.2F96591447FABp-24, 0x1.09C132C084389p-21, 0x1.5606DC96DD711p-21, -0x1.31B0BBB1F2B33p-21, -0x1.A6F58CAB906BCp-19, -0x1.3B886942ADD77p-19, 0x1.23B2E3C574FD5p-17, -0x1.ABC3B26EA8D55p-18,
+		  0x1.DC11E1E8C9C22p-21, 0x1.2084096DD43A2p-18, 0x1.13BACE6ECE359p-17, 0x1.06DAA2406550Ep-17, 0x1.146807D3DA91Fp-18, 0x1.592DB35B10E3Bp-20, 0x1.1CE64FDB92036p-22, 0x1.632B88670495Ap-25 },
+		{ -0x1.F0198FBB64CCDp-29, -0x1.656E48F7F4444p-26, -0x1.019F906C57777p-28, 0x1.70D8068741DDEp-24, 0x1.C433DA539CCCDp-24, -0x1.678E937E7EEEFp-22, -0x1.B626309071111p-24, 0x1.ABA8A6A9F2222p-24,
+		  -0x1.B4C9EB4DB7777p-25, -0x1.771D4457B3CCDp-22, -0x1.D93A7BBD1F322p-21, -0x1.21A83DC397402p-20, -0x1.83147E72F42DCp-21, -0x1.33220671A532Ep-22, -0x1.41A35D02BC25Cp-24, -0x1.E91FC6C81F036p-27 },
+		{ 0x1.7C30045A44444p-33, 0x1.81AE82B291111p-31, -0x1.6AF29C4BB3333p-30, -0x1.42ACFD9E8CCCDp-28, 0x1.90C49507AAAABp-28, 0x1.694B512EE8889p-26, -0x1.324698E3A0000p-24, 0x1.3DF91E15E5555p-24,
+		  0x1.7D4EFA98A2222p-29, 0x1.D519978C38889p-26, 0x1.7F0C09589CBBCp-24, 0x1.271ED8B8C6333p-23, 0x1.EB8028F6537C4p-24, 0x1.E5210E228870Cp-25, 0x1.3A720A1F033F1p-26, 0x1.1C65B3202B2D7p-28 },
+		{ -0x1.E36E438CCCCCDp-38, -0x1.6900941111111p-38, 0x1.40D1113111111p-33, 0x1.1D60693BBBBBCp-33, -0x1.7E65E62444444p-31, 0x1.921374A555555p-30, -0x1.78E020F99999Ap-30, 0x1.4D90E9A444444p-27,
+		  -0x1.31232D4000000p-33, -0x1.1B6C9F6100000p-29, -0x1.26AE744A4AAABp-27, -0x1.193EFE93DAAABp-26, -0x1.1F2C36A61EEEFp-26, -0x1.5A4EC63E641BCp-27, -0x1.101D277AD6F84p-28, -0x1.1EA6440C7C4F4p-30 },
+		{ 0x1.4FA54F5555555p-41, 0x1.18B3DBDDDDDDEp-39, 0x1.B47B600000000p-42, 0x1.B28277EEEEEEFp-36, 0x1.B331813333333p-35, -0x1.0F32A56222222p-33, 0x1.68746CDDDDDDEp-31, 0x1.66ED03E000000p-31,
+		  0x1.A14E02CCCCCCDp-37, 0x1.4A8D34F333333p-33, 0x1.AFE614B755555p-31, 0x1.F94E2E16C4444p-30, 0x1.381D715EF7BBCp-29, 0x1.C4BD8B7F2FF77p-30, 0x1.A786096461355p-31, 0x1.FE7166BA79F55p-33 },
+		{ -0x1.3515A66666666p-46, 0x1.7E56888888889p-45, 0x1.B7D7222222222p-43, -0x1.08245DDDDDDDEp-40, 0x1.A4CEAEEEEEEEFp-39, -0x1.5A45333333333p-42, 0x1.78DCC04444444p-35, -0x1.47AA655555555p-37,
+		  -0x1.4EA979999999Ap-41, -0x1.866E611111111p-37, -0x1.32D82E7AAAAABp-34, -0x1.AF857F5844444p-33, -0x1.3E1E690CE2222p-32, -0x1.11A8A0BCCEAABp-32, -0x1.2BF47BF0D8E66p-33, -0x1.97550B8EAF000p-35 },
+		{ -0x1.596ECCCCCCCCDp-46, -0x1.A26D59999999Ap-43, -0x1.1B61B55555555p-41, -0x1.0AA4644444444p-40, -0x1.0C9D666666666p-39, -0x1.4AF359999999Ap-40, -0x1.F6CAD11111111p-38, -0x1.9098344444444p-37,
+		  -0x1.1759B77777777p-41, 0x1.DFF6B33333333p-42, 0x1.97C57A4444444p-38, 0x1.5EBF6F9111111p-36, 0x1.31D90EA711111p-35, 0x1.3438F139B5555p-35, 0x1.86443DCAB199Ap-36, 0x1.26A09053CCAABp-37 },
+		{ 0x1.6C4C666666666p-47, 0x1.9EC2222222222p-44, 0x1.1D11BBBBBBBBCp-42, 0x1.182B777777777p-41, 0x1.CD57333333333p-41, 0x1.45A2444444444p-40, 0x1.2760666666666p-40, 0x1.1C85BBBBBBBBCp-40,
+		  0x1.367DEEEEEEEEFp-42, 0x1.203999999999Ap-43, -0x1.D516377777777p-42, -0x1.0F71437777777p-39, -0x1.16865C6222222p-38, -0x1.4510F43155555p-38, -0x1.D53315835DDDEp-39, -0x1.851A45C09DDDEp-40 },
+		{ 0x1.0AE2EEEEEEEEFp-46, 0x1.312F555555555p-43, 0x1.A6F2000000000p-42, 0x1.9D8B99999999Ap-41, 0x1.552CAAAAAAAABp-40, 0x1.F3CDBBBBBBBBCp-40, 0x1.5444EEEEEEEEFp-39, 0x1.9235777777777p-39,
+		  0x1.C64CCCCCCCCCDp-42, 0x1.1EF599999999Ap-42, 0x1.3B1C666666666p-43, 0x1.D1D8111111111p-43, 0x1.E80F211111111p-42, 0x1.4393527BBBBBCp-41, 0x1.0727955BBBBBCp-41, 0x1.DAE80C5F11111p-43 },
+		{ -0x1.7ECAAAAAAAAABp-49, -0x1.B25999999999Ap-46, -0x1.2C8CCCCCCCCCDp-44, -0x1.2746666666666p-43, -0x1.E748888888889p-43, -0x1.66BDDDDDDDDDEp-42, -0x1.DD46666666666p-42, -0x1.24A1111111111p-41,
+		  -0x1.4276666666666p-44, -0x1.9B15555555555p-45, -0x1.761CCCCCCCCCDp-46, -0x1.7FE2222222222p-46, -0x1.A5D5F77777777p-45, -0x1.3E8D884444444p-44, -0x1.23CB417333333p-44, -0x1.1E13D22AAAAABp-45 },
+		{ -0x1.469999999999Ap-48, -0x1.750DDDDDDDDDEp-45, -0x1.029199999999Ap-43, -0x1.F9FAAAAAAAAABp-43, -0x1.A10CCCCCCCCCDp-42, -0x1.3369111111111p-41, -0x1.9E7999999999Ap-41, -0x1.F670000000000p-41,
+		  -0x1.159CCCCCCCCCDp-43, -0x1.59CAAAAAAAAABp-44, -0x1.12A5555555555p-45, -0x1.ADDDDDDDDDDDEp-48, 0x1.EE46EEEEEEEEFp-49, 0x1.16C6BDDDDDDDEp-47, 0x1.1DEAE48888889p-47, 0x1.2BBB6BAAAAAABp-48 }
+	},
+	{
+		{ 0x1.F0F41A309C0FAp-9, 0x1.18B331FCC1F01p-5, 0x1.8923BEB80245Bp-4, 0x1.8630E106BE861p-3, 0x1.47FDA65110D9Ep-2, 0x1.F3DEB92AFD2B0p-2, 0x1.6361BEA1B17B2p-1, 0x1.D35A30DA26147p-1,
+		  0x1.D763614417741p-4, 0x1.1212712943583p-4, 0x1.6D891A4D2F73Cp-6, 0x1.0FBA40341B0C8p-8, 0x1.AEC121F4BFF3Ep-12, 0x1.57F2B3B2D9FF8p-16, 0x1.0BD97C742919Ep-21, 0x1.F987BA077E709p-28 },
+		{ -0x1.3808AFE6BF519p-12, -0x1.5D43725559477p-9, -0x1.DF58C5993A5CEp-8, -0x1.CAE9D1690CF98p-7, -0x1.6A5802206F8CDp-6, -0x1.EB3CE3D596CDFp-6, -0x1.0C6C6030D21B3p-5, -0x1.210F585EBF08Cp-6,
+		  -0x1.381CE0025F64Cp-8, -0x1.01102F5616619p-8, -0x1.18578D1A63C10p-9, -0x1.5B7F794EE7137p-11, -0x1.C82205FBB0D62p-14, -0x1.2F73FE5662955p-17, -0x1.9759BCFA39F2Fp-22, -0x1.556008F3CEE41p-27 },
+		{ 0x1.2353C8DD94E95p-16, 0x1.3D8303A0CE7C8p-13, 0x1.99D9708BE5D39p-12, 0x1.5C36F5B133A78p-11, 0x1.ACD16D9C95F4Fp-11, 0x1.16978C7716CFDp-11, -0x1.8A3FEDD494152p-11, -0x1.173E5825D3CA6p-9,
+		  0x1.C4C1614A2F411p-13, 0x1.57B762A921D0Fp-12, 0x1.222A421D28D48p-12, 0x1.ED939EF5CFE6Dp-14, 0x1.B18C293773379p-16, 0x1.8BD09197759F3p-19, 0x1.824A6700090D1p-23, 0x1.EFFB74754283Dp-28 },
+		{ -0x1.EA824B17C1870p-21, -0x1.FC175405FD430p-18, -0x1.2041ADE9608E7p-16, -0x1.6410EFA2894A2p-16, -0x1.31792C1EA6400p-18, 0x1.AE15330D45D42p-15, 0x1.CCC5AC6A4A4E3p-14, -0x1.307943DE90F52p-13,
+		  -0x1.657D2D204609Fp-17, -0x1.BA0A5A75FC76Bp-16, -0x1.F808C4E7EC36Ep-16, -0x1.19D9FF4B6BA3Ep-16, -0x1.477E84C8D1834p-18, -0x1.92F236EB86BD8p-21, -0x1.12680778C25D6p-24, -0x1.F7F5D30304EF8p-29 },
+		{ 0x1.7715F4A0AE4DEp-25, 0x1.62804C83ECA22p-22, 0x1.2E3428E4FC111p-21, 0x1.2974B78318EEFp-24, -0x1.F828DCA201E00p-20, -0x1.16A81E2F6DA9Ap-18, 0x1.0226B3BA52AEFp-18, 0x1.38E4A28188A66p-19,
+		  0x1.161E7AB94ACCDp-21, 0x1.0C5821C312344p-19, 0x1.949C189EE7304p-19, 0x1.2433D5FC8C201p-19, 0x1.B4A227F43AA77p-21, 0x1.5DC88582C2140p-23, 0x1.3F34A1CADBFDFp-26, 0x1.8DFAB85B8330Fp-30 },
+		{ -0x1.0087092549BBCp-29, -0x1.953667DD44000p-27, -0x1.C5D620C2D5555p-28, 0x1.AF48DDBF5A222p-25, 0x1.33A8057A40444p-23, -0x1.F7A196EBCCCCDp-28, -0x1.8C119D6C3A222p-21, 0x1.0A5E541C42222p-19,
+		  -0x1.A3B8099076EEFp-26, -0x1.36AB0A9665800p-23, -0x1.308728681F1BCp-22, -0x1.167E21C1C6455p-22, -0x1.06329A62326BDp-23, -0x1.0B7FDCAFEC42Ap-25, -0x1.3DD4A80BC619Bp-28, -0x1.027F8C6721172p-31 },
+		{ 0x1.28BB414E3DDDEp-33, 0x1.E352CFB99999Ap-31, 0x1.F0C8744588889p-31, -0x1.553BBC5F9999Ap-31, 0x1.733BF91222222p-29, 0x1.049EF883C999Ap-25, -0x1.1B76751C08889p-27, 0x1.F82A4DF9F4444p-23,
+		  0x1.1054D4FB6AAABp-29, 0x1.546731A089111p-27, 0x1.A9EAD8C645DDEp-26, 0x1.EBC1BAE786089p-26, 0x1.20A2CA293DD9Ap-26, 0x1.70C7C377625BAp-28, 0x1.168E84BEA4B13p-30, 0x1.1E238AEBBB037p-33 },
+		{ 0x1.3EA6951111111p-43, 0x1.AA8E628CCCCCDp-36, 0x1.5CDF39B111111p-33, 0x1.9D8CA9ADDDDDEp-32, 0x1.8BFEBB3333333p-33, 0x1.35DA3C8888889p-35, 0x1.39FE830C44444p-27, 0x1.717D338AAAAABp-28,
+		  0x1.0B31A17777777p-37, -0x1.7F251836EEEEFp-31, -0x1.2BA8083688889p-29, -0x1.9FE7639780000p-29, -0x1.2898E3FC50889p-29, -0x1.D1C1ECE92AB33p-31, -0x1.B5FFBAA11B222p-33, -0x1.147F192ADA4C4p-35 },
+		{ 0x1.CBBB86EEEEEEFp-45, -0x1.D250FAAAAAAABp-41, -0x1.A8CBC97777777p-38, -0x1.F6F6626666666p-38, 0x1.503881DDDDDDEp-36, -0x1.68C2ECE666666p-34, 0x1.81894DC444444p-33, -0x1.4EBA363222222p-29,
+		  0x1.185A3B999999Ap-38, 0x1.87E3D89BBBBBCp-35, 0x1.80CE110555555p-33, 0x1.49B8762C1999Ap-32, 0x1.1D6A679D40000p-32, 0x1.1039F021DD889p-33, 0x1.391BCE31C4FBCp-35, 0x1.DAC0EADAACAC4p-38 },
+		{ -0x1.B2239B3333333p-44, -0x1.CDB883BBBBBBCp-41, -0x1.41CE09999999Ap-39, -0x1.8307E33333333p-38, -0x1.7CB48CCCCCCCDp-37, -0x1.5119D5DDDDDDEp-37, -0x1.D9D496CCCCCCDp-34, -0x1.BCD831AAAAAABp-32,
+		  -0x1.BD1F433333333p-40, -0x1.8FEF5AEEEEEEFp-39, -0x1.D592993333333p-37, -0x1.F288166333333p-36, -0x1.039AA4D12AAABp-35, -0x1.2915A9A587777p-36, -0x1.9B3F3EA366000p-38, -0x1.6F04C8B110955p-40 },
+		{ -0x1.A4C7BDDDDDDDEp-46, -0x1.DC5AEEEEEEEEFp-43, -0x1.5519688888889p-41, -0x1.5471288888889p-40, -0x1.3C43111111111p-39, -0x1.119A300000000p-38, -0x1.27B0655555555p-37, -0x1.AD9D0DDDDDDDEp-36,
+		  -0x1.4DC2755555555p-41, -0x1.424C6EEEEEEEFp-44, 0x1.21F6FCCCCCCCDp-40, 0x1.6EAF23C444444p-39, 0x1.C17DF9CEEEEEFp-39, 0x1.30A42B484CCCDp-39, 0x1.F429E7BA17777p-41, 0x1.022DB37D8F000p-42 },
+		{ 0x1.3FDFAAAAAAAABp-47, 0x1.6CA3EEEEEEEEFp-44, 0x1.FBC6AAAAAAAABp-43, 0x1.F63D555555555p-42, 0x1.A8C999999999Ap-41, 0x1.3247888888889p-40, 0x1.414F222222222p-39, 0x1.4B9B000000000p-38,
+		  0x1.1F8699999999Ap-42, 0x1.3FF6777777777p-43, -0x1.B22AAAAAAAAABp-46, -0x1.EA53711111111p-43, -0x1.7174527777777p-42, -0x1.26B6289666666p-42, -0x1.1B18077CBBBBCp-43, -0x1.4CBB5A743DDDEp-45 },
+		{ 0x1.D5DDBBBBBBBBCp-47, 0x1.01DEEEEEEEEEFp-43, 0x1.6A0CEEEEEEEEFp-42, 0x1.679A444444444p-41, 0x1.2B27555555555p-40, 0x1.C7F7555555555p-40, 0x1.4279777777777p-39, 0x1.EE40888888889p-39,
+		  0x1.A2DD333333333p-42, 0x1.F5A3DDDDDDDDEp-43, 0x1.69A1111111111p-44, 0x1.365C666666666p-45, 0x1.34A4666666666p-45, 0x1.0FB3D14444444p-45, 0x1.2CC701FDDDDDEp-46, 0x1.8D4EB25577777p-48 },
+		{ -0x1.41E999999999Ap-49, -0x1.6E83333333333p-46, -0x1.FE5999999999Ap-45, -0x1.F9C4444444444p-44, -0x1.A4D999999999Ap-43, -0x1.3ED4444444444p-42, -0x1.C3B5555555555p-42, -0x1.03D7777777777p-41,
+		  -0x1.282DDDDDDDDDEp-44, -0x1.5F16666666666p-45, -0x1.FC95555555555p-47, -0x1.38B8888888889p-48, -0x1.F7C6CCCCCCCCDp-49, -0x1.EF17E00000000p-49, -0x1.3C27B7AAAAAABp-49, -0x1.D46D206CCCCCDp-51 },
+		{ -0x1.1C60888888889p-48, -0x1.3911111111111p-45, -0x1.B73CCCCCCCCCDp-44, -0x1.B3CBBBBBBBBBCp-43, -0x1.6A5DDDDDDDDDEp-42, -0x1.129A222222222p-41, -0x1.8025555555555p-41, -0x1.ECACCCCCCCCCDp-41,
+		  -0x1.FE21111111111p-44, -0x1.3149111111111p-44, -0x1.9D5999999999Ap-46, -0x1.4554444444444p-48, -0x1.1095555555555p-52, 0x1.750F444444444p-52, 0x1.27A2A9999999Ap-52, 0x1.E262627777777p-54 }
+	},
+	{
+		{ 0x1.AB2D05A96461Ap-9, 0x1.E31865AE5F307p-6, 0x1.5319380E87C21p-4, 0x1.51ECEB4D8D6EFp-3, 0x1.1DFC1D3467126p-2, 0x1.B8FED79E5E5D5p-2, 0x1.40C2323DFDBD8p-1, 0x1.BC632ED34FE0Fp-1,
+		  0x1.B397EA2CED107p-4, 0x1.ED1F11E4E531Ap-5, 0x1.364FACA856F32p-6, 0x1.A1768C5B36C4Ap-9, 0x1.18949E8FF96F5p-12, 0x1.520F022076A19p-17, 0x1.354DA20BC348Ep-23, 0x1.7634CFB030DD3p-31 },
+		{ -0x1.F2B9BD126FB29p-13, -0x1.188276E976462p-9, -0x1.853C3F8331651p-8, -0x1.7BFFF3CE7F705p-7, -0x1.366C76B5E3B6Dp-6, -0x1.C06D327112149p-6, -0x1.19B845C4C3B90p-5, -0x1.C4AE8081B310Dp-6,
+		  -0x1.06E9DCD6920EBp-8, -0x1.78A086BABE477p-9, -0x1.58A72E1F5F2EBp-10, -0x1.64E86E98EBACBp-12, -0x1.7B4FC12A66E26p-15, -0x1.75E2C2A82B431p-19, -0x1.2D7C5376B8071p-24, -0x1.79329C9682BA7p-31 },
+		{ 0x1.ADF1D42855876p-17, 0x1.DAB251BE4E2C5p-14, 0x1.3BAE3E673CC57p-12, 0x1.1C767E71BB01Ep-11, 0x1.8D4476D18B3F6p-11, 0x1.870A0BB5BA87Bp-11, -0x1.D2448FAE3C0BCp-15, -0x1.663FB7E6475E1p-9,
+		  0x1.55ADD4ED2569Fp-13, 0x1.B4691C10BA3DDp-13, 0x1.3C688A7C881E4p-13, 0x1.C20907E1B600Dp-15, 0x1.367B967573468p-17, 0x1.9035522127179p-21, 0x1.C2D8D15C4E5D0p-26, 0x1.C7D60D750F335p-32 },
+		{ -0x1.4BAA853B1A9FAp-21, -0x1.6092416E96EDDp-18, -0x1.AB43EDD6B8156p-17, -0x1.37F7D5248FFC2p-16, -0x1.BFCA2B80F95AFp-17, 0x1.780907B4BDD6Dp-16, 0x1.E0B8CDDF59ECAp-14, -0x1.BBBD19D1E1D5Ap-17,
+		  -0x1.E0FEA8B378377p-18, -0x1.F32D898AB17B3p-17, -0x1.DEC4A4B263402p-17, -0x1.B12EDD0D638AEp-18, -0x1.80BC6661A5A00p-20, -0x1.48BC581A98AFEp-23, -0x1.02E3C824C1462p-27, -0x1.91A4C120A5805p-33 },
+		{ 0x1.197E8CF319055p-25, 0x1.1EDAFFB8D8377p-22, 0x1.367B26D79379Ap-21, 0x1.45C41FA4E8355p-21, -0x1.19249297B6DDEp-22, -0x1.555F2A58FA044p-19, -0x1.D1FC2F7B008CDp-20, 0x1.17C317A8859EBp-15,
+		  0x1.A566FA9B50044p-22, 0x1.0AB11A6F18A6Fp-20, 0x1.44DEEDA8EF542p-20, 0x1.794E05A1EC88Dp-21, 0x1.ADCEC35FBBA02p-23, 0x1.DC0F1A3013DDAp-26, 0x1.F8F80361DCF99p-30, 0x1.1B456ECB91E2Ep-34 },
+		{ -0x1.D56B1A49F1111p-32, -0x1.8D6B3E8FD999Ap-30, 0x1.4878618883333p-27, 0x1.F7EDF98A66EEFp-25, 0x1.753579CB14AABp-23, 0x1.3B0A44F2E6AABp-22, -0x1.DE2F5A68CEEEFp-23, 0x1.C079B01BD6A22p-19,
+		  -0x1.CCCC76599999Ap-30, -0x1.255A535DA4111p-24, -0x1.DA6DB645C43BCp-24, -0x1.4A3E006FE56ABp-24, -0x1.C5F1DDFBD8777p-26, -0x1.3897D88BE0A13p-28, -0x1.B03D30A42C512p-32, -0x1.4F7D8874BE5B0p-36 },
+		{ 0x1.356984A188889p-34, 0x1.0F5C171DF3333p-31, 0x1.6560602988889p-31, -0x1.9B1F7D8444444p-32, -0x1.6BA487BB44444p-30, 0x1.81058E14B7777p-27, 0x1.0E7167A8B0000p-24, -0x1.D3356688AA222p-23,
+		  0x1.72F54E26B3333p-30, 0x1.0E10CEF84CCCDp-28, 0x1.0BF7435D9C889p-27, 0x1.E8E9FEEB47000p-28, 0x1.AB6B3F8922E66p-29, 0x1.7378F60CCA311p-31, 0x1.4B397B0F71524p-34, 0x1.57D5B5D0EA4E1p-38 },
+		{ -0x1.FB527B5EEEEEFp-37, -0x1.10FE8026EEEEFp-33, -0x1.638AA933BBBBCp-32, -0x1.5EC98A1A22222p-31, -0x1.7BF5584DDDDDEp-30, -0x1.F2E140B5DDDDEp-29, -0x1.F977C95EEEEEFp-29, -0x1.4EBF39801999Ap-24,
+		  -0x1.A471AE0CCCCCDp-33, -0x1.D1E547799999Ap-33, -0x1.24947CBF44444p-31, -0x1.5F86942D66666p-31, -0x1.7E99DCAA06EEFp-32, -0x1.9ADE2B829C222p-34, -0x1.CE9E90473B333p-37, -0x1.37586EE587CDAp-40 },
+		{ -0x1.CEA0413333333p-40, -0x1.15686B7555555p-36, -0x1.AC557FC000000p-35, -0x1.D538AE999999Ap-34, -0x1.A64BAC4EEEEEFp-33, -0x1.8AD9D66CCCCCDp-32, -0x1.8C233E4777777p-30, -0x1.1425F4AC88889p-28,
+		  -0x1.F2AFAAB333333p-36, 0x1.881F8E5555555p-36, 0x1.0FED8AA3BBBBCp-34, 0x1.1E3EC51F88889p-34, 0x1.4FF6EFBF22222p-35, 0x1.AB399F4A8DDDEp-37, 0x1.2994DB0A9D666p-39, 0x1.F9C22EC8ACCDEp-43 },
+		{ -0x1.8706444444444p-50, 0x1.C74199999999Ap-47, 0x1.C51BCCCCCCCCDp-44, 0x1.6E59555555555p-45, -0x1.0CB5B33333333p-40, 0x1.C151911111111p-40, 0x1.0EC4200000000p-37, 0x1.06BBC16444444p-30,
+		  -0x1.3DA159999999Ap-40, -0x1.01F13C4444444p-40, -0x1.99DF626666666p-39, -0x1.59D14C8AAAAABp-38, -0x1.0A1E57F777777p-38, -0x1.9F68355DC4444p-40, -0x1.635DC24834CCDp-42, -0x1.74C2A9BCA819Ap-45 },
+		{ 0x1.D958222222222p-47, 0x1.1D1E177777777p-43, 0x1.B54D8CCCCCCCDp-42, 0x1.04E1D9999999Ap-40, 0x1.1A8AC55555555p-39, 0x1.1BFC4BBBBBBBCp-38, 0x1.228EAC4444444p-36, 0x1.6A77ED0000000p-33,
+		  -0x1.0D79888888889p-44, -0x1.5070777777777p-42, -0x1.0F249DDDDDDDEp-44, 0x1.7746A86666666p-42, 0x1.959E529111111p-42, 0x1.7F9966B911111p-43, 0x1.8CD0CDFA80000p-45, 0x1.F72A3271D5111p-48 },
+		{ 0x1.7096111111111p-47, 0x1.A0EB333333333p-44, 0x1.2967444444444p-42, 0x1.3045444444444p-41, 0x1.0EDC222222222p-40, 0x1.CD7E444444444p-40, 0x1.7113555555555p-39, 0x1.30E9EEEEEEEEFp-39,
+		  0x1.444D111111111p-42, 0x1.1121EEEEEEEEFp-43, 0x1.3AD999999999Ap-49, -0x1.37782EEEEEEEFp-45, -0x1.39D8277777777p-45, -0x1.521D9D0888889p-46, -0x1.9FFC61D19999Ap-48, -0x1.38C631309DDDEp-50 },
+		{ 0x1.8834000000000p-47, 0x1.B29CEEEEEEEEFp-44, 0x1.3335777777777p-42, 0x1.3054AAAAAAAABp-41, 0x1.00D9CCCCCCCCDp-40, 0x1.89D8222222222p-40, 0x1.158999999999Ap-39, -0x1.CF57777777777p-43,
+		  0x1.80E5777777777p-42, 0x1.BA16AAAAAAAABp-43, 0x1.2036666666666p-44, 0x1.E12B555555555p-47, 0x1.237AA22222222p-48, 0x1.2131F11111111p-49, 0x1.9C6DA4EEEEEEFp-51, 0x1.69C65349DDDDEp-53 },
+		{ -0x1.1EFCCCCCCCCCDp-49, -0x1.40A6666666666p-46, -0x1.C27DDDDDDDDDEp-45, -0x1.C13DDDDDDDDDEp-44, -0x1.7CF5555555555p-43, -0x1.2724444444444p-42, -0x1.AF2EEEEEEEEEFp-42, -0x1.B2E3333333333p-41,
+		  -0x1.1577777777777p-44, -0x1.378999999999Ap-45, -0x1.8B95555555555p-47, -0x1.272DDDDDDDDDEp-49, -0x1.FAC4444444444p-52, -0x1.E83B222222222p-53, -0x1.94F973BBBBBBCp-54, -0x1.9D89F40444444p-56 },
+		{ -0x1.E266666666666p-49, -0x1.0C00888888889p-45, -0x1.7ABAAAAAAAAABp-44, -0x1.7764444444444p-43, -0x1.3D1F777777777p-42, -0x1.E6D6666666666p-42, -0x1.5F4DDDDDDDDDEp-41, -0x1.CC45555555555p-41,
+		  -0x1.D610000000000p-44, -0x1.0D37777777777p-44, -0x1.5A52222222222p-46, -0x1.DEEBBBBBBBBBCp-49, -0x1.4417777777777p-52, 0x1.F237777777777p-58, 0x1.5E4DB33333333p-57, 0x1.9F6773999999Ap-59 }
+	},
+	{
+		{ 0x1.72F8F62464319p-9, 0x1.A3C410FDEC20Ep-6, 0x1.26FF9B0EDEDE6p-4, 0x1.2696CA511E278p-3, 0x1.F45AC438497B5p-3, 0x1.84261CFA5F237p-2, 0x1.1DE20C4B50E2Ep-1, 0x1.9AC22FE3B9D00p-1,
+		  0x1.95308046B10D5p-4, 0x1.C4004AB85E892p-5, 0x1.138389042A62Dp-6, 0x1.5ECC0874840F9p-9, 0x1.AE5D1643D6038p-13, 0x1.BA6769D3D7168p-18, 0x1.270FCB8AD1E5Ap-24, 0x1.311A13DF77F1Ep-33 },
+		{ -0x1.94A5A5F880C66p-13, -0x1.C8A7998BD6B37p-10, -0x1.3F120E28449A2p-8, -0x1.3B6BB655EBF07p-7, -0x1.0750D4663F7ABp-6, -0x1.8C15EBC291714p-6, -0x1.10CCFD431198Ep-5, -0x1.32E87D1534D8Fp-5,
+		  -0x1.C2087A3802940p-9, -0x1.1F62233588F50p-9, -0x1.BE4E4A5218F75p-11, -0x1.85940EDFB2290p-13, -0x1.5A48CECF93FF7p-16, -0x1.11E91F777B70Ap-20, -0x1.375526E1AE308p-26, -0x1.618674B70CF9Cp-34 },
+		{ 0x1.4AF849D7666B2p-17, 0x1.70EF2AADF1D52p-14, 0x1.F58F8D0BA8B59p-13, 0x1.D7690C30E9903p-12, 0x1.6678585734726p-11, 0x1.B9B1107B1138Bp-11, 0x1.31A417326477Cp-11, -0x1.E51A178927996p-10,
+		  0x1.0F454FE90D601p-13, 0x1.2184A43CF2E77p-13, 0x1.6D423BC6688EBp-14, 0x1.C523AB4BFD1EEp-16, 0x1.066730528469Bp-18, 0x1.05FE0975A1A69p-22, 0x1.82F4FB444EFC7p-28, 0x1.4D2D315E79CD0p-35 },
+		{ -0x1.8F5817A038D73p-22, -0x1.ABE3AF511A9C2p-19, -0x1.08317E2D02227p-17, -0x1.91A2967B335ABp-17, -0x1.477F6C0927746p-17, 0x1.B5B6CEFD220E4p-17, 0x1.997D683D109F8p-14, 0x1.43EFA569DB2EFp-12,
+		  -0x1.0EB4071E75495p-18, -0x1.31E23DB34B624p-17, -0x1.0B20CA1A26138p-17, -0x1.9735485A88908p-19, -0x1.1E9B8784530C6p-21, -0x1.667473BC345A3p-25, -0x1.628993FC21980p-30, -0x1.D9ABBA28E40FDp-37 },
+		{ 0x1.D550927B95ABCp-26, 0x1.F74D22FFFCCCDp-23, 0x1.3813C7581A711p-21, 0x1.E3FF05855C555p-21, 0x1.C66FE3C8B3333p-21, -0x1.073E90168E2ABp-22, -0x1.4FB9F5CA81D55p-19, 0x1.157BD75515BE2p-15,
+		  0x1.92691D9268089p-22, 0x1.108FCAE3DF066p-21, 0x1.023C844E7B40Dp-21, 0x1.FF2373474ED37p-23, 0x1.E36D6618C5629p-25, 0x1.9876188A4DD50p-28, 0x1.17337AB0DA15Dp-32, 0x1.19B45444A565Fp-38 },
+		{ -0x1.56203769EF333p-30, -0x1.62CF8E4766222p-27, -0x1.94AF61A545DDEp-26, -0x1.01448D9690889p-25, -0x1.ACC8CE3C5DDDEp-27, 0x1.E724E4FEB3333p-26, -0x1.EAC4F9EFED111p-23, -0x1.39CE8FCE1FAEFp-18,
+		  -0x1.921422FAF0000p-27, -0x1.0BFAF9B602889p-25, -0x1.5BDB117FC86EFp-25, -0x1.9F20F1751F089p-26, -0x1.CEE4562A50F66p-28, -0x1.D654276C5C166p-31, -0x1.97F28B537FDD5p-35, -0x1.232226380DE76p-40 },
+		{ -0x1.B1560CD362222p-33, -0x1.04DCF2A7C5555p-29, -0x1.9C72FC4BD7777p-28, -0x1.E407256675555p-27, -0x1.EEB741E772222p-26, -0x1.C1F23EE59999Ap-25, -0x1.32FD27EDD1111p-24, -0x1.941656A05E222p-21,
+		  -0x1.BD12B7CF9999Ap-29, 0x1.6BA687D33DDDEp-29, 0x1.53F8DB906C889p-28, 0x1.86929FB907DDEp-29, 0x1.B9C5862F9BA22p-31, 0x1.F814ECD85F000p-34, 0x1.0E8BF360371A2p-37, 0x1.0A00EA60C3C70p-42 },
+		{ -0x1.0FAB9522AAAABp-37, -0x1.297ECC6333333p-34, -0x1.8B911F0000000p-33, -0x1.7D59007666666p-32, -0x1.6E6FF55666666p-31, -0x1.DB518AC800000p-30, -0x1.7356DB4B33333p-28, 0x1.319470CE77777p-24,
+		  -0x1.FB1ED54777777p-33, -0x1.D6DDCFA666666p-35, -0x1.7895BE7C44444p-34, -0x1.20E3B7254CCCDp-33, -0x1.1B45824ECEEEFp-34, -0x1.CA736B775199Ap-37, -0x1.465F0C3972222p-40, -0x1.B4FE2C2877533p-45 },
+		{ 0x1.1656AEEAAAAABp-38, 0x1.413069BAAAAABp-35, 0x1.D83DF06888889p-34, 0x1.00A9846111111p-32, 0x1.FC6DF40555555p-32, 0x1.032A47A222222p-30, 0x1.1CD2172666666p-29, 0x1.2DE8636400000p-26,
+		  0x1.E3C1C9EEEEEEFp-35, -0x1.0929AFA222222p-37, -0x1.182DF5E333333p-36, 0x1.02BD550DDDDDEp-38, 0x1.7E2021A6BBBBCp-38, 0x1.9F6AD2CE91111p-40, 0x1.742E5E6168000p-43, 0x1.46EF0B504C933p-47 },
+		{ 0x1.9BC7704444444p-42, 0x1.E0A153BBBBBBCp-39, 0x1.67C48C6666666p-37, 0x1.8C62C84444444p-36, 0x1.846B0A4444444p-35, 0x1.7B93723333333p-34, 0x1.E0403BA222222p-33, -0x1.E4A6024888889p-31,
+		  0x1.FE7A7B3333333p-38, -0x1.32C735DDDDDDEp-39, -0x1.6573C93333333p-38, -0x1.6E93442222222p-39, -0x1.C91792D99999Ap-41, -0x1.8BB2C21333333p-43, -0x1.9164CF8B55555p-46, -0x1.C10CB62F85DDEp-50 },
+		{ -0x1.07857EEEEEEEFp-44, -0x1.306C6E6666666p-41, -0x1.BFAC811111111p-40, -0x1.E28069999999Ap-39, -0x1.D0AFE6EEEEEEFp-38, -0x1.C782CDDDDDDDEp-37, -0x1.2315233333333p-35, -0x1.B6E7015555555p-32,
+		  -0x1.F2585DDDDDDDEp-41, -0x1.4E7FD55555555p-44, 0x1.11A624CCCCCCDp-42, 0x1.469DF15555555p-43, 0x1.0843EC8000000p-44, 0x1.34EB9E7BBBBBCp-46, 0x1.913C89C3BBBBCp-49, 0x1.1CF951331F777p-52 },
+		{ -0x1.DF2BBBBBBBBBCp-49, -0x1.261F777777777p-45, -0x1.E631DDDDDDDDEp-44, -0x1.37B199999999Ap-42, -0x1.71AB555555555p-41, -0x1.C0FB222222222p-40, -0x1.4C50488888889p-38, 0x1.95BCF77777777p-38,
+		  0x1.DCACCCCCCCCCDp-45, 0x1.6A8D777777777p-43, 0x1.1DDA99999999Ap-43, 0x1.2F585DDDDDDDEp-45, 0x1.9CF999999999Ap-52, -0x1.ABFEF33333333p-50, -0x1.7D63FA5555555p-52, -0x1.500F9D4B77777p-55 },
+		{ 0x1.5848666666666p-47, 0x1.83CA888888889p-44, 0x1.1030666666666p-42, 0x1.0FC6444444444p-41, 0x1.D001333333333p-41, 0x1.66B6000000000p-40, 0x1.16F0000000000p-39, 0x1.828D444444444p-37,
+		  0x1.6283333333333p-42, 0x1.8DC0EEEEEEEEFp-43, 0x1.F91CEEEEEEEEFp-45, 0x1.78FD777777777p-47, 0x1.6D09AAAAAAAABp-50, 0x1.D40D2AAAAAAABp-53, 0x1.63F4CE2222222p-55, 0x1.733924ABBBBBCp-58 },
+		{ -0x1.A9B3333333333p-50, -0x1.E148888888889p-47, -0x1.508AAAAAAAAABp-45, -0x1.4A22222222222p-44, -0x1.101BBBBBBBBBCp-43, -0x1.88ACCCCCCCCCDp-43, -0x1.C8CAAAAAAAAABp-43, -0x1.2168888888889p-42,
+		  -0x1.E66EEEEEEEEEFp-45, -0x1.1F5999999999Ap-45, -0x1.958AAAAAAAAABp-47, -0x1.31F3333333333p-49, -0x1.EF9BBBBBBBBBCp-53, -0x1.94B5555555555p-56, -0x1.40CB000000000p-58, -0x1.95B02C2222222p-61 },
+		{ -0x1.9BECCCCCCCCCDp-49, -0x1.CFA5555555555p-46, -0x1.454999999999Ap-44, -0x1.442DDDDDDDDDEp-43, -0x1.1402AAAAAAAABp-42, -0x1.A6C2222222222p-42, -0x1.354CCCCCCCCCDp-41, -0x1.097DDDDDDDDDEp-40,
+		  -0x1.B3D1111111111p-44, -0x1.E5ADDDDDDDDDEp-45, -0x1.2C7B333333333p-46, -0x1.959CCCCCCCCCDp-49, -0x1.F752222222222p-53, -0x1.F326666666666p-58, 0x1.9433333333333p-62, 0x1.885232AAAAAABp-64 }
+	},
+	{
+		{ 0x1.453935DBFBD28p-9, 0x1.7015B8B2F83FDp-6, 0x1.02CEFD4FFE3B4p-4, 0x1.02AC8ABB0D398p-3, 0x1.B7FD73CCCFA96p-3, 0x1.563074FCC9AFFp-2, 0x1.FAB33E7CA51F6p-2, 0x1.720BFA9F537D3p-1,
+		  0x1.7B1256E689C27p-4, 0x1.A4106E896873Dp-5, 0x1.F8C94C79CE9A4p-7, 0x1.397F988CAA619p-9, 0x1.712A5E727B49Dp-13, 0x1.617D2BF2919B1p-18, 0x1.990639B3C6478p-25, 0x1.16BA1FCBF1DC2p-34 },
+		{ -0x1.49B77FC8FAA12p-13, -0x1.74CAEFA329C97p-10, -0x1.058B68020BA4Dp-8, -0x1.046B4E29B37F0p-7, -0x1.B82B9CD0CFE9Ep-7, -0x1.528F7E8F844B1p-6, -0x1.EA0996CF44538p-6, -0x1.4C606758892B7p-5,
+		  -0x1.833260E2768BEp-9, -0x1.C6F4AEF06DF04p-10, -0x1.32ED50FFDCCDCp-11, -0x1.C4D862A39C0BDp-14, -0x1.50074ACF93C82p-17, -0x1.B3FC15CB10B45p-22, -0x1.7F0B155A184CEp-28, -0x1.040E07D0F402Cp-36 },
+		{ 0x1.1142637B0185Cp-17, 0x1.330ADC3A18EEEp-14, 0x1.A8FA62ED1CAF5p-13, 0x1.9CFD1FD5A131Ap-12, 0x1.4E879F96543F2p-11, 0x1.DAA0DA788F840p-11, 0x1.1982A8B68671Bp-10, 0x1.48CAC0FFDF76Cp-12,
+		  0x1.D76EDFAC137C5p-14, 0x1.88B02A15E19B7p-14, 0x1.9894A8584E0D5p-15, 0x1.BA1BA214B7D23p-17, 0x1.C1A7D7DD8F093p-20, 0x1.7C78068831FCFp-24, 0x1.AD0BA8C5B0C69p-30, 0x1.90DE609FE578Ep-38 },
+		{ -0x1.F007119CABB6Ep-23, -0x1.0B8CDB667858Ep-19, -0x1.500C9D746DFDAp-18, -0x1.09FC03DCC5A29p-17, -0x1.F92592C559811p-18, 0x1.3FEB498C338E6p-18, 0x1.E88E4EBABE8B7p-15, 0x1.57957D1B0DE87p-12,
+		  -0x1.0FF039C300EDCp-19, -0x1.8DF2A47172591p-18, -0x1.520074BD3D8ADp-18, -0x1.CD75729F19012p-20, -0x1.10FDF88BB0495p-22, -0x1.094978C888F90p-26, -0x1.6433195EFBA48p-32, -0x1.C6249FD4DD4BAp-40 },
+		{ 0x1.935A7CD87AF77p-28, 0x1.7D1F6EBF28A22p-25, 0x1.3164171FC8800p-24, -0x1.7F95101517333p-25, -0x1.4748A6AA6A666p-21, -0x1.4412D4F6D9EBCp-19, -0x1.0BC8AA4EA909Ap-17, -0x1.C458443FCA366p-16,
+		  0x1.4EAC415801777p-24, 0x1.5E41AC05E70ABp-22, 0x1.55C9B79C8E509p-22, 0x1.10A3D218271CFp-23, 0x1.86A7E600E7B86p-26, 0x1.DFF30E17D94D7p-30, 0x1.B119522482628p-35, 0x1.A5E4FA7674516p-42 },
+		{ -0x1.3EE579777A889p-29, -0x1.668119486D777p-26, -0x1.F1340970E2000p-25, -0x1.E67F3F80D3555p-24, -0x1.935EC58EFECCDp-23, -0x1.38E5935726666p-22, -0x1.1FCF306042333p-21, -0x1.0914183CA46ABp-18,
+		  -0x1.48A6D306A4889p-25, -0x1.3F3079F660889p-27, -0x1.CA863B44F3333p-31, -0x1.702F6940E7111p-29, -0x1.4B763B280CC44p-30, -0x1.610C88AE26F55p-33, -0x1.E33EA38A69855p-38, -0x1.6784583CC5828p-44 },
+		{ 0x1.2E6B9CA8E4444p-33, 0x1.56B48745AEEEFp-30, 0x1.E4FDC9E7CCCCDp-29, 0x1.F02D48D4C8889p-28, 0x1.C6E638AF13333p-27, 0x1.BE67592C22222p-26, 0x1.4B5C5082A1111p-24, 0x1.9DAB15F964CCDp-21,
+		  0x1.3E89C08FC4444p-30, 0x1.54204BCF91111p-31, 0x1.7844EAF5E4444p-31, 0x1.2B921D8ECCCCDp-31, 0x1.7F0858EEC1DDEp-33, 0x1.85F177B307777p-36, 0x1.27AD956F11355p-40, 0x1.1E7CC2399A5C9p-46 },
+		{ 0x1.4107D9BEAAAABp-35, 0x1.75F4E05044444p-32, 0x1.17027638EEEEFp-30, 0x1.3241985466666p-29, 0x1.2A03FCD377777p-28, 0x1.16DA7BD4AAAABp-27, 0x1.046CADCB11111p-26, 0x1.27FDA47D88889p-25,
+		  0x1.63159E14CCCCDp-31, -0x1.A0F154CDDDDDEp-33, -0x1.DA723D94EEEEFp-32, -0x1.962B5BFD91111p-33, -0x1.30CA9B8E2AAABp-35, -0x1.CABCD6D711111p-39, -0x1.520235A87199Ap-43, -0x1.9EAD971E08089p-49 },
+		{ -0x1.5F56101777777p-39, -0x1.9BE3DEDDDDDDEp-36, -0x1.37BD19AAAAAABp-34, -0x1.5F101F2888889p-33, -0x1.65CF687AAAAABp-32, -0x1.70CC884AAAAABp-31, -0x1.CDEFB51222222p-30, -0x1.3350590533333p-26,
+		  -0x1.5AE1E93BBBBBCp-36, 0x1.17B5F58000000p-37, 0x1.0F9222C333333p-36, 0x1.F6DA41A888889p-38, 0x1.E9006C16EEEEFp-40, 0x1.1335352B11111p-42, 0x1.3084C6CCBBBBCp-46, 0x1.10E6B298AB777p-51 },
+		{ -0x1.9D07EA5555555p-41, -0x1.DF5390EEEEEEFp-38, -0x1.636596AAAAAABp-36, -0x1.84292ACCCCCCDp-35, -0x1.7B723F3333333p-34, -0x1.6FB99F2222222p-33, -0x1.81AC9B5555555p-32, 0x1.ED87D1999999Ap-33,
+		  -0x1.D031AF5555555p-37, 0x1.6791B9DDDDDDEp-39, 0x1.D97968AAAAAABp-38, 0x1.4B7E1F7BBBBBCp-39, 0x1.102722E666666p-42, -0x1.88B915D555555p-48, -0x1.FEAF01EF33333p-50, -0x1.5211E54CA0000p-54 },
+		{ 0x1.81097CCCCCCCDp-45, 0x1.C380955555555p-42, 0x1.5B89933333333p-40, 0x1.92CF122222222p-39, 0x1.B21B43BBBBBBCp-38, 0x1.EE23B77777777p-37, 0x1.679FA7BBBBBBCp-35, 0x1.905EF63333333p-32,
+		  0x1.2105666666666p-44, -0x1.7776133333333p-42, -0x1.4302391111111p-42, -0x1.0FC7155555555p-44, 0x1.DED4755555555p-49, 0x1.432F932222222p-49, 0x1.14807CE888889p-52, 0x1.8F88A84944444p-57 },
+		{ 0x1.607D911111111p-46, 0x1.97F2333333333p-43, 0x1.2B7E111111111p-41, 0x1.425F99999999Ap-40, 0x1.33C1777777777p-39, 0x1.20DA4CCCCCCCDp-38, 0x1.24A0666666666p-37, -0x1.75554CCCCCCCDp-36,
+		  0x1.00FB6EEEEEEEFp-41, 0x1.1025BBBBBBBBCp-44, -0x1.D22E222222222p-44, -0x1.ABF5044444444p-45, -0x1.0E5E488888889p-47, -0x1.3ED58BBBBBBBCp-51, -0x1.17AC36CCCCCCDp-55, -0x1.B69C855BBBBBCp-60 },
+		{ 0x1.F183777777777p-48, 0x1.1FA0CCCCCCCCDp-44, 0x1.8C89555555555p-43, 0x1.845C000000000p-42, 0x1.378ACCCCCCCCDp-41, 0x1.A8D6222222222p-41, 0x1.47AB333333333p-41, -0x1.3456888888889p-38,
+		  0x1.4277DDDDDDDDEp-42, 0x1.72A2000000000p-43, 0x1.F3A4666666666p-45, 0x1.452E888888889p-47, 0x1.92C0000000000p-51, 0x1.0A1CDDDDDDDDEp-55, 0x1.61C20CCCCCCCDp-59, 0x1.BCACF48888889p-63 },
+		{ -0x1.E74AAAAAAAAABp-50, -0x1.168CCCCCCCCCDp-46, -0x1.8B57777777777p-45, -0x1.938AAAAAAAAABp-44, -0x1.60F1111111111p-43, -0x1.232CCCCCCCCCDp-42, -0x1.DE82222222222p-42, 0x1.5CB7777777777p-42,
+		  -0x1.01C7777777777p-44, -0x1.FDA0000000000p-46, -0x1.C33BBBBBBBBBCp-48, -0x1.F091111111111p-52, 0x1.09BBBBBBBBBBCp-55, 0x1.8CD999999999Ap-59, -0x1.99D0888888889p-63, -0x1.C7131DDDDDDDEp-66 },
+		{ -0x1.5D2999999999Ap-49, -0x1.9377777777777p-46, -0x1.1A02222222222p-44, -0x1.1AADDDDDDDDDEp-43, -0x1.DD63333333333p-43, -0x1.70E6666666666p-42, -0x1.094BBBBBBBBBCp-41, -0x1.5A13333333333p-41,
+		  -0x1.95A1111111111p-44, -0x1.BD70000000000p-45, -0x1.16E5DDDDDDDDEp-46, -0x1.53CCCCCCCCCCDp-49, -0x1.9782222222222p-53, -0x1.7C20000000000p-58, -0x1.7555555555555p-66, 0x1.A44C333333333p-69 }
+	},
+	{
+		{ 0x1.200A632A34147p-9, 0x1.46064B3CDC221p-6, 0x1.CA8A38481596Ep-5, 0x1.CA6BE3872050Fp-4, 0x1.860AF4F016252p-3, 0x1.2F91D94EBDC22p-2, 0x1.C22DE9CFC40BBp-2, 0x1.4A394B890B973p-1,
+		  0x1.64A5CDEB6819Ep-4, 0x1.8A5963A7E6C81p-5, 0x1.D7A66AC7971E4p-7, 0x1.228ECD5D911EBp-9, 0x1.51A53FC7301F2p-13, 0x1.3C14CE67D3336p-18, 0x1.5DF4668C47AD7p-25, 0x1.A51708EC18F52p-35 },
+		{ -0x1.0B20E971D0D7Dp-13, -0x1.2E46652D820C7p-10, -0x1.A8E52AC504751p-9, -0x1.A85F428D6BBD1p-8, -0x1.687F88B15E0F3p-7, -0x1.17D12CAB4E440p-6, -0x1.9CC774165CBAFp-6, -0x1.2A57AB7764BAAp-5,
+		  -0x1.4B77B9321C99Ep-9, -0x1.74E239D356819p-10, -0x1.CE5CD9AB9621Bp-12, -0x1.2E081D49D2330p-14, -0x1.7F6E8C37200A2p-18, -0x1.9A07C1AB14284p-23, -0x1.18D40BADACAFEp-29, -0x1.FED6766135F77p-39 },
+		{ 0x1.C5E7E6EA85A7Ap-18, 0x1.00487AC6AE2A4p-14, 0x1.66A2C330A53E5p-13, 0x1.636CF13257E58p-12, 0x1.2A0B0A747B707p-11, 0x1.C43E419C6B6A7p-11, 0x1.3E22D397B7F28p-10, 0x1.8862214146008p-10,
+		  0x1.A2156F985E92Dp-14, 0x1.115D95EAE9D26p-14, 0x1.B3FDA391F644Cp-16, 0x1.8009B36FB1896p-18, 0x1.4DAB4994FBEDEp-21, 0x1.EA7BAB1A150A4p-26, 0x1.D3182F1CA36C6p-32, 0x1.38453BB4C2B70p-40 },
+		{ -0x1.035E2C19BF6DEp-22, -0x1.20940715E7772p-19, -0x1.86AABDE19453Ap-18, -0x1.6C4AC1E795DABp-17, -0x1.10C5091908B72p-16, -0x1.4357F86C862E3p-16, -0x1.58F79A7763A8Fp-17, 0x1.252BDAB79552Bp-14,
+		  -0x1.4C512C28199DAp-19, -0x1.ED219AD4F6CE1p-19, -0x1.5CEAA953CF43Ap-19, -0x1.AF9A337E94AB5p-21, -0x1.CF74BB5097A0Fp-24, -0x1.8B3BACF620FD0p-28, -0x1.AC1CCA6BCE645p-34, -0x1.53D87A5150BB8p-42 },
+		{ -0x1.E03290C635DDEp-29, -0x1.41F4D58CFD2EFp-25, -0x1.2F31400DB97BCp-23, -0x1.B4DF208A60F77p-22, -0x1.19C7CBFF932EFp-20, -0x1.60CEE130DD844p-19, -0x1.D8130FB846E55p-18, -0x1.B86B50D131AA2p-16,
+		  -0x1.EC8C471DB4B33p-24, 0x1.F5E1E4FF63000p-23, 0x1.1F13DD8168B89p-22, 0x1.9D4E19DAACED1p-24, 0x1.E58CF9A19AF69p-27, 0x1.C2B3A2759DC5Dp-31, 0x1.11844D8B11822p-36, 0x1.0DD3EAFCBB152p-44 },
+		{ 0x1.0B1C51F19F777p-31, 0x1.4DBE28C633333p-28, 0x1.1B16A2C88B333p-26, 0x1.706BF5DA0599Ap-25, 0x1.B69540307D111p-24, 0x1.04B81F4864889p-22, 0x1.57AA1D91DAEEFp-21, 0x1.54E7046EAA666p-19,
+		  0x1.0648A52AE4444p-28, -0x1.7671CF7D87777p-27, -0x1.BF5768C0E7777p-27, -0x1.69D5F79217D55p-28, -0x1.F467ABF052666p-31, -0x1.1EE3D07DA3E00p-34, -0x1.CB02C8FC222EFp-40, -0x1.538BE3D704675p-47 },
+		{ 0x1.6EB8A70B10000p-33, 0x1.A251DD76BDDDEp-30, 0x1.2B1324F835555p-28, 0x1.335E544A4BBBCp-27, 0x1.112D3D2FE6666p-26, 0x1.C862C3D1D5555p-26, 0x1.81E4A4A2C8889p-25, 0x1.B3939BE040000p-24,
+		  0x1.B7F2C3F0AEEEFp-29, -0x1.0702E0FBCCCCDp-32, -0x1.3E6C1012E2222p-30, -0x1.8B2B464BCF777p-32, -0x1.BBB646403EEEFp-36, 0x1.88309051B8000p-40, 0x1.1A63DC08E3B33p-43, 0x1.91D08ABEB2CCDp-50 },
+		{ -0x1.C9BFC6BD11111p-36, -0x1.0903837C88889p-32, -0x1.875439E844444p-31, -0x1.A8DE6B9622222p-30, -0x1.9CE664359999Ap-29, -0x1.910985D155555p-28, -0x1.C36C5B77DDDDEp-27, -0x1.F20C07ECE6666p-25,
+		  -0x1.8B9107A888889p-32, 0x1.072714CAAAAABp-34, 0x1.6A2EE22888889p-33, 0x1.D56716AD55555p-35, 0x1.4CE6BEA088889p-38, -0x1.5E0361A1DDDDEp-44, -0x1.1753046733333p-46, -0x1.033C2F2A57777p-52 },
+		{ -0x1.F6118FE222222p-41, -0x1.1DABB7F333333p-37, -0x1.948841F777777p-36, -0x1.92614B4888889p-35, -0x1.418CDF199999Ap-34, -0x1.593FED0000000p-34, 0x1.659813999999Ap-33, 0x1.73EA923E66666p-28,
+		  -0x1.FBAB630888889p-36, 0x1.EE6E327777777p-38, 0x1.37B7CE7DDDDDEp-36, 0x1.04C2CDCA66666p-37, 0x1.64E8B81FBBBBCp-40, 0x1.B5D57EC933333p-44, 0x1.CC1AA8D880000p-49, 0x1.522B46D012222p-55 },
+		{ 0x1.29FB6B999999Ap-41, 0x1.5A0C258888889p-38, 0x1.00E28CC444444p-36, 0x1.188F739111111p-35, 0x1.110048A222222p-34, 0x1.04037B5DDDDDEp-33, 0x1.069DD22666666p-32, 0x1.B50ACA5555555p-32,
+		  0x1.27639E2222222p-37, -0x1.273F551111111p-39, -0x1.5824EC4CCCCCDp-38, -0x1.05BEB3ACCCCCDp-39, -0x1.3124118CCCCCDp-42, -0x1.26734B3BBBBBCp-46, -0x1.EA6EDFEAAAAABp-52, -0x1.7A30308108889p-58 },
+		{ -0x1.297196EEEEEEFp-45, -0x1.5CFA811111111p-42, -0x1.07DE700000000p-40, -0x1.2AA556EEEEEEFp-39, -0x1.35EFBEEEEEEEFp-38, -0x1.4FE9F11111111p-37, -0x1.C51EC22222222p-36, -0x1.49AE6BBBBBBBCp-33,
+		  -0x1.09151BBBBBBBCp-41, -0x1.5722044444444p-43, 0x1.E806AAAAAAAABp-48, 0x1.89B41BBBBBBBCp-47, 0x1.E0821BBBBBBBCp-50, 0x1.DA21DB3333333p-53, 0x1.5F9D4D9111111p-56, 0x1.58B33B5E66666p-61 },
+		{ -0x1.B47DDDDDDDDDEp-49, -0x1.00ADBBBBBBBBCp-45, -0x1.93EDBBBBBBBBCp-44, -0x1.DED4222222222p-43, -0x1.FF75333333333p-42, -0x1.0280777777777p-40, -0x1.CD3F888888889p-40, 0x1.9454777777777p-37,
+		  0x1.836999999999Ap-45, 0x1.35A4BBBBBBBBCp-43, 0x1.FFDEF77777777p-44, 0x1.47E579999999Ap-45, 0x1.5AA0400000000p-48, 0x1.0B005DDDDDDDEp-52, 0x1.18F3377777777p-59, -0x1.297CC75DDDDDEp-64 },
+		{ 0x1.25D2DDDDDDDDEp-47, 0x1.4FFD99999999Ap-44, 0x1.DD93BBBBBBBBCp-43, 0x1.E746444444444p-42, 0x1.AAD0444444444p-41, 0x1.62C999999999Ap-40, 0x1.2E7CEEEEEEEEFp-39, 0x1.00F4AAAAAAAABp-38,
+		  0x1.4732222222222p-42, 0x1.4D0CEEEEEEEEFp-43, 0x1.6117BBBBBBBBCp-45, 0x1.3A3E888888889p-48, 0x1.BECCCCCCCCCCDp-53, 0x1.0733333333333p-59, 0x1.6B53333333333p-63, 0x1.48131AAAAAAABp-67 },
+		{ -0x1.5608888888889p-50, -0x1.896CCCCCCCCCDp-47, -0x1.1532222222222p-45, -0x1.14F0000000000p-44, -0x1.D524444444444p-44, -0x1.7342222222222p-43, -0x1.2856666666666p-42, -0x1.9606666666666p-41,
+		  -0x1.AB55555555555p-45, -0x1.F068888888889p-46, -0x1.45CBBBBBBBBBCp-47, -0x1.D9F8888888889p-50, -0x1.64ECCCCCCCCCDp-53, -0x1.E0B1111111111p-58, -0x1.0B5DDDDDDDDDEp-63, -0x1.8EF219999999Ap-70 },
+		{ -0x1.3D19111111111p-49, -0x1.68FCCCCCCCCCDp-46, -0x1.FC68888888889p-45, -0x1.FE10000000000p-44, -0x1.B182222222222p-43, -0x1.53F3333333333p-42, -0x1.FC4CCCCCCCCCDp-42, -0x1.6380000000000p-41,
+		  -0x1.7EABBBBBBBBBCp-44, -0x1.9F23333333333p-45, -0x1.F6ACCCCCCCCCDp-47, -0x1.27D4CCCCCCCCDp-49, -0x1.577AAAAAAAAABp-53, -0x1.2D01111111111p-58, -0x1.135EEEEEEEEEFp-65, 0x1.B272222222222p-74 }
+	},
+	{
+		{ 0x1.01F022BE6DCC1p-9, 0x1.23F4E609415BBp-6, 0x1.9AA3368F4AAEDp-5, 0x1.9A8D9E6D83A6Fp-4, 0x1.5D583D2E962DEp-3, 0x1.0FEF0A33029D1p-2, 0x1.93602DE2EBB57p-2, 0x1.281C10FC7BC42p-1,
+		  0x1.517A00AB616B9p-4, 0x1.74F76FABDB53Bp-5, 0x1.BD9A19CE4015Fp-7, 0x1.1204121996FBFp-9, 0x1.3D7EDFB73B6E1p-13, 0x1.27C6EEBCB9CF4p-18, 0x1.448122ADC8922p-25, 0x1.7D6752502601Ap-35 },
+		{ -0x1.B12892AC40F75p-14, -0x1.EA4369E8FDDF7p-11, -0x1.58BE55C9862C4p-9, -0x1.589D320A6AE65p-8, -0x1.2527F4990BE2Ap-7, -0x1.C82F7C9919D8Dp-7, -0x1.520F9FA6F42CEp-6, -0x1.EF4AA0C6B7293p-6,
+		  -0x1.1B7C110190B9Ep-9, -0x1.3A5F523F58356p-10, -0x1.7A5828E4ACBDBp-12, -0x1.D704EA4869B07p-15, -0x1.162B4BACEAC56p-18, -0x1.0B3B08BEC6558p-23, -0x1.3560CA925974Fp-30, -0x1.99C6888F8F628p-40 },
+		{ 0x1.632A70D2C742Ap-18, 0x1.91CDCCA7D5D05p-15, 0x1.1A4305A04A137p-13, 0x1.19AE8FE2D0C6Ep-12, 0x1.DDEF9435CEB3Ep-12, 0x1.722936D52A33Ep-11, 0x1.0FEE39949A487p-10, 0x1.8544111A2C6BEp-10,
+		  0x1.5BA623AD1BE9Bp-14, 0x1.91703519DC67Ap-15, 0x1.05DFDBF6B194Ep-16, 0x1.701B50F1407D0p-19, 0x1.0046BD0299123p-22, 0x1.315DC4F7495DEp-27, 0x1.D749771421787p-34, 0x1.E03C34B7F5B34p-43 },
+		{ -0x1.FD882C448035Fp-23, -0x1.1F4A4CF70ECF2p-19, -0x1.90D14A51AF61Ep-18, -0x1.8B2C43C3C150Dp-17, -0x1.4888F610A1DB7p-16, -0x1.EB1AAF07ECFAAp-16, -0x1.4F1DF2774372Bp-15, -0x1.76B18FACB64BCp-15,
+		  -0x1.8ADBA46231542p-19, -0x1.2CE02048581E1p-19, -0x1.1E0229D57FE3Ap-20, -0x1.1F78273583123p-22, -0x1.0FF01E00F2BD6p-25, -0x1.A3600BE3A3401p-30, -0x1.94EAE5758E79Bp-36, -0x1.01C49099A312Ap-44 },
+		{ 0x1.444B2EDF5F400p-28, 0x1.5FA3D8D0B7377p-25, 0x1.BFBBA577686EFp-24, 0x1.6F1A73D63DF77p-23, 0x1.8EBA7598DC2ABp-23, 0x1.C87C43141BBBCp-28, -0x1.B9CFCA1E3A111p-21, -0x1.42260B6053544p-18,
+		  0x1.83D800A559DDEp-27, 0x1.13CF8AA31C866p-23, 0x1.F7E9790791AEFp-24, 0x1.4ECC3CD7A03B3p-25, 0x1.6E9AE63F2A7EBp-28, 0x1.364C3115571E0p-32, 0x1.43B4F0D0EDC56p-38, 0x1.C8CA65FD895B6p-47 },
+		{ 0x1.6A32E6335CCCDp-31, 0x1.ACEBBC249D555p-28, 0x1.4A90BD0DF8444p-26, 0x1.7CACA53D5999Ap-25, 0x1.8B5F4DDF8C889p-24, 0x1.95F467E823DDEp-23, 0x1.C41C6737C3DDEp-22, 0x1.58F7771960DDEp-20,
+		  0x1.B3AFBFE13BBBCp-27, -0x1.29EE54C300000p-27, -0x1.B8E281577B333p-27, -0x1.45D7CD868299Ap-28, -0x1.791B1E97C4E66p-31, -0x1.4F378CB7607BCp-35, -0x1.7540B34A5F977p-41, -0x1.2BAE43EE4D411p-49 },
+		{ -0x1.4811277795555p-34, -0x1.81AA062291111p-31, -0x1.2548114C71111p-29, -0x1.4C1B51AE62222p-28, -0x1.5369D21A33333p-27, -0x1.59967F7B75555p-26, -0x1.86BACDEA82222p-25, -0x1.492331B4DAAABp-23,
+		  -0x1.055AE8E0BBBBCp-30, 0x1.FAFFB2B744444p-32, 0x1.BC5927D7B7777p-31, 0x1.5DC6DBAB9D555p-32, 0x1.B2F60D4AF6666p-35, 0x1.AAEDB2C2BECCDp-39, 0x1.141C6AD457EEFp-44, 0x1.21D9A7A5E90CDp-52 },
+		{ -0x1.7C6F7FF777777p-39, -0x1.A55AAE4888889p-36, -0x1.191DF3B222222p-34, -0x1.F6669A8444444p-34, -0x1.45A9EBFBBBBBCp-33, -0x1.2780D0DDDDDDEp-34, 0x1.5376F8A99999Ap-31, 0x1.E6DD3FC333333p-28,
+		  -0x1.8C68CEE000000p-34, 0x1.47AF8F5555555p-37, 0x1.3661EE399999Ap-35, 0x1.8BA37E9F77777p-37, 0x1.0C5BBB1444444p-40, -0x1.C898889111111p-47, -0x1.4E9CE65277777p-49, -0x1.AB15509640000p-56 },
+		{ 0x1.AD22166222222p-40, 0x1.EEBD1C2AAAAABp-37, 0x1.69BB1AC666666p-35, 0x1.81571EEAAAAABp-34, 0x1.68F569AAAAAABp-33, 0x1.4498BCA000000p-32, 0x1.2D003D599999Ap-31, 0x1.2AED1FBDDDDDEp-30,
+		  0x1.D227DE3333333p-36, -0x1.6979D90000000p-38, -0x1.E0EC334888889p-37, -0x1.5F5A086F77777p-38, -0x1.6918E13000000p-41, -0x1.E30E2AE59999Ap-46, -0x1.7530D433BBBBCp-53, 0x1.367FD71CE6666p-59 },
+		{ -0x1.5CADEDBBBBBBCp-43, -0x1.9580FEEEEEEEFp-40, -0x1.2DF0DC8888889p-38, -0x1.4BEFCDDDDDDDEp-37, -0x1.477C6FDDDDDDEp-36, -0x1.41D38ECCCCCCDp-35, -0x1.633B932222222p-34, -0x1.2C3422BBBBBBCp-32,
+		  -0x1.3137F80000000p-39, 0x1.1348CEEEEEEEFp-42, 0x1.0E0830EEEEEEFp-40, 0x1.93BC0B0000000p-42, 0x1.9D82583333333p-45, 0x1.041BAF8888889p-49, 0x1.FF1BEB3333333p-60, -0x1.7416DB8AAAAABp-62 },
+		{ -0x1.DC48A66666666p-47, -0x1.0503155555555p-43, -0x1.6B4879999999Ap-42, -0x1.5DE2F33333333p-41, -0x1.0EDE6EEEEEEEFp-40, -0x1.35E7377777777p-40, 0x1.F889555555555p-42, 0x1.95996BBBBBBBCp-36,
+		  -0x1.1A48800000000p-41, -0x1.56A51DDDDDDDEp-43, 0x1.62D53BBBBBBBCp-45, 0x1.FB60E77777777p-46, 0x1.678EE66666666p-48, 0x1.78936BDDDDDDEp-52, 0x1.201AB43333333p-57, 0x1.145D404666666p-64 },
+		{ 0x1.05C5F77777777p-47, 0x1.2B2B99999999Ap-44, 0x1.AB93333333333p-43, 0x1.B78F777777777p-42, 0x1.8684777777777p-41, 0x1.436C333333333p-40, 0x1.025F19999999Ap-39, 0x1.884F777777777p-40,
+		  0x1.04EBEEEEEEEEFp-42, 0x1.964399999999Ap-44, 0x1.E2C999999999Ap-49, -0x1.9B0F000000000p-48, -0x1.4AE6D55555555p-50, -0x1.49F5F77777777p-54, -0x1.A5CF8AAAAAAABp-60, -0x1.39B5811111111p-67 },
+		{ 0x1.C79999999999Ap-48, 0x1.EEF7333333333p-45, 0x1.5E00EEEEEEEEFp-43, 0x1.5C0199999999Ap-42, 0x1.24E4EEEEEEEEFp-41, 0x1.BE48000000000p-41, 0x1.3B92AAAAAAAABp-40, 0x1.A720CCCCCCCCDp-40,
+		  0x1.22E9333333333p-42, 0x1.4A92EEEEEEEEFp-43, 0x1.8A91DDDDDDDDEp-45, 0x1.0D0D222222222p-47, 0x1.4A1ECCCCCCCCDp-51, 0x1.5FDA333333333p-56, 0x1.05AD333333333p-62, 0x1.0DE87BBBBBBBCp-70 },
+		{ -0x1.4B67777777777p-50, -0x1.7866666666666p-47, -0x1.0811111111111p-45, -0x1.07A2222222222p-44, -0x1.BFC2222222222p-44, -0x1.5977777777777p-43, -0x1.F4D3333333333p-43, -0x1.3D2EEEEEEEEEFp-42,
+		  -0x1.A897777777777p-45, -0x1.CC9BBBBBBBBBCp-46, -0x1.0E58888888889p-47, -0x1.3BE7777777777p-50, -0x1.50E4444444444p-54, -0x1.15CCCCCCCCCCDp-59, -0x1.C895555555555p-67, -0x1.DE7BBBBBBBBBCp-75 },
+		{ -0x1.20B6666666666p-49, -0x1.3B3DDDDDDDDDEp-46, -0x1.BECDDDDDDDDDEp-45, -0x1.BEBDDDDDDDDDEp-44, -0x1.7BE2222222222p-43, -0x1.274DDDDDDDDDEp-42, -0x1.B56EEEEEEEEEFp-42, -0x1.444AAAAAAAAABp-41,
+		  -0x1.675DDDDDDDDDEp-44, -0x1.91A5555555555p-45, -0x1.CFE4444444444p-47, -0x1.2C9F777777777p-49, -0x1.5626666666666p-53, -0x1.44D2AAAAAAAABp-58, -0x1.7B34444444444p-65, -0x1.ADD8888888889p-75 }
+	},
+	{
+		{ 0x1.D2CEA3A6ED1ADp-10, 0x1.082FDDC502F2Ep-6, 0x1.7394C46B6737Fp-5, 0x1.7381F00BBCC24p-4, 0x1.3C1FC2A38F1CEp-3, 0x1.EC28970273B3Ep-3, 0x1.6D0988C493CF2p-2, 0x1.0BFD465AB8224p-1,
+		  0x1.4105C381AE902p-4, 0x1.62C118DFBC8B8p-5, 0x1.A7C59668E63F0p-7, 0x1.0484AF7BABA3Ap-9, 0x1.2DB87BC393DE6p-13, 0x1.18E01ED158298p-18, 0x1.33BFD64E0A99Dp-25, 0x1.68963E5B843CCp-35 },
+		{ -0x1.6383CA2B9D27Cp-14, -0x1.9266A07C2D257p-11, -0x1.1AFC848BE2B4Ap-9, -0x1.1AEC9BB294189p-8, -0x1.E179FF8C695B1p-8, -0x1.76C5F07624593p-7, -0x1.15F1C14DF1556p-6, -0x1.9802691F912AEp-6,
+		  -0x1.E900E88793220p-10, -0x1.0E535D7266FE2p-10, -0x1.43413655A85C4p-12, -0x1.8E2494DBC25B1p-15, -0x1.CE619AA7FFD32p-19, -0x1.B056325759277p-24, -0x1.DD5D8218FC39Bp-31, -0x1.1C7AAD1B49E6Bp-40 },
+		{ 0x1.0D947E8EA4EF9p-18, 0x1.311C5568F56C1p-15, 0x1.AD11858305D92p-14, 0x1.ACDCAC0DF2A8Ap-13, 0x1.6CC375F8BAD98p-12, 0x1.1BBB8C865B19Ap-11, 0x1.A455B3557C4EEp-11, 0x1.339EDE8821A46p-10,
+		  0x1.15F339CB1BEDCp-14, 0x1.3590F8284CE41p-15, 0x1.77EEC24C6A468p-17, 0x1.DAE6E736ED95Cp-20, 0x1.1EAB67AB5E74Dp-23, 0x1.1C77421A69EB0p-28, 0x1.5A18EDB595E0Bp-35, 0x1.F2A8E7B398E98p-45 },
+		{ -0x1.8C9520DB3533Fp-23, -0x1.C098088E7AD47p-20, -0x1.3B08A8A585289p-18, -0x1.3A39AF44AC78Bp-17, -0x1.0A5D1F0C047DCp-16, -0x1.9C1528495DC8Bp-16, -0x1.2E1AEFBD0A1FDp-15, -0x1.AEE698A613C7Ep-15,
+		  -0x1.51094B05B7ACFp-19, -0x1.8FC28DEA17FEBp-20, -0x1.11A0F6AE0A71Dp-21, -0x1.98BE3C7649657p-24, -0x1.2F9F247D128F5p-27, -0x1.80AF685D60AE3p-32, -0x1.383F69F06AA27p-38, -0x1.453AEC9D77E25p-47 },
+		{ 0x1.EEB120E18ED11p-28, 0x1.16B1B654C6D77p-24, 0x1.8424909F44444p-23, 0x1.7D8B5826B0955p-22, 0x1.3BB475D8EEC89p-21, 0x1.D449156B8AE66p-21, 0x1.3B2892E623422p-20, 0x1.568441AAC82EFp-20,
+		  0x1.4A48C12036000p-24, 0x1.2341E1D09CF33p-24, 0x1.39311F2324044p-25, 0x1.51AB2B59AE99Ap-27, 0x1.4AF740DEB0FEFp-30, 0x1.02A4488F3E5ABp-34, 0x1.F0183FA3FA1BCp-41, 0x1.2D46CF369834Dp-49 },
+		{ -0x1.18C2CE5AC0000p-34, -0x1.1CBE448022222p-31, -0x1.2C811FA8CCCCDp-30, -0x1.0396365700000p-30, 0x1.F89ADDC2DDDDEp-30, 0x1.99530D18D3333p-27, 0x1.74D93C8BFDDDEp-25, 0x1.62C6AD0696EEFp-23,
+		  0x1.75CF71A62AAABp-30, -0x1.0990A9C06DDDEp-28, -0x1.1B1CD762E999Ap-28, -0x1.83F606A52A222p-30, -0x1.AA822C651E000p-33, -0x1.652F5CB1212ABp-37, -0x1.69E30AEA1BEEFp-43, -0x1.D6EF22CEF3044p-52 },
+		{ -0x1.167C9B45E6666p-35, -0x1.455571CD48889p-32, -0x1.E85313519999Ap-31, -0x1.0E8B4AB055555p-29, -0x1.0B4E537751111p-28, -0x1.01D2EC2C22222p-27, -0x1.08585076CEEEFp-26, -0x1.5CF13913BBBBCp-25,
+		  -0x1.4B6179489999Ap-31, 0x1.323EF4D9EEEEFp-32, 0x1.070FB8B3D3333p-31, 0x1.8854A5C234444p-33, 0x1.C09BE45CEDDDEp-36, 0x1.83A9A2B608444p-40, 0x1.985DD61839DDEp-46, 0x1.1E7437D62C444p-54 },
+		{ 0x1.24AEF14555555p-38, 0x1.5451963BBBBBCp-35, 0x1.FA44DF2111111p-34, 0x1.1519DDF911111p-32, 0x1.0E22F85AAAAABp-31, 0x1.01BC723B33333p-30, 0x1.088A211F33333p-29, 0x1.6EDD4E7555555p-28,
+		  0x1.122769F111111p-34, -0x1.4E84491111111p-36, -0x1.65E4ECBF77777p-35, -0x1.153BE40911111p-36, -0x1.46FD7179DDDDEp-39, -0x1.2621B4EBAAAABp-43, -0x1.4A4DFC724CCCDp-49, -0x1.081ADEA960000p-57 },
+		{ -0x1.C3B4EB999999Ap-43, -0x1.0989BCB333333p-39, -0x1.93F50D5555555p-38, -0x1.CA60C42222222p-37, -0x1.D72AEE1111111p-36, -0x1.E61D080000000p-35, -0x1.1A42B75111111p-33, -0x1.F0D6120000000p-32,
+		  -0x1.B4B073BBBBBBCp-40, 0x1.7CDB64CCCCCCDp-41, 0x1.6CC9EB8888889p-40, 0x1.305681D111111p-41, 0x1.94CDB72EEEEEFp-44, 0x1.AE1ED55CCCCCDp-48, 0x1.2FE48784CCCCDp-53, 0x1.5938C07A66666p-61 },
+		{ -0x1.DAAEA11111111p-46, -0x1.0E019C4444444p-42, -0x1.7CD54AAAAAAABp-41, -0x1.7D205BBBBBBBCp-40, -0x1.40683BBBBBBBCp-39, -0x1.D1532EEEEEEEFp-39, -0x1.D319088888889p-39, 0x1.B33216EEEEEEFp-37,
+		  -0x1.AB0FFDDDDDDDEp-41, -0x1.68CCAAAAAAAABp-45, 0x1.EA18100000000p-43, 0x1.8B1972AAAAAABp-44, 0x1.9DA7211111111p-47, 0x1.14172D3333333p-51, 0x1.C9DDC00000000p-59, -0x1.FB3D5AF777777p-66 },
+		{ -0x1.28EDEEEEEEEEFp-49, -0x1.33DD088888889p-46, -0x1.845D111111111p-45, -0x1.2B1799999999Ap-44, -0x1.23C8222222222p-44, 0x1.49CAAAAAAAAABp-46, 0x1.6601EEEEEEEEFp-42, 0x1.80C4444444444p-41,
+		  -0x1.F40C911111111p-43, -0x1.BA356AAAAAAABp-43, -0x1.C8A9688888889p-44, -0x1.EA16166666666p-46, -0x1.CA65E77777777p-49, -0x1.4861440000000p-53, -0x1.F887C4CCCCCCDp-60, -0x1.74FE1DDDDDDDEp-72 },
+		{ 0x1.F2A7555555555p-49, 0x1.1D0ABBBBBBBBCp-45, 0x1.8C13333333333p-44, 0x1.85EEEEEEEEEEFp-43, 0x1.44A4CCCCCCCCDp-42, 0x1.DE2E666666666p-42, 0x1.3DF9555555555p-41, 0x1.456B555555555p-41,
+		  0x1.7394EEEEEEEEFp-43, 0x1.B1DEAAAAAAAABp-44, 0x1.2773EEEEEEEEFp-45, 0x1.A43C222222222p-48, 0x1.2AD0EEEEEEEEFp-51, 0x1.69C1000000000p-56, 0x1.FBDA444444444p-63, 0x1.7E70EEEEEEEEFp-74 },
+		{ 0x1.A33A222222222p-48, 0x1.D63F99999999Ap-45, 0x1.4B58000000000p-43, 0x1.4A05555555555p-42, 0x1.1947DDDDDDDDEp-41, 0x1.B7C8888888889p-41, 0x1.4841DDDDDDDDEp-40, 0x1.ED2D99999999Ap-40,
+		  0x1.154A444444444p-42, 0x1.3718CCCCCCCCDp-43, 0x1.67DE444444444p-45, 0x1.D1E8AAAAAAAABp-48, 0x1.0D1BBBBBBBBBCp-51, 0x1.F141777777777p-57, 0x1.179799999999Ap-63, 0x1.A956222222222p-73 },
+		{ -0x1.2305555555555p-50, -0x1.4D87777777777p-47, -0x1.D3A6666666666p-46, -0x1.D348888888889p-45, -0x1.8F2EEEEEEEEEFp-44, -0x1.34DBBBBBBBBBCp-43, -0x1.CAE6666666666p-43, -0x1.5614444444444p-42,
+		  -0x1.8AB999999999Ap-45, -0x1.B46EEEEEEEEEFp-46, -0x1.0C2DDDDDDDDDEp-47, -0x1.45C2222222222p-50, -0x1.7D66666666666p-54, -0x1.7A66666666666p-59, -0x1.C4B3333333333p-66, -0x1.470999999999Ap-75 },
+		{ -0x1.FF02222222222p-50, -0x1.1ECA222222222p-46, -0x1.93EAAAAAAAAABp-45, -0x1.9242222222222p-44, -0x1.5678888888889p-43, -0x1.0B20000000000p-42, -0x1.8C76666666666p-42, -0x1.22BBBBBBBBBBCp-41,
+		  -0x1.52D6666666666p-44, -0x1.7B9AAAAAAAAABp-45, -0x1.B75EEEEEEEEEFp-47, -0x1.1AD199999999Ap-49, -0x1.44DEEEEEEEEEFp-53, -0x1.291B333333333p-58, -0x1.4352222222222p-65, -0x1.7A93333333333p-75 }
+	},
+	{
+		{ 0x1.AA38D41288414p-10, 0x1.E26FA58CF70FFp-7, 0x1.53467B050C238p-5, 0x1.53355B6BB1052p-4, 0x1.20A3EF0B83455p-3, 0x1.C15F13D43BBCEp-3, 0x1.4D4D8B5C429EEp-2, 0x1.E9633671E4E1Ap-2,
+		  0x1.32BFEC76F9A12p-4, 0x1.52FA84524B2E7p-5, 0x1.94EB3EC50303Bp-7, 0x1.F1D70E9E48F1Bp-10, 0x1.2045E44330577p-13, 0x1.0C55A5933E132p-18, 0x1.25F7447946589p-25, 0x1.5853B386C94E6p-35 },
+		{ -0x1.287D144E8D0ABp-14, -0x1.4F9791CBDDAF8p-11, -0x1.D80337D783C6Dp-10, -0x1.D7EB223B1E772p-9, -0x1.9190AA134D494p-8, -0x1.389678029CA7Ap-7, -0x1.CFB1B4B039910p-7, -0x1.5469DC802B5A5p-6,
+		  -0x1.AAC3F1D7FB9C0p-10, -0x1.D7A1284D8A7F4p-11, -0x1.19B834301158Dp-12, -0x1.5A6F72ABAB791p-15, -0x1.91534E838F493p-19, -0x1.75BEA79F549D5p-24, -0x1.99C6BFE307230p-31, -0x1.E0CCBD62F10C8p-41 },
+		{ 0x1.9C3E903DCDF67p-19, 0x1.D29C54504C327p-16, 0x1.4823B41EEE63Bp-14, 0x1.48105A6114A6Fp-13, 0x1.17248364EDBAAp-12, 0x1.B28C6DED8AE72p-12, 0x1.42430D8D5FC77p-11, 0x1.D906929AC69D2p-11,
+		  0x1.BD0142C0BEE94p-15, 0x1.EC44E1ED66394p-16, 0x1.26A90BED32D68p-17, 0x1.6B9A925A02BBBp-20, 0x1.A77E6EBA8697Fp-24, 0x1.8DC3659DCF8EEp-29, 0x1.BA7DF832A2EFFp-36, 0x1.0BAAE56DC9698p-45 },
+		{ -0x1.1D2A3CBC32660p-23, -0x1.42BEF8754FBB6p-20, -0x1.C5DB8667C07C6p-19, -0x1.C59F189B2B982p-18, -0x1.81CCCFB785D1Bp-17, -0x1.2C1224CFCC31Ap-16, -0x1.BC7CA2FB1BD27p-16, -0x1.4542324536694p-15,
+		  -0x1.0010C9D12481Ep-19, -0x1.1E2E3335731E2p-20, -0x1.5E025CBC014FAp-22, -0x1.BF1AE254F0C8Bp-25, -0x1.1233E97A02CFEp-28, -0x1.160DA83E02AA7p-33, -0x1.5C49F0D3B7F6Ep-40, -0x1.0487EE30E74FFp-49 },
+		{ 0x1.7E6817D2DFF77p-28, 0x1.B08ECD020D99Ap-25, 0x1.2FC5A1B691B11p-23, 0x1.2EFF019322689p-22, 0x1.00DBDF4D68C00p-21, 0x1.8D733F7B66489p-21, 0x1.238F975EE9422p-20, 0x1.A126F9C68C444p-20,
+		  0x1.2726D7B6D8E66p-24, 0x1.6360531BD43BCp-25, 0x1.F2DF979D2F666p-27, 0x1.7F632217D8F77p-29, 0x1.24609B1690400p-32, 0x1.79F284BB2C666p-37, 0x1.35B86EA95F99Ap-43, 0x1.3E1AB20118CDEp-52 },
+		{ -0x1.B321CB2302222p-33, -0x1.EA64DA6CBBBBCp-30, -0x1.55ACA62307777p-28, -0x1.503714F3B8889p-27, -0x1.16C32165D6EEFp-26, -0x1.9F4F917932222p-26, -0x1.1AE9D731FCCCDp-25, -0x1.47750F9F6999Ap-25,
+		  -0x1.0487B54208889p-29, -0x1.EAB0593CBBBBCp-30, -0x1.13E07F623AAABp-30, -0x1.2F8D5C0347777p-32, -0x1.2B7A10C301DDEp-35, -0x1.D2A335C698444p-40, -0x1.B91FF2A17C222p-46, -0x1.00E9007DA6111p-54 },
+		{ 0x1.7E99038CCCCCDp-40, 0x1.7E727863BBBBCp-37, 0x1.816B1BE111111p-36, 0x1.FBEADBE222222p-37, -0x1.EBA2AA5EEEEEFp-35, -0x1.43C4ACA0CCCCDp-32, -0x1.1483B67FBBBBCp-30, -0x1.E7FF4C6211111p-29,
+		  -0x1.BD9C8EECCCCCDp-35, 0x1.AC24E324CCCCDp-34, 0x1.E074F6DA00000p-34, 0x1.4B36CA23F3333p-35, 0x1.6AADC73C24444p-38, 0x1.2C432C121AAABp-42, 0x1.292187679D555p-48, 0x1.6CB654B9A7777p-57 },
+		{ 0x1.E93E147777777p-41, 0x1.1C73B86EEEEEFp-37, 0x1.A6F312CCCCCCDp-36, 0x1.CDD5BAF333333p-35, 0x1.BED9AA7777777p-34, 0x1.A2522DF777777p-33, 0x1.996748A222222p-32, 0x1.EA9B873333333p-31,
+		  0x1.35AD1D7777777p-36, -0x1.ECA7F90000000p-38, -0x1.C37FB4B555555p-37, -0x1.50E5D45333333p-38, -0x1.7DA575AB33333p-41, -0x1.43B851F044444p-45, -0x1.4924385F55555p-51, -0x1.A7FB65F977777p-60 },
+		{ -0x1.105B0B7777777p-43, -0x1.3B67C52222222p-40, -0x1.D1AB5CEEEEEEFp-39, -0x1.F71B71BBBBBBCp-38, -0x1.E0DE727777777p-37, -0x1.BCA8E1CCCCCCDp-36, -0x1.B03B55DDDDDDEp-35, -0x1.07CF78B777777p-33,
+		  -0x1.0702333333333p-39, 0x1.775E366666666p-41, 0x1.6D62CCEEEEEEFp-40, 0x1.1449B1D99999Ap-41, 0x1.3D37AF5777777p-44, 0x1.12304D3000000p-48, 0x1.1FC2FC819999Ap-54, 0x1.8CAD497222222p-63 },
+		{ 0x1.6C48000000000p-48, 0x1.AF24C88888889p-45, 0x1.4FBE5DDDDDDDEp-43, 0x1.8684222222222p-42, 0x1.9CFE466666666p-41, 0x1.AF797DDDDDDDEp-40, 0x1.E8E6CAAAAAAABp-39, 0x1.7348F66666666p-37,
+		  -0x1.B7D9BBBBBBBBCp-44, -0x1.8112444444444p-43, -0x1.1E4F3EEEEEEEFp-43, -0x1.6A3231999999Ap-45, -0x1.8B3794CCCCCCDp-48, -0x1.562918AAAAAABp-52, -0x1.76DB72999999Ap-58, -0x1.21C4EEC444444p-66 },
+		{ -0x1.FBF8EEEEEEEEFp-48, -0x1.220BF55555555p-44, -0x1.96EE044444444p-43, -0x1.9CD4D11111111p-42, -0x1.636C39999999Ap-41, -0x1.1D0A577777777p-40, -0x1.BFFC911111111p-40, -0x1.8E7F688888889p-39,
+		  -0x1.59D7800000000p-42, -0x1.75E2555555555p-43, -0x1.B22C19999999Ap-45, -0x1.F3B8844444444p-48, -0x1.F1DF8CCCCCCCDp-52, -0x1.FF8AD55555555p-58, 0x1.51E7C00000000p-64, 0x1.DD32E44444444p-71 },
+		{ 0x1.021199999999Ap-48, 0x1.2631EEEEEEEEFp-45, 0x1.9D11555555555p-44, 0x1.9EBB777777777p-43, 0x1.5FCC777777777p-42, 0x1.125D222222222p-41, 0x1.98E3555555555p-41, 0x1.357E000000000p-40,
+		  0x1.6DC1DDDDDDDDEp-43, 0x1.9BB0444444444p-44, 0x1.F4FC666666666p-46, 0x1.3C7F888888889p-48, 0x1.7BF8AAAAAAAABp-52, 0x1.7430111111111p-57, 0x1.A545444444444p-64, 0x1.4C7ECCCCCCCCDp-74 },
+		{ 0x1.7857777777777p-48, 0x1.ACBDBBBBBBBBCp-45, 0x1.2B7CCCCCCCCCDp-43, 0x1.2D45111111111p-42, 0x1.FF9ECCCCCCCCDp-42, 0x1.8F62888888889p-41, 0x1.27EF99999999Ap-40, 0x1.B211BBBBBBBBCp-40,
+		  0x1.0C60AAAAAAAABp-42, 0x1.252FDDDDDDDDEp-43, 0x1.5D0AAAAAAAAABp-45, 0x1.ABCCEEEEEEEEFp-48, 0x1.EF0C222222222p-52, 0x1.BF48AAAAAAAABp-57, 0x1.E8DFDDDDDDDDEp-64, 0x1.1FCFDDDDDDDDEp-73 },
+		{ -0x1.0A37777777777p-50, -0x1.3036666666666p-47, -0x1.AAF7777777777p-46, -0x1.AD0CCCCCCCCCDp-45, -0x1.6BA999999999Ap-44, -0x1.1B52222222222p-43, -0x1.A468888888889p-43, -0x1.3533333333333p-42,
+		  -0x1.7762222222222p-45, -0x1.A388888888889p-46, -0x1.F4C2222222222p-48, -0x1.32E1111111111p-50, -0x1.6195555555555p-54, -0x1.4B0999999999Ap-59, -0x1.6D87777777777p-66, -0x1.A40EEEEEEEEEFp-76 },
+		{ -0x1.CABBBBBBBBBBCp-50, -0x1.0532AAAAAAAABp-46, -0x1.6D1AAAAAAAAABp-45, -0x1.6F0DDDDDDDDDEp-44, -0x1.37C8000000000p-43, -0x1.E66BBBBBBBBBCp-43, -0x1.6857777777777p-42, -0x1.0864CCCCCCCCDp-41,
+		  -0x1.4757777777777p-44, -0x1.6633333333333p-45, -0x1.AB3999999999Ap-47, -0x1.0710888888889p-49, -0x1.3173BBBBBBBBCp-53, -0x1.171199999999Ap-58, -0x1.3528000000000p-65, -0x1.6BB5555555555p-75 }
+	},
+	{
+		{ 0x1.881FF3E0E1036p-10, 0x1.BBD7870B76790p-7, 0x1.38223F2B15538p-5, 0x1.38127FA6728C0p-4, 0x1.098CB27080C02p-3, 0x1.9D6C271BACDB5p-3, 0x1.32A3AC434ACECp-2, 0x1.C23CE0E97A4BCp-2,
+		  0x1.263962F6E0BF6p-4, 0x1.4523024037FCCp-5, 0x1.84623E65FE71Ep-7, 0x1.DD8248104CD52p-10, 0x1.147FBC55F6BFDp-13, 0x1.015F7644C7C65p-18, 0x1.19F419B155DCEp-25, 0x1.4A3F6C3C9B417p-35 },
+		{ -0x1.F5EAEB989F291p-15, -0x1.1C0EBFB08B409p-11, -0x1.8F878CE63AB41p-10, -0x1.8F735FE0C7C77p-9, -0x1.53E6DF945443Bp-8, -0x1.0896C840C5D74p-7, -0x1.887EFAFE70D9Cp-7, -0x1.20266926EB2BBp-6,
+		  -0x1.789B0794ECC72p-10, -0x1.A02CF58FC1753p-11, -0x1.F1231B0FD1451p-13, -0x1.319D5993C17B5p-15, -0x1.61F0453623A44p-19, -0x1.4978388127D20p-24, -0x1.68F60C5C79541p-31, -0x1.A6D913AA24FDEp-41 },
+		{ 0x1.4134AB3AA06D1p-19, 0x1.6B91ABE9FA850p-16, 0x1.FF5CB0EA8AD09p-15, 0x1.FF427A83C45A2p-14, 0x1.B30A6BBBC63CFp-13, 0x1.52A52EDB7934Ep-12, 0x1.F658A036B04B5p-12, 0x1.70C96F3652469p-11,
+		  0x1.6983A0E9A2ABBp-15, 0x1.8F8A4C034F1F4p-16, 0x1.DD5EF1D1FE217p-18, 0x1.259217FE20DDCp-20, 0x1.542EE884C4FFFp-24, 0x1.3CF24EB9604FEp-29, 0x1.5BC27957F30F0p-36, 0x1.98A1B37AD31D0p-46 },
+		{ -0x1.9ADB0B644C6A5p-24, -0x1.D109D90267B4Ep-21, -0x1.47088D055DABFp-19, -0x1.46F5179F52935p-18, -0x1.163349B847CB7p-17, -0x1.B114814FBD7D3p-17, -0x1.412BF93B9A296p-16, -0x1.D76D682B8DAC9p-16,
+		  -0x1.814229ED2D9BCp-20, -0x1.AA540D945877Cp-21, -0x1.FEC2911E5D5BCp-23, -0x1.3B8406CC8B646p-25, -0x1.7029091C996C6p-29, -0x1.5ABE60A4D39ADp-34, -0x1.83642A1EEA8C9p-41, -0x1.D82BD9357C75Ep-51 },
+		{ 0x1.058BCD34005BCp-28, 0x1.28044E816E155p-25, 0x1.A046FEDAB2333p-24, 0x1.A012DE1DB8489p-23, 0x1.61E27741A0400p-22, 0x1.1345E85DD1444p-21, 0x1.97D501663259Ap-21, 0x1.2A9911E346A22p-20,
+		  0x1.AC14024DA1111p-25, 0x1.DEF0277902BBCp-26, 0x1.2582335998BBCp-27, 0x1.78205CD2B9AABp-30, 0x1.CF3FB190CA333p-34, 0x1.D7F8C1F2E9AABp-39, 0x1.28D08B09BD666p-45, 0x1.BB23687000777p-55 },
+		{ -0x1.4432C94301111p-33, -0x1.6EC1C0918999Ap-30, -0x1.019FDFB205555p-28, -0x1.011300270999Ap-27, -0x1.B429802D67777p-27, -0x1.51DA89C525555p-26, -0x1.F0DD7BD36AAABp-26, -0x1.65CD418921111p-25,
+		  -0x1.D3ECDD8BB7777p-30, -0x1.1938F3892EEEFp-30, -0x1.89803CABEAAABp-32, -0x1.2CFEADE9FDDDEp-34, -0x1.C827409FC2222p-38, -0x1.2422C6BC1CCCDp-42, -0x1.D7C1B2184999Ap-49, -0x1.D5AF02EF8EEEFp-58 },
+		{ 0x1.5ECECEE2AAAABp-38, 0x1.8BBF96FEAAAABp-35, 0x1.145421A266666p-33, 0x1.10F2AEFF55555p-32, 0x1.C78EEB3222222p-32, 0x1.576065B3DDDDEp-31, 0x1.DFE676D800000p-31, 0x1.2F74B12288889p-30,
+		  0x1.8F3DAB66EEEEFp-35, 0x1.69278F8777777p-35, 0x1.8A738F6C44444p-36, 0x1.AA93F199DDDDEp-38, 0x1.9F73F56F44444p-41, 0x1.3F68E95BF7777p-45, 0x1.285FF4AC91111p-51, 0x1.4C743B0FC8889p-60 },
+		{ -0x1.F1418AAAAAAABp-45, -0x1.0B0220CCCCCCDp-41, -0x1.4BEEA3BBBBBBCp-40, -0x1.028C8C4444444p-39, -0x1.E23389999999Ap-40, 0x1.008B09999999Ap-40, 0x1.7EC7C6AAAAAABp-37, 0x1.AAE5DFDDDDDDEp-35,
+		  0x1.220A0B3333333p-40, -0x1.1510B88888889p-39, -0x1.363B43999999Ap-39, -0x1.AA06288888889p-41, -0x1.CF5AEAF333333p-44, -0x1.7B702BB777777p-48, -0x1.703A6CF777777p-54, -0x1.B0501D85DDDDEp-63 },
+		{ -0x1.A6F9000000000p-47, -0x1.EA1FB55555555p-44, -0x1.7209466666666p-42, -0x1.9B528DDDDDDDEp-41, -0x1.984C222222222p-40, -0x1.8821E80000000p-39, -0x1.8773088888889p-38, -0x1.D17C9AEEEEEEFp-37,
+		  -0x1.72B9200000000p-43, 0x1.11674AAAAAAABp-42, 0x1.41C621999999Ap-42, 0x1.BD8D7EEEEEEEFp-44, 0x1.E8F7263333333p-47, 0x1.9472DFF777777p-51, 0x1.8E59294CCCCCDp-57, 0x1.E1AB328CCCCCDp-66 },
+		{ -0x1.73A8A22222222p-49, -0x1.98F0911111111p-46, -0x1.1408D55555555p-44, -0x1.FC2FDDDDDDDDEp-44, -0x1.7A91BBBBBBBBCp-43, -0x1.B93E666666666p-43, -0x1.EFDD99999999Ap-44, 0x1.22A6222222222p-41,
+		  -0x1.B14B000000000p-43, -0x1.3D041DDDDDDDEp-43, -0x1.2773088888889p-44, -0x1.201A0DDDDDDDEp-46, -0x1.0CA451999999Ap-49, -0x1.973F31999999Ap-54, -0x1.80722C4444444p-60, -0x1.D24D122222222p-69 },
+		{ -0x1.BB965DDDDDDDEp-48, -0x1.037D511111111p-44, -0x1.6CDA444444444p-43, -0x1.709A2EEEEEEEFp-42, -0x1.3A18888888889p-41, -0x1.EBEE044444444p-41, -0x1.721F6EEEEEEEFp-40, -0x1.1B924AAAAAAABp-39,
+		  -0x1.45A9E00000000p-42, -0x1.659B088888889p-43, -0x1.A325E66666666p-45, -0x1.CC30000000000p-48, -0x1.D3CA488888889p-52, -0x1.511FD9999999Ap-57, -0x1.27A0333333333p-65, 0x1.4380D9999999Ap-73 },
+		{ 0x1.E617DDDDDDDDEp-49, 0x1.1231666666666p-45, 0x1.8235333333333p-44, 0x1.813D111111111p-43, 0x1.493199999999Ap-42, 0x1.007A000000000p-41, 0x1.7E0E888888889p-41, 0x1.1A2AAAAAAAAABp-40,
+		  0x1.63BCCCCCCCCCDp-43, 0x1.845B555555555p-44, 0x1.D71DDDDDDDDDEp-46, 0x1.1B0F888888889p-48, 0x1.46D4555555555p-52, 0x1.24F8555555555p-57, 0x1.2406CCCCCCCCDp-64, 0x1.1E48444444444p-74 },
+		{ 0x1.4D69BBBBBBBBCp-48, 0x1.860CCCCCCCCCDp-45, 0x1.11CAAAAAAAAABp-43, 0x1.1393BBBBBBBBCp-42, 0x1.D3C3777777777p-42, 0x1.6B71333333333p-41, 0x1.0D62888888889p-40, 0x1.8CA1777777777p-40,
+		  0x1.F6D9BBBBBBBBCp-43, 0x1.192ECCCCCCCCDp-43, 0x1.563C444444444p-45, 0x1.9910444444444p-48, 0x1.DD4E444444444p-52, 0x1.C6C7111111111p-57, 0x1.0101333333333p-63, 0x1.2313111111111p-73 },
+		{ -0x1.ED5BBBBBBBBBCp-51, -0x1.1681111111111p-47, -0x1.884AAAAAAAAABp-46, -0x1.86DDDDDDDDDDEp-45, -0x1.4DFDDDDDDDDDEp-44, -0x1.03E0000000000p-43, -0x1.823DDDDDDDDDEp-43, -0x1.1AF1111111111p-42,
+		  -0x1.6A82222222222p-45, -0x1.8C24444444444p-46, -0x1.E437777777777p-48, -0x1.2485555555555p-50, -0x1.56F8888888889p-54, -0x1.3A9AAAAAAAAABp-59, -0x1.4AA6666666666p-66, -0x1.9011111111111p-76 },
+		{ -0x1.978AAAAAAAAABp-50, -0x1.DC86666666666p-47, -0x1.4E8CCCCCCCCCDp-45, -0x1.506DDDDDDDDDEp-44, -0x1.1DB3333333333p-43, -0x1.BC0DDDDDDDDDEp-43, -0x1.493999999999Ap-42, -0x1.E4C3333333333p-42,
+		  -0x1.3358000000000p-44, -0x1.5775555555555p-45, -0x1.A0F1111111111p-47, -0x1.F46AAAAAAAAABp-50, -0x1.2353BBBBBBBBCp-53, -0x1.1492AAAAAAAABp-58, -0x1.36F2222222222p-65, -0x1.5F63333333333p-75 }
+	},
+	{
+		{ 0x1.6B141D8CA6BD7p-10, 0x1.9AF6FB8FD4064p-7, 0x1.2103465237E08p-5, 0x1.20F4B1872BFE0p-4, 0x1.EBC2326871B33p-4, 0x1.7ECC73CBF0DF3p-3, 0x1.1BECE503F1B7Dp-2, 0x1.A0E30EDCF15F3p-2,
+		  0x1.1B1E0AAEC6009p-4, 0x1.38DCEC476D822p-5, 0x1.75B8EE71F1C6Ep-7, 0x1.CB7BA424B8E1Ep-10, 0x1.0A0FA084789EBp-13, 0x1.EF504DA5FA137p-19, 0x1.0F4F2B46E2982p-25, 0x1.3DC797E1C5ED9p-35 },
+		{ -0x1.AE50B1827D88Bp-15, -0x1.E711B74D61636p-12, -0x1.5688979A248FCp-10, -0x1.56774F43B11DFp-9, -0x1.2369920C55EF2p-8, -0x1.C5AFE59A8EE39p-8, -0x1.50810577E1280p-7, -0x1.EE168488AA29Cp-7,
+		  -0x1.4F8BE09AA44D9p-10, -0x1.72CCF4C057924p-11, -0x1.BAEE3EF558FC2p-13, -0x1.10496D57D872Bp-15, -0x1.3B553DC8ED477p-19, -0x1.25857C382B66Bp-24, -0x1.418E48E25D4AFp-31, -0x1.78A2E918D0EF0p-41 },
+		{ 0x1.FE000BBC752A8p-20, 0x1.20A1C201B2E85p-16, 0x1.95F6949489CC3p-15, 0x1.95E2128DDEFB2p-14, 0x1.596013DC4B252p-13, 0x1.0CD981E6B837Fp-12, 0x1.8ED0F4B2FEFEEp-12, 0x1.24CA358032854p-11,
+		  0x1.2A42EFF64CDCDp-15, 0x1.4999F53155E36p-16, 0x1.89B98FE01F384p-18, 0x1.E4177F7E29214p-21, 0x1.18533C1379A90p-24, 0x1.04F480FC00DDBp-29, 0x1.1DEA499C65D7Ap-36, 0x1.4EF972F45DB9Ap-46 },
+		{ -0x1.2E336F0B59373p-24, -0x1.560EC44CA8287p-21, -0x1.E11B30CDA266Cp-20, -0x1.E10285A7ADD9Ap-19, -0x1.994CEED8CB3B6p-18, -0x1.3E9BC7740BDE4p-17, -0x1.D89FB084E0FC5p-17, -0x1.5AF797323B2D0p-16,
+		  -0x1.268D315E1DFAFp-20, -0x1.458B4C41F915Ap-21, -0x1.84FC48E0ECE44p-23, -0x1.DE7B7EAE0AB6Bp-26, -0x1.15458BACA5DB3p-29, -0x1.0264DE248A160p-34, -0x1.1B9EF3160ACF5p-41, -0x1.4D7C8E7B75D9Ep-51 },
+		{ 0x1.65F1002B228CDp-29, 0x1.952586E0664CDp-26, 0x1.1CEA7B6E35777p-24, 0x1.1CD9E947A0AEFp-23, 0x1.E4C01FEDC9CCDp-23, 0x1.7950D5B5A7EEFp-22, 0x1.17D304F924D9Ap-21, 0x1.9AC313D5D419Ap-21,
+		  0x1.312D6B0BC7666p-25, 0x1.51B90B50F8889p-26, 0x1.94A2BDD3B4111p-28, 0x1.F3F79AC4C4444p-31, 0x1.23B9B5CCC6889p-34, 0x1.12C55AE275555p-39, 0x1.32EB880EBF333p-46, 0x1.7586FE71E8EEFp-56 },
+		{ -0x1.A66B6604BBBBCp-34, -0x1.DE1A13013BBBCp-31, -0x1.502E9F2EF0000p-29, -0x1.500A7D296999Ap-28, -0x1.1DD88C94B1111p-27, -0x1.BCC72E0D88889p-27, -0x1.4997476A8BBBCp-26, -0x1.E3017468F7777p-26,
+		  -0x1.4344E03C88889p-30, -0x1.69394F9300000p-31, -0x1.B99545C71999Ap-33, -0x1.19BEE2D9E6666p-35, -0x1.58CF0CE5A6666p-39, -0x1.5BFADE8E0CCCDp-44, -0x1.AF22523D6AAABp-51, -0x1.38BF05FC66666p-60 },
+		{ 0x1.E87C624511111p-39, 0x1.1459AD0D9999Ap-35, 0x1.845E3D4777777p-34, 0x1.83C1EF4B77777p-33, 0x1.493D86C8EEEEFp-32, 0x1.FED4C28155555p-32, 0x1.78AB36F59999Ap-31, 0x1.1114DB259999Ap-30,
+		  0x1.4FF651F800000p-35, 0x1.8E2786F777777p-36, 0x1.0FD9CD0911111p-37, 0x1.93CEFCE555555p-40, 0x1.28B64A0733333p-43, 0x1.7078698911111p-48, 0x1.1FE51E0B9999Ap-54, 0x1.125EF46022222p-63 },
+		{ -0x1.F23477BBBBBBCp-44, -0x1.195FAC1111111p-40, -0x1.89D37E4444444p-39, -0x1.868D411111111p-38, -0x1.480CE24444444p-37, -0x1.F421A24444444p-37, -0x1.6561A97777777p-36, -0x1.E1B9448888889p-36,
+		  -0x1.EAADFEEEEEEEFp-41, -0x1.A623DA2222222p-41, -0x1.BB8AC04444444p-42, -0x1.D515EE6666666p-44, -0x1.C1BBBA8888889p-47, -0x1.54FEA5AAAAAABp-51, -0x1.36F21B8000000p-57, -0x1.51CFBFF333333p-66 },
+		{ 0x1.9DDBE00000000p-48, 0x1.CBFF777777777p-45, 0x1.3E6619999999Ap-43, 0x1.356D0EEEEEEEFp-42, 0x1.FABBDBBBBBBBCp-42, 0x1.6DA58EEEEEEEFp-41, 0x1.D7B7E22222222p-41, 0x1.CE51333333333p-41,
+		  0x1.81BEF9999999Ap-43, 0x1.2CB7444444444p-43, 0x1.2542B00000000p-44, 0x1.2AA3ADDDDDDDEp-46, 0x1.16623B7777777p-49, 0x1.A2F5D77777777p-54, 0x1.7DFC7FDDDDDDEp-60, 0x1.A33BF06666666p-69 },
+		{ -0x1.4243777777777p-48, -0x1.689CE22222222p-45, -0x1.FA92F33333333p-44, -0x1.F81DBBBBBBBBCp-43, -0x1.AA4E622222222p-42, -0x1.483C111111111p-41, -0x1.DCFAAEEEEEEEFp-41, -0x1.4D01622222222p-40,
+		  -0x1.F1F3911111111p-43, -0x1.1EF5C88888889p-43, -0x1.75363BBBBBBBCp-45, -0x1.01CA466666666p-47, -0x1.62B9111111111p-51, -0x1.9AE3688888889p-56, -0x1.2FD16DDDDDDDEp-62, -0x1.1D777EEEEEEEFp-71 },
+		{ -0x1.A220FBBBBBBBCp-48, -0x1.D2B9111111111p-45, -0x1.482E333333333p-43, -0x1.470C9DDDDDDDEp-42, -0x1.17EB644444444p-41, -0x1.B22FA66666666p-41, -0x1.42D97BBBBBBBCp-40, -0x1.DC3B555555555p-40,
+		  -0x1.3A431BBBBBBBCp-42, -0x1.5698F77777777p-43, -0x1.94F3044444444p-45, -0x1.F1463BBBBBBBCp-48, -0x1.11FC8EEEEEEEFp-51, -0x1.F0D2888888889p-57, -0x1.010D977777777p-63, -0x1.EF61A22222222p-74 },
+		{ 0x1.C2B199999999Ap-49, 0x1.F78F555555555p-46, 0x1.62C8DDDDDDDDEp-44, 0x1.629EEEEEEEEEFp-43, 0x1.2E1A111111111p-42, 0x1.D694000000000p-42, 0x1.5D3D222222222p-41, 0x1.005FAAAAAAAABp-40,
+		  0x1.548F111111111p-43, 0x1.7929333333333p-44, 0x1.C3A4CCCCCCCCDp-46, 0x1.12F099999999Ap-48, 0x1.3F1F777777777p-52, 0x1.250ABBBBBBBBCp-57, 0x1.3A6ADDDDDDDDEp-64, 0x1.6DC2444444444p-74 },
+		{ 0x1.43D5DDDDDDDDEp-48, 0x1.6A64888888889p-45, 0x1.FDBCCCCCCCCCDp-44, 0x1.FBD0888888889p-43, 0x1.B219777777777p-42, 0x1.507FDDDDDDDDEp-41, 0x1.F36AAAAAAAAABp-41, 0x1.6EA2666666666p-40,
+		  0x1.EA2399999999Ap-43, 0x1.0C36222222222p-43, 0x1.3F8E222222222p-45, 0x1.8CD2EEEEEEEEFp-48, 0x1.C14C222222222p-52, 0x1.A552AAAAAAAABp-57, 0x1.D19ECCCCCCCCDp-64, 0x1.0F1B111111111p-73 },
+		{ -0x1.CD1999999999Ap-51, -0x1.0098888888889p-47, -0x1.69C1111111111p-46, -0x1.697DDDDDDDDDEp-45, -0x1.3401111111111p-44, -0x1.DF88888888889p-44, -0x1.63C1111111111p-43, -0x1.04EBBBBBBBBBCp-42,
+		  -0x1.5B60000000000p-45, -0x1.8182222222222p-46, -0x1.CDEEEEEEEEEEFp-48, -0x1.19BEEEEEEEEEFp-50, -0x1.4853333333333p-54, -0x1.2F81111111111p-59, -0x1.49EDDDDDDDDDEp-66, -0x1.8A82222222222p-76 },
+		{ -0x1.8A7EEEEEEEEEFp-50, -0x1.BA6AAAAAAAAABp-47, -0x1.373BBBBBBBBBCp-45, -0x1.361EEEEEEEEEFp-44, -0x1.08F4CCCCCCCCDp-43, -0x1.9B03333333333p-43, -0x1.30FCCCCCCCCCDp-42, -0x1.BFC8888888889p-42,
+		  -0x1.2B44CCCCCCCCDp-44, -0x1.47A8888888889p-45, -0x1.8667777777777p-47, -0x1.E406666666666p-50, -0x1.12F6EEEEEEEEFp-53, -0x1.012CCCCCCCCCDp-58, -0x1.1B70888888889p-65, -0x1.4A52222222222p-75 }
+	},
+	{
+		{ 0x1.5209E6BAE0386p-10, 0x1.7E9F545AB420Ep-7, 0x1.0D14B461ABB5Dp-5, 0x1.0D0721072937Fp-4, 0x1.C9D81D8EF1BFEp-4, 0x1.646613C59A78Cp-3, 0x1.085824DDE100Bp-2, 0x1.8422D93927A73p-2,
+		  0x1.112E27D43F6CBp-4, 0x1.2DE1C38E3F5B5p-5, 0x1.689AEEDB969A5p-7, 0x1.BB5B0EF5595A0p-10, 0x1.00B8FE1964A2Fp-13, 0x1.DDEDC375403FCp-19, 0x1.05C95EF07EF46p-25, 0x1.32A03BEBD4A0Bp-35 },
+		{ -0x1.75021888A2080p-15, -0x1.A6343924D625Bp-12, -0x1.28EAB4EFB58AFp-10, -0x1.28DBBA0C39536p-9, -0x1.F93516F45DD00p-9, -0x1.89447F0CD7532p-8, -0x1.23B0B55869AB2p-7, -0x1.AC49C28B9E280p-7,
+		  -0x1.2D70B8D02F1C9p-10, -0x1.4D1C6E049E3B6p-11, -0x1.8DE8C299D0BFEp-13, -0x1.E9385C19B1527p-16, -0x1.1B47BCC296A57p-19, -0x1.07AF5A23DEA70p-24, -0x1.20DE43EC9EEC1p-31, -0x1.5258AA183CB04p-41 },
+		{ 0x1.9B985566DF1D1p-20, 0x1.D1E14B7A09A56p-17, 0x1.47A1D806A7AAFp-15, 0x1.4791500FEB752p-14, 0x1.16BC269672BCDp-13, 0x1.B1F33EA6CF3F3p-13, 0x1.41DD6B9B99D17p-12, 0x1.D897EBC5AC85Bp-12,
+		  0x1.F2EF796F899C9p-16, 0x1.13AD9C7615503p-16, 0x1.494E0384D5DEDp-18, 0x1.94DFA01DB607Dp-21, 0x1.D4E19EA969185p-25, 0x1.B47336DD64CB3p-30, 0x1.DE23410DA503Fp-37, 0x1.1805AF6A9F52Cp-46 },
+		{ -0x1.C62BCBEFEE0E6p-25, -0x1.010922D451CB9p-21, -0x1.6985DD42DDBF7p-20, -0x1.697399FFD897Bp-19, -0x1.33914724CD922p-18, -0x1.DED6874A28666p-18, -0x1.63288806DD8EFp-17, -0x1.04BD12EE6BA94p-16,
+		  -0x1.CAC998C81F2DEp-21, -0x1.FAFEF5A4DD322p-22, -0x1.2ED12E708F262p-23, -0x1.7452742E9715Ap-26, -0x1.AF35A4C873B4Dp-30, -0x1.916BBB46DAEABp-35, -0x1.B7D419A445D3Cp-42, -0x1.01A936DC0664Dp-51 },
+		{ 0x1.F51FC4B8EEF77p-30, 0x1.1B9BB992D66ABp-26, 0x1.8EE59DD35C889p-25, 0x1.8ED138E7F0000p-24, 0x1.535C911EC6911p-23, 0x1.082ABA3E7CF77p-22, 0x1.87DDBB7BC5D55p-22, 0x1.1FAEA6812E800p-21,
+		  0x1.BAED613B92444p-26, 0x1.E987E00AD7777p-27, 0x1.247690FA8A444p-28, 0x1.67BFA77D65DDEp-31, 0x1.A0ED51579BDDEp-35, 0x1.8486974B81DDEp-40, 0x1.AA6B61676B99Ap-47, 0x1.F542C0E694CCDp-57 },
+		{ -0x1.145B5E1657777p-34, -0x1.38CDB02AEEEEFp-31, -0x1.B7F47E249DDDEp-30, -0x1.B7DBD6DD55555p-29, -0x1.7646054EEEEEFp-28, -0x1.23546BB464444p-27, -0x1.B0207210E0000p-27, -0x1.3D30D1F71BBBCp-26,
+		  -0x1.B78FF0B711111p-31, -0x1.E6557ADB9999Ap-32, -0x1.2335EE9977777p-33, -0x1.678AA54F22222p-36, -0x1.A310EC0908889p-40, -0x1.89F14AE99999Ap-45, -0x1.B68C8AE791111p-52, -0x1.08EBBD9180000p-61 },
+		{ 0x1.2FE05FA488889p-39, 0x1.57F0B03B77777p-36, 0x1.E3B5607A66666p-35, 0x1.E38B45659999Ap-34, 0x1.9B5CA3B155555p-33, 0x1.401A13C7BBBBCp-32, 0x1.DA8F6E1911111p-32, 0x1.5BF9F2D19999Ap-31,
+		  0x1.B947DF5DDDDDEp-36, 0x1.EBD4E92222222p-37, 0x1.2B15C3A444444p-38, 0x1.7A7A0B2000000p-41, 0x1.C9A03D9222222p-45, 0x1.C5DDAAFEEEEEFp-50, 0x1.1201499000000p-56, 0x1.7C91BCB888889p-66 },
+		{ -0x1.3C3D5D5555555p-44, -0x1.65E72D3333333p-41, -0x1.F70AE84444444p-40, -0x1.F67C7C8888889p-39, -0x1.AAF9D8CCCCCCDp-38, -0x1.4BA9E35555555p-37, -0x1.EA29BB3333333p-37, -0x1.651612EEEEEEFp-36,
+		  -0x1.60185BBBBBBBCp-41, -0x1.9D09A11111111p-42, -0x1.17B64AAAAAAABp-43, -0x1.9849688888889p-46, -0x1.270E0BBBBBBBCp-49, -0x1.673CF33333333p-54, -0x1.126E9CCCCCCCDp-60, -0x1.FB6ED91111111p-70 },
+		{ 0x1.96B1E88888889p-48, 0x1.CAF6822222222p-45, 0x1.4449611111111p-43, 0x1.418E300000000p-42, 0x1.127E522222222p-41, 0x1.A7A60EEEEEEEFp-41, 0x1.3810533333333p-40, 0x1.C27A888888889p-40,
+		  0x1.AB73888888889p-43, 0x1.EEDF666666666p-44, 0x1.34978CCCCCCCDp-45, 0x1.B02A555555555p-48, 0x1.1E1AB88888889p-51, 0x1.442A788888889p-56, 0x1.CB485BBBBBBBCp-63, 0x1.8989233333333p-72 },
+		{ -0x1.3973888888889p-48, -0x1.617F955555555p-45, -0x1.F2DE222222222p-44, -0x1.F2C7EAAAAAAABp-43, -0x1.A7E6EEEEEEEEFp-42, -0x1.490ED55555555p-41, -0x1.E765333333333p-41, -0x1.6505EAAAAAAABp-40,
+		  -0x1.E8A9444444444p-43, -0x1.1369DDDDDDDDEp-43, -0x1.44D01DDDDDDDEp-45, -0x1.99A57BBBBBBBCp-48, -0x1.E25A2AAAAAAABp-52, -0x1.D43AEEEEEEEEFp-57, -0x1.1222400000000p-63, -0x1.5EFDAAAAAAAABp-73 },
+		{ -0x1.7B14C88888889p-48, -0x1.AACA2EEEEEEEFp-45, -0x1.2EADB11111111p-43, -0x1.2BA82CCCCCCCDp-42, -0x1.019AD77777777p-41, -0x1.8E9DC00000000p-41, -0x1.283B955555555p-40, -0x1.B31D111111111p-40,
+		  -0x1.2D42D55555555p-42, -0x1.5077D55555555p-43, -0x1.87396EEEEEEEFp-45, -0x1.F061777777777p-48, -0x1.1B12ACCCCCCCDp-51, -0x1.09C83DDDDDDDEp-56, -0x1.242959999999Ap-63, -0x1.52FD044444444p-73 },
+		{ 0x1.9E5C444444444p-49, 0x1.D318222222222p-46, 0x1.49BB777777777p-44, 0x1.49F0777777777p-43, 0x1.1863BBBBBBBBCp-42, 0x1.B3A7777777777p-42, 0x1.4320CCCCCCCCDp-41, 0x1.DB25BBBBBBBBCp-41,
+		  0x1.466199999999Ap-43, 0x1.6F3B777777777p-44, 0x1.AB6C222222222p-46, 0x1.0A29222222222p-48, 0x1.321DBBBBBBBBCp-52, 0x1.1F9C888888889p-57, 0x1.3FF9333333333p-64, 0x1.6BAB777777777p-74 },
+		{ 0x1.28AD555555555p-48, 0x1.4DCE666666666p-45, 0x1.D8E1777777777p-44, 0x1.D476000000000p-43, 0x1.9297555555555p-42, 0x1.378B111111111p-41, 0x1.CEE3BBBBBBBBCp-41, 0x1.53CD99999999Ap-40,
+		  0x1.D743777777777p-43, 0x1.067E222222222p-43, 0x1.329AAAAAAAAABp-45, 0x1.84D2AAAAAAAABp-48, 0x1.BBC8EEEEEEEEFp-52, 0x1.A1A0AAAAAAAABp-57, 0x1.CE12222222222p-64, 0x1.0F92444444444p-73 },
+		{ -0x1.A737777777777p-51, -0x1.DCD7777777777p-48, -0x1.50AAAAAAAAAABp-46, -0x1.510DDDDDDDDDEp-45, -0x1.1E37777777777p-44, -0x1.BC9999999999Ap-44, -0x1.49B5555555555p-43, -0x1.E4F5555555555p-43,
+		  -0x1.4CE2222222222p-45, -0x1.77B3333333333p-46, -0x1.B33DDDDDDDDDEp-48, -0x1.0FC3333333333p-50, -0x1.386EEEEEEEEEFp-54, -0x1.266AAAAAAAAABp-59, -0x1.49AAAAAAAAAABp-66, -0x1.7588888888889p-76 },
+		{ -0x1.6AA999999999Ap-50, -0x1.97EDDDDDDDDDEp-47, -0x1.20AA222222222p-45, -0x1.1E1E666666666p-44, -0x1.EBABBBBBBBBBCp-44, -0x1.7C8DDDDDDDDDEp-43, -0x1.1AADDDDDDDDDEp-42, -0x1.9F04444444444p-42,
+		  -0x1.1FECCCCCCCCCDp-44, -0x1.3FF999999999Ap-45, -0x1.76ECCCCCCCCCDp-47, -0x1.DA9DDDDDDDDDEp-50, -0x1.0E7E666666666p-53, -0x1.FCC999999999Ap-59, -0x1.197CCCCCCCCCDp-65, -0x1.4A96666666666p-75 }
+	},
+	{
+		{ 0x1.3C3ACF98C573Fp-10, 0x1.65EFE391C6956p-7, 0x1.F7710F70E522Dp-6, 0x1.F757A92ACDE53p-5, 0x1.AC4E4D37487BAp-4, 0x1.4D67BFEDDD4EEp-3, 0x1.EE946607ED4A3p-3, 0x1.6B18579D8A587p-2,
+		  0x1.08389B0AF96FFp-4, 0x1.23FB3E2CFE9C6p-5, 0x1.5CC762ECFF204p-7, 0x1.ACD0C2A4D8782p-10, 0x1.F09B3BBA1DC95p-14, 0x1.CE4132D2E8753p-19, 0x1.FA66F517A992Bp-26, 0x1.2891E1D6BE165p-35 },
+		{ -0x1.466E419E65443p-15, -0x1.717BC19617C76p-12, -0x1.03D741C073ED5p-10, -0x1.03CA25BD1B826p-9, -0x1.BA1F476772D6Dp-9, -0x1.58290825D5171p-8, -0x1.FE88AB5372928p-8, -0x1.76CECE008A46Ep-7,
+		  -0x1.10BE8F81CFD22p-10, -0x1.2D6671BD2DC35p-11, -0x1.6807A003FECD5p-13, -0x1.BAA5F27D5C327p-16, -0x1.00501F2163B01p-19, -0x1.DD2A88032ED1Dp-25, -0x1.055E6EDD6C5D2p-31, -0x1.3222FB6F6D935p-41 },
+		{ 0x1.50F5F0783CB49p-20, 0x1.7D66F8989ACCBp-17, 0x1.0C39098104A20p-15, 0x1.0C2B8136B516Dp-14, 0x1.C862592F94E27p-14, 0x1.63432051C152Ap-13, 0x1.078057B742652p-12, 0x1.82E5FCB49BBFAp-12,
+		  0x1.A650591C0CB02p-16, 0x1.D2AF2424C7158p-17, 0x1.16BB96C59850Fp-18, 0x1.56B20C67747F4p-21, 0x1.8CDF35E4CF6FAp-25, 0x1.716B564C69B7Fp-30, 0x1.94B36900A53DAp-37, 0x1.DA04F15AE2C51p-47 },
+		{ -0x1.5BD48A908F544p-25, -0x1.89B491704F91Ap-22, -0x1.14E001228E1A5p-20, -0x1.14D208CCADDD5p-19, -0x1.D71B22BDAC513p-19, -0x1.6EB8DA2AABABCp-18, -0x1.10004F87768D2p-17, -0x1.8F60F1A9CE7E0p-17,
+		  -0x1.6B47CFAB46840p-21, -0x1.9172E5CE7CA00p-22, -0x1.DF8A8D53EF0A2p-24, -0x1.26CB153564E73p-26, -0x1.5565FEC97576Bp-30, -0x1.3DC90248D5BB3p-35, -0x1.5C23A1FA7AE22p-42, -0x1.97C72A4BBA6DEp-52 },
+		{ 0x1.670C7E04F1111p-30, 0x1.96674B17233BCp-27, 0x1.1DCE153D7A911p-25, 0x1.1DBFA61FAA444p-24, 0x1.E64CDDD1D6444p-24, 0x1.7A8CAF942EA22p-23, 0x1.18C6088DC9E66p-22, 0x1.9C42316251DDEp-22,
+		  0x1.481F39DE4EEEFp-26, 0x1.6A99A4ACDB555p-27, 0x1.B125275FB0AABp-29, 0x1.0A480EDEB1777p-31, 0x1.3465708DC0666p-35, 0x1.1F170D8DC599Ap-40, 0x1.3A8E232263BBCp-47, 0x1.708964C730AABp-57 },
+		{ -0x1.729FA29B11111p-35, -0x1.A38128E684444p-32, -0x1.2704A08BBBBBCp-30, -0x1.26F59B7066666p-29, -0x1.F5F96B7A55555p-29, -0x1.86BFC9A1AAAABp-28, -0x1.21D1FFC4F7777p-27, -0x1.A989653CBBBBCp-27,
+		  -0x1.30D7ADCC33333p-31, -0x1.50E895DCC4444p-32, -0x1.928A5D51CCCCDp-34, -0x1.EF1B4F5BEEEEFp-37, -0x1.1EDBE37C44444p-40, -0x1.0B42132BE6666p-45, -0x1.2536630233333p-52, -0x1.586634A055555p-62 },
+		{ 0x1.7E2B0E119999Ap-40, 0x1.B09207D444444p-37, 0x1.3034D34A66666p-35, 0x1.30243357BBBBCp-34, 0x1.02CBDADC00000p-33, 0x1.92E500B222222p-33, 0x1.2AD089E044444p-32, 0x1.B6B3FB0EEEEEFp-32,
+		  0x1.1F57710000000p-36, 0x1.3DD232C99999Ap-37, 0x1.7C5C194444444p-39, 0x1.D5189FFBBBBBCp-42, 0x1.10E5EDCBBBBBCp-45, 0x1.FFB0F94AAAAABp-51, 0x1.1B8E99599999Ap-57, 0x1.53833C2222222p-67 },
+		{ -0x1.6FD36DDDDDDDEp-45, -0x1.A0CED26666666p-42, -0x1.2522166666666p-40, -0x1.24FF95999999Ap-39, -0x1.F2A6011111111p-39, -0x1.83FE751111111p-38, -0x1.1FAFED1111111p-37, -0x1.A61F480000000p-37,
+		  -0x1.7CE7BDDDDDDDEp-42, -0x1.A8A34CCCCCCCDp-43, -0x1.0290E77777777p-44, -0x1.45B1444444444p-47, -0x1.89A8933333333p-51, -0x1.878B6CCCCCCCDp-56, -0x1.D7A5000000000p-63, -0x1.42EBB88888889p-72 },
+		{ 0x1.45754EEEEEEEFp-48, 0x1.7029155555555p-45, 0x1.018D5CCCCCCCDp-43, 0x1.01FFDEEEEEEEFp-42, 0x1.B6274EEEEEEEFp-42, 0x1.5525377777777p-41, 0x1.F9C0022222222p-41, 0x1.72D7622222222p-40,
+		  0x1.90E52AAAAAAABp-43, 0x1.B94D600000000p-44, 0x1.098FF33333333p-45, 0x1.45F00CCCCCCCDp-48, 0x1.80951BBBBBBBCp-52, 0x1.709D600000000p-57, 0x1.9F27333333333p-64, 0x1.010C155555555p-73 },
+		{ -0x1.298D777777777p-48, -0x1.4A0AC44444444p-45, -0x1.CF52C88888889p-44, -0x1.D093000000000p-43, -0x1.8A2C8CCCCCCCDp-42, -0x1.33F9C44444444p-41, -0x1.C865155555555p-41, -0x1.4E9BF33333333p-40,
+		  -0x1.DBBD733333333p-43, -0x1.06A8800000000p-43, -0x1.387BAEEEEEEEFp-45, -0x1.8560C88888889p-48, -0x1.C2FC8CCCCCCCDp-52, -0x1.9DFD19999999Ap-57, -0x1.C39F666666666p-64, -0x1.0FF3DDDDDDDDEp-73 },
+		{ -0x1.6483488888889p-48, -0x1.93174CCCCCCCDp-45, -0x1.19880EEEEEEEFp-43, -0x1.1A45244444444p-42, -0x1.DF816AAAAAAABp-42, -0x1.7535666666666p-41, -0x1.14CE022222222p-40, -0x1.969ACCCCCCCCDp-40,
+		  -0x1.242DCCCCCCCCDp-42, -0x1.406579999999Ap-43, -0x1.8063088888889p-45, -0x1.D1B7D55555555p-48, -0x1.0E33022222222p-51, -0x1.FCC5488888889p-57, -0x1.15E4DDDDDDDDEp-63, -0x1.3E68444444444p-73 },
+		{ 0x1.8BDF777777777p-49, 0x1.B4E3333333333p-46, 0x1.3277EEEEEEEEFp-44, 0x1.3385111111111p-43, 0x1.04C2BBBBBBBBCp-42, 0x1.97F6EEEEEEEEFp-42, 0x1.2E45EEEEEEEEFp-41, 0x1.BB1B555555555p-41,
+		  0x1.3DC4333333333p-43, 0x1.5EA8888888889p-44, 0x1.A056444444444p-46, 0x1.03F9000000000p-48, 0x1.2C7DEEEEEEEEFp-52, 0x1.1171333333333p-57, 0x1.276F333333333p-64, 0x1.6324888888889p-74 },
+		{ 0x1.1691333333333p-48, 0x1.3AFB99999999Ap-45, 0x1.B832444444444p-44, 0x1.B949333333333p-43, 0x1.7704EEEEEEEEFp-42, 0x1.23B4AAAAAAAABp-41, 0x1.B0B0666666666p-41, 0x1.3DDDDDDDDDDDEp-40,
+		  0x1.C8BCCCCCCCCCDp-43, 0x1.F4BC222222222p-44, 0x1.2CDF555555555p-45, 0x1.6C26666666666p-48, 0x1.A600666666666p-52, 0x1.8E20222222222p-57, 0x1.B511111111111p-64, 0x1.F34599999999Ap-74 },
+		{ -0x1.969999999999Ap-51, -0x1.BE11111111111p-48, -0x1.38ABBBBBBBBBCp-46, -0x1.3A00000000000p-45, -0x1.0A0BBBBBBBBBCp-44, -0x1.A0D1111111111p-44, -0x1.34C7777777777p-43, -0x1.C45BBBBBBBBBCp-43,
+		  -0x1.4492222222222p-45, -0x1.6617777777777p-46, -0x1.A868888888889p-48, -0x1.0A36666666666p-50, -0x1.33ADDDDDDDDDEp-54, -0x1.15F7777777777p-59, -0x1.2A8CCCCCCCCCDp-66, -0x1.6A95555555555p-76 },
+		{ -0x1.53F0000000000p-50, -0x1.807DDDDDDDDDEp-47, -0x1.0CC5DDDDDDDDEp-45, -0x1.0D69111111111p-44, -0x1.CA12222222222p-44, -0x1.642AAAAAAAAABp-43, -0x1.0824CCCCCCCCDp-42, -0x1.842AAAAAAAAABp-42,
+		  -0x1.16D999999999Ap-44, -0x1.31B199999999Ap-45, -0x1.6FB5555555555p-47, -0x1.BCC2222222222p-50, -0x1.0173BBBBBBBBCp-53, -0x1.E638888888889p-59, -0x1.0BBBBBBBBBBBCp-65, -0x1.30FBBBBBBBBBCp-75 }
+	},
+	{
+		{ 0x1.29107570A0455p-10, 0x1.503E70EDF42BAp-7, 0x1.D8EE164380446p-6, 0x1.D8D63A112E4D3p-5, 0x1.9259123BE83F0p-4, 0x1.3932EA99CF892p-3, 0x1.D09AEB7C1AD98p-3, 0x1.5516DDF15631Ep-2,
+		  0x1.0016DB0E7EC3Ap-4, 0x1.1AFEC64A9E6DBp-5, 0x1.520B6BE7442A4p-7, 0x1.9F9E339516F92p-10, 0x1.E1528FEFE290Bp-14, 0x1.C0072DA016B3Dp-19, 0x1.EAD11B640D752p-26, 0x1.1F71432B1FCBEp-35 },
+		{ -0x1.200FF5C22BDF5p-15, -0x1.460E00E650886p-12, -0x1.CA994BE3C01A0p-11, -0x1.CA8228CA3585Fp-10, -0x1.8627D39E60A17p-9, -0x1.2FB54094AEEA1p-8, -0x1.C286B5CCEB4D6p-8, -0x1.4AC0D736F4239p-7,
+		  -0x1.F0A872882B094p-11, -0x1.126B6AF325870p-11, -0x1.47CD03CA32A4Bp-13, -0x1.9306037CEC7BCp-16, -0x1.D2BCAAA2F842Fp-20, -0x1.B2739123F2C1Ap-25, -0x1.DBF18F036AEA6p-32, -0x1.16BB6802A025Ap-41 },
+		{ 0x1.17554B5DF649Ap-20, 0x1.3C2C9BFBD9A8Cp-17, 0x1.BCB3AE6183075p-16, 0x1.BC9D3EC468C52p-15, 0x1.7A552A3E7D000p-14, 0x1.268136D28A421p-13, 0x1.B4DFB7FA444B6p-13, 0x1.40BAFF2D72519p-12,
+		  0x1.6934B055DFE77p-16, 0x1.8F27E16737C5Ep-17, 0x1.DCCD1D01F0024p-19, 0x1.251BA5C781987p-21, 0x1.5371F131A5DA4p-25, 0x1.3BF6F65B0E79Ep-30, 0x1.5A240D06A4FB1p-37, 0x1.956DB2CFF0B2Cp-47 },
+		{ -0x1.0EDE57F81F442p-25, -0x1.3297DC5B2AC09p-22, -0x1.AF39DE5EFEC00p-21, -0x1.AF241CC705344p-20, -0x1.6EDE378ACF113p-19, -0x1.1D94917A88026p-18, -0x1.A7A2A1A30BFCBp-18, -0x1.3702E6DF2A3CBp-17,
+		  -0x1.23E22B2B7ACD1p-21, -0x1.428CD53973195p-22, -0x1.814B4159C7777p-24, -0x1.D9B5C5BEC79F7p-27, -0x1.124C9A5A9DED1p-30, -0x1.FEA68B46364A2p-36, -0x1.17B5D36464E40p-42, -0x1.479EB946F02C9p-52 },
+		{ 0x1.06A90B978419Ap-30, 0x1.294D6C656D111p-27, 0x1.A228932213889p-26, 0x1.A2137A001BEEFp-25, 0x1.63C02F9FDDAABp-24, 0x1.14ED22E06FF77p-23, 0x1.9ACC36796B777p-23, 0x1.2D962CC0A1BBCp-22,
+		  0x1.EF5140ECC2222p-27, 0x1.11ADD9C66A444p-27, 0x1.46EAB92AB8444p-29, 0x1.91F0177D17BBCp-32, 0x1.D17B5690A0889p-36, 0x1.B14933D3A7BBCp-41, 0x1.DAABFB874A666p-48, 0x1.15FE2328EA000p-57 },
+		{ -0x1.FD6A902088889p-36, -0x1.204D2FBEE2222p-32, -0x1.957FA02566666p-31, -0x1.956B28C004444p-30, -0x1.58FAE65F3BBBCp-29, -0x1.0C8AC7291999Ap-28, -0x1.8E5C378D5DDDEp-28, -0x1.24749436C0000p-27,
+		  -0x1.B05478B688889p-32, -0x1.DDC1C7389999Ap-33, -0x1.1D59FF7011111p-34, -0x1.5ED81DCF88889p-37, -0x1.9654134A11111p-41, -0x1.7A3F605044444p-46, -0x1.9E6B20CD88889p-53, -0x1.E581DBC555555p-63 },
+		{ 0x1.ED7083E444444p-41, 0x1.1740C5AAAAAABp-37, 0x1.88C56D7911111p-36, 0x1.88B0D78DDDDDEp-35, 0x1.4E27153D55555p-34, 0x1.041C29B5DDDDEp-33, 0x1.81D9A30777777p-33, 0x1.1B453DE333333p-32,
+		  0x1.7E6F589DDDDDEp-37, 0x1.A6B0C8D555555p-38, 0x1.F8ECDD4000000p-40, 0x1.3683DE6666666p-42, 0x1.67ADAA3BBBBBCp-46, 0x1.4F17266CCCCCDp-51, 0x1.6F9853C000000p-58, 0x1.AF38174AAAAABp-68 },
+		{ -0x1.AEF81B3333333p-46, -0x1.E7345CCCCCCCDp-43, -0x1.56C0E5DDDDDDEp-41, -0x1.569976EEEEEEFp-40, -0x1.23A29C0000000p-39, -0x1.C5BCC6EEEEEEFp-39, -0x1.508A43BBBBBBCp-38, -0x1.EE3EFDDDDDDDEp-38,
+		  -0x1.6BA0D9999999Ap-43, -0x1.91E34CCCCCCCDp-44, -0x1.E22AF33333333p-46, -0x1.286D200000000p-48, -0x1.56B0C00000000p-52, -0x1.4AD9400000000p-57, -0x1.78B9266666666p-64, -0x1.B5B0511111111p-74 },
+		{ 0x1.057A800000000p-48, 0x1.2D57111111111p-45, 0x1.A7E5DBBBBBBBCp-44, 0x1.A97F333333333p-43, 0x1.67BC8AAAAAAABp-42, 0x1.1A1FE44444444p-41, 0x1.A2BB844444444p-41, 0x1.327ADDDDDDDDEp-40,
+		  0x1.7853377777777p-43, 0x1.990A666666666p-44, 0x1.F4F9377777777p-46, 0x1.2E0E333333333p-48, 0x1.6BD7C44444444p-52, 0x1.45A3B11111111p-57, 0x1.4F2B2AAAAAAABp-64, 0x1.A635D33333333p-74 },
+		{ -0x1.0D57155555555p-48, -0x1.349C111111111p-45, -0x1.B0B2CCCCCCCCDp-44, -0x1.B1C1222222222p-43, -0x1.6F87622222222p-42, -0x1.200919999999Ap-41, -0x1.AB250CCCCCCCDp-41, -0x1.38AA400000000p-40,
+		  -0x1.CB1D488888889p-43, -0x1.FC63EAAAAAAABp-44, -0x1.2E68E66666666p-45, -0x1.76129DDDDDDDEp-48, -0x1.B5D2488888889p-52, -0x1.882A511111111p-57, -0x1.9DC8EAAAAAAABp-64, -0x1.FD9A955555555p-74 },
+		{ -0x1.433ECCCCCCCCDp-48, -0x1.7651C44444444p-45, -0x1.07346CCCCCCCDp-43, -0x1.084F6EEEEEEEFp-42, -0x1.BE998CCCCCCCDp-42, -0x1.5E91266666666p-41, -0x1.0431377777777p-40, -0x1.7CC8088888889p-40,
+		  -0x1.1AEC266666666p-42, -0x1.3405666666666p-43, -0x1.781C6AAAAAAABp-45, -0x1.C528777777777p-48, -0x1.105A3BBBBBBBCp-51, -0x1.E81CD9999999Ap-57, -0x1.F6D1BBBBBBBBCp-64, -0x1.39A7533333333p-73 },
+		{ 0x1.6524AAAAAAAABp-49, 0x1.9A13BBBBBBBBCp-46, 0x1.1F7EEEEEEEEEFp-44, 0x1.2060CCCCCCCCDp-43, 0x1.E83B555555555p-43, 0x1.7F30444444444p-42, 0x1.1C1D888888889p-41, 0x1.9FAECCCCCCCCDp-41,
+		  0x1.32A0111111111p-43, 0x1.53EE111111111p-44, 0x1.9380000000000p-46, 0x1.F43B99999999Ap-49, 0x1.2560111111111p-52, 0x1.0476555555555p-57, 0x1.103D000000000p-64, 0x1.52BFAAAAAAAABp-74 },
+		{ 0x1.FA0D99999999Ap-49, 0x1.24C7333333333p-45, 0x1.9BA9333333333p-44, 0x1.9D37333333333p-43, 0x1.5D59777777777p-42, 0x1.11FDDDDDDDDDEp-41, 0x1.96AEAAAAAAAABp-41, 0x1.29B0444444444p-40,
+		  0x1.BA1AEEEEEEEEFp-43, 0x1.E26599999999Ap-44, 0x1.259E444444444p-45, 0x1.6201DDDDDDDDEp-48, 0x1.A875555555555p-52, 0x1.7DC8AAAAAAAABp-57, 0x1.8BA0CCCCCCCCDp-64, 0x1.EA3D777777777p-74 },
+		{ -0x1.6B64444444444p-51, -0x1.A27BBBBBBBBBCp-48, -0x1.2566666666666p-46, -0x1.2686666666666p-45, -0x1.F213333333333p-45, -0x1.879999999999Ap-44, -0x1.2256666666666p-43, -0x1.A875555555555p-43,
+		  -0x1.38E1111111111p-45, -0x1.5B65555555555p-46, -0x1.9B3BBBBBBBBBCp-48, -0x1.FF4EEEEEEEEEFp-51, -0x1.2CABBBBBBBBBCp-54, -0x1.080DDDDDDDDDEp-59, -0x1.10CBBBBBBBBBCp-66, -0x1.5834444444444p-76 },
+		{ -0x1.3562222222222p-50, -0x1.65A8888888889p-47, -0x1.F6D4444444444p-46, -0x1.F89999999999Ap-45, -0x1.AAD2222222222p-44, -0x1.4E8999999999Ap-43, -0x1.F082222222222p-43, -0x1.6B8AAAAAAAAABp-42,
+		  -0x1.0DD6666666666p-44, -0x1.26F7777777777p-45, -0x1.6634444444444p-47, -0x1.B01DDDDDDDDDEp-50, -0x1.0286666666666p-53, -0x1.D25CCCCCCCCCDp-59, -0x1.E58CCCCCCCCCDp-66, -0x1.2B4199999999Ap-75 }
+	},
+	{
+		{ 0x1.1816D5210DF0Bp-10, 0x1.3D07AC4E14289p-7, 0x1.BDE7CBD9415E2p-6, 0x1.BDD14CB1200F4p-5, 0x1.7B5B4BB4D65ADp-4, 0x1.274D439858314p-3, 0x1.B60E68FFFFAD0p-3, 0x1.419937A90B31Fp-2,
+		  0x1.F154633DB0058p-5, 0x1.12CA6B9A59831p-5, 0x1.483E7F649E163p-7, 0x1.939189BF9E56Bp-10, 0x1.D35E3F89CBDB3p-14, 0x1.B309F8B117706p-19, 0x1.DC9653CCAC475p-26, 0x1.171BE6C4AFFCBp-35 },
+		{ -0x1.0014E01E34605p-15, -0x1.21DB21316CA7Fp-12, -0x1.97AF5B4A436DFp-11, -0x1.979AC9C67C8A1p-10, -0x1.5AD720A54FE53p-9, -0x1.0DFD7FA1356AFp-8, -0x1.9082341D38FD2p-8, -0x1.26086D6753787p-7,
+		  -0x1.C6B38DEF3BD0Ap-11, -0x1.F679744D743C8p-12, -0x1.2C1BE2302AC57p-13, -0x1.70FA178ACC23Cp-16, -0x1.AB4EDB0205800p-20, -0x1.8DBFF9520D98Bp-25, -0x1.B3BCA4646E542p-32, -0x1.FE5EE7D02FE37p-42 },
+		{ 0x1.D4436DED2BA26p-21, 0x1.0902DC846F98Ep-17, 0x1.74BD954A76A24p-16, 0x1.74AAC71B1AC06p-15, 0x1.3D1C759DC6A35p-14, 0x1.EDB248761E429p-14, 0x1.6E2DE680374ACp-13, 0x1.0CD48147C56F3p-12,
+		  0x1.37CB9486084E8p-16, 0x1.588DCC180014Fp-17, 0x1.9B93F461F1B1Ep-19, 0x1.FA0686B7DBDA2p-22, 0x1.2502DF5AD5875p-25, 0x1.10BE275C84D0Dp-30, 0x1.2ACA7F74A66EDp-37, 0x1.5DF7EF9DCEF5Ap-47 },
+		{ -0x1.AC20644D66957p-26, -0x1.E497845FD17EBp-23, -0x1.54CA96F60CE4Dp-21, -0x1.54B9656B54CBEp-20, -0x1.21EE224060C20p-19, -0x1.C3612C15C0B7Ep-19, -0x1.4ECAE133DB4E4p-18, -0x1.EB933547A38E2p-18,
+		  -0x1.DB1DD58884F09p-22, -0x1.06846A77CEA26p-22, -0x1.39954C5022866p-24, -0x1.818B1168E65D5p-27, -0x1.BE7E48D019F33p-31, -0x1.9F9BAB0AB45BCp-36, -0x1.C74CF5BAE16C4p-43, -0x1.0AA488C48741Ep-52 },
+		{ 0x1.876E16CCEC99Ap-31, 0x1.BB0E34B5CAAABp-28, 0x1.3794AAA621CCDp-26, 0x1.3784F259C0444p-25, 0x1.09143F6BB2E66p-24, 0x1.9CB0A1B64EBBCp-24, 0x1.32189695A5666p-23, 0x1.C170AA4759555p-23,
+		  0x1.7C17EE425D555p-27, 0x1.A407242B70CCDp-28, 0x1.F5BBC8471D99Ap-30, 0x1.346F558782CCDp-32, 0x1.6531F1A2A5555p-36, 0x1.4C7CAD38A6222p-41, 0x1.6C3DC835C8000p-48, 0x1.AAA13C06A1DDEp-58 },
+		{ -0x1.65E4EAB862222p-36, -0x1.9518BC7E88889p-33, -0x1.1CE2D0A308889p-31, -0x1.1CD4713811111p-30, -0x1.E4BC9E2D80000p-30, -0x1.7955293E11111p-29, -0x1.17DF0620C4444p-28, -0x1.9AEF2697A2222p-28,
+		  -0x1.38D0FE3277777p-32, -0x1.59AEC5DD9999Ap-33, -0x1.9CED410555555p-35, -0x1.FBAF55E822222p-38, -0x1.25F90F91CCCCDp-41, -0x1.11A3C1B644444p-46, -0x1.2BC6C1C466666p-53, -0x1.5F20A792CCCCDp-63 },
+		{ 0x1.46B736F800000p-41, 0x1.71CC810444444p-38, 0x1.0410651AAAAABp-36, 0x1.0403AB1A22222p-35, 0x1.BA7FD94000000p-35, 0x1.58743EB19999Ap-34, 0x1.FEF7C49AAAAABp-34, 0x1.7720996000000p-33,
+		  0x1.0464D4CCCCCCDp-37, 0x1.1FC1174000000p-38, 0x1.57B7972666666p-40, 0x1.A69317B777777p-43, 0x1.E96BFC0888889p-47, 0x1.C7A8092EEEEEFp-52, 0x1.F34DD01555555p-59, 0x1.2467A31DDDDDEp-68 },
+		{ -0x1.FB338BBBBBBBCp-47, -0x1.1F157EEEEEEEFp-43, -0x1.93D0255555555p-42, -0x1.93B4044444444p-41, -0x1.57803DDDDDDDEp-40, -0x1.0B69880000000p-39, -0x1.8CB2EBBBBBBBCp-39, -0x1.233B45DDDDDDEp-38,
+		  -0x1.FA64888888889p-45, -0x1.1691777777777p-45, -0x1.4F59DDDDDDDDEp-47, -0x1.9A9EB33333333p-50, -0x1.E2B3000000000p-54, -0x1.BDCE222222222p-59, -0x1.E3A6111111111p-66, -0x1.1CA9EEEEEEEEFp-75 },
+		{ 0x1.C78A133333333p-49, 0x1.057AEEEEEEEEFp-45, 0x1.6EB4511111111p-44, 0x1.6D611BBBBBBBCp-43, 0x1.38CE7BBBBBBBCp-42, 0x1.E701A44444444p-42, 0x1.69D7422222222p-41, 0x1.092FA66666666p-40,
+		  0x1.64C6CCCCCCCCDp-43, 0x1.89C9377777777p-44, 0x1.DA750CCCCCCCDp-46, 0x1.2582822222222p-48, 0x1.5276400000000p-52, 0x1.341CFDDDDDDDEp-57, 0x1.480ACAAAAAAABp-64, 0x1.8AEFB77777777p-74 },
+		{ -0x1.FFAC8CCCCCCCDp-49, -0x1.2174622222222p-45, -0x1.9690888888889p-44, -0x1.96B1F33333333p-43, -0x1.5A43400000000p-42, -0x1.0D7D755555555p-41, -0x1.8FB3733333333p-41, -0x1.255CD11111111p-40,
+		  -0x1.BDD6FBBBBBBBCp-43, -0x1.ED5059999999Ap-44, -0x1.2578333333333p-45, -0x1.6A7FF33333333p-48, -0x1.A0A7111111111p-52, -0x1.8458CCCCCCCCDp-57, -0x1.AA44955555555p-64, -0x1.F54AC88888889p-74 },
+		{ -0x1.328E9BBBBBBBCp-48, -0x1.6196C44444444p-45, -0x1.EFAA088888889p-44, -0x1.ED9C488888889p-43, -0x1.A6E2EEEEEEEEFp-42, -0x1.493D2CCCCCCCDp-41, -0x1.E953C88888889p-41, -0x1.6688911111111p-40,
+		  -0x1.1192088888889p-42, -0x1.2DBC955555555p-43, -0x1.6C05733333333p-45, -0x1.C16CC88888889p-48, -0x1.039C6AAAAAAABp-51, -0x1.D89EA66666666p-57, -0x1.F6C9C88888889p-64, -0x1.2EB1488888889p-73 },
+		{ 0x1.5523888888889p-49, 0x1.820E444444444p-46, 0x1.0ED6AAAAAAAABp-44, 0x1.0EF3000000000p-43, 0x1.CD86CCCCCCCCDp-43, 0x1.6743EEEEEEEEFp-42, 0x1.0A71CCCCCCCCDp-41, 0x1.86FE888888889p-41,
+		  0x1.2A2D444444444p-43, 0x1.49C9222222222p-44, 0x1.87E5DDDDDDDDEp-46, 0x1.E588666666666p-49, 0x1.1659DDDDDDDDEp-52, 0x1.02F8888888889p-57, 0x1.1B81888888889p-64, 0x1.4ECF666666666p-74 },
+		{ 0x1.DEAF555555555p-49, 0x1.146F333333333p-45, 0x1.8384CCCCCCCCDp-44, 0x1.81F6888888889p-43, 0x1.4A92888888889p-42, 0x1.015CBBBBBBBBCp-41, 0x1.7E75777777777p-41, 0x1.1842EEEEEEEEFp-40,
+		  0x1.AB95DDDDDDDDEp-43, 0x1.D76E666666666p-44, 0x1.1C8AEEEEEEEEFp-45, 0x1.5EB3BBBBBBBBCp-48, 0x1.959C888888889p-52, 0x1.71C0AAAAAAAABp-57, 0x1.89E2000000000p-64, 0x1.D97CCCCCCCCCDp-74 },
+		{ -0x1.5C85555555555p-51, -0x1.8A7999999999Ap-48, -0x1.146AAAAAAAAABp-46, -0x1.148BBBBBBBBBCp-45, -0x1.D742222222222p-45, -0x1.6EE3333333333p-44, -0x1.101EEEEEEEEEFp-43, -0x1.8F31111111111p-43,
+		  -0x1.3094444444444p-45, -0x1.50BEEEEEEEEEFp-46, -0x1.8F91111111111p-48, -0x1.F0C6666666666p-51, -0x1.1BE8888888889p-54, -0x1.07C4444444444p-59, -0x1.1FFCCCCCCCCCDp-66, -0x1.55A3333333333p-76 },
+		{ -0x1.2413BBBBBBBBCp-50, -0x1.519BBBBBBBBBCp-47, -0x1.D946666666666p-46, -0x1.D774444444444p-45, -0x1.93B3333333333p-44, -0x1.3A44CCCCCCCCDp-43, -0x1.D2FAAAAAAAAABp-43, -0x1.563DDDDDDDDDEp-42,
+		  -0x1.050AAAAAAAAABp-44, -0x1.1FBEEEEEEEEEFp-45, -0x1.5B76666666666p-47, -0x1.ABB6666666666p-50, -0x1.EEF1111111111p-54, -0x1.C3F2222222222p-59, -0x1.E247777777777p-66, -0x1.214999999999Ap-75 }
+	},
+	{
+		{ 0x1.08F300F5C1292p-10, 0x1.2BE4A9E8FE67Ep-7, 0x1.A5CD6DCD83286p-6, 0x1.A5B825F3A8D7Dp-5, 0x1.66D9D1FE16FF9p-4, 0x1.1756ECEA0E563p-3, 0x1.9E60A883757A4p-3, 0x1.3036FD4CE1368p-2,
+		  0x1.E3B39A8246DA2p-5, 0x1.0B42C11A84804p-5, 0x1.3F3FDAA1D5D15p-7, 0x1.88827DCFCEC99p-10, 0x1.C68FA5178812Fp-14, 0x1.A71E289AC17A2p-19, 0x1.CF870D5197DFEp-26, 0x1.0F75F1482495Ap-35 },
+		{ -0x1.CA4A62867E8ACp-16, -0x1.035DFABBAB97Bp-12, -0x1.6CCD580BAFB24p-11, -0x1.6CBAF06407A1Cp-10, -0x1.365B852EC7C1Ep-9, -0x1.E32E92E0F6240p-9, -0x1.66616F2595F54p-8, -0x1.071ACD3B9240Ap-7,
+		  -0x1.A25624C3B34BCp-11, -0x1.CE49F41232355p-12, -0x1.141B8CA7A54B4p-13, -0x1.5377C6C192CB1p-16, -0x1.89224997D4986p-20, -0x1.6DF091D1FAD53p-25, -0x1.90E3812405C51p-32, -0x1.D58DBD07432F0p-42 },
+		{ 0x1.8C5C022F06BB5p-21, 0x1.C0A28F1AFCFE1p-18, 0x1.3B81298D7BFE0p-16, 0x1.3B713E9B9E3C2p-15, 0x1.0C6AD40CB622Fp-14, 0x1.A1E3173EFC947p-14, 0x1.35F3670BA9668p-13, 0x1.C7199A591168Bp-13,
+		  0x1.0F5A78B624E93p-16, 0x1.2BDCF157CC912p-17, 0x1.663193E06118Ap-19, 0x1.B86408C3F871Ep-22, 0x1.FE02F7B0D0CE5p-26, 0x1.DABB8CBE800CAp-31, 0x1.0409312D338D6p-37, 0x1.30934A3069F68p-47 },
+		{ -0x1.56CC1D6CB9F4Bp-26, -0x1.8402366A98509p-23, -0x1.10DE69035A355p-21, -0x1.10D0A4BC86BA0p-20, -0x1.D04A14A64379Ap-20, -0x1.696A74D19606Fp-19, -0x1.0C10C7B60F700p-18, -0x1.89999A14FA9D5p-18,
+		  -0x1.8723D94FDF044p-22, -0x1.B03C2AE40DE09p-23, -0x1.022857CD452A2p-24, -0x1.3D6613C5A4422p-27, -0x1.6F936F35C94ABp-31, -0x1.56264E04F2C4Dp-36, -0x1.76D397467F7ABp-43, -0x1.B7070C1C67B09p-53 },
+		{ 0x1.287932DECB555p-31, 0x1.4F933B3D59333p-28, 0x1.D7FD4756B1111p-27, 0x1.D7E57754C6EEFp-26, 0x1.918C33BACC444p-25, 0x1.389370D8F5AABp-24, 0x1.CFAE59C31B99Ap-24, 0x1.546930973CEEFp-23,
+		  0x1.27FF84DE45DDEp-27, 0x1.4718D8950FBBCp-28, 0x1.86B9AFF0D0444p-30, 0x1.E0633F7CEE222p-33, 0x1.162A72BA6F777p-36, 0x1.02EC9CCFA2EEFp-41, 0x1.1BA71A7964889p-48, 0x1.4C3CC4B2A6222p-58 },
+		{ -0x1.006C7390FBBBCp-36, -0x1.223E5BAF1999Ap-33, -0x1.983AEE2091111p-32, -0x1.982655E855555p-31, -0x1.5B4DDCE688889p-30, -0x1.0E59EEAD51111p-29, -0x1.910B518BA2222p-29, -0x1.266D16979DDDEp-28,
+		  -0x1.CCE6C02F11111p-33, -0x1.FD53C0E311111p-34, -0x1.30338F8644444p-35, -0x1.76020D3377777p-38, -0x1.B122A5DCAAAABp-42, -0x1.932C6C8CAAAABp-47, -0x1.B9ADB33733333p-54, -0x1.02AA6A4033333p-63 },
+		{ 0x1.BA93AD6222222p-42, 0x1.F4F3B0C888889p-39, 0x1.604DA3BBBBBBCp-37, 0x1.603ADD7111111p-36, 0x1.2BB9F55111111p-35, 0x1.D29E0C799999Ap-35, 0x1.5A18BF9111111p-34, 0x1.FC2D7E8444444p-34,
+		  0x1.69ECB58888889p-38, 0x1.900AFC6222222p-39, 0x1.DDC40BDDDDDDEp-41, 0x1.25D0985111111p-43, 0x1.5412ED8888889p-47, 0x1.3CC5306AAAAABp-52, 0x1.5B36AA2666666p-59, 0x1.966ED6E222222p-69 },
+		{ -0x1.2C14566666666p-47, -0x1.50F56DDDDDDDEp-44, -0x1.D9ABCEEEEEEEFp-43, -0x1.D9960BBBBBBBCp-42, -0x1.9328888888889p-41, -0x1.39B34BBBBBBBCp-40, -0x1.D163BDDDDDDDEp-40, -0x1.55B5ACCCCCCCDp-39,
+		  0x1.C9E199999999Ap-48, 0x1.4A7F777777777p-48, 0x1.571FBBBBBBBBCp-50, 0x1.63E4000000000p-53, 0x1.E000888888889p-57, 0x1.8A6199999999Ap-62, 0x1.81BDDDDDDDDDEp-69, 0x1.0A6AEEEEEEEEFp-78 },
+		{ 0x1.A0CC800000000p-49, 0x1.D631800000000p-46, 0x1.4868AEEEEEEEFp-44, 0x1.49CEC88888889p-43, 0x1.1684C88888889p-42, 0x1.B673377777777p-42, 0x1.446AAEEEEEEEFp-41, 0x1.DAADDDDDDDDDEp-41,
+		  0x1.58AECCCCCCCCDp-43, 0x1.75B3533333333p-44, 0x1.C6FB088888889p-46, 0x1.0CA3F11111111p-48, 0x1.4923A66666666p-52, 0x1.1EE24AAAAAAABp-57, 0x1.29DA422222222p-64, 0x1.732BF11111111p-74 },
+		{ -0x1.D1F7B77777777p-49, -0x1.1066911111111p-45, -0x1.8023666666666p-44, -0x1.7FE9F33333333p-43, -0x1.4646DDDDDDDDEp-42, -0x1.FC96CCCCCCCCDp-42, -0x1.792E99999999Ap-41, -0x1.14BCC44444444p-40,
+		  -0x1.ADE1555555555p-43, -0x1.E32B9DDDDDDDEp-44, -0x1.1DEA955555555p-45, -0x1.5BF4800000000p-48, -0x1.95EDCCCCCCCCDp-52, -0x1.77F3F33333333p-57, -0x1.984AB33333333p-64, -0x1.E28C955555555p-74 },
+		{ -0x1.2998AAAAAAAABp-48, -0x1.4F89888888889p-45, -0x1.D4C6088888889p-44, -0x1.D6E65DDDDDDDEp-43, -0x1.8D82AAAAAAAABp-42, -0x1.38F5B77777777p-41, -0x1.CF195DDDDDDDEp-41, -0x1.52D0911111111p-40,
+		  -0x1.0B24222222222p-42, -0x1.227E7DDDDDDDEp-43, -0x1.61576EEEEEEEFp-45, -0x1.A15F844444444p-48, -0x1.FEAD2AAAAAAABp-52, -0x1.BF3B2EEEEEEEFp-57, -0x1.D2BE511111111p-64, -0x1.2129244444444p-73 },
+		{ 0x1.3524BBBBBBBBCp-49, 0x1.6B70444444444p-46, 0x1.0079555555555p-44, 0x1.0039888888889p-43, 0x1.B39EEEEEEEEEFp-43, 0x1.537C888888889p-42, 0x1.F7A4CCCCCCCCDp-42, 0x1.716D99999999Ap-41,
+		  0x1.1F03333333333p-43, 0x1.43A1222222222p-44, 0x1.7E87555555555p-46, 0x1.D04E666666666p-49, 0x1.0EF5111111111p-52, 0x1.F60E000000000p-58, 0x1.0F3F111111111p-64, 0x1.417C333333333p-74 },
+		{ 0x1.D0F3333333333p-49, 0x1.0619DDDDDDDDEp-45, 0x1.6E68CCCCCCCCDp-44, 0x1.7002EEEEEEEEFp-43, 0x1.36C6666666666p-42, 0x1.E8F2222222222p-42, 0x1.69D1111111111p-41, 0x1.08CEEEEEEEEEFp-40,
+		  0x1.A12199999999Ap-43, 0x1.C6A1333333333p-44, 0x1.143CAAAAAAAABp-45, 0x1.46B3BBBBBBBBCp-48, 0x1.8EC4888888889p-52, 0x1.5F06888888889p-57, 0x1.704BDDDDDDDDEp-64, 0x1.C5B5333333333p-74 },
+		{ -0x1.393EEEEEEEEEFp-51, -0x1.72D999999999Ap-48, -0x1.05F999999999Ap-46, -0x1.0598888888889p-45, -0x1.BCDDDDDDDDDDEp-45, -0x1.5AB1111111111p-44, -0x1.013999999999Ap-43, -0x1.793999999999Ap-43,
+		  -0x1.247999999999Ap-45, -0x1.4B16666666666p-46, -0x1.86CEEEEEEEEEFp-48, -0x1.D8C0000000000p-51, -0x1.1424444444444p-54, -0x1.FF8AAAAAAAAABp-60, -0x1.1293333333333p-66, -0x1.46C7777777777p-76 },
+		{ -0x1.1BB7777777777p-50, -0x1.3FE6666666666p-47, -0x1.BF6CCCCCCCCCDp-46, -0x1.C153333333333p-45, -0x1.7B91111111111p-44, -0x1.2A61111111111p-43, -0x1.B9A8888888889p-43, -0x1.4357777777777p-42,
+		  -0x1.FCF7777777777p-45, -0x1.15D0888888889p-45, -0x1.5160000000000p-47, -0x1.8F7EEEEEEEEEFp-50, -0x1.E682222222222p-54, -0x1.AE2999999999Ap-59, -0x1.C561111111111p-66, -0x1.15E4CCCCCCCCDp-75 }
+	},
+	{
+		{ 0x1.F6B964487514Cp-11, 0x1.1C839AA1F7ED7p-7, 0x1.902BEB74343B7p-6, 0x1.9017BAFADB446p-5, 0x1.5472C0A8DABF5p-4, 0x1.0903B2D0ECC91p-3, 0x1.89209FDF2DD1Ap-3, 0x1.209D31F39A97Ap-2,
+		  0x1.D722C09ADDFB2p-5, 0x1.0451570C247A1p-5, 0x1.36F4B093D30B0p-7, 0x1.7E501C4777A6Ep-10, 0x1.BAC0978C5A2DFp-14, 0x1.9C2038112AC9Bp-19, 0x1.C37C5E32F5D23p-26, 0x1.086898B341732p-35 },
+		{ -0x1.9C7DDC2132784p-16, -0x1.D2E518033B5B6p-13, -0x1.48588CAE1E026p-11, -0x1.4847FBE1863E6p-10, -0x1.17579783FBED8p-9, -0x1.B2E53FB2C0048p-9, -0x1.4290EC33D7194p-8, -0x1.D99F7FEBA8C13p-8,
+		  -0x1.8292AB29BD5F0p-11, -0x1.AB3025D249C03p-12, -0x1.FE495647EBB18p-14, -0x1.39B15247C546Ap-16, -0x1.6B48B0DC30909p-20, -0x1.522790771D6D5p-25, -0x1.72732C789659Ap-32, -0x1.B1E6B8F1A83E6p-42 },
+		{ 0x1.527465D9888C6p-21, 0x1.7F17DF3087BCCp-18, 0x1.0D6979FE67A6Ep-16, 0x1.0D5BE25D191A2p-15, 0x1.CA685B1A250EEp-15, 0x1.64D65BA64AE20p-14, 0x1.08AB6C7941643p-13, 0x1.849D20C149E33p-13,
+		  0x1.DBC8351F7416Bp-17, 0x1.06E28D6D972A7p-17, 0x1.3A05BEF10AFCEp-19, 0x1.821551933E462p-22, 0x1.BF1E6384FCD16p-26, 0x1.A030B1CD8B63Cp-31, 0x1.C7F036BBAED06p-38, 0x1.0B04230AD705Ep-47 },
+		{ -0x1.15B4D6B7EF115p-26, -0x1.3A553A42F9E42p-23, -0x1.BA1CADBA263BCp-22, -0x1.BA065F90898CDp-21, -0x1.78211C9F33CDAp-20, -0x1.24CA23ACCB5B3p-19, -0x1.B2546307F8995p-19, -0x1.3EDCD284AAF6Dp-18,
+		  -0x1.455230F5E749Ap-22, -0x1.678034D3C2055p-23, -0x1.AD6EB152DAE55p-25, -0x1.07FD122F1A933p-27, -0x1.31B8E1200CD55p-31, -0x1.1C93124F3FD91p-36, -0x1.37C0B0FD7D4CDp-43, -0x1.6D2679C5AAD89p-53 },
+		{ 0x1.C7B934BA5EEEFp-32, 0x1.01EA0D58BBDDEp-28, 0x1.6AC239A6A6222p-27, 0x1.6AAFEC6279777p-26, 0x1.349E795495222p-25, 0x1.E079B36220889p-25, 0x1.645F860DF7666p-24, 0x1.05A183D03EDDEp-23,
+		  0x1.D320CF5E12222p-28, 0x1.021A79A0D1555p-28, 0x1.344F8DAE51DDEp-30, 0x1.7B0F96DD2EEEFp-33, 0x1.B6FC74C1D4444p-37, 0x1.989EC68C6A222p-42, 0x1.BFA537DAD5DDEp-49, 0x1.0628D2A1B5555p-58 },
+		{ -0x1.75F457DB6EEEFp-37, -0x1.A7466EFFCCCCDp-34, -0x1.29AB8BA680000p-32, -0x1.299C88E13BBBCp-31, -0x1.FA7D34AA55555p-31, -0x1.8A43E9B64CCCDp-30, -0x1.246E2667DDDDEp-29, -0x1.AD5FEC2AC4444p-29,
+		  -0x1.590EE5E177777p-33, -0x1.7D4FE61355555p-34, -0x1.C77C678444444p-36, -0x1.18012C0022222p-38, -0x1.444547F800000p-42, -0x1.2DD707CE22222p-47, -0x1.4AAAF9E133333p-54, -0x1.834E10B9DDDDEp-64 },
+		{ 0x1.31EBB2E555555p-42, 0x1.5A488B8BBBBBCp-39, 0x1.E70A0FD333333p-38, 0x1.E6F13A8444444p-37, 0x1.9E5A94A444444p-36, 0x1.428B6E0555555p-35, 0x1.DE789CC222222p-35, 0x1.5F44C71555555p-34,
+		  0x1.0038088000000p-38, 0x1.1B10400000000p-39, 0x1.5241568000000p-41, 0x1.9FC4D15555555p-44, 0x1.E196C1199999Ap-48, 0x1.C047A7A222222p-53, 0x1.EAEA1D0888889p-60, 0x1.1F8BAEBBBBBBCp-69 },
+		{ -0x1.54EEE44444444p-48, -0x1.818BC00000000p-45, -0x1.0F26D33333333p-43, -0x1.0EECFCCCCCCCDp-42, -0x1.CD7C8AAAAAAABp-42, -0x1.6727C88888889p-41, -0x1.0A7E177777777p-40, -0x1.8726711111111p-40,
+		  0x1.9DEB666666666p-45, 0x1.D03B333333333p-46, 0x1.10F6A22222222p-47, 0x1.4DBC19999999Ap-50, 0x1.8A33444444444p-54, 0x1.6EEC2AAAAAAABp-59, 0x1.9D19EEEEEEEEFp-66, 0x1.DF0C333333333p-76 },
+		{ 0x1.7C6E4AAAAAAABp-49, 0x1.A9D9FDDDDDDDEp-46, 0x1.2D5ABDDDDDDDEp-44, 0x1.2DAC044444444p-43, 0x1.FFB40CCCCCCCDp-43, 0x1.8E85933333333p-42, 0x1.2722311111111p-41, 0x1.B18C99999999Ap-41,
+		  0x1.478FF33333333p-43, 0x1.715B111111111p-44, 0x1.AC646AAAAAAABp-46, 0x1.0CC9777777777p-48, 0x1.342779999999Ap-52, 0x1.1E5B0AAAAAAABp-57, 0x1.4287CAAAAAAABp-64, 0x1.760C99999999Ap-74 },
+		{ -0x1.C70E800000000p-49, -0x1.0225200000000p-45, -0x1.6B05888888889p-44, -0x1.6B8F6EEEEEEEFp-43, -0x1.348FC00000000p-42, -0x1.E0CC666666666p-42, -0x1.643E1DDDDDDDEp-41, -0x1.05C20EEEEEEEFp-40,
+		  -0x1.A51C19999999Ap-43, -0x1.D45F911111111p-44, -0x1.15D02EEEEEEEFp-45, -0x1.54A819999999Ap-48, -0x1.8E34EEEEEEEEFp-52, -0x1.72259DDDDDDDEp-57, -0x1.9A29777777777p-64, -0x1.DEB1F77777777p-74 },
+		{ -0x1.18EA977777777p-48, -0x1.3AD57DDDDDDDEp-45, -0x1.BD73E22222222p-44, -0x1.BE14800000000p-43, -0x1.7A16044444444p-42, -0x1.2686022222222p-41, -0x1.B437155555555p-41, -0x1.407519999999Ap-40,
+		  -0x1.0054511111111p-42, -0x1.20EB19999999Ap-43, -0x1.4F1A9DDDDDDDEp-45, -0x1.A488BBBBBBBBCp-48, -0x1.E383488888889p-52, -0x1.C173488888889p-57, -0x1.FA56FBBBBBBBCp-64, -0x1.25C6111111111p-73 },
+		{ 0x1.2FCF99999999Ap-49, 0x1.58E3666666666p-46, 0x1.E4F0000000000p-45, 0x1.E5F2222222222p-44, 0x1.9C04AAAAAAAABp-43, 0x1.412FBBBBBBBBCp-42, 0x1.DBD2888888889p-42, 0x1.5DA9444444444p-41,
+		  0x1.1983111111111p-43, 0x1.39AFDDDDDDDDEp-44, 0x1.736E444444444p-46, 0x1.C707777777777p-49, 0x1.0ACF333333333p-52, 0x1.EF05BBBBBBBBCp-58, 0x1.12DA666666666p-64, 0x1.40CCAAAAAAAABp-74 },
+		{ 0x1.B69DBBBBBBBBCp-49, 0x1.EC48666666666p-46, 0x1.5C1BDDDDDDDDEp-44, 0x1.5CA0000000000p-43, 0x1.2774000000000p-42, 0x1.CC4B555555555p-42, 0x1.54E6EEEEEEEEFp-41, 0x1.F4F1555555555p-41,
+		  0x1.90FA666666666p-43, 0x1.C38FBBBBBBBBCp-44, 0x1.0616666666666p-45, 0x1.48AE666666666p-48, 0x1.7AA8222222222p-52, 0x1.6056CCCCCCCCDp-57, 0x1.8CE0222222222p-64, 0x1.CC7199999999Ap-74 },
+		{ -0x1.35FBBBBBBBBBCp-51, -0x1.6023333333333p-48, -0x1.EF04444444444p-47, -0x1.F077777777777p-46, -0x1.A460000000000p-45, -0x1.47F5555555555p-44, -0x1.E5ACCCCCCCCCDp-44, -0x1.64F2222222222p-43,
+		  -0x1.1F40000000000p-45, -0x1.40D999999999Ap-46, -0x1.7B06666666666p-48, -0x1.CFCCCCCCCCCCDp-51, -0x1.1115555555555p-54, -0x1.F942222222222p-60, -0x1.193DDDDDDDDDEp-66, -0x1.4857777777777p-76 },
+		{ -0x1.0B8E666666666p-50, -0x1.2C9D555555555p-47, -0x1.A90999999999Ap-46, -0x1.A9A8888888889p-45, -0x1.68C1111111111p-44, -0x1.18FA222222222p-43, -0x1.A03CCCCCCCCCDp-43, -0x1.31DBBBBBBBBBCp-42,
+		  -0x1.E9F5555555555p-45, -0x1.13A0000000000p-45, -0x1.404999999999Ap-47, -0x1.9148888888889p-50, -0x1.CEF0000000000p-54, -0x1.AF4DDDDDDDDDEp-59, -0x1.E5BAAAAAAAAABp-66, -0x1.199999999999Ap-75 }
+	}
+};
+
+/* NGQP = 9: roots (9) and weights (9) on [0,84), one polynomial of degree 14 per interval */
+static const double rys_table_9[21][RYS_TABLE_NCOEF][18] = {
+	{
+		{ 0x1.A836D75BECF2Ep-8, 0x1.D6A75CC4DC997p-5, 0x1.3DAA97431436Ap-3, 0x1.29C87F2CD8907p-2, 0x1.CE7019C66D70Ap-2, 0x1.3DC7E9410F762p-1, 0x1.8E8754DA20645p-1, 0x1.CF15D60C1D8ADp-1, 0x1.F66879EDF4B10p-1,
+		  0x1.44BE787CD74D8p-3, 0x1.1F236741C09C7p-3, 0x1.C3C64468D705Fp-4, 0x1.40077022CDD0Ep-4, 0x1.9F0B2EFA30FFBp-5, 0x1.F543185FC856Cp-6, 0x1.1C32FBC2D7BE2p-6, 0x1.25798D4F3C1CEp-7, 0x1.BB761EC1ABB32p-9 },
+		{ -0x1.5A107E8FB320Ep-11, -0x1.6E29DAD4FFF37p-8, -0x1.BF9438ED32E24p-7, -0x1.653B8BFF9CABFp-6, -0x1.B465BA6334F08p-6, -0x1.A68D4E3C0BF48p-6, -0x1.3B0BE4F15064Fp-6, -0x1.401D8122C5275p-7, -0x1.12CC64519BE84p-9,
+		  -0x1.4239CB55C65ADp-7, -0x1.51AF3A534CE0Fp-6, -0x1.1A1434F1EFAC4p-5, -0x1.5E24C99E73B8Dp-5, -0x1.5A070380BF7E1p-5, -0x1.1F1048556D77Cp-5, -0x1.9AF59DB9BD4A2p-6, -0x1.F10A4503FCC14p-7, -0x1.99B32198C0179p-8 },
+		{ 0x1.A4C41B9CE98A8p-15, 0x1.92CF928D321B7p-12, 0x1.870FE636C7CA6p-11, 0x1.8822D17D379D3p-11, 0x1.016581A6F1546p-12, -0x1.F2A9D1FD47984p-12, -0x1.CAB1CBBE525B0p-11, -0x1.5C9DA752AF0A0p-11, -0x1.6993A66404859p-13,
+		  0x1.68CCF861E8834p-11, 0x1.8BA5D894C6602p-9, 0x1.094A4F1BF381Cp-7, 0x1.E403EEB6E38B3p-7, 0x1.494B9B45F7B98p-6, 0x1.6171C420FB873p-6, 0x1.341065511CE49p-6, 0x1.AB3A4EC7E41BFp-7, 0x1.7C1D5D1BC415Ep-8 },
+		{ -0x1.C3165E6074F35p-19, -0x1.680725C3C3D2Ap-16, -0x1.901DAE7585C74p-16, 0x1.45DD7CD208986p-17, 0x1.962CB951FFE39p-15, 0x1.5BE55C9E6429Dp-15, -0x1.CFD388FD25C22p-18, -0x1.11EE3E8575B82p-15, -0x1.9B1E91D9197F3p-17,
+		  -0x1.A5BD313FCD8E8p-15, -0x1.9A19A7AE666F7p-12, -0x1.974FD3A4B0860p-10, -0x1.012829AE1CAF3p-8, -0x1.CA9826871148Dp-8, -0x1.32C7FFB064C42p-7, -0x1.3D2CA6A72A31Dp-7, -0x1.EFE81C3496383p-8, -0x1.D7FFC21A82DC3p-9 },
+		{ 0x1.C07FB4958236Fp-23, 0x1.03BC2EE8DEACDp-20, -0x1.9EFCB1FB5319Ap-23, -0x1.445A7E981AF66p-19, -0x1.6517902E888CDp-20, 0x1.2EEAA57EA1955p-19, 0x1.1DA663F627177p-19, -0x1.DED9712026889p-21, -0x1.A5D38FFC22111p-21,
+		  0x1.EDF263D5C09B3p-19, 0x1.8415817308BDEp-15, 0x1.104D423A37FBFp-12, 0x1.C87DC286191EBp-11, 0x1.01A4559D83EC9p-9, 0x1.A205238F271E1p-9, 0x1.F6370F3C7E903p-9, 0x1.B4818AA4DB752p-9, 0x1.B90FBBA1DD6A2p-10 },
+		{ -0x1.A68109B19A000p-27, -0x1.05886EC339BBCp-25, 0x1.613DBA206C889p-24, 0x1.535C3C358C444p-24, -0x1.406C1AAF00000p-23, -0x1.A73672E0B2222p-24, 0x1.35602AC0B6EEFp-23, 0x1.D6C9974326666p-26, -0x1.8A49AB1502222p-25,
+		  -0x1.1D830DA568CCDp-22, -0x1.56882398DC59Ap-18, -0x1.479B3895AFDA6p-15, -0x1.6162524D751AAp-13, -0x1.EBCBD9C509A8Ap-12, -0x1.D96D32A755A3Cp-11, -0x1.44F67A217946Fp-10, -0x1.365A4D1D246ABp-10, -0x1.4ABAF9EFD4FC4p-11 },
+		{ 0x1.7C91AB7F60000p-31, 0x1.FC8848F555555p-35, -0x1.72ADF49AF7777p-28, 0x1.56755FD53BBBCp-28, 0x1.F93F63389999Ap-28, -0x1.81D0119EC4444p-27, 0x1.58C076DDDDDDEp-33, 0x1.7D31DE06CCCCDp-28, -0x1.4C1AE64FDDDDEp-29,
+		  0x1.4447642C16666p-26, 0x1.1DA2A767555DEp-21, 0x1.69D4F633379BCp-18, 0x1.E9FA6279D0DFAp-16, 0x1.9B75ED5B7318Fp-14, 0x1.CDADAF6AC56F9p-13, 0x1.650508ABD9C86p-12, 0x1.72E6659126778p-12, 0x1.9E7A74EFF4655p-13 },
+		{ -0x1.48E9FFE19999Ap-35, 0x1.74A1B28222222p-34, 0x1.064D2B8CCCCCDp-33, -0x1.307CCB4555555p-31, 0x1.1C6F5BAAAAAABp-31, 0x1.750DBE0000000p-33, -0x1.47A1A42000000p-31, 0x1.B42D1C4444444p-32, -0x1.D98B07BBBBBBCp-34,
+		  -0x1.69C5EAF2AAAABp-30, -0x1.C5F3AB04ECCCDp-25, -0x1.73D9CB1DF2AABp-21, -0x1.35A0BA37A8889p-18, -0x1.3437E4996AE77p-16, -0x1.8D082E68099DEp-15, -0x1.55B90DBB1C437p-14, -0x1.7ECEDEDF99757p-14, -0x1.BE5AC2766112Ep-15 },
+		{ 0x1.1360C5D555555p-39, -0x1.16CC724444444p-37, 0x1.898F922222222p-37, 0x1.17251D1111111p-37, -0x1.5D77280000000p-35, 0x1.F53933DDDDDDEp-35, -0x1.38B1E8CCCCCCDp-35, 0x1.1B041B3333333p-36, -0x1.7BBB0CCCCCCCDp-40,
+		  0x1.8EF1D2C000000p-34, 0x1.59E62FED44444p-28, 0x1.67057E18C8889p-24, 0x1.69370CD685AABp-21, 0x1.A3B9CB1AF4C44p-19, 0x1.324F2A03E2522p-17, 0x1.2257C64406644p-16, 0x1.5C0AA58B8A695p-16, 0x1.A59271CD50255p-17 },
+		{ -0x1.0CA0D9999999Ap-43, 0x1.43F63DDDDDDDEp-42, -0x1.0422BDDDDDDDEp-39, 0x1.222DD9999999Ap-40, -0x1.CF74ACCCCCCCDp-39, -0x1.B91FB33333333p-40, -0x1.2A82B33333333p-39, -0x1.D23B2AAAAAAABp-39, -0x1.C1186AAAAAAABp-39,
+		  -0x1.D37C300000000p-38, -0x1.FC407EB555555p-32, -0x1.48043D8588889p-27, -0x1.88A606B354444p-24, -0x1.06B97F8C33111p-21, -0x1.AD85248359333p-20, -0x1.BC382597D1A22p-19, -0x1.1AFC93835E244p-18, -0x1.62B312E4288ABp-19 },
+		{ -0x1.B0CF5DDDDDDDEp-46, -0x1.3038D55555555p-42, -0x1.568C4CCCCCCCDp-41, -0x1.826FE22222222p-40, -0x1.D2FF888888889p-40, -0x1.8BAFAEEEEEEEFp-39, -0x1.9C61EEEEEEEEFp-39, -0x1.04047BBBBBBBCp-38, -0x1.0FD8688888889p-38,
+		  -0x1.24B5911111111p-42, 0x1.627F7CBBBBBBCp-35, 0x1.1CF4342666666p-30, 0x1.908E0C8591111p-27, 0x1.30FFC9888EEEFp-24, 0x1.146A2CF36EAABp-22, 0x1.355762B75C000p-21, 0x1.A062EC2B46555p-21, 0x1.0D18ABDC29555p-21 },
+		{ 0x1.164B777777777p-46, 0x1.338DCCCCCCCCDp-43, 0x1.9AFEAAAAAAAABp-42, 0x1.7A4BDDDDDDDDEp-41, 0x1.2202BBBBBBBBCp-40, 0x1.83A0222222222p-40, 0x1.E4F7777777777p-40, 0x1.1324AAAAAAAABp-39, 0x1.296A777777777p-39,
+		  0x1.7CBD99999999Ap-42, -0x1.BDB1A66666666p-39, -0x1.D80C917777777p-34, -0x1.81610F1222222p-30, -0x1.4A46FAC933333p-27, -0x1.48B3A6E09999Ap-25, -0x1.8AF8006A1DDDEp-24, -0x1.173E3ADC36666p-23, -0x1.72F9956E12222p-24 },
+		{ 0x1.90F9111111111p-46, 0x1.B85BBBBBBBBBCp-43, 0x1.263F111111111p-41, 0x1.0FD9DDDDDDDDEp-40, 0x1.9E7599999999Ap-40, 0x1.1874222222222p-39, 0x1.5944222222222p-39, 0x1.8BC9555555555p-39, 0x1.AA0C222222222p-39,
+		  0x1.25E7BBBBBBBBCp-41, 0x1.C17D111111111p-41, 0x1.8A2319999999Ap-37, 0x1.61071E7777777p-33, 0x1.506F734CCCCCDp-30, 0x1.6CBD119911111p-28, 0x1.D3A95BA088889p-27, 0x1.59CDDBEA66666p-26, 0x1.D702377688889p-27 },
+		{ -0x1.208CCCCCCCCCDp-48, -0x1.398BBBBBBBBBCp-45, -0x1.A2F7777777777p-44, -0x1.838EEEEEEEEEFp-43, -0x1.2676666666666p-42, -0x1.8E24444444444p-42, -0x1.EC00000000000p-42, -0x1.1A00000000000p-41, -0x1.2F78888888889p-41,
+		  -0x1.A440000000000p-44, -0x1.01C999999999Ap-43, -0x1.4228666666666p-40, -0x1.3FB17CCCCCCCDp-36, -0x1.52C4906666666p-33, -0x1.8FE072BBBBBBCp-31, -0x1.117E127777777p-29, -0x1.A700083AAAAABp-29, -0x1.275D2BFD55555p-29 },
+		{ -0x1.E8E0000000000p-48, -0x1.0CD3333333333p-44, -0x1.678AAAAAAAAABp-43, -0x1.4BB8888888889p-42, -0x1.FA88888888889p-42, -0x1.563CCCCCCCCCDp-41, -0x1.A5AEEEEEEEEEFp-41, -0x1.E360000000000p-41, -0x1.0420888888889p-40,
+		  -0x1.6598888888889p-43, -0x1.5663333333333p-43, -0x1.B555555555555p-45, 0x1.E920333333333p-40, 0x1.30C579999999Ap-36, 0x1.8429451111111p-34, 0x1.17F83B999999Ap-32, 0x1.C0D4E32AAAAABp-32, 0x1.3FA5C41111111p-32 }
+	},
+	{
+		{ 0x1.5D47E3D1B732Fp-8, 0x1.8669CEC3E6FF9p-5, 0x1.0B6FDE9328690p-3, 0x1.003C48D4FA8A5p-2, 0x1.9943A1A42EA8Dp-2, 0x1.22957712BC135p-1, 0x1.7909B431A4917p-1, 0x1.C3945ADEC8AAAp-1, 0x1.F3D9C6795AE5Cp-1,
+		  0x1.21628BB6A1120p-3, 0x1.BC8DC6A685B05p-4, 0x1.0872BE710075Dp-4, 0x1.F05172FD3E07Fp-6, 0x1.7B47BBA0EBB73p-7, 0x1.F04BAE903D4D1p-9, 0x1.29D606BC403ABp-10, 0x1.5DEA97267A3B5p-12, 0x1.6C3C3B3DFDC2Cp-14 },
+		{ -0x1.02F7B8A2DC333p-11, -0x1.1876FD8AC8747p-8, -0x1.6735CB22D94EEp-7, -0x1.3375380D77BC6p-6, -0x1.9BA83E7ABF102p-6, -0x1.BC8B2E04523A5p-6, -0x1.7471259C11E86p-6, -0x1.A4EE984538CFAp-7, -0x1.844EF2D7C332Bp-9,
+		  -0x1.F10FB06CC52A5p-8, -0x1.8BAAC57BEC6CAp-7, -0x1.E237D4001EAC9p-7, -0x1.92F9B54639F03p-7, -0x1.EA14106E9208Bp-8, -0x1.D3BCBD0404F9Cp-9, -0x1.7B52913C6729Cp-10, -0x1.163310CB81095p-11, -0x1.4A19E863E3869p-13 },
+		{ 0x1.1E9C95771BEE5p-15, 0x1.21A859615EE17p-12, 0x1.3C6DCE2480B7Bp-11, 0x1.8C08C8B0F5A59p-11, 0x1.031527685707Bp-11, -0x1.7FA0F6A3A2B2Ep-13, -0x1.BFD6780FFD0E4p-11, -0x1.CC90A23D65012p-11, -0x1.1A30744A70451p-12,
+		  0x1.DF92CCAD3CA40p-12, 0x1.823D35382EBEAp-10, 0x1.7256DAEF17172p-9, 0x1.C2E4E3188D340p-9, 0x1.7F9249E523AA2p-9, 0x1.EBF8CFA5E006Dp-10, 0x1.FF7276BE146AAp-11, 0x1.C51BEC23D0B36p-12, 0x1.2D19A49192AB8p-13 },
+		{ -0x1.1865032285DA3p-19, -0x1.F3B140183454Cp-17, -0x1.7FFFD66A3C661p-16, -0x1.8F75C5CEC6706p-18, 0x1.167712890FA52p-15, 0x1.C4D48407BA250p-15, 0x1.0426DEF703FA2p-16, -0x1.3B1DCB522217Bp-15, -0x1.5D73362AB953Ep-16,
+		  -0x1.E76C4F3F07786p-16, -0x1.54F72D8D52974p-13, -0x1.DACA5439CB69Dp-12, -0x1.8F493318F3F39p-11, -0x1.C4505AAA8AEDAp-11, -0x1.755D409B0EE9Ap-11, -0x1.E0B61F0C1456Fp-12, -0x1.F5DDAFA004EEFp-13, -0x1.70419E3B29882p-14 },
+		{ 0x1.FE29EAD4B09ABp-24, 0x1.6EA8867F1C944p-21, 0x1.74047140F6911p-22, -0x1.8A2A1384E3244p-20, -0x1.32E1D4B48A4EFp-19, 0x1.7AA0E29859EEFp-21, 0x1.C4D6C3ED81133p-19, -0x1.5C629F3EF9111p-23, -0x1.7E6AD16116000p-20,
+		  0x1.F4EEE09E17F44p-20, 0x1.15BB731D147A6p-16, 0x1.0DB3E3CD746AEp-14, 0x1.2D8CA8A749C26p-13, 0x1.B7339D021BFB1p-13, 0x1.C471D4086E5CBp-13, 0x1.5F7B20E8F6A32p-13, 0x1.A7F6AB6607E52p-14, 0x1.5376AE8F489E2p-15 },
+		{ -0x1.B99122138A666p-28, -0x1.B4DB155CA9555p-26, 0x1.033B9F8CAC889p-25, 0x1.A6C7E26DD9555p-24, -0x1.43471D072DDDEp-25, -0x1.A3FD4B3874444p-23, 0x1.5F2B158F9999Ap-24, 0x1.1A7087FD9199Ap-23, -0x1.7057483E84444p-24,
+		  -0x1.FFF2A954F599Ap-24, -0x1.A9893668CB155p-20, -0x1.1754985E3741Ap-17, -0x1.936760105E659p-16, -0x1.6FE3FB1A39F59p-15, -0x1.CDCC0457612A8p-15, -0x1.A803EFA748798p-15, -0x1.22AE62FC32C4Fp-15, -0x1.F6DEC76B4F95Dp-17 },
+		{ 0x1.6EF7C2AF77777p-32, 0x1.4CA4BBAA55555p-31, -0x1.B8221F0177777p-29, -0x1.259070ACEEEEFp-30, 0x1.4927C63E2EEEFp-27, -0x1.C150D31BAAAABp-29, -0x1.84037C3E91111p-27, 0x1.9955BD671999Ap-27, -0x1.2A885A3800000p-28,
+		  0x1.02132068E3333p-27, 0x1.362AA03DAD444p-23, 0x1.0C5892409D155p-20, 0x1.E939303FB5B5Ep-19, 0x1.1181D47DCCC60p-17, 0x1.9A4469DA5BF82p-17, 0x1.B59F076CE9E21p-17, 0x1.5057ECE09D717p-17, 0x1.379AC712ADC72p-18 },
+		{ -0x1.26A8EA419999Ap-36, 0x1.39A3B75DDDDDEp-37, 0x1.5DDA593DDDDDEp-33, -0x1.2DC50BB777777p-32, -0x1.84225EE222222p-33, 0x1.DA8BAAFDDDDDEp-31, -0x1.EA65E9F333333p-31, 0x1.D2E328F777777p-32, -0x1.52ABC95555555p-33,
+		  -0x1.008569F888889p-31, -0x1.B16E2EFB4CCCDp-27, -0x1.E3E0F6B70F777p-24, -0x1.11282BFCB63BCp-21, -0x1.6FE656577C333p-20, -0x1.445AE7F44F6D5p-19, -0x1.8C1122F8ADDB3p-19, -0x1.51406E5807546p-19, -0x1.4C2B3B545FC6Fp-20 },
+		{ 0x1.D19107BBBBBBCp-41, -0x1.345DBFBBBBBBCp-39, -0x1.4C73044444444p-39, 0x1.7850B82222222p-36, -0x1.2334338888889p-35, 0x1.39289F999999Ap-36, 0x1.4136795555555p-36, -0x1.5B36A84444444p-36, 0x1.62D2111111111p-39,
+		  0x1.FD5A344CCCCCDp-36, 0x1.23F8306177777p-30, 0x1.9CE8491D22222p-27, 0x1.1C05E69461DDEp-24, 0x1.C5D16932DDBBCp-23, 0x1.CFAFA4BB7A266p-22, 0x1.3FFA11166BD09p-21, 0x1.2AC2ED12EC380p-21, 0x1.36D0506F6806Fp-22 },
+		{ -0x1.020979999999Ap-44, 0x1.0538AAAAAAAABp-46, -0x1.A78DB33333333p-41, -0x1.3DE3288888889p-40, 0x1.5C4C888888889p-41, -0x1.B144D33333333p-38, 0x1.A8FA444444444p-39, -0x1.F3C1A00000000p-38, -0x1.573FF33333333p-39,
+		  -0x1.372319999999Ap-39, -0x1.7E26228CCCCCDp-34, -0x1.4FA4C25F77777p-30, -0x1.15473CD9D5555p-27, -0x1.034E50692EEEFp-25, -0x1.2F3CA74C40222p-24, -0x1.D3C0873C853BCp-24, -0x1.DA94EB67D58CDp-24, -0x1.0346FA7F2F911p-24 },
+		{ -0x1.79F6DDDDDDDDEp-46, -0x1.E63BA22222222p-43, -0x1.299AE66666666p-41, -0x1.3D31D11111111p-40, -0x1.C167622222222p-40, -0x1.5711CEEEEEEEFp-39, -0x1.8D689DDDDDDDEp-39, -0x1.0B0BCEEEEEEEFp-38, -0x1.095CAAAAAAAABp-38,
+		  -0x1.0F42F9999999Ap-41, 0x1.BFA796AAAAAABp-38, 0x1.044BC09111111p-33, 0x1.FF71ADFD11111p-31, 0x1.14AC5DA7DDDDEp-28, 0x1.6E36631E4DDDEp-27, 0x1.388ADFE61ACCDp-26, 0x1.55D245D66E444p-26, 0x1.864ED6B62CCCDp-27 },
+		{ 0x1.C955DDDDDDDDEp-47, 0x1.FC77111111111p-44, 0x1.556F777777777p-42, 0x1.4947EEEEEEEEFp-41, 0x1.FB95111111111p-41, 0x1.6E38222222222p-40, 0x1.C3F6666666666p-40, 0x1.0DEFAAAAAAAABp-39, 0x1.28F899999999Ap-39,
+		  0x1.63A6666666666p-42, -0x1.2863222222222p-42, -0x1.7FB2944444444p-37, -0x1.BF78E77777777p-34, -0x1.151C79599999Ap-31, -0x1.9AE14714EEEEFp-30, -0x1.8069F7BAFBBBCp-29, -0x1.C1C90A51C2222p-29, -0x1.0B17AFB02EEEFp-29 },
+		{ 0x1.401B777777777p-46, 0x1.69B4CCCCCCCCDp-43, 0x1.EE2BBBBBBBBBCp-42, 0x1.D302222222222p-41, 0x1.7120222222222p-40, 0x1.0250555555555p-39, 0x1.4825111111111p-39, 0x1.838ACCCCCCCCDp-39, 0x1.A838888888889p-39,
+		  0x1.01C6DDDDDDDDEp-41, 0x1.D15DBBBBBBBBCp-42, 0x1.60C5911111111p-40, 0x1.7B560C4444444p-37, 0x1.06B79DA222222p-34, 0x1.B019D84EEEEEFp-33, 0x1.B7CCA04EAAAABp-32, 0x1.11A484E355555p-31, 0x1.50D0229F44444p-32 },
+		{ -0x1.D6F3333333333p-49, -0x1.02B6666666666p-45, -0x1.5E71111111111p-44, -0x1.4D36666666666p-43, -0x1.06A0000000000p-42, -0x1.6FE0000000000p-42, -0x1.D41999999999Ap-42, -0x1.13D0000000000p-41, -0x1.2E2DDDDDDDDDEp-41,
+		  -0x1.72A6666666666p-44, -0x1.3BADDDDDDDDDEp-44, -0x1.2FA4444444444p-43, -0x1.3CB3777777777p-40, -0x1.EBFA222222222p-38, -0x1.C0CE146666666p-36, -0x1.F0E60B599999Ap-35, -0x1.48CEC08333333p-34, -0x1.A36FA73555555p-35 },
+		{ -0x1.8751111111111p-48, -0x1.B9ACCCCCCCCCDp-45, -0x1.2DBDDDDDDDDDEp-43, -0x1.1D38888888889p-42, -0x1.C2A1111111111p-42, -0x1.3B53BBBBBBBBCp-41, -0x1.9116666666666p-41, -0x1.D905555555555p-41, -0x1.02FBBBBBBBBBCp-40,
+		  -0x1.3AC0888888889p-43, -0x1.0090888888889p-43, -0x1.3D33333333333p-44, 0x1.12E0888888889p-44, 0x1.95A6444444444p-41, 0x1.9F90966666666p-39, 0x1.EE65A3DDDDDDEp-38, 0x1.57E5B5CCCCCCDp-37, 0x1.C34E280000000p-38 }
+	},
+	{
+		{ 0x1.24833826397F9p-8, 0x1.4874C458E853Ap-5, 0x1.C63C5A69CB2D2p-4, 0x1.B9A7B7AE53E1Dp-3, 0x1.6810A1234F198p-2, 0x1.06A61BE713265p-1, 0x1.601A5D1A18176p-1, 0x1.B4794301DA1BCp-1, 0x1.F02AD63F6BEEDp-1,
+		  0x1.05A4BC1974490p-3, 0x1.6D5BD4CC6F20Fp-4, 0x1.655EE375673EAp-5, 0x1.EE10F3A825094p-7, 0x1.EC99D44CA851Cp-9, 0x1.71E1B98ACD691p-11, 0x1.C8039175623EEp-14, 0x1.0B385A39286A1p-16, 0x1.4630D99D2F601p-19 },
+		{ -0x1.8D68E50AF051Ep-12, -0x1.B4E917EDB0207p-9, -0x1.20ADAB90607E0p-7, -0x1.03C50F517A774p-6, -0x1.75F7106C27C75p-6, -0x1.BDCF2E0862F6Dp-6, -0x1.A789DFA919933p-6, -0x1.134B785E51AC4p-6, -0x1.1C940E7999E0Bp-8,
+		  -0x1.8CA510FFEF113p-8, -0x1.F90B7050FCDDDp-8, -0x1.DEB7E54AA12F9p-8, -0x1.25357D99AEFCBp-8, -0x1.DC85D54A7FED5p-10, -0x1.1177DA7DF8A95p-11, -0x1.E73CF468AA136p-14, -0x1.81E60B7DB9834p-16, -0x1.1EFF7F2E71D98p-18 },
+		{ 0x1.934EBC3A451BAp-16, 0x1.A65931742A9CCp-13, 0x1.F3689C5B9D351p-12, 0x1.6ABFC7494CBBEp-11, 0x1.4E463801BA873p-11, 0x1.29E3DD0BE110Dp-13, -0x1.62E204BB148FCp-11, -0x1.1ED24D5D43D14p-10, -0x1.C97A21F1FFC9Fp-12,
+		  0x1.4F5C650DFB87Bp-12, 0x1.A164505764350p-11, 0x1.31F9663EE8EF5p-10, 0x1.0B8B7F2E98BC5p-10, 0x1.2F1854E26F11Ep-11, 0x1.DD46EAD54F9DFp-13, 0x1.1D15549C6A9EDp-14, 0x1.220C43EEFB08Cp-16, 0x1.FE5B4F1886F85p-19 },
+		{ -0x1.6A8B86473878Ep-20, -0x1.5B30A2E035A17p-17, -0x1.447335674F64Bp-16, -0x1.D781340C1EE1Ap-17, 0x1.F002CEF3DAEB7p-17, 0x1.B23F431F88C54p-15, 0x1.6D143B19E6E94p-15, -0x1.087398DDACFB0p-15, -0x1.319F53BC70170p-15,
+		  -0x1.2C7264638C2D8p-16, -0x1.3EBC3A26EFF24p-14, -0x1.4B8B349685876p-13, -0x1.8BC351F133593p-13, -0x1.2B508567672C5p-13, -0x1.354B7A773E103p-14, -0x1.DB5744C249BCBp-16, -0x1.2C0AA3000140Fp-17, -0x1.31342DC33249Ap-19 },
+		{ 0x1.2F5E6ECDD3D89p-24, 0x1.F3C73BC029DEFp-22, 0x1.0AAB3D1B22244p-21, -0x1.4411AD775F8CDp-21, -0x1.22E566166C233p-19, -0x1.434C756B0A3BCp-20, 0x1.BB98E64EF1AEFp-19, 0x1.04829886B8CCDp-19, -0x1.5A915838854CDp-19,
+		  0x1.11E0C72C92E55p-20, 0x1.C4F9D232BD15Ep-18, 0x1.4308C3F880C9Bp-16, 0x1.FD386D4C0A7E1p-16, 0x1.F15969B24AFB5p-16, 0x1.469F73C58DBB8p-16, 0x1.3944D9687BD7Dp-17, 0x1.DDD7D16EE2A99p-19, 0x1.13DC06A110515p-20 },
+		{ -0x1.E51F79FA4999Ap-29, -0x1.3831257521111p-26, 0x1.DFB5FE425DDDEp-29, 0x1.30715303FAEEFp-24, 0x1.B9C3D5628999Ap-25, -0x1.5F929B9C8A222p-23, -0x1.D8AC4ECA31111p-24, 0x1.36E2739F25555p-22, -0x1.3F1EB98B4F777p-23,
+		  -0x1.F4B20AF015111p-25, -0x1.30B126836F800p-21, -0x1.222A85FD56566p-19, -0x1.264E374BB534Fp-18, -0x1.6A21F76A88926p-18, -0x1.270B547BFA9E3p-18, -0x1.58F2D4529E370p-19, -0x1.371F7BAD9CFC1p-20, -0x1.91912DEDE6B52p-22 },
+		{ 0x1.7418CA59DDDDEp-33, 0x1.34D7E2FAF7777p-31, -0x1.7FCFA492BBBBCp-30, -0x1.920C1D7E1999Ap-29, 0x1.4384B4C366666p-28, 0x1.0BEF2CC940000p-27, -0x1.38D6C6079DDDEp-26, 0x1.919BFDEB4CCCDp-27, -0x1.82BE9E23EEEEFp-28,
+		  0x1.C3A068AD8CCCDp-29, 0x1.8834AC7849DDEp-25, 0x1.E7E03AC0C9800p-23, 0x1.37E23ABBFC811p-21, 0x1.D9FDC90EE041Ap-21, 0x1.D5C4B7498F03Ap-21, 0x1.484D22E37FCEFp-21, 0x1.57F6F6A24A567p-22, 0x1.E9F10AD313FA3p-24 },
+		{ -0x1.174F6BE888889p-37, -0x1.5D48D06EEEEEFp-37, 0x1.A70A652666666p-34, -0x1.56638EEEEEEEFp-36, -0x1.CB64C87555555p-32, 0x1.2A14CA8888889p-31, 0x1.40A7B30000000p-33, -0x1.A167509DDDDDEp-31, 0x1.64D8033333333p-34,
+		  -0x1.95B0269555555p-33, -0x1.E643E79CBBBBCp-29, -0x1.83BEFEAE0BBBCp-26, -0x1.332DFC4352666p-24, -0x1.1B91E03DEA1DEp-23, -0x1.504301C0E76DEp-23, -0x1.1458EB72614AFp-23, -0x1.4B3A80E6C29D1p-24, -0x1.017D1249FBE5Fp-25 },
+		{ 0x1.9CCEFAEEEEEEFp-42, -0x1.626BB00000000p-42, -0x1.0D1AC7BBBBBBCp-38, 0x1.754EA97777777p-37, 0x1.BBE2155555555p-39, -0x1.9C13205555555p-35, 0x1.C3D782DDDDDDEp-34, -0x1.204CA94CCCCCDp-33, 0x1.843BC0EEEEEEFp-35,
+		  0x1.6F1A7CDDDDDDEp-37, 0x1.241717B3BBBBCp-32, 0x1.258DC642F7777p-29, 0x1.1BF75E858999Ap-27, 0x1.39F0A9945D111p-26, 0x1.B7159E4718333p-26, 0x1.A250F55BF4200p-26, 0x1.1B0784DA3095Ap-26, 0x1.DBC638F86F2C9p-28 },
+		{ -0x1.1CE19BBBBBBBCp-45, -0x1.9226E66666666p-44, -0x1.777659999999Ap-42, -0x1.8D94444444444p-40, 0x1.34B3777777777p-42, -0x1.DE11422222222p-39, -0x1.120FE66666666p-40, -0x1.37883CCCCCCCDp-37, 0x1.02CFB77777777p-39,
+		  -0x1.16866DDDDDDDEp-40, -0x1.59AD37AAAAAABp-36, -0x1.A9FE634777777p-33, -0x1.F0695678CCCCDp-31, -0x1.4481A96351111p-29, -0x1.084C4B8314444p-28, -0x1.203EDCDEBDEEFp-28, -0x1.B3483653FE511p-29, -0x1.8851C4D0C3C22p-30 },
+		{ -0x1.511CE66666666p-46, -0x1.8AD9155555555p-43, -0x1.06D1622222222p-41, -0x1.FB67EAAAAAAABp-41, -0x1.B9FF088888889p-40, -0x1.05C64AAAAAAABp-39, -0x1.DC2E59999999Ap-39, -0x1.AC996AAAAAAABp-39, -0x1.E3352EEEEEEEFp-39,
+		  -0x1.1B3A133333333p-41, 0x1.159EA55555555p-40, 0x1.2537AF6EEEEEFp-36, 0x1.9C24AC5222222p-34, 0x1.3B53F32288889p-32, 0x1.27C5BD5D95555p-31, 0x1.6D236A837F777p-31, 0x1.3085A8D2B0777p-31, 0x1.24310E7CD7800p-32 },
+		{ 0x1.7657DDDDDDDDEp-47, 0x1.A79BDDDDDDDDEp-44, 0x1.223CDDDDDDDDEp-42, 0x1.1A25111111111p-41, 0x1.C511DDDDDDDDEp-41, 0x1.487CBBBBBBBBCp-40, 0x1.A97ACCCCCCCCDp-40, 0x1.10C6BBBBBBBBCp-39, 0x1.293F444444444p-39,
+		  0x1.4198777777777p-42, 0x1.0291333333333p-43, -0x1.6FB44AAAAAAABp-40, -0x1.45B760CCCCCCDp-37, -0x1.216E07AAAAAABp-35, -0x1.356D7C4088889p-34, -0x1.ABDF91E055555p-34, -0x1.865F6F3424444p-34, -0x1.8C148A806BBBCp-35 },
+		{ 0x1.10DF777777777p-46, 0x1.2E72EEEEEEEEFp-43, 0x1.A0E6EEEEEEEEFp-42, 0x1.91F0222222222p-41, 0x1.464B555555555p-40, 0x1.D4F4AAAAAAAABp-40, 0x1.3580EEEEEEEEFp-39, 0x1.78C5777777777p-39, 0x1.A5AC222222222p-39,
+		  0x1.D5A0666666666p-42, 0x1.5AACEEEEEEEEFp-42, 0x1.3663666666666p-42, 0x1.0B127BBBBBBBCp-40, 0x1.FC0E8AAAAAAABp-39, 0x1.311929AAAAAABp-37, 0x1.D4401B2222222p-37, 0x1.CFCA7A0066666p-37, 0x1.EF0977949999Ap-38 },
+		{ -0x1.7E82222222222p-49, -0x1.AF68888888889p-46, -0x1.28D8888888889p-44, -0x1.1F02222222222p-43, -0x1.CF15555555555p-43, -0x1.4E8DDDDDDDDDEp-42, -0x1.B7F5555555555p-42, -0x1.0C25555555555p-41, -0x1.2C56666666666p-41,
+		  -0x1.4A07777777777p-44, -0x1.E660000000000p-45, -0x1.57E3333333333p-45, -0x1.AA6BBBBBBBBBCp-44, -0x1.B790888888889p-42, -0x1.28FF55DDDDDDEp-40, -0x1.F9FED72222222p-40, -0x1.1008FB9000000p-39, -0x1.316B0C5B33333p-40 },
+		{ -0x1.4CC6666666666p-48, -0x1.7141111111111p-45, -0x1.FCFDDDDDDDDDEp-44, -0x1.EAFAAAAAAAAABp-43, -0x1.8E31111111111p-42, -0x1.1EA5DDDDDDDDEp-41, -0x1.795AAAAAAAAABp-41, -0x1.CB7CCCCCCCCCDp-41, -0x1.016E666666666p-40,
+		  -0x1.1EC2AAAAAAAABp-43, -0x1.9E23333333333p-44, -0x1.B1F4444444444p-45, -0x1.B88EEEEEEEEEFp-47, 0x1.238D99999999Ap-45, 0x1.01BF733333333p-43, 0x1.E4F0391111111p-43, 0x1.170C879111111p-42, 0x1.463022599999Ap-43 }
+	},
+	{
+		{ 0x1.F0FE97F474B50p-9, 0x1.17D1E66A1ACB1p-5, 0x1.8544B6BAC0046p-4, 0x1.7E2289D03039Ap-3, 0x1.3C04B3ADD3B19p-2, 0x1.D68D8C4E6DBBAp-2, 0x1.4472D23D616CDp-1, 0x1.A0EB35F53A450p-1, 0x1.EAA77FEC3D833p-1,
+		  0x1.DE6B6A8A7EC94p-4, 0x1.3928EAF368950p-4, 0x1.0BA220D56AAC9p-5, 0x1.2972F743D7F82p-7, 0x1.AD74B4DB441CFp-10, 0x1.97D37B65450B0p-13, 0x1.0CB56304CD8F4p-16, 0x1.1F613BBA1A719p-20, 0x1.4DD4855792A43p-24 },
+		{ -0x1.3778F5CA5CF77p-12, -0x1.59D29E7766A0Ap-9, -0x1.D2AB14476E6DAp-8, -0x1.B2D7DDE317B09p-7, -0x1.4A54E218C2871p-6, -0x1.AB241451DD2CCp-6, -0x1.C9CEF10214140p-6, -0x1.5FC5BAC4444C8p-6, -0x1.B1DBD5242A2E8p-8,
+		  -0x1.450474EC749EFp-8, -0x1.587219893B490p-8, -0x1.09B6A84B1E2ABp-8, -0x1.FF0B802902F75p-10, -0x1.2E29BF675BCFCp-11, -0x1.C356BA8D6A2A3p-14, -0x1.C662374CDBBD8p-17, -0x1.665624D4CEACCp-20, -0x1.17CBC2D302D80p-23 },
+		{ 0x1.23A862146B9E4p-16, 0x1.38CC49D8E5491p-13, 0x1.863DD7EED5808p-12, 0x1.398E5BE689E5Fp-11, 0x1.641C655ECD1E4p-11, 0x1.B0D617EC61C9Cp-12, -0x1.6E4E4FCC87DDBp-12, -0x1.3D96F40DE742Fp-10, -0x1.7EB25EB8C706Cp-11,
+		  0x1.E862E8B53AD7Bp-13, 0x1.E85AF5130DEA0p-12, 0x1.207D534B9771Cp-11, 0x1.82B6EF09D0595p-12, 0x1.38BB991EC2D20p-13, 0x1.404764FBC7EE2p-15, 0x1.BC8C87E4960B1p-18, 0x1.DEE90386DBEE8p-21, 0x1.DDCC5AE2C6B32p-24 },
+		{ -0x1.E513806EF5A92p-21, -0x1.E7A684EA25067p-18, -0x1.0267A509A51C9p-16, -0x1.14FE89BBF000Ep-16, 0x1.028FA45A3ECCDp-25, 0x1.36BBB9F7596D6p-15, 0x1.07D7FDF129930p-14, -0x1.B21C7ACCC0D89p-19, -0x1.0B851DA0B7B67p-14,
+		  -0x1.868F355687DB8p-17, -0x1.47000F11E7EEFp-15, -0x1.0BB56DA26A7D5p-14, -0x1.E0FCFF9FC4306p-15, -0x1.01AFC7C2AF0A4p-15, -0x1.5C54372A32F61p-17, -0x1.3F0C14D06EA44p-19, -0x1.C111A5037C12Ep-22, -0x1.14100CF6B9CBFp-24 },
+		{ 0x1.768E9290A2FBCp-25, 0x1.518322B3A8E89p-22, 0x1.F90E9188872EFp-22, -0x1.203A008787000p-24, -0x1.8D6B9543B6CCDp-20, -0x1.31E7111CD1600p-19, 0x1.52F28C8D2CEABp-20, 0x1.5A3B53E9202CDp-18, -0x1.2147E12FE9D9Ap-18,
+		  0x1.3DF20213D7222p-21, 0x1.9A67E6C941E49p-19, 0x1.C41F6E2BD06DEp-18, 0x1.090777EE90784p-17, 0x1.6D1BA638AF516p-18, 0x1.3BBD86285406Fp-19, 0x1.719A14552942Bp-21, 0x1.48D4E45F1E914p-23, 0x1.E47317F30F50Ap-26 },
+		{ -0x1.17BB39BBB3BBCp-29, -0x1.A95B263546666p-27, -0x1.DA47011E60000p-28, 0x1.4144D5033999Ap-25, 0x1.46A186C990889p-24, -0x1.97920F908DDDEp-25, -0x1.258D0A937A222p-22, 0x1.41737D1074889p-22, -0x1.7BF050D70DDDEp-23,
+		  -0x1.085C48CCC8000p-25, -0x1.E9E63E759CCCDp-23, -0x1.632C288246DBCp-21, -0x1.09B37D5B24CA6p-20, -0x1.CC4D957FD134Ep-21, -0x1.F1D5F5242F30Cp-22, -0x1.6B5F77A2D7E51p-23, -0x1.8E352F169995Ep-25, -0x1.579B0F7475FEEp-27 },
+		{ 0x1.874FFAB2D5555p-34, 0x1.B85EE24E22222p-32, -0x1.FA87D2BF33333p-32, -0x1.52C6649480000p-29, -0x1.A1E2E6699999Ap-33, 0x1.4F441B7B6AAABp-27, -0x1.9BA49207EEEEFp-28, -0x1.0A1C4AB608889p-26, 0x1.6203AEC066666p-28,
+		  0x1.A6AC12496EEEFp-30, 0x1.19277FD3FB333p-26, 0x1.0750F0CB045DEp-24, 0x1.ED74C9D4F61DEp-24, 0x1.07FAD7FF84344p-23, 0x1.5E8103A8B232Bp-24, 0x1.38B535ADE59CCp-25, 0x1.9D21075F570F5p-27, 0x1.99CD7F7E2BA0Bp-29 },
+		{ -0x1.178F051333333p-38, -0x1.8D8001BBBBBBCp-37, 0x1.7C0B08D555555p-35, 0x1.1D3BD07333333p-34, -0x1.0EBD8A199999Ap-32, -0x1.DB7DA77777777p-33, 0x1.7F73111555555p-30, -0x1.97B4E18666666p-29, 0x1.0D4E551EEEEEFp-29,
+		  -0x1.61C7C00000000p-34, -0x1.37CEE08E88889p-30, -0x1.732744728CCCDp-28, -0x1.AD556891FC444p-27, -0x1.178D985D29333p-26, -0x1.C0A78C7180D9Ap-27, -0x1.E1048F0B4EE44p-28, -0x1.7822EB0CAC809p-29, -0x1.A627FBA76F431p-31 },
+		{ 0x1.A8272E2222222p-43, 0x1.63525DDDDDDDEp-42, -0x1.0A0DBEEEEEEEFp-39, 0x1.78CE12AAAAAABp-39, 0x1.1F271CEEEEEEFp-36, -0x1.159A57AAAAAABp-35, 0x1.F4AF095555555p-36, -0x1.179F164444444p-34, 0x1.FD7A7B1111111p-33,
+		  0x1.36DEA82222222p-38, 0x1.511F043111111p-34, 0x1.F5436F6311111p-32, 0x1.611FBB5D7BBBCp-30, 0x1.144410565DDDEp-29, 0x1.085C5F2396AABp-29, 0x1.4F9CD822FC777p-30, 0x1.31CAFE635D25Ep-31, 0x1.7F13F12D9B409p-33 },
+		{ -0x1.2DAC377777777p-46, -0x1.615DFBBBBBBBCp-44, -0x1.59AE444444444p-43, -0x1.AE5C777777777p-41, -0x1.B6EC911111111p-41, 0x1.6DFDA22222222p-40, -0x1.514DFBBBBBBBCp-37, 0x1.1F36A08888889p-36, 0x1.D9EE466666666p-37,
+		  -0x1.2EB6D77777777p-41, -0x1.742028CCCCCCDp-38, -0x1.46F1E86666666p-35, -0x1.146D8E0D55555p-33, -0x1.00D1B350CCCCDp-32, -0x1.218ED47C25555p-32, -0x1.ADA1FA4547333p-33, -0x1.C1D9C87F4FA22p-34, -0x1.36D577CE723DEp-35 },
+		{ -0x1.16120CCCCCCCDp-46, -0x1.44945DDDDDDDEp-43, -0x1.BEEDBBBBBBBBCp-42, -0x1.A72DE22222222p-41, -0x1.7093AEEEEEEEFp-40, -0x1.F72AC00000000p-40, -0x1.6BAB488888889p-39, -0x1.9D2FAAAAAAAABp-40, -0x1.CEDE000000000p-39,
+		  -0x1.04F64EEEEEEEFp-41, 0x1.D8D999999999Ap-50, 0x1.835BE9BBBBBBCp-39, 0x1.9BCD8ED111111p-37, 0x1.C3AF18A666666p-36, 0x1.28EDE17255555p-35, 0x1.FCEECF631999Ap-36, 0x1.2E6DB9C25F99Ap-36, 0x1.C8545919DC666p-38 },
+		{ 0x1.3B91777777777p-47, 0x1.66FF222222222p-44, 0x1.EF20888888889p-43, 0x1.E5E9555555555p-42, 0x1.90F6000000000p-41, 0x1.2203DDDDDDDDEp-40, 0x1.A06B777777777p-40, 0x1.F263111111111p-40, 0x1.1B7B99999999Ap-39,
+		  0x1.2487444444444p-42, 0x1.6102444444444p-43, -0x1.3C43777777777p-43, -0x1.21F359999999Ap-40, -0x1.7929415555555p-39, -0x1.1E84140777777p-38, -0x1.188DF77A00000p-38, -0x1.761F2282EAAABp-39, -0x1.3146399CF2222p-40 },
+		{ 0x1.C49FBBBBBBBBCp-47, 0x1.016D555555555p-43, 0x1.6479555555555p-42, 0x1.5B33333333333p-41, 0x1.1D9D777777777p-40, 0x1.A60399999999Ap-40, 0x1.1E7BBBBBBBBBCp-39, 0x1.679CCCCCCCCCDp-39, 0x1.A02EEEEEEEEEFp-39,
+		  0x1.A604EEEEEEEEFp-42, 0x1.1A80444444444p-42, 0x1.2987666666666p-43, 0x1.1D45911111111p-43, 0x1.36353CCCCCCCDp-42, 0x1.0687C00000000p-41, 0x1.2258707BBBBBCp-41, 0x1.AE51C22EAAAABp-42, 0x1.78FE1053BBBBCp-43 },
+		{ -0x1.41ACCCCCCCCCDp-49, -0x1.6DD6666666666p-46, -0x1.F8F3333333333p-45, -0x1.EFF7777777777p-44, -0x1.96D7777777777p-43, -0x1.2AF7777777777p-42, -0x1.9884444444444p-42, -0x1.021CCCCCCCCCDp-41, -0x1.2A4AAAAAAAAABp-41,
+		  -0x1.2A87777777777p-44, -0x1.97ACCCCCCCCCDp-45, -0x1.873BBBBBBBBBCp-46, -0x1.FAEEEEEEEEEEFp-47, -0x1.F457111111111p-46, -0x1.DA9C4AAAAAAABp-45, -0x1.28B483DDDDDDEp-44, -0x1.E8C24BA666666p-45, -0x1.CB8956C111111p-46 },
+		{ -0x1.149CCCCCCCCCDp-48, -0x1.3A57777777777p-45, -0x1.B351111111111p-44, -0x1.A80DDDDDDDDDEp-43, -0x1.5CD6666666666p-42, -0x1.01AF777777777p-41, -0x1.5DDEEEEEEEEEFp-41, -0x1.B9C2222222222p-41, -0x1.FE40000000000p-41,
+		  -0x1.01AD555555555p-43, -0x1.578DDDDDDDDDEp-44, -0x1.3D74CCCCCCCCDp-45, -0x1.6FADDDDDDDDDEp-47, 0x1.8E66666666666p-53, 0x1.6E22CCCCCCCCDp-48, 0x1.0E78EEEEEEEEFp-47, 0x1.E854C9BBBBBBCp-48, 0x1.E5FC86999999Ap-49 }
+	},
+	{
+		{ 0x1.AB607A306AABFp-9, 0x1.E2153D25F8BA6p-6, 0x1.508EBA21CCD8Dp-4, 0x1.4C68846814F87p-3, 0x1.157CCB57CB071p-2, 0x1.A31DC143AD104p-2, 0x1.27622B97A2419p-1, 0x1.887C2D457CEA4p-1, 0x1.E214CA7724D13p-1,
+		  0x1.B942FD0E6D4C5p-4, 0x1.14A1AFBBF8E86p-4, 0x1.AF943B54321FFp-6, 0x1.9C9812BCAE0EEp-8, 0x1.D8FAF45892E5Dp-11, 0x1.3D5B5282217E0p-14, 0x1.EE5C47796FBC8p-19, 0x1.E22604DBA4F2Ap-24, 0x1.A7BF5EBCC0311p-29 },
+		{ -0x1.F13CA2C192E32p-13, -0x1.15DABF6A5144Cp-9, -0x1.7C4666C7B4000p-8, -0x1.6AEEDE0F462B6p-7, -0x1.1E7D8EF2F0975p-6, -0x1.8A08C8751017Fp-6, -0x1.D40A218AD682Bp-6, -0x1.ACC7749E3BA4Cp-6, -0x1.5698E277328E7p-7,
+		  -0x1.100665B6BEC22p-8, -0x1.EF3D319AB5AD1p-9, -0x1.40BAEA88A848Cp-9, -0x1.FD355C64DEBAAp-11, -0x1.D7E5D00074DE0p-13, -0x1.F68BD8AEC0F2Bp-16, -0x1.35F26614E93D2p-19, -0x1.E2DC623A120D9p-24, -0x1.462B2B1D680FCp-28 },
+		{ 0x1.AFB345C95BD55p-17, 0x1.D696B4477342Dp-14, 0x1.308265265402Ap-12, 0x1.060EF89CA492Bp-11, 0x1.54ABAE64105A4p-11, 0x1.2F6716E4672E7p-11, 0x1.2E5862394558Bp-15, -0x1.1D7087600A118p-10, -0x1.41B3847FD9D48p-10,
+		  0x1.6F3ECD2954558p-13, 0x1.305C7F490A151p-12, 0x1.2DCBD479811EBp-12, 0x1.477D8FEFE4946p-13, 0x1.93AB2BF60EF5Fp-15, 0x1.20BC3B541424Ep-17, 0x1.EBE6BA5996D51p-21, 0x1.118D4C5C7591Fp-24, 0x1.044D541A40984p-28 },
+		{ -0x1.4EE4D0D917EFBp-21, -0x1.5C35501E50CEBp-18, -0x1.9191397996B4Dp-17, -0x1.0AD9645D9C059p-16, -0x1.2B0408C7BDB8Cp-17, 0x1.332C3B5EF6510p-16, 0x1.03A48A25D448Ep-14, 0x1.80E6A1722C151p-15, -0x1.AFACED2BCF2E1p-14,
+		  -0x1.09ECDF5DB5D05p-17, -0x1.69804A1FAF91Fp-16, -0x1.E5BF6939EE45Dp-16, -0x1.5963B94920FE3p-16, -0x1.15E91067A9566p-17, -0x1.04E966503F050p-19, -0x1.2826D3FF87D5Dp-22, -0x1.BFFB14EDBC9F7p-26, -0x1.1C8E8D23731A0p-29 },
+		{ 0x1.DB53E917DF4CDp-26, 0x1.C6E6149808600p-23, 0x1.9C7D636976F9Ap-22, 0x1.81755EB053CCDp-23, -0x1.A3DE7164EEE66p-21, -0x1.2E6148A1EDAEFp-19, -0x1.81FC221E27089p-20, 0x1.AEA29341E0A11p-18, -0x1.489A8E40B9DBCp-18,
+		  0x1.80C4BF8BFE800p-22, 0x1.954206742D02Bp-20, 0x1.67BB93E74E6AFp-19, 0x1.48D21E8A28D51p-19, 0x1.50955A5F59F4Ap-20, 0x1.92C38D9765D29p-22, 0x1.27056D00C80C8p-24, 0x1.2487EA8F7DF35p-27, 0x1.DCA2A74941662p-31 },
+		{ -0x1.50ADE5DA20000p-30, -0x1.1E2C523D1F777p-27, -0x1.41C60CF402222p-27, 0x1.E9DA916FB7777p-27, 0x1.040198D7B5555p-24, 0x1.72F3C2144CCCDp-25, -0x1.ECDB5C1BF6666p-23, -0x1.EC88954580000p-24, 0x1.8FF708DB1AAABp-23,
+		  -0x1.2B935D11AC444p-26, -0x1.B10DACA602444p-24, -0x1.F1E324B709889p-23, -0x1.1F7D936D53A66p-22, -0x1.6F8B12854A16Fp-23, -0x1.12D24DD10067Dp-24, -0x1.FBE43276EBDD4p-27, -0x1.40F5E9864F675p-29, -0x1.44E968DB0C147p-32 },
+		{ 0x1.CF1AE3B466666p-35, 0x1.4AD08867DDDDEp-32, 0x1.7B7026A555555p-35, -0x1.60A727A322222p-30, -0x1.D899AD3A00000p-30, 0x1.676F36FCA2222p-28, 0x1.A7DF96B4D5555p-27, -0x1.92ADBE556AAABp-25, 0x1.297671D888889p-24,
+		  0x1.C1B5C13666666p-31, 0x1.BF25073835555p-28, 0x1.47E4510AC0AABp-26, 0x1.D61FA78270555p-26, 0x1.714DE7B26C0ABp-26, 0x1.53661E9E15E7Cp-27, 0x1.843154E98DEA7p-29, 0x1.3185D7A22DF09p-31, 0x1.7678C5A4ED43Bp-34 },
+		{ -0x1.3FDF19C444444p-40, 0x1.7C25C44444444p-45, 0x1.63AC601DDDDDEp-35, 0x1.F4C8B97333333p-34, 0x1.7FE3566666666p-35, -0x1.262BC9F777777p-32, 0x1.19C9FC3333333p-30, -0x1.AAC3DB5555555p-34, 0x1.0AA8E6F000000p-27,
+		  -0x1.8B77BDCCCCCCDp-36, -0x1.C144407222222p-32, -0x1.9F62A425AAAABp-30, -0x1.6B74F66EF7777p-29, -0x1.59E8612859111p-29, -0x1.8137065832AABp-30, -0x1.0C51E3A5A5022p-31, -0x1.01DDC06E442FCp-33, -0x1.766F442403BABp-36 },
+		{ 0x1.CA0B0FBBBBBBCp-43, 0x1.6F78A66666666p-40, 0x1.290F904444444p-39, 0x1.87D3AFBBBBBBCp-38, 0x1.769F286666666p-36, 0x1.D28469BBBBBBCp-36, -0x1.89F2CD3333333p-35, 0x1.E09C895555555p-32, 0x1.B65A668000000p-32,
+		  0x1.1BF5455555555p-38, 0x1.B26076C444444p-36, 0x1.EFF1D02F77777p-34, 0x1.09DB6966CCCCDp-32, 0x1.3067F1DAA0000p-32, 0x1.9633ADF244000p-33, 0x1.53DC294F8C5DEp-34, 0x1.880B73ABA5E00p-36, 0x1.4AFFB8FFDF14Dp-38 },
+		{ -0x1.6692488888889p-47, -0x1.15D6A66666666p-44, -0x1.E79E99999999Ap-44, -0x1.89293BBBBBBBCp-42, -0x1.DBDEFBBBBBBBCp-41, 0x1.220F733333333p-40, -0x1.9A883BBBBBBBCp-40, 0x1.330CB77777777p-36, -0x1.B5F1500000000p-36,
+		  -0x1.6576C44444444p-42, -0x1.E70C7D5555555p-40, -0x1.2AA897E666666p-37, -0x1.76F9BE099999Ap-36, -0x1.FC0056C99999Ap-36, -0x1.915F642F5DDDEp-36, -0x1.8E53937144444p-37, -0x1.0F9BEBB1BF889p-38, -0x1.066E8F9911977p-40 },
+		{ -0x1.0C1EEAAAAAAABp-46, -0x1.28C2D55555555p-43, -0x1.A0747BBBBBBBCp-42, -0x1.973259999999Ap-41, -0x1.55CC844444444p-40, -0x1.11BF822222222p-39, -0x1.244D955555555p-39, -0x1.AB710CCCCCCCDp-38, -0x1.77560EEEEEEEFp-37,
+		  -0x1.F7BA000000000p-42, -0x1.C446D55555555p-43, 0x1.0F8E1F7777777p-41, 0x1.F13CF1DDDDDDEp-40, 0x1.92A9F62888889p-39, 0x1.75E3C1F466666p-39, 0x1.B343C16DE2222p-40, 0x1.5A242F630D555p-41, 0x1.796B782A4799Ap-43 },
+		{ 0x1.0976777777777p-47, 0x1.2E03666666666p-44, 0x1.A325777777777p-43, 0x1.9BAC222222222p-42, 0x1.56A8333333333p-41, 0x1.FEA9333333333p-41, 0x1.5E1799999999Ap-40, 0x1.866F777777777p-40, 0x1.70A3777777777p-40,
+		  0x1.0C7B111111111p-42, 0x1.4EF3AAAAAAAABp-43, 0x1.A4E2666666666p-46, -0x1.233A4AAAAAAABp-43, -0x1.2F20DDDDDDDDEp-42, -0x1.49C20C0888889p-42, -0x1.BDBF494000000p-43, -0x1.9828FDB122222p-44, -0x1.EFCFE2C5C6666p-46 },
+		{ 0x1.8F0C888888889p-47, 0x1.B5BC000000000p-44, 0x1.319A666666666p-42, 0x1.2DF9777777777p-41, 0x1.F42AEEEEEEEEFp-41, 0x1.7834666666666p-40, 0x1.0594666666666p-39, 0x1.5851BBBBBBBBCp-39, 0x1.9783BBBBBBBBCp-39,
+		  0x1.8508000000000p-42, 0x1.FA5F777777777p-43, 0x1.9BB7111111111p-44, 0x1.344CCCCCCCCCDp-45, 0x1.00C96AAAAAAABp-45, 0x1.18A2215555555p-45, 0x1.AF43612AAAAABp-46, 0x1.C184364888889p-47, 0x1.2D1A800711111p-48 },
+		{ -0x1.13ADDDDDDDDDEp-49, -0x1.39CDDDDDDDDDEp-46, -0x1.B3F999999999Ap-45, -0x1.AD4AAAAAAAAABp-44, -0x1.6534444444444p-43, -0x1.0C43333333333p-42, -0x1.75C2222222222p-42, -0x1.E5D5555555555p-42, -0x1.23B5555555555p-41,
+		  -0x1.151DDDDDDDDDEp-44, -0x1.600DDDDDDDDDEp-45, -0x1.2476666666666p-46, -0x1.643EEEEEEEEEFp-48, -0x1.9FF7777777777p-49, -0x1.D5A7AAAAAAAABp-49, -0x1.9BF9122222222p-49, -0x1.E90DAB6666666p-50, -0x1.68F9074555555p-51 },
+		{ -0x1.E64EEEEEEEEEFp-49, -0x1.0B8AAAAAAAAABp-45, -0x1.7585555555555p-44, -0x1.70E7777777777p-43, -0x1.31B2222222222p-42, -0x1.CBA7777777777p-42, -0x1.4061111111111p-41, -0x1.A2ECCCCCCCCCDp-41, -0x1.F6B5555555555p-41,
+		  -0x1.DB80000000000p-44, -0x1.342BBBBBBBBBCp-44, -0x1.E75EEEEEEEEEFp-46, -0x1.EFE6666666666p-48, -0x1.121AAAAAAAAABp-50, 0x1.C633BBBBBBBBCp-53, 0x1.5C2D59999999Ap-52, 0x1.D76346EEEEEEFp-53, 0x1.78B0A4DDDDDDEp-54 }
+	},
+	{
+		{ 0x1.735DE695319B3p-9, 0x1.A357FB7E94BCAp-6, 0x1.2569B6587DFACp-4, 0x1.22E1E3FD700E8p-3, 0x1.E881E85EDE92Fp-3, 0x1.7458DA4604EDAp-2, 0x1.0A717C438B21Ap-1, 0x1.6BB18A91AF987p-1, 0x1.D467ED119F77Dp-1,
+		  0x1.99E3AD8C73B8Ap-4, 0x1.F3A1C77AD7146p-5, 0x1.6F0FE98DEC307p-6, 0x1.3D89CB3F473CCp-8, 0x1.37708FD0D55ADp-11, 0x1.47BB4125E603Bp-15, 0x1.5853B5DA24CB5p-20, 0x1.54A8507F07633p-26, 0x1.7FD5CDC61D808p-33 },
+		{ -0x1.93569055886CDp-13, -0x1.C4C42BC1D81ACp-10, -0x1.38CD0D70FCC7Fp-8, -0x1.2F741055E56BAp-7, -0x1.EBFCFC5221C03p-7, -0x1.619E6F168E048p-6, -0x1.C6840F9F71BE0p-6, -0x1.E80B57993010Bp-6, -0x1.12007B2215D12p-6,
+		  -0x1.CF5D2DAA23CABp-9, -0x1.7388157C585FEp-9, -0x1.9C4FC6DA41982p-10, -0x1.171FF8821381Dp-11, -0x1.ACEAF78DBC404p-14, -0x1.625DA070D5CAFp-17, -0x1.2A555487C1E9Dp-21, -0x1.F1FB3A5E19CEDp-27, -0x1.F85CD5383F5A3p-33 },
+		{ 0x1.458495EA9CBDCp-17, 0x1.66DA03C64664Ep-14, 0x1.DC48220C27CD4p-13, 0x1.AD87552B5558Bp-12, 0x1.31276FB121612p-11, 0x1.4F0D623099F79p-11, 0x1.778FE51C3BA71p-12, -0x1.641AF28D1CF37p-11, -0x1.F89F77FDABC64p-10,
+		  0x1.1B071D7B17D0Ap-13, 0x1.8F71E692B2C14p-13, 0x1.571D80491D1CCp-13, 0x1.3B3DFA23DF555p-14, 0x1.397CB57158ECBp-16, 0x1.500A24B31AD85p-19, 0x1.7C50B1410655Bp-23, 0x1.C857F88D0027Cp-28, 0x1.66789F6E03BEFp-33 },
+		{ -0x1.DC0231880D152p-22, -0x1.FAEBA9C695BEFp-19, -0x1.35E5D497E7B2Bp-17, -0x1.D6D202040ECC2p-17, -0x1.B2ED6806E3DDDp-17, 0x1.719083AA25F91p-19, 0x1.6E7D2E5CFC7E2p-15, 0x1.685204677DBF5p-14, -0x1.F2201CFF50614p-14,
+		  -0x1.79E423FE84EF2p-18, -0x1.A89418B6C921Fp-17, -0x1.E39E2760300BDp-17, -0x1.1BD35D0A20A24p-17, -0x1.69472A1292A88p-19, -0x1.F5DD57ABB9F7Fp-22, -0x1.7906F276414A0p-25, -0x1.39BC4CD49FC69p-29, -0x1.658E936844DE8p-34 },
+		{ 0x1.3D3D75E79869Ap-26, 0x1.3DC2A731C1822p-23, 0x1.49593B95C89BCp-22, 0x1.2F7159B91FC89p-22, -0x1.0836A4DB8E666p-22, -0x1.9FA8AB59A0200p-20, -0x1.71BECCC10A79Ap-19, 0x1.8B88CFC08D8ABp-19, 0x1.D8F0CE9F71377p-19,
+		  0x1.EFCDC9E7D0555p-23, 0x1.AD6260159CD00p-21, 0x1.3D7EEFCBF4CADp-20, 0x1.D75F58E814B6Bp-21, 0x1.787C2B4B5EE49p-22, 0x1.499C898197DC3p-24, 0x1.3E650FF2583B0p-27, 0x1.61D5213002C56p-31, 0x1.15E22465805A8p-35 },
+		{ -0x1.4EED3325F0889p-31, -0x1.1FD3A4130EEEFp-28, -0x1.398F493787777p-28, 0x1.6B09EBF8BBBBCp-27, 0x1.BD629F8FB8000p-25, 0x1.A07EE6B444CCDp-24, -0x1.FEDB29B0AAAABp-27, -0x1.0291E4A611111p-21, 0x1.CEBB00F684666p-20,
+		  -0x1.0F1018C8E3333p-27, -0x1.A0E6AE7277BBCp-25, -0x1.8C88A10BBD089p-24, -0x1.6D10C1F9AA222p-24, -0x1.66C3C5C4604DEp-25, -0x1.84C0EB12D5B20p-27, -0x1.D95F7DAF3EAA2p-30, -0x1.561566FAB30A0p-33, -0x1.63F6F0B43A97Dp-37 },
+		{ 0x1.E232D7C9DDDDEp-35, 0x1.CE3D09BB08889p-32, 0x1.B931831EBBBBCp-31, 0x1.A754515733333p-31, 0x1.A48F30E488889p-31, 0x1.469BB4FC88889p-28, 0x1.75E47EE6C6666p-26, 0x1.CA2C6CC888889p-32, 0x1.737D33A02BBBCp-23,
+		  0x1.E854CC9BAAAABp-31, 0x1.7B746C7DE2222p-29, 0x1.BBF8EB1D8999Ap-28, 0x1.0299D5868799Ap-27, 0x1.3A5CFB5487089p-28, 0x1.A2E2343AB3D9Ap-30, 0x1.3CFA5065CC1A4p-32, 0x1.23849A79E98AAp-35, 0x1.852EA18F9BC2Ep-39 },
+		{ 0x1.9BFA14E666666p-41, 0x1.8ECE4B2222222p-37, 0x1.D7FF567333333p-35, 0x1.3F30948888889p-33, 0x1.FE81E60888889p-33, 0x1.044B88C444444p-33, 0x1.19FAD70CCCCCDp-32, 0x1.8AB5437D55555p-28, 0x1.A75A88E666666p-32,
+		  0x1.95C3AC999999Ap-36, -0x1.6EC57CFAAAAABp-33, -0x1.11E0E80D22222p-31, -0x1.6F120E5EEAAABp-31, -0x1.06EE05215B333p-31, -0x1.A49294DB1EAABp-33, -0x1.84D30E2077EEFp-35, -0x1.BE4B9EB818F11p-38, -0x1.73F3EE278D3F1p-41 },
+		{ -0x1.8D8932AAAAAABp-44, -0x1.257DFE4444444p-40, -0x1.11F5C0EEEEEEFp-38, -0x1.2EAAF95555555p-37, -0x1.77595C8888889p-37, -0x1.0A80F9999999Ap-37, -0x1.61504EE666666p-34, 0x1.3EB8DA2222222p-36, -0x1.26FA197222222p-29,
+		  -0x1.15BED11111111p-43, 0x1.42EC498888889p-37, 0x1.242495B333333p-35, 0x1.DEDC1F9AAAAABp-35, 0x1.9C26E59500000p-35, 0x1.8AF258B6F1111p-36, 0x1.B96F09B2AF111p-38, 0x1.370692E66AF33p-40, 0x1.3C33D82D84FC4p-43 },
+		{ -0x1.D57F377777777p-45, -0x1.06651DDDDDDDEp-41, -0x1.71F7D9999999Ap-40, -0x1.872A022222222p-39, -0x1.78BB591111111p-38, -0x1.3B50FE6666666p-37, -0x1.93934EEEEEEEFp-37, -0x1.3148BACCCCCCDp-34, -0x1.3439A3EEEEEEFp-32,
+		  -0x1.28B55CCCCCCCDp-40, -0x1.492E1EEEEEEEFp-41, -0x1.0480AEEEEEEEFp-39, -0x1.223A8E5DDDDDEp-38, -0x1.322159F3BBBBCp-38, -0x1.5DEECCC055555p-39, -0x1.D3E5623BD5555p-41, -0x1.8EBD14E6AC444p-43, -0x1.E4985D24F8D55p-46 },
+		{ -0x1.0FBAD55555555p-46, -0x1.2FDCA44444444p-43, -0x1.B08E400000000p-42, -0x1.AEA5111111111p-41, -0x1.70F6955555555p-40, -0x1.2D5E266666666p-39, -0x1.C9E6688888889p-39, -0x1.9936911111111p-38, -0x1.8686DBBBBBBBCp-37,
+		  -0x1.0AAC977777777p-41, -0x1.EBF65DDDDDDDEp-43, 0x1.69CDD55555555p-44, 0x1.6879322222222p-42, 0x1.B92A86DDDDDDEp-42, 0x1.26CDD4099999Ap-42, 0x1.D21A659366666p-44, 0x1.D9E9283BB1111p-46, 0x1.522F34F520EEFp-48 },
+		{ 0x1.E2DD111111111p-48, 0x1.0D8EEEEEEEEEFp-44, 0x1.79CF777777777p-43, 0x1.75FC000000000p-42, 0x1.3A4D888888889p-41, 0x1.E093555555555p-41, 0x1.4FCA222222222p-40, 0x1.19AE333333333p-39, 0x1.479EBBBBBBBBCp-38,
+		  0x1.F870EEEEEEEEFp-43, 0x1.3329AAAAAAAABp-43, 0x1.85F599999999Ap-45, -0x1.BCADDDDDDDDDEp-47, -0x1.21ED855555555p-45, -0x1.D724917777777p-46, -0x1.B62DA34444444p-47, -0x1.0673777844444p-48, -0x1.B0BB708E7BBBCp-51 },
+		{ 0x1.57BDBBBBBBBBCp-47, 0x1.7CF2000000000p-44, 0x1.0C40000000000p-42, 0x1.07D8666666666p-41, 0x1.BBC6AAAAAAAABp-41, 0x1.50BB111111111p-40, 0x1.DF75333333333p-40, 0x1.4532CCCCCCCCDp-39, 0x1.D04E666666666p-39,
+		  0x1.6955BBBBBBBBCp-42, 0x1.C024444444444p-43, 0x1.4E0FDDDDDDDDEp-44, 0x1.4C53BBBBBBBBCp-46, 0x1.6677444444444p-48, 0x1.82CECCCCCCCCDp-49, 0x1.893C44EEEEEEFp-50, 0x1.111F518888889p-51, 0x1.00ABFB3BDDDDEp-53 },
+		{ -0x1.E4C8888888889p-50, -0x1.0DB3333333333p-46, -0x1.79BDDDDDDDDDEp-45, -0x1.75D1111111111p-44, -0x1.398BBBBBBBBBCp-43, -0x1.DC02222222222p-43, -0x1.518CCCCCCCCCDp-42, -0x1.C96CCCCCCCCCDp-42, -0x1.146CCCCCCCCCDp-41,
+		  -0x1.013EEEEEEEEEFp-44, -0x1.3D3AAAAAAAAABp-45, -0x1.E26AAAAAAAAABp-47, -0x1.C451111111111p-49, -0x1.67C3333333333p-51, -0x1.352C666666666p-52, -0x1.5C05D9999999Ap-53, -0x1.18F721DDDDDDEp-54, -0x1.2CA148ECCCCCDp-56 },
+		{ -0x1.A115555555555p-49, -0x1.CF38888888889p-46, -0x1.45FEEEEEEEEEFp-44, -0x1.40AAAAAAAAAABp-43, -0x1.0D7EEEEEEEEEFp-42, -0x1.98A0000000000p-42, -0x1.2224CCCCCCCCDp-41, -0x1.877BBBBBBBBBCp-41, -0x1.EDD3333333333p-41,
+		  -0x1.B861111111111p-44, -0x1.1158888888889p-44, -0x1.9713333333333p-46, -0x1.72C4444444444p-48, -0x1.7913333333333p-51, -0x1.063DDDDDDDDDEp-55, 0x1.E6AECCCCCCCCDp-57, 0x1.0171E11111111p-57, 0x1.33EF032222222p-59 }
+	},
+	{
+		{ 0x1.459B874F5359Bp-9, 0x1.6FE59F3D6AFF1p-6, 0x1.01C038DA6506Ep-4, 0x1.00162B3EDE129p-3, 0x1.AF8F60FB300F5p-3, 0x1.4AC354000CACBp-2, 0x1.DDDA55BC8D7BAp-2, 0x1.4C2B1020F321Ep-1, 0x1.BEEA1AFF54B9Fp-1,
+		  0x1.7EF858278034Ep-4, 0x1.CAB22B3E2E9F7p-5, 0x1.449FB9D368884p-6, 0x1.07CB46BC91F7Ap-8, 0x1.D4F26AD495E7Ep-12, 0x1.A636F8A389C6Ep-16, 0x1.5559734B40124p-21, 0x1.9B581FFA2061Fp-28, 0x1.32747A41B8FE4p-36 },
+		{ -0x1.4BF4AE6003422p-13, -0x1.75C24D9DCE153p-10, -0x1.03E6009AA8ED6p-8, -0x1.FDE5FFE5CD8F3p-8, -0x1.A4E94264345DAp-7, -0x1.37DD89FF40924p-6, -0x1.A7D953C858CA3p-6, -0x1.015B36F8B7A18p-5, -0x1.A2E65DA9CDEA3p-6,
+		  -0x1.908E08B459BA9p-9, -0x1.20AA7FE849759p-9, -0x1.15D53AEB1D1B5p-10, -0x1.45DC2A04BFE26p-12, -0x1.ADD2EC5608D0Cp-15, -0x1.25DEDDB0C2EE0p-18, -0x1.774C9C5AAF830p-23, -0x1.84252D080744Fp-29, -0x1.29998FC48C8FDp-36 },
+		{ 0x1.F3E470C23D10Cp-18, 0x1.15BB5DAD56A08p-14, 0x1.7731E33AAEEC7p-13, 0x1.5D83AC67B7667p-12, 0x1.079CE5A33E146p-11, 0x1.48E8312AE51F5p-11, 0x1.24A65091AC41Dp-11, -0x1.0C43617D984E4p-13, -0x1.37BE7A10445ADp-9,
+		  0x1.BDE10C6D18CD2p-14, 0x1.11868ADDA8864p-13, 0x1.A0EBA09EF0A87p-14, 0x1.508B7A36FA2A4p-15, 0x1.1BA21DB69479Ep-17, 0x1.E58E04B5CB88Dp-21, 0x1.8CCAF35521A79p-25, 0x1.1A742D6F555F3p-30, 0x1.5DD788C5FAD93p-37 },
+		{ -0x1.4E2A7961AB90Fp-22, -0x1.693BFA4C4A90Fp-19, -0x1.C9AED78367FDBp-18, -0x1.76F18BF80F6D6p-17, -0x1.A88CF098613D3p-17, -0x1.4F1753D528855p-18, 0x1.9A81555CF06B1p-16, 0x1.86AE02A090C7Bp-14, 0x1.072E4413DFACDp-20,
+		  -0x1.0915C32FD5C2Dp-18, -0x1.06D9CCE891E02p-17, -0x1.06F6D0589FFA2p-17, -0x1.075E330393230p-18, -0x1.13E1DA105949Cp-20, -0x1.2B1F3172E4520p-23, -0x1.3FB065099483Fp-27, -0x1.3B31664976574p-32, -0x1.2CFBB4088C8CCp-38 },
+		{ 0x1.0B5153E1C5155p-26, 0x1.1A40A60605AABp-23, 0x1.51C2CABDEB000p-22, 0x1.E78EBD5FD88CDp-22, 0x1.76FDCD4D8D444p-22, -0x1.4A32BEB49BAABp-22, -0x1.BFEBB3F6CD666p-20, -0x1.0FBC305FA72ABp-21, 0x1.D24D3823C7977p-16,
+		  0x1.BDD55DAA98044p-23, 0x1.DAFB658F6F9BCp-22, 0x1.21B289AE4EDABp-21, 0x1.6DE45867AAFBCp-22, 0x1.E3C91B537A915p-24, 0x1.4AFF3485B3E5Bp-26, 0x1.C511AE4C8A2FEp-30, 0x1.2AD69E7243A9Ap-34, 0x1.9FD3A8E583F68p-40 },
+		{ -0x1.27D5D109E6666p-35, 0x1.BA54BDB3D5555p-32, 0x1.623B295540000p-28, 0x1.81924E922AAABp-26, 0x1.15BE66706A666p-24, 0x1.2F0DDF7481555p-23, 0x1.B856DBDC6DDDEp-23, -0x1.179862017BBBCp-23, 0x1.3EB48D8F54DDEp-19,
+		  0x1.6BA0A690C8889p-29, -0x1.BD0CD248D9555p-26, -0x1.7BE67A5083889p-25, -0x1.17322F2FC4177p-25, -0x1.AA8B805052411p-27, -0x1.59BE5CAE2939Ap-29, -0x1.22E7F5CF2FF62p-32, -0x1.F1B3B7345ADF3p-37, -0x1.E387582150E46p-42 },
+		{ 0x1.6DA50D7444444p-36, 0x1.4DE7DADA66666p-33, 0x1.FE064414EEEEFp-33, -0x1.B75954F99999Ap-35, -0x1.D50661CA00000p-31, -0x1.FB86BBCE22222p-31, 0x1.F7279B7108889p-28, 0x1.3319105CF7777p-25, -0x1.BF020F6573BBCp-23,
+		  0x1.1FAE973F77777p-31, 0x1.5E89F590BBBBCp-30, 0x1.5211F92B94444p-29, 0x1.464EB24630889p-29, 0x1.3DF9B0B464222p-30, 0x1.415F474420DDEp-32, 0x1.519824318BF55p-35, 0x1.7338118023A46p-39, 0x1.E786E76FC211Ep-44 },
+		{ -0x1.10644E9D55555p-37, -0x1.3036C4819999Ap-34, -0x1.A3F317F555555p-33, -0x1.A39CCA0DDDDDEp-32, -0x1.7F118B5777777p-31, -0x1.745A85919999Ap-30, -0x1.929529999999Ap-29, -0x1.DEA1425777777p-29, -0x1.E2C38B3F22222p-25,
+		  -0x1.0E637C0444444p-33, -0x1.CA7E7AEEEEEEFp-35, -0x1.CBB9F92222222p-34, -0x1.5F659BD79999Ap-33, -0x1.C381509073333p-34, -0x1.1A16E0C594444p-35, -0x1.6C123DF7AA666p-38, -0x1.F8FEB8C529A66p-42, -0x1.B30F4CDABB677p-46 },
+		{ -0x1.BF759C0000000p-41, -0x1.0560C38000000p-37, -0x1.858C41D99999Ap-36, -0x1.A365896EEEEEFp-35, -0x1.816B6E0CCCCCDp-34, -0x1.44E5C87333333p-33, -0x1.2D84901333333p-32, -0x1.FE2490EEEEEEFp-31, -0x1.F56505EBBBBBCp-30,
+		  -0x1.20E63B5555555p-36, 0x1.B11B5D3333333p-38, 0x1.5E191C1BBBBBCp-36, 0x1.410BE64777777p-36, 0x1.67F7EC8FBBBBCp-37, 0x1.E52622EFDDDDEp-39, 0x1.7109BDD380000p-41, 0x1.3CA4C3B75FEEFp-44, 0x1.5CC2CAB106689p-48 },
+		{ 0x1.D0D89DDDDDDDEp-47, 0x1.161159999999Ap-43, 0x1.A781155555555p-42, 0x1.C3858CCCCCCCDp-41, 0x1.7E5E488888889p-40, 0x1.28ADC00000000p-39, 0x1.B8BE311111111p-38, 0x1.059545DDDDDDEp-36, 0x1.988CBC4888889p-31,
+		  -0x1.C7A8E66666666p-42, -0x1.971BBDDDDDDDEp-42, -0x1.707F177777777p-41, -0x1.1573052222222p-40, -0x1.BD0BD53333333p-41, -0x1.7A2E79E888889p-42, -0x1.5DBCD05C66666p-44, -0x1.70DD548C5CCCDp-47, -0x1.FC10CFB3C0777p-51 },
+		{ 0x1.D085333333333p-49, 0x1.2206111111111p-45, 0x1.D6B3911111111p-44, 0x1.2016B33333333p-42, 0x1.4609955555555p-41, 0x1.61A0622222222p-40, 0x1.7BA50AAAAAAABp-39, 0x1.7138F55555555p-37, 0x1.A97ADC6666666p-34,
+		  -0x1.5606555555555p-43, -0x1.21F0EAAAAAAABp-42, -0x1.86EC600000000p-43, -0x1.395CCCCCCCCCDp-48, 0x1.DDD63EEEEEEEFp-45, 0x1.190ECC5555555p-45, 0x1.3A73F2E000000p-47, 0x1.921E4DF32AAABp-50, 0x1.53455F8B84CCDp-53 },
+		{ 0x1.E67E000000000p-48, 0x1.13BAAAAAAAAABp-44, 0x1.86C799999999Ap-43, 0x1.8897555555555p-42, 0x1.51B7111111111p-41, 0x1.0C4999999999Ap-40, 0x1.9F6399999999Ap-40, 0x1.3CBF888888889p-39, -0x1.E8AD111111111p-41,
+		  0x1.0734666666666p-42, 0x1.0FCC555555555p-43, 0x1.098C444444444p-45, -0x1.961EEEEEEEEEFp-50, -0x1.6DE3555555555p-48, -0x1.A5F2C00000000p-49, -0x1.0DE116CCCCCCDp-50, -0x1.9BEF494777777p-53, -0x1.A1C5315091111p-56 },
+		{ 0x1.2637333333333p-47, 0x1.493599999999Ap-44, 0x1.CCB3DDDDDDDDEp-43, 0x1.CAE1111111111p-42, 0x1.811E000000000p-41, 0x1.2542888888889p-40, 0x1.A7F4222222222p-40, 0x1.1E48EEEEEEEEFp-39, 0x1.D77D555555555p-41,
+		  0x1.5184AAAAAAAABp-42, 0x1.9337777777777p-43, 0x1.22A9333333333p-44, 0x1.F68EEEEEEEEEFp-47, 0x1.1472AAAAAAAABp-49, 0x1.93A6EEEEEEEEFp-52, 0x1.C41B2CCCCCCCDp-54, 0x1.8F8F1A4444444p-56, 0x1.DF03DC3EEEEEFp-59 },
+		{ -0x1.A70EEEEEEEEEFp-50, -0x1.DE33333333333p-47, -0x1.50DBBBBBBBBBCp-45, -0x1.4E35555555555p-44, -0x1.19CCCCCCCCCCDp-43, -0x1.AFDDDDDDDDDDEp-43, -0x1.39A4444444444p-42, -0x1.B65BBBBBBBBBCp-42, -0x1.5A9AAAAAAAAABp-41,
+		  -0x1.E566666666666p-45, -0x1.1DA7777777777p-45, -0x1.98AEEEEEEEEEFp-47, -0x1.51CCCCCCCCCCDp-49, -0x1.5071111111111p-52, -0x1.5E0CCCCCCCCCDp-55, -0x1.756C888888889p-57, -0x1.7F64766666666p-59, -0x1.0F652C1DDDDDEp-61 },
+		{ -0x1.6A97777777777p-49, -0x1.95C2222222222p-46, -0x1.1C15DDDDDDDDEp-44, -0x1.1ADCCCCCCCCCDp-43, -0x1.DB6BBBBBBBBBCp-43, -0x1.6A81111111111p-42, -0x1.06B6EEEEEEEEFp-41, -0x1.68E4444444444p-41, -0x1.CFC3333333333p-41,
+		  -0x1.9CCEEEEEEEEEFp-44, -0x1.EBA4444444444p-45, -0x1.608DDDDDDDDDEp-46, -0x1.29E2222222222p-48, -0x1.0BEEEEEEEEEEFp-51, -0x1.00B7777777777p-55, 0x1.43DDDDDDDDDDEp-63, 0x1.4180A22222222p-62, 0x1.0EA771DDDDDDEp-64 }
+	},
+	{
+		{ 0x1.1FB98272D8382p-9, 0x1.4532D2FAFEBE0p-6, 0x1.C7FC2C33CD319p-5, 0x1.C59036F5D6859p-4, 0x1.7EDF8869BF805p-3, 0x1.264ECD6A7BFAFp-2, 0x1.AB5682E5F1F69p-2, 0x1.2C1CDEFEB69B2p-1, 0x1.A01F516924CD1p-1,
+		  0x1.678FCC027900Fp-4, 0x1.AA6CCC51355F4p-5, 0x1.2780B089DA8D7p-6, 0x1.CFA35B02585B7p-9, 0x1.85DCFEC6E4144p-12, 0x1.415B76E2C396Ep-16, 0x1.BF2BE54589A19p-22, 0x1.9089FDF395B8Dp-29, 0x1.09A4FA18E51CDp-38 },
+		{ -0x1.144357316B498p-13, -0x1.37AF0393AA268p-10, -0x1.B35C0F6170723p-9, -0x1.AE4092B86CEFDp-8, -0x1.67772E7D26ADFp-7, -0x1.0FB996D6D22D1p-6, -0x1.7F10C7E96DA4Fp-6, -0x1.F92545DA9BB21p-6, -0x1.16FA92A762491p-5,
+		  -0x1.5E2167D72987Cp-9, -0x1.CDFC06AAAF819p-10, -0x1.8514A82935AE5p-11, -0x1.8BAEC977E7915p-13, -0x1.C460CA06F9C59p-16, -0x1.08CC5E059E91Dp-19, -0x1.14F4C990E0B03p-24, -0x1.9D4505DBE6E15p-31, -0x1.280BAE214BF6Ap-39 },
+		{ 0x1.8F5E4A278793Ap-18, 0x1.BE8E842504155p-15, 0x1.31DB2B8EA62A4p-13, 0x1.242AC718ADE8Cp-12, 0x1.CCFEA19414027p-12, 0x1.3A8AAF53A3743p-11, 0x1.64E7C52F47EDEp-11, 0x1.B148084E5BEF6p-12, -0x1.A3FE558392260p-10,
+		  0x1.7053224E7B9E8p-14, 0x1.82ED3E03F425Bp-14, 0x1.057D2B46A065Ap-14, 0x1.7BDA2A6EC36F0p-16, 0x1.1B3C4D7115B3Fp-18, 0x1.9B9D5EA70C1A5p-22, 0x1.086782F08930Cp-26, 0x1.F83E70D2A4223p-33, 0x1.0F6FC2220FF46p-40 },
+		{ -0x1.98656A090FE12p-23, -0x1.BA7EC77B70FF1p-20, -0x1.19B0ADCE95A0Ep-18, -0x1.D1273818153D4p-18, -0x1.09BF49B495935p-17, -0x1.879FA75CE0B2Bp-19, 0x1.361CA8A06AB34p-16, 0x1.69FEC9D5CD2BAp-14, 0x1.0BDE10444A2FCp-12,
+		  -0x1.268CB9FD9AE69p-19, -0x1.5965F62B436D6p-18, -0x1.4A6C78951846Fp-18, -0x1.24B4F8FDE3114p-19, -0x1.022A8FA5064EBp-21, -0x1.C09B3217EAFFDp-25, -0x1.64FDC04C65965p-29, -0x1.C3AEF46D0E302p-35, -0x1.7805E5CF70338p-42 },
+		{ 0x1.D6D2EF8A0CB9Ap-27, 0x1.00C3F02F673CDp-23, 0x1.4C77DC0AD0600p-22, 0x1.1D94595D17F77p-21, 0x1.6E1C9FA3D1B11p-21, 0x1.2AA5A6C920D11p-21, -0x1.B1D1BD51D4222p-23, -0x1.7BF419BE8D59Ap-20, 0x1.A779E7DFA7B4Dp-16,
+		  0x1.CF94108D47377p-23, 0x1.0D349D7BE1222p-22, 0x1.F5FE066EE0A11p-23, 0x1.16A3BF76BD889p-23, 0x1.461A3BAF8470Bp-25, 0x1.79A682FF50CA1p-28, 0x1.9125B0C5DB0ADp-32, 0x1.5B9263273F539p-37, 0x1.B4E65EC8F7052p-44 },
+		{ -0x1.5691BD67A2222p-31, -0x1.709D33C08D555p-28, -0x1.CF2A73535A222p-27, -0x1.79090FE75F777p-26, -0x1.B9CFD2C6DDDDEp-26, -0x1.4A7D8E1B8AAABp-26, -0x1.14756089C0000p-26, -0x1.161869D360444p-22, -0x1.E8DB6D3FA63BCp-19,
+		  -0x1.CABA90F366666p-28, -0x1.BD3D74879BBBCp-27, -0x1.21BB345D9E777p-26, -0x1.86A76A8FB4D55p-27, -0x1.0997954FCA311p-28, -0x1.656F2C37321DEp-31, -0x1.C515E1123355Ep-35, -0x1.EFC728B0CA517p-40, -0x1.BA02982383741p-46 },
+		{ -0x1.E506F01E55555p-34, -0x1.1C842B8E44444p-30, -0x1.AD5D43737DDDEp-29, -0x1.DB8BAD4902222p-28, -0x1.CCA83E3E0AAABp-27, -0x1.9F0CD1D4C8889p-26, -0x1.5DC4592E64444p-25, -0x1.EF6AFE37EEEEFp-25, -0x1.18CDB3DD1B99Ap-21,
+		  -0x1.2305579FC4444p-29, 0x1.0AB5CD5B84444p-30, 0x1.44CABE3B7EEEFp-29, 0x1.8FB1DCE6E4889p-30, 0x1.EFADB64EC6AABp-32, 0x1.4FB121EBA7222p-34, 0x1.DBDA5E85B6E66p-38, 0x1.41010B085BF1Ep-42, 0x1.8C13ACAB32C6Fp-48 },
+		{ -0x1.9DA34ECCCCCCDp-39, -0x1.CB184EC666666p-36, -0x1.37C8574666666p-34, -0x1.2D17BE7BBBBBCp-33, -0x1.03968E6222222p-32, -0x1.E224CC2444444p-32, -0x1.239D1DBDDDDDEp-30, -0x1.7EC046699999Ap-29, 0x1.CB7ACD5F5DDDEp-25,
+		  -0x1.F57BE14000000p-34, -0x1.348CF96666666p-36, -0x1.3D734CD555555p-38, -0x1.1A3A96EE22222p-35, -0x1.916292751999Ap-36, -0x1.B4B78A279999Ap-38, -0x1.AA5F87656D555p-41, -0x1.7A3BE3302D111p-45, -0x1.3F9966A2597DEp-50 },
+		{ 0x1.18C7B8E222222p-39, 0x1.42D2D5F777777p-36, 0x1.D5902C9333333p-35, 0x1.F13FDCCEEEEEFp-34, 0x1.D04BF6F111111p-33, 0x1.A3F1AC0000000p-32, 0x1.8DEA809555555p-31, 0x1.A06A13C222222p-30, 0x1.84825A0A44444p-27,
+		  0x1.2319DE7777777p-35, -0x1.C83AA7DDDDDDEp-39, -0x1.FA4E6E1DDDDDEp-37, -0x1.1DD42FB000000p-38, 0x1.C4AC683BBBBBCp-41, 0x1.2454E17777777p-41, 0x1.79E8DA74A2222p-44, 0x1.A50A566B4B777p-48, 0x1.D67B96D54D333p-53 },
+		{ 0x1.63D08FBBBBBBCp-43, 0x1.9B79DEEEEEEEFp-40, 0x1.2E99FE2222222p-38, 0x1.445AD13333333p-37, 0x1.3104A84444444p-36, 0x1.117DDC6666666p-35, 0x1.FA7E102222222p-35, 0x1.286561AAAAAABp-33, -0x1.770421E666666p-31,
+		  0x1.FE65908888889p-39, -0x1.AC1B522222222p-41, -0x1.5701C66666666p-39, -0x1.6E544DB333333p-40, -0x1.9B759EA666666p-42, -0x1.4149363DDDDDEp-44, -0x1.5CEF7F0ACCCCDp-47, -0x1.BB5220135DDDEp-51, -0x1.3E57302E7D333p-55 },
+		{ -0x1.2268B55555555p-45, -0x1.4F80133333333p-42, -0x1.E4D5DAAAAAAABp-41, -0x1.FBD4811111111p-40, -0x1.CFDDA11111111p-39, -0x1.958BC22222222p-38, -0x1.72BC711111111p-37, -0x1.B139000000000p-36, -0x1.0979058000000p-32,
+		  -0x1.7751800000000p-41, -0x1.56A99DDDDDDDEp-43, 0x1.DD6F2EEEEEEEFp-44, 0x1.4C32180000000p-44, 0x1.8C2A666666666p-46, 0x1.7B98055555555p-48, 0x1.0C73BB599999Ap-50, 0x1.B14095DE88889p-54, 0x1.8E9BCBA2D999Ap-58 },
+		{ 0x1.C19AAAAAAAAABp-51, 0x1.D4C6666666666p-48, 0x1.C802222222222p-47, 0x1.1C20000000000p-47, -0x1.66D7777777777p-45, -0x1.B9CF777777777p-43, -0x1.7BD9BBBBBBBBCp-41, -0x1.5404DDDDDDDDEp-39, 0x1.F1DF99999999Ap-38,
+		  0x1.F28F333333333p-44, 0x1.1F62333333333p-43, 0x1.86FD777777777p-44, 0x1.0284400000000p-45, 0x1.2012044444444p-48, -0x1.378D99999999Ap-55, -0x1.6F62DEAAAAAABp-54, -0x1.9273E05DDDDDEp-57, -0x1.D049B16133333p-61 },
+		{ 0x1.0279BBBBBBBBCp-47, 0x1.2AAD333333333p-44, 0x1.A1A7DDDDDDDDEp-43, 0x1.A01BDDDDDDDDEp-42, 0x1.5E57BBBBBBBBCp-41, 0x1.0EE0EEEEEEEEFp-40, 0x1.8BBC888888889p-40, 0x1.21BC222222222p-39, 0x1.0345F77777777p-37,
+		  0x1.3B93555555555p-42, 0x1.7004EEEEEEEEFp-43, 0x1.0B40888888889p-44, 0x1.A451777777777p-47, 0x1.96E8CCCCCCCCDp-50, 0x1.FAE2CCCCCCCCDp-54, 0x1.87174CCCCCCCDp-57, 0x1.6F88684444444p-60, 0x1.FB18636666666p-64 },
+		{ -0x1.58E4444444444p-50, -0x1.8815555555555p-47, -0x1.113BBBBBBBBBCp-45, -0x1.0F72222222222p-44, -0x1.C38CCCCCCCCCDp-44, -0x1.562CCCCCCCCCDp-43, -0x1.DB82222222222p-43, -0x1.28A8888888889p-42, -0x1.D06EEEEEEEEEFp-42,
+		  -0x1.B5A0000000000p-45, -0x1.0CD0000000000p-45, -0x1.8E68888888889p-47, -0x1.5694444444444p-49, -0x1.4B8BBBBBBBBBCp-52, -0x1.504EEEEEEEEEFp-56, -0x1.55BB777777777p-60, -0x1.44A4E66666666p-63, -0x1.11FD7A1111111p-66 },
+		{ -0x1.368AAAAAAAAABp-49, -0x1.6606666666666p-46, -0x1.F470000000000p-45, -0x1.F20999999999Ap-44, -0x1.A29CCCCCCCCCDp-43, -0x1.424EEEEEEEEEFp-42, -0x1.D24CCCCCCCCCDp-42, -0x1.459999999999Ap-41, -0x1.EE9AAAAAAAAABp-41,
+		  -0x1.812AAAAAAAAABp-44, -0x1.C2A3333333333p-45, -0x1.45CDDDDDDDDDEp-46, -0x1.F7D8888888889p-49, -0x1.BEE2222222222p-52, -0x1.762EEEEEEEEEFp-56, -0x1.F1E2222222222p-62, 0x1.6FFC000000000p-67, 0x1.0648466666666p-69 }
+	},
+	{
+		{ 0x1.00233C6ECA30Ep-9, 0x1.2189C85FC7D53p-6, 0x1.961ABED483F59p-5, 0x1.942667EE87F97p-4, 0x1.556E42BCB2CB7p-3, 0x1.06C8591EDBD9Cp-2, 0x1.7E63573543126p-2, 0x1.0DB926E4800F2p-1, 0x1.7B26599D32A6Ap-1,
+		  0x1.530EE00AC767Ep-4, 0x1.90443776AB472p-5, 0x1.12AE2DBC8FAA5p-6, 0x1.A7FF4B845694Bp-9, 0x1.5B84D3B918F69p-12, 0x1.131214DFD5540p-16, 0x1.655C1B372B46Ep-22, 0x1.1769ABC5BFCC1p-29, 0x1.F1FD5394DBC06p-40 },
+		{ -0x1.CCB5E9F4D4F8Ap-14, -0x1.043571E69AAC0p-10, -0x1.6C6A4982C8315p-9, -0x1.69BE62061DCB0p-8, -0x1.30634472C154Fp-7, -0x1.D192BE12EDC27p-7, -0x1.4F115A2D7B433p-6, -0x1.CE5A302740656p-6, -0x1.2EB044B9B9451p-5,
+		  -0x1.32C2CD1EFACA7p-9, -0x1.7B90F9EBA8A6Dp-10, -0x1.1DDF3E4B19CB7p-11, -0x1.FA9848C3E0BC9p-14, -0x1.F2F4A084FE27Cp-17, -0x1.F357EA4150029p-21, -0x1.B646C7BAF1A9Fp-26, -0x1.026163ECFE187p-32, -0x1.C664C9598FA4Dp-42 },
+		{ 0x1.53E01BBD2AAB5p-18, 0x1.7E22B1C90000Fp-15, 0x1.08E991B90CAFCp-13, 0x1.0280A2191028Fp-12, 0x1.A71250B4C6BA8p-12, 0x1.34C23E1F523D0p-11, 0x1.9715EA6A6FC82p-11, 0x1.C4CCCB74BEFFFp-11, 0x1.650CD22136A63p-13,
+		  0x1.4A6EB5B376C7Cp-14, 0x1.172FC1BCF25B0p-14, 0x1.3B5ADC63AE5A4p-15, 0x1.95355998CB21Fp-17, 0x1.107DCA1D0296Bp-19, 0x1.61AAB91975C73p-23, 0x1.859F158142F51p-28, 0x1.1F6E13202BF55p-34, 0x1.5681F6EFC43DCp-43 },
+		{ -0x1.0372A05859245p-23, -0x1.19EFE6897ADD1p-20, -0x1.6979824949F62p-19, -0x1.2EDB63480FECFp-18, -0x1.67171E40C1B64p-18, -0x1.5BDCBCB9F8D11p-19, 0x1.619740B0FDC97p-17, 0x1.DCAAA6AE6BC35p-15, 0x1.1CD17F812F756p-12,
+		  -0x1.1DF723D39FF89p-20, -0x1.D8B67F6788CB1p-19, -0x1.C69095CC9F44Cp-19, -0x1.76777649B1AF7p-20, -0x1.24866557CB716p-22, -0x1.ABCC539C7CC1Ep-26, -0x1.0AFA4422D210Bp-30, -0x1.D21AD451BA8E1p-37, -0x1.7A38535E60583p-45 },
+		{ 0x1.54ABE3CE8199Ap-29, 0x1.470A48BB172ABp-26, 0x1.1CA4DCB15C444p-25, -0x1.16A2A0F63BBBCp-29, -0x1.8FED66435D6EFp-23, -0x1.8DCD34E520EEFp-21, -0x1.2AB58CA262077p-19, -0x1.AE13E7ABBFBEFp-18, -0x1.51543ADEEF15Ap-16,
+		  0x1.30DD31E298222p-25, 0x1.6BD1A80AFBD11p-23, 0x1.8B23B6740E500p-23, 0x1.7396C540BC0A2p-24, 0x1.54FD2CB95E54Bp-26, 0x1.2E91524D5E092p-29, 0x1.DC8836BD4A79Ep-34, 0x1.1655A79114D99p-39, 0x1.57E37EFAB74C9p-47 },
+		{ -0x1.55E9FED835555p-30, -0x1.8227D5F6AFDDEp-27, -0x1.0E651A15D1111p-25, -0x1.0CBB504168666p-24, -0x1.C6B687A352AABp-24, -0x1.629B8C7F24666p-23, -0x1.122D0863F2EEFp-22, -0x1.023E5146D8222p-21, -0x1.9D7E3D29F399Ap-19,
+		  -0x1.953AD62A06EEFp-26, -0x1.4873576F98889p-28, 0x1.4F41F41F11111p-29, 0x1.A33C1490EAAABp-33, -0x1.0350C31E56DDEp-31, -0x1.1014B27441089p-33, -0x1.63707595CCF22p-37, -0x1.336B7570796E2p-42, -0x1.1F56BD00FFA15p-49 },
+		{ 0x1.1F820D0344444p-34, 0x1.46ADF759B7777p-31, 0x1.D00C2E7691111p-30, 0x1.DA3B124126666p-29, 0x1.A779129BF7777p-28, 0x1.7013D3F571111p-27, 0x1.6462E7BF4EEEFp-26, 0x1.004714B921111p-24, 0x1.238E7E857B777p-21,
+		  0x1.5095540A22222p-31, 0x1.1AC1032C33333p-32, 0x1.DB157E8777777p-33, 0x1.E5414F3FAAAABp-33, 0x1.A301D9191199Ap-34, 0x1.344B0B6A0CEEFp-36, 0x1.8072434B0E911p-40, 0x1.6FCB81D5F6311p-45, 0x1.C074A7705F3F3p-52 },
+		{ 0x1.4D26DCFB33333p-36, 0x1.8095ED92AAAABp-33, 0x1.19A0DAA1BBBBCp-31, 0x1.2C1424B977777p-30, 0x1.17AF8F6E44444p-29, 0x1.ED80873F77777p-29, 0x1.B141C1D444444p-28, 0x1.88DA102ECCCCDp-27, 0x1.CE92B6E0DDDDEp-26,
+		  0x1.A382964BBBBBCp-32, -0x1.24B86B5EEEEEFp-34, -0x1.07EA899200000p-32, -0x1.0B73E1A59999Ap-33, -0x1.DF4CB08991111p-36, -0x1.B7003C466EEEFp-39, -0x1.A9D47FB07999Ap-43, -0x1.97292C6690889p-48, -0x1.3E11429D71444p-54 },
+		{ -0x1.38BAD6D555555p-40, -0x1.6AFC701555555p-37, -0x1.0CFA13E222222p-35, -0x1.24732F6888889p-34, -0x1.19B8B4DDDDDDEp-33, -0x1.06FD928BBBBBCp-32, -0x1.02394C1666666p-31, -0x1.3F4194699999Ap-30, -0x1.95215502AAAABp-27,
+		  -0x1.5C25531111111p-37, 0x1.767BFA4444444p-39, 0x1.F609E48888889p-38, 0x1.012F2E2AAAAABp-38, 0x1.0A7F5A74CCCCDp-40, 0x1.524056D59999Ap-43, 0x1.F809022522222p-47, 0x1.68EA09449BBBCp-51, 0x1.9B9DFC8794222p-57 },
+		{ -0x1.8C68ACAAAAAABp-42, -0x1.C8F266EEEEEEFp-39, -0x1.4DB853999999Ap-37, -0x1.62B7C55555555p-36, -0x1.4ADFD01111111p-35, -0x1.2707955555555p-34, -0x1.0C8597199999Ap-33, -0x1.0C092F0000000p-32, 0x1.2BC450CCCCCCDp-34,
+		  -0x1.FE080DDDDDDDEp-38, 0x1.98BDB33333333p-41, 0x1.06B3948888889p-38, 0x1.E7171D999999Ap-40, 0x1.5322C63BBBBBCp-42, 0x1.30DC96C666666p-46, -0x1.103A9FD555555p-51, -0x1.2F79F8EA00000p-54, -0x1.F5F41B2604444p-60 },
+		{ 0x1.E852E66666666p-47, 0x1.1DC8355555555p-43, 0x1.B414EAAAAAAABp-42, 0x1.F24F711111111p-41, 0x1.0167644444444p-39, 0x1.08B4C1999999Ap-38, 0x1.2AE6E3BBBBBBCp-37, 0x1.B70AA08888889p-36, 0x1.EC23DC2222222p-33,
+		  -0x1.2B1A444444444p-43, -0x1.095ED77777777p-42, -0x1.92F3000000000p-43, -0x1.D450F77777777p-45, -0x1.290E277777777p-48, 0x1.8198B6EEEEEEFp-51, 0x1.3764ECB333333p-53, 0x1.3C806A5444444p-57, 0x1.236D66AA08889p-62 },
+		{ 0x1.7AE9666666666p-47, 0x1.B451DDDDDDDDEp-44, 0x1.3AAF99999999Ap-42, 0x1.477DCCCCCCCCDp-41, 0x1.2869911111111p-40, 0x1.FC6EEEEEEEEEFp-40, 0x1.B62F800000000p-39, 0x1.9C2C333333333p-38, -0x1.6762DDDDDDDDEp-37,
+		  0x1.5AE4CCCCCCCCDp-42, 0x1.9F66AAAAAAAABp-44, -0x1.234D555555555p-45, -0x1.D484666666666p-46, -0x1.9DFE555555555p-48, -0x1.3CDEDEEEEEEEFp-51, -0x1.EF98955555555p-56, -0x1.2DEEA86666666p-60, -0x1.3ABCE84444444p-65 },
+		{ 0x1.A8A6666666666p-48, 0x1.E412AAAAAAAABp-45, 0x1.532B777777777p-43, 0x1.4E3399999999Ap-42, 0x1.162A888888889p-41, 0x1.A1D5777777777p-41, 0x1.1AC1DDDDDDDDEp-40, 0x1.3627777777777p-40, -0x1.B0B5111111111p-40,
+		  0x1.23D6AAAAAAAABp-42, 0x1.5AD8666666666p-43, 0x1.F972EEEEEEEEFp-45, 0x1.8DCEAAAAAAAABp-47, 0x1.55D9111111111p-50, 0x1.02FA666666666p-54, 0x1.DCAD555555555p-60, 0x1.8893777777777p-64, 0x1.3BDCE35555555p-68 },
+		{ -0x1.5E0EEEEEEEEEFp-50, -0x1.92DBBBBBBBBBCp-47, -0x1.1C60000000000p-45, -0x1.1CFDDDDDDDDDEp-44, -0x1.E6ECCCCCCCCCDp-44, -0x1.804EEEEEEEEEFp-43, -0x1.20BEEEEEEEEEFp-42, -0x1.B504444444444p-42, -0x1.F3DDDDDDDDDDEp-45,
+		  -0x1.B7E2222222222p-45, -0x1.ED2EEEEEEEEEFp-46, -0x1.2A4CCCCCCCCCDp-47, -0x1.72D5555555555p-50, -0x1.9100000000000p-54, -0x1.7CEEEEEEEEEEFp-62, 0x1.1D00000000000p-65, -0x1.0242666666666p-67, -0x1.3F8A355555555p-71 },
+		{ -0x1.146CCCCCCCCCDp-49, -0x1.3B21111111111p-46, -0x1.BB3DDDDDDDDDEp-45, -0x1.B82DDDDDDDDDEp-44, -0x1.734EEEEEEEEEFp-43, -0x1.1DDA222222222p-42, -0x1.9C1AAAAAAAAABp-42, -0x1.1EFAAAAAAAAABp-41, -0x1.7AD7777777777p-41,
+		  -0x1.692EEEEEEEEEFp-44, -0x1.A616666666666p-45, -0x1.2904444444444p-46, -0x1.C508888888889p-49, -0x1.7FA3333333333p-52, -0x1.28F4444444444p-56, -0x1.8CC7777777777p-62, -0x1.64BDDDDDDDDDEp-70, 0x1.1F524CCCCCCCDp-74 }
+	},
+	{
+		{ 0x1.CBBEC7088C681p-10, 0x1.03DC2302C169Ap-6, 0x1.6C83437B053C6p-5, 0x1.6AD0FA9A1B01Bp-4, 0x1.32968825DD94Ap-3, 0x1.D81E15F815C29p-3, 0x1.57BA7B21E0C8Bp-2, 0x1.E58A2A4C70C96p-2, 0x1.5693F3996973Ap-1,
+		  0x1.4124161CA3CFAp-4, 0x1.7A83D2854024Dp-5, 0x1.02E1E9FABCABAp-6, 0x1.8D62CE8DC3497p-9, 0x1.42E26ADAE8AD6p-12, 0x1.F837D0A92BADAp-17, 0x1.402B5E89E929Cp-22, 0x1.DF36B9F7BB7ACp-30, 0x1.79A7E3216C827p-40 },
+		{ -0x1.7DD392C53B171p-14, -0x1.AF8D212D64B0Dp-11, -0x1.2E8C48EE4833Fp-9, -0x1.2CEE4B003C470p-8, -0x1.FC097CF7B0488p-8, -0x1.868117AC228DEp-7, -0x1.1B82F594D57BCp-6, -0x1.8E533790EE88Bp-6, -0x1.14D59FF17656Bp-5,
+		  -0x1.0B3240C77F9A4p-9, -0x1.3F858ECF8816Cp-10, -0x1.C25B716A606DAp-12, -0x1.6A8C2F228F76Ap-14, -0x1.3BDBA81353060p-17, -0x1.106F7B37B68B7p-21, -0x1.8FD7F881ABFCDp-27, -0x1.770AFD804A1E0p-34, -0x1.C644639108C5Ap-44 },
+		{ 0x1.223C051C4834Ep-18, 0x1.477ED1C05F935p-15, 0x1.C998F4F6D29D5p-14, 0x1.C47FE6DDE7E97p-13, 0x1.7A72CB792AE1Dp-12, 0x1.1EA057194C695p-11, 0x1.95B3C323222D0p-11, 0x1.0E668355215F9p-10, 0x1.3AC15333328A0p-10,
+		  0x1.2CC8B02812264p-14, 0x1.9C36BF3F21D6Dp-15, 0x1.6DC503174615Ap-16, 0x1.840C5FB9B0EE2p-18, 0x1.C3DFC7A66BFE9p-21, 0x1.049331A0B6E09p-24, 0x1.FEF94030C9C8Ep-30, 0x1.4374261FCBEB8p-36, 0x1.175D507844293p-45 },
+		{ -0x1.1DA4DF58A9460p-23, -0x1.3E35C63A6E434p-20, -0x1.B0558C4F1373Ap-19, -0x1.96F1EDFC697AAp-18, -0x1.38BEDACCCCED4p-17, -0x1.952EF07C73A9Fp-17, -0x1.8F7E9F2EAAAFEp-17, -0x1.3D6793EA72400p-21, 0x1.2BA2E2697EA37p-14,
+		  -0x1.88528DFA367C0p-20, -0x1.3ADA4109DE1BDp-19, -0x1.FAD2A12021F3Fp-20, -0x1.7F46DC051D25Bp-21, -0x1.1612B881039C6p-23, -0x1.742B97BB9F67Cp-27, -0x1.995E0E17B6E2Ep-32, -0x1.2186973FD4EBEp-38, -0x1.26C6C2C979D5Dp-47 },
+		{ -0x1.8FDA799918800p-29, -0x1.EF71659FBFE66p-26, -0x1.9C9033DF33622p-24, -0x1.03E2015ABEF33p-22, -0x1.24FB87F477222p-21, -0x1.3CFFFB726FBDEp-20, -0x1.5B7C592B46522p-19, -0x1.A34173FD250CDp-18, -0x1.6880127EC45C9p-16,
+		  -0x1.8017E2B03999Ap-24, 0x1.09CD3F3D34F33p-23, 0x1.74C49061A4F00p-23, 0x1.4AFD3945DB2A2p-24, 0x1.05B5D6E8275CFp-26, 0x1.77E856437CF1Cp-30, 0x1.BFD58B48E50FBp-35, 0x1.637D71AB61343p-41, 0x1.C52C0F6CF6BB1p-50 },
+		{ 0x1.EF09DDDD13333p-33, 0x1.2EE8CA1A4B333p-29, 0x1.EE91851201111p-28, 0x1.3133637F55555p-26, 0x1.52BBBBBAFEEEFp-25, 0x1.6C30C0F2C0000p-24, 0x1.9285CFAB12666p-23, 0x1.F6F1BC3ADCEEFp-22, 0x1.E277BD25CA000p-20,
+		  0x1.B4AD083588889p-30, -0x1.588B7F00D3333p-28, -0x1.CE1E4BFBEC444p-28, -0x1.C4E393691D333p-29, -0x1.A051D2131F333p-31, -0x1.69EF9B2794EEFp-34, -0x1.10494EF9C6755p-38, -0x1.2199786BC264Dp-44, -0x1.17C2DAE197D5Cp-52 },
+		{ 0x1.AE1175583BBBCp-34, 0x1.EAB6B61D3BBBCp-31, 0x1.5EF24636B3333p-29, 0x1.68984EA744444p-28, 0x1.3FB886D733333p-27, 0x1.089A7E92F5555p-26, 0x1.AF9645D9F999Ap-26, 0x1.758C77C468889p-25, 0x1.D08B7A6D85555p-24,
+		  0x1.1DB666E1BBBBCp-29, -0x1.51DD7AE777777p-34, -0x1.E055866B9999Ap-31, -0x1.A2001E0394444p-32, -0x1.F3C802851EEEFp-35, -0x1.30C3A5B9CA222p-39, 0x1.B95BB44062AABp-44, 0x1.7246C58B162ABp-48, 0x1.4A94612E9E3ABp-55 },
+		{ -0x1.B798CECE66666p-37, -0x1.FA54A95555555p-34, -0x1.716582FD9999Ap-32, -0x1.884166A7BBBBCp-31, -0x1.6DF52A62EEEEFp-30, -0x1.47BCA500CCCCDp-29, -0x1.302B303D11111p-28, -0x1.4ED6A19F11111p-27, -0x1.6F429F1780000p-25,
+		  -0x1.A91EF08666666p-33, 0x1.45C5AC6222222p-36, 0x1.9DDB0EACCCCCDp-34, 0x1.6751692755555p-35, 0x1.B8B46EAB55555p-38, 0x1.1DF3CE33DDDDEp-42, -0x1.958544D511111p-47, -0x1.825BC7236EEEFp-51, -0x1.A6A029364C000p-58 },
+		{ -0x1.8D273C5555555p-41, -0x1.C5BD72BBBBBBCp-38, -0x1.44B3D38000000p-36, -0x1.4C92EB0888889p-35, -0x1.224368199999Ap-34, -0x1.C72D646EEEEEFp-34, -0x1.31C5628CCCCCDp-33, -0x1.89F0608888889p-35, 0x1.B9DDE29E66666p-29,
+		  -0x1.686C4AEEEEEEFp-36, 0x1.9DBB373333333p-39, 0x1.AA02CD3BBBBBCp-37, 0x1.AA0F1D5666666p-38, 0x1.68BCE5CF77777p-40, 0x1.20DF62BF11111p-43, 0x1.B3FFEF2133333p-48, 0x1.1F8813AB6AAABp-53, 0x1.0A9C4A276D555p-60 },
+		{ 0x1.1CB5DD999999Ap-42, 0x1.4895413333333p-39, 0x1.E13DD9999999Ap-38, 0x1.00B385CCCCCCDp-36, 0x1.E0B8B57777777p-36, 0x1.AD90943333333p-35, 0x1.85D6FD2222222p-34, 0x1.83D22FCCCCCCDp-33, 0x1.8829E26EEEEEFp-32,
+		  0x1.374055999999Ap-38, -0x1.B5DA3EEEEEEEFp-41, -0x1.787A8C2222222p-39, -0x1.632C696666666p-40, -0x1.13B6290444444p-42, -0x1.80B4774444444p-46, -0x1.DF5AF67555555p-51, -0x1.105EF5F511111p-56, -0x1.1F692A1400000p-63 },
+		{ -0x1.E512E66666666p-47, -0x1.11D32AAAAAAABp-43, -0x1.9460A22222222p-42, -0x1.B4CE000000000p-41, -0x1.A20E3BBBBBBBCp-40, -0x1.8B0E866666666p-39, -0x1.9676A77777777p-38, -0x1.1064100000000p-36, -0x1.AFD8D8EEEEEEFp-34,
+		  -0x1.46F1666666666p-42, -0x1.A556E66666666p-43, -0x1.57BB666666666p-44, -0x1.940A244444444p-46, -0x1.171C833333333p-48, -0x1.5F2AFC4444444p-52, -0x1.5B762CCCCCCCDp-59, 0x1.55439BF777777p-61, 0x1.03784202EEEEFp-66 },
+		{ 0x1.A488888888889p-56, -0x1.D655555555555p-52, -0x1.818CCCCCCCCCDp-48, -0x1.B730000000000p-46, -0x1.5C02AAAAAAAABp-44, -0x1.CFAC888888889p-43, -0x1.19FB555555555p-41, -0x1.3109333333333p-40, 0x1.A21A911111111p-38,
+		  0x1.A3E8CCCCCCCCDp-44, 0x1.F77C666666666p-44, 0x1.6774111111111p-44, 0x1.FD73555555555p-46, 0x1.5EF9B77777777p-48, 0x1.B7A8444444444p-52, 0x1.9F88311111111p-57, 0x1.BD93866666666p-65, -0x1.CE163B7777777p-70 },
+		{ 0x1.C11E222222222p-48, 0x1.EA6D111111111p-45, 0x1.5BEA444444444p-43, 0x1.5E44000000000p-42, 0x1.2A09111111111p-41, 0x1.D4A5555555555p-41, 0x1.645999999999Ap-40, 0x1.153599999999Ap-39, 0x1.D3E5DDDDDDDDEp-39,
+		  0x1.1D5AAAAAAAAABp-42, 0x1.4D08888888889p-43, 0x1.A04599999999Ap-45, 0x1.315B99999999Ap-47, 0x1.BB54444444444p-51, 0x1.3496CCCCCCCCDp-55, 0x1.8916666666666p-61, 0x1.A8F5444444444p-67, 0x1.FC44255555555p-73 },
+		{ -0x1.189999999999Ap-50, -0x1.3DD999999999Ap-47, -0x1.BC73333333333p-46, -0x1.B917777777777p-45, -0x1.73A8888888889p-44, -0x1.1D76666666666p-43, -0x1.A08EEEEEEEEEFp-43, -0x1.2EE2222222222p-42, -0x1.450DDDDDDDDDEp-41,
+		  -0x1.8828888888889p-45, -0x1.D668888888889p-46, -0x1.5660000000000p-47, -0x1.1E37777777777p-49, -0x1.09C3333333333p-52, -0x1.FDC8888888889p-57, -0x1.AFEDDDDDDDDDEp-62, -0x1.2A3B777777777p-68, -0x1.1D87666666666p-75 },
+		{ -0x1.02B999999999Ap-49, -0x1.1A08888888889p-46, -0x1.8E9DDDDDDDDDEp-45, -0x1.8EBBBBBBBBBBCp-44, -0x1.4F9DDDDDDDDDEp-43, -0x1.02D0000000000p-42, -0x1.7AF0000000000p-42, -0x1.0CE6666666666p-41, -0x1.741CCCCCCCCCDp-41,
+		  -0x1.561DDDDDDDDDEp-44, -0x1.984EEEEEEEEEFp-45, -0x1.0C5DDDDDDDDDEp-46, -0x1.A6D2222222222p-49, -0x1.5432222222222p-52, -0x1.07A0888888889p-56, -0x1.413CCCCCCCCCDp-62, -0x1.BFE3333333333p-70, 0x1.C7F2222222222p-80 }
+	},
+	{
+		{ 0x1.A04386935D3ACp-10, 0x1.D692221C4BD0Ap-7, 0x1.4A0C63ECC640Dp-5, 0x1.48861CB5CF9BDp-4, 0x1.15A00BFC21A75p-3, 0x1.AB8DAD7352AE5p-3, 0x1.375388CEED73Fp-2, 0x1.B7E2451141F87p-2, 0x1.36947460CF859p-1,
+		  0x1.319021FBB0762p-4, 0x1.680424FC0DCA8p-5, 0x1.EC101610B2566p-7, 0x1.7927BABC14CA8p-9, 0x1.31D094D5F339Ep-12, 0x1.DC0AC08D7EAF1p-17, 0x1.2CB68DD10270Fp-22, 0x1.BDC9746D96BFFp-30, 0x1.56C13725DAAE7p-40 },
+		{ -0x1.3C391EE9B7051p-14, -0x1.6577098FD236Ep-11, -0x1.F5657F7A57446p-10, -0x1.F303B03DF20B0p-9, -0x1.A59D8CF6E1BDEp-8, -0x1.448CDFBFDA67Dp-7, -0x1.D8688EC04F70Dp-7, -0x1.4D6ECEC64C0FCp-6, -0x1.D5C1EE7D09116p-6,
+		  -0x1.D06E96C67EC77p-10, -0x1.127146F3D5A52p-10, -0x1.798955A01B7C4p-12, -0x1.2471E3E1E2588p-14, -0x1.E1E6671A4B0F2p-18, -0x1.802C965EF73F2p-22, -0x1.F7CE36F244A6Bp-28, -0x1.8E147BD10B9E0p-35, -0x1.5FE4F2613B1B2p-45 },
+		{ 0x1.D463BFB941DC6p-19, 0x1.08A289526C91Fp-15, 0x1.72E19AD7CBA4Cp-14, 0x1.709CD204E2A64p-13, 0x1.36C6DE600EBD0p-12, 0x1.DCE094D6DD954p-12, 0x1.592EBC7A00EF5p-11, 0x1.E24D780BD572Fp-11, 0x1.4A98E6E43F66Fp-10,
+		  0x1.0102B1087CB04p-14, 0x1.3BAAFCFCB1014p-15, 0x1.D497A4E5F6B4Cp-17, 0x1.9635C403FE64Cp-19, 0x1.8440189ACB165p-22, 0x1.74E6FE2E723BAp-26, 0x1.342DBA043B0B5p-31, 0x1.47B8254F2D576p-38, 0x1.BD95262153D85p-48 },
+		{ -0x1.29EAA92F5ED58p-23, -0x1.4FA6C822B6639p-20, -0x1.D3788B74A8BADp-19, -0x1.CBBEF3A9403DAp-18, -0x1.7D32F70E38EAEp-17, -0x1.1CBA139934303p-16, -0x1.896627FE5AAF4p-16, -0x1.F28399AC26872p-16, -0x1.E1D3E357977E9p-16,
+		  -0x1.FEE8716A721A2p-20, -0x1.A1B78A179E191p-20, -0x1.C692BC1BE7C75p-21, -0x1.19D78E5A6B00Ap-22, -0x1.6C4C2B0D36051p-25, -0x1.C093AF40B5F03p-29, -0x1.C80062A8E564Dp-34, -0x1.22C4F7E0AF5BAp-40, -0x1.DD121F1DFE161p-50 },
+		{ 0x1.E4FC5FA2A0000p-30, 0x1.02FDAE014DB33p-26, 0x1.3E2A628FFC089p-25, 0x1.E36E8298E6889p-25, 0x1.A3AE80524E222p-25, -0x1.413576E64BBBCp-25, -0x1.63EEA15C74DDEp-22, -0x1.4CEC67090C3BCp-20, -0x1.4D2871AF26211p-18,
+		  -0x1.457E3A4652AABp-27, 0x1.42D49D7673889p-24, 0x1.6A9BFBD5F559Ap-24, 0x1.2CD0A5A194EF7p-25, 0x1.C298244184C77p-28, 0x1.2F5139375914Dp-31, 0x1.4950A96542389p-36, 0x1.BFB83D6CECDE4p-43, 0x1.95605F9B03776p-52 },
+		{ 0x1.D9123F4BF5DDEp-32, 0x1.13E4513F8A222p-28, 0x1.9C71407161111p-27, 0x1.C514FBAD44CCDp-26, 0x1.B7E0BB3AFB333p-25, 0x1.9945B7DF37777p-24, 0x1.831C79CBAC444p-23, 0x1.93680515D0CCDp-22, 0x1.2403D6FB52000p-20,
+		  0x1.3454B18B34444p-27, -0x1.1DF62BC39AAABp-28, -0x1.1F33AE21A1777p-27, -0x1.09769ABD6E777p-28, -0x1.A2AC5FA416000p-31, -0x1.258A224A32B77p-34, -0x1.4DB8E674D22CDp-39, -0x1.E5CD2519D12EFp-46, -0x1.F9EA1DCBFC233p-55 },
+		{ -0x1.405243CFE6666p-35, -0x1.75151CCE84444p-32, -0x1.163784E9CCCCDp-30, -0x1.30FC9A2CE6666p-29, -0x1.281F75606CCCDp-28, -0x1.1517AF5E7DDDEp-27, -0x1.0ADE070CEAAABp-26, -0x1.23A057D990000p-25, -0x1.E802B33DA8889p-24,
+		  -0x1.117856D211111p-31, 0x1.89C78B6533333p-33, 0x1.D0A608EF0CCCDp-32, 0x1.C7AFFF0E5999Ap-33, 0x1.80D889E2AEEEFp-35, 0x1.274FD2D36E222p-38, 0x1.7BE88DF261555p-43, 0x1.4AEA84B3D0000p-49, 0x1.D2F9FA48C1F77p-58 },
+		{ -0x1.786C432EEEEEFp-39, -0x1.AA379BF777777p-36, -0x1.2BAB194000000p-34, -0x1.2A8FBA5222222p-33, -0x1.F5480C399999Ap-33, -0x1.75DF828AAAAABp-32, -0x1.E01C07B99999Ap-32, -0x1.2F1CE87777777p-32, 0x1.C838EB7222222p-29,
+		  -0x1.4CC0264888889p-34, 0x1.90F8474444444p-38, 0x1.395E1C3DDDDDEp-35, 0x1.1896F55511111p-36, 0x1.7438133E22222p-39, 0x1.603FB61B33333p-43, 0x1.55D9391333333p-50, -0x1.5A6584B5BBBBCp-54, -0x1.545858BA1CCCDp-61 },
+		{ 0x1.E0BB864444444p-41, 0x1.14129C5333333p-37, 0x1.9051877777777p-36, 0x1.A44749DDDDDDEp-35, 0x1.8046085777777p-34, 0x1.4BA71ADBBBBBCp-33, 0x1.1DCE9A5555555p-32, 0x1.070BDC5CCCCCDp-31, 0x1.20902B999999Ap-30,
+		  0x1.2062B06EEEEEFp-36, -0x1.FD079C8888889p-40, -0x1.30B23ECEEEEEFp-37, -0x1.1DB83CFBBBBBCp-38, -0x1.A53F31BDDDDDEp-41, -0x1.FDCD22A4CCCCDp-45, -0x1.A3C265F19999Ap-50, -0x1.4A79728AAAAABp-58, 0x1.0E1E5C615DDDEp-64 },
+		{ -0x1.2A55748888889p-44, -0x1.5936A62222222p-41, -0x1.FB5D3AAAAAAABp-40, -0x1.1079DB3333333p-38, -0x1.025636CCCCCCDp-37, -0x1.D808FD5555555p-37, -0x1.BF874C0000000p-36, -0x1.ED683F5555555p-35, -0x1.BC461EBBBBBBCp-33,
+		  -0x1.2779D77777777p-40, -0x1.8AB2000000000p-45, 0x1.B02B433333333p-42, 0x1.ADF21D999999Ap-43, 0x1.3AEE5D999999Ap-45, 0x1.63C9544444444p-49, 0x1.A4D00BBBBBBBCp-55, -0x1.50F898C444444p-61, -0x1.52ADE03777777p-67 },
+		{ -0x1.A57C2AAAAAAABp-47, -0x1.DA31ECCCCCCCDp-44, -0x1.4DAF0CCCCCCCDp-42, -0x1.4E0E4CCCCCCCDp-41, -0x1.1B1EF44444444p-40, -0x1.AF42DBBBBBBBCp-40, -0x1.24AF777777777p-39, -0x1.03E439999999Ap-39, 0x1.A7F6A66666666p-37,
+		  -0x1.EDE8155555555p-42, -0x1.6D47155555555p-43, 0x1.3F65800000000p-46, 0x1.D001955555555p-46, 0x1.C872400000000p-48, 0x1.60F5D7BBBBBBCp-51, 0x1.BAF356AAAAAABp-56, 0x1.9831C9999999Ap-62, 0x1.CBC3C02666666p-70 },
+		{ 0x1.666FCCCCCCCCDp-48, 0x1.9B07AAAAAAAABp-45, 0x1.230CAAAAAAAABp-43, 0x1.26B4CCCCCCCCDp-42, 0x1.00A7D55555555p-41, 0x1.9B74222222222p-41, 0x1.40CD222222222p-40, 0x1.F211000000000p-40, 0x1.1AF3888888889p-39,
+		  0x1.AE06AAAAAAAABp-43, 0x1.A1BEEEEEEEEEFp-44, 0x1.4E38CCCCCCCCDp-46, -0x1.FE6BBBBBBBBBCp-51, -0x1.C109111111111p-51, -0x1.969A444444444p-54, -0x1.0938D55555555p-58, -0x1.C13AF11111111p-65, -0x1.CD48544444444p-73 },
+		{ 0x1.6F98888888889p-48, 0x1.9A8CEEEEEEEEFp-45, 0x1.1F1C222222222p-43, 0x1.1DA1DDDDDDDDEp-42, 0x1.E171333333333p-42, 0x1.70D5BBBBBBBBCp-41, 0x1.092EAAAAAAAABp-40, 0x1.6BA9777777777p-40, 0x1.D759DDDDDDDDEp-40,
+		  0x1.0712888888889p-42, 0x1.3B5E888888889p-43, 0x1.A81DBBBBBBBBCp-45, 0x1.5887DDDDDDDDEp-47, 0x1.19EE222222222p-50, 0x1.BBEDBBBBBBBBCp-55, 0x1.285B99999999Ap-60, 0x1.06C1333333333p-67, 0x1.6DE9555555555p-76 },
+		{ -0x1.0752222222222p-50, -0x1.2D9AAAAAAAAABp-47, -0x1.A651111111111p-46, -0x1.A39999999999Ap-45, -0x1.63E3333333333p-44, -0x1.10FDDDDDDDDDEp-43, -0x1.8F60000000000p-43, -0x1.16BCCCCCCCCCDp-42, -0x1.66DBBBBBBBBBCp-42,
+		  -0x1.7B00000000000p-45, -0x1.B95DDDDDDDDDEp-46, -0x1.2FD1111111111p-47, -0x1.BE71111111111p-50, -0x1.52EAAAAAAAAABp-53, -0x1.02CAAAAAAAAABp-57, -0x1.F5D999999999Ap-64, -0x1.0468888888889p-71, -0x1.5BFDDDDDDDDDEp-80 },
+		{ -0x1.C7CCCCCCCCCCDp-50, -0x1.FDE5555555555p-47, -0x1.6502222222222p-45, -0x1.63EEEEEEEEEEFp-44, -0x1.2CEB333333333p-43, -0x1.CFD4444444444p-43, -0x1.517BBBBBBBBBCp-42, -0x1.DC83333333333p-42, -0x1.515DDDDDDDDDEp-41,
+		  -0x1.4292222222222p-44, -0x1.8092222222222p-45, -0x1.0076EEEEEEEEFp-46, -0x1.9971111111111p-49, -0x1.483BBBBBBBBBCp-52, -0x1.F607777777777p-57, -0x1.3FD4444444444p-62, -0x1.E1CCCCCCCCCCDp-70, -0x1.6AF2222222222p-80 }
+	},
+	{
+		{ 0x1.7C1D564B10B75p-10, 0x1.ADB4C98EDC7F7p-7, 0x1.2D6347A41875Bp-5, 0x1.2BFF4FAB99A97p-4, 0x1.FB0A71E91292Ep-4, 0x1.866FA63B5AC00p-3, 0x1.1C4E0CE73DB6Cp-2, 0x1.91B81B0AD0782p-2, 0x1.1BA8B128666BDp-1,
+		  0x1.23FDD2EC5D0E4p-4, 0x1.5800E48BD421Ap-5, 0x1.D61C9C28CBF78p-7, 0x1.683F7F29A4425p-9, 0x1.2400F99A510A6p-12, 0x1.C64D559602CB9p-17, 0x1.1EBCDB2855CB3p-22, 0x1.A86E3AD9C9C24p-30, 0x1.452EAC7F126ABp-40 },
+		{ -0x1.084E9861C4EF9p-14, -0x1.2AC9C6688A473p-11, -0x1.A31FC00CECD5Ep-10, -0x1.A12EBD11E2092p-9, -0x1.608A72EDA0BCFp-8, -0x1.0F747BA5F28D3p-7, -0x1.8B4E300DED162p-7, -0x1.173F5FC894129p-6, -0x1.8A40DD245F366p-6,
+		  -0x1.9616890D8E4AEp-10, -0x1.DEA73BD085A73p-11, -0x1.4764187F0A5E0p-12, -0x1.F696993C04EA2p-15, -0x1.98661DB107B18p-18, -0x1.3EE44CDE192DBp-22, -0x1.94EA32B1A73C5p-28, -0x1.2EBAA59D16975p-35, -0x1.DA57BFD513AC5p-46 },
+		{ 0x1.6DB913BDD0C2Ep-19, 0x1.9D682240739A6p-16, 0x1.21E93D280D2BCp-14, 0x1.20802503766B4p-13, 0x1.E76BBD1541FC7p-13, 0x1.771B5DD415419p-12, 0x1.10E2CFDA94FD8p-11, 0x1.80F0554BABC87p-11, 0x1.0EBCD6B569D40p-10,
+		  0x1.A51DD52FFD230p-15, 0x1.F41BBA9041D61p-16, 0x1.5B724AD6E3E95p-17, 0x1.1172DBD75A191p-19, 0x1.CD1D54064CDEBp-23, 0x1.7BBEAF085EE94p-27, 0x1.04B76F982CE4Cp-32, 0x1.B8DEB61A95060p-40, 0x1.B2E742C9E50CAp-50 },
+		{ -0x1.E7BFAF061DA3Fp-24, -0x1.13844824FCAF6p-20, -0x1.81F79BFB442C6p-19, -0x1.7F568954FE23Bp-18, -0x1.42D8FB31F65D9p-17, -0x1.EE9A08A7DBB8Ap-17, -0x1.651B3D19EB636p-16, -0x1.F0C7465C05AE5p-16, -0x1.5154007478DF3p-15,
+		  -0x1.CD55C0E0C6E51p-20, -0x1.2531238592C44p-20, -0x1.CE76D58D335BAp-22, -0x1.B05559739F142p-24, -0x1.BF5CECC24EA0Fp-27, -0x1.CF4BAF5949385p-31, -0x1.98F7C793A0D44p-36, -0x1.C9C38DE74F0BDp-43, -0x1.3D9EE71E7DA6Dp-52 },
+		{ 0x1.0658C1F69DD9Ap-28, 0x1.2724EC9D13C44p-25, 0x1.99C6D1B1A4B33p-24, 0x1.90E7E48370CCDp-23, 0x1.49AE2B5CB5666p-22, 0x1.E60647948CB77p-22, 0x1.4828029240733p-21, 0x1.8C4B6AF279777p-21, 0x1.3CC48A7F782ABp-21,
+		  0x1.72EC72BD32222p-25, 0x1.7BE58740C5000p-25, 0x1.ECB748D893C44p-26, 0x1.5067FC8E88733p-27, 0x1.C961F21B91B77p-30, 0x1.20C4678FB8866p-33, 0x1.27F2F0F27AFEFp-38, 0x1.75EDD86E2B35Ep-45, 0x1.245022CE891B3p-54 },
+		{ 0x1.300954B4A2222p-36, 0x1.9CFD9ED6E6666p-33, 0x1.88AEFAE344444p-31, 0x1.18980F4048889p-29, 0x1.5D1745D78CCCDp-28, 0x1.937D1E5D5999Ap-27, 0x1.C83A4C1347777p-26, 0x1.0E58C40C91111p-24, 0x1.8F5554D86C889p-23,
+		  0x1.EEA20514C4444p-30, -0x1.26C111FD31111p-29, -0x1.A3C7C93228000p-29, -0x1.6BFDBA08E8889p-30, -0x1.13B39DC96D000p-32, -0x1.725800D70A222p-36, -0x1.8CC63328BD2ABp-41, -0x1.058FE4BDCBC44p-47, -0x1.B42F049AB5D55p-57 },
+		{ -0x1.7BA4962377777p-36, -0x1.B6EC136188889p-33, -0x1.4265293C08889p-31, -0x1.591894C380000p-30, -0x1.43BC116F22222p-29, -0x1.2073D2F64CCCDp-28, -0x1.02555696F5555p-27, -0x1.F3CF358C0CCCDp-27, -0x1.3B9AEF7718889p-25,
+		  -0x1.E6D0749D66666p-32, 0x1.19F10C29BBBBCp-33, 0x1.67A0AE6CE6666p-32, 0x1.51E83F0735555p-33, 0x1.0900B8E5D199Ap-35, 0x1.6D29428F18000p-39, 0x1.921F51A1E8444p-44, 0x1.13EA09D15B777p-50, 0x1.F39C0DE1C0889p-60 },
+		{ 0x1.3F09440333333p-39, 0x1.705AAD8222222p-36, 0x1.0DE5BAD99999Ap-34, 0x1.2009C47000000p-33, 0x1.0D8A319444444p-32, 0x1.E05B53D111111p-32, 0x1.B123AD3222222p-31, 0x1.AD62F505DDDDEp-30, 0x1.271D5860CCCCDp-28,
+		  0x1.49A240D111111p-35, -0x1.F214AB6666666p-38, -0x1.A4CBAAF99999Ap-36, -0x1.99B69CD555555p-37, -0x1.4A73C62F33333p-39, -0x1.D72E735444444p-43, -0x1.105F8BF600000p-47, -0x1.942D0D7D3BBBCp-54, -0x1.ABBD94749DDDEp-63 },
+		{ -0x1.07D22C0000000p-44, -0x1.369C9C0000000p-41, -0x1.D9F7737777777p-40, -0x1.0CABEBDDDDDDEp-38, -0x1.11652D999999Ap-37, -0x1.100DF73333333p-36, -0x1.1C224FF777777p-35, -0x1.5A668DE666666p-34, -0x1.50E9F8FDDDDDEp-32,
+		  0x1.8D8CC44444444p-45, 0x1.ADFA577777777p-43, 0x1.14AD44CCCCCCDp-42, 0x1.37DE6CAAAAAABp-43, 0x1.4E29713BBBBBCp-45, 0x1.4970602666666p-48, 0x1.0E4FDC3222222p-52, 0x1.279A74799999Ap-58, 0x1.FB35C7C911111p-67 },
+		{ -0x1.8EF43CCCCCCCDp-46, -0x1.C6A4E33333333p-43, -0x1.43641BBBBBBBCp-41, -0x1.49471EEEEEEEFp-40, -0x1.1E68B22222222p-39, -0x1.C967055555555p-39, -0x1.57B0366666666p-38, -0x1.D0B99AAAAAAABp-38, 0x1.08BC555555555p-42,
+		  -0x1.6AD7600000000p-41, -0x1.8D40BBBBBBBBCp-44, 0x1.8AA95AAAAAAABp-43, 0x1.AD8E7A2222222p-44, 0x1.4C3E58CCCCCCDp-46, 0x1.A264AE4444444p-50, 0x1.755D163333333p-55, 0x1.12AB2D999999Ap-62, -0x1.446A67F777777p-71 },
+		{ -0x1.A178555555555p-49, -0x1.D3FC777777777p-46, -0x1.37A8E66666666p-44, -0x1.2774D55555555p-43, -0x1.BB59111111111p-43, -0x1.1831444444444p-42, -0x1.0090D55555555p-42, 0x1.2D35555555555p-47, 0x1.9087F77777777p-41,
+		  -0x1.0600CAAAAAAABp-42, -0x1.8C142EEEEEEEFp-43, -0x1.94A98CCCCCCCDp-44, -0x1.D610FDDDDDDDEp-46, -0x1.226B0D5555555p-48, -0x1.4D0713BBBBBBCp-52, -0x1.3271A95555555p-57, -0x1.2E30C44444444p-64, -0x1.205E888888889p-79 },
+		{ 0x1.B2F5333333333p-49, 0x1.EE59333333333p-46, 0x1.58D1555555555p-44, 0x1.56A6444444444p-43, 0x1.1D42000000000p-42, 0x1.B181BBBBBBBBCp-42, 0x1.320B111111111p-41, 0x1.91CECCCCCCCCDp-41, 0x1.B359777777777p-41,
+		  0x1.57DC222222222p-43, 0x1.A290888888889p-44, 0x1.2CB8333333333p-45, 0x1.EB72000000000p-48, 0x1.BF83111111111p-51, 0x1.8592777777777p-55, 0x1.1CE5911111111p-60, 0x1.D3BC222222222p-68, -0x1.AC97333333333p-80 },
+		{ 0x1.4F7BBBBBBBBBCp-48, 0x1.7CA6222222222p-45, 0x1.095F99999999Ap-43, 0x1.09FF99999999Ap-42, 0x1.C04AAAAAAAAABp-42, 0x1.59ABDDDDDDDDEp-41, 0x1.F732000000000p-41, 0x1.64E7DDDDDDDDEp-40, 0x1.0070BBBBBBBBCp-39,
+		  0x1.FE85333333333p-43, 0x1.294CEEEEEEEEFp-43, 0x1.99AB333333333p-45, 0x1.369CEEEEEEEEFp-47, 0x1.021A777777777p-50, 0x1.8CF0222222222p-55, 0x1.07DEDDDDDDDDEp-60, 0x1.97D8CCCCCCCCDp-68, 0x1.91A5DDDDDDDDEp-78 },
+		{ -0x1.D8F999999999Ap-51, -0x1.0DBCCCCCCCCCDp-47, -0x1.7973333333333p-46, -0x1.798AAAAAAAAABp-45, -0x1.3D4AAAAAAAAABp-44, -0x1.EA86666666666p-44, -0x1.6580000000000p-43, -0x1.F8E4444444444p-43, -0x1.6683333333333p-42,
+		  -0x1.6513333333333p-45, -0x1.AA1999999999Ap-46, -0x1.250BBBBBBBBBCp-47, -0x1.BE4EEEEEEEEEFp-50, -0x1.7595555555555p-53, -0x1.1FE5555555555p-57, -0x1.700BBBBBBBBBCp-63, -0x1.1D77777777777p-70, -0x1.18DAAAAAAAAABp-80 },
+		{ -0x1.9A31111111111p-50, -0x1.D153333333333p-47, -0x1.4494444444444p-45, -0x1.452BBBBBBBBBCp-44, -0x1.1208888888889p-43, -0x1.A63999999999Ap-43, -0x1.331C444444444p-42, -0x1.B22999999999Ap-42, -0x1.32B199999999Ap-41,
+		  -0x1.37EC444444444p-44, -0x1.6B14444444444p-45, -0x1.F27999999999Ap-47, -0x1.78CBBBBBBBBBCp-49, -0x1.35CF777777777p-52, -0x1.D912222222222p-57, -0x1.329D555555555p-62, -0x1.C2F3333333333p-70, -0x1.512EEEEEEEEEFp-80 }
+	},
+	{
+		{ 0x1.5DB60D32DFC96p-10, 0x1.8B56134F96A93p-7, 0x1.15480EB8D0F28p-5, 0x1.14009B3D5CE27p-4, 0x1.D27C766082743p-4, 0x1.67355B8474E87p-3, 0x1.0590FB47EE149p-2, 0x1.7197641024E39p-2, 0x1.04F9B7F43BE25p-1,
+		  0x1.1812056BBFECAp-4, 0x1.49F4C07553BD6p-5, 0x1.C2E813B468E3Cp-7, 0x1.598555D4AB4A2p-9, 0x1.180DD0A4CD868p-12, 0x1.B3AE5EEF04A96p-17, 0x1.12F4C1647EC6Ap-22, 0x1.96EAFC55DEBA7p-30, 0x1.37A434714FB77p-40 },
+		{ -0x1.BF9B0305D6B44p-15, -0x1.FA0089C7ECCAFp-12, -0x1.62E666FDCB0A3p-10, -0x1.61431A6148137p-9, -0x1.2A8855AFF805Cp-8, -0x1.CBC189C221A7Fp-8, -0x1.4EC7B3B7F56DEp-7, -0x1.D9093D574B357p-7, -0x1.4E02CFD8C9984p-6,
+		  -0x1.66790EB6D54D9p-10, -0x1.A6591A22BFFE5p-11, -0x1.209E4CB3A5D2Ep-12, -0x1.BA69C196CF1C8p-15, -0x1.66B20123D915Cp-18, -0x1.1722FF857786Bp-22, -0x1.6090F791390D8p-28, -0x1.05310328A6A0Fp-35, -0x1.910D494871D03p-46 },
+		{ 0x1.1E3D8C0E21A1Fp-19, 0x1.4394EB703FD5Ep-16, 0x1.C5E63915E0551p-15, 0x1.C3CA6AFD67DAEp-14, 0x1.7DC75B4231737p-13, 0x1.25F591687A65Dp-12, 0x1.AC0EB31983E3Ep-12, 0x1.2E5C55613AC00p-11, 0x1.AAD1966FCEBDFp-11,
+		  0x1.57D2BF392FFCBp-15, 0x1.9588020319F45p-16, 0x1.15C318DDB86D4p-17, 0x1.AB5CA9FDAEAECp-20, 0x1.5C71632BA7D7Ap-23, 0x1.116E6736F315Bp-27, 0x1.5DD01FC2E1405p-33, 0x1.08C65495DFBBEp-40, 0x1.A91D87283C4C1p-51 },
+		{ -0x1.6BB503B66D67Cp-24, -0x1.9B1E6AED795ECp-21, -0x1.204B05648C6D4p-19, -0x1.1EDE59931C2D5p-18, -0x1.E49BC213E48DAp-18, -0x1.74E157B2BD7ADp-17, -0x1.0F32BBD6B2854p-16, -0x1.7E67AC95E4986p-16, -0x1.0CC33E739253Dp-15,
+		  -0x1.6B25CE1625551p-20, -0x1.B1747EDA03711p-21, -0x1.303FC962D03A9p-22, -0x1.E686BC125E737p-25, -0x1.A3445938BACDEp-28, -0x1.6352F52D57724p-32, -0x1.FA246D07BCBDCp-38, -0x1.C046F805439FAp-45, -0x1.D4167477D2B33p-55 },
+		{ 0x1.BAD8A28F7ACCDp-29, 0x1.F44244B006000p-26, 0x1.5E55E65BD9E66p-24, 0x1.5BD7ABBD6D489p-23, 0x1.24D2481AE4D55p-22, 0x1.C0508695E4489p-22, 0x1.4364EA399E59Ap-21, 0x1.C15269ED03266p-21, 0x1.30D476C90C59Ap-20,
+		  0x1.78EF1959B799Ap-25, 0x1.ECC7E8456A99Ap-26, 0x1.96C2E449C7222p-27, 0x1.8FB92323E7000p-29, 0x1.B0CCD14BBE333p-32, 0x1.D0E62B6C4A000p-36, 0x1.A534095AC3BBCp-41, 0x1.DDA63638530CDp-48, 0x1.4784AAECB90EFp-57 },
+		{ -0x1.A591DFD442222p-34, -0x1.D9FF9802BBBBCp-31, -0x1.48A620C257777p-29, -0x1.40E5CB0E74444p-28, -0x1.0718E39B92222p-27, -0x1.8223D844F7777p-27, -0x1.02F4E88B74444p-26, -0x1.35729DBFB999Ap-26, -0x1.EC97DBED51111p-27,
+		  -0x1.F107F2C55DDDEp-31, -0x1.3275E20D55555p-30, -0x1.B806C03F86666p-31, -0x1.39F5BFF0FBBBCp-32, -0x1.B30DFA1FE7777p-35, -0x1.1469888E8DDDEp-38, -0x1.1A80CA4815DDEp-43, -0x1.5FFF2B351E666p-50, -0x1.07F701C1C7222p-59 },
+		{ -0x1.63ED0ACEEEEEFp-40, -0x1.AF15EC8F77777p-37, -0x1.58EB721800000p-35, -0x1.9D55A4F333333p-34, -0x1.B8970ABAEEEEFp-33, -0x1.BFB2E2C0CCCCDp-32, -0x1.C62ACAD755555p-31, -0x1.E73BEDBF55555p-30, -0x1.3EC987CEE6666p-28,
+		  -0x1.2A0E10C2EEEEFp-34, 0x1.D221E3E6EEEEFp-35, 0x1.76AF289E44444p-34, 0x1.4A4DD8756EEEFp-35, 0x1.F53026696AAABp-38, 0x1.4EDD729DC4444p-41, 0x1.627553C9FCCCDp-46, 0x1.C833BFA09DDDEp-53, 0x1.6653ED6980000p-62 },
+		{ 0x1.709E436222222p-41, 0x1.A8A8D5B777777p-38, 0x1.35B0B88888889p-36, 0x1.47D1C16222222p-35, 0x1.2EBBB23333333p-34, 0x1.07F79E3DDDDDEp-33, 0x1.CA9C7D4000000p-33, 0x1.A70853D333333p-32, 0x1.E392328EEEEEFp-31,
+		  0x1.ED469C6666666p-37, -0x1.C511A08888889p-39, -0x1.4B36B22EEEEEFp-37, -0x1.3922312DDDDDEp-38, -0x1.E8C0941AAAAABp-41, -0x1.4CD4D75666666p-44, -0x1.67127B8155555p-49, -0x1.DA70168D9999Ap-56, -0x1.8884373E88889p-65 },
+		{ -0x1.4A16295555555p-44, -0x1.7B59EF999999Ap-41, -0x1.1456520000000p-39, -0x1.24218BBBBBBBCp-38, -0x1.0DABC7AAAAAABp-37, -0x1.D6BCAC2222222p-37, -0x1.9B0B721111111p-36, -0x1.814286DDDDDDEp-35, -0x1.CF85B0C444444p-34,
+		  -0x1.5844CA6666666p-40, 0x1.6F5C433333333p-42, 0x1.EC007A6666666p-41, 0x1.CFD4F65555555p-42, 0x1.6CB7BFAEEEEEFp-44, 0x1.F74125B333333p-48, 0x1.1557A13000000p-52, 0x1.7C673D6000000p-59, 0x1.54FEE52DDDDDEp-68 },
+		{ 0x1.97C9DDDDDDDDEp-51, 0x1.1193444444444p-47, 0x1.E1FB222222222p-46, 0x1.4A95555555555p-44, 0x1.8990EEEEEEEEFp-43, 0x1.C5C5111111111p-42, 0x1.04AED33333333p-40, 0x1.4531111111111p-39, 0x1.13A4D66666666p-37,
+		  -0x1.4A4A5DDDDDDDEp-43, -0x1.3F34D55555555p-43, -0x1.99BFECCCCCCCDp-44, -0x1.1972077777777p-45, -0x1.89C9044444444p-48, -0x1.077497BBBBBBCp-51, -0x1.26E9FCAAAAAABp-56, -0x1.AF66946666666p-63, -0x1.C23BAB7777777p-72 },
+		{ -0x1.7C05555555555p-48, -0x1.BF7B622222222p-45, -0x1.3B0DEAAAAAAABp-43, -0x1.3BF699999999Ap-42, -0x1.0B3BE88888889p-41, -0x1.A04BB77777777p-41, -0x1.356D600000000p-40, -0x1.C6AE844444444p-40, -0x1.7450F9999999Ap-39,
+		  -0x1.2F9BCEEEEEEEFp-42, -0x1.6DA02EEEEEEEFp-43, -0x1.0301266666666p-44, -0x1.83EAF33333333p-47, -0x1.473479999999Ap-50, -0x1.EEF119999999Ap-55, -0x1.0147E88888889p-60, -0x1.9878AAAAAAAABp-70, 0x1.17808AAAAAAABp-76 },
+		{ 0x1.A9F6EEEEEEEEFp-49, 0x1.DF27111111111p-46, 0x1.510BCCCCCCCCDp-44, 0x1.4E19DDDDDDDDEp-43, 0x1.1BE2666666666p-42, 0x1.B33599999999Ap-42, 0x1.3C59EEEEEEEEFp-41, 0x1.BFB2EEEEEEEEFp-41, 0x1.41A8AAAAAAAABp-40,
+		  0x1.5004AAAAAAAABp-43, 0x1.8AC2222222222p-44, 0x1.1674BBBBBBBBCp-45, 0x1.B306000000000p-48, 0x1.65FC000000000p-51, 0x1.2901EEEEEEEEFp-55, 0x1.8E77AAAAAAAABp-61, 0x1.3A6DEEEEEEEEFp-68, 0x1.7F57777777777p-79 },
+		{ 0x1.2712222222222p-48, 0x1.5B11777777777p-45, 0x1.E7C2666666666p-44, 0x1.E78AEEEEEEEEFp-43, 0x1.9AAC666666666p-42, 0x1.3CFF777777777p-41, 0x1.CF6A888888889p-41, 0x1.4745DDDDDDDDEp-40, 0x1.CD5ECCCCCCCCDp-40,
+		  0x1.DE39333333333p-43, 0x1.1D6D99999999Ap-43, 0x1.8D6EEEEEEEEEFp-45, 0x1.260C222222222p-47, 0x1.E7E1BBBBBBBBCp-51, 0x1.78DB777777777p-55, 0x1.C62F99999999Ap-61, 0x1.4512AAAAAAAABp-68, 0x1.061B333333333p-78 },
+		{ -0x1.B8B3333333333p-51, -0x1.F035555555555p-48, -0x1.5D3EEEEEEEEEFp-46, -0x1.5A0EEEEEEEEEFp-45, -0x1.2682222222222p-44, -0x1.C380000000000p-44, -0x1.484999999999Ap-43, -0x1.D062222222222p-43, -0x1.48A2222222222p-42,
+		  -0x1.592EEEEEEEEEFp-45, -0x1.91D5555555555p-46, -0x1.17A999999999Ap-47, -0x1.A9C6666666666p-50, -0x1.5033333333333p-53, -0x1.0B58888888889p-57, -0x1.52E7777777777p-63, -0x1.FC53333333333p-71, -0x1.786AAAAAAAAABp-81 },
+		{ -0x1.683BBBBBBBBBCp-50, -0x1.A776666666666p-47, -0x1.2976666666666p-45, -0x1.292EEEEEEEEEFp-44, -0x1.F4E3333333333p-44, -0x1.8265555555555p-43, -0x1.1A49111111111p-42, -0x1.8E90000000000p-42, -0x1.18EB333333333p-41,
+		  -0x1.2420888888889p-44, -0x1.5CA5555555555p-45, -0x1.E4D7777777777p-47, -0x1.693CCCCCCCCCDp-49, -0x1.2B35DDDDDDDDEp-52, -0x1.D164444444444p-57, -0x1.1B9E666666666p-62, -0x1.9CCAAAAAAAAABp-70, -0x1.4B68888888889p-80 }
+	},
+	{
+		{ 0x1.43CEA2397C787p-10, 0x1.6E0D7DA2F3163p-7, 0x1.00BE18555EEBEp-5, 0x1.FF1DCE6209369p-5, 0x1.AFEEB6DCBECD7p-4, 0x1.4C99E062A1819p-3, 0x1.E462196AECCD8p-3, 0x1.563712EDB846Dp-2, 0x1.E34A1EE7D0DD4p-2,
+		  0x1.0D7F81150FEAAp-4, 0x1.3D8014DD429E4p-5, 0x1.B1E2574DFBA53p-7, 0x1.4C79D3ACBA7F9p-9, 0x1.0D7ABC2375AE6p-12, 0x1.A33A37EEE69A3p-17, 0x1.0891C67314BB7p-22, 0x1.878A17C2754F9p-30, 0x1.2BDA4A2959FFAp-40 },
+		{ -0x1.7FC4F32B50F91p-15, -0x1.B1D67B3DF1130p-12, -0x1.304926AF95009p-10, -0x1.2EE1CCC898825p-9, -0x1.FFEAB4C8A1177p-9, -0x1.8A30F7BACB80Fp-8, -0x1.1F0A31FE42C7Ap-7, -0x1.9595BF3E4BBA3p-7, -0x1.1E640C20ED211p-6,
+		  -0x1.3F675116B9282p-10, -0x1.784C0C10BE5CAp-11, -0x1.011EB3422A3E4p-12, -0x1.8A0EF808D00A8p-15, -0x1.3F672B22654CDp-18, -0x1.F0EA373840652p-23, -0x1.399E2EE57F2A4p-28, -0x1.D02D781960CE7p-36, -0x1.638F4352720EDp-46 },
+		{ 0x1.C6CBC89B4EC90p-20, 0x1.0110B50A3AF74p-16, 0x1.6899D0532F332p-15, 0x1.66EFA8BF79FA8p-14, 0x1.2F53B341B927Dp-13, 0x1.D3236738AB9F5p-13, 0x1.5427778A58C48p-12, 0x1.E0A04C736A457p-12, 0x1.535D9EB8D58B9p-11,
+		  0x1.1BE274008B70Dp-15, 0x1.4E7E64FEEEE74p-16, 0x1.C93BD7395E414p-18, 0x1.5E86BCC7E124Dp-20, 0x1.1C4D667B6D784p-23, 0x1.BABB402EC75FEp-28, 0x1.17D4A1751A741p-33, 0x1.9F2D6DA79DC63p-41, 0x1.3F9B471782722p-51 },
+		{ -0x1.0D3DE0D1E873Bp-24, -0x1.305D65338B76Bp-21, -0x1.AAF0F6D5CD0DCp-20, -0x1.A8F4775F16C52p-19, -0x1.6719125806D7Ap-18, -0x1.147DD8BDC8396p-17, -0x1.929CDE35B91F9p-17, -0x1.1C60E3E8DBAC0p-16, -0x1.9169D8572503Ep-16,
+		  -0x1.1801659055D71p-20, -0x1.4A752CFB588C4p-21, -0x1.C53F77089BD2Bp-23, -0x1.5D6130756AAEFp-25, -0x1.1DB402D7BA8B7p-28, -0x1.C24E88B573355p-33, -0x1.21D8794EAE43Ep-38, -0x1.BB01B9E12616Bp-46, -0x1.69B6880A5C0F7p-56 },
+		{ 0x1.3C9C3DFB4F3BCp-29, 0x1.65E1AC3698A22p-26, 0x1.F5EB31173B555p-25, 0x1.F36F22F3CEE66p-24, 0x1.A5D7F20ABB333p-23, 0x1.44952113BBB33p-22, 0x1.D8240EB459A22p-22, 0x1.4CE2AF47ADA22p-21, 0x1.D40BA37E2EA22p-21,
+		  0x1.1EF22A9EF5444p-25, 0x1.578CD55C4F666p-26, 0x1.E53C2A495F555p-28, 0x1.87814D0EE4666p-30, 0x1.556E88DC80333p-33, 0x1.259C76E3CB222p-37, 0x1.A94F458EE9CCDp-43, 0x1.7F63DE24FFA22p-50, 0x1.957F7BC48C333p-60 },
+		{ -0x1.654C4EB691111p-34, -0x1.93A3252D55555p-31, -0x1.1AB280FCD8889p-29, -0x1.18BB49279CCCDp-28, -0x1.D8C7F58BEAAABp-28, -0x1.6A163C9A4CCCDp-27, -0x1.056B94D534444p-26, -0x1.6BE9E20377777p-26, -0x1.F0E7DCD993333p-26,
+		  -0x1.19DDB87126666p-30, -0x1.7476B7A1AAAABp-31, -0x1.387994CCF7777p-32, -0x1.380A29C12AAABp-34, -0x1.562791C51BBBCp-37, -0x1.72701047D5555p-41, -0x1.5061074935555p-46, -0x1.7B4D0B1215555p-53, -0x1.FC03729192AABp-63 },
+		{ 0x1.40186D499999Ap-39, 0x1.6820D8F59999Ap-36, 0x1.F40F767EEEEEFp-35, 0x1.E9682926EEEEFp-34, 0x1.92D5018D9999Ap-33, 0x1.29A77CC800000p-32, 0x1.94AD04CCCCCCDp-32, 0x1.F47D4CF111111p-32, 0x1.DEAACD1666666p-32,
+		  0x1.5338869CCCCCDp-36, 0x1.B58B6E9888889p-36, 0x1.405771CAEEEEFp-36, 0x1.CBF9B54C44444p-38, 0x1.3ECAEFB500000p-40, 0x1.93A09CED00000p-44, 0x1.994639B508889p-49, 0x1.F6335DCF08889p-56, 0x1.6B5FC8A102222p-65 },
+		{ 0x1.CC6A1CCCCCCCDp-46, 0x1.15FE355555555p-42, 0x1.BB02C6EEEEEEFp-41, 0x1.07DA315555555p-39, 0x1.1724404444444p-38, 0x1.18D9FECCCCCCDp-37, 0x1.19031C8888889p-36, 0x1.26DAF02222222p-35, 0x1.6F751E6666666p-34,
+		  0x1.D98C844444444p-40, -0x1.22C2426666666p-40, -0x1.FD945A6666666p-40, -0x1.C5A1037777777p-41, -0x1.581781BBBBBBCp-43, -0x1.C97DC4CCCCCCDp-47, -0x1.DF56381111111p-52, -0x1.2E8DE5AE66666p-58, -0x1.C63F5966EEEEFp-68 },
+		{ -0x1.6F9B066666666p-47, -0x1.ABDB7AAAAAAABp-44, -0x1.3A78488888889p-42, -0x1.50A4E33333333p-41, -0x1.3ADD76EEEEEEFp-40, -0x1.16FEE00000000p-39, -0x1.EAE1888888889p-39, -0x1.C816B22222222p-38, -0x1.FE1D144444444p-37,
+		  -0x1.32C1822222222p-43, 0x1.76DF7DDDDDDDEp-43, 0x1.094137BBBBBBCp-42, 0x1.CA5514CCCCCCDp-44, 0x1.5852C07777777p-46, 0x1.CAA17F4444444p-50, 0x1.E2F982A222222p-55, 0x1.350F9B0CCCCCDp-61, 0x1.DEF8391333333p-71 },
+		{ -0x1.6369088888889p-49, -0x1.87E3555555555p-46, -0x1.0D31800000000p-44, -0x1.012FAEEEEEEEFp-43, -0x1.9847222222222p-43, -0x1.18C5D55555555p-42, -0x1.4922088888889p-42, -0x1.0121111111111p-42, 0x1.8961BBBBBBBBCp-42,
+		  -0x1.99FD59999999Ap-43, -0x1.29BCAAAAAAAABp-43, -0x1.1B5EE22222222p-44, -0x1.3DA3155555555p-46, -0x1.80B5644444444p-49, -0x1.C64D155555555p-53, -0x1.C05315DDDDDDEp-58, -0x1.15E4340000000p-64, -0x1.B1F555DDDDDDEp-74 },
+		{ -0x1.7E33CCCCCCCCDp-48, -0x1.A961044444444p-45, -0x1.2A6DAAAAAAAABp-43, -0x1.28D2622222222p-42, -0x1.F7CFD11111111p-42, -0x1.8316EEEEEEEEFp-41, -0x1.1CD1EEEEEEEEFp-40, -0x1.9724088888889p-40, -0x1.29C9DDDDDDDDEp-39,
+		  -0x1.2D60977777777p-42, -0x1.5B14D9999999Ap-43, -0x1.CC6A044444444p-45, -0x1.56192AAAAAAABp-47, -0x1.F0AE622222222p-51, -0x1.6D31155555555p-55, -0x1.4D02D9999999Ap-61, -0x1.90FE333333333p-70, 0x1.0402A88888889p-78 },
+		{ 0x1.920FDDDDDDDDEp-49, 0x1.C17AAAAAAAAABp-46, 0x1.3BE399999999Ap-44, 0x1.3A4CDDDDDDDDEp-43, 0x1.0A24222222222p-42, 0x1.9993DDDDDDDDEp-42, 0x1.2A58111111111p-41, 0x1.A685555555555p-41, 0x1.2C40AAAAAAAABp-40,
+		  0x1.43C4111111111p-43, 0x1.7F82EEEEEEEEFp-44, 0x1.05ACAAAAAAAABp-45, 0x1.8D99111111111p-48, 0x1.3F23111111111p-51, 0x1.EE1F777777777p-56, 0x1.33EDEEEEEEEEFp-61, 0x1.B6CCEEEEEEEEFp-69, 0x1.1AA8CCCCCCCCDp-79 },
+		{ 0x1.21AE222222222p-48, 0x1.4315BBBBBBBBCp-45, 0x1.C504CCCCCCCCDp-44, 0x1.C1BAAAAAAAAABp-43, 0x1.7CB3DDDDDDDDEp-42, 0x1.2374888888889p-41, 0x1.A9E1555555555p-41, 0x1.2C8C444444444p-40, 0x1.A88F333333333p-40,
+		  0x1.D2C0AAAAAAAABp-43, 0x1.0FFA666666666p-43, 0x1.7226CCCCCCCCDp-45, 0x1.1F15555555555p-47, 0x1.C4DF99999999Ap-51, 0x1.7387555555555p-55, 0x1.C614EEEEEEEEFp-61, 0x1.55D3777777777p-68, 0x1.0638DDDDDDDDEp-78 },
+		{ -0x1.9A9BBBBBBBBBCp-51, -0x1.C966666666666p-48, -0x1.4191111111111p-46, -0x1.3FD6666666666p-45, -0x1.0ED3333333333p-44, -0x1.A068888888889p-44, -0x1.2F27777777777p-43, -0x1.AC6EEEEEEEEEFp-43, -0x1.2E88888888889p-42,
+		  -0x1.4A01111111111p-45, -0x1.882AAAAAAAAABp-46, -0x1.0BBDDDDDDDDDEp-47, -0x1.9844444444444p-50, -0x1.492EEEEEEEEEFp-53, -0x1.021999999999Ap-57, -0x1.4614444444444p-63, -0x1.E513333333333p-71, -0x1.7253333333333p-81 },
+		{ -0x1.60C8888888889p-50, -0x1.8A67777777777p-47, -0x1.1491111111111p-45, -0x1.128BBBBBBBBBCp-44, -0x1.D0C1111111111p-44, -0x1.6404444444444p-43, -0x1.03FBBBBBBBBBCp-42, -0x1.6F0EEEEEEEEEFp-42, -0x1.0357777777777p-41,
+		  -0x1.1CFD555555555p-44, -0x1.4C43333333333p-45, -0x1.C441111111111p-47, -0x1.5E7DDDDDDDDDEp-49, -0x1.158A222222222p-52, -0x1.C492222222222p-57, -0x1.162E666666666p-62, -0x1.A196666666666p-70, -0x1.3E69111111111p-80 }
+	},
+	{
+		{ 0x1.2D79C6239D097p-10, 0x1.54CEC7CDEF078p-7, 0x1.DE128A6E2A521p-6, 0x1.DBDDFA17B4A6Cp-5, 0x1.9224E39ED47CAp-4, 0x1.35A9C2DEF1828p-3, 0x1.C2FA40BCBAF75p-3, 0x1.3E9D399512DE6p-2, 0x1.C1F597BDEC3DFp-2,
+		  0x1.0409FEC39587Ep-4, 0x1.325B40F20E9C5p-5, 0x1.A2A7C137A3E64p-7, 0x1.40CE6761D3EF2p-9, 0x1.040555196C610p-12, 0x1.94833271C812Bp-17, 0x1.FE90C9E7C2FA7p-23, 0x1.79CBA32157BE2p-30, 0x1.215388C02BF79p-40 },
+		{ -0x1.4CA9A43D65C46p-15, -0x1.78104386F6078p-12, -0x1.07C393747861Bp-10, -0x1.068C17772126Bp-9, -0x1.BBBEB70BA8ABBp-9, -0x1.55B2725AAC44Ap-8, -0x1.F1A14E42ADDF8p-8, -0x1.5F92F2067ED88p-7, -0x1.F081A6A415901p-7,
+		  -0x1.1EF0843066A60p-10, -0x1.520C6CECFCBB4p-11, -0x1.CDF708EF052E6p-13, -0x1.61FE7E1C95721p-15, -0x1.1EEBCA67E1341p-18, -0x1.BE5CD3DDF3CDBp-23, -0x1.19B20772672AAp-28, -0x1.A0E33152EED61p-36, -0x1.3F45027BD0D75p-46 },
+		{ 0x1.6F12A225C8A0Ep-20, 0x1.9EF6833855348p-17, 0x1.230C17E382998p-15, 0x1.21B45E44AB1B1p-14, 0x1.E9A5125F44045p-14, 0x1.790A83FD29622p-13, 0x1.128D285814E97p-12, 0x1.83F04D8A7BFE3p-12, 0x1.11EE1FF593B7Bp-11,
+		  0x1.DAEDF794F5412p-16, 0x1.17C3D1835B2F6p-16, 0x1.7E539654331C2p-18, 0x1.24FB23A2FDB6Cp-20, 0x1.DAF763B6D50A2p-24, 0x1.717C65F11E970p-28, 0x1.D26C343ADFFF9p-34, 0x1.5936484E6E190p-41, 0x1.087E7C04B9BFAp-51 },
+		{ -0x1.9500657237C53p-25, -0x1.C9D6EEE6C26B1p-22, -0x1.411E904D4A133p-20, -0x1.3FA3061CB16FCp-19, -0x1.0E1DAEF4ECD9Ap-18, -0x1.9FFDC3BC7B235p-18, -0x1.2EE900EFB76BAp-17, -0x1.AC002D314EBA9p-17, -0x1.2E34CF142434Ep-16,
+		  -0x1.B4A6F9C2ECF40p-21, -0x1.01436395432A2p-21, -0x1.5FB52C80C7D9Ep-23, -0x1.0DAE6D82D1D1Ep-25, -0x1.B5977FE28D2DEp-29, -0x1.54DE0CA16F8EFp-33, -0x1.AF2ACB1C7C755p-39, -0x1.402CECC1A2895p-46, -0x1.EDDA9B9DE9A22p-57 },
+		{ 0x1.BE74AAA9874CDp-30, 0x1.F8B26AD714B33p-27, 0x1.61FA09FFA14CDp-25, 0x1.605491D4782ABp-24, 0x1.29BA9E2550EEFp-23, 0x1.CA7B48D514800p-23, 0x1.4DCFA735A7B33p-22, 0x1.D792328B0E222p-22, 0x1.4CD6ABFD43C44p-21,
+		  0x1.A4F5AFFCD4444p-26, 0x1.F0F1B36CEF99Ap-27, 0x1.54FD102731111p-28, 0x1.0713D7FE48555p-30, 0x1.AECDBE1BA8444p-34, 0x1.541825FD6A444p-38, 0x1.B6DA5FD5C2EEFp-44, 0x1.50765BD204222p-51, 0x1.13DB74DDF5555p-61 },
+		{ -0x1.E931D956F5555p-35, -0x1.147C30EF02222p-31, -0x1.83C6061397777p-30, -0x1.81DF448FA0000p-29, -0x1.45F2B879F999Ap-28, -0x1.F5A6C9178CCCDp-28, -0x1.6CEC3D24FDDDEp-27, -0x1.0161DEBBEAAABp-26, -0x1.6A35DC1671111p-26,
+		  -0x1.9D344162B3333p-31, -0x1.EEC5BF1DB3333p-32, -0x1.5D7936A09999Ap-33, -0x1.1A00324855555p-35, -0x1.EBC847661999Ap-39, -0x1.A6897C579999Ap-43, -0x1.314D1FB8A2222p-48, -0x1.11982368FBBBCp-55, -0x1.1CB4BF4F28889p-65 },
+		{ 0x1.02D6D86D9999Ap-39, 0x1.2472D4A733333p-36, 0x1.99C2FC2FBBBBCp-35, 0x1.971B2EB2AAAABp-34, 0x1.570DF90EAAAABp-33, 0x1.0709B7F777777p-32, 0x1.7C8A5FB6AAAABp-32, 0x1.09D2511F33333p-31, 0x1.6E57C17222222p-31,
+		  0x1.82B5E44333333p-36, 0x1.FAE43F2888889p-37, 0x1.A3E99C8000000p-38, 0x1.9D83F3A111111p-40, 0x1.BF6FA57D55555p-43, 0x1.DE2DF632AAAABp-47, 0x1.AC5F664911111p-52, 0x1.DACE284D55555p-59, 0x1.34A84509BBBBCp-68 },
+		{ -0x1.B05971DDDDDDEp-45, -0x1.E6FACF7777777p-42, -0x1.52D5933333333p-40, -0x1.4CE5FFBBBBBBCp-39, -0x1.13C2971111111p-38, -0x1.9BCCF1999999Ap-38, -0x1.1D2F8C8888889p-37, -0x1.6F9342EEEEEEFp-37, -0x1.9ACA077777777p-37,
+		  -0x1.3CBB111111111p-42, -0x1.CBCCB55555555p-42, -0x1.62A45FBBBBBBCp-42, -0x1.02F282AAAAAABp-43, -0x1.6905A3999999Ap-46, -0x1.C8E1EF6666666p-50, -0x1.CD18203333333p-55, -0x1.1785FB3333333p-61, -0x1.89317A1555555p-71 },
+		{ 0x1.A9BFC00000000p-49, 0x1.DA52844444444p-46, 0x1.4876B9999999Ap-44, 0x1.3A6AFBBBBBBBCp-43, 0x1.FF83155555555p-43, 0x1.6648C44444444p-42, 0x1.C61D955555555p-42, 0x1.CFF14CCCCCCCDp-42, 0x1.8CC9DDDDDDDDEp-44,
+		  0x1.34A939999999Ap-43, 0x1.06CD4AAAAAAABp-43, 0x1.1D9D000000000p-44, 0x1.6B77300000000p-46, 0x1.CBF15B3333333p-49, 0x1.1A59FAEEEEEEFp-52, 0x1.1383DD999999Ap-57, 0x1.4B673DDDDDDDEp-64, 0x1.D50FE24444444p-74 },
+		{ -0x1.0536D11111111p-48, -0x1.2655511111111p-45, -0x1.9CDA555555555p-44, -0x1.99FA222222222p-43, -0x1.57DCC44444444p-42, -0x1.0680B77777777p-41, -0x1.7A8A2AAAAAAABp-41, -0x1.05272EEEEEEEFp-40, -0x1.5DCD8CCCCCCCDp-40,
+		  -0x1.C5801DDDDDDDEp-43, -0x1.189E4CCCCCCCDp-43, -0x1.924C844444444p-45, -0x1.585A511111111p-47, -0x1.41DF6EEEEEEEFp-50, -0x1.2E38AEEEEEEEFp-54, -0x1.D9A0C44444444p-60, -0x1.DFC8ECCCCCCCDp-67, -0x1.26E9ECCCCCCCDp-76 },
+		{ -0x1.54779DDDDDDDEp-48, -0x1.7E508CCCCCCCDp-45, -0x1.0DB0200000000p-43, -0x1.0B23155555555p-42, -0x1.C904266666666p-42, -0x1.5CFFAAAAAAAABp-41, -0x1.FFF2A66666666p-41, -0x1.69F0E22222222p-40, -0x1.006B955555555p-39,
+		  -0x1.1F7AC22222222p-42, -0x1.5636A66666666p-43, -0x1.C336CCCCCCCCDp-45, -0x1.65DD488888889p-47, -0x1.0A94755555555p-50, -0x1.B6F3266666666p-55, -0x1.E3E0B33333333p-61, -0x1.4EB5DDDDDDDDEp-68, -0x1.9D3C6EEEEEEEFp-79 },
+		{ 0x1.719CAAAAAAAABp-49, 0x1.A0C0EEEEEEEEFp-46, 0x1.24C5111111111p-44, 0x1.23D6666666666p-43, 0x1.EBAD555555555p-43, 0x1.7A7F111111111p-42, 0x1.1470EEEEEEEEFp-41, 0x1.8632000000000p-41, 0x1.13DF000000000p-40,
+		  0x1.36BB666666666p-43, 0x1.7456222222222p-44, 0x1.F070222222222p-46, 0x1.7FBDBBBBBBBBCp-48, 0x1.3983777777777p-51, 0x1.ED8A222222222p-56, 0x1.2D56AAAAAAAABp-61, 0x1.BEACAAAAAAAABp-69, 0x1.4DC4CCCCCCCCDp-79 },
+		{ 0x1.0901111111111p-48, 0x1.294AEEEEEEEEFp-45, 0x1.A304666666666p-44, 0x1.9F21111111111p-43, 0x1.62BBDDDDDDDDEp-42, 0x1.0EC2000000000p-41, 0x1.8C9F111111111p-41, 0x1.17DF111111111p-40, 0x1.8AD5DDDDDDDDEp-40,
+		  0x1.C0CB99999999Ap-43, 0x1.0B02222222222p-43, 0x1.63A6EEEEEEEEFp-45, 0x1.1BD7333333333p-47, 0x1.AEFFDDDDDDDDEp-51, 0x1.6974222222222p-55, 0x1.A49599999999Ap-61, 0x1.3AF6222222222p-68, 0x1.E197BBBBBBBBCp-79 },
+		{ -0x1.7937777777777p-51, -0x1.A928888888889p-48, -0x1.2A8EEEEEEEEEFp-46, -0x1.29C6666666666p-45, -0x1.F508888888889p-45, -0x1.81CEEEEEEEEEFp-44, -0x1.19E2222222222p-43, -0x1.8DA0000000000p-43, -0x1.18DAAAAAAAAABp-42,
+		  -0x1.3CDCCCCCCCCCDp-45, -0x1.7CC6666666666p-46, -0x1.FA3DDDDDDDDDEp-48, -0x1.8846666666666p-50, -0x1.42D3333333333p-53, -0x1.FDA6666666666p-58, -0x1.37B3333333333p-63, -0x1.D37DDDDDDDDDEp-71, -0x1.687999999999Ap-81 },
+		{ -0x1.43F8888888889p-50, -0x1.6B45555555555p-47, -0x1.FFADDDDDDDDDEp-46, -0x1.FB1BBBBBBBBBCp-45, -0x1.B11AAAAAAAAABp-44, -0x1.4AA6666666666p-43, -0x1.E43AAAAAAAAABp-43, -0x1.55B4444444444p-42, -0x1.E22CCCCCCCCCDp-42,
+		  -0x1.1232AAAAAAAABp-44, -0x1.456999999999Ap-45, -0x1.B2F7777777777p-47, -0x1.5A41111111111p-49, -0x1.074A222222222p-52, -0x1.B8E3333333333p-57, -0x1.01C1111111111p-62, -0x1.8237777777777p-70, -0x1.265AAAAAAAAABp-80 }
+	},
+	{
+		{ 0x1.1A069046FE04Bp-10, 0x1.3ED1F4F636A73p-7, 0x1.BF3AA2E0750AFp-6, 0x1.BD2A7EF4E8306p-5, 0x1.783306CBB3C74p-4, 0x1.21AF5374EE0C3p-3, 0x1.A5E1D9DE015FFp-3, 0x1.2A0EF41FD3A9Dp-2, 0x1.A4EE021E8B6CBp-2,
+		  0x1.F7058D5343A37p-5, 0x1.284F2A50A9C8Ap-5, 0x1.94ECD56297BE8p-7, 0x1.3648FEFCBF375p-9, 0x1.F6FC8600D9345p-13, 0x1.873F017051037p-17, 0x1.EDD2313008372p-23, 0x1.6D67BD50E668Fp-30, 0x1.17D664457448Bp-40 },
+		{ -0x1.231F8C001097Bp-15, -0x1.491ACA8C3D29Fp-12, -0x1.CDA7E0D75695Ep-11, -0x1.CB86B37A66209p-10, -0x1.8455B3725970Ep-9, -0x1.2B078F26A3F34p-8, -0x1.B37DC6DAAEAD4p-8, -0x1.33AC55D5ECF9Ap-7, -0x1.B28210FFF3F6Bp-7,
+		  -0x1.039FC44AA2E5Ep-10, -0x1.31DE1B4C184CBp-11, -0x1.A1FCBD8C23E42p-13, -0x1.404B5E313DD98p-15, -0x1.039B229920265p-18, -0x1.93DE029496DD6p-23, -0x1.FDC05665CAF83p-29, -0x1.793171AAC8D88p-36, -0x1.20DD85C295127p-46 },
+		{ 0x1.2C839AAF68E57p-20, 0x1.53B87E5BC4319p-17, 0x1.DC8C2B21E2DEAp-16, 0x1.DA596713799E1p-15, 0x1.90DC82B8EDECAp-14, 0x1.34ACE557BBA40p-13, 0x1.C189FBEF88004p-13, 0x1.3D9908D61FC25p-12, 0x1.C0861D8277577p-12,
+		  0x1.91FF8D2F455B2p-16, 0x1.D999FE6B52A9Ep-17, 0x1.439A92C07CC84p-18, 0x1.EFF14EA29406Ap-21, 0x1.91F99891B283Ap-24, 0x1.38AD5BD486F19p-28, 0x1.8AA86C333D4BCp-34, 0x1.2408CE5997526p-41, 0x1.BF4FD8FD4E883p-52 },
+		{ -0x1.3634747867F53p-25, -0x1.5EAD00144D6BAp-22, -0x1.EBEA3395F3F53p-21, -0x1.E9A53F90C176Bp-20, -0x1.9DC9A64B0537Ep-19, -0x1.3EA0F9F968AEFp-18, -0x1.D008C13E32E9Ap-18, -0x1.47D68A76A8251p-17, -0x1.CEFBEC16BD95Cp-17,
+		  -0x1.59CCD5A1A0E9Ep-21, -0x1.97667FF75EBCDp-22, -0x1.16612768670EFp-23, -0x1.AAA86BD32E200p-26, -0x1.59D8DE5357AC9p-29, -0x1.0D0D23A9D89A6p-33, -0x1.53A81D2F95626p-39, -0x1.F6D1F7FAE6044p-47, -0x1.814EE4A31DB49p-57 },
+		{ 0x1.402D971BBE555p-30, 0x1.69F3239B7399Ap-27, 0x1.FBBA805904222p-26, 0x1.F9627112B0BBCp-25, 0x1.AB1614C09FBBCp-24, 0x1.48DDE01E13EEFp-23, 0x1.DEF058949A99Ap-23, 0x1.525CB0C6CC5DEp-22, 0x1.DDD465687BAABp-22,
+		  0x1.38492AAAD9DDEp-26, 0x1.6FFCC3CD6C000p-27, 0x1.F719C17C7E889p-29, 0x1.81CA751028EEFp-31, 0x1.3906A6E636889p-34, 0x1.E7BBA1AD3CEEFp-39, 0x1.3485EBCEBDDDEp-44, 0x1.CA501160C2CCDp-52, 0x1.6190623FC8EEFp-62 },
+		{ -0x1.4A3CC29A2AAABp-35, -0x1.7551780E8CCCDp-32, -0x1.05D55B86B3333p-30, -0x1.049E13C3F3333p-29, -0x1.B8767CE02EEEFp-29, -0x1.53257C67D7777p-28, -0x1.EDDD391D48889p-28, -0x1.5CDAA342B3333p-27, -0x1.EC7FA96DC4444p-27,
+		  -0x1.21BE5445EEEEFp-31, -0x1.5601E0D42AAABp-32, -0x1.D53F079F44444p-34, -0x1.69E5129077777p-36, -0x1.28230C7B6EEEFp-39, -0x1.D3212EC400000p-44, -0x1.2CECA3046EEEFp-49, -0x1.CC1C1FE4AAAABp-57, -0x1.76AD7EA022222p-67 },
+		{ 0x1.52C1D9A266666p-40, 0x1.7EEE116088889p-37, 0x1.0C8BB00BBBBBCp-35, 0x1.0B3F76BC00000p-34, 0x1.C38AF68C44444p-34, 0x1.5B882B8800000p-33, 0x1.F9C16C2888889p-33, 0x1.64E1384111111p-32, 0x1.F6C2B31BBBBBCp-32,
+		  0x1.0E8C4A9DDDDDEp-36, 0x1.433F3D8000000p-37, 0x1.C696983111111p-39, 0x1.6C5402CAAAAABp-41, 0x1.3AAA6ECEEEEEFp-44, 0x1.0B0994399999Ap-48, 0x1.7B9A778BBBBBCp-54, 0x1.4CA4AD4BBBBBCp-61, 0x1.4E163AAE66666p-71 },
+		{ -0x1.3BF17E6666666p-45, -0x1.65787A2222222p-42, -0x1.F50CDEEEEEEEFp-41, -0x1.F1E6CDDDDDDDEp-40, -0x1.A3F5704444444p-39, -0x1.424A0BBBBBBBCp-38, -0x1.D32C35DDDDDDEp-38, -0x1.4758851111111p-37, -0x1.C67F86AAAAAABp-37,
+		  -0x1.48A1D55555555p-42, -0x1.B6DBD33333333p-43, -0x1.764F066666666p-44, -0x1.7B09844444444p-46, -0x1.A2AB422222222p-49, -0x1.C8D109999999Ap-53, -0x1.9B5156EEEEEEFp-58, -0x1.C92641DDDDDDEp-65, -0x1.25FF777777777p-74 },
+		{ 0x1.13DDA77777777p-48, 0x1.3693ACCCCCCCDp-45, 0x1.B0843BBBBBBBCp-44, 0x1.AE25B9999999Ap-43, 0x1.6998066666666p-42, 0x1.159D311111111p-41, 0x1.90EDC88888889p-41, 0x1.178B4CCCCCCCDp-40, 0x1.80C6444444444p-40,
+		  0x1.732F733333333p-43, 0x1.C15419999999Ap-44, 0x1.4C41D33333333p-45, 0x1.18371BBBBBBBCp-47, 0x1.0A045DDDDDDDEp-50, 0x1.EB45D9999999Ap-55, 0x1.876669999999Ap-60, 0x1.84125AAAAAAABp-67, 0x1.BF109F7777777p-77 },
+		{ -0x1.0799E22222222p-48, -0x1.2380C00000000p-45, -0x1.9831622222222p-44, -0x1.9806A22222222p-43, -0x1.5765D11111111p-42, -0x1.091A666666666p-41, -0x1.803C222222222p-41, -0x1.0F42BBBBBBBBCp-40, -0x1.7DCFD11111111p-40,
+		  -0x1.C322266666666p-43, -0x1.0AF5911111111p-43, -0x1.6EE9333333333p-45, -0x1.1CFD777777777p-47, -0x1.DCB9622222222p-51, -0x1.70A7844444444p-55, -0x1.FB239DDDDDDDEp-61, -0x1.8F2C19999999Ap-68, -0x1.572DF11111111p-78 },
+		{ -0x1.3F03CEEEEEEEFp-48, -0x1.66FFC88888889p-45, -0x1.F40C777777777p-44, -0x1.F26BA66666666p-43, -0x1.A442FBBBBBBBCp-42, -0x1.4422E22222222p-41, -0x1.D807B33333333p-41, -0x1.4D392AAAAAAABp-40, -0x1.D77D333333333p-40,
+		  -0x1.162AC00000000p-42, -0x1.4474F77777777p-43, -0x1.BF899DDDDDDDEp-45, -0x1.51A1E22222222p-47, -0x1.1688C44444444p-50, -0x1.AFEF000000000p-55, -0x1.11F2977777777p-60, -0x1.99307BBBBBBBCp-68, -0x1.2D185BBBBBBBCp-78 },
+		{ 0x1.6181BBBBBBBBCp-49, 0x1.84DF555555555p-46, 0x1.102F222222222p-44, 0x1.107E888888889p-43, 0x1.CA92000000000p-43, 0x1.628999999999Ap-42, 0x1.00EE666666666p-41, 0x1.6B99DDDDDDDDEp-41, 0x1.0107666666666p-40,
+		  0x1.2E2F888888889p-43, 0x1.643AEEEEEEEEFp-44, 0x1.E552222222222p-46, 0x1.73F2222222222p-48, 0x1.31BADDDDDDDDEp-51, 0x1.C596444444444p-56, 0x1.3013CCCCCCCCDp-61, 0x1.BE2199999999Ap-69, 0x1.4B41AAAAAAAABp-79 },
+		{ 0x1.F1F3DDDDDDDDEp-49, 0x1.1850666666666p-45, 0x1.86C0888888889p-44, 0x1.855E000000000p-43, 0x1.4865333333333p-42, 0x1.FA32EEEEEEEEFp-42, 0x1.70C9111111111p-41, 0x1.043C666666666p-40, 0x1.6FFF333333333p-40,
+		  0x1.B2B4000000000p-43, 0x1.FB35555555555p-44, 0x1.5E59555555555p-45, 0x1.0878888888889p-47, 0x1.B3EC888888889p-51, 0x1.550F111111111p-55, 0x1.AF73111111111p-61, 0x1.4493777777777p-68, 0x1.E830222222222p-79 },
+		{ -0x1.6B1BBBBBBBBBCp-51, -0x1.8CDBBBBBBBBBCp-48, -0x1.1596666666666p-46, -0x1.1653333333333p-45, -0x1.D3F999999999Ap-45, -0x1.6A24444444444p-44, -0x1.060EEEEEEEEEFp-43, -0x1.7300000000000p-43, -0x1.0654444444444p-42,
+		  -0x1.348BBBBBBBBBCp-45, -0x1.6BD7777777777p-46, -0x1.EF73333333333p-48, -0x1.7BFBBBBBBBBBCp-50, -0x1.3958888888889p-53, -0x1.CB60000000000p-58, -0x1.39BCCCCCCCCCDp-63, -0x1.CD0CCCCCCCCCDp-71, -0x1.5487777777777p-81 },
+		{ -0x1.2FBA222222222p-50, -0x1.562DDDDDDDDDEp-47, -0x1.DD48888888889p-46, -0x1.DB83333333333p-45, -0x1.9121111111111p-44, -0x1.3505555555555p-43, -0x1.C27999999999Ap-43, -0x1.3DD7777777777p-42, -0x1.C166666666666p-42,
+		  -0x1.0965555555555p-44, -0x1.35B1111111111p-45, -0x1.ABF8888888889p-47, -0x1.42F0000000000p-49, -0x1.099DDDDDDDDDEp-52, -0x1.A13BBBBBBBBBCp-57, -0x1.069B333333333p-62, -0x1.8AEBBBBBBBBBCp-70, -0x1.29DD555555555p-80 }
+	},
+	{
+		{ 0x1.08EEE4A33CC67p-10, 0x1.2B7F6A0281678p-7, 0x1.A41FCF549A031p-6, 0x1.A22FAD967D130p-5, 0x1.61663CB4E775Ap-4, 0x1.1020D24B2C934p-3, 0x1.8C5048CF448A3p-3, 0x1.17FE8842099BBp-2, 0x1.8B6B3853E1330p-2,
+		  0x1.E78A5605BBDFFp-5, 0x1.1F30994F9CF5Bp-5, 0x1.88768092C5DE2p-7, 0x1.2CBC50DD14924p-9, 0x1.E78195AF743F0p-13, 0x1.7B3472BB69A80p-17, 0x1.DE9F76F52EA36p-23, 0x1.6228C6D522079p-30, 0x1.0F3999E53A691p-40 },
+		{ -0x1.00E7A75DC236Bp-15, -0x1.226C09A931FC2p-12, -0x1.9764A9F3D4BA9p-11, -0x1.958390FD0D43Ap-10, -0x1.56B0B6EE14669p-9, -0x1.07E1C41DC2CE9p-8, -0x1.804DD9EC55E27p-8, -0x1.0F82748E43532p-7, -0x1.7F6FBA6709559p-7,
+		  -0x1.D8C434524D39Fp-11, -0x1.167CB3B42722Dp-11, -0x1.7C91F12EAF237p-13, -0x1.239F56708CD2Fp-15, -0x1.D8BBB8C1E1DE1p-19, -0x1.6FB6BDE699A99p-23, -0x1.D01E85051E15Bp-29, -0x1.576D5E7B26F2Ep-36, -0x1.070190B7B2EDCp-46 },
+		{ 0x1.F23D61D2DDA80p-21, 0x1.199F101A2D37Ep-17, 0x1.8B0C46403C0EDp-16, 0x1.8939C1677FD0Cp-15, 0x1.4C4E4377F3DBDp-14, 0x1.FFC55B2F3A4D4p-14, 0x1.74A893962E67Dp-13, 0x1.074831A5DF3D9p-12, 0x1.73D12EAA34FE5p-12,
+		  0x1.57D481B90EDAAp-16, 0x1.95127A1D55337p-17, 0x1.14C73E2FDEAD6p-18, 0x1.A82DA0F6322F4p-21, 0x1.57CE6A133922Ap-24, 0x1.0B6DB93876A03p-28, 0x1.518ABF549C60Fp-34, 0x1.F38840308A051p-42, 0x1.7E8E7BC26D6C2p-52 },
+		{ -0x1.E324251A098DAp-26, -0x1.11164DF401F0Bp-22, -0x1.7F1393387EB17p-21, -0x1.7D4F30ED27051p-20, -0x1.423C4CE44D417p-19, -0x1.F04321539E0F7p-19, -0x1.695D8D629907Ap-18, -0x1.FE9B5FA3B3A69p-18, -0x1.688CA71722F5Ap-17,
+		  -0x1.15D7999AB01AFp-21, -0x1.4754C4CAB1980p-22, -0x1.BF51E1D4340D5p-24, -0x1.56C5E0D45312Bp-26, -0x1.15D3CDC362D95p-29, -0x1.B037F17FEE66Fp-34, -0x1.10C5A08D287D1p-39, -0x1.93B01641FEE3Cp-47, -0x1.352B70BC73CAFp-57 },
+		{ 0x1.D47F04DC86555p-31, 0x1.08CF2BC2E6A22p-27, 0x1.7376EABC31000p-26, 0x1.71C038253DBBCp-25, 0x1.3877B5A42C777p-24, 0x1.E137FE9CE2EEFp-24, 0x1.5E692C3B3F222p-23, 0x1.EF209F17EF99Ap-23, 0x1.5D9E3B2DCE111p-22,
+		  0x1.D77BB00555555p-27, 0x1.15BC8D38EE889p-27, 0x1.7B8F3FBC31555p-29, 0x1.22DDE89AEB555p-31, 0x1.D78DB8FA69555p-35, 0x1.6ED8E6063D111p-39, 0x1.CF1F074D41DDEp-45, 0x1.56CD28061F555p-52, 0x1.06B0957C44444p-62 },
+		{ -0x1.C646760FFBBBCp-36, -0x1.00C561F571111p-32, -0x1.68302B9EE6666p-31, -0x1.66868F845999Ap-30, -0x1.2EFAF2AC51111p-29, -0x1.D29AE676D5555p-29, -0x1.53C4442BDDDDEp-28, -0x1.E014B59837777p-28, -0x1.52FC1854EAAABp-27,
+		  -0x1.9B78638D9999Ap-32, -0x1.E4DA8CBF55555p-33, -0x1.4B6CCAC100000p-34, -0x1.FC41B08355555p-37, -0x1.9C59F4B0BBBBCp-40, -0x1.4131E11400000p-44, -0x1.96413909DDDDEp-50, -0x1.2D9D033066666p-57, -0x1.D0E588A6AAAABp-68 },
+		{ 0x1.B7C3E7BDDDDDEp-41, 0x1.F1207BA888889p-38, 0x1.5CAB205BBBBBCp-36, 0x1.5B0D0E32AAAABp-35, 0x1.2546D71000000p-34, 0x1.C3A321DA22222p-34, 0x1.48D9D07D55555p-33, 0x1.D09B8BE088889p-33, 0x1.47FE33C3BBBBCp-32,
+		  0x1.6B95CB199999Ap-37, 0x1.AD0F494444444p-38, 0x1.26180CF111111p-39, 0x1.C529CFFDDDDDEp-42, 0x1.7211EC6222222p-45, 0x1.23481ABDDDDDEp-49, 0x1.759C36B111111p-55, 0x1.1BCD5E3555555p-62, 0x1.C876E83BBBBBCp-73 },
+		{ -0x1.7E8A82AAAAAABp-46, -0x1.AFDAE9999999Ap-43, -0x1.2EFC06EEEEEEFp-41, -0x1.2D72848888889p-40, -0x1.FD81555555555p-40, -0x1.8809F66666666p-39, -0x1.1D8298CCCCCCDp-38, -0x1.92FCBBBBBBBBCp-38, -0x1.1C03E0CCCCCCDp-37,
+		  -0x1.54ADD11111111p-43, -0x1.997C088888889p-44, -0x1.230799999999Ap-45, -0x1.DC2EEAAAAAAABp-48, -0x1.9FCD19999999Ap-51, -0x1.77299DDDDDDDEp-55, -0x1.0735F77777777p-60, -0x1.DF97E66666666p-68, -0x1.FD63DDDDDDDDEp-78 },
+		{ 0x1.D09FA22222222p-49, 0x1.0AB7333333333p-45, 0x1.77672AAAAAAABp-44, 0x1.766F9BBBBBBBCp-43, 0x1.3B32A66666666p-42, 0x1.E863ACCCCCCCDp-42, 0x1.608DB11111111p-41, 0x1.F2D8B55555555p-41, 0x1.5FD9DBBBBBBBCp-40,
+		  0x1.65EAD11111111p-43, 0x1.A02A4CCCCCCCDp-44, 0x1.243CECCCCCCCDp-45, 0x1.B889CAAAAAAABp-48, 0x1.7BECD11111111p-51, 0x1.1333A44444444p-55, 0x1.8B80A00000000p-61, 0x1.3371933333333p-68, 0x1.F742888888889p-79 },
+		{ -0x1.DF7EB33333333p-49, -0x1.12A3733333333p-45, -0x1.7FF71DDDDDDDEp-44, -0x1.7F6E777777777p-43, -0x1.430D0CCCCCCCDp-42, -0x1.F391777777777p-42, -0x1.6923FBBBBBBBCp-41, -0x1.FF5A266666666p-41, -0x1.69AA000000000p-40,
+		  -0x1.B4E0488888889p-43, -0x1.01CBAEEEEEEEFp-43, -0x1.60997BBBBBBBCp-45, -0x1.0DADD11111111p-47, -0x1.BEFF2EEEEEEEFp-51, -0x1.4898AEEEEEEEFp-55, -0x1.C7399DDDDDDDEp-61, -0x1.5460A66666666p-68, -0x1.FB38266666666p-79 },
+		{ -0x1.20B4000000000p-48, -0x1.4D116EEEEEEEFp-45, -0x1.D4CF333333333p-44, -0x1.D3B5044444444p-43, -0x1.89BFC44444444p-42, -0x1.3160600000000p-41, -0x1.B8B71DDDDDDDEp-41, -0x1.38389BBBBBBBCp-40, -0x1.B95B955555555p-40,
+		  -0x1.0DB8D9999999Ap-42, -0x1.3917666666666p-43, -0x1.B3E3400000000p-45, -0x1.4555A00000000p-47, -0x1.13B1C00000000p-50, -0x1.8794155555555p-55, -0x1.1012533333333p-60, -0x1.9199B77777777p-68, -0x1.29BAC44444444p-78 },
+		{ 0x1.3E08666666666p-49, 0x1.6D39BBBBBBBBCp-46, 0x1.FEA7DDDDDDDDEp-45, 0x1.FE60444444444p-44, 0x1.ADB2888888889p-43, 0x1.4C87BBBBBBBBCp-42, 0x1.E00F111111111p-42, 0x1.5415EEEEEEEEFp-41, 0x1.E16A666666666p-41,
+		  0x1.23D4555555555p-43, 0x1.58C6CCCCCCCCDp-44, 0x1.D64A444444444p-46, 0x1.6730EEEEEEEEFp-48, 0x1.2A7C777777777p-51, 0x1.AFEB555555555p-56, 0x1.2FCA777777777p-61, 0x1.C3AA000000000p-69, 0x1.48B5AAAAAAAABp-79 },
+		{ 0x1.C3C1DDDDDDDDEp-49, 0x1.048B555555555p-45, 0x1.6E7D111111111p-44, 0x1.6D7E888888889p-43, 0x1.33D8888888889p-42, 0x1.DD22CCCCCCCCDp-42, 0x1.5898222222222p-41, 0x1.E826000000000p-41, 0x1.58FACCCCCCCCDp-40,
+		  0x1.A560444444444p-43, 0x1.EA2C000000000p-44, 0x1.545BDDDDDDDDEp-45, 0x1.FD1E888888889p-48, 0x1.ADECCCCCCCCCDp-51, 0x1.3474222222222p-55, 0x1.A8F7111111111p-61, 0x1.39AC888888889p-68, 0x1.D363333333333p-79 },
+		{ -0x1.4373333333333p-51, -0x1.74BBBBBBBBBBCp-48, -0x1.0496666666666p-46, -0x1.04B5555555555p-45, -0x1.B697777777777p-45, -0x1.53BBBBBBBBBBCp-44, -0x1.E982222222222p-44, -0x1.5AFCCCCCCCCCDp-43, -0x1.EB73333333333p-43,
+		  -0x1.29BEEEEEEEEEFp-45, -0x1.6068888888889p-46, -0x1.DF93333333333p-48, -0x1.6E3DDDDDDDDDEp-50, -0x1.3203333333333p-53, -0x1.B3F5555555555p-58, -0x1.39E999999999Ap-63, -0x1.D357777777777p-71, -0x1.5058888888889p-81 },
+		{ -0x1.141999999999Ap-50, -0x1.3E53333333333p-47, -0x1.BF91111111111p-46, -0x1.BE41111111111p-45, -0x1.77F999999999Ap-44, -0x1.2333BBBBBBBBCp-43, -0x1.A4E5555555555p-43, -0x1.2A13BBBBBBBBCp-42, -0x1.A547777777777p-42,
+		  -0x1.0123333333333p-44, -0x1.2BA6666666666p-45, -0x1.9F47777777777p-47, -0x1.3703BBBBBBBBCp-49, -0x1.05F8888888889p-52, -0x1.7AABBBBBBBBBCp-57, -0x1.0328000000000p-62, -0x1.7E54444444444p-70, -0x1.1D93333333333p-80 }
+	},
+	{
+		{ 0x1.F39699343857Ap-11, 0x1.1A6230C0C320Fp-7, 0x1.8C1DFDFFA2CBCp-6, 0x1.8A4A35F49F40Bp-5, 0x1.4D348261B7410p-4, 0x1.0093F97A50AA5p-3, 0x1.75AAC84EC3EA2p-3, 0x1.07FE9DBAE5745p-2, 0x1.74D2CEB5F7EA5p-2,
+		  0x1.D967DFAEF083Ep-5, 0x1.16DD1CD5FC267p-5, 0x1.7D15B15D04C17p-7, 0x1.24044B6F20B06p-9, 0x1.D95F6049DF9D9p-13, 0x1.703609BF65E4Bp-17, 0x1.D0BF2FC67EB95p-23, 0x1.57E440704F125p-30, 0x1.075C9A8FDC3D2p-40 },
+		{ -0x1.C8C4344BE3183p-16, -0x1.022DE36DC6CC4p-12, -0x1.6A2A0CCB900D0p-11, -0x1.687E5D3680C1Fp-10, -0x1.30A5097D1A7A1p-9, -0x1.D52BD6CFB9DF5p-9, -0x1.55A3754E4F494p-8, -0x1.E2BBA41256D51p-8, -0x1.54DDFED0F3341p-7,
+		  -0x1.B0D3FFB4F8DD9p-11, -0x1.FDEC1778E610Fp-12, -0x1.5C6B9ADABD44Bp-13, -0x1.0AFC9CC13BCB4p-15, -0x1.B0CC3AD2F0A96p-19, -0x1.50A66F5F2BF28p-23, -0x1.A8E9505F03B49p-29, -0x1.3A6A49AECFC82p-36, -0x1.E193641F74938p-47 },
+		{ 0x1.A19D718A9CB40p-21, 0x1.D819653D8F9CDp-18, 0x1.4B1F218F2C97Bp-16, 0x1.49981AA00D581p-15, 0x1.1688431DC4B4Fp-14, 0x1.ACF4E18991990p-14, 0x1.385AEED0C91CFp-13, 0x1.B95B19855AF3Ap-13, 0x1.37A66532B22CCp-12,
+		  0x1.28CBE2759717Fp-16, 0x1.5DA934AFF6641p-17, 0x1.DDD567054D46Dp-19, 0x1.6E273E11656FFp-21, 0x1.28C68FC98A6ADp-24, 0x1.CDB11080BC1D6p-29, 0x1.235E2B39FB163p-34, 0x1.AF32B497D657Cp-42, 0x1.4A3936DDFBC62p-52 },
+		{ -0x1.7DD1C53949EC2p-26, -0x1.AFA22EC6109C2p-23, -0x1.2EBD5F27DDB15p-21, -0x1.2D57DC7263BD1p-20, -0x1.FD50ED56A306Fp-20, -0x1.88305739A2D22p-19, -0x1.1D94F61591BBCp-18, -0x1.93867B5F777E4p-18, -0x1.1CEFE58CBBFCDp-17,
+		  -0x1.C442DC333143Cp-22, -0x1.0A6889B1D31D1p-22, -0x1.6C105398961CDp-24, -0x1.16F95E00A4F62p-26, -0x1.C43AE20F76311p-30, -0x1.5FC404E6D98E6p-34, -0x1.BBFD8882464D5p-40, -0x1.4888892101691p-47, -0x1.F7339593ADB89p-58 },
+		{ 0x1.5D17829F02666p-31, 0x1.8AA2D9F94E444p-28, 0x1.14CA5AE409666p-26, 0x1.13837CA92CEEFp-25, 0x1.D1A8FFEA90666p-25, 0x1.669288B80F666p-24, 0x1.051A6DAFD7089p-23, 0x1.70EFE7032D889p-23, 0x1.04837E1820666p-22,
+		  0x1.69CF0B047EAABp-27, 0x1.AA40F6C37C000p-28, 0x1.23408DEB91777p-29, 0x1.BE5CC8CB64889p-32, 0x1.69CA2A6380889p-35, 0x1.196B7D0F90444p-39, 0x1.6334F4DB00CCDp-45, 0x1.06D7F9F8B3DDEp-52, 0x1.929ACDA826666p-63 },
+		{ -0x1.3F2E580D22222p-36, -0x1.68D2AF01FBBBCp-33, -0x1.FA2625F080000p-32, -0x1.F7D065A99999Ap-31, -0x1.A9C2E1A733333p-30, -0x1.47D950B9AEEEFp-29, -0x1.DD76474244444p-29, -0x1.5153306348889p-28, -0x1.DC61E5EB80000p-28,
+		  -0x1.29C3B33DBBBBCp-32, -0x1.5ECEB5EDCCCCDp-33, -0x1.DF6AC80D33333p-35, -0x1.6F63332700000p-37, -0x1.29CD0D6B66666p-40, -0x1.CF57FE7244444p-45, -0x1.2476626D22222p-50, -0x1.B0F0A34CAAAABp-58, -0x1.4BBB5BE188889p-68 },
+		{ 0x1.235C315C44444p-41, 0x1.495D61C6EEEEFp-38, 0x1.CE059B6111111p-37, 0x1.CBE3A4AAAAAABp-36, 0x1.84A29E6555555p-35, 0x1.2B43235777777p-34, 0x1.B3D3C8D111111p-34, 0x1.33E858ABBBBBCp-33, 0x1.B2D48C5333333p-33,
+		  0x1.EFAE06FBBBBBCp-38, 0x1.240742E444444p-38, 0x1.8F2BF28888889p-40, 0x1.3203432666666p-42, 0x1.F09BC89DDDDDEp-46, 0x1.82A100599999Ap-50, 0x1.E8D175AAAAAABp-56, 0x1.6A8EB38888889p-63, 0x1.170872C666666p-73 },
+		{ -0x1.C4101AAAAAAABp-47, -0x1.FF23A11111111p-44, -0x1.66812BBBBBBBCp-42, -0x1.64D05CCCCCCCDp-41, -0x1.2D8BE4CCCCCCDp-40, -0x1.D069FAAAAAAABp-40, -0x1.5220608888889p-39, -0x1.DDBC611111111p-39, -0x1.514B34CCCCCCDp-38,
+		  -0x1.DFE7111111111p-45, -0x1.1B8CB33333333p-45, -0x1.88C4444444444p-47, -0x1.30DCEEEEEEEEFp-49, -0x1.FAEB777777777p-53, -0x1.8F97888888889p-57, -0x1.088A99999999Ap-62, -0x1.A091555555555p-70, -0x1.6102000000000p-80 },
+		{ 0x1.948E244444444p-49, 0x1.D0D9BDDDDDDDEp-46, 0x1.4543244444444p-44, 0x1.43C4D11111111p-43, 0x1.13ACA88888889p-42, 0x1.A69A555555555p-42, 0x1.339E844444444p-41, 0x1.B28F2EEEEEEEFp-41, 0x1.3313F77777777p-40,
+		  0x1.53474EEEEEEEFp-43, 0x1.8F298EEEEEEEFp-44, 0x1.1444222222222p-45, 0x1.AB1B955555555p-48, 0x1.4A7139999999Ap-51, 0x1.0836533333333p-55, 0x1.4D9F888888889p-61, 0x1.FDF4000000000p-69, 0x1.7FA7D77777777p-79 },
+		{ -0x1.C8AA0CCCCCCCDp-49, -0x1.01C0CAAAAAAABp-45, -0x1.692CD55555555p-44, -0x1.67E7B33333333p-43, -0x1.30152AAAAAAABp-42, -0x1.D40F222222222p-42, -0x1.54DC3BBBBBBBCp-41, -0x1.E19E0CCCCCCCDp-41, -0x1.5416F77777777p-40,
+		  -0x1.A8B1622222222p-43, -0x1.F3FE59999999Ap-44, -0x1.54F52AAAAAAABp-45, -0x1.059EC22222222p-47, -0x1.A605AAAAAAAABp-51, -0x1.4A28A66666666p-55, -0x1.A170044444444p-61, -0x1.35839DDDDDDDEp-68, -0x1.D8555DDDDDDDEp-79 },
+		{ -0x1.1041933333333p-48, -0x1.3A74577777777p-45, -0x1.B7D58CCCCCCCDp-44, -0x1.B5A5800000000p-43, -0x1.7517955555555p-42, -0x1.1DD6AAAAAAAABp-41, -0x1.A005BBBBBBBBCp-41, -0x1.25DE1DDDDDDDEp-40, -0x1.9F71EEEEEEEEFp-40,
+		  -0x1.0444BDDDDDDDEp-42, -0x1.31BE644444444p-43, -0x1.A797A22222222p-45, -0x1.46D6377777777p-47, -0x1.F973A66666666p-51, -0x1.92EFB77777777p-55, -0x1.FCE8444444444p-61, -0x1.8366222222222p-68, -0x1.20AB711111111p-78 },
+		{ 0x1.309CBBBBBBBBCp-49, 0x1.57BA111111111p-46, 0x1.E11FBBBBBBBBCp-45, 0x1.DFBC888888889p-44, 0x1.9565111111111p-43, 0x1.37F0888888889p-42, 0x1.C63199999999Ap-42, 0x1.40E3EEEEEEEEFp-41, 0x1.C54AAAAAAAAABp-41,
+		  0x1.1C1BAAAAAAAABp-43, 0x1.4E1DEEEEEEEEFp-44, 0x1.C7A4888888889p-46, 0x1.5E0F222222222p-48, 0x1.197C444444444p-51, 0x1.B88D333333333p-56, 0x1.179F444444444p-61, 0x1.9FAC666666666p-69, 0x1.3B35777777777p-79 },
+		{ 0x1.A93799999999Ap-49, 0x1.EBCA444444444p-46, 0x1.57E8EEEEEEEEFp-44, 0x1.561F333333333p-43, 0x1.239ACCCCCCCCDp-42, 0x1.BEE9555555555p-42, 0x1.4536444444444p-41, 0x1.CB6E666666666p-41, 0x1.44BEEEEEEEEEFp-40,
+		  0x1.96DD333333333p-43, 0x1.DD99BBBBBBBBCp-44, 0x1.4B0A444444444p-45, 0x1.FE49111111111p-48, 0x1.8B67555555555p-51, 0x1.3AF3DDDDDDDDEp-55, 0x1.8E11555555555p-61, 0x1.2EC8222222222p-68, 0x1.C389BBBBBBBBCp-79 },
+		{ -0x1.375AAAAAAAAABp-51, -0x1.5F25555555555p-48, -0x1.EAE6666666666p-47, -0x1.E9D1111111111p-46, -0x1.9E00000000000p-45, -0x1.3E7999999999Ap-44, -0x1.CF95555555555p-44, -0x1.4787777777777p-43, -0x1.CEC4444444444p-43,
+		  -0x1.224999999999Ap-45, -0x1.5501111111111p-46, -0x1.D0F7777777777p-48, -0x1.65D8888888889p-50, -0x1.1EB5555555555p-53, -0x1.C153333333333p-58, -0x1.1E4999999999Ap-63, -0x1.AB02222222222p-71, -0x1.421999999999Ap-81 },
+		{ -0x1.0380888888889p-50, -0x1.2C5C444444444p-47, -0x1.A40DDDDDDDDDEp-46, -0x1.A1D3333333333p-45, -0x1.640BBBBBBBBBCp-44, -0x1.10E2222222222p-43, -0x1.8D2AAAAAAAAABp-43, -0x1.1887777777777p-42, -0x1.8C91111111111p-42,
+		  -0x1.F0D6666666666p-45, -0x1.2379111111111p-45, -0x1.9431111111111p-47, -0x1.3738888888889p-49, -0x1.E336666666666p-53, -0x1.80CBBBBBBBBBCp-57, -0x1.E62AAAAAAAAABp-63, -0x1.7180000000000p-70, -0x1.13C9111111111p-80 }
+	},
+	{
+		{ 0x1.D895607D86E4Cp-11, 0x1.0B1E9CD207D0Bp-7, 0x1.76B49652B334Ep-6, 0x1.74FA175D09E3Ep-5, 0x1.3B31ABC43BB3Cp-4, 0x1.E56AFA9467AEEp-4, 0x1.61780996A2A5Ep-3, 0x1.F37300E513D08p-3, 0x1.60ABBC9E51C1Cp-2,
+		  0x1.CC6EEA9F30DABp-5, 0x1.0F38DFD09FEB3p-5, 0x1.72A45EDFC7D74p-7, 0x1.1C03C984A2D1Ap-9, 0x1.CC66A6D677A42p-13, 0x1.661F0662F7A3Ap-17, 0x1.C402F8D8EA2BFp-23, 0x1.4E77D72D591F5p-30, 0x1.00251CC32518Ep-40 },
+		{ -0x1.98B88ACD5F9DCp-16, -0x1.CE0B701F20071p-13, -0x1.4411CE1DF7513p-11, -0x1.42931B1FFCDF8p-10, -0x1.1099A94FBAB78p-9, -0x1.A3D224D35019Fp-9, -0x1.31B3EC9DE7A4Ap-8, -0x1.AFF4C280DAB3Bp-8, -0x1.31033B586DDCCp-7,
+		  -0x1.8E366A0D17C19p-11, -0x1.D5241B5B0ABECp-12, -0x1.408E288A4BF6Ep-13, -0x1.EB44D231EFE55p-16, -0x1.8E2F442FB803Dp-19, -0x1.35B9F7B054CE1p-23, -0x1.86EDD04E7A14Cp-29, -0x1.21450D221FBB3p-36, -0x1.BB0FC310EE11Bp-47 },
+		{ 0x1.617D026B083A0p-21, 0x1.8F9B308807CBBp-18, 0x1.1846C018C8DD5p-16, 0x1.16FBC46D8A014p-15, 0x1.D7865549A05C4p-15, 0x1.6B169C621B741p-14, 0x1.086442421ED7Fp-13, 0x1.759569F0F5944p-13, 0x1.07CB719701B52p-12,
+		  0x1.024CCF29D9D05p-16, 0x1.304EC5A300B67p-17, 0x1.9FDB042DD4DB3p-19, 0x1.3EA92E6EE0B77p-21, 0x1.02482C48D66FFp-24, 0x1.91CEA94120827p-29, 0x1.FB26ADA8D959Ep-35, 0x1.7744D31A45700p-42, 0x1.1F642BECB3CE3p-52 },
+		{ -0x1.31B8393D16B22p-26, -0x1.599AF94E4D88Bp-23, -0x1.E4CD679EB21E2p-22, -0x1.E290E4BB45140p-21, -0x1.97CE1FF6A306Fp-20, -0x1.3A05B77557C17p-19, -0x1.C953793117E37p-19, -0x1.4319702238582p-18, -0x1.C84B24F7C4F9Ap-18,
+		  -0x1.745309B5F5FDEp-22, -0x1.B6A4482B3BFE6p-23, -0x1.2BB737F8CF144p-24, -0x1.CB54BB69817CDp-27, -0x1.744C5CC3E70CDp-30, -0x1.21974237E3289p-34, -0x1.6D83AD0529580p-40, -0x1.0E76CFC745211p-47, -0x1.9E4206D9461E6p-58 },
+		{ 0x1.0867FD6B9D444p-31, 0x1.2AE6E91493DDEp-28, 0x1.A349E214F8666p-27, 0x1.A15ABCF07A000p-26, 0x1.60B2494850333p-25, 0x1.0F9640F511CCDp-24, 0x1.8B867B03EDEEFp-24, 0x1.176FF54213333p-23, 0x1.8AA1DEB364889p-23,
+		  0x1.19C25B1635DDEp-27, 0x1.4BF2041FF6EEFp-28, 0x1.C59FCF5074CCDp-30, 0x1.5B9A314CDAAABp-32, 0x1.19BD63896E666p-35, 0x1.B64D01AE0EEEFp-40, 0x1.149B457874444p-45, 0x1.995A7438FA222p-53, 0x1.397EBFA3A7BBCp-63 },
+		{ -0x1.C96052693BBBCp-37, -0x1.02863CCFDDDDEp-33, -0x1.6AA5FB2388889p-32, -0x1.68F9B70E9999Ap-31, -0x1.310D460400000p-30, -0x1.D5CC6024F7777p-30, -0x1.56185830AAAABp-29, -0x1.E360CB5DC4444p-29, -0x1.55529A6788889p-28,
+		  -0x1.B6BABE5D33333p-33, -0x1.027032FCEEEEFp-33, -0x1.612C2CA222222p-35, -0x1.0EA118F3BBBBCp-37, -0x1.B6B4D23B55555p-41, -0x1.553F806B11111p-45, -0x1.AEB9124333333p-51, -0x1.3EB8D14B33333p-58, -0x1.E83099C044444p-69 },
+		{ 0x1.8AB2B61AAAAABp-42, 0x1.BE33EDCBBBBBCp-39, 0x1.38F68BDBBBBBCp-37, 0x1.3784BF5222222p-36, 0x1.074217D333333p-35, 0x1.956D68C000000p-35, 0x1.273B6DA444444p-34, 0x1.A128177777777p-34, 0x1.268F37C555555p-33,
+		  0x1.588104B777777p-38, 0x1.95FA21EEEEEEFp-39, 0x1.155821E666666p-40, 0x1.A93BB72222222p-43, 0x1.5882399555555p-46, 0x1.0C443E0CCCCCDp-50, 0x1.51FF2E599999Ap-56, 0x1.F45CD84CCCCCDp-64, 0x1.7FA4504888889p-74 },
+		{ -0x1.0BD09DDDDDDDEp-47, -0x1.2BEB822222222p-44, -0x1.A4B53DDDDDDDEp-43, -0x1.A2FEBAAAAAAABp-42, -0x1.621F49999999Ap-41, -0x1.1096DEEEEEEEFp-40, -0x1.8D257DDDDDDDEp-40, -0x1.1888BAAAAAAABp-39, -0x1.8C16ABBBBBBBCp-39,
+		  0x1.BD42222222222p-48, 0x1.4A7DDDDDDDDDEp-48, 0x1.7F1B333333333p-50, 0x1.11BC888888889p-52, 0x1.0678CCCCCCCCDp-55, 0x1.3A34444444444p-60, 0x1.2417777777777p-65, 0x1.93EFBBBBBBBBCp-73, 0x1.AFBD555555555p-84 },
+		{ 0x1.75F24EEEEEEEFp-49, 0x1.A2CF7DDDDDDDEp-46, 0x1.2435622222222p-44, 0x1.2316066666666p-43, 0x1.EB1B444444444p-43, 0x1.7C6759999999Ap-42, 0x1.114B6EEEEEEEFp-41, 0x1.83A3DDDDDDDDEp-41, 0x1.129A79999999Ap-40,
+		  0x1.48AD8EEEEEEEFp-43, 0x1.7B03333333333p-44, 0x1.0846F33333333p-45, 0x1.852E99999999Ap-48, 0x1.4C27288888889p-51, 0x1.D44A733333333p-56, 0x1.614C4AAAAAAABp-61, 0x1.0318F9999999Ap-68, 0x1.73483DDDDDDDEp-79 },
+		{ -0x1.9E32000000000p-49, -0x1.E695155555555p-46, -0x1.556DD11111111p-44, -0x1.52F9488888889p-43, -0x1.1E6E888888889p-42, -0x1.B985C88888889p-42, -0x1.4106044444444p-41, -0x1.C5DE488888889p-41, -0x1.40D0F77777777p-40,
+		  -0x1.99A4111111111p-43, -0x1.E9E69DDDDDDDEp-44, -0x1.4B1EA22222222p-45, -0x1.F9EA088888889p-48, -0x1.9D69EEEEEEEEFp-51, -0x1.3EBA99999999Ap-55, -0x1.9B41F33333333p-61, -0x1.3078AAAAAAAABp-68, -0x1.C982F33333333p-79 },
+		{ -0x1.0AFC0AAAAAAABp-48, -0x1.2ACB644444444p-45, -0x1.A116A22222222p-44, -0x1.9F75844444444p-43, -0x1.5E76DDDDDDDDEp-42, -0x1.0F8D844444444p-41, -0x1.8626222222222p-41, -0x1.14B319999999Ap-40, -0x1.88026AAAAAAABp-40,
+		  -0x1.FD62FBBBBBBBCp-43, -0x1.26B5B33333333p-43, -0x1.9A7E000000000p-45, -0x1.2E9AEEEEEEEEFp-47, -0x1.020039999999Ap-50, -0x1.6D9BE22222222p-55, -0x1.104EA88888889p-60, -0x1.8F76EAAAAAAABp-68, -0x1.1FF3ACCCCCCCDp-78 },
+		{ 0x1.129AAAAAAAAABp-49, 0x1.44C3444444444p-46, 0x1.C7FD777777777p-45, 0x1.C44FDDDDDDDDEp-44, 0x1.7E5AEEEEEEEEFp-43, 0x1.269CBBBBBBBBCp-42, 0x1.AC4F111111111p-42, 0x1.2ECB000000000p-41, 0x1.AC37777777777p-41,
+		  0x1.118BBBBBBBBBCp-43, 0x1.4821222222222p-44, 0x1.BAA2666666666p-46, 0x1.521C222222222p-48, 0x1.1405555555555p-51, 0x1.AAC0888888889p-56, 0x1.1418555555555p-61, 0x1.9A31555555555p-69, 0x1.3247888888889p-79 },
+		{ 0x1.A0DF555555555p-49, 0x1.D2AECCCCCCCCDp-46, 0x1.45F2AAAAAAAABp-44, 0x1.44A8222222222p-43, 0x1.11E6444444444p-42, 0x1.A857777777777p-42, 0x1.312F99999999Ap-41, 0x1.B0BC444444444p-41, 0x1.326E888888889p-40,
+		  0x1.8D9FDDDDDDDDEp-43, 0x1.CD55555555555p-44, 0x1.40F2666666666p-45, 0x1.DA04444444444p-48, 0x1.935FDDDDDDDDEp-51, 0x1.1F89BBBBBBBBCp-55, 0x1.A680EEEEEEEEFp-61, 0x1.360C666666666p-68, 0x1.C1D399999999Ap-79 },
+		{ -0x1.15FDDDDDDDDDEp-51, -0x1.4B94444444444p-48, -0x1.D1DBBBBBBBBBCp-47, -0x1.CD97777777777p-46, -0x1.8666666666666p-45, -0x1.2CBAAAAAAAAABp-44, -0x1.B506666666666p-44, -0x1.34FCCCCCCCCCDp-43, -0x1.B52EEEEEEEEEFp-43,
+		  -0x1.16CEEEEEEEEEFp-45, -0x1.4FADDDDDDDDDEp-46, -0x1.C3C0000000000p-48, -0x1.5902222222222p-50, -0x1.1960000000000p-53, -0x1.B415555555555p-58, -0x1.1B7AAAAAAAAABp-63, -0x1.A6D5555555555p-71, -0x1.393AAAAAAAAABp-81 },
+		{ -0x1.FC81111111111p-51, -0x1.1CBD555555555p-47, -0x1.8DF5555555555p-46, -0x1.8C61111111111p-45, -0x1.4E6EEEEEEEEEFp-44, -0x1.0301111111111p-43, -0x1.74EAAAAAAAAABp-43, -0x1.084EEEEEEEEEFp-42, -0x1.7638888888889p-42,
+		  -0x1.E518888888889p-45, -0x1.19F5555555555p-45, -0x1.8804444444444p-47, -0x1.21EAAAAAAAAABp-49, -0x1.EC90000000000p-53, -0x1.60E7777777777p-57, -0x1.0048000000000p-62, -0x1.7843333333333p-70, -0x1.1260888888889p-80 }
+	},
+	{
+		{ 0x1.C0593428524D0p-11, 0x1.FAD79FB5E7C17p-8, 0x1.637D60AA5B781p-6, 0x1.61D992E21D4D1p-5, 0x1.2B07BD36E3812p-4, 0x1.CC865030E5F74p-4, 0x1.4F57A01231871p-3, 0x1.D9D621AB61F29p-3, 0x1.4E95CD33BD767p-2,
+		  0x1.C078CF96E8D8Bp-5, 0x1.082D1D5DE91A9p-5, 0x1.69036B92B92B5p-7, 0x1.14A2F34DA884Ep-9, 0x1.C070C2C52CC06p-13, 0x1.5CD1583233F5Ep-17, 0x1.B844DFE55DAE3p-23, 0x1.45C776E9E2077p-30, 0x1.F2FB3F3934A6Cp-41 },
+		{ -0x1.6FE02ACBBFE32p-16, -0x1.9FDEDEF126C5Fp-13, -0x1.23AF143D028CCp-11, -0x1.22569FE77A326p-10, -0x1.EAB75DE3EAF1Bp-10, -0x1.79DDCBA4D67D5p-9, -0x1.132713C028450p-8, -0x1.84C9F43DD99DDp-8, -0x1.12880AD51E38Fp-7,
+		  -0x1.6FFA19EB69C59p-11, -0x1.B1851C7FDB5A2p-12, -0x1.283751B378F5Ep-13, -0x1.C5F7B6A6D8B4Fp-16, -0x1.6FF37EFDB6CFBp-19, -0x1.1E359DB314202p-23, -0x1.693F139B74B0Ep-29, -0x1.0B4E5471395D5p-36, -0x1.996BB0982F14Cp-47 },
+		{ 0x1.2DD8C0A70EE38p-21, 0x1.553A2684176F4p-18, 0x1.DEA927C6634D1p-17, 0x1.DC73E595EC41Dp-16, 0x1.92A3953E2006Dp-15, 0x1.360B51C23280Cp-14, 0x1.C38854EC5E285p-14, 0x1.3F019A743E15Fp-13, 0x1.C28359FB0B492p-13,
+		  0x1.C4E50C351B56Bp-17, 0x1.0AC81189A4F60p-17, 0x1.6C92DAB59623Cp-19, 0x1.175D5CB5C84B6p-21, 0x1.C4DCEB1217762p-25, 0x1.6041FD2CD8B4Dp-29, 0x1.BC9C66EA29B8Cp-35, 0x1.48FDF1CA7CA25p-42, 0x1.F7E700C594FD3p-53 },
+		{ -0x1.EF56913C8F584p-27, -0x1.17FB33281A931p-23, -0x1.88BF4E63EC649p-22, -0x1.86EF811B765E6p-21, -0x1.4A5ED63074B91p-20, -0x1.FCCA5E87D5A6Bp-20, -0x1.727CFD4A82AC9p-19, -0x1.05BFAC8CA5BF5p-18, -0x1.71A6DA0DFCF11p-18,
+		  -0x1.35ABED9DC1366p-22, -0x1.6CD454B26373Cp-23, -0x1.F28FEF4A58111p-25, -0x1.7E0984D48BA11p-27, -0x1.35A65EB55EC6Fp-30, -0x1.E1B85329259EFp-35, -0x1.3001EA3DBECE6p-40, -0x1.C1E74EE318300p-48, -0x1.588C7271AF4ABp-58 },
+		{ 0x1.966E71DCB1333p-32, 0x1.CB74DFED62000p-29, 0x1.4241188602333p-27, 0x1.40C48A4DD8111p-26, 0x1.0F12C202B2889p-25, 0x1.A17820F402AABp-25, 0x1.2FFD8D605B000p-24, 0x1.AD8957C964666p-24, 0x1.2F4DD97587AABp-23,
+		  0x1.BCA8386CB5555p-28, 0x1.05EDD90C9D99Ap-28, 0x1.65F1479F0EEEFp-30, 0x1.12488D2862666p-32, 0x1.BCA03FD256666p-36, 0x1.59D9C63530CCDp-40, 0x1.B4862C6FAEEEFp-46, 0x1.4302142A71555p-53, 0x1.EEBCBBF683333p-64 },
+		{ -0x1.4D81BA69E6666p-37, -0x1.79048D6A3BBBCp-34, -0x1.086EE9B94CCCDp-32, -0x1.0736A489EEEEFp-31, -0x1.BCDEF6BAB3333p-31, -0x1.56906A4F66666p-30, -0x1.F2E494029999Ap-30, -0x1.607758C408889p-29, -0x1.F1C43821BBBBCp-29,
+		  -0x1.4875952FBBBBCp-33, -0x1.82F6CFFE00000p-34, -0x1.0867AE5AAAAABp-35, -0x1.953718BA88889p-38, -0x1.486FF73E88889p-41, -0x1.FEF25E8155555p-46, -0x1.4273C51511111p-51, -0x1.DD32C4B59999Ap-59, -0x1.6D745A6C44444p-69 },
+		{ 0x1.10D535B111111p-42, 0x1.34701AABBBBBCp-39, 0x1.B0A851B333333p-38, 0x1.AEA949B777777p-37, 0x1.6BF2AC9555555p-36, 0x1.183FFD8BBBBBCp-35, 0x1.98241EF555555p-35, 0x1.2059A88111111p-34, 0x1.9738191111111p-34,
+		  0x1.E7CB932222222p-39, 0x1.1F40A2DDDDDDEp-39, 0x1.88B84BD555555p-41, 0x1.2CE0BEB333333p-43, 0x1.E7A3BD3BBBBBCp-47, 0x1.7B55987777777p-51, 0x1.DEB6EC4444444p-57, 0x1.6243AFB333333p-64, 0x1.0F595D1DDDDDEp-74 },
+		{ -0x1.2FE2377777777p-48, -0x1.5747ECCCCCCCDp-45, -0x1.E1B58CCCCCCCDp-44, -0x1.DF5B266666666p-43, -0x1.95648EEEEEEEFp-42, -0x1.37FB222222222p-41, -0x1.C64F000000000p-41, -0x1.40DAF33333333p-40, -0x1.C559C88888889p-40,
+		  0x1.8AC1888888889p-45, 0x1.D881777777777p-46, 0x1.3CD3DDDDDDDDEp-47, 0x1.E21E666666666p-50, 0x1.95BF222222222p-53, 0x1.31E1D55555555p-57, 0x1.81B1111111111p-63, 0x1.0AA0555555555p-70, 0x1.B28F000000000p-81 },
+		{ 0x1.5294000000000p-49, 0x1.7BEF0AAAAAAABp-46, 0x1.0BA9333333333p-44, 0x1.0ABBAAAAAAAABp-43, 0x1.C036666666666p-43, 0x1.59D6C66666666p-42, 0x1.F7EB9DDDDDDDEp-42, 0x1.6419E88888889p-41, 0x1.F6BEBBBBBBBBCp-41,
+		  0x1.3751888888889p-43, 0x1.7758333333333p-44, 0x1.F0EC733333333p-46, 0x1.81EDAEEEEEEEFp-48, 0x1.3F52D77777777p-51, 0x1.EA10D55555555p-56, 0x1.3884D11111111p-61, 0x1.C8A9FBBBBBBBCp-69, 0x1.5E11FDDDDDDDEp-79 },
+		{ -0x1.966A2EEEEEEEFp-49, -0x1.CC4B733333333p-46, -0x1.42888CCCCCCCDp-44, -0x1.41463BBBBBBBCp-43, -0x1.0EEF888888889p-42, -0x1.A204D11111111p-42, -0x1.30628CCCCCCCDp-41, -0x1.AE830CCCCCCCDp-41, -0x1.2F9DEEEEEEEEFp-40,
+		  -0x1.912B800000000p-43, -0x1.DBE859999999Ap-44, -0x1.4288111111111p-45, -0x1.ECAFE66666666p-48, -0x1.966B044444444p-51, -0x1.36FF955555555p-55, -0x1.89C8400000000p-61, -0x1.1B39733333333p-68, -0x1.BCB1BBBBBBBBCp-79 },
+		{ -0x1.F3CA333333333p-49, -0x1.18D7600000000p-45, -0x1.8B84F77777777p-44, -0x1.8A59F77777777p-43, -0x1.4B31222222222p-42, -0x1.FF698CCCCCCCDp-42, -0x1.74ABD11111111p-41, -0x1.075C600000000p-40, -0x1.73A9000000000p-40,
+		  -0x1.E72FDDDDDDDDEp-43, -0x1.2589DDDDDDDDEp-43, -0x1.85052EEEEEEEFp-45, -0x1.2E00E22222222p-47, -0x1.F509266666666p-51, -0x1.7ECDBBBBBBBBCp-55, -0x1.E67C6EEEEEEEFp-61, -0x1.6225400000000p-68, -0x1.11AB7DDDDDDDEp-78 },
+		{ 0x1.0F68BBBBBBBBCp-49, 0x1.338A555555555p-46, 0x1.AED9333333333p-45, 0x1.AD50CCCCCCCCDp-44, 0x1.69C1DDDDDDDDEp-43, 0x1.174D222222222p-42, 0x1.969D333333333p-42, 0x1.1FA3222222222p-41, 0x1.959F777777777p-41,
+		  0x1.0C3ACCCCCCCCDp-43, 0x1.3ED1222222222p-44, 0x1.AF48000000000p-46, 0x1.48EA888888889p-48, 0x1.1105EEEEEEEEFp-51, 0x1.9E97111111111p-56, 0x1.07D0333333333p-61, 0x1.78E4666666666p-69, 0x1.2922EEEEEEEEFp-79 },
+		{ 0x1.861D111111111p-49, 0x1.B70C222222222p-46, 0x1.3508666666666p-44, 0x1.342A000000000p-43, 0x1.02DB777777777p-42, 0x1.8FC9333333333p-42, 0x1.2366AAAAAAAABp-41, 0x1.9BD6CCCCCCCCDp-41, 0x1.2284AAAAAAAABp-40,
+		  0x1.7D0CCCCCCCCCDp-43, 0x1.CAB7333333333p-44, 0x1.3062000000000p-45, 0x1.D85C444444444p-48, 0x1.881BDDDDDDDDEp-51, 0x1.2B35BBBBBBBBCp-55, 0x1.7A90444444444p-61, 0x1.1312222222222p-68, 0x1.AB9C222222222p-79 },
+		{ -0x1.1503333333333p-51, -0x1.3A14444444444p-48, -0x1.B7CEEEEEEEEEFp-47, -0x1.B67BBBBBBBBBCp-46, -0x1.7113333333333p-45, -0x1.1D43333333333p-44, -0x1.9F17777777777p-44, -0x1.25BEEEEEEEEEFp-43, -0x1.9E22222222222p-43,
+		  -0x1.11C2222222222p-45, -0x1.4634444444444p-46, -0x1.B833333333333p-48, -0x1.4F00000000000p-50, -0x1.1863333333333p-53, -0x1.A54AAAAAAAAABp-58, -0x1.0DFCCCCCCCCCDp-63, -0x1.7E68888888889p-71, -0x1.2EFBBBBBBBBBCp-81 },
+		{ -0x1.DBE6666666666p-51, -0x1.0C1199999999Ap-47, -0x1.794AAAAAAAAABp-46, -0x1.783999999999Ap-45, -0x1.3C1DDDDDDDDDEp-44, -0x1.E838888888889p-44, -0x1.63F4444444444p-43, -0x1.F70999999999Ap-43, -0x1.62C8888888889p-42,
+		  -0x1.D19DDDDDDDDDEp-45, -0x1.17F7777777777p-45, -0x1.740BBBBBBBBBCp-47, -0x1.208999999999Ap-49, -0x1.DEF8888888889p-53, -0x1.6D9DDDDDDDDDEp-57, -0x1.CC86666666666p-63, -0x1.4E54444444444p-70, -0x1.04F6EEEEEEEEFp-80 }
+	},
+	{
+		{ 0x1.AA7A50D52F145p-11, 0x1.E21E46BFC37D5p-8, 0x1.5226174463815p-6, 0x1.5096C3E9D0F49p-5, 0x1.1C71820881005p-4, 0x1.B60F5F02CE466p-4, 0x1.3EFBEFAD67518p-3, 0x1.C2B8F451DA10Bp-3, 0x1.3E43913DB43C1p-2,
+		  0x1.B565967CA4AE9p-5, 0x1.01A70093DD21Ap-5, 0x1.60191B61226B9p-7, 0x1.0DCE107D54463p-9, 0x1.B55DBC8F5512Ap-13, 0x1.543421A694DF7p-17, 0x1.AD6582838B34Bp-23, 0x1.3DBBE68CC49FDp-30, 0x1.E6A8B46084F1Dp-41 },
+		{ -0x1.4CDC581088EE7p-16, -0x1.784994E098E54p-13, -0x1.07EBC73B9F0E6p-11, -0x1.06B41C07A98D6p-10, -0x1.BC025A96A4472p-10, -0x1.55E688980B6D5p-9, -0x1.F1ED2B3424CFEp-9, -0x1.5FC88CBCC3761p-8, -0x1.F0CD5F9883E35p-8,
+		  -0x1.556205101D3CFp-11, -0x1.923064CDD6CF8p-12, -0x1.12CEE9A979182p-13, -0x1.A528AF97EEB67p-16, -0x1.555BE456E5B75p-19, -0x1.098658B3F8427p-23, -0x1.4F23851580E5Ap-29, -0x1.EFF999D580D37p-37, -0x1.7BD4D7B57DB61p-47 },
+		{ 0x1.03CB32005CA5Fp-21, 0x1.25B0104B54CF4p-18, 0x1.9BF968F2D5AA6p-17, 0x1.9A12E7121E281p-16, 0x1.5A8B33F89F54Dp-15, 0x1.0AD9645DA312Cp-14, 0x1.84A021B83998Ep-14, 0x1.129009F0ED7E4p-13, 0x1.83BF82CE5DF9Ep-13,
+		  0x1.8FAAF331DEF5Ep-17, 0x1.D6DAFF6121622p-18, 0x1.41BA0B4F9C5E5p-19, 0x1.ED1069AB6B155p-22, 0x1.8FA3C6A4095E1p-25, 0x1.36DBB90490F10p-29, 0x1.885B8912E31E8p-35, 0x1.2253AB3852CEFp-42, 0x1.BCAE4138A29D5p-53 },
+		{ -0x1.95881BDF97FCDp-27, -0x1.CA707D1532691p-24, -0x1.418A773227684p-22, -0x1.400EC0A873EAFp-21, -0x1.0E79222B203DAp-20, -0x1.A08B89B488440p-20, -0x1.2F5145DB4F06Bp-19, -0x1.AC95E9D0F9FEBp-19, -0x1.2EA1F588B8C44p-18,
+		  -0x1.03F24EA0E809Ap-22, -0x1.323F588EA12EFp-23, -0x1.A2819D96F25CDp-25, -0x1.40B12D45B6FF7p-27, -0x1.03EDA4214AA77p-30, -0x1.945E55F6C1889p-35, -0x1.FE624108B8A89p-41, -0x1.79A9315474FBCp-48, -0x1.213923B314177p-58 },
+		{ 0x1.3C833C7E57555p-32, 0x1.65CE767941333p-29, 0x1.F5EAEB4182000p-28, 0x1.F39A3233DB555p-27, 0x1.A633C261B2889p-26, 0x1.451BC43E4399Ap-25, 0x1.D978AA12C6889p-25, 0x1.4E81861D0C222p-24, 0x1.D86700FA3C666p-24,
+		  0x1.630CA25AF7777p-28, 0x1.A24A2BC024444p-29, 0x1.1DCF3F8B92666p-30, 0x1.B604DF9C38889p-33, 0x1.630642247D555p-36, 0x1.14278AE356666p-40, 0x1.5C8E24D756666p-46, 0x1.01EA44F9D4889p-53, 0x1.8B097D98FAAABp-64 },
+		{ -0x1.EE1D8C95AAAABp-38, -0x1.174A3D72B3333p-34, -0x1.87C713A611111p-33, -0x1.85F86AA488889p-32, -0x1.498E0BCAAAAABp-31, -0x1.FB88D0B5EEEEFp-31, -0x1.7192D28188889p-30, -0x1.051A3D94B3333p-29, -0x1.70BD391ACCCCDp-29,
+		  -0x1.F2FDAF7000000p-34, -0x1.25EF294022222p-34, -0x1.91AE2800CCCCDp-36, -0x1.33CC838E44444p-38, -0x1.F2F473059999Ap-42, -0x1.841BDBE333333p-46, -0x1.E9DD9C0A22222p-52, -0x1.6A7A816666666p-59, -0x1.1598414888889p-69 },
+		{ 0x1.8019263BBBBBCp-43, 0x1.B23CBE1777777p-40, 0x1.3090640222222p-38, 0x1.2F2864E444444p-37, 0x1.00303F499999Ap-36, 0x1.8A8DDAAAAAAABp-36, 0x1.1F4D147111111p-35, 0x1.95F4DC0444444p-35, 0x1.1EA6F79333333p-34,
+		  0x1.5ECCFEF777777p-39, 0x1.9D4AA1B333333p-40, 0x1.1A56021111111p-41, 0x1.B0C677BBBBBBCp-44, 0x1.5EEF771111111p-47, 0x1.10BDEDE666666p-51, 0x1.58743BDDDDDDEp-57, 0x1.FD9E8C8888889p-65, 0x1.868492999999Ap-75 },
+		{ -0x1.44F3CCCCCCCCDp-49, -0x1.70BD0CCCCCCCDp-46, -0x1.02876CCCCCCCDp-44, -0x1.016F044444444p-43, -0x1.B23ECCCCCCCCDp-43, -0x1.4E61377777777p-42, -0x1.E804266666666p-42, -0x1.5885F77777777p-41, -0x1.E67A888888889p-41,
+		  0x1.2DC4333333333p-44, 0x1.5FB7777777777p-45, 0x1.E5093BBBBBBBCp-47, 0x1.74CF000000000p-49, 0x1.2AE719999999Ap-52, 0x1.C4B1DDDDDDDDEp-57, 0x1.2C18733333333p-62, 0x1.BAC4333333333p-70, 0x1.4B95BBBBBBBBCp-80 },
+		{ 0x1.3CFCC44444444p-49, 0x1.60DDB55555555p-46, 0x1.F0230CCCCCCCDp-45, 0x1.EDE0EAAAAAAABp-44, 0x1.A2A5688888889p-43, 0x1.40CCEAAAAAAABp-42, 0x1.D4D5FBBBBBBBCp-42, 0x1.4ACD2EEEEEEEFp-41, 0x1.D36B6AAAAAAABp-41,
+		  0x1.3160022222222p-43, 0x1.67F2B9999999Ap-44, 0x1.EF14CCCCCCCCDp-46, 0x1.79F6BBBBBBBBCp-48, 0x1.29B2844444444p-51, 0x1.E679C00000000p-56, 0x1.25534CCCCCCCDp-61, 0x1.B6974CCCCCCCDp-69, 0x1.49DA377777777p-79 },
+		{ -0x1.8399111111111p-49, -0x1.B440F77777777p-46, -0x1.32247BBBBBBBCp-44, -0x1.308D377777777p-43, -0x1.02096AAAAAAABp-42, -0x1.8D75622222222p-42, -0x1.20A1955555555p-41, -0x1.983A1DDDDDDDEp-41, -0x1.2041BBBBBBBBCp-40,
+		  -0x1.87BDE66666666p-43, -0x1.CB02333333333p-44, -0x1.3B26F33333333p-45, -0x1.E3DE1DDDDDDDEp-48, -0x1.85C5911111111p-51, -0x1.29E5666666666p-55, -0x1.828C333333333p-61, -0x1.1D11088888889p-68, -0x1.B014EEEEEEEEFp-79 },
+		{ -0x1.DFAD888888889p-49, -0x1.0ACA466666666p-45, -0x1.7754155555555p-44, -0x1.756859999999Ap-43, -0x1.3C96ACCCCCCCDp-42, -0x1.E52DE66666666p-42, -0x1.62CD2EEEEEEEFp-41, -0x1.F499E66666666p-41, -0x1.617DE22222222p-40,
+		  -0x1.DFF6044444444p-43, -0x1.1B07866666666p-43, -0x1.84463BBBBBBBCp-45, -0x1.298DCCCCCCCCDp-47, -0x1.D42F800000000p-51, -0x1.7ED1488888889p-55, -0x1.CA03AAAAAAAABp-61, -0x1.552AD55555555p-68, -0x1.037A9DDDDDDDEp-78 },
+		{ 0x1.0308CCCCCCCCDp-49, 0x1.238D333333333p-46, 0x1.993B99999999Ap-45, 0x1.970799999999Ap-44, 0x1.58FE444444444p-43, 0x1.09B7AAAAAAAABp-42, 0x1.81DCEEEEEEEEFp-42, 0x1.10E3EEEEEEEEFp-41, 0x1.8150000000000p-41,
+		  0x1.05F2000000000p-43, 0x1.3303333333333p-44, 0x1.A59DBBBBBBBBCp-46, 0x1.43B9000000000p-48, 0x1.0486000000000p-51, 0x1.8D2BBBBBBBBBCp-56, 0x1.01DB111111111p-61, 0x1.7BBEEEEEEEEEFp-69, 0x1.204A222222222p-79 },
+		{ 0x1.76E1555555555p-49, 0x1.A107DDDDDDDDEp-46, 0x1.256B333333333p-44, 0x1.23D2666666666p-43, 0x1.EED5333333333p-43, 0x1.7B3D555555555p-42, 0x1.156DDDDDDDDDEp-41, 0x1.876999999999Ap-41, 0x1.144AEEEEEEEEFp-40,
+		  0x1.772A444444444p-43, 0x1.BA81777777777p-44, 0x1.2F24AAAAAAAABp-45, 0x1.D1A999999999Ap-48, 0x1.6E45DDDDDDDDEp-51, 0x1.2B6A444444444p-55, 0x1.64A1111111111p-61, 0x1.08F4AAAAAAAABp-68, 0x1.9628CCCCCCCCDp-79 },
+		{ -0x1.0875555555555p-51, -0x1.29A6666666666p-48, -0x1.A1D7777777777p-47, -0x1.9F7DDDDDDDDDEp-46, -0x1.6057777777777p-45, -0x1.0F61111111111p-44, -0x1.8A06666666666p-44, -0x1.16ADDDDDDDDDEp-43, -0x1.8966666666666p-43,
+		  -0x1.0B60000000000p-45, -0x1.3975555555555p-46, -0x1.AE8AAAAAAAAABp-48, -0x1.4AA5555555555p-50, -0x1.09B3333333333p-53, -0x1.9408888888889p-58, -0x1.066EEEEEEEEEFp-63, -0x1.81E6666666666p-71, -0x1.2584444444444p-81 },
+		{ -0x1.C9B7777777777p-51, -0x1.FD3CCCCCCCCCDp-48, -0x1.6656666666666p-46, -0x1.6452222222222p-45, -0x1.2E18000000000p-44, -0x1.CF20000000000p-44, -0x1.52DCCCCCCCCCDp-43, -0x1.DE13333333333p-43, -0x1.5163333333333p-42,
+		  -0x1.CA27777777777p-45, -0x1.0E28000000000p-45, -0x1.71F5555555555p-47, -0x1.1C84444444444p-49, -0x1.BFA8888888889p-53, -0x1.6DB4444444444p-57, -0x1.B284444444444p-63, -0x1.423999999999Ap-70, -0x1.F093333333333p-81 }
+	}
+};
+
+/* NGQP = 10: roots (10) and weights (10) on [0,92), one polynomial of degree 14 per interval */
+static const double rys_table_10[23][RYS_TABLE_NCOEF][20] = {
+	{
+		{ 0x1.5D1A93C06EC09p-8, 0x1.842E968C53476p-5, 0x1.073BCFBAAC52Fp-3, 0x1.F14F6C90A6E63p-3, 0x1.869338737C52Dp-2, 0x1.10C7BD667FDA4p-1, 0x1.5DCBFBD148702p-1, 0x1.A2BF865E8C45Ep-1, 0x1.D84544FB09DBAp-1, 0x1.F8430DC460106p-1,
+		  0x1.275A1AB1236E8p-3, 0x1.0AC308B3E3207p-3, 0x1.B5261F4B05717p-4, 0x1.47B7BA1C8E16Fp-4, 0x1.C6F5F697B94AEp-5, 0x1.28684C5EF63CEp-5, 0x1.6E99DEB371825p-6, 0x1.AE1B390479EF4p-7, 0x1.CB59048E0DA37p-8, 0x1.63184D68A5C42p-9 },
+		{ -0x1.028CE1CDB440Dp-11, -0x1.146AF6E272B5Bp-8, -0x1.599314AC11434p-7, -0x1.1EB54CECE69C5p-6, -0x1.74D53B76C1A35p-6, -0x1.8F2E9A03EA4B9p-6, -0x1.6045961BA3816p-6, -0x1.EB76F4F06DC74p-7, -0x1.DD521ED85CB72p-8, -0x1.8F99C9AFDDF24p-10,
+		  -0x1.064CD820B6A28p-7, -0x1.0E9E4B09C67C9p-6, -0x1.D0EE72588CC14p-6, -0x1.30EFB7A22C0E5p-5, -0x1.4430C2CA70516p-5, -0x1.256BAB2F2CA91p-5, -0x1.D2D3EF0519081p-6, -0x1.49E80D8E3DE35p-6, -0x1.8FE0B55578B52p-7, -0x1.4B71C613A2393p-8 },
+		{ 0x1.1DB6F4DC2250Dp-15, 0x1.195BCAB6834C5p-12, 0x1.24B87B399E026p-11, 0x1.585453B2E15B5p-11, 0x1.B31C1AE24D452p-12, -0x1.73AFA9CE73443p-14, -0x1.27E35909C09B8p-11, -0x1.73B5EE36FF4BAp-11, -0x1.E9B59BADEE1D0p-12, -0x1.DBD926FC4FDF9p-14,
+		  0x1.059A77A4F9FE3p-11, 0x1.16E0025844D2Fp-9, 0x1.7E670500166A6p-8, 0x1.6F41D3D06CD34p-7, 0x1.0D2CE78903E99p-6, 0x1.3DB0BB6BC31DDp-6, 0x1.388DFC7F99296p-6, 0x1.039E959E857B4p-6, 0x1.5FE0639452B4Cp-7, 0x1.365A7C522D695p-8 },
+		{ -0x1.16C8B8294EDBDp-19, -0x1.DA03E6F6EE49Bp-17, -0x1.48FA7AE3B298Dp-16, -0x1.A06B0E5706226p-19, 0x1.B4E2BF4BCC79Cp-16, 0x1.434105B265A3Fp-15, 0x1.2F7461A0276CDp-16, -0x1.D9CBE649889D5p-17, -0x1.7F361259FE813p-16, -0x1.EC91AE1986B9Ap-18,
+		  -0x1.10F959F850CDDp-15, -0x1.008F1379624D5p-12, -0x1.032F7577484F0p-10, -0x1.57F7B5B0ACBAFp-9, -0x1.4B3841D37375Fp-8, -0x1.EB060800A56B3p-8, -0x1.22A65FA84AF40p-7, -0x1.16647351F330Fp-7, -0x1.A0C0C2B7B0735p-8, -0x1.8496AA9581AC5p-9 },
+		{ 0x1.F98B2E64F3A5Ep-24, 0x1.4EAABF0546DABp-21, 0x1.A99597E4A4222p-23, -0x1.4EAF63FFEC933p-20, -0x1.A2AC5D4190822p-20, 0x1.5E62AC4829EEFp-22, 0x1.FC3DBF4B292EFp-20, 0x1.B6C3EFE152666p-21, -0x1.9CA079BC32000p-21, -0x1.D00C511042000p-22,
+		  0x1.1E72590DC3EDEp-19, 0x1.B10B44BE3247Dp-16, 0x1.3416538B61183p-13, 0x1.0F6BC939EA087p-11, 0x1.4C040F6BCE4F4p-10, 0x1.2CD1F5B680C41p-9, 0x1.A38F7A96D15D2p-9, 0x1.C83FD55ADC0EEp-9, 0x1.7546CDC46C9B3p-9, 0x1.6DDD6D3A20ABAp-10 },
+		{ -0x1.B3599F3B21BBCp-28, -0x1.71AB57ADD8444p-26, 0x1.0DD6D1DFF0000p-25, 0x1.29A2FA8989111p-24, -0x1.1993AD97B6666p-25, -0x1.D7144021A0889p-24, 0x1.305BA41EEEEEFp-27, 0x1.7583374A38889p-24, -0x1.36597B5C11111p-28, -0x1.9373AABD44444p-26,
+		  -0x1.2990CAFCCD666p-23, -0x1.56265BD11F622p-19, -0x1.4B5CB737792F1p-16, -0x1.78352B9AA1927p-14, -0x1.1CF227DC4D1A0p-12, -0x1.34EB9CC67D3C7p-11, -0x1.F2F7833E8001Fp-11, -0x1.3005CF6CE4209p-10, -0x1.0D721A69BD84Ep-10, -0x1.143C5E8692007p-11 },
+		{ 0x1.67A1C3B044444p-32, 0x1.B243E26233333p-32, -0x1.7561667280000p-29, 0x1.9D1380F333333p-36, 0x1.86B419DBE6666p-28, -0x1.7B6FB441BBBBCp-30, -0x1.902FBB0E77777p-28, 0x1.807AA3B155555p-29, 0x1.E3C449F99999Ap-30, -0x1.432682D088889p-30,
+		  0x1.306005A371111p-27, 0x1.003D473E1EF77p-22, 0x1.48BA5A6354B00p-19, 0x1.D5C0676A5825Ep-17, 0x1.AFAC5167795D4p-15, 0x1.132413E74DAD1p-13, 0x1.FB4EBAF3B0D26p-13, 0x1.568AAFF532FD9p-12, 0x1.464CF0F9224D9p-12, 0x1.5C5EBB5058F8Cp-13 },
+		{ -0x1.1E230C3E66666p-36, 0x1.37766D7777777p-36, 0x1.E2CF67E666666p-34, -0x1.DAB4151DDDDDEp-33, -0x1.7966EE1111111p-35, 0x1.A1FA86AAAAAABp-32, -0x1.F6E9A74444444p-33, -0x1.EFF9847777777p-34, 0x1.6A17441111111p-33, -0x1.BF44400000000p-35,
+		  -0x1.3238857333333p-31, -0x1.6EC9E05815555p-26, -0x1.30B5D8BB81111p-22, -0x1.0CBA1B6EEC2ABp-19, -0x1.26854B5EF72EFp-17, -0x1.B2FBBA488651Ap-16, -0x1.C4291470E893Cp-15, -0x1.4F105268085A2p-14, -0x1.54B557D556E61p-14, -0x1.7956D985D7FA2p-15 },
+		{ 0x1.C03F3ACCCCCCDp-41, -0x1.4D045CEEEEEEFp-39, 0x1.DD63800000000p-43, 0x1.AF675F999999Ap-37, -0x1.3CACB8AAAAAABp-36, 0x1.0B5C151111111p-37, 0x1.0CDF415555555p-36, -0x1.0BF3F4CCCCCCDp-36, 0x1.7A837CCCCCCCDp-37, 0x1.B410666666666p-42,
+		  0x1.33177FE666666p-35, 0x1.F8D9DF2F9999Ap-30, 0x1.0A5C837F12222p-25, 0x1.1D25602EF5111p-22, 0x1.6F49E0241AE66p-20, 0x1.363F9617742EFp-18, 0x1.67BDFE1735900p-17, 0x1.2213690C7AD2Bp-16, 0x1.38F274576D555p-16, 0x1.664C0B37E91BCp-17 },
+		{ -0x1.F0DBECCCCCCCDp-45, 0x1.7EB2222222222p-48, -0x1.B3B01DDDDDDDEp-41, -0x1.9D376AAAAAAABp-41, -0x1.5326EEEEEEEEFp-41, -0x1.C855933333333p-39, -0x1.F3C3BBBBBBBBCp-41, -0x1.DBC2555555555p-39, -0x1.8760E22222222p-39, -0x1.C5E2111111111p-39,
+		  -0x1.6E31ECCCCCCCDp-39, -0x1.5067EA2222222p-33, -0x1.BA3D050911111p-29, -0x1.1B273E697999Ap-25, -0x1.A729B99015555p-23, -0x1.944DA71DBC666p-21, -0x1.02FFB7FE70444p-19, -0x1.C312D69079DDEp-19, -0x1.00C2521800B9Ap-18, -0x1.2EF4E5B3625EFp-19 },
+		{ -0x1.8761555555555p-46, -0x1.DFD2EAAAAAAABp-43, -0x1.28092EEEEEEEFp-41, -0x1.2EEFF11111111p-40, -0x1.AFAD155555555p-40, -0x1.3902422222222p-39, -0x1.8729C88888889p-39, -0x1.CAA7A22222222p-39, -0x1.024AEAAAAAAABp-38, -0x1.115F9DDDDDDDEp-38,
+		  -0x1.0CF5AEEEEEEEFp-41, 0x1.9B241ECCCCCCDp-37, 0x1.5DBEC01444444p-32, 0x1.08EA670CEEEEFp-28, 0x1.C62E3448D1111p-26, 0x1.E5F058B64EEEFp-24, 0x1.550DAB680599Ap-22, 0x1.3E8F350C05BBCp-21, 0x1.7CD363F33B111p-21, 0x1.CDCC76092FDDEp-22 },
+		{ 0x1.C939333333333p-47, 0x1.F716AAAAAAAABp-44, 0x1.510F111111111p-42, 0x1.3D15EEEEEEEEFp-41, 0x1.E79A666666666p-41, 0x1.538899999999Ap-40, 0x1.A7E7777777777p-40, 0x1.F859555555555p-40, 0x1.18B0DDDDDDDDEp-39, 0x1.2A39111111111p-39,
+		  0x1.6ACC888888889p-42, -0x1.676D111111111p-41, -0x1.075C908888889p-35, -0x1.D542009555555p-32, -0x1.C8C1A88222222p-29, -0x1.0F173F7C11111p-26, -0x1.9D94A602DDDDEp-25, -0x1.9BB0B08208889p-24, -0x1.01332ACE74444p-23, -0x1.3FABA4DEFD555p-24 },
+		{ 0x1.4802888888889p-46, 0x1.6839BBBBBBBBCp-43, 0x1.E4FFBBBBBBBBCp-42, 0x1.C4D5BBBBBBBBCp-41, 0x1.5D24444444444p-40, 0x1.E2F3555555555p-40, 0x1.3127333333333p-39, 0x1.68A599999999Ap-39, 0x1.928D99999999Ap-39, 0x1.AB5C444444444p-39,
+		  0x1.0A47555555555p-41, 0x1.2AFE111111111p-41, 0x1.C294844444444p-39, 0x1.8FE4F77777777p-35, 0x1.B200E5A222222p-32, 0x1.1B54A2F99999Ap-29, 0x1.D2BB45899999Ap-28, 0x1.ECA0D3CAEEEEFp-27, 0x1.4086BADE88889p-26, 0x1.97800BC844444p-27 },
+		{ -0x1.D6B999999999Ap-49, -0x1.0033333333333p-45, -0x1.5928888888889p-44, -0x1.4272222222222p-43, -0x1.F45999999999Ap-43, -0x1.5941111111111p-42, -0x1.B266666666666p-42, -0x1.00E0000000000p-41, -0x1.1ED2222222222p-41, -0x1.3073333333333p-41,
+		  -0x1.7B86666666666p-44, -0x1.899DDDDDDDDDEp-44, -0x1.7108000000000p-42, -0x1.4F8FB77777777p-38, -0x1.96DA3EEEEEEEFp-35, -0x1.2427FDCCCCCCDp-32, -0x1.03E3A3CCCCCCDp-30, -0x1.22FC28AAAAAABp-29, -0x1.8A88E6099999Ap-29, -0x1.009E023266666p-29 },
+		{ -0x1.9008888888889p-48, -0x1.B7FEEEEEEEEEFp-45, -0x1.2825555555555p-43, -0x1.147A222222222p-42, -0x1.AA7CCCCCCCCCDp-42, -0x1.26E3BBBBBBBBCp-41, -0x1.74A999999999Ap-41, -0x1.B860000000000p-41, -0x1.EB9BBBBBBBBBCp-41, -0x1.04F0000000000p-40,
+		  -0x1.44B8888888889p-43, -0x1.39FA222222222p-43, -0x1.FBC5555555555p-44, 0x1.6FEB333333333p-42, 0x1.5220E22222222p-38, 0x1.0CBC0DDDDDDDEp-35, 0x1.FED93E2222222p-34, 0x1.2C2E845555555p-32, 0x1.A4AFA7EEEEEEFp-32, 0x1.16AC5CF777777p-32 }
+	},
+	{
+		{ 0x1.246ACDFA97844p-8, 0x1.47053CB1BBFA9p-5, 0x1.C09856F3DA503p-4, 0x1.AEED18565EA3Ep-3, 0x1.59DB901FCA20Cp-2, 0x1.EF9DFC1E6B131p-2, 0x1.46B6AB00589ACp-1, 0x1.91E363E9CF513p-1, 0x1.CFC19164F7602p-1, 0x1.F66F428CD9DD2p-1,
+		  0x1.0A2E4476540ADp-3, 0x1.AA7787A31A502p-4, 0x1.1371DA88C2228p-4, 0x1.22DD1CF669FD3p-5, 0x1.00F4AC2C21FB0p-6, 0x1.89444EB0983C2p-8, 0x1.11784E9E5FB0Ep-9, 0x1.6D8D189A4265Cp-11, 0x1.E6750BC7221FCp-13, 0x1.167CDF1E2D30Ep-14 },
+		{ -0x1.8CE6F7C985908p-12, -0x1.AFF9E83EBA49Fp-9, -0x1.17D485AFB97D2p-7, -0x1.E9AEB002D163Dp-7, -0x1.555CBB4D44C8Dp-6, -0x1.8D6336D291D61p-6, -0x1.80B79956C0D56p-6, -0x1.266C15BA8F332p-6, -0x1.35A8D9917B158p-7, -0x1.10EAFAEFBE501p-9,
+		  -0x1.9F8B27D0467AAp-8, -0x1.50F2E08AEBD87p-7, -0x1.B77BA2ACFF7F0p-7, -0x1.9947B6B5EC36Bp-7, -0x1.1D9453CF1DA21p-7, -0x1.3D996BC23B734p-8, -0x1.2BBA0E7D735B2p-9, -0x1.FE31904F0F139p-11, -0x1.9477B81DA352Dp-12, -0x1.0045D6D556DF7p-13 },
+		{ 0x1.92633879B9EBFp-16, 0x1.9CF12C400874Fp-13, 0x1.D516B84437BB1p-12, 0x1.41B9B8F1F4F9Fp-11, 0x1.1727A584C0041p-11, 0x1.28E8BE46EF1F4p-13, -0x1.AF2F913268FD6p-12, -0x1.91E76D50B37F7p-11, -0x1.4647AE24D1A07p-11, -0x1.64A5B9AABBC22p-13,
+		  0x1.6A7438AEC01C6p-12, 0x1.25CE04C306FD9p-10, 0x1.2C0EC8F5BCF4Dp-9, 0x1.944D8AA2405ECp-9, 0x1.87EA112BA9BCAp-9, 0x1.23A4A7E3DC59Ep-9, 0x1.61E9D2FD5D6BEp-10, 0x1.72306952B4A6Dp-11, 0x1.55E6D85863975p-12, 0x1.D9D48E2901241p-14 },
+		{ -0x1.68E3832B8B552p-20, -0x1.4D3BE950F539Fp-17, -0x1.1F96EFD2F9324p-16, -0x1.5D05AFD1E7F70p-17, 0x1.B7CEFDA222177p-17, 0x1.344DE6AFDE587p-15, 0x1.11200EF71E9E7p-15, -0x1.F7E5ABBC6E400p-19, -0x1.E2E078062E249p-16, -0x1.91412736E7A2Bp-17,
+		  -0x1.4D124A7B8CF09p-16, -0x1.D2D1F9FA33330p-14, -0x1.5856FC7AEFF5Bp-12, -0x1.3EB7EA243546Cp-11, -0x1.996E2DE7F7BF3p-11, -0x1.8739A1100326Bp-11, -0x1.272273507D1F3p-11, -0x1.71C668D098A3Cp-12, -0x1.86D44649ED116p-13, -0x1.25389AB10A414p-14 },
+		{ 0x1.2D60ECFE11A00p-24, 0x1.D2A8CF9362311p-22, 0x1.96BD100A9DEEFp-22, -0x1.422DE4EE60C44p-21, -0x1.A732D7EAC4311p-20, -0x1.909FD1441AB33p-21, 0x1.AA64198450222p-20, 0x1.E36EA78D1CFBCp-20, -0x1.5E53D2B60E99Ap-21, -0x1.9548E3C611555p-21,
+		  0x1.3634D69FBC19Ap-20, 0x1.5760CCE1933A4p-17, 0x1.5FC43BF90B853p-15, 0x1.AF40ADB15834Bp-14, 0x1.630AB1681A544p-13, 0x1.A70A19953F335p-13, 0x1.82FE82B7CCBFDp-13, 0x1.1C96F86FE2A4Ap-13, 0x1.532FC6D964DFEp-14, 0x1.112DD064DD647p-15 },
+		{ -0x1.DF89B84BEC444p-29, -0x1.1525A974EE666p-26, 0x1.00A7217FF7777p-27, 0x1.E5583B10B0000p-25, 0x1.ACD5B75F37777p-26, -0x1.9657917D82AABp-24, -0x1.3433755128889p-24, 0x1.B633D04531111p-24, 0x1.26B2AD50FBBBCp-25, -0x1.720318CD2AAABp-25,
+		  -0x1.1FDCD40E9999Ap-24, -0x1.DC4E614265800p-21, -0x1.48DB90F704311p-18, -0x1.03BF247A0A0CCp-16, -0x1.0B59A031BAC32p-15, -0x1.8464430979540p-15, -0x1.A6654804AA4DEp-15, -0x1.66A653D2C6468p-15, -0x1.DC0BD820EE16Dp-16, -0x1.988E16A620BEDp-17 },
+		{ 0x1.6F20720566666p-33, 0x1.F1B86AA444444p-32, -0x1.7219802BDDDDEp-30, -0x1.E3E062A077777p-30, 0x1.E4B3311C44444p-29, 0x1.F3EFA87B55555p-29, -0x1.CDC2ED0477777p-28, -0x1.2A7976A955555p-30, 0x1.5AEA15E833333p-28, -0x1.2C41447533333p-29,
+		  0x1.080AAB02A4444p-28, 0x1.3AFE7F5262666p-24, 0x1.1E1EF54E43000p-21, 0x1.1CEC00323D8EFp-19, 0x1.67697F16102BEp-18, 0x1.388B637031511p-17, 0x1.8D871B3103FCDp-17, 0x1.804F97419285Cp-17, 0x1.190550A9597C4p-17, 0x1.FEB4400CDD45Ep-19 },
+		{ -0x1.0FE7314EEEEEFp-37, -0x1.29C7108888889p-38, 0x1.60F3ECB333333p-34, -0x1.A7DA0C1111111p-35, -0x1.E066208000000p-33, 0x1.2DD8F5C444444p-32, 0x1.43ED9A4CCCCCDp-33, -0x1.EBD88ACCCCCCDp-32, 0x1.508AD54CCCCCDp-32, -0x1.8E410CEEEEEEFp-34,
+		  -0x1.DDAE0E8888889p-33, -0x1.902C265CBBBBCp-28, -0x1.D4A6FDF886666p-25, -0x1.20F0A7F337DDEp-22, -0x1.B75834B1862ABp-21, -0x1.C26A20E140333p-20, -0x1.4A5B41A83846Fp-19, -0x1.67470D7967FCBp-19, -0x1.1EC6700B0CB5Cp-19, -0x1.1257619378605p-20 },
+		{ 0x1.950BD40000000p-42, -0x1.0D23E44444444p-41, -0x1.4600666666666p-39, 0x1.2D91142222222p-37, -0x1.CAEDB77777777p-40, -0x1.1A79DF3333333p-36, 0x1.0E08E7999999Ap-35, -0x1.3C86851111111p-36, 0x1.3E6CE08888889p-37, -0x1.E5F7111111111p-43,
+		  0x1.B750E52222222p-37, 0x1.EB3CFEE111111p-32, 0x1.6C45BB4488889p-28, 0x1.11D5DD9584444p-25, 0x1.EECD7FCD9BDDEp-24, 0x1.27145A01D1111p-22, 0x1.ED31ABD546B77p-22, 0x1.2A883850EBC2Bp-21, 0x1.01FC5363FFA8Dp-21, 0x1.028AC1FF5C85Ap-22 },
+		{ -0x1.176C111111111p-45, -0x1.73BE2AAAAAAABp-44, -0x1.B74DC44444444p-42, -0x1.2FB0CEEEEEEEFp-40, -0x1.50B0CCCCCCCCDp-42, -0x1.53D6844444444p-39, -0x1.352C2EEEEEEEFp-39, -0x1.F26EAAAAAAAABp-40, -0x1.F7765DDDDDDDEp-39, -0x1.B7D3800000000p-39,
+		  -0x1.38885EEEEEEEFp-40, -0x1.2729898000000p-35, -0x1.0E7CDD9222222p-31, -0x1.E9019DF1AAAABp-29, -0x1.033E55C25BBBCp-26, -0x1.638F3294F4000p-25, -0x1.4EF68C03C1EEFp-24, -0x1.BF361E2FF9A22p-24, -0x1.9F6452F28E777p-24, -0x1.B22CBDBFAC79Ap-25 },
+		{ -0x1.499B99999999Ap-46, -0x1.88AA800000000p-43, -0x1.036EE66666666p-41, -0x1.F616955555555p-41, -0x1.96E1888888889p-40, -0x1.0D71622222222p-39, -0x1.8087B77777777p-39, -0x1.A9D00CCCCCCCDp-39, -0x1.0392822222222p-38, -0x1.0F986CCCCCCCDp-38,
+		  -0x1.1A73CEEEEEEEFp-41, 0x1.11E9300000000p-39, 0x1.7E19890000000p-35, 0x1.9DA4318444444p-32, 0x1.FD4BC75D88889p-30, 0x1.8D7B5DDEA2222p-28, 0x1.A21BB32074444p-27, 0x1.3141D9EE36CCDp-26, 0x1.2EC78276A9889p-26, 0x1.48C42E550F000p-27 },
+		{ 0x1.7D58000000000p-47, 0x1.A598AAAAAAAABp-44, 0x1.1DE8EEEEEEEEFp-42, 0x1.1212BBBBBBBBCp-41, 0x1.B13EEEEEEEEEFp-41, 0x1.3371333333333p-40, 0x1.8F3E444444444p-40, 0x1.E61F777777777p-40, 0x1.13CDBBBBBBBBCp-39, 0x1.2968222222222p-39,
+		  0x1.496ABBBBBBBBCp-42, 0x1.66E6AAAAAAAABp-44, -0x1.F6588CCCCCCCDp-39, -0x1.4C9703AAAAAABp-35, -0x1.D7711C6AAAAABp-33, -0x1.9EC255C488889p-31, -0x1.E2C9F6BADDDDEp-30, -0x1.7E785CA626666p-29, -0x1.929BF067D999Ap-29, -0x1.C470932F87777p-30 },
+		{ 0x1.0ADD555555555p-46, 0x1.2CB7777777777p-43, 0x1.9C4EEEEEEEEEFp-42, 0x1.8730EEEEEEEEFp-41, 0x1.37EE888888889p-40, 0x1.B6E4CCCCCCCCDp-40, 0x1.1ECCAAAAAAAABp-39, 0x1.5B5F333333333p-39, 0x1.8C4399999999Ap-39, 0x1.AA01777777777p-39,
+		  0x1.D9D8AAAAAAAABp-42, 0x1.9B01111111111p-42, 0x1.3EB4666666666p-41, 0x1.0C8EF11111111p-38, 0x1.9FA4B13333333p-36, 0x1.975B61AAAAAABp-34, 0x1.04545FAEEEEEFp-32, 0x1.BCC08B70CCCCDp-32, 0x1.EE7E7DBFBBBBCp-32, 0x1.1EBE4E1E44444p-32 },
+		{ -0x1.8788888888889p-49, -0x1.ADE4444444444p-46, -0x1.2482222222222p-44, -0x1.1714444444444p-43, -0x1.BB66666666666p-43, -0x1.392EEEEEEEEEFp-42, -0x1.9828888888889p-42, -0x1.EF44444444444p-42, -0x1.1A4EEEEEEEEEFp-41, -0x1.2F71111111111p-41,
+		  -0x1.5303333333333p-44, -0x1.2158888888889p-44, -0x1.432CCCCCCCCCDp-44, -0x1.A7F5777777777p-42, -0x1.68EF911111111p-39, -0x1.8A6FA40000000p-37, -0x1.14E6A82AAAAABp-35, -0x1.FE5C684000000p-35, -0x1.2BD639F333333p-34, -0x1.66FFE6A911111p-35 },
+		{ -0x1.4611111111111p-48, -0x1.6F2CCCCCCCCCDp-45, -0x1.F773333333333p-44, -0x1.DDBEEEEEEEEEFp-43, -0x1.7CD1111111111p-42, -0x1.0C14444444444p-41, -0x1.5E21111111111p-41, -0x1.A847777777777p-41, -0x1.E3EBBBBBBBBBCp-41, -0x1.041B333333333p-40,
+		  -0x1.2146EEEEEEEEFp-43, -0x1.E5E4444444444p-44, -0x1.566CCCCCCCCCDp-44, -0x1.45EEEEEEEEEEFp-46, 0x1.FE7B99999999Ap-43, 0x1.55144CCCCCCCDp-40, 0x1.05B073BBBBBBCp-38, 0x1.0109CF6666666p-37, 0x1.3BE0A03BBBBBCp-37, 0x1.83F5FD199999Ap-38 }
+	},
+	{
+		{ 0x1.F0E85548250AFp-9, 0x1.16E0B5B805F45p-5, 0x1.816E4B7FCF074p-4, 0x1.768E62C3F24F5p-3, 0x1.31736B001304Dp-2, 0x1.BECF425929225p-2, 0x1.2DF8B7D09AD98p-1, 0x1.7DEAFB564247Bp-1, 0x1.C4AEA796A807Ep-1, 0x1.F3E5F07A0E2BFp-1,
+		  0x1.E57FCA8E2A378p-4, 0x1.658435EE395E6p-4, 0x1.8515A3F1B40F3p-5, 0x1.3B86AE24E7C1Ep-6, 0x1.83B678409E151p-8, 0x1.744A56B3451EAp-10, 0x1.2730BD5356C66p-12, 0x1.A769BCAF8B45Dp-15, 0x1.363CECCB31F2Fp-17, 0x1.D156A0D0CAF39p-20 },
+		{ -0x1.37213CA3C0F6Ap-12, -0x1.56B23B5D06959p-9, -0x1.C70CD33976E6Dp-8, -0x1.9DD57397DC1C1p-7, -0x1.30ACDC8EFDBFFp-6, -0x1.7D62A74523881p-6, -0x1.948BB7F8FD0B4p-6, -0x1.5853D11A809D5p-6, -0x1.931ADAD8D8698p-7, -0x1.809136633920Fp-9,
+		  -0x1.526D92E927FBCp-8, -0x1.C208C7BF1C09Ep-8, -0x1.D5752A7DD8A5Ap-8, -0x1.4D0F8112FD130p-8, -0x1.486F70CD4402Ep-9, -0x1.D9C49C2572879p-11, -0x1.0B7161FA9CF00p-12, -0x1.03485E8EC7B9Ep-14, -0x1.E1EF1ED13892Cp-17, -0x1.A36A367C79E7Cp-19 },
+		{ 0x1.23384F2568880p-16, 0x1.335E145A4554Bp-13, 0x1.731D67102A09Dp-12, 0x1.1B9769CA25FA6p-11, 0x1.2DF6660B4AFE4p-11, 0x1.620A3E83628DCp-12, -0x1.83D86B65ACC3Cp-13, -0x1.8315AC695EB84p-11, -0x1.A6D836D1C9A75p-11, -0x1.14CA21E2C8F99p-12,
+		  0x1.05D86C5E76653p-12, 0x1.5093F7B8B136Dp-11, 0x1.0E9629EF49EF4p-10, 0x1.1062EEA5ACE8Cp-10, 0x1.72A04758C04A6p-11, 0x1.69D8724E1B031p-12, 0x1.0E9BCA9071C87p-13, 0x1.51419FC66642Ep-15, 0x1.804AA7B78E2FAp-17, 0x1.7CAE823D08106p-19 },
+		{ -0x1.E30440117C575p-21, -0x1.D7CC2024E79A9p-18, -0x1.D55981C25346Fp-17, -0x1.BC392B087A434p-17, 0x1.03A79E44DCE2Bp-19, 0x1.D0B9C882F91B0p-16, 0x1.5BBA9452F1BA6p-15, 0x1.DF2570F824609p-17, -0x1.0973E6976BA9Ep-15, -0x1.51A97030F3897p-16,
+		  -0x1.ACB9F53187ACDp-17, -0x1.D405CEE950315p-15, -0x1.09F3CB4296D92p-13, -0x1.6B2B88E1C1864p-13, -0x1.470769AF9374Fp-13, -0x1.9EAA872365BCAp-14, -0x1.8B6CDB82B5A60p-15, -0x1.328EC5F36B54Ep-16, -0x1.A18D5F2292A78p-18, -0x1.CF839F61F2AEEp-20 },
+		{ 0x1.755D637F45F00p-25, 0x1.40CE2A2A29C55p-22, 0x1.A528844ECC5DEp-22, -0x1.3B33DCD2D7E66p-23, -0x1.3BD1A9B8B5422p-20, -0x1.7CE4035AEF3BCp-20, 0x1.2169BA0CCCBBCp-21, 0x1.5EB8340B35577p-19, 0x1.61307F86D4444p-24, -0x1.691E06403F800p-20,
+		  0x1.65BC11CE75A44p-21, 0x1.2F99CD9F92AFEp-18, 0x1.D74E88E46B8BEp-17, 0x1.A6CAE2F863434p-16, 0x1.E849E3597287Ap-16, 0x1.864D53824B08Bp-16, 0x1.CDB1FD5912009p-17, 0x1.B2709DAE5C9ADp-18, 0x1.5A9405DE35949p-19, 0x1.A98BBEEE61B4Cp-21 },
+		{ -0x1.13B68E8A5B99Ap-29, -0x1.8203D62902222p-27, -0x1.AB7E59BC15555p-29, 0x1.258E9FF442AABp-25, 0x1.A691B57A75555p-25, -0x1.3AEB77032AAABp-25, -0x1.137EECB9DE666p-23, 0x1.832CA4390AAABp-25, 0x1.048CB71CC0889p-23, -0x1.4F37CAFED7777p-24,
+		  -0x1.2B6006A59BBBCp-25, -0x1.757EB7A63EE66p-22, -0x1.81EF69C5C2866p-20, -0x1.BBB25EF894637p-19, -0x1.4106065AB3174p-18, -0x1.3C611A94B0315p-18, -0x1.C66FBC85BEE1Cp-19, -0x1.FCD2A84985A6Ep-20, -0x1.D39637F955A7Bp-21, -0x1.3A08551AA1540p-22 },
+		{ 0x1.88247F7FD1111p-34, 0x1.868D28B311111p-32, -0x1.16CF40B0BBBBCp-31, -0x1.E84FB6EB88889p-30, 0x1.5E06A45BBBBBCp-31, 0x1.6A84DEF908889p-28, -0x1.041CBD8155555p-29, -0x1.278F71D31999Ap-27, 0x1.3E6D53872AAABp-27, -0x1.FB376E38AAAABp-29,
+		  0x1.F047E6F8BBBBCp-30, 0x1.B8426BD7F4CCDp-26, 0x1.28682D37C5777p-23, 0x1.AC312E08B5711p-22, 0x1.7D05E4545FB84p-21, 0x1.C6BB0AC4F670Bp-21, 0x1.85AD512E477A1p-21, 0x1.FEACACEF611B9p-22, 0x1.0A7A792B4B797p-22, 0x1.83DE3C4C9DDDAp-24 },
+		{ -0x1.0F38CDD777777p-38, -0x1.19EE3C6666666p-37, 0x1.708F66999999Ap-35, 0x1.15321DF777777p-35, -0x1.72435A3777777p-33, -0x1.48406EAAAAAABp-35, 0x1.0A4DFE3111111p-31, -0x1.1CF718A666666p-31, 0x1.D42BACDDDDDDEp-33, -0x1.D29BC33333333p-34,
+		  -0x1.976C926AAAAABp-34, -0x1.F48497E933333p-30, -0x1.AF4DE2209DDDEp-27, -0x1.8123A1558199Ap-25, -0x1.9F07483FBC99Ap-24, -0x1.276975272F2CDp-23, -0x1.299F0737B59ABp-23, -0x1.C21B09323D82Bp-24, -0x1.077CD6574F48Ep-24, -0x1.9C2EF471CBD77p-26 },
+		{ 0x1.837557999999Ap-43, 0x1.6863000000000p-44, -0x1.EB64FC4444444p-40, 0x1.8C1EDB3333333p-39, 0x1.05A05CCCCCCCDp-37, -0x1.1A65EC2222222p-36, 0x1.2790855555555p-37, 0x1.68DBC9DDDDDDEp-36, -0x1.AE06604444444p-36, 0x1.7D8809999999Ap-38,
+		  0x1.60761AEEEEEEFp-38, 0x1.144F74499999Ap-33, 0x1.2B7D46AB77777p-30, 0x1.45FF2509E8889p-28, 0x1.A3CDDF5284000p-27, 0x1.5FD1A975E0555p-26, 0x1.9B6674CD172ABp-26, 0x1.629C3E684A0EFp-26, 0x1.CCCA415F5BD4Dp-27, 0x1.80951CF08C92Fp-28 },
+		{ -0x1.65C0ECCCCCCCDp-46, -0x1.D4D2511111111p-44, -0x1.330759999999Ap-42, -0x1.EA0C0CCCCCCCDp-41, -0x1.E41A088888889p-41, -0x1.CC063BBBBBBBCp-41, -0x1.1B547BBBBBBBCp-38, 0x1.873CEEEEEEEEFp-41, -0x1.B481A22222222p-38, -0x1.4618B77777777p-39,
+		  -0x1.6559ACCCCCCCDp-41, -0x1.323FEAEEEEEEFp-37, -0x1.8FBC8A6000000p-34, -0x1.0593D86F11111p-31, -0x1.8DD315BC73333p-30, -0x1.8410AFCF4AAABp-29, -0x1.0461D98284AABp-28, -0x1.FA25E1FF0699Ap-29, -0x1.698E6545B4000p-29, -0x1.3FF7B3122F1BCp-30 },
+		{ -0x1.2332244444444p-46, -0x1.4951666666666p-43, -0x1.C1820CCCCCCCDp-42, -0x1.ADDFF33333333p-41, -0x1.6962777777777p-40, -0x1.F0CDD11111111p-40, -0x1.57DF2AAAAAAABp-39, -0x1.A4CF622222222p-39, -0x1.02CD977777777p-38, -0x1.0969A44444444p-38,
+		  -0x1.0EBB266666666p-41, 0x1.86E46EEEEEEEFp-43, 0x1.F0B7E33333333p-38, 0x1.8F11B7A888889p-35, 0x1.63800CD1BBBBCp-33, 0x1.8F9CB1526EEEFp-32, 0x1.309C2F2AE8889p-31, 0x1.4A9A9E9D6199Ap-31, 0x1.0177A9913B666p-31, 0x1.E07E12DA5B666p-33 },
+		{ 0x1.3BB8333333333p-47, 0x1.64C9CCCCCCCCDp-44, 0x1.EAE2CCCCCCCCDp-43, 0x1.DABB555555555p-42, 0x1.809DBBBBBBBBCp-41, 0x1.149FAAAAAAAABp-40, 0x1.7578888888889p-40, 0x1.CB1D111111111p-40, 0x1.0F6E222222222p-39, 0x1.28D7222222222p-39,
+		  0x1.2A57888888889p-42, 0x1.7BC6EEEEEEEEFp-43, -0x1.F3A2E66666666p-42, -0x1.20D25EAAAAAABp-38, -0x1.2CE9D24888889p-36, -0x1.8254552222222p-35, -0x1.4B66F53022222p-34, -0x1.8DFB39C71999Ap-34, -0x1.4F383C5BF3333p-34, -0x1.481131A16999Ap-35 },
+		{ 0x1.CD8399999999Ap-47, 0x1.FE4C000000000p-44, 0x1.5F85BBBBBBBBCp-42, 0x1.53FC444444444p-41, 0x1.13BC666666666p-40, 0x1.8D67111111111p-40, 0x1.0994CCCCCCCCDp-39, 0x1.4C1B333333333p-39, 0x1.8437DDDDDDDDEp-39, 0x1.A83F555555555p-39,
+		  0x1.B1A2222222222p-42, 0x1.4C34888888889p-42, 0x1.E0E4444444444p-43, 0x1.F4AA2AAAAAAABp-42, 0x1.EE809B3333333p-40, 0x1.61BEA15555555p-38, 0x1.5239FAB555555p-37, 0x1.BE07B9AC44444p-37, 0x1.93D07678EEEEFp-37, 0x1.9CD44EE188889p-38 },
+		{ -0x1.4265555555555p-49, -0x1.6C23333333333p-46, -0x1.F593333333333p-45, -0x1.E4CAAAAAAAAABp-44, -0x1.880EEEEEEEEEFp-43, -0x1.1B85555555555p-42, -0x1.7A9999999999Ap-42, -0x1.D8F7777777777p-42, -0x1.1471111111111p-41, -0x1.2E27777777777p-41,
+		  -0x1.3158888888889p-44, -0x1.D54CCCCCCCCCDp-45, -0x1.3203333333333p-45, -0x1.9C4B333333333p-45, -0x1.8F023BBBBBBBCp-43, -0x1.3F02A44444444p-41, -0x1.544B8B999999Ap-40, -0x1.ED1EB35DDDDDEp-40, -0x1.E027754444444p-40, -0x1.007BB0AC44444p-40 },
+		{ -0x1.194F777777777p-48, -0x1.3773333333333p-45, -0x1.AD3EEEEEEEEEFp-44, -0x1.9F27777777777p-43, -0x1.50AEEEEEEEEEFp-42, -0x1.E538888888889p-42, -0x1.444AAAAAAAAABp-41, -0x1.95A999999999Ap-41, -0x1.D9E1111111111p-41, -0x1.0302AAAAAAAABp-40,
+		  -0x1.08C5555555555p-43, -0x1.9265555555555p-44, -0x1.D491111111111p-45, -0x1.838DDDDDDDDDEp-46, 0x1.0362AAAAAAAABp-47, 0x1.F33CDDDDDDDDEp-45, 0x1.31CC711111111p-43, 0x1.E1906A2222222p-43, 0x1.F1D467EEEEEEFp-43, 0x1.13797DD99999Ap-43 }
+	},
+	{
+		{ 0x1.AB5DA1FB22A21p-9, 0x1.E0D68957E3AEEp-6, 0x1.4DEA42D5E352Bp-4, 0x1.4709D3BD61B49p-3, 0x1.0DB9469D4313Dp-2, 0x1.90B8E2AC74044p-2, 0x1.147B133BFCD47p-1, 0x1.66F7388C8CDB9p-1, 0x1.B64E8CFD6955Ap-1, 0x1.F042200309CE0p-1,
+		  0x1.BEE86A048ABECp-4, 0x1.363572AC49AC8p-4, 0x1.2AC1FB0AC376Cp-5, 0x1.8F374137A1A01p-7, 0x1.734D37ECF7274p-9, 0x1.E6ECB1516B7D8p-12, 0x1.D26D636BACA30p-15, 0x1.63427A3C41875p-18, 0x1.003AA77788B0Dp-21, 0x1.AAABC427D5EECp-25 },
+		{ -0x1.F0AD9B1C3215Bp-13, -0x1.13C4AE4C3EBA5p-9, -0x1.7478852EBFA41p-8, -0x1.5C3776743FEC4p-7, -0x1.0B19DE8D26ADBp-6, -0x1.6296791BA6995p-6, -0x1.98676883E38FDp-6, -0x1.8481C1B032A69p-6, -0x1.0465B646CA24Dp-6, -0x1.1896ADBF8BA13p-8,
+		  -0x1.19C7ADCBF5BDBp-8, -0x1.3DAEABB94EA4Dp-8, -0x1.13413010455F3p-8, -0x1.3AC5236054CC7p-9, -0x1.D6C4759537BDEp-11, -0x1.D8D4EB35136F4p-13, -0x1.4EA08E24F9B29p-15, -0x1.6CB503F4BB975p-18, -0x1.6772BBB86A025p-21, -0x1.747280B31BDCAp-24 },
+		{ 0x1.AF90FBA1C8164p-17, 0x1.D073A3E45DDB0p-14, 0x1.249EBA8E5D527p-12, 0x1.E2A46961CF603p-12, 0x1.2755A1FDBD702p-11, 0x1.EACCD9DBE147Cp-12, 0x1.162ED57F96BC2p-14, -0x1.34A27CA2C1E68p-11, -0x1.018791BC46E41p-10, -0x1.BCCF08EC74FDEp-12,
+		  0x1.8766FD380142Ep-13, 0x1.9C2D3C875BDE9p-12, 0x1.1077F725B0FFAp-11, 0x1.B0BDBF9380FD0p-12, 0x1.B6B090CA44BE5p-13, 0x1.290ACBD882D5Ep-14, 0x1.1AC0A9A278FA6p-16, 0x1.9B4EC4D8F4407p-19, 0x1.07431403010D2p-21, 0x1.48D992B5C657Bp-24 },
+		{ -0x1.4CC74DFC42494p-21, -0x1.520A154E8BC3Cp-18, -0x1.7248DD99ABAFBp-17, -0x1.BE9B4E463325Cp-17, -0x1.7071C5A14D017p-18, 0x1.0707807B55F11p-16, 0x1.549957752300Ep-15, 0x1.28B3EDCEF9511p-15, -0x1.9CB889A0CB84Bp-16, -0x1.22AA15BFB40FFp-15,
+		  -0x1.2071A583FF18Fp-17, -0x1.FB76BF81185AEp-16, -0x1.D0457B6DC98A2p-15, -0x1.EB9C6164BAF06p-15, -0x1.46FEA4CC1DB37p-15, -0x1.1FE8EEDE89C7Ap-16, -0x1.628BB418F567Ep-18, -0x1.4B3047E15E28Fp-20, -0x1.0A031B0F9D4D6p-22, -0x1.86E13CB0EA330p-25 },
+		{ 0x1.DE1CFC024A577p-26, 0x1.B9520BCBDBEEFp-23, 0x1.6D725E9536955p-22, 0x1.A88C1B9566333p-24, -0x1.7049459E29844p-21, -0x1.9190CB8060800p-20, -0x1.83FBF04A223BCp-21, 0x1.46DE5269A6C89p-19, 0x1.F4D2C49C69D55p-20, -0x1.3E01CD77D7EABp-19,
+		  0x1.B267291E73D9Ap-22, 0x1.2565933011D44p-19, 0x1.6843E23AF7090p-18, 0x1.EF747CDEDA073p-18, 0x1.A44C45C0E8273p-18, 0x1.D3A8914892B9Ap-19, 0x1.6A1C400D177B3p-20, 0x1.A663AE832C419p-22, 0x1.9EA3816C4AC96p-24, 0x1.5F55286FC4A0Bp-26 },
+		{ -0x1.49D5746A25111p-30, -0x1.0662558488000p-27, -0x1.BD9A9A57F1111p-28, 0x1.14934DDEACCCDp-26, 0x1.88BA583217777p-25, 0x1.28AE6A1BFBBBCp-26, -0x1.DEADEEF9A6EEFp-24, -0x1.77518397EBBBCp-24, 0x1.EF5BB99060000p-23, -0x1.11D65A61D8889p-23,
+		  -0x1.4B53DE6118889p-26, -0x1.4322C12ADF555p-23, -0x1.047D9D34DFFBCp-21, -0x1.C72CEC71F8977p-21, -0x1.E2203E27C9957p-21, -0x1.4BED6C97D04C3p-21, -0x1.3C58B4D723471p-22, -0x1.C2C19B49F4D68p-24, -0x1.08AD82251BDABp-25, -0x1.FCDD789537EF0p-28 },
+		{ 0x1.B292669900000p-35, 0x1.0F797892A2222p-32, -0x1.EF619D53BBBBCp-34, -0x1.4D45552F77777p-30, -0x1.0913DE7D55555p-30, 0x1.CABDC73500000p-29, 0x1.2704C54A00000p-28, -0x1.9660C3C9A2222p-27, 0x1.C8A84D18EEEEFp-28, -0x1.0D3F23CAEEEEFp-28,
+		  0x1.F06B958CEEEEFp-31, 0x1.565B923CC999Ap-27, 0x1.63C4E65BB4444p-25, 0x1.83F6D6F07DA66p-24, 0x1.F882C8DDB6B9Ap-24, 0x1.A6A1A8FEBCF00p-24, 0x1.E7349E4AB1094p-25, 0x1.A05FE9641EA87p-26, 0x1.1F4DE63083A60p-27, 0x1.35034F2F0A62Bp-29 },
+		{ -0x1.1DEB7EAEEEEEFp-39, -0x1.EE30E1999999Ap-38, 0x1.2F5C0B6EEEEEFp-36, 0x1.76346CEEEEEEFp-35, -0x1.11726D6EEEEEFp-34, -0x1.B2E628F333333p-33, 0x1.5C9A4F7BBBBBCp-32, 0x1.7BE5479111111p-33, -0x1.AA1CAF6EEEEEFp-31, 0x1.95F70D8888889p-33,
+		  -0x1.7A4062EEEEEEFp-35, -0x1.5EF6F5B4CCCCDp-31, -0x1.CEB00C9D5DDDEp-29, -0x1.3668670092222p-27, -0x1.E8B82DEDD9111p-27, -0x1.EB2A876C242ABp-27, -0x1.516EC056108ABp-27, -0x1.549FD5E3851EFp-28, -0x1.0FFFBBEB7F033p-29, -0x1.4374C2D320569p-31 },
+		{ 0x1.82A21CCCCCCCDp-44, 0x1.9271766666666p-43, -0x1.FA3B566666666p-41, -0x1.9149111111111p-46, 0x1.BC3ED11111111p-38, -0x1.D52C2CCCCCCCDp-40, -0x1.8D9C9BBBBBBBCp-36, 0x1.0862AC1111111p-34, -0x1.9952811111111p-34, 0x1.9BC9080000000p-35,
+		  0x1.383FF00000000p-39, 0x1.5FC14A2666666p-35, 0x1.20B0B38888889p-32, 0x1.D660AEE8D5555p-31, 0x1.BAE8DA8493333p-30, 0x1.07C547B491555p-29, 0x1.AA7DB5A726089p-30, 0x1.F5BDE66FD06EFp-31, 0x1.C988081632811p-32, 0x1.29B32E01B9709p-33 },
+		{ -0x1.0018D33333333p-46, -0x1.C0B1D55555555p-44, -0x1.0B1F266666666p-42, -0x1.5F2B2AAAAAAABp-41, -0x1.2FDB422222222p-40, -0x1.4CFA333333333p-41, -0x1.7781C00000000p-39, -0x1.3CDAA22222222p-39, -0x1.7136A00000000p-38, 0x1.98F5C44444444p-40,
+		  -0x1.FF3F59999999Ap-42, -0x1.78C68B3333333p-39, -0x1.5D0792F777777p-36, -0x1.53CA35AE66666p-34, -0x1.7A80F23E9999Ap-33, -0x1.08475A4BDDDDEp-32, -0x1.F135DD9A7BBBCp-33, -0x1.50D3ABCDF7AABp-33, -0x1.5AA9C794A7111p-34, -0x1.E9410884D3E89p-36 },
+		{ -0x1.EA2AEEEEEEEEFp-47, -0x1.19A2288888889p-43, -0x1.85C0C88888889p-42, -0x1.761A222222222p-41, -0x1.3752EEEEEEEEFp-40, -0x1.D020955555555p-40, -0x1.27B8444444444p-39, -0x1.BBAF400000000p-39, -0x1.A9AA444444444p-39, -0x1.EE03333333333p-39,
+		  -0x1.F2AD444444444p-42, -0x1.80856EEEEEEEFp-43, 0x1.64D5611111111p-40, 0x1.D15B116EEEEEFp-38, 0x1.3289F4FCCCCCDp-36, 0x1.F1807EA888889p-36, 0x1.0D8F51CACAAABp-35, 0x1.A0289F6E02222p-36, 0x1.DE63B9F0A1555p-37, 0x1.6B38A43653111p-38 },
+		{ 0x1.0D09888888889p-47, 0x1.326F99999999Ap-44, 0x1.A69D333333333p-43, 0x1.9DFF333333333p-42, 0x1.53CBEEEEEEEEFp-41, 0x1.F49D555555555p-41, 0x1.5735333333333p-40, 0x1.B4E1111111111p-40, 0x1.0E16555555555p-39, 0x1.283C777777777p-39,
+		  0x1.1064111111111p-42, 0x1.7501777777777p-43, -0x1.A163333333333p-47, -0x1.2615C55555555p-41, -0x1.D79E37999999Ap-40, -0x1.BA1C814CCCCCDp-39, -0x1.116B40BAAAAABp-38, -0x1.DC32D3A9AAAABp-39, -0x1.2EB5625680000p-39, -0x1.EAEC4E8B2999Ap-41 },
+		{ 0x1.836C888888889p-47, 0x1.B80A000000000p-44, 0x1.3064666666666p-42, 0x1.27C799999999Ap-41, 0x1.E5B6AAAAAAAABp-41, 0x1.6663111111111p-40, 0x1.E956AAAAAAAABp-40, 0x1.3A2D777777777p-39, 0x1.799AEEEEEEEEFp-39, 0x1.A5AD99999999Ap-39,
+		  0x1.89B6AAAAAAAABp-42, 0x1.1568666666666p-42, 0x1.2E75777777777p-43, 0x1.9B59AAAAAAAABp-44, 0x1.7A2DA66666666p-43, 0x1.78477D1111111p-42, 0x1.0595496222222p-41, 0x1.FD58E0D555555p-42, 0x1.634A3C3C00000p-42, 0x1.31F2ED10BBBBCp-43 },
+		{ -0x1.11F2222222222p-49, -0x1.388EEEEEEEEEFp-46, -0x1.AF0AAAAAAAAABp-45, -0x1.A6C8888888889p-44, -0x1.5A1EEEEEEEEEFp-43, -0x1.FF9DDDDDDDDDEp-43, -0x1.5DDDDDDDDDDDEp-42, -0x1.BF08888888889p-42, -0x1.0D0999999999Ap-41, -0x1.2C78888888889p-41,
+		  -0x1.15DCCCCCCCCCDp-44, -0x1.9035555555555p-45, -0x1.A331111111111p-46, -0x1.A552222222222p-47, -0x1.2744222222222p-46, -0x1.3AD9AAAAAAAABp-45, -0x1.ED24344444444p-45, -0x1.0CA91C0888889p-44, -0x1.9B8A1D6EEEEEFp-45, -0x1.7872FFFE66666p-46 },
+		{ -0x1.D948888888889p-49, -0x1.0C8C444444444p-45, -0x1.7394444444444p-44, -0x1.692AAAAAAAAABp-43, -0x1.289DDDDDDDDDEp-42, -0x1.B598888888889p-42, -0x1.2ADDDDDDDDDDEp-41, -0x1.7F5CCCCCCCCCDp-41, -0x1.CCEAAAAAAAAABp-41, -0x1.017BBBBBBBBBCp-40,
+		  -0x1.E091111111111p-44, -0x1.5261111111111p-44, -0x1.5DE4444444444p-45, -0x1.FA30000000000p-47, -0x1.6CA8888888889p-49, 0x1.73C2222222222p-49, 0x1.9CB3733333333p-48, 0x1.F811C22222222p-48, 0x1.A1B2D71111111p-48, 0x1.911FD1EEEEEEFp-49 }
+	},
+	{
+		{ 0x1.736D8F0591519p-9, 0x1.A28AFB7DB4F92p-6, 0x1.2396978DDF25Cp-4, 0x1.1F116A0D659EFp-3, 0x1.DD2D5F0D0448Dp-3, 0x1.666BACC14A4C8p-2, 0x1.F68008DC6EDDCp-2, 0x1.4DA435EC01421p-1, 0x1.A3F04257F36F7p-1, 0x1.EAD7806A7EF39p-1,
+		  0x1.9E7C57F55F37Ap-4, 0x1.1412CE9C05E09p-4, 0x1.E7E1F9A43F21Cp-6, 0x1.1BB33091486BCp-7, 0x1.ADBFF706EA294p-10, 0x1.A3F9CA4164ED2p-13, 0x1.0927569EAE0FFp-16, 0x1.C24A8A5ED108Ap-21, 0x1.2BBFF7C9921F2p-25, 0x1.C35467675B82Fp-30 },
+		{ -0x1.92B37BFB3EF8Cp-13, -0x1.C1B1A029CEAFEp-10, -0x1.3350C710CAE58p-8, -0x1.24FB313A3C8F3p-7, -0x1.CF2233CAD747Dp-7, -0x1.4195429C36B11p-6, -0x1.8C95886D0A3BAp-6, -0x1.A30142E065EAFp-6, -0x1.48527C2FAF467p-6, -0x1.A8B7D6074C699p-8,
+		  -0x1.DDB71397AD29Bp-9, -0x1.D50ACE5C0C610p-9, -0x1.5AC9B8E263183p-9, -0x1.4D5349724AEF8p-10, -0x1.9178D87C0B13Cp-12, -0x1.2E3B1D14324F2p-14, -0x1.2079E51827544p-17, -0x1.6F07946F26511p-21, -0x1.692F4BFB403D4p-25, -0x1.75E16E5F66C4Bp-29 },
+		{ 0x1.46523023805BFp-17, 0x1.640A76DFB7A1Ep-14, 0x1.CE63AC18C4CBCp-13, 0x1.92770DF2D400Dp-12, 0x1.0F36038C5BC8Ep-11, 0x1.14F7DB1F1481Bp-11, 0x1.2AB6E14D97194p-12, -0x1.5788C1050F31Fp-12, -0x1.1769567CAB99Bp-10, -0x1.6EF052766447Bp-11,
+		  0x1.2CC34EDFAC849p-13, 0x1.0A63AA7F42407p-12, 0x1.2B98458E9F670p-12, 0x1.88C03F6598A06p-13, 0x1.3921E482478C3p-14, 0x1.385239152A7EAp-16, 0x1.8FEF044D20F39p-19, 0x1.5AE344CDFFFD7p-22, 0x1.D459FC718145Cp-26, 0x1.3C0751119E92Fp-29 },
+		{ -0x1.D6A439125312Ap-22, -0x1.EB9EDECA701BEp-19, -0x1.1FF82A3AE3595p-17, -0x1.9437A7AF1D204p-17, -0x1.390D3788C1BF2p-17, 0x1.43A3B2C3B8AA2p-18, 0x1.05914A1AE3A1Bp-15, 0x1.A0967BFC240DCp-15, 0x1.5D3D3FE126666p-28, -0x1.EFEF8062A916Ep-15,
+		  -0x1.932E4A1C344E5p-18, -0x1.254A21D98930Cp-16, -0x1.BFA7F649F05F8p-16, -0x1.7F8696AF846FBp-16, -0x1.8BD08B4583B8Cp-17, -0x1.FDF10F4F413E4p-19, -0x1.A7B8041B9BF87p-21, -0x1.E1955909CD8D8p-24, -0x1.AB4C70C21C290p-27, -0x1.69FA99364A2DBp-30 },
+		{ 0x1.3A6597EDAA79Ap-26, 0x1.3125289AE0E00p-23, 0x1.248AC55E7AAEFp-22, 0x1.A9A708EC7AF77p-23, -0x1.40A71BE652CCDp-22, -0x1.3C76B81ECE333p-20, -0x1.97F4D036F9555p-20, 0x1.0219F3527AD55p-20, 0x1.1CD940839F0EFp-18, -0x1.F80A2912A1889p-19,
+		  0x1.127E76BD066ABp-22, 0x1.31246F94336DEp-20, 0x1.3336F315FE41Ep-19, 0x1.513BC07CC434Bp-19, 0x1.B7933527D90E6p-20, 0x1.64230CC4D670Bp-21, 0x1.75926025E0770p-23, 0x1.0E1A8D6ECD822p-25, 0x1.311F37EA953EFp-28, 0x1.3B22EFB25653Bp-31 },
+		{ -0x1.9B8E7B1597777p-31, -0x1.66999DF5C8000p-28, -0x1.D4384CF02BBBCp-28, 0x1.4A61B657C8889p-28, 0x1.0AB647A5CEEEFp-25, 0x1.5E16CDEA10000p-25, -0x1.812EAA2967777p-25, -0x1.9A2225B58AAABp-23, 0x1.B259CDA490889p-23, -0x1.10F965A0FAAABp-23,
+		  -0x1.867834EF37777p-27, -0x1.2F652CBFC6CCDp-24, -0x1.8B279F4F9F622p-23, -0x1.10D486C06D0EFp-22, -0x1.B8E9ED468CEC0p-23, -0x1.B8F3ACCF37652p-24, -0x1.1E2946AD223FDp-25, -0x1.0167A3A6A9CAEp-27, -0x1.69028A0A8988Ap-30, -0x1.BBED407E8C210p-33 },
+		{ 0x1.EC917124DDDDEp-36, 0x1.6277D68922222p-33, 0x1.17CCCC7AAAAABp-35, -0x1.7DCA42C155555p-31, -0x1.6BBA07AAEEEEFp-30, 0x1.78BAF0259999Ap-31, 0x1.94577311CCCCDp-28, -0x1.04E3125C22222p-28, -0x1.F118EADABBBBCp-27, 0x1.10E2A5EBD5555p-27,
+		  0x1.0117E1C500000p-31, 0x1.2340D12F4BBBCp-28, 0x1.E3C6815A20000p-27, 0x1.9D1755AAACAABp-26, 0x1.9775BAB0A5355p-26, 0x1.EF54DB5324055p-27, 0x1.8746F8D9AE691p-28, 0x1.ADE01E0758072p-30, 0x1.6E8B35C19ED52p-32, 0x1.0712B558E80B9p-34 },
+		{ -0x1.2EC3723333333p-40, -0x1.4E53881111111p-38, 0x1.BCDC068888889p-38, 0x1.20623D6EEEEEFp-35, 0x1.CCED0BBBBBBBCp-38, -0x1.4EE13DDDDDDDEp-33, -0x1.26F584999999Ap-34, 0x1.D7D2808CCCCCDp-31, -0x1.1483894B33333p-29, 0x1.07DDA2D666666p-29,
+		  -0x1.6FF8478000000p-36, -0x1.0EF377CF77777p-32, -0x1.1AD568B122222p-30, -0x1.2741AF65EEEEFp-29, -0x1.5F4D302B8BBBCp-29, -0x1.004F3496C3777p-29, -0x1.E6284A841CBBCp-31, -0x1.4120055E0FE89p-32, -0x1.4714FDD38B5D1p-34, -0x1.0D79EC9777CFAp-36 },
+		{ 0x1.1472884444444p-44, 0x1.555D2B3333333p-42, 0x1.F20699999999Ap-45, 0x1.8F4A444444444p-43, 0x1.2E76555555555p-38, 0x1.2D07A6AAAAAABp-37, -0x1.0DEFB84444444p-36, 0x1.3556F1999999Ap-36, -0x1.38B8B77777777p-38, 0x1.B468472AAAAABp-33,
+		  0x1.809D4A2222222p-40, 0x1.F2CED90888889p-37, 0x1.3E8C20BDDDDDEp-34, 0x1.91CEEB9222222p-33, 0x1.1D45E82FC6666p-32, 0x1.EE33172C41111p-33, 0x1.160140262B99Ap-33, 0x1.B3A6FF14F39DEp-35, 0x1.04F79A2FE4D44p-36, 0x1.E69047D8B1415p-39 },
+		{ -0x1.46C44CCCCCCCDp-47, -0x1.3AC5777777777p-44, -0x1.72CDB33333333p-43, -0x1.99DE111111111p-42, -0x1.A66F400000000p-41, -0x1.816A555555555p-41, -0x1.C556EEEEEEEEFp-44, -0x1.8EC79DDDDDDDEp-38, 0x1.A00AB77777777p-37, 0x1.3506788888889p-37,
+		  -0x1.7906488888889p-42, -0x1.1B4121999999Ap-40, -0x1.642173CCCCCCDp-38, -0x1.06B5168222222p-36, -0x1.B7AB6536AAAABp-36, -0x1.BF8EA6EF55555p-36, -0x1.2780DA4AC5555p-36, -0x1.0F5ACC578A889p-37, -0x1.79389A689E19Ap-39, -0x1.88F76DD06B5DEp-41 },
+		{ -0x1.B23FD9999999Ap-47, -0x1.DEE99DDDDDDDEp-44, -0x1.4CF2155555555p-42, -0x1.45FAE66666666p-41, -0x1.0D1F6EEEEEEEFp-40, -0x1.98CF8CCCCCCCDp-40, -0x1.10ED155555555p-39, -0x1.6DF85DDDDDDDEp-39, -0x1.496F111111111p-39, -0x1.02CF8EEEEEEEFp-38,
+		  -0x1.CA9B844444444p-42, -0x1.1473755555555p-42, 0x1.B98AB33333333p-43, 0x1.3CED0E2222222p-40, 0x1.419DD1F555555p-39, 0x1.7EF41E4088889p-39, 0x1.2616486F88889p-39, 0x1.3917767C3EEEFp-40, 0x1.F2EB0C997D555p-42, 0x1.1F3A5CA0E25DEp-43 },
+		{ 0x1.D5B3777777777p-48, 0x1.098BBBBBBBBBCp-44, 0x1.701B99999999Ap-43, 0x1.6912AAAAAAAABp-42, 0x1.2C1B222222222p-41, 0x1.BF06AAAAAAAABp-41, 0x1.3612CCCCCCCCDp-40, 0x1.A017333333333p-40, 0x1.EF38444444444p-40, 0x1.1987222222222p-39,
+		  0x1.FC8ECCCCCCCCDp-43, 0x1.519FEEEEEEEEFp-43, 0x1.C0E9BBBBBBBBCp-45, -0x1.2B3C911111111p-44, -0x1.BBF1D91111111p-43, -0x1.36CA271111111p-42, -0x1.1375D9D444444p-42, -0x1.50903A70AAAABp-43, -0x1.2FE3BA9E37777p-44, -0x1.7ED01C03EAAABp-46 },
+		{ 0x1.585C666666666p-47, 0x1.7B56CCCCCCCCDp-44, 0x1.074E444444444p-42, 0x1.036C222222222p-41, 0x1.ADAC444444444p-41, 0x1.402E888888889p-40, 0x1.BE3D99999999Ap-40, 0x1.24F8000000000p-39, 0x1.6A4E222222222p-39, 0x1.A072888888889p-39,
+		  0x1.6B5799999999Ap-42, 0x1.F8B8EEEEEEEEFp-43, 0x1.C78EEEEEEEEEFp-44, 0x1.503EAAAAAAAABp-45, 0x1.AA6A4CCCCCCCDp-46, 0x1.F400A88888889p-46, 0x1.EA9592EEEEEEFp-46, 0x1.53E5E97DDDDDEp-46, 0x1.587E33C777777p-47, 0x1.D70D627B88889p-49 },
+		{ -0x1.DFE2222222222p-50, -0x1.0F3999999999Ap-46, -0x1.77F7777777777p-45, -0x1.70CCCCCCCCCCDp-44, -0x1.3278888888889p-43, -0x1.C7CCCCCCCCCCDp-43, -0x1.3E04444444444p-42, -0x1.A18CCCCCCCCCDp-42, -0x1.0331111111111p-41, -0x1.2A2BBBBBBBBBCp-41,
+		  -0x1.03EDDDDDDDDDEp-44, -0x1.5D6BBBBBBBBBCp-45, -0x1.4734444444444p-46, -0x1.B168888888889p-48, -0x1.73AF777777777p-49, -0x1.895DBBBBBBBBCp-49, -0x1.ADFB644444444p-49, -0x1.52847A0000000p-49, -0x1.816AADAEEEEEFp-50, -0x1.1E0A566000000p-51 },
+		{ -0x1.A398888888889p-49, -0x1.CF74444444444p-46, -0x1.41B0000000000p-44, -0x1.3CCAAAAAAAAABp-43, -0x1.0664444444444p-42, -0x1.871AAAAAAAAABp-42, -0x1.108999999999Ap-41, -0x1.65E4444444444p-41, -0x1.BC0CCCCCCCCCDp-41, -0x1.FE54444444444p-41,
+		  -0x1.BC18888888889p-44, -0x1.334E666666666p-44, -0x1.128EEEEEEEEEFp-45, -0x1.52ECCCCCCCCCDp-47, -0x1.12B8000000000p-49, -0x1.D34CCCCCCCCCDp-55, 0x1.37CE444444444p-52, 0x1.2CFCFEEEEEEEFp-52, 0x1.7C2DD2EEEEEEFp-53, 0x1.2D99CB6222222p-54 }
+	},
+	{
+		{ 0x1.45C3D2F1ADD47p-9, 0x1.6F72E9F728339p-6, 0x1.0085A0607F1D4p-4, 0x1.FACC47E58CAF3p-4, 0x1.A75CC7E6DC9C1p-3, 0x1.406878B3AB7B5p-2, 0x1.C652CB59AC19Ap-2, 0x1.32FDA2EBA40E1p-1, 0x1.8D45E1BDC7218p-1, 0x1.E27F65589346Fp-1,
+		  0x1.82CBF74F42FE4p-4, 0x1.F4D40001EB7E9p-5, 0x1.A0EDF4724583Bp-6, 0x1.B8087DD97CA1Ep-8, 0x1.2008024A32438p-10, 0x1.C620B434490CAp-14, 0x1.A0AC72E36473Bp-18, 0x1.B2A0E3A88E07Ep-23, 0x1.103B679B0E952p-28, 0x1.2BF1A6CF2FCA1p-34 },
+		{ -0x1.4B09E2A359B4Ap-13, -0x1.731DA6C86682Bp-10, -0x1.FF75B7B6C4FE7p-9, -0x1.EE630CD9501C8p-8, -0x1.8F3D41457B86Ap-7, -0x1.1E93CD8FC218Ap-6, -0x1.749F2A8A67418p-6, -0x1.AE76B95563E14p-6, -0x1.8BBE4DA5B96F9p-6, -0x1.4B86B3076E28Dp-7,
+		  -0x1.9B029C7C3DFEEp-9, -0x1.6738F32EAE194p-9, -0x1.CDF8560FBA827p-10, -0x1.8039FB2BCEFDEp-11, -0x1.867CCDA06EF79p-13, -0x1.D6B92517BA0B4p-16, -0x1.4902620EC590Cp-19, -0x1.08BA1ADE2AB93p-23, -0x1.06BDA95EE6E90p-28, -0x1.C5B94B25C5519p-34 },
+		{ 0x1.F60421040E0D2p-18, 0x1.1490CCC10EFC5p-14, 0x1.6EFEE4800E84Cp-13, 0x1.4BEA05988B3CBp-12, 0x1.DE7E263E147A6p-12, 0x1.170E00C49E46Ep-11, 0x1.C64AE39E8031Bp-12, -0x1.7411837FBF47Cp-16, -0x1.F369153595921p-11, -0x1.2DCE6997406F5p-10,
+		  0x1.D8AC6ACD4B1A6p-14, 0x1.6801863A69C0Bp-13, 0x1.61A61286A37F5p-13, 0x1.8D2939EED2868p-14, 0x1.04E5340A2C153p-15, 0x1.959B44A3D41B9p-18, 0x1.74BB5FE389736p-21, 0x1.982E0649C8E2Cp-25, 0x1.203FE5A0C4D68p-29, 0x1.64D4D6C138C2Ap-34 },
+		{ -0x1.55536E92723EAp-22, -0x1.6BE4155194668p-19, -0x1.BF5E4EDA4C292p-18, -0x1.5BA979994D02Ap-17, -0x1.664AACD94AF00p-17, -0x1.8A59CF4ABB500p-19, 0x1.2FE0D1522D186p-16, 0x1.A00EA6F46580Fp-15, 0x1.4489B0FC261DEp-15, -0x1.7FBD0914F0AC2p-14,
+		  -0x1.2412A744A5EBCp-18, -0x1.656831FCAE26Bp-17, -0x1.D4009A1D000C5p-17, -0x1.501AEA95C941Cp-17, -0x1.18EEBD6E22E33p-18, -0x1.16C1F4BCCF4DAp-20, -0x1.4A8D876D7FB83p-23, -0x1.DD4AE9124085Dp-27, -0x1.CA47026957C4Fp-31, -0x1.8131C502A3B3Fp-35 },
+		{ 0x1.A52065C519CABp-27, 0x1.A770724FA15DEp-24, 0x1.BF05A185818CDp-23, 0x1.CBBD56C371EEFp-23, -0x1.073136D09799Ap-24, -0x1.995BA31097E66p-21, -0x1.B9BF9ABC90C89p-20, -0x1.F3AC45FFB2111p-21, 0x1.4897C88A8CB66p-18, -0x1.F71E58B8CF0CDp-19,
+		  0x1.63506566C659Ap-23, 0x1.517CA9111D755p-21, 0x1.1F453A6D78633p-20, 0x1.046169F10842Ap-20, 0x1.0F72EBEF574DAp-21, 0x1.4F632E09E1047p-23, 0x1.F39385E2AD3A8p-26, 0x1.CDD15C95C135Dp-29, 0x1.23256C03B2C7Cp-32, 0x1.3F11A5392D56Bp-36 },
+		{ -0x1.06164143B999Ap-31, -0x1.E6158810FBBBCp-29, -0x1.8E07617D5BBBCp-28, -0x1.40694CF988889p-31, 0x1.2DC066F8FAAABp-26, 0x1.5C7C2A1D07777p-25, 0x1.1706A7F0E8889p-26, -0x1.5ED3025900889p-23, -0x1.D2B4023870000p-24, 0x1.00337D5A5F777p-22,
+		  -0x1.E055FE50B999Ap-28, -0x1.310B59F43BDDEp-25, -0x1.4A8CE6EF97800p-24, -0x1.75257CB99E0CDp-24, -0x1.DE21E2E8F8A77p-25, -0x1.6A2EAFA490324p-26, -0x1.4D1613C8B33F5p-28, -0x1.8232B77CA7CC9p-31, -0x1.3758FC15FD8D2p-34, -0x1.AECB9EBF3E210p-38 },
+		{ 0x1.5D24D0AFAAAABp-36, 0x1.2AC8EE9B66666p-33, 0x1.69AC8D1BDDDDEp-33, -0x1.5A359A9A22222p-33, -0x1.9657F56A22222p-31, -0x1.2186AD9C44444p-32, 0x1.27CCF2BD77777p-28, 0x1.176E8FD900000p-27, -0x1.0F98C8C8D3333p-25, 0x1.0FCE4FC528889p-24,
+		  0x1.5749FF82AAAABp-32, 0x1.0B1AB6F9BBBBCp-29, 0x1.6B73E43AF2222p-28, 0x1.F7C4170B72AABp-28, 0x1.875CFE94B3D55p-28, 0x1.66A71A886FCDEp-29, 0x1.91651001CDC44p-31, 0x1.1EE0E9EDF4BBBp-33, 0x1.2153084964EE7p-36, 0x1.EC3AA21AA7DD8p-40 },
+		{ 0x1.93AE555555555p-47, 0x1.5637988888889p-39, 0x1.31CBCB0000000p-36, 0x1.CFC31ED555555p-35, 0x1.7B5DFF4CCCCCDp-34, 0x1.63D8C5EEEEEEFp-35, -0x1.1B03413333333p-34, 0x1.A3E590F555555p-31, 0x1.D23B1C2666666p-32, 0x1.A6BEFAB6EEEEFp-28,
+		  0x1.38045AAAAAAABp-40, -0x1.C8FA49D555555p-34, -0x1.89B14F8622222p-32, -0x1.461D30AED5555p-31, -0x1.2DE41C940DDDEp-31, -0x1.4A4DC73CC1DDEp-32, -0x1.BC216C3C31333p-34, -0x1.819AF49C47C00p-36, -0x1.DD76708B13B55p-39, -0x1.E861D4217E0ABp-42 },
+		{ 0x1.8FA9D9DDDDDDEp-44, 0x1.89ED77BBBBBBCp-41, 0x1.BE7128CCCCCCDp-40, 0x1.9F1695DDDDDDEp-39, 0x1.E76702AAAAAABp-38, 0x1.1C8CA4AAAAAABp-36, 0x1.320155999999Ap-36, -0x1.00B851999999Ap-36, 0x1.4721E56AAAAABp-32, 0x1.EB40723333333p-33,
+		  0x1.196A777777777p-39, 0x1.7F12F5999999Ap-38, 0x1.8019935111111p-36, 0x1.8AC2BAB222222p-35, 0x1.B6D4B89855555p-35, 0x1.1D27A7ED45555p-35, 0x1.C83595EC4BBBCp-37, 0x1.DB235BE4F299Ap-39, 0x1.634D566BC1333p-41, 0x1.ACBA7F146CE11p-44 },
+		{ -0x1.3232844444444p-47, -0x1.3EE61DDDDDDDEp-44, -0x1.985E7BBBBBBBCp-43, -0x1.92EDB77777777p-42, -0x1.7FDCCCCCCCCCDp-41, -0x1.1FFE2AAAAAAABp-40, -0x1.5E06888888889p-42, -0x1.33095DDDDDDDEp-39, 0x1.8F7C7BBBBBBBCp-38, -0x1.196B8BBBBBBBCp-35,
+		  -0x1.42F2333333333p-42, -0x1.1194D44444444p-41, -0x1.A8B2E48888889p-40, -0x1.DB3B8C5555555p-39, -0x1.3220D6DDDDDDEp-38, -0x1.D1F6AA279999Ap-39, -0x1.B6E2F4FD11111p-40, -0x1.0F04DF5736EEFp-41, -0x1.E284767DDF777p-44, -0x1.51C7D24302A22p-46 },
+		{ -0x1.90A7044444444p-47, -0x1.BD8FF33333333p-44, -0x1.39B9355555555p-42, -0x1.339AE22222222p-41, -0x1.0161844444444p-40, -0x1.8913D9999999Ap-40, -0x1.1C96B77777777p-39, -0x1.5912222222222p-39, -0x1.7269533333333p-38, -0x1.53D5600000000p-37,
+		  -0x1.BAF9088888889p-42, -0x1.0FF1911111111p-42, -0x1.3E9F99999999Ap-46, 0x1.DA07200000000p-43, 0x1.9238AB0000000p-42, 0x1.6928089CCCCCDp-42, 0x1.8DE16C7666666p-43, 0x1.206DFD84D1111p-44, 0x1.2DB11B1541111p-46, 0x1.E3036A0E1599Ap-49 },
+		{ 0x1.993399999999Ap-48, 0x1.C825333333333p-45, 0x1.3F0D222222222p-43, 0x1.3A4C333333333p-42, 0x1.05A7BBBBBBBBCp-41, 0x1.89D4000000000p-41, 0x1.1438EEEEEEEEFp-40, 0x1.6F3AEEEEEEEEFp-40, 0x1.B47C444444444p-40, 0x1.B1EC444444444p-40,
+		  0x1.D70E666666666p-43, 0x1.35D1888888889p-43, 0x1.EE73555555555p-45, 0x1.F2BBBBBBBBBBCp-53, -0x1.D581D55555555p-46, -0x1.094DD20000000p-45, -0x1.5563EB999999Ap-46, -0x1.1FDF342B33333p-47, -0x1.5D788923BBBBCp-49, -0x1.3BA0AD69C0000p-51 },
+		{ 0x1.29A8888888889p-47, 0x1.4AB7111111111p-44, 0x1.D026CCCCCCCCDp-43, 0x1.C6D7BBBBBBBBCp-42, 0x1.7C77777777777p-41, 0x1.1E5BDDDDDDDDEp-40, 0x1.940B333333333p-40, 0x1.0EBA666666666p-39, 0x1.5B4A666666666p-39, 0x1.9AF6666666666p-39,
+		  0x1.533A888888889p-42, 0x1.C16E666666666p-43, 0x1.7919DDDDDDDDEp-44, 0x1.BD13777777777p-46, 0x1.C409555555555p-48, 0x1.BDC6F33333333p-49, 0x1.1BC16EEEEEEEFp-49, 0x1.0FB16DD555555p-50, 0x1.7A6F61099999Ap-52, 0x1.7D88E3C022222p-54 },
+		{ -0x1.A7ACCCCCCCCCDp-50, -0x1.D70AAAAAAAAABp-47, -0x1.49A999999999Ap-45, -0x1.4521111111111p-44, -0x1.0EF999999999Ap-43, -0x1.9815555555555p-43, -0x1.1FBBBBBBBBBBCp-42, -0x1.81D1111111111p-42, -0x1.EBC4444444444p-42, -0x1.239DDDDDDDDDEp-41,
+		  -0x1.E48CCCCCCCCCDp-45, -0x1.3DDCCCCCCCCCDp-45, -0x1.1038888888889p-46, -0x1.2FC6666666666p-48, -0x1.0106666666666p-50, -0x1.661E222222222p-52, -0x1.CED3777777777p-53, -0x1.F9A1C33333333p-54, -0x1.94924A2222222p-55, -0x1.C72FF10444444p-57 },
+		{ -0x1.6AE3333333333p-49, -0x1.9405555555555p-46, -0x1.1B6D555555555p-44, -0x1.15DEEEEEEEEEFp-43, -0x1.D0BDDDDDDDDDEp-43, -0x1.5DD8888888889p-42, -0x1.EDA4444444444p-42, -0x1.4B0CCCCCCCCCDp-41, -0x1.A6D4444444444p-41, -0x1.F735555555555p-41,
+		  -0x1.9E68888888889p-44, -0x1.11FDDDDDDDDDEp-44, -0x1.CAF999999999Ap-46, -0x1.0317777777777p-47, -0x1.5F3AAAAAAAAABp-50, -0x1.0EC9111111111p-53, 0x1.51C0000000000p-57, 0x1.9D0E911111111p-57, 0x1.80005AAAAAAABp-58, 0x1.D924431111111p-60 }
+	},
+	{
+		{ 0x1.1FFF6691E8E28p-9, 0x1.450CAD5EB89F1p-6, 0x1.C66F4D65450CCp-5, 0x1.C1DC35C29103Dp-4, 0x1.790515E32DD40p-3, 0x1.1EBB157BC22D9p-2, 0x1.99A47B23F4F9Fp-2, 0x1.183C0A21E4467p-1, 0x1.72C8B59918F9Fp-1, 0x1.D5616AE03E9F6p-1,
+		  0x1.6AD287B7F6FA2p-4, 0x1.CCED2598BD4F5p-5, 0x1.70A6D6189A510p-6, 0x1.6C68A791EE149p-8, 0x1.AFF3AB80BB0B5p-11, 0x1.258ADDA976898p-14, 0x1.AD4EFBD03F37Ap-19, 0x1.36769804D05B1p-24, 0x1.996CBAD6DF0E0p-31, 0x1.20AE30F78E234p-38 },
+		{ -0x1.13892570DBFB5p-13, -0x1.35BE333762891p-10, -0x1.AD60DFEA36A3Fp-9, -0x1.A31C6EB8B6E73p-8, -0x1.57A5D6CD3CA2Bp-7, -0x1.F93D77FECDD13p-7, -0x1.557EDAFB1F670p-6, -0x1.A6D646284107Fp-6, -0x1.C03ADBB8FFA13p-6, -0x1.049BD4A0BB018p-6,
+		  -0x1.66248433695D2p-9, -0x1.1BAAAFBD593B8p-9, -0x1.416DB23ABF677p-10, -0x1.D6D55A6A43138p-12, -0x1.A0F71F3B190FAp-14, -0x1.A81144088FE82p-17, -0x1.D4CE4C159F4ADp-21, -0x1.07FFF7E681A74p-25, -0x1.20D7B46181A8Ap-31, -0x1.71B25D0EBC2A8p-38 },
+		{ 0x1.878770514614Dp-18, 0x1.B27190D1E2A48p-15, 0x1.24BB51AB628F0p-13, 0x1.10117DE7DEC2Ap-12, 0x1.9B214E4ED15B8p-12, 0x1.05E9FE693B3F1p-11, 0x1.08A20D64136F9p-11, 0x1.FC6D9A095476Dp-13, -0x1.4433C05AE3C13p-11, -0x1.CB2CFA1A9F4C5p-10,
+		  0x1.79C9440AAA3FEp-14, 0x1.F904888AEF2DDp-14, 0x1.BAA70AB414512p-14, 0x1.B7200AD21715Bp-15, 0x1.EE77441863ABFp-17, 0x1.3AC6759F32649p-19, 0x1.BA1F4F2DCFFFBp-23, 0x1.498E54CE23317p-27, 0x1.00CBCEA8F109Cp-32, 0x1.016C98B05E247p-38 },
+		{ -0x1.F9EB9CFE6A532p-23, -0x1.11C706B01944Ap-19, -0x1.5C95A1A4F4AC8p-18, -0x1.22B00830D100Cp-17, -0x1.612B960CF5CE5p-17, -0x1.F13BACAFDC349p-18, 0x1.A5824329531A6p-18, 0x1.3903C3CE99EE7p-15, 0x1.225AE30FA470Cp-14, -0x1.9C08039C71C82p-14,
+		  -0x1.B4D30115760FAp-19, -0x1.C725DC9E19C82p-18, -0x1.0545153A6F0D3p-17, -0x1.43D9BFA30560Cp-18, -0x1.C699301D97D0Ap-20, -0x1.6BC6F51BE0993p-22, -0x1.461B1FCE94540p-25, -0x1.3F0674C003EFBp-29, -0x1.5702A0026F6FDp-34, -0x1.F8A884E3A9062p-40 },
+		{ 0x1.2D1DC5DF11B9Ap-27, 0x1.3831D1FFE60CDp-24, 0x1.654E0DC0FBB33p-23, 0x1.D023B6796D5DEp-23, 0x1.AED75EF0E6777p-24, -0x1.735E4CAA1AA22p-22, -0x1.4879607221AABp-20, -0x1.F992C18419F33p-20, 0x1.3CE8A9B8C4489p-19, 0x1.1904DEB1C0355p-18,
+		  0x1.F426916CFBF77p-24, 0x1.88EBB8825A3BCp-22, 0x1.20774DB9B6D95p-21, 0x1.BCE5C57D13029p-22, 0x1.80C4EB9961C6Ap-23, 0x1.7AE03FEFF28A6p-25, 0x1.A607E970462F7p-28, 0x1.06E88F4A61D51p-31, 0x1.7860A74F095E7p-36, 0x1.82516671A83F9p-41 },
+		{ -0x1.C84AB22D7EEEFp-33, -0x1.932A39BF28889p-30, -0x1.FA2C948A22222p-30, 0x1.8C89C122FBBBCp-29, 0x1.389B949611111p-26, 0x1.90539BAB84CCDp-25, 0x1.2C74AE850EEEFp-24, -0x1.69F5C4E977777p-27, -0x1.5C52D77885555p-22, 0x1.90F0C57667AABp-20,
+		  -0x1.4EC87CE78CCCDp-29, -0x1.46DD825294889p-26, -0x1.35D4A4D53B222p-25, -0x1.22B21310495DEp-25, -0x1.2E8D9FD1F49DEp-26, -0x1.678AFE1093080p-28, -0x1.E953611073540p-31, -0x1.7D3DFE0962997p-34, -0x1.627C104D79509p-38, -0x1.E854A9220A7CAp-43 },
+		{ 0x1.CFF36D08E6666p-36, 0x1.E0E6A29D77777p-33, 0x1.187BE50A00000p-31, 0x1.A0536127EEEEFp-31, 0x1.FA33AE7E66666p-31, 0x1.AAC41A7577777p-30, 0x1.5CAF7ADBDDDDEp-28, 0x1.174DF67DF1111p-26, 0x1.17C6FE21EEEEFp-28, 0x1.13204ABC48000p-23,
+		  0x1.0D3B37D2CCCCDp-31, 0x1.0025A0A38CCCDp-30, 0x1.145D408DC2222p-29, 0x1.4CE527F0CBBBCp-29, 0x1.AEEABD5E54666p-30, 0x1.381A1A8278777p-31, 0x1.02877D464CC33p-33, 0x1.F1C3A970AD266p-37, 0x1.26A23589BD71Ap-40, 0x1.07D2345125B4Bp-44 },
+		{ 0x1.08A9B6E666666p-41, 0x1.7E28422222222p-38, 0x1.73D8FA4444444p-36, 0x1.E7E42C3BBBBBCp-35, 0x1.D7CF5B7BBBBBCp-34, 0x1.377384E666666p-33, 0x1.618DA73BBBBBCp-34, 0x1.17A73CD99999Ap-32, 0x1.018E7E6F77777p-28, -0x1.4567CD6444444p-29,
+		  0x1.2CDF5BF777777p-36, -0x1.A7BCDAC444444p-35, -0x1.3E448B5800000p-33, -0x1.A15820D622222p-33, -0x1.313ECA7511111p-33, -0x1.01C9F75E38000p-34, -0x1.FC6BA516DBBBCp-37, -0x1.299BEC83CFD55p-39, -0x1.B86F98DA570EFp-43, -0x1.F3015F7EBC955p-47 },
+		{ -0x1.9DD3A60000000p-44, -0x1.F5FF888888889p-41, -0x1.87F9204444444p-39, -0x1.AC4997DDDDDDEp-38, -0x1.7170911111111p-37, -0x1.FEB5662222222p-37, -0x1.695E577777777p-36, -0x1.473CDCA222222p-34, -0x1.B1232A0000000p-35, -0x1.F5A16C8BBBBBCp-30,
+		  -0x1.28715AAAAAAABp-40, 0x1.58E02CAAAAAABp-39, 0x1.2EEF65C444444p-37, 0x1.D181344666666p-37, 0x1.90DB0E7488889p-37, 0x1.8F297ADEEEEEFp-38, 0x1.D33220F535555p-40, 0x1.495FCDC46EEEFp-42, 0x1.2C0806D84E444p-45, 0x1.A43A3C2606622p-49 },
+		{ -0x1.152C9CCCCCCCDp-45, -0x1.39EBA55555555p-42, -0x1.BD27988888889p-41, -0x1.C820977777777p-40, -0x1.9A5DDEEEEEEEFp-39, -0x1.5B3AADDDDDDDEp-38, -0x1.0E84AA2222222p-37, -0x1.82F143BBBBBBCp-37, -0x1.A4B8B7BBBBBBCp-35, -0x1.A8E28AAAAAAABp-33,
+		  -0x1.ADB2DBBBBBBBCp-41, -0x1.2325D33333333p-42, -0x1.2721833333333p-42, -0x1.9F17426666666p-41, -0x1.E385B61DDDDDEp-41, -0x1.23A71F1C44444p-41, -0x1.9489C07B88889p-43, -0x1.545B72FCB5555p-45, -0x1.785F273597BBCp-48, -0x1.3F488E1137EEFp-51 },
+		{ -0x1.7D2F7DDDDDDDEp-47, -0x1.AC00F77777777p-44, -0x1.2C65C00000000p-42, -0x1.2CA4711111111p-41, -0x1.F8EC5DDDDDDDEp-41, -0x1.8769D9999999Ap-40, -0x1.2331DDDDDDDDEp-39, -0x1.9C5FD77777777p-39, -0x1.40ACF9999999Ap-38, -0x1.1FA3244444444p-38,
+		  -0x1.C02F911111111p-42, -0x1.F5F2EAAAAAAABp-43, -0x1.C0CAAAAAAAAABp-45, 0x1.7DCDEEEEEEEEFp-45, 0x1.285ADA6666666p-44, 0x1.9C1C773333333p-45, 0x1.4CC937899999Ap-46, 0x1.4A9AD1C911111p-48, 0x1.B624F451C4444p-51, 0x1.BA39D7294A222p-54 },
+		{ 0x1.6EA7555555555p-48, 0x1.9E23111111111p-45, 0x1.22FC777777777p-43, 0x1.1F79777777777p-42, 0x1.E192888888889p-42, 0x1.6EBB555555555p-41, 0x1.063E333333333p-40, 0x1.630299999999Ap-40, 0x1.08AB888888889p-39, 0x1.2E9B777777777p-38,
+		  0x1.BF6E000000000p-43, 0x1.1944BBBBBBBBCp-43, 0x1.BC83111111111p-45, 0x1.4FFAEEEEEEEEFp-47, -0x1.A79BCCCCCCCCDp-49, -0x1.09DE166666666p-48, -0x1.036E721111111p-49, -0x1.2F21345BBBBBCp-51, -0x1.DBD1AAEA66666p-54, -0x1.18FA49EF5DDDEp-56 },
+		{ 0x1.06D099999999Ap-47, 0x1.259E666666666p-44, 0x1.9A09DDDDDDDDEp-43, 0x1.9764AAAAAAAABp-42, 0x1.52D5333333333p-41, 0x1.0213BBBBBBBBCp-40, 0x1.6E1BBBBBBBBBCp-40, 0x1.F2E2888888889p-40, 0x1.4894222222222p-39, 0x1.BB62888888889p-39,
+		  0x1.404CEEEEEEEEFp-42, 0x1.955DBBBBBBBBCp-43, 0x1.47ADBBBBBBBBCp-44, 0x1.4EF5BBBBBBBBCp-46, 0x1.CE2B333333333p-49, 0x1.4CD1444444444p-51, 0x1.A558AEEEEEEEFp-53, 0x1.09E5166666666p-54, 0x1.E5F4E8999999Ap-57, 0x1.4B35CD86AAAABp-59 },
+		{ -0x1.6E48888888889p-50, -0x1.9DFDDDDDDDDDEp-47, -0x1.2305555555555p-45, -0x1.1F40000000000p-44, -0x1.E086666666666p-44, -0x1.6D15555555555p-43, -0x1.03DEEEEEEEEEFp-42, -0x1.6056666666666p-42, -0x1.CF5BBBBBBBBBCp-42, -0x1.1CD7777777777p-41,
+		  -0x1.C731111111111p-45, -0x1.1F8BBBBBBBBBCp-45, -0x1.D7D3333333333p-47, -0x1.E626666666666p-49, -0x1.3952222222222p-51, -0x1.4E5EEEEEEEEEFp-54, -0x1.4C62888888889p-56, -0x1.CB08622222222p-58, -0x1.EA3D88CCCCCCDp-60, -0x1.8175EDEAAAAABp-62 },
+		{ -0x1.402199999999Ap-49, -0x1.6568888888889p-46, -0x1.F33999999999Ap-45, -0x1.EF96666666666p-44, -0x1.9C4EEEEEEEEEFp-43, -0x1.39E999999999Ap-42, -0x1.BCCCCCCCCCCCDp-42, -0x1.2E95DDDDDDDDEp-41, -0x1.8D67777777777p-41, -0x1.EE4DDDDDDDDDEp-41,
+		  -0x1.866CCCCCCCCCDp-44, -0x1.EED4444444444p-45, -0x1.9126666666666p-46, -0x1.97EEEEEEEEEEFp-48, -0x1.FA2CCCCCCCCCDp-51, -0x1.6D11111111111p-54, -0x1.908EEEEEEEEEFp-59, 0x1.242DDDDDDDDDEp-61, 0x1.B8AA3BBBBBBBCp-63, 0x1.88C47B7777777p-65 }
+	},
+	{
+		{ 0x1.00629D6DE390Bp-9, 0x1.217A161C015AEp-6, 0x1.950481403C347p-5, 0x1.91740939C9217p-4, 0x1.511BA6F8A100Cp-3, 0x1.0122804A0F542p-2, 0x1.710E9A23ED71Bp-2, 0x1.FCE20CAB0B17Ep-2, 0x1.55CD19BAC348Ep-1, 0x1.C12A53B64C61Ep-1,
+		  0x1.55D0A3987AD2Ep-4, 0x1.AD032CBBC6098p-5, 0x1.4E7E27117192Cp-6, 0x1.3D1E9614B186Bp-8, 0x1.60C380D296D33p-11, 0x1.B3C6CA0733B29p-15, 0x1.12D8D3CA9C896p-19, 0x1.36D4FD7CBC38Bp-25, 0x1.01041655AF192p-32, 0x1.ED55B9306E85Dp-42 },
+		{ -0x1.CFEB2C02B3378p-14, -0x1.05439115A3A2Ep-10, -0x1.6BAC6424CF44Fp-9, -0x1.656D95F064E9Cp-8, -0x1.283C4E467D8D7p-7, -0x1.BAE79228DC0F0p-7, -0x1.33B727FF6A80Dp-6, -0x1.908FF08DAB0C1p-6, -0x1.DA4B5E497DF9Ap-6, -0x1.8637130CE0B3Dp-6,
+		  -0x1.3B9001FA5B0D8p-9, -0x1.CBB39CF75B333p-10, -0x1.CED8209AEA6A9p-11, -0x1.2C8470800A9A4p-12, -0x1.D7930A2924550p-15, -0x1.A2E970884154Fp-18, -0x1.8537B434DD17Dp-22, -0x1.52961EE4A1485p-27, -0x1.D6CB8946EBBC7p-34, -0x1.CF09285FC45AAp-42 },
+		{ 0x1.36188E8FA832Fp-18, 0x1.59DFD88FA569Ep-15, 0x1.D769BB569A08Dp-14, 0x1.BEE9B1C805559p-13, 0x1.5D3C5B3917B5Fp-12, 0x1.D8DBB5A84962Bp-12, 0x1.108EA5E22475Cp-11, 0x1.BCC54C2DF9515p-12, -0x1.62A65A7AA6170p-13, -0x1.12B8B52F13A3Cp-9,
+		  0x1.334EA371D2C5Cp-14, 0x1.6D9B91CD4142Ap-14, 0x1.225D02FAC2BADp-14, 0x1.04ED85B9EFFFDp-15, 0x1.0499FB2879D73p-17, 0x1.1BE43FEE44266p-20, 0x1.42946AA798AB5p-24, 0x1.618A25CA48287p-29, 0x1.4E660439C07C2p-35, 0x1.095D9E6ED3246p-42 },
+		{ -0x1.6C3CCB6432A18p-23, -0x1.8DCB77E889852p-20, -0x1.0286BC5E8B74Ep-18, -0x1.C0A79311B3427p-18, -0x1.27FC833066314p-17, -0x1.0DA277287F6CFp-17, 0x1.28E085EC98222p-24, 0x1.98F5FCA319FD3p-16, 0x1.453C46162D1BBp-14, 0x1.4FB58EEE7F166p-17,
+		  -0x1.39C791380200Dp-19, -0x1.2D4FA51091002p-18, -0x1.39BF1D3E4AEC4p-18, -0x1.57F69F31FB8B5p-19, -0x1.9FF4F6CA1197Dp-21, -0x1.15933B3E7EA5Dp-23, -0x1.8AA7E03DCEDD8p-27, -0x1.17D1E87A2ABEEp-31, -0x1.6BC2AAC9A35B5p-37, -0x1.BEB1D12F4F113p-44 },
+		{ 0x1.19559C9429C00p-27, 0x1.2F6ED815E4577p-24, 0x1.7F49C8F9E3C00p-23, 0x1.3AC13CED64EEFp-22, 0x1.724E1A44D4E22p-22, 0x1.D3E34ACCC299Ap-23, -0x1.0D1F070C60889p-22, -0x1.1F4F285A3A7BCp-20, 0x1.5D7B553A17DDEp-23, 0x1.89946715666ABp-16,
+		  0x1.072251D523F77p-23, 0x1.D9658A2A59F33p-23, 0x1.1DA704A5E2FBCp-22, 0x1.8428D0466F484p-23, 0x1.256DC01FA326Ap-24, 0x1.E790CB4B5F9EBp-27, 0x1.B0284C36AC319p-30, 0x1.84D97DA2E440Ep-34, 0x1.505E1F86F80FDp-39, 0x1.2EB271FC9F6B2p-45 },
+		{ 0x1.CCC70A8500000p-35, 0x1.891A1D0B13333p-31, 0x1.D126FB896AAABp-29, 0x1.7860C6D73EEEFp-27, 0x1.E3F004E277777p-26, 0x1.075C26A4FC889p-24, 0x1.E6822D7340000p-24, 0x1.42A9C42EA8000p-23, -0x1.4EE8EC805BBBCp-24, 0x1.CDF9695DE9777p-20,
+		  0x1.B0AE4D660CCCDp-29, -0x1.78B7B4F9A5555p-27, -0x1.5E02AA7BB2889p-26, -0x1.0FD78C06962ABp-26, -0x1.C87AE2F7EFB77p-28, -0x1.ADD943EC9C2BCp-30, -0x1.BE0FB2B8BB009p-33, -0x1.E95A56AF718F3p-37, -0x1.115C1F2B8613Bp-41, -0x1.5A078688EB813p-47 },
+		{ 0x1.5B0505AE66666p-38, 0x1.27520E0DDDDDEp-35, 0x1.284CEE099999Ap-35, -0x1.C52070599999Ap-34, -0x1.12210CC3DDDDEp-31, -0x1.32E9581DBBBBCp-30, -0x1.1EE2C99A66666p-30, 0x1.1E9BD15D11111p-28, 0x1.5B3F0C3C40000p-26, -0x1.98404B54C2222p-23,
+		  0x1.B6C3E903BBBBCp-33, 0x1.0A4D704377777p-31, 0x1.FA12D40CFBBBCp-31, 0x1.FEC96C4391111p-31, 0x1.12724EB5DAEEFp-31, 0x1.415D064130889p-33, 0x1.99707E3059E66p-36, 0x1.1605421B3B36Fp-39, 0x1.8E23EBA25DB7Ep-44, 0x1.579BDF0EFED2Cp-49 },
+		{ -0x1.3CBBBBFAAAAABp-38, -0x1.65F1DE5DDDDDEp-35, -0x1.F76CBC8444444p-34, -0x1.FBFFF4D777777p-33, -0x1.BF9CAAB555555p-32, -0x1.7D7AD88333333p-31, -0x1.554124399999Ap-30, -0x1.4A04596111111p-29, -0x1.B12EC46EEEEEFp-29, -0x1.62EF6F4EAAAABp-25,
+		  -0x1.727048A222222p-34, -0x1.2A1521C444444p-36, -0x1.4967F8EAAAAABp-37, -0x1.513E120733333p-35, -0x1.26ACA8C388889p-35, -0x1.C330C775AEEEFp-37, -0x1.61154B7BFCCCDp-39, -0x1.25357DBA75BBCp-42, -0x1.088F10A33F755p-46, -0x1.2E74CCFFFA02Fp-51 },
+		{ -0x1.C6714E2222222p-42, -0x1.06310BAAAAAABp-38, -0x1.7F0FBEEEEEEEFp-37, -0x1.9407395555555p-36, -0x1.6EBC3BB333333p-35, -0x1.32A343E666666p-34, -0x1.F0ABC88888889p-34, -0x1.C386833333333p-33, -0x1.55B40F7555555p-31, -0x1.6BD0EDCCCCCCDp-31,
+		  -0x1.55AF542222222p-37, 0x1.F68F780000000p-40, 0x1.29E3E68CCCCCDp-37, 0x1.F274035DDDDDEp-38, 0x1.00395366EEEEFp-38, 0x1.5FAD477911111p-40, 0x1.29CEF60FEEEEFp-42, 0x1.229BCC19C8000p-45, 0x1.44550C8DA5444p-49, 0x1.DEF7820F9CA00p-54 },
+		{ 0x1.C3FBF55555555p-47, 0x1.04EF755555555p-43, 0x1.7FF7A66666666p-42, 0x1.95EEFDDDDDDDEp-41, 0x1.6FE6711111111p-40, 0x1.31ABD77777777p-39, 0x1.0034B55555555p-38, 0x1.1C79677777777p-37, 0x1.3D1AD22222222p-36, 0x1.3A6920BBBBBBCp-31,
+		  -0x1.48E3666666666p-43, -0x1.0721666666666p-42, -0x1.4DB0AAAAAAAABp-42, -0x1.507729DDDDDDEp-42, -0x1.E9E237999999Ap-43, -0x1.B88478199999Ap-44, -0x1.C95E3F5222222p-46, -0x1.0D484F8C55555p-48, -0x1.71955F28EEEEFp-52, -0x1.58FF428497000p-56 },
+		{ -0x1.5AE2AAAAAAAABp-51, -0x1.D5AA222222222p-48, -0x1.A90EEEEEEEEEFp-47, -0x1.6BBBBBBBBBBBCp-50, 0x1.D933777777777p-45, 0x1.DA9BDDDDDDDDEp-43, 0x1.58F4666666666p-41, 0x1.C86B222222222p-40, 0x1.D95DF55555555p-38, 0x1.F7148BBBBBBBCp-35,
+		  -0x1.B520333333333p-43, -0x1.ED5919999999Ap-43, -0x1.6578B11111111p-43, -0x1.BCB13BBBBBBBCp-45, 0x1.B30DDDDDDDDDEp-50, 0x1.D5A5408888889p-48, 0x1.4C9D49AAAAAABp-49, 0x1.D906CA66EEEEFp-52, 0x1.8A60DDFCF7777p-55, 0x1.C81E1548ED555p-59 },
+		{ 0x1.5F21EEEEEEEEFp-48, 0x1.8FFB555555555p-45, 0x1.1847111111111p-43, 0x1.185F444444444p-42, 0x1.DA29777777777p-42, 0x1.6F3CEEEEEEEEFp-41, 0x1.0E29777777777p-40, 0x1.85A8EEEEEEEEFp-40, 0x1.18A6000000000p-39, -0x1.C07CCCCCCCCCDp-40,
+		  0x1.BDFF333333333p-43, 0x1.04BD99999999Ap-43, 0x1.5CCF333333333p-45, 0x1.C16E222222222p-48, -0x1.47F2222222222p-52, -0x1.4DB9666666666p-51, -0x1.E5C1CAAAAAAABp-53, -0x1.8C9E524444444p-55, -0x1.8BC51DB99999Ap-58, -0x1.1645545391111p-61 },
+		{ 0x1.BECA222222222p-48, 0x1.0296444444444p-44, 0x1.690B777777777p-43, 0x1.6427777777777p-42, 0x1.2AAD555555555p-41, 0x1.C777777777777p-41, 0x1.453EEEEEEEEEFp-40, 0x1.BD26222222222p-40, 0x1.25D3BBBBBBBBCp-39, 0x1.A97BBBBBBBBBCp-40,
+		  0x1.2B53333333333p-42, 0x1.7242AAAAAAAABp-43, 0x1.2E7ECCCCCCCCDp-44, 0x1.1F6399999999Ap-46, 0x1.5976444444444p-49, 0x1.0497777777777p-52, 0x1.DC05DDDDDDDDEp-56, 0x1.48055CCCCCCCDp-58, 0x1.7879EEDDDDDDEp-61, 0x1.3C6823D3BBBBCp-64 },
+		{ -0x1.479CCCCCCCCCDp-50, -0x1.74E2222222222p-47, -0x1.043DDDDDDDDDEp-45, -0x1.0316666666666p-44, -0x1.B21BBBBBBBBBCp-44, -0x1.4B8CCCCCCCCCDp-43, -0x1.DC2EEEEEEEEEFp-43, -0x1.4913333333333p-42, -0x1.BB7BBBBBBBBBCp-42, -0x1.3208888888889p-41,
+		  -0x1.ACBBBBBBBBBBCp-45, -0x1.0C48888888889p-45, -0x1.A248888888889p-47, -0x1.89CAAAAAAAAABp-49, -0x1.CDD5555555555p-52, -0x1.363DDDDDDDDDEp-55, -0x1.A2D1111111111p-59, -0x1.08E0222222222p-61, -0x1.61E42EEEEEEEFp-64, -0x1.6389E08000000p-67 },
+		{ -0x1.138EEEEEEEEEFp-49, -0x1.3E0EEEEEEEEEFp-46, -0x1.BC51111111111p-45, -0x1.B6A2222222222p-44, -0x1.7003333333333p-43, -0x1.18CBBBBBBBBBCp-42, -0x1.91BBBBBBBBBBCp-42, -0x1.13C2222222222p-41, -0x1.70DAAAAAAAAABp-41, -0x1.D3D1111111111p-41,
+		  -0x1.6E31111111111p-44, -0x1.C486666666666p-45, -0x1.6EEDDDDDDDDDEp-46, -0x1.5A40000000000p-48, -0x1.9440000000000p-51, -0x1.F7EAAAAAAAAABp-55, -0x1.4C3BBBBBBBBBCp-59, -0x1.4895555555555p-67, 0x1.1F62F77777777p-67, 0x1.60180E2222222p-70 }
+	},
+	{
+		{ 0x1.CB4E09E37BEDFp-10, 0x1.03587C622219Bp-6, 0x1.6B0355D646F46p-5, 0x1.681152FF1C39Ep-4, 0x1.2EACE770675B1p-3, 0x1.CE7AD5203AE09p-3, 0x1.4CB8CCE594CFFp-2, 0x1.CCBCB26A4986Ap-2, 0x1.3821262A6D26Fp-1, 0x1.A4BCA3EC78701p-1,
+		  0x1.43397EDBDF3A1p-4, 0x1.92DE8F0E97BE8p-5, 0x1.358C97FFA4BF5p-6, 0x1.1E86753DD1B13p-8, 0x1.3354D73A20CEAp-11, 0x1.67699D61D1000p-15, 0x1.A0672C17ABF23p-20, 0x1.984382CF6DC79p-26, 0x1.FDEFA2862A21Cp-34, 0x1.C30F46C124592p-44 },
+		{ -0x1.89D221A5F8CCCp-14, -0x1.BC2CD3C41B83Ep-11, -0x1.36076944F9728p-9, -0x1.3228A5C8CF34Dp-8, -0x1.FF3FBB2D734FDp-8, -0x1.8296451723CF5p-7, -0x1.11A10B6A496E5p-6, -0x1.7057D32CFBE0Cp-6, -0x1.D61DF97366094p-6, -0x1.FFF0CA8C2F844p-6,
+		  -0x1.1847C8A124B9Ep-9, -0x1.7CC816F6AE283p-10, -0x1.575F80716A180p-11, -0x1.8AC5F1F6C1866p-13, -0x1.1260C744AE6F4p-15, -0x1.AEED521D48C0Ep-19, -0x1.5C6ABF2A10D0Ap-23, -0x1.F808DECA4DEDCp-29, -0x1.0188722D2827Dp-35, -0x1.E57B00D1220DBp-45 },
+		{ 0x1.FE380AE650854p-19, 0x1.1DC9507116A8Bp-15, 0x1.89375C4181C78p-14, 0x1.7AF0240A5A14Dp-13, 0x1.304EB17790075p-12, 0x1.B00EAED192059p-12, 0x1.11B8CAF366ADCp-11, 0x1.236EBDA3DFB40p-11, 0x1.35FF35C9651DEp-12, -0x1.70BECAFD56FD2p-10,
+		  0x1.05C36FEEF75D4p-14, 0x1.0F93F4172392Dp-14, 0x1.8336BE89422ABp-15, 0x1.3EEADA6E7CE32p-16, 0x1.22827CC3D7F8Fp-18, 0x1.1A4A494074497p-21, 0x1.12A6DBEBF50FDp-25, 0x1.DEE97E542D80Dp-31, 0x1.34D89E2E7C164p-37, 0x1.B23CF193864BAp-46 },
+		{ -0x1.BFC222B322071p-24, -0x1.E8AC84C4E1239p-21, -0x1.3CF7CF777B12Ap-19, -0x1.119EA3FEDC929p-18, -0x1.636D2B913AACFp-18, -0x1.2DB97F3B1F5F3p-18, 0x1.AAED551E1DD22p-20, 0x1.5E7E5FB31231Fp-16, 0x1.403300C7662DBp-14, 0x1.C3F00FFA42D95p-13,
+		  -0x1.529D743678BC9p-20, -0x1.9F55147ACDEA6p-19, -0x1.AE7ABC425DB9Ap-19, -0x1.B0B25B43AF8A1p-20, -0x1.CAF9009448A53p-22, -0x1.02F53AEE1A86Bp-24, -0x1.2A16CF93D05A4p-28, -0x1.3F3CB7C38A653p-33, -0x1.0F18C34C47E86p-39, -0x1.25D23CB41C4F4p-47 },
+		{ 0x1.00CE85295AC22p-27, 0x1.1AFB2A212BB11p-24, 0x1.777E966BA3A22p-23, 0x1.534E584B88733p-22, 0x1.E748AFAF50FBCp-22, 0x1.1810FFEC37444p-21, 0x1.A86845F799F77p-22, -0x1.1060174889333p-23, -0x1.9BEEA0085599Ap-21, 0x1.4BBDF327B081Ap-16,
+		  0x1.1FF98ADDC0111p-23, 0x1.25433EDFD9555p-23, 0x1.06719C0D32600p-23, 0x1.3CD48A3F2692Bp-24, 0x1.B903040B23CE2p-26, 0x1.49FD042E0C48Dp-28, 0x1.F4D26DC9E7946p-32, 0x1.621FE439A546Fp-36, 0x1.98B3890011F30p-42, 0x1.4E35B386D6038p-49 },
+		{ -0x1.7D49AABB04444p-32, -0x1.A2B71545FEEEFp-29, -0x1.13FF52EBBC444p-27, -0x1.EED29644F5555p-27, -0x1.628D6C3AE6666p-26, -0x1.A8565E1986666p-26, -0x1.BE183EDB44444p-26, -0x1.625BBA4B7BBBCp-25, -0x1.14B0A6401D99Ap-22, -0x1.86ABD3B19C6EFp-19,
+		  -0x1.28C613168EEEFp-28, -0x1.9FA520DED5555p-28, -0x1.02BF2E34C6666p-27, -0x1.82B3A03D6A444p-28, -0x1.38C0EBFAC9222p-29, -0x1.0B6A01FFD11BCp-31, -0x1.D3FF000DC6DABp-35, -0x1.88EBD84284FB7p-39, -0x1.1D4F51735CA20p-44, -0x1.4B9F8E769A8AFp-51 },
+		{ -0x1.1C6F441684444p-34, -0x1.494CD0565999Ap-31, -0x1.E4786FF233333p-30, -0x1.02F529114AAABp-28, -0x1.E13A83B0D999Ap-28, -0x1.A0A038B3E6666p-27, -0x1.5AFEC37AE2222p-26, -0x1.16D660DF1EEEFp-25, -0x1.953C8C4F60000p-25, -0x1.942B11F024444p-22,
+		  -0x1.85965997D5555p-30, 0x1.874F894800000p-32, 0x1.5EBB469E48889p-30, 0x1.D5E0922971111p-31, 0x1.3D8A079590000p-32, 0x1.EA86A70267333p-35, 0x1.B03842BFD5DDEp-38, 0x1.9513D2D549911p-42, 0x1.69AE045C49889p-47, 0x1.23EB5AA2E72E5p-53 },
+		{ -0x1.41222FC444444p-40, -0x1.660032599999Ap-37, -0x1.E962242AAAAABp-36, -0x1.D83F71EEEEEEFp-35, -0x1.8875678000000p-34, -0x1.3D2D8BB333333p-33, -0x1.1F3DE9AEEEEEFp-32, -0x1.4CFE24399999Ap-31, -0x1.707E22ADDDDDEp-30, 0x1.6244D83B88889p-25,
+		  -0x1.04D955EEEEEEFp-34, -0x1.2A89CBEEEEEEFp-37, 0x1.11321DF333333p-37, -0x1.8866896222222p-38, -0x1.1B3AA64888889p-37, -0x1.A9D06AE233333p-39, -0x1.1BC75EA082222p-41, -0x1.65FE8489ECCCDp-45, -0x1.A15DCD793F555p-50, -0x1.CF75D53C42B9Ap-56 },
+		{ 0x1.30DF98AEEEEEFp-40, 0x1.5D424AFBBBBBCp-37, 0x1.F7C3558000000p-36, 0x1.065ED70AAAAABp-34, 0x1.DB07266222222p-34, 0x1.9540574CCCCCDp-33, 0x1.58AA643BBBBBCp-32, 0x1.365003E333333p-31, 0x1.39F1CB2333333p-30, 0x1.04D65BFCCCCCDp-27,
+		  0x1.6FF0D4F777777p-36, -0x1.BE1B233333333p-41, -0x1.6478ED4CCCCCDp-37, -0x1.57E5AF1555555p-38, -0x1.55D5B34444444p-41, 0x1.16F9FC1333333p-43, 0x1.794B002F77777p-45, 0x1.372A188D08889p-48, 0x1.C6C60E6FB3333p-53, 0x1.500899B8E3044p-58 },
+		{ 0x1.475EDC4444444p-44, 0x1.783BAC8888889p-41, 0x1.1177E7BBBBBBCp-39, 0x1.1FDE6A2222222p-38, 0x1.0757D9DDDDDDEp-37, 0x1.C43CE2AAAAAABp-37, 0x1.7F1DBE2222222p-36, 0x1.54B3493333333p-35, 0x1.766628EEEEEEFp-34, -0x1.22EF776EEEEEFp-31,
+		  0x1.08CE52AAAAAABp-39, -0x1.4BE8888888889p-42, -0x1.6BAECF3333333p-40, -0x1.AF58FEBBBBBBCp-41, -0x1.F541D4999999Ap-43, -0x1.6DC8870888889p-45, -0x1.82CA15B222222p-48, -0x1.17A771E244444p-51, -0x1.D4C546E9AAAABp-56, -0x1.C081290C8A666p-61 },
+		{ -0x1.617D79999999Ap-46, -0x1.94A4D77777777p-43, -0x1.2212ACCCCCCCDp-41, -0x1.2960944444444p-40, -0x1.07EA877777777p-39, -0x1.B44FD9999999Ap-39, -0x1.6384444444444p-38, -0x1.33117E6666666p-37, -0x1.4DDEED5555555p-36, -0x1.5233066666666p-33,
+		  -0x1.2597022222222p-41, -0x1.93925DDDDDDDEp-43, 0x1.434099999999Ap-45, 0x1.950ED9999999Ap-45, 0x1.F0611BBBBBBBCp-47, 0x1.72F67EEEEEEEFp-49, 0x1.CE36104444444p-52, 0x1.A87F99AAAAAABp-55, 0x1.C10B79C111111p-59, 0x1.154481BDE1111p-63 },
+		{ 0x1.1A33777777777p-49, 0x1.434E000000000p-46, 0x1.B4B6222222222p-45, 0x1.948B333333333p-44, 0x1.2F16AAAAAAAABp-43, 0x1.717F777777777p-43, 0x1.2F8199999999Ap-43, -0x1.589EEEEEEEEEFp-44, -0x1.23EFDDDDDDDDEp-40, 0x1.DCB3000000000p-38,
+		  0x1.22C2888888889p-43, 0x1.F66C444444444p-44, 0x1.2B59222222222p-44, 0x1.A9C9E66666666p-46, 0x1.450FC44444444p-48, 0x1.AE2F444444444p-52, -0x1.B216333333333p-58, -0x1.1F067FBBBBBBCp-58, -0x1.98AEDE5555555p-62, -0x1.3F3B166BDDDDEp-66 },
+		{ 0x1.9BEB333333333p-48, 0x1.D4AEEEEEEEEEFp-45, 0x1.4A2B777777777p-43, 0x1.45FE888888889p-42, 0x1.131D99999999Ap-41, 0x1.A458000000000p-41, 0x1.2F06CCCCCCCCDp-40, 0x1.A7E4AAAAAAAABp-40, 0x1.2803DDDDDDDDEp-39, 0x1.815DBBBBBBBBCp-38,
+		  0x1.1AE3555555555p-42, 0x1.5B33777777777p-43, 0x1.0FAB333333333p-44, 0x1.F782666666666p-47, 0x1.1A02000000000p-49, 0x1.66E1111111111p-53, 0x1.3BB1111111111p-57, 0x1.2B70111111111p-61, 0x1.6E748C4444444p-65, 0x1.58F8FEC666666p-69 },
+		{ -0x1.1486666666666p-50, -0x1.3ECBBBBBBBBBCp-47, -0x1.BE31111111111p-46, -0x1.B984444444444p-45, -0x1.7242222222222p-44, -0x1.18A4444444444p-43, -0x1.8E0AAAAAAAAABp-43, -0x1.0D4DDDDDDDDDEp-42, -0x1.548EEEEEEEEEFp-42, -0x1.087BBBBBBBBBCp-41,
+		  -0x1.8AA8888888889p-45, -0x1.F61999999999Ap-46, -0x1.8D68888888889p-47, -0x1.8787777777777p-49, -0x1.C68EEEEEEEEEFp-52, -0x1.1A77777777777p-55, -0x1.A414444444444p-60, -0x1.0782666666666p-64, -0x1.3E04DDDDDDDDEp-68, -0x1.70D83E4444444p-72 },
+		{ -0x1.F07999999999Ap-50, -0x1.1A2BBBBBBBBBCp-46, -0x1.8D42222222222p-45, -0x1.881CCCCCCCCCDp-44, -0x1.4A5CCCCCCCCCDp-43, -0x1.F7E2222222222p-43, -0x1.69EAAAAAAAAABp-42, -0x1.F596666666666p-42, -0x1.51C999999999Ap-41, -0x1.DDB3333333333p-41,
+		  -0x1.586BBBBBBBBBCp-44, -0x1.A924444444444p-45, -0x1.4D42222222222p-46, -0x1.3553333333333p-48, -0x1.5493333333333p-51, -0x1.92EEEEEEEEEEFp-55, -0x1.F240000000000p-60, -0x1.B955555555555p-66, 0x1.3613333333333p-72, 0x1.5D9D766666666p-75 }
+	},
+	{
+		{ 0x1.9DDF40D816D05p-10, 0x1.D36D254286F9Fp-7, 0x1.47325230D9FF2p-5, 0x1.44A47E196F7ABp-4, 0x1.11068E91999DAp-3, 0x1.A178E0ABABE98p-3, 0x1.2CAC9063A9BDEp-2, 0x1.A122FE5A514AFp-2, 0x1.1BA741D528EE2p-1, 0x1.82D9108ED0DB5p-1,
+		  0x1.32B232EFEE70Ap-4, 0x1.7D018385BF783p-5, 0x1.22B8F5064B85Fp-6, 0x1.0A0F11741319Fp-8, 0x1.188182C7D50BEp-11, 0x1.3FAF311E1FA73p-15, 0x1.63E79BDBEFB9Ap-20, 0x1.467D1AEA8884Bp-26, 0x1.65DDC76B6007Cp-34, 0x1.B03D27137ADCBp-45 },
+		{ -0x1.4E73F931E31D1p-14, -0x1.7988D1EAC6378p-11, -0x1.07FBEA73C482Bp-9, -0x1.05749834F6828p-8, -0x1.B6939B77364C4p-8, -0x1.4DEFEA7ED3A66p-7, -0x1.DDF9B5ED24A21p-7, -0x1.48060779875EEp-6, -0x1.B49C4BA44B1E3p-6, -0x1.15FEC9DD62EA1p-5,
+		  -0x1.F22028958D372p-10, -0x1.41960D8AC198Ep-10, -0x1.08E3DC99E58DBp-11, -0x1.0F8C38B6272DAp-13, -0x1.4CB93E5BF8888p-16, -0x1.CA2A61658B990p-20, -0x1.428A62941EBAEp-24, -0x1.8E602D8028A38p-30, -0x1.472E5123745FCp-37, -0x1.82C1ED881FA60p-47 },
+		{ 0x1.BCB6753DF3D89p-19, 0x1.F42F1F1980E2Bp-16, 0x1.5B126290C2376p-14, 0x1.5364F98E55D08p-13, 0x1.1712318C1F944p-12, 0x1.9C0CCADF95F8Dp-12, 0x1.184B88A9ED1A3p-11, 0x1.5E190DA1E021Bp-11, 0x1.716EA01E07996p-11, 0x1.3B594DE437301p-14,
+		  0x1.E1500D25D6D0Dp-15, 0x1.9B7DF6A1E2D19p-15, 0x1.EF865FB69270Cp-16, 0x1.6BFEA66A683D2p-17, 0x1.2F60353E33C8Dp-19, 0x1.0E5FA3480C29Bp-22, 0x1.DA9AFA60BF284p-27, 0x1.65D5C7827FB30p-32, 0x1.68DF80D51A58Bp-39, 0x1.1DA32E6C2E0FFp-48 },
+		{ -0x1.20B3A2958687Dp-24, -0x1.3B4D0CE63433Dp-21, -0x1.99AA401A3EBEBp-20, -0x1.62ABD6C3DE6BEp-19, -0x1.CF50E8306ABE9p-19, -0x1.8F2B83B7D10F7p-19, 0x1.F9DB111BA6F77p-21, 0x1.CE504EE5507C0p-17, 0x1.C329F39E2891Ap-15, 0x1.E06AA0D5F14B2p-13,
+		  -0x1.36131AC75EC11p-21, -0x1.2671ADD671C23p-19, -0x1.3AAFD7E175810p-19, -0x1.2DE0DFC1F932Cp-20, -0x1.2579A28092509p-22, -0x1.2479600142E06p-25, -0x1.1C657C77D070Dp-29, -0x1.E1F5E6C911188p-35, -0x1.1E64054E541BDp-41, -0x1.344CC4F499009p-50 },
+		{ 0x1.2F21B74732EEFp-30, 0x1.249EF207D2444p-27, 0x1.06A962220E000p-26, 0x1.4426D5E6F2222p-29, -0x1.251A6AFA51777p-24, -0x1.24B219851AB33p-22, -0x1.A062843D5C889p-21, -0x1.0AF8EC2C3A0ABp-19, -0x1.5DADB76E35544p-18, -0x1.03F57B5A01037p-16,
+		  0x1.2033B3926AAABp-26, 0x1.92C976EFB7E66p-24, 0x1.DF8B28251F155p-24, 0x1.01DAF3ED0AA77p-24, 0x1.1FCCE459361E2p-26, 0x1.521A157B5400Bp-29, 0x1.8EEB8FB4B47D3p-33, 0x1.A94EA2226F49Ap-38, 0x1.50B392C45A83Bp-44, 0x1.12F9DC9FF3D77p-52 },
+		{ -0x1.8A02A2885FBBCp-31, -0x1.BDD39B5391555p-28, -0x1.395B72675DDDEp-26, -0x1.3929DC1C93333p-25, -0x1.0AA2999652222p-24, -0x1.A0C35A382C000p-24, -0x1.3995760B5E222p-23, -0x1.E2F76B3C14889p-23, -0x1.C8B9354796666p-22, -0x1.48FCC79EBF3BCp-19,
+		  -0x1.0878F62650000p-26, -0x1.9A2EA01D95555p-29, 0x1.8B6F9C2E01111p-29, 0x1.61B2DEBC17777p-30, 0x1.8325DE1E77777p-38, -0x1.2AAA6B0CE599Ap-34, -0x1.799493C94B844p-37, -0x1.4093DC17972DEp-41, -0x1.703E43F0E6895p-47, -0x1.C36272D66A2E4p-55 },
+		{ 0x1.29ABAA7555555p-35, 0x1.526E87E637777p-32, 0x1.E0E0C1EA33333p-31, 0x1.EA0E5D129999Ap-30, 0x1.AFC0A1C684444p-29, 0x1.66957AAF95555p-28, 0x1.2DF813313BBBCp-27, 0x1.2081B75155555p-26, 0x1.92B6082098889p-25, 0x1.AB1C3EC35F777p-22,
+		  0x1.816E8A2ACCCCDp-32, 0x1.12E6270244444p-33, 0x1.1177F5A688889p-34, 0x1.7C7BFC982EEEFp-34, 0x1.BD8719EABCCCDp-35, 0x1.C1C90DF4B9111p-37, 0x1.9FCBE7FA9CAABp-40, 0x1.53563A94F199Ap-44, 0x1.AF842B7557289p-50, 0x1.59A43635BF357p-57 },
+		{ 0x1.7111F6DB33333p-37, 0x1.A79896ABBBBBCp-34, 0x1.327DD856AAAABp-32, 0x1.4053ECA19999Ap-31, 0x1.2228F6CD11111p-30, 0x1.EB5A5DDA22222p-30, 0x1.96BD2DF888889p-29, 0x1.55D03C28CCCCDp-28, 0x1.2F5F7102EEEEFp-27, 0x1.69647AAB77777p-26,
+		  0x1.04D2F00000000p-32, -0x1.50D64B4444444p-36, -0x1.3721C776AAAABp-33, -0x1.71CC6A3FBBBBCp-34, -0x1.8B36D46111111p-36, -0x1.B98DC0173BBBCp-39, -0x1.0D9B9CC835555p-42, -0x1.65764C7DF3333p-47, -0x1.D0C47FD86599Ap-53, -0x1.E17CA6C0DD2ABp-60 },
+		{ -0x1.2FCB54E666666p-41, -0x1.5E6D510444444p-38, -0x1.0009D6999999Ap-36, -0x1.0FF9A8CCCCCCDp-35, -0x1.F956079DDDDDEp-35, -0x1.BCFFA4D99999Ap-34, -0x1.8923D4EEEEEEFp-33, -0x1.7614658444444p-32, -0x1.CA5CAEF888889p-31, -0x1.171267699999Ap-27,
+		  -0x1.7755CD7777777p-38, 0x1.00A127BBBBBBCp-40, 0x1.007252C444444p-38, 0x1.27ABC3A000000p-39, 0x1.4E204A1666666p-41, 0x1.CAF3A4FAAAAABp-44, 0x1.982BBB2A66666p-47, 0x1.A45C7E90AAAABp-51, 0x1.966C614724444p-56, 0x1.32C935465BCCDp-62 },
+		{ -0x1.9B9F2D7777777p-43, -0x1.D814813333333p-40, -0x1.5517EE2222222p-38, -0x1.6404F8EEEEEEFp-37, -0x1.427F7A7777777p-36, -0x1.121681BBBBBBCp-35, -0x1.CB9B72AAAAAABp-35, -0x1.8FBB597777777p-34, -0x1.8060BDB333333p-33, 0x1.0733F9999999Ap-37,
+		  -0x1.2C19FE6666666p-38, 0x1.ED5E111111111p-45, 0x1.29D7505555555p-39, 0x1.5669520888889p-40, 0x1.43E5C7D99999Ap-42, 0x1.0DA08D8CCCCCDp-45, 0x1.1D38AE599999Ap-50, -0x1.1ECEEAD555555p-55, -0x1.556B2DDBBBBBCp-59, -0x1.70B1F9E4E0000p-65 },
+		{ 0x1.B09E99999999Ap-49, 0x1.1B4CAEEEEEEEFp-45, 0x1.B839CCCCCCCCDp-44, 0x1.0247F77777777p-42, 0x1.1661600000000p-41, 0x1.1F18288888889p-40, 0x1.312AA66666666p-39, 0x1.6806711111111p-38, 0x1.14AC615555555p-36, 0x1.3CB5971111111p-33,
+		  -0x1.C0314CCCCCCCDp-43, -0x1.CC8AD11111111p-43, -0x1.1EC8644444444p-43, -0x1.829CF22222222p-45, -0x1.CAA8166666666p-48, -0x1.EBAFA22222222p-54, 0x1.3B507D999999Ap-54, 0x1.074F3D4444444p-57, 0x1.583A5E4BBBBBCp-62, 0x1.A556602191111p-68 },
+		{ 0x1.D567444444444p-48, 0x1.0B7919999999Ap-44, 0x1.7C39333333333p-43, 0x1.8343000000000p-42, 0x1.5373A22222222p-41, 0x1.1409CCCCCCCCDp-40, 0x1.B3F4444444444p-40, 0x1.5EBB444444444p-39, 0x1.33F8EAAAAAAABp-38, -0x1.5D40555555555p-38,
+		  0x1.06AF555555555p-42, 0x1.BE6CEEEEEEEEFp-44, 0x1.8A2DDDDDDDDDEp-49, -0x1.B521AAAAAAAABp-47, -0x1.23B7733333333p-48, -0x1.3A1FD9999999Ap-51, -0x1.3F05177777777p-55, -0x1.6327D11111111p-60, -0x1.396287BBBBBBCp-65, -0x1.C06E0BDBBBBBCp-71 },
+		{ 0x1.6E77333333333p-48, 0x1.8D48EEEEEEEEFp-45, 0x1.17F0888888889p-43, 0x1.172799999999Ap-42, 0x1.CFBCAAAAAAAABp-42, 0x1.60C5BBBBBBBBCp-41, 0x1.F4D0888888889p-41, 0x1.4DA2AAAAAAAABp-40, 0x1.8DC6000000000p-40, 0x1.4DEEEEEEEEEEFp-46,
+		  0x1.07CF555555555p-42, 0x1.5320EEEEEEEEFp-43, 0x1.FC11555555555p-45, 0x1.E33E444444444p-47, 0x1.0943AAAAAAAABp-49, 0x1.2715111111111p-53, 0x1.3862888888889p-58, 0x1.9136AAAAAAAABp-64, 0x1.A31D2EEEEEEEFp-69, 0x1.BDA3D5CCCCCCDp-74 },
+		{ -0x1.140DDDDDDDDDEp-50, -0x1.38D6666666666p-47, -0x1.B59999999999Ap-46, -0x1.B2D3333333333p-45, -0x1.6FD8888888889p-44, -0x1.1C04444444444p-43, -0x1.9DD999999999Ap-43, -0x1.252EEEEEEEEEFp-42, -0x1.A1DAAAAAAAAABp-42, -0x1.01C4444444444p-42,
+		  -0x1.8873333333333p-45, -0x1.D675555555555p-46, -0x1.5623333333333p-47, -0x1.1D27777777777p-49, -0x1.0147777777777p-52, -0x1.BE6AAAAAAAAABp-57, -0x1.2BA6666666666p-62, -0x1.0080000000000p-68, -0x1.2D4D555555555p-72, -0x1.BDBD533333333p-77 },
+		{ -0x1.CD31111111111p-50, -0x1.F5F6666666666p-47, -0x1.61E0000000000p-45, -0x1.61A4444444444p-44, -0x1.2750888888889p-43, -0x1.C496666666666p-43, -0x1.460AAAAAAAAABp-42, -0x1.C1E8888888889p-42, -0x1.2FBB333333333p-41, -0x1.8EB1111111111p-41,
+		  -0x1.44A1111111111p-44, -0x1.9D05555555555p-45, -0x1.310BBBBBBBBBCp-46, -0x1.1D25DDDDDDDDEp-48, -0x1.35DA222222222p-51, -0x1.5D52222222222p-55, -0x1.7D92222222222p-60, -0x1.69A8888888889p-66, -0x1.06ABBBBBBBBBCp-74, 0x1.86D7D55555555p-80 }
+	},
+	{
+		{ 0x1.7765F5D9F736Ep-10, 0x1.A7FCA6F1FA319p-7, 0x1.28CED71959828p-5, 0x1.26858AA1134EBp-4, 0x1.EF771745FB610p-4, 0x1.7AE2DFBD50B35p-3, 0x1.10FB463C809AFp-2, 0x1.7AF18457D38CEp-2, 0x1.01FB1C0B4D527p-1, 0x1.61098081A2BF0p-1,
+		  0x1.240CD2821FB33p-4, 0x1.6A61C7DC64D07p-5, 0x1.13D3658ED0BA2p-6, 0x1.F6D02F27CAEF6p-9, 0x1.07720C22B1A9Dp-11, 0x1.29876C67F42D6p-15, 0x1.46AE0DE25236Bp-20, 0x1.24F02932E8623p-26, 0x1.336E91110C44Ep-34, 0x1.48D97D75A0887p-45 },
+		{ -0x1.1A4BE0A127D21p-14, -0x1.3EC94AC8C2F9Cp-11, -0x1.BE2F4548413A9p-10, -0x1.BA84BB8FD2D48p-9, -0x1.73ED7DDAB6009p-8, -0x1.1C1635E46DB86p-7, -0x1.98A336D5DA533p-7, -0x1.1ACF1F65A5918p-6, -0x1.7EF3FEB2ED525p-6, -0x1.020A4DC2C88CAp-5,
+		  -0x1.B7EB29BEE32DFp-10, -0x1.14527CFDD5518p-10, -0x1.AF75652CA4AE1p-12, -0x1.99478DBA3F72Ep-14, -0x1.C617ECBEBBB4Dp-17, -0x1.1578632498BC7p-20, -0x1.53A6144D3EF5Ep-25, -0x1.6360458E0CD43p-31, -0x1.D8711E432E413p-39, -0x1.8998AE8654865p-49 },
+		{ 0x1.8441D39E99B46p-19, 0x1.B5DCC226B8AA1p-16, 0x1.3191B6E868EA1p-14, 0x1.2DAC66F269DB9p-13, 0x1.F792D1BAD16F8p-13, 0x1.7C9B7C41575BDp-12, 0x1.0D42EFC12A54Dp-11, 0x1.6A5D51EC077CDp-11, 0x1.CF28A8F1EA996p-11, 0x1.006C75A024160p-10,
+		  0x1.BF1DEF7D07117p-15, 0x1.3E1D5D2958667p-15, 0x1.333BEE439315Cp-16, 0x1.78F420F06ABF4p-18, 0x1.126350B9525E9p-20, 0x1.B7BFD667A16E5p-24, 0x1.5F385E80423EEp-28, 0x1.DE9BE226A58A4p-34, 0x1.A2A49DB74ED29p-41, 0x1.E501D9851D759p-51 },
+		{ -0x1.4CB29CE254C07p-24, -0x1.72FA6F59A801Bp-21, -0x1.F950FAEB27A5Ap-20, -0x1.DE890F404004Bp-19, -0x1.753CB3CD5C3DDp-18, -0x1.F76F10AA80F7Ap-18, -0x1.1F2CA18348836p-17, -0x1.BAFD363EAA4B3p-18, 0x1.6E5A88C060FF3p-18, 0x1.24B00B170C239p-14,
+		  -0x1.E206788BFBAA2p-21, -0x1.A075F152D3044p-20, -0x1.7505205A96CA3p-20, -0x1.4B2E200D0A8ABp-21, -0x1.2F3730AD710FDp-23, -0x1.1B098A6F70A19p-26, -0x1.F99780B5A26F6p-31, -0x1.7A860296AED0Bp-36, -0x1.6DC4A539F8E3Bp-43, -0x1.F17F165283B91p-53 },
+		{ -0x1.2E9A7EC278A22p-29, -0x1.6A48554C2F3BCp-26, -0x1.1BE7B102826ABp-24, -0x1.4B30B6EB444CDp-23, -0x1.56546173E93BCp-22, -0x1.4FFC8EFC93D55p-21, -0x1.469D0A0306489p-20, -0x1.485F35C038033p-19, -0x1.70DF7779F51DEp-18, -0x1.2AEE72D90069Ep-16,
+		  -0x1.26282EE9C8EEFp-24, 0x1.21F5F75FFE0CDp-24, 0x1.EF579D48AD822p-24, 0x1.04FECCB72AD2Bp-24, 0x1.0436F4D98E0F3p-26, 0x1.02BD42BA6160Fp-29, 0x1.EC618DF2EFFBCp-34, 0x1.8EDA7DAB83ECBp-39, 0x1.B1C2B5100637Ep-46, 0x1.73EA2DEF917FDp-55 },
+		{ 0x1.D1BE49EEFDDDEp-34, 0x1.19A5643011111p-30, 0x1.C1AC9FB3DBBBCp-29, 0x1.0CC045E683BBCp-27, 0x1.1DC6499153BBCp-26, 0x1.2194B6FDF6EEFp-25, 0x1.242E10AC62666p-24, 0x1.341B1E1354444p-23, 0x1.7415B69BE6CCDp-22, 0x1.5E7D27E7A1777p-20,
+		  0x1.0DDC2174C4444p-31, -0x1.56169A344AAABp-29, -0x1.E779872147777p-29, -0x1.15ACC8670D555p-29, -0x1.3F9BCC000DBBCp-31, -0x1.7D7E99066E4CDp-34, -0x1.C23021E975889p-38, -0x1.D4CBDE1181800p-43, -0x1.59A4A4DC02522p-49, -0x1.C42E7B5701440p-58 },
+		{ 0x1.0653E3146EEEFp-34, 0x1.2AFDB58D2AAABp-31, 0x1.AA98D5F6AAAABp-30, 0x1.B44D7DAF22222p-29, 0x1.7FA3DBD380000p-28, 0x1.389C86C88AAABp-27, 0x1.EDEA8E9D33333p-27, 0x1.8AA9AC1AB3333p-26, 0x1.574D829D30000p-25, 0x1.BB936E3C18889p-24,
+		  0x1.7FEBCDAA5999Ap-30, 0x1.0010260BBBBBCp-36, -0x1.58410477F7777p-31, -0x1.7AA2296D05555p-32, -0x1.474BD5C5E999Ap-34, -0x1.CE500DC5F4444p-38, -0x1.403D5D88DEEEFp-43, 0x1.C2E9FD082F777p-48, 0x1.CA04763BC9333p-53, 0x1.0A90BDA127177p-60 },
+		{ -0x1.C15C7432AAAABp-38, -0x1.01BF9BBEEEEEFp-34, -0x1.74C815D777777p-33, -0x1.85C1C5AEEEEEFp-32, -0x1.6238C12E66666p-31, -0x1.2F0E46F333333p-30, -0x1.01B79CD888889p-29, -0x1.CFFB87B4CCCCDp-29, -0x1.F73665B377777p-28, -0x1.13CA4CFAB3333p-25,
+		  -0x1.DF47F12666666p-34, 0x1.C85DD77777777p-39, 0x1.DB7ABAB222222p-35, 0x1.018154BC88889p-35, 0x1.B9CCDA0F77777p-38, 0x1.2D22F18155555p-41, 0x1.08561AB088889p-47, -0x1.033AAF21AAAABp-50, -0x1.EA2FEAAA17777p-56, -0x1.50DFCC7F67BBCp-63 },
+		{ -0x1.1442408000000p-41, -0x1.3B4394999999Ap-38, -0x1.C2A6564444444p-37, -0x1.CD7B69DDDDDDEp-36, -0x1.95025A4444444p-35, -0x1.4641A66AAAAABp-34, -0x1.EFFDFE999999Ap-34, -0x1.5C6FD76EEEEEFp-33, -0x1.2E868A5111111p-33, 0x1.0D221926EEEEFp-29,
+		  -0x1.F6A2B19111111p-37, 0x1.FBF963BBBBBBCp-41, 0x1.1FF17B9111111p-37, 0x1.542615A555555p-38, 0x1.601D43E333333p-40, 0x1.6BA7F9EF77777p-43, 0x1.797CBBE155555p-47, 0x1.7AEE6369BBBBCp-52, 0x1.4EE47768BBBBCp-58, 0x1.9C895F7A6AAABp-66 },
+		{ 0x1.1F02964444444p-43, 0x1.4999EECCCCCCDp-40, 0x1.DE118B3333333p-39, 0x1.F5C495999999Ap-38, 0x1.C9C31D7777777p-37, 0x1.88795D3333333p-36, 0x1.4C5DB9EEEEEEFp-35, 0x1.2433EB1111111p-34, 0x1.1FFE7AB333333p-33, 0x1.470CB33333333p-32,
+		  0x1.53FCB91111111p-39, -0x1.4943A22222222p-42, -0x1.AB0153DDDDDDEp-40, -0x1.DFF0A01111111p-41, -0x1.D61A458000000p-43, -0x1.BF6830999999Ap-46, -0x1.9AB01B6AAAAABp-50, -0x1.61855F5777777p-55, -0x1.20D9BD8C44444p-61, -0x1.B001668B11111p-69 },
+		{ -0x1.E4B6800000000p-48, -0x1.11FEBBBBBBBBCp-44, -0x1.88106EEEEEEEFp-43, -0x1.97F7555555555p-42, -0x1.6EB099999999Ap-41, -0x1.386C644444444p-40, -0x1.0EAC0CCCCCCCDp-39, -0x1.06131DDDDDDDEp-38, -0x1.584A5E6666666p-37, -0x1.234C002222222p-34,
+		  -0x1.00EAB55555555p-42, -0x1.956BAEEEEEEEFp-43, -0x1.B8F4B33333333p-44, -0x1.40865CCCCCCCDp-45, -0x1.0E92B88888889p-47, -0x1.EEA409999999Ap-51, -0x1.9BD44F7777777p-55, -0x1.434C32AAAAAABp-61, 0x1.5235E4AAAAAABp-66, 0x1.8433F9B111111p-72 },
+		{ 0x1.4E1FBBBBBBBBCp-50, 0x1.7B3C000000000p-47, 0x1.F33EEEEEEEEEFp-46, 0x1.B916EEEEEEEEFp-45, 0x1.34F5111111111p-44, 0x1.40A0888888889p-44, 0x1.D80EEEEEEEEEFp-46, -0x1.3C76666666666p-43, -0x1.37AA444444444p-41, 0x1.DBF5333333333p-39,
+		  0x1.F491DDDDDDDDEp-44, 0x1.BD2B333333333p-44, 0x1.1920D55555555p-44, 0x1.9D10D55555555p-46, 0x1.501A488888889p-48, 0x1.20F3777777777p-51, 0x1.D076044444444p-56, 0x1.2024177777777p-61, 0x1.18A79DDDDDDDEp-70, -0x1.609E7F1111111p-75 },
+		{ 0x1.5AC0888888889p-48, 0x1.840B777777777p-45, 0x1.0F61BBBBBBBBCp-43, 0x1.0FCD99999999Ap-42, 0x1.CA89111111111p-42, 0x1.6078EEEEEEEEFp-41, 0x1.00D6EEEEEEEEFp-40, 0x1.6DDCEEEEEEEEFp-40, 0x1.09FE333333333p-39, 0x1.AE62AAAAAAAABp-39,
+		  0x1.FCB6000000000p-43, 0x1.3CC9111111111p-43, 0x1.CEC9555555555p-45, 0x1.A446888888889p-47, 0x1.A4CD555555555p-50, 0x1.CA9CCCCCCCCCDp-54, 0x1.01A0AAAAAAAABp-58, 0x1.0E3799999999Ap-64, 0x1.42D9444444444p-71, 0x1.7E93044444444p-78 },
+		{ -0x1.C8E0000000000p-51, -0x1.0518888888889p-47, -0x1.6D33333333333p-46, -0x1.68D1111111111p-45, -0x1.2FFEEEEEEEEEFp-44, -0x1.CFF999999999Ap-44, -0x1.4D10000000000p-43, -0x1.CA6AAAAAAAAABp-43, -0x1.3BEDDDDDDDDDEp-42, -0x1.1C1999999999Ap-41,
+		  -0x1.62D999999999Ap-45, -0x1.BCF3333333333p-46, -0x1.6525555555555p-47, -0x1.53C7777777777p-49, -0x1.7632222222222p-52, -0x1.E2E0000000000p-56, -0x1.2A3AAAAAAAAABp-60, -0x1.69DAAAAAAAAABp-66, -0x1.400199999999Ap-73, -0x1.9465111111111p-81 },
+		{ -0x1.9BACCCCCCCCCDp-50, -0x1.CCA2222222222p-47, -0x1.41A8888888889p-45, -0x1.4151111111111p-44, -0x1.0DD999999999Ap-43, -0x1.9C18888888889p-43, -0x1.28B999999999Ap-42, -0x1.9C8CCCCCCCCCDp-42, -0x1.19CB333333333p-41, -0x1.7F5EEEEEEEEEFp-41,
+		  -0x1.3440888888889p-44, -0x1.830DDDDDDDDDEp-45, -0x1.204AAAAAAAAABp-46, -0x1.0BCE666666666p-48, -0x1.1556666666666p-51, -0x1.372BBBBBBBBBCp-55, -0x1.5B9EEEEEEEEEFp-60, -0x1.39C7777777777p-66, -0x1.4682222222222p-74, 0x1.BC33333333333p-86 }
+	},
+	{
+		{ 0x1.56F9768F526F8p-10, 0x1.835E830EC64CFp-7, 0x1.0F2D9A5675CB5p-5, 0x1.0D18856F2F8D8p-4, 0x1.C4B563733557Fp-4, 0x1.5A3563F7FB242p-3, 0x1.F2EA94D5D6F16p-3, 0x1.5A55B9456C101p-2, 0x1.D7ADC4D4168A1p-2, 0x1.42F2BFBD8F6FCp-1,
+		  0x1.172471BD972A8p-4, 0x1.5A42CFFD4FCC9p-5, 0x1.0763770749381p-6, 0x1.DFA5E5D18A03Cp-9, 0x1.F5D7FD8737621p-12, 0x1.1ABE63F16EA86p-15, 0x1.356390449481Ap-20, 0x1.13EB333DC8750p-26, 0x1.1EAC7384B9BE9p-34, 0x1.2ADB56A6A0FFFp-45 },
+		{ -0x1.DBC6A0A50658Dp-15, -0x1.0CABFBE231F2Cp-11, -0x1.7824AA0AF04D5p-10, -0x1.7537197B751C7p-9, -0x1.39E2DF4D676AEp-8, -0x1.DFFA0CE3FFBC5p-8, -0x1.59B92A1246EA0p-7, -0x1.DFB7C5FE6054Fp-7, -0x1.4656B9D98EEE6p-6, -0x1.BDC1A7ECF2BDBp-6,
+		  -0x1.835CC7B9D152Dp-10, -0x1.E1D888B63315Ap-11, -0x1.70A88E808319Bp-12, -0x1.52D213BD5F5B1p-14, -0x1.676850FA8F84Bp-17, -0x1.9D13FC39EB617p-21, -0x1.D1341A92E5105p-26, -0x1.B17B359E50ADAp-32, -0x1.E4F8D4588743Cp-40, -0x1.2853D8495FAF6p-50 },
+		{ 0x1.4138CA47944F8p-19, 0x1.6AAAB184F3D08p-16, 0x1.FB609511A65B6p-15, 0x1.F6D90E973B431p-14, 0x1.A62DF59EE087Fp-13, 0x1.41F5C2BDA6719p-12, 0x1.CE02E34B934C5p-12, 0x1.3E85FBA007FDCp-11, 0x1.AC47673D2711Ap-11, 0x1.1B6B51F24E692p-10,
+		  0x1.868BD582E2752p-15, 0x1.F801CFEA98101p-16, 0x1.9E81779FD463Bp-17, 0x1.A764B7398B9D4p-19, 0x1.0185B6EF73049p-21, 0x1.5DF44B650DF12p-25, 0x1.E15AA97EA43D9p-30, 0x1.1D012A169A1DFp-35, 0x1.AE1ADE5ADCE9Ap-43, 0x1.916AE2B2611BBp-53 },
+		{ -0x1.6D9E47C087BD7p-24, -0x1.9BADA0CDDD061p-21, -0x1.1E566E17774B7p-19, -0x1.1922F9018D0B1p-18, -0x1.D15AB093A533Ap-18, -0x1.5B3C4947E0CACp-17, -0x1.E168BCD7B591Fp-17, -0x1.389EF284B34F3p-16, -0x1.720863A54F769p-16, -0x1.290B297F82902p-16,
+		  -0x1.568E34ED4B51Ap-20, -0x1.28EBDBCA1EE73p-20, -0x1.6896E473CC6B5p-21, -0x1.080F10701968Cp-22, -0x1.B1CF6693C2554p-25, -0x1.7840A251184A3p-28, -0x1.3BD152E79E75Cp-32, -0x1.BA05FBB848086p-38, -0x1.836E25BB93130p-45, -0x1.A979CE7D89389p-55 },
+		{ 0x1.3018FCC275222p-31, 0x1.37AD822B53CCDp-28, 0x1.56DF2E1DD9111p-27, 0x1.79262C8F6FBBCp-27, -0x1.15FB674F50000p-28, -0x1.F02EB69549BBCp-25, -0x1.A92F21F9F6666p-23, -0x1.22486F632A044p-21, -0x1.84740FAC6B489p-20, -0x1.465AA5C491B00p-18,
+		  -0x1.1D2E85AC8999Ap-26, 0x1.8042232C88222p-25, 0x1.0644B0D506C66p-24, 0x1.0492EF8136AEFp-25, 0x1.F16E8E5597BABp-28, 0x1.D712896AEF7F7p-31, 0x1.A42E3D80CD811p-35, 0x1.358529E77F333p-40, 0x1.1F2ED0C52C84Cp-47, 0x1.5BC81DD6E5A5Ap-57 },
+		{ 0x1.362F25D36DDDEp-32, 0x1.668A852339111p-29, 0x1.071B8CEF0999Ap-27, 0x1.18D6E5FFEB777p-26, 0x1.05A216B6A0889p-25, 0x1.CB1A2E4B95555p-25, 0x1.8D98D653D5555p-24, 0x1.639E2520C3777p-23, 0x1.61EF24A63E889p-22, 0x1.EE8D663376222p-21,
+		  0x1.B71909CDD5555p-28, -0x1.0BD45C36C8889p-29, -0x1.7ABDDBFD1C444p-28, -0x1.A4743C5B4B777p-29, -0x1.A597CD86BF99Ap-31, -0x1.9DD3F79A15AABp-34, -0x1.7EDECBBEA16EFp-38, -0x1.2797E6D02D4EFp-43, -0x1.270F19E9DC500p-50, -0x1.9F870F7C2B9ABp-60 },
+		{ -0x1.4033AB07AAAABp-36, -0x1.72AD70FB08889p-33, -0x1.10E8B0DEA6666p-31, -0x1.24F631951DDDEp-30, -0x1.13714F3577777p-29, -0x1.EA6FE26855555p-29, -0x1.B2DA82CDC0000p-28, -0x1.94C946D1E6666p-27, -0x1.B27D58AA20000p-26, -0x1.6E121C278999Ap-24,
+		  -0x1.1A5314E9CCCCDp-32, 0x1.2EDE188D55555p-34, 0x1.E18AC25BD5555p-33, 0x1.1A8CCA5C37777p-33, 0x1.2F91D683A999Ap-35, 0x1.45CDB3524BBBCp-38, 0x1.525B26DD02AABp-42, 0x1.3020CCCDE9DDEp-47, 0x1.76C4CBD883DDEp-54, 0x1.71AF69E5116EFp-63 },
+		{ -0x1.2AD2EE5444444p-39, -0x1.53987C6CCCCCDp-36, -0x1.E172994AAAAABp-35, -0x1.E6EA332666666p-34, -0x1.A42EC3D99999Ap-33, -0x1.4B900B3777777p-32, -0x1.EDC5053BBBBBCp-32, -0x1.5BAAF9ACCCCCDp-31, -0x1.9C78A0DBBBBBCp-31, 0x1.3941453111111p-30,
+		  -0x1.062434B333333p-34, 0x1.833FE26666666p-40, 0x1.04FD20CAAAAABp-35, 0x1.241129AE66666p-36, 0x1.0C661FC7BBBBCp-38, 0x1.BA059ABE66666p-42, 0x1.1FCA2768CCCCDp-46, 0x1.2D665E32AAAABp-53, -0x1.67B049A433333p-59, -0x1.0E2B2D24B8889p-66 },
+		{ 0x1.13D55BE666666p-41, 0x1.3BCCCFB777777p-38, 0x1.C6B7A1C000000p-37, 0x1.D7CAC24888889p-36, 0x1.A74F868888889p-35, 0x1.627A40CCCCCCDp-34, 0x1.2249DC0666666p-33, 0x1.E5CF5FF777777p-33, 0x1.BC3CDCD777777p-32, 0x1.02CAB1D666666p-30,
+		  0x1.6C01089111111p-37, -0x1.8D0D511111111p-42, -0x1.7C2FA24888889p-38, -0x1.B3C5591555555p-39, -0x1.A34B3C5EEEEEFp-41, -0x1.7762B1C777777p-44, -0x1.24798ECC44444p-48, -0x1.3771C17F77777p-54, -0x1.801DE81333333p-64, 0x1.CD9DF43100000p-70 },
+		{ -0x1.07BD600000000p-45, -0x1.2FC29F7777777p-42, -0x1.BA09E66666666p-41, -0x1.D2F47BBBBBBBCp-40, -0x1.AE72C33333333p-39, -0x1.77E5DC4444444p-38, -0x1.486B67BBBBBBCp-37, -0x1.31CA244444444p-36, -0x1.54DF248888889p-35, -0x1.4853C83333333p-33,
+		  -0x1.2D0BB33333333p-41, -0x1.153DCCCCCCCCDp-43, 0x1.FE57266666666p-44, 0x1.6B975CCCCCCCDp-44, 0x1.628011999999Ap-46, 0x1.266383DDDDDDEp-49, 0x1.5530B00000000p-54, -0x1.64D1C77777777p-62, -0x1.78470FD555555p-65, -0x1.23B0BEC088889p-72 },
+		{ -0x1.4BA0444444444p-47, -0x1.78270AAAAAAABp-44, -0x1.088109999999Ap-42, -0x1.0A60EBBBBBBBCp-41, -0x1.C5D9BBBBBBBBCp-41, -0x1.614F2EEEEEEEFp-40, -0x1.0333322222222p-39, -0x1.675E622222222p-39, -0x1.A2DF600000000p-39, 0x1.84DCD77777777p-38,
+		  -0x1.ACD3ACCCCCCCDp-42, -0x1.73F6F77777777p-43, -0x1.4781000000000p-47, 0x1.4EBC044444444p-46, 0x1.CA4D300000000p-48, 0x1.F9A6DCCCCCCCDp-51, 0x1.EEB4E2AAAAAABp-55, 0x1.9A72804444444p-60, 0x1.F3D1CF5555555p-67, 0x1.6CB8A5599999Ap-75 },
+		{ 0x1.0757111111111p-48, 0x1.2C7FEEEEEEEEFp-45, 0x1.A71CCCCCCCCCDp-44, 0x1.A968000000000p-43, 0x1.6AE399999999Ap-42, 0x1.1D0B444444444p-41, 0x1.A9DF444444444p-41, 0x1.394C444444444p-40, 0x1.D6B6444444444p-40, 0x1.36DF444444444p-39,
+		  0x1.7199111111111p-43, 0x1.9F60CCCCCCCCDp-44, 0x1.EB3F333333333p-46, 0x1.C4D3BBBBBBBBCp-49, -0x1.2392222222222p-53, -0x1.4339222222222p-54, -0x1.8EA6444444444p-58, -0x1.60954CCCCCCCDp-63, -0x1.AD8D377777777p-70, -0x1.4A49E5DDDDDDEp-78 },
+		{ 0x1.2D4799999999Ap-48, 0x1.54A5111111111p-45, 0x1.DAB8AAAAAAAABp-44, 0x1.D9AF555555555p-43, 0x1.8C6B777777777p-42, 0x1.2E5D777777777p-41, 0x1.B298EEEEEEEEFp-41, 0x1.2B9A444444444p-40, 0x1.8FE5333333333p-40, 0x1.FFBF777777777p-40,
+		  0x1.E850222222222p-43, 0x1.2B46AAAAAAAABp-43, 0x1.CD74666666666p-45, 0x1.9A24888888889p-47, 0x1.BC60AAAAAAAABp-50, 0x1.F0E7777777777p-54, 0x1.141CAAAAAAAABp-58, 0x1.E977333333333p-65, 0x1.1B5E666666666p-72, 0x1.FF5EAAAAAAAABp-82 },
+		{ -0x1.AFAAAAAAAAAABp-51, -0x1.ED53333333333p-48, -0x1.58C0000000000p-46, -0x1.5753333333333p-45, -0x1.1FCAAAAAAAAABp-44, -0x1.B9DBBBBBBBBBCp-44, -0x1.3DE1111111111p-43, -0x1.B840000000000p-43, -0x1.2AEAAAAAAAAABp-42, -0x1.83A0000000000p-42,
+		  -0x1.57AEEEEEEEEEFp-45, -0x1.AB66666666666p-46, -0x1.4402222222222p-47, -0x1.1BCEEEEEEEEEFp-49, -0x1.2B4AAAAAAAAABp-52, -0x1.33A7777777777p-56, -0x1.4044444444444p-61, -0x1.0988888888889p-67, -0x1.B0D5555555555p-76, -0x1.1B0BBBBBBBBBCp-85 },
+		{ -0x1.71D999999999Ap-50, -0x1.A25EEEEEEEEEFp-47, -0x1.23CB333333333p-45, -0x1.2349111111111p-44, -0x1.E833333333333p-44, -0x1.7520000000000p-43, -0x1.0D23BBBBBBBBCp-42, -0x1.75B1111111111p-42, -0x1.FC4DDDDDDDDDEp-42, -0x1.5C87777777777p-41,
+		  -0x1.2A2D555555555p-44, -0x1.6D8AAAAAAAAABp-45, -0x1.1905DDDDDDDDEp-46, -0x1.F38EEEEEEEEEFp-49, -0x1.0D32AAAAAAAABp-51, -0x1.2DA7777777777p-55, -0x1.4DB2222222222p-60, -0x1.288BBBBBBBBBCp-66, -0x1.3AD2222222222p-74, -0x1.3D18888888889p-85 }
+	},
+	{
+		{ 0x1.3B92E6A55D47Fp-10, 0x1.646C180887B0Cp-7, 0x1.F30756F6E3923p-6, 0x1.EF32DF2414704p-5, 0x1.A08C063C008E8p-4, 0x1.3E8E8F321B467p-3, 0x1.CB12F274F9F1Dp-3, 0x1.3EAF1F3199207p-2, 0x1.B2097FF980AF7p-2, 0x1.2933E92AFBAF5p-1,
+		  0x1.0BC206BC734D7p-4, 0x1.4C1EDF0F7A3C0p-5, 0x1.F934AEAF8932Cp-7, 0x1.CBEB787BFE38Dp-9, 0x1.E1113DF6583ACp-12, 0x1.0EED55D977C96p-15, 0x1.284755C4FA9B7p-20, 0x1.07F9A1711F0FAp-26, 0x1.11CDA265AD3ABp-34, 0x1.1C5049EDD89D1p-45 },
+		{ -0x1.93BC4A5725740p-15, -0x1.C7FE573DDE6B2p-12, -0x1.3F375D1FDD078p-10, -0x1.3CC2DE789C643p-9, -0x1.0A71ACCEC3DBBp-8, -0x1.9783E5F053622p-8, -0x1.259EFDA0F9527p-7, -0x1.979FD02447349p-7, -0x1.158BED902E53Ap-6, -0x1.7BF942B5A95A1p-6,
+		  -0x1.5694C9F9C45F0p-10, -0x1.A920D579F575Bp-11, -0x1.43A837EA18D13p-12, -0x1.271B44700E2F3p-14, -0x1.3564299F0DF2Fp-17, -0x1.5DA72BC670F59p-21, -0x1.803F77889D764p-26, -0x1.58F075BDDA131p-32, -0x1.6A695978E7AABp-40, -0x1.83135C93B7809p-51 },
+		{ 0x1.00CCAB7C59965p-19, 0x1.22053765CF7D8p-16, 0x1.96006660F144Cp-15, 0x1.92CB1BD804FA6p-14, 0x1.52B3ECEE50BBDp-13, 0x1.02E5764E88203p-12, 0x1.74D24ED04BF44p-12, 0x1.028229BF61CFDp-11, 0x1.5F5B61B854966p-11, 0x1.DED8C5C6088DFp-11,
+		  0x1.468B2AC73ECDCp-15, 0x1.9856897974F7Ep-16, 0x1.3BCF694BFA152p-17, 0x1.27326F72CFFFAp-19, 0x1.40BC09E595495p-22, 0x1.7CDF7BF237414p-26, 0x1.C03C57C9E3035p-31, 0x1.BB812CCC0AA58p-37, 0x1.0E24292FEE01Fp-44, 0x1.78AE73DDCAA6Dp-55 },
+		{ -0x1.38BBE45DC2D03p-24, -0x1.60FF6FA5B8A71p-21, -0x1.ED996193A3450p-20, -0x1.E8CA6F298CC91p-19, -0x1.99E0036B9BEFFp-18, -0x1.380480C4D309Ep-17, -0x1.BE8DE59B571D1p-17, -0x1.3294D864CFBA0p-16, -0x1.992E86FB7D69Dp-16, -0x1.0A2B5A2D3A7F2p-15,
+		  -0x1.456E374CE785Cp-20, -0x1.B5A1973340440p-21, -0x1.82D6931E539A2p-22, -0x1.AFAB71B01A42Dp-24, -0x1.1FCAEAE899BC5p-26, -0x1.AA649C2CDE742p-30, -0x1.3C7D6F3763D15p-34, -0x1.8F560B77C5755p-40, -0x1.3BE6486F59995p-47, -0x1.2B93AB81CB406p-57 },
+		{ 0x1.217CD3F9A1911p-29, 0x1.4546EAF3FAA22p-26, 0x1.C27DBF3EEFD55p-25, 0x1.B7171AD01B666p-24, 0x1.6753EA1578089p-23, 0x1.077E6C75032ABp-22, 0x1.6325CC0318D55p-22, 0x1.B62D5C954A444p-22, 0x1.CAF709C871111p-22, 0x1.21A242FFF0EEFp-23,
+		  0x1.A48694218B777p-26, 0x1.F7C7B953FE111p-26, 0x1.80F85F69E12ABp-26, 0x1.3E1506AAA0111p-27, 0x1.1658618C040CDp-29, 0x1.F36147270FF9Ap-33, 0x1.AA1F77973B144p-37, 0x1.2B430365929B3p-42, 0x1.033DA461D42CDp-49, 0x1.0EFBBB8FF7962p-59 },
+		{ 0x1.5E8B043322222p-35, 0x1.9F1118BF5999Ap-32, 0x1.3EAF83F008889p-30, 0x1.69B14A4CFBBBCp-29, 0x1.69E60B8AEAAABp-28, 0x1.564CDC2086666p-27, 0x1.3EB30093D0000p-26, 0x1.2F23ABFED6666p-25, 0x1.3845664E10000p-24, 0x1.9B47CA2CBC444p-23,
+		  0x1.E7730CB5C0000p-30, -0x1.4148991FA6666p-30, -0x1.35E347984C444p-29, -0x1.45A90C47C2222p-30, -0x1.3C0918828A666p-32, -0x1.2C1CBBA984AABp-35, -0x1.0A235D3793E66p-39, -0x1.8236C832F1000p-45, -0x1.5B21D5287299Ap-52, -0x1.82BD74DD56377p-62 },
+		{ -0x1.FF6251C366666p-37, -0x1.25C4747633333p-33, -0x1.A9F671EDEEEEFp-32, -0x1.BE80F754F7777p-31, -0x1.9603CF5D66666p-30, -0x1.5979378722222p-29, -0x1.200107EB51111p-28, -0x1.EAE1B49BBBBBCp-28, -0x1.C8CBFE888CCCDp-27, -0x1.18CC3A56B3333p-25,
+		  -0x1.6358E69C33333p-32, 0x1.D239AE2A22222p-35, 0x1.EB0797A29999Ap-33, 0x1.16C84E482CCCDp-33, 0x1.1737D3FB67777p-35, 0x1.0EFEB99473BBCp-38, 0x1.EB206105A2222p-43, 0x1.6E47D545E4444p-48, 0x1.57B1953B45333p-55, 0x1.A343510A72BBCp-65 },
+		{ 0x1.61E3CB0444444p-40, 0x1.96A1716666666p-37, 0x1.26EFB82EEEEEFp-35, 0x1.35806E3333333p-34, 0x1.1A249AF888889p-33, 0x1.E29E243777777p-33, 0x1.966FF3E888889p-32, 0x1.6169A16EEEEEFp-31, 0x1.574BDFFCCCCCDp-30, 0x1.D9808BF4CCCCDp-29,
+		  0x1.8D3802199999Ap-36, -0x1.2B6F5F7777777p-39, -0x1.E9472CF777777p-37, -0x1.1F89794000000p-37, -0x1.27CB6D9800000p-39, -0x1.28489076AAAABp-42, -0x1.180B162755555p-46, -0x1.BBC884B1DDDDEp-52, -0x1.CA29419D44444p-59, -0x1.4FE37E4A5DDDEp-68 },
+		{ -0x1.2923755555555p-48, -0x1.7F726AAAAAAABp-45, -0x1.654039999999Ap-43, -0x1.FB9D966666666p-42, -0x1.3E64B55555555p-40, -0x1.77AD344444444p-39, -0x1.B6FAA8CCCCCCDp-38, -0x1.0D265AAAAAAABp-36, -0x1.81A742DDDDDDEp-35, -0x1.C141C44444444p-33,
+		  0x1.7DAFE91111111p-41, 0x1.CD60377777777p-44, -0x1.99CCC9999999Ap-43, -0x1.CC17295555555p-44, -0x1.4D58893333333p-46, -0x1.CDB4362222222p-51, 0x1.778CA48888889p-54, 0x1.E71F1CDDDDDDEp-58, 0x1.02E1108800000p-63, 0x1.6EAD0EEF9999Ap-72 },
+		{ -0x1.2EC5BCCCCCCCDp-46, -0x1.57D6FDDDDDDDEp-43, -0x1.E932033333333p-42, -0x1.F07C088888889p-41, -0x1.B009566666666p-40, -0x1.592FACCCCCCCDp-39, -0x1.07B3600000000p-38, -0x1.89A1F33333333p-38, -0x1.1CFA191111111p-37, -0x1.C6BA688888889p-38,
+		  -0x1.2A4F69999999Ap-41, -0x1.08302EEEEEEEFp-43, 0x1.0D1E955555555p-43, 0x1.834E05DDDDDDEp-44, 0x1.9042340000000p-46, 0x1.7627284444444p-49, 0x1.3544AD6666666p-53, 0x1.7C00173333333p-59, 0x1.A12DFBAAAAAABp-67, -0x1.B7DA228000000p-77 },
+		{ -0x1.AA41A22222222p-49, -0x1.00B52AAAAAAABp-45, -0x1.64A96EEEEEEEFp-44, -0x1.58CF844444444p-43, -0x1.15A0666666666p-42, -0x1.8F8A666666666p-42, -0x1.FF8F6EEEEEEEFp-42, -0x1.1796CCCCCCCCDp-41, -0x1.91E2333333333p-42, 0x1.CBD2AAAAAAAABp-42,
+		  -0x1.F7BB9DDDDDDDEp-43, -0x1.7336AEEEEEEEFp-43, -0x1.73AEF33333333p-44, -0x1.C2E8ACCCCCCCDp-46, -0x1.4C83B66666666p-48, -0x1.01D8DE6666666p-51, -0x1.883E6CCCCCCCDp-56, -0x1.E6DBE44444444p-62, -0x1.3BB830CCCCCCDp-69, 0x1.3F86A11111111p-82 },
+		{ 0x1.79E6CCCCCCCCDp-49, 0x1.A78AEEEEEEEEFp-46, 0x1.2994333333333p-44, 0x1.2527777777777p-43, 0x1.ED64AAAAAAAABp-43, 0x1.7506EEEEEEEEFp-42, 0x1.09FEAAAAAAAABp-41, 0x1.6AAF333333333p-41, 0x1.D547555555555p-41, 0x1.08EECCCCCCCCDp-40,
+		  0x1.40D7EEEEEEEEFp-43, 0x1.8DFF555555555p-44, 0x1.36C6AAAAAAAABp-45, 0x1.240EBBBBBBBBCp-47, 0x1.3307444444444p-50, 0x1.7C68AAAAAAAABp-54, 0x1.B6CA111111111p-59, 0x1.910AAAAAAAAABp-65, 0x1.8B64111111111p-73, -0x1.0F35800000000p-83 },
+		{ 0x1.084B111111111p-48, 0x1.3839111111111p-45, 0x1.B72D555555555p-44, 0x1.B424222222222p-43, 0x1.6EB2666666666p-42, 0x1.1960CCCCCCCCDp-41, 0x1.9501BBBBBBBBCp-41, 0x1.180AAAAAAAAABp-40, 0x1.7F32444444444p-40, 0x1.098B111111111p-39,
+		  0x1.C832444444444p-43, 0x1.1F46EEEEEEEEFp-43, 0x1.BD4A222222222p-45, 0x1.8A50222222222p-47, 0x1.A7FE444444444p-50, 0x1.D243111111111p-54, 0x1.FE91555555555p-59, 0x1.F1CF333333333p-65, 0x1.07B1000000000p-72, 0x1.5FE499999999Ap-83 },
+		{ -0x1.8D0AAAAAAAAABp-51, -0x1.BD9999999999Ap-48, -0x1.39A7777777777p-46, -0x1.3584444444444p-45, -0x1.05ADDDDDDDDDEp-44, -0x1.8DF3333333333p-44, -0x1.1EE8888888889p-43, -0x1.8F91111111111p-43, -0x1.0F78888888889p-42, -0x1.74F1111111111p-42,
+		  -0x1.49B6666666666p-45, -0x1.95A0000000000p-46, -0x1.388AAAAAAAAABp-47, -0x1.1FA5555555555p-49, -0x1.2254444444444p-52, -0x1.5DE0000000000p-56, -0x1.7FBEEEEEEEEEFp-61, -0x1.4B73333333333p-67, -0x1.708BBBBBBBBBCp-75, -0x1.DD2BBBBBBBBBCp-86 },
+		{ -0x1.43F4444444444p-50, -0x1.7E4AAAAAAAAABp-47, -0x1.0CB2222222222p-45, -0x1.0ADD555555555p-44, -0x1.C0C8888888889p-44, -0x1.582EEEEEEEEEFp-43, -0x1.EF7EEEEEEEEEFp-43, -0x1.56A6666666666p-42, -0x1.D3DEEEEEEEEEFp-42, -0x1.406EEEEEEEEEFp-41,
+		  -0x1.173A222222222p-44, -0x1.5ECDDDDDDDDDEp-45, -0x1.0E9AAAAAAAAABp-46, -0x1.DF1EEEEEEEEEFp-49, -0x1.FDC7777777777p-52, -0x1.1702AAAAAAAABp-55, -0x1.2C75555555555p-60, -0x1.1C31111111111p-66, -0x1.1CA8000000000p-74, -0x1.1FBA222222222p-85 }
+	},
+	{
+		{ 0x1.2433EF666F81Ep-10, 0x1.4A06B24150A43p-7, 0x1.CE124F8B5130Ap-6, 0x1.CA868455E312Cp-5, 0x1.81B2E32F02934p-4, 0x1.26F742EE50A88p-3, 0x1.A913DD8F9FDAEp-3, 0x1.2715BC514DA9Cp-2, 0x1.91E5CB070637Dp-2, 0x1.1332C5390A69Dp-1,
+		  0x1.01A6EE26022DFp-4, 0x1.3F9540175EB9Ep-5, 0x1.E6204F12D2DBDp-7, 0x1.BA89EB64C7C72p-9, 0x1.CEDE722675364p-12, 0x1.04A9D0AD8CD97p-15, 0x1.1D07E4D32A40Ap-20, 0x1.FBD7B187DA8D8p-27, 0x1.075156EA1D9F4p-34, 0x1.114B8E6BB44AEp-45 },
+		{ -0x1.5A4AC89A77C18p-15, -0x1.871DD91EA5A92p-12, -0x1.11CD4DA93E097p-10, -0x1.0FB340530585Dp-9, -0x1.C91785EF10867p-9, -0x1.5D901377BE503p-8, -0x1.F7C12E7671382p-8, -0x1.5DB2D2B71B0A5p-7, -0x1.DC45C16166E92p-7, -0x1.461D8CFFC47FBp-6,
+		  -0x1.315916FE0E463p-10, -0x1.7AC4474F6C6AFp-11, -0x1.201CE37799F42p-12, -0x1.065564BDFB109p-14, -0x1.1277CC2BBAC03p-17, -0x1.354407CA2C417p-21, -0x1.5263B74380187p-26, -0x1.2DBE7B915E0A5p-32, -0x1.396912A77109Bp-40, -0x1.466161D68A7F4p-51 },
+		{ 0x1.9A065636B28C4p-20, 0x1.CF183C85DFAFBp-17, 0x1.442F2C9E7B569p-15, 0x1.41AFA02750B24p-14, 0x1.0E9495C4C1485p-13, 0x1.9DD3FE74AEF0Bp-13, 0x1.2A27CAD090CF3p-12, 0x1.9DE3B1C706B05p-12, 0x1.19C7566C7EE5Ap-11, 0x1.81ABE26ACC905p-11,
+		  0x1.0F1E3685A2A14p-15, 0x1.50B5CC878E901p-16, 0x1.00C2E1F2C4569p-17, 0x1.D571C969F126Ap-20, 0x1.EE0C171915168p-23, 0x1.18AFC482663E8p-26, 0x1.36DBFAF0FDCB9p-31, 0x1.1A4A8AEE63857p-37, 0x1.2E285A8E3C769p-45, 0x1.4EACBDC93D4ABp-56 },
+		{ -0x1.E1798CDB1D555p-25, -0x1.0FDF2867EFB0Bp-21, -0x1.7C91DDD32E9D1p-20, -0x1.7985B5C051A71p-19, -0x1.3D6727466F22Dp-18, -0x1.E51F0D060D482p-18, -0x1.5D2F12B894C3Bp-17, -0x1.E3FFF79E3D6A4p-17, -0x1.48A77BF974E7Ap-16, -0x1.BF30B3AB79E4Fp-16,
+		  -0x1.0868ABD15EB33p-20, -0x1.4CDE21A1DA83Cp-21, -0x1.04F002F2D242Fp-22, -0x1.F1DBC9CA703A6p-25, -0x1.1600CD3C9998Dp-27, -0x1.55DD95FADE017p-31, -0x1.A3F552FDD9FB7p-36, -0x1.B5864EF2235F7p-42, -0x1.1B52B1637E0FFp-49, -0x1.A7AA59E729291p-60 },
+		{ 0x1.0B2E132B042EFp-29, 0x1.2D86542D4919Ap-26, 0x1.A57775DC6D4CDp-25, 0x1.A11C68748FF77p-24, 0x1.5D759D6E447BCp-23, 0x1.09B07087B6A22p-22, 0x1.7B8D6CDCCA2ABp-22, 0x1.03DC6CFAA7955p-21, 0x1.594211524B333p-21, 0x1.BD58AA2719089p-21,
+		  0x1.EF1F5E0102889p-26, 0x1.5BA6F003ECAABp-26, 0x1.48CCCCC83A555p-27, 0x1.89E1667BF5777p-29, 0x1.177348341D6EFp-31, 0x1.B30D2194E26EFp-35, 0x1.4F070F4187489p-39, 0x1.B155F760B5111p-45, 0x1.5ABFB554718EFp-52, 0x1.447A8F4D35622p-62 },
+		{ -0x1.9C7FD16031111p-35, -0x1.CEACD43AC4444p-32, -0x1.3F303D583BBBCp-30, -0x1.352D782E88889p-29, -0x1.F528210AD5555p-29, -0x1.6A00F5B5F999Ap-28, -0x1.DBF7C7346EEEFp-28, -0x1.1831F71E3BBBCp-27, -0x1.03289BA5AEEEFp-27, 0x1.8246B2AC66666p-30,
+		  -0x1.A831CF2988889p-32, -0x1.81256BDD66666p-31, -0x1.5BEE4C1413333p-31, -0x1.32AF670697777p-32, -0x1.14103E73C0889p-34, -0x1.F572DA4AC1111p-38, -0x1.AD4EC38DB199Ap-42, -0x1.2C3BA9D7EC444p-47, -0x1.004E093358BBCp-54, -0x1.00E3F28EE0555p-64 },
+		{ -0x1.0DBCA6BD77777p-39, -0x1.391DB27622222p-36, -0x1.CF36426C44444p-35, -0x1.F3A0409088889p-34, -0x1.D6ACF94000000p-33, -0x1.A0C2644A66666p-32, -0x1.69F5B57E00000p-31, -0x1.3FF84240EEEEFp-30, -0x1.2FA3E416EEEEFp-29, -0x1.63DC19E1CCCCDp-28,
+		  -0x1.2A722B23BBBBCp-34, 0x1.E0991B6444444p-36, 0x1.20A3B0D5CCCCDp-34, 0x1.36D6D4D9D5555p-35, 0x1.2F3EB22CFBBBCp-37, 0x1.1F7E2EBE57777p-40, 0x1.FA877E3508889p-45, 0x1.6AD3F56B73333p-50, 0x1.3E20C01281111p-57, 0x1.4D749A6A28CCDp-67 },
+		{ 0x1.0A178B6666666p-41, 0x1.30E7532EEEEEFp-38, 0x1.B7C151CCCCCCDp-37, 0x1.C928696EEEEEFp-36, 0x1.9AE97A3333333p-35, 0x1.58361E1111111p-34, 0x1.18F5C9BBBBBBCp-33, 0x1.D0DEF5A222222p-33, 0x1.9CD5D40000000p-32, 0x1.CB60B4E000000p-31,
+		  0x1.7F406E0000000p-37, -0x1.52F545DDDDDDEp-40, -0x1.DF5251999999Ap-38, -0x1.130B095777777p-38, -0x1.12EDEB4CCCCCDp-40, -0x1.08C80CC666666p-43, -0x1.D96EFE399999Ap-48, -0x1.594A546333333p-53, -0x1.373661FE66666p-60, -0x1.5957D4D111111p-70 },
+		{ -0x1.8CD0A35555555p-45, -0x1.C7E1173333333p-42, -0x1.49639C0000000p-40, -0x1.576A315555555p-39, -0x1.3611AEEEEEEEFp-38, -0x1.057FB42222222p-37, -0x1.AF54A46666666p-37, -0x1.6B20EF999999Ap-36, -0x1.4D08402222222p-35, -0x1.8FF5F5AAAAAABp-34,
+		  -0x1.B5D4A9999999Ap-41, 0x1.71F2FBBBBBBBCp-43, 0x1.47B387DDDDDDEp-41, 0x1.709F0B8888889p-42, 0x1.70621E199999Ap-44, 0x1.6600DDC000000p-47, 0x1.45022C9111111p-51, 0x1.E69D3F9111111p-57, 0x1.CA9F298AAAAABp-64, 0x1.17AB0BAD11111p-73 },
+		{ -0x1.635C000000000p-50, -0x1.7A01333333333p-47, -0x1.EA05111111111p-46, -0x1.9CD2000000000p-45, -0x1.0032CCCCCCCCDp-44, -0x1.5017BBBBBBBBCp-45, 0x1.0B7F111111111p-44, 0x1.95FB888888889p-42, 0x1.70704CCCCCCCDp-40, 0x1.88B41BBBBBBBCp-38,
+		  -0x1.7814111111111p-43, -0x1.2538555555555p-43, -0x1.3E346AAAAAAABp-44, -0x1.B548B9999999Ap-46, -0x1.60B8A44444444p-48, -0x1.39EC83BBBBBBCp-51, -0x1.1732E80000000p-55, -0x1.AFA4277777777p-61, -0x1.BFF178EEEEEEFp-68, -0x1.4E76AE4444444p-77 },
+		{ -0x1.4D50B9999999Ap-48, -0x1.7010622222222p-45, -0x1.00D5266666666p-43, -0x1.FD216EEEEEEEFp-43, -0x1.ABEFE66666666p-42, -0x1.479E488888889p-41, -0x1.DBC9B77777777p-41, -0x1.4D0B8CCCCCCCDp-40, -0x1.D1553BBBBBBBCp-40, -0x1.644D9DDDDDDDEp-39,
+		  -0x1.1A1A8CCCCCCCDp-42, -0x1.5E97CCCCCCCCDp-43, -0x1.1033288888889p-44, -0x1.05A70AAAAAAABp-46, -0x1.1A786CCCCCCCDp-49, -0x1.5F13688888889p-53, -0x1.7CCAB33333333p-58, -0x1.5898D55555555p-64, -0x1.008D2EEEEEEEFp-72, 0x1.1D4BD44444444p-82 },
+		{ 0x1.64DCCCCCCCCCDp-49, 0x1.8F03777777777p-46, 0x1.1819555555555p-44, 0x1.157B555555555p-43, 0x1.D35C888888889p-43, 0x1.647C666666666p-42, 0x1.00C7222222222p-41, 0x1.6481333333333p-41, 0x1.E466222222222p-41, 0x1.4E2BDDDDDDDDEp-40,
+		  0x1.3345DDDDDDDDEp-43, 0x1.82B9555555555p-44, 0x1.28EBDDDDDDDDEp-45, 0x1.12CF666666666p-47, 0x1.2459777777777p-50, 0x1.5A66DDDDDDDDEp-54, 0x1.8B13DDDDDDDDEp-59, 0x1.6E64CCCCCCCCDp-65, 0x1.9B6FEEEEEEEEFp-73, 0x1.7828000000000p-84 },
+		{ 0x1.0753888888889p-48, 0x1.23E3DDDDDDDDEp-45, 0x1.9775DDDDDDDDEp-44, 0x1.9385DDDDDDDDEp-43, 0x1.52FB111111111p-42, 0x1.02FE444444444p-41, 0x1.7681BBBBBBBBCp-41, 0x1.03E2AAAAAAAABp-40, 0x1.6231555555555p-40, 0x1.E508888888889p-40,
+		  0x1.BE7EEEEEEEEEFp-43, 0x1.11DFBBBBBBBBCp-43, 0x1.9DF0AAAAAAAABp-45, 0x1.7EEE888888889p-47, 0x1.8951333333333p-50, 0x1.CF8FDDDDDDDDEp-54, 0x1.DC20CCCCCCCCDp-59, 0x1.ADA0000000000p-65, 0x1.B2D8888888889p-73, 0x1.C9E799999999Ap-84 },
+		{ -0x1.71FDDDDDDDDDEp-51, -0x1.9C80000000000p-48, -0x1.21C8888888889p-46, -0x1.1F24444444444p-45, -0x1.E404444444444p-45, -0x1.7166666666666p-44, -0x1.0A63333333333p-43, -0x1.724AAAAAAAAABp-43, -0x1.F7E6666666666p-43, -0x1.594CCCCCCCCCDp-42,
+		  -0x1.3B13333333333p-45, -0x1.8B5999999999Ap-46, -0x1.2B40000000000p-47, -0x1.0FD6666666666p-49, -0x1.18AAAAAAAAAABp-52, -0x1.420DDDDDDDDDEp-56, -0x1.5C42222222222p-61, -0x1.2F73333333333p-67, -0x1.3F90000000000p-75, -0x1.4A04444444444p-86 },
+		{ -0x1.4030888888889p-50, -0x1.63EDDDDDDDDDEp-47, -0x1.F10AAAAAAAAABp-46, -0x1.EC28888888889p-45, -0x1.9D8EEEEEEEEEFp-44, -0x1.3BF4444444444p-43, -0x1.C8B6666666666p-43, -0x1.3CF0000000000p-42, -0x1.AFB1111111111p-42, -0x1.2763333333333p-41,
+		  -0x1.1085555555555p-44, -0x1.4E9999999999Ap-45, -0x1.FA21111111111p-47, -0x1.D485555555555p-49, -0x1.E2EDDDDDDDDDEp-52, -0x1.1BE4CCCCCCCCDp-55, -0x1.2697777777777p-60, -0x1.0993333333333p-66, -0x1.1043333333333p-74, -0x1.1F69111111111p-85 }
+	},
+	{
+		{ 0x1.100D2CEC9F2A0p-10, 0x1.33442DB009653p-7, 0x1.AE3492C627BC4p-6, 0x1.AAE763F768525p-5, 0x1.67198052C88FDp-4, 0x1.129FBE5DF5E23p-3, 0x1.8BC349DBC9906p-3, 0x1.12BC258AFA36Ap-2, 0x1.762E8425BCC1Bp-2, 0x1.00385BE463133p-1,
+		  0x1.F137D1C19611Bp-5, 0x1.345DB4787A97Dp-5, 0x1.D51019761254Ap-7, 0x1.AB010C17E24CEp-9, 0x1.BE9E5ED9B9743p-12, 0x1.F70557FE9732Bp-16, 0x1.13050F9E57703p-20, 0x1.E9FFB9DE0D7D7p-27, 0x1.FC1EAC70185D9p-35, 0x1.07AC859326985p-45 },
+		{ -0x1.2C314F9B8D6C6p-15, -0x1.530CD3631E037p-12, -0x1.DAB4B9C25E647p-11, -0x1.D71017D8C5FFBp-10, -0x1.8C3EAC1D04886p-9, -0x1.2F07EB1797D49p-8, -0x1.B4B3362B3C622p-8, -0x1.2F2724F90E5D2p-7, -0x1.9CE2B726C260Dp-7, -0x1.1AB8C332B8000p-6,
+		  -0x1.1253543CE6A4Ep-10, -0x1.5444216AA816Dp-11, -0x1.02CC097125439p-12, -0x1.D731AF2102DBEp-15, -0x1.ECDABE5EF22CEp-18, -0x1.158F889D1AB66p-21, -0x1.2F86706A11F56p-26, -0x1.0E6B8F17D90DCp-32, -0x1.18775B90F44FDp-40, -0x1.232CB69585A67p-51 },
+		{ 0x1.4B35049119ED6p-20, 0x1.761429A5B3B6Dp-17, 0x1.05DFD3AA569B2p-15, 0x1.03DD1A6AA6897p-14, 0x1.B52D83799F37Ep-14, 0x1.4E550E5F27A59p-13, 0x1.E1CDB1799688Ap-13, 0x1.4E753A247D942p-12, 0x1.C782907848651p-12, 0x1.37E43449212D3p-11,
+		  0x1.C5FE1A94B9626p-16, 0x1.199A45F4FD584p-16, 0x1.AC7E08F3A114Ap-18, 0x1.86467583FF99Dp-20, 0x1.988412E689FB9p-23, 0x1.CC9C6AC99BC45p-27, 0x1.F87637DB4650Ep-32, 0x1.C276A362F3EAFp-38, 0x1.D4F29C687E03Bp-46, 0x1.EA91D2C0E4120p-57 },
+		{ -0x1.6CFA3EEC72539p-25, -0x1.9C372960638EDp-22, -0x1.209092D910389p-20, -0x1.1E566FEF2A4B3p-19, -0x1.E1AFF0DD8AECFp-19, -0x1.7056E945FB09Cp-18, -0x1.095F639835112p-17, -0x1.705CDE77DDFA2p-17, -0x1.F5870733BCDB3p-17, -0x1.572B936DECED7p-16,
+		  -0x1.A0B1DA09F3DEBp-21, -0x1.02FB5BFC93F40p-21, -0x1.8BB2CEF8DD304p-23, -0x1.6AC7A61410055p-25, -0x1.7F6376AEC65A6p-28, -0x1.B62DF5C990FCDp-32, -0x1.E93C90B36C689p-37, -0x1.C1743929443D5p-43, -0x1.E99C6A8643889p-51, -0x1.17872790E75F3p-61 },
+		{ 0x1.8E529D9D68B33p-30, 0x1.C1D48D6BDE111p-27, 0x1.3AD440705DA22p-25, 0x1.384AC07A56000p-24, 0x1.068A79FC6EAABp-23, 0x1.913A78617E111p-23, 0x1.20C20408FE3BCp-22, 0x1.902A3609E1CCDp-22, 0x1.0FA6B070D0C00p-21, 0x1.717FB2D80A2ABp-21,
+		  0x1.8B8CAB96DF111p-26, 0x1.F4BF1F0748889p-27, 0x1.8CDD52DC4BDDEp-28, 0x1.80B2277602000p-30, 0x1.B681022F17DDEp-33, 0x1.143D606ABE333p-36, 0x1.5CB694DAEEBBCp-41, 0x1.760716B7D8444p-47, 0x1.F2A2BFDBE7889p-55, 0x1.7D2FC1B5033BCp-65 },
+		{ -0x1.991C13129DDDEp-35, -0x1.CDAD84CB00000p-32, -0x1.42A21D10ACCCDp-30, -0x1.3F40EAD448889p-29, -0x1.0B6BE02A80000p-28, -0x1.96883FC5A2222p-28, -0x1.224ADBD508889p-27, -0x1.8D63C3DC6AAABp-27, -0x1.0802F6B546666p-26, -0x1.5592091F08889p-26,
+		  -0x1.5B03C624A2222p-31, -0x1.F5A0354DAAAABp-32, -0x1.EE4E7CBD08889p-33, -0x1.33985D23EAAABp-34, -0x1.C18CD77F91111p-37, -0x1.653621F3B999Ap-40, -0x1.169CE4388DDDEp-44, -0x1.6A5706FFD2222p-50, -0x1.20F63C1986666p-57, -0x1.088A43F4E6AABp-67 },
+		{ 0x1.1C70663CCCCCDp-40, 0x1.3EEF9A2CCCCCDp-37, 0x1.B7C4B0CA22222p-36, 0x1.A98C75999999Ap-35, 0x1.5867EE6DDDDDEp-34, 0x1.F0A3E7619999Ap-34, 0x1.45C7E1899999Ap-33, 0x1.7EF057F3BBBBCp-33, 0x1.64C1053000000p-33, -0x1.930A87CCCCCCDp-37,
+		  0x1.A264ACE222222p-38, 0x1.0878D3B000000p-36, 0x1.02E1E9E5DDDDEp-36, 0x1.D406651444444p-38, 0x1.A9256A439999Ap-40, 0x1.82EEA139AAAABp-43, 0x1.4A798792D5555p-47, 0x1.CAF86C84B3333p-53, 0x1.8215A2F61999Ap-60, 0x1.756ED7A82EEEFp-70 },
+		{ 0x1.BC14308888889p-45, 0x1.007672EEEEEEFp-41, 0x1.77B251DDDDDDEp-40, 0x1.8F7B733333333p-39, 0x1.7170F95555555p-38, 0x1.3FEA011111111p-37, 0x1.0E9A3A7777777p-36, 0x1.CF5E8AEEEEEEFp-36, 0x1.A5A467EEEEEEFp-35, 0x1.CC2089DDDDDDEp-34,
+		  0x1.00506D5555555p-39, -0x1.0D42F88888889p-41, -0x1.9B1CA9999999Ap-40, -0x1.C3D23F2222222p-41, -0x1.BA99CD8888889p-43, -0x1.A2FB63C000000p-46, -0x1.6F153A9333333p-50, -0x1.042E5DC666666p-55, -0x1.BF561FF333333p-63, -0x1.BF9F1E2CCCCCDp-73 },
+		{ -0x1.206DFBBBBBBBCp-47, -0x1.4B201BBBBBBBCp-44, -0x1.DFE7D66666666p-43, -0x1.F72B1DDDDDDDEp-42, -0x1.C87CE44444444p-41, -0x1.840ED5DDDDDDEp-40, -0x1.4111B00000000p-39, -0x1.0D1010CCCCCCDp-38, -0x1.E071BD5555555p-38, -0x1.04C112CCCCCCDp-36,
+		  -0x1.C74E488888889p-44, 0x1.16D1711111111p-43, 0x1.B1FC2DDDDDDDEp-43, 0x1.BB6A4A2222222p-44, 0x1.A5AA7C6666666p-46, 0x1.8D44CEDDDDDDEp-49, 0x1.5B41B4B333333p-53, 0x1.EFA22BE666666p-59, 0x1.B038330888889p-66, 0x1.BFA31CD99999Ap-76 },
+		{ -0x1.4D1159999999Ap-49, -0x1.75CE19999999Ap-46, -0x1.0254DDDDDDDDEp-44, -0x1.F66B333333333p-44, -0x1.972C2AAAAAAABp-43, -0x1.28146EEEEEEEFp-42, -0x1.87F8A22222222p-42, -0x1.CEE7777777777p-42, -0x1.AB07555555555p-42, 0x1.2DAB777777777p-43,
+		  -0x1.8509511111111p-43, -0x1.1B9059999999Ap-43, -0x1.0F13E88888889p-44, -0x1.5109A22222222p-46, -0x1.EF8B066666666p-49, -0x1.8C93555555555p-52, -0x1.39A2777777777p-56, -0x1.A88E700000000p-62, -0x1.6858522222222p-69, -0x1.7C3A91DDDDDDEp-79 },
+		{ -0x1.3550088888889p-48, -0x1.5DCB3BBBBBBBCp-45, -0x1.EB58D9999999Ap-44, -0x1.E86DBBBBBBBBCp-43, -0x1.9DB33BBBBBBBCp-42, -0x1.3B24066666666p-41, -0x1.C810F77777777p-41, -0x1.3D91711111111p-40, -0x1.B546EAAAAAAABp-40, -0x1.35A6ECCCCCCCDp-39,
+		  -0x1.130E5BBBBBBBCp-42, -0x1.5868C88888889p-43, -0x1.F59AA22222222p-45, -0x1.D033F77777777p-47, -0x1.AD00AEEEEEEEFp-50, -0x1.FAA4511111111p-54, -0x1.CB827BBBBBBBCp-59, -0x1.6CD959999999Ap-65, -0x1.AC7E333333333p-74, 0x1.71FC911111111p-84 },
+		{ 0x1.4D4DEEEEEEEEFp-49, 0x1.786DBBBBBBBBCp-46, 0x1.077D111111111p-44, 0x1.05EAEEEEEEEEFp-43, 0x1.B79C666666666p-43, 0x1.510D777777777p-42, 0x1.E661333333333p-42, 0x1.5154444444444p-41, 0x1.CC92222222222p-41, 0x1.3C96444444444p-40,
+		  0x1.28D1444444444p-43, 0x1.772D333333333p-44, 0x1.164BCCCCCCCCDp-45, 0x1.FD46EEEEEEEEFp-48, 0x1.0E7E555555555p-50, 0x1.2C6D111111111p-54, 0x1.3BC1111111111p-59, 0x1.1D8F555555555p-65, 0x1.14D8444444444p-73, 0x1.FBE9DDDDDDDDEp-85 },
+		{ 0x1.DAF9555555555p-49, 0x1.0C10888888889p-45, 0x1.7836000000000p-44, 0x1.75B0000000000p-43, 0x1.3BEE222222222p-42, 0x1.E06B99999999Ap-42, 0x1.5A94CCCCCCCCDp-41, 0x1.E015777777777p-41, 0x1.46EDDDDDDDDDEp-40, 0x1.C10A444444444p-40,
+		  0x1.AB99BBBBBBBBCp-43, 0x1.0CB0666666666p-43, 0x1.8F2EEEEEEEEEFp-45, 0x1.794CCCCCCCCCDp-47, 0x1.6EBDBBBBBBBBCp-50, 0x1.C702CCCCCCCCDp-54, 0x1.D37399999999Ap-59, 0x1.BD53DDDDDDDDEp-65, 0x1.D76AAAAAAAAABp-73, 0x1.CC1B333333333p-84 },
+		{ -0x1.53E1111111111p-51, -0x1.7FE0000000000p-48, -0x1.0C86666666666p-46, -0x1.0B0CCCCCCCCCDp-45, -0x1.BFD3333333333p-45, -0x1.578EEEEEEEEEFp-44, -0x1.EF9BBBBBBBBBCp-44, -0x1.5751111111111p-43, -0x1.D433333333333p-43, -0x1.403999999999Ap-42,
+		  -0x1.2E9CCCCCCCCCDp-45, -0x1.7FA8888888889p-46, -0x1.1BE3333333333p-47, -0x1.0402222222222p-49, -0x1.16B8888888889p-52, -0x1.347DDDDDDDDDEp-56, -0x1.4517777777777p-61, -0x1.2C51111111111p-67, -0x1.2B88888888889p-75, -0x1.3BB7777777777p-86 },
+		{ -0x1.2268888888889p-50, -0x1.476CCCCCCCCCDp-47, -0x1.CB65555555555p-46, -0x1.C855555555555p-45, -0x1.81A4444444444p-44, -0x1.2550888888889p-43, -0x1.A746666666666p-43, -0x1.2538000000000p-42, -0x1.8F5CCCCCCCCCDp-42, -0x1.123D555555555p-41,
+		  -0x1.054A222222222p-44, -0x1.4772222222222p-45, -0x1.E84AAAAAAAAABp-47, -0x1.CC68888888889p-49, -0x1.C112222222222p-52, -0x1.15BD555555555p-55, -0x1.1D9A222222222p-60, -0x1.0EF5DDDDDDDDEp-66, -0x1.1E0999999999Ap-74, -0x1.17FAAAAAAAAABp-85 }
+	},
+	{
+		{ 0x1.FCFFE6838C97Ep-11, 0x1.1F71577D3E954p-7, 0x1.927343E836EBEp-6, 0x1.8F5C9C5746B27p-5, 0x1.4FEE95332F376p-4, 0x1.00E808311EE3Ap-3, 0x1.723AD6ECBFE42p-3, 0x1.01029AE3C4274p-2, 0x1.5E0A821EDA145p-2, 0x1.DF613B43C21AEp-2,
+		  0x1.E0E95135867E6p-5, 0x1.2A40BE8A08F7Ap-5, 0x1.C5ADF2F921A4Fp-7, 0x1.9CFFFBAB2CECFp-9, 0x1.AFF894393AC6Dp-12, 0x1.E685ED429DBADp-16, 0x1.09FFE8420BF0Fp-20, 0x1.D9ED62338F429p-27, 0x1.EB73EA5A2E821p-35, 0x1.FE0C492927E91p-46 },
+		{ -0x1.06B5951C70C7Bp-15, -0x1.28B7034AB3B92p-12, -0x1.9F6EA7A53E412p-11, -0x1.9C3E7E7C5EF08p-10, -0x1.5AC4AB05AD4B2p-9, -0x1.093187FB29A1Dp-8, -0x1.7E2C24E8AC8B0p-8, -0x1.094CF3F5798ECp-7, -0x1.695514313DADCp-7, -0x1.EED7D3A59E032p-7,
+		  -0x1.F06CA4583E35Dp-11, -0x1.33DFBD59AA8B7p-11, -0x1.D4509F51F197Fp-13, -0x1.AA52EE21A9F0Dp-15, -0x1.BDE88C0FDC42Dp-18, -0x1.F639062194D78p-22, -0x1.1295B6DA0B21Bp-26, -0x1.E93A4AFFF2FD9p-33, -0x1.FB53847513CA8p-41, -0x1.0744AE8E65A58p-51 },
+		{ 0x1.0F2E2D497E958p-20, 0x1.32484E66D7BD6p-17, 0x1.ACD3E6CD4322Bp-16, 0x1.A989631B2ABE8p-15, 0x1.65F30A948C75Fp-14, 0x1.11BE80941D699p-13, 0x1.8A7E96094C240p-13, 0x1.11DAA1E5EDE72p-12, 0x1.74FB21AB8A5A2p-12, 0x1.FECB1A803D456p-12,
+		  0x1.8052AB5AFDD60p-16, 0x1.DCB56A9BA0476p-17, 0x1.6A9425F474DEEp-18, 0x1.4A15F1EEB956Dp-20, 0x1.59468D4A57C61p-23, 0x1.84EC55E35DC51p-27, 0x1.A9585950C5DFDp-32, 0x1.7B0188087CB1Fp-38, 0x1.892C550EA2D3Ap-46, 0x1.985BF7EA2FBEAp-57 },
+		{ -0x1.17E218096F6B9p-25, -0x1.3C1C803CBB35Ep-22, -0x1.BA9686B2DA191p-21, -0x1.B7307AC67F87Ep-20, -0x1.716E66815EF9Cp-19, -0x1.1A85BA192D516p-18, -0x1.9723B069EBCABp-18, -0x1.1AA05AFC4F54Bp-17, -0x1.80EA876FA6EE2p-17, -0x1.078D4AF449099p-16,
+		  -0x1.4A8706B38D555p-21, -0x1.9A144011271B3p-22, -0x1.380E1B0BDB077p-23, -0x1.1C505F4CA2B62p-25, -0x1.29BDA588689AFp-28, -0x1.4FEE208937704p-32, -0x1.7040D927A001Ap-37, -0x1.494820858CC1Ep-43, -0x1.5786D29B7A280p-51, -0x1.68CD33BD64DD5p-62 },
+		{ 0x1.207A8F6FCC555p-30, 0x1.45D0B9FB5E4CDp-27, 0x1.C8299554C7CCDp-26, 0x1.C4A3E86501666p-25, 0x1.7CB8C92C302ABp-24, 0x1.2321764ED2E66p-23, 0x1.A37D8F06B2CCDp-23, 0x1.2324B8BBFA444p-22, 0x1.8C635E24B5800p-22, 0x1.0F3A5D77C4A22p-21,
+		  0x1.29D95C3DFB777p-26, 0x1.72762096E2889p-27, 0x1.1B5E886280AABp-28, 0x1.044E8EB7DFDDEp-30, 0x1.13DD621529BBCp-33, 0x1.3C7ECE1369555p-37, 0x1.6332797307777p-42, 0x1.489ABB182F333p-48, 0x1.697AB16D00889p-56, 0x1.A2B11CA8CA889p-67 },
+		{ -0x1.268AC7504CCCDp-35, -0x1.4CA1835DCCCCDp-32, -0x1.D19C3D129DDDEp-31, -0x1.CDDD730A6AAABp-30, -0x1.844B7D28F3333p-29, -0x1.28B7AFCFBDDDEp-28, -0x1.AB1D2CD522222p-28, -0x1.27FC63D2C0000p-27, -0x1.91F656E12AAABp-27, -0x1.1196207CE4444p-26,
+		  -0x1.0FA07E2591111p-31, -0x1.58B1FBEDF7777p-32, -0x1.1274B337EEEEFp-33, -0x1.0BC7EB1A11111p-35, -0x1.33AA2834EEEEFp-38, -0x1.87064C656EEEFp-42, -0x1.F1F020FADDDDEp-47, -0x1.0D14CD6A1999Ap-52, -0x1.6848FA362EEEFp-60, -0x1.11DA88BEEAAABp-70 },
+		{ 0x1.1C19BADA66666p-40, 0x1.40A3100333333p-37, 0x1.C0398FE5DDDDEp-36, 0x1.BBA984B911111p-35, 0x1.73CDF40666666p-34, 0x1.1ACEB06AEEEEFp-33, 0x1.9457B7DDDDDDEp-33, 0x1.154A703800000p-32, 0x1.71DE6474CCCCDp-32, 0x1.E3DE27FAAAAABp-32,
+		  0x1.C36CD09777777p-37, 0x1.480135DCCCCCDp-37, 0x1.456BEC2AAAAABp-38, 0x1.974062C444444p-40, 0x1.2A86C14333333p-42, 0x1.DAC5D9D99999Ap-46, 0x1.719B5D7E22222p-50, 0x1.DE3EB19A22222p-56, 0x1.79652A7DDDDDEp-63, 0x1.51253F7066666p-73 },
+		{ -0x1.5B58166666666p-46, -0x1.869AD77777777p-43, -0x1.0DA79DDDDDDDEp-41, -0x1.055F5E2222222p-40, -0x1.A8BCA2AAAAAABp-40, -0x1.340D100000000p-39, -0x1.98A8808888889p-39, -0x1.EBFD288888889p-39, -0x1.EF5CEEEEEEEEFp-39, -0x1.3BAD955555555p-40,
+		  0x1.2E18222222222p-46, -0x1.D328DDDDDDDDEp-43, -0x1.1B266B3333333p-42, -0x1.0F34C51111111p-43, -0x1.F7234B3333333p-46, -0x1.CE42D5BBBBBBCp-49, -0x1.8B511FAAAAAABp-53, -0x1.1193018000000p-58, -0x1.C730CFBBBBBBCp-66, -0x1.AC193DC888889p-76 },
+		{ 0x1.02C3755555555p-49, 0x1.1C04EEEEEEEEFp-46, 0x1.80EFD9999999Ap-45, 0x1.7156155555555p-44, 0x1.2539666666666p-43, 0x1.9C11488888889p-43, 0x1.FF76111111111p-43, 0x1.0B87D55555555p-42, 0x1.37E7222222222p-43, -0x1.AB18777777777p-42,
+		  0x1.0BA35BBBBBBBCp-43, 0x1.C987E44444444p-44, 0x1.18E8E00000000p-44, 0x1.9620AAAAAAAABp-46, 0x1.4C95F9999999Ap-48, 0x1.1AA935DDDDDDEp-51, 0x1.D1439F3333333p-56, 0x1.39F5695555555p-61, 0x1.02784CEEEEEEFp-68, 0x1.E9F49D7777777p-79 },
+		{ -0x1.C115D11111111p-49, -0x1.EDD9444444444p-46, -0x1.58D699999999Ap-44, -0x1.571FC00000000p-43, -0x1.1E66622222222p-42, -0x1.B401044444444p-42, -0x1.37752AAAAAAABp-41, -0x1.ABAE6EEEEEEEFp-41, -0x1.1C3B6EEEEEEEFp-40, -0x1.703B844444444p-40,
+		  -0x1.A59F222222222p-43, -0x1.0D39C00000000p-43, -0x1.B10FBBBBBBBBCp-45, -0x1.A96EA66666666p-47, -0x1.FCBC6AAAAAAABp-50, -0x1.44284EEEEEEEFp-53, -0x1.B345F33333333p-58, -0x1.E01B200000000p-64, -0x1.5645466666666p-71, -0x1.1F0AE9999999Ap-81 },
+		{ -0x1.2271311111111p-48, -0x1.442E2AAAAAAABp-45, -0x1.C33AD9999999Ap-44, -0x1.C08B9DDDDDDDEp-43, -0x1.796F111111111p-42, -0x1.219D688888889p-41, -0x1.A1AC444444444p-41, -0x1.225F511111111p-40, -0x1.8C4E622222222p-40, -0x1.100D622222222p-39,
+		  -0x1.0AD9ECCCCCCCDp-42, -0x1.45CD977777777p-43, -0x1.F6293BBBBBBBCp-45, -0x1.BE9E666666666p-47, -0x1.D707888888889p-50, -0x1.FD73E66666666p-54, -0x1.0FD41BBBBBBBCp-58, -0x1.C9D6A22222222p-65, -0x1.A5BE3BBBBBBBCp-73, -0x1.7742088888889p-84 },
+		{ 0x1.3FC3444444444p-49, 0x1.5E50888888889p-46, 0x1.E9E2AAAAAAAABp-45, 0x1.E932000000000p-44, 0x1.999F99999999Ap-43, 0x1.3981AAAAAAAABp-42, 0x1.C39C444444444p-42, 0x1.3A5399999999Ap-41, 0x1.AB93777777777p-41, 0x1.250D000000000p-40,
+		  0x1.20F8444444444p-43, 0x1.66DECCCCCCCCDp-44, 0x1.10F2EEEEEEEEFp-45, 0x1.EACFDDDDDDDDEp-48, 0x1.085DEEEEEEEEFp-50, 0x1.1E8FCCCCCCCCDp-54, 0x1.47C2444444444p-59, 0x1.141ADDDDDDDDEp-65, 0x1.2298222222222p-73, 0x1.2852000000000p-84 },
+		{ 0x1.C339777777777p-49, 0x1.F817333333333p-46, 0x1.5F04EEEEEEEEFp-44, 0x1.5CACAAAAAAAABp-43, 0x1.2551333333333p-42, 0x1.C1E0666666666p-42, 0x1.4442222222222p-41, 0x1.C22C888888889p-41, 0x1.32B4CCCCCCCCDp-40, 0x1.A33C444444444p-40,
+		  0x1.A04A888888889p-43, 0x1.FD7C666666666p-44, 0x1.8A4999999999Ap-45, 0x1.6172EEEEEEEEFp-47, 0x1.77D1555555555p-50, 0x1.9FFD111111111p-54, 0x1.C41E888888889p-59, 0x1.9199DDDDDDDDEp-65, 0x1.92DE222222222p-73, 0x1.B8F6EEEEEEEEFp-84 },
+		{ -0x1.4861111111111p-51, -0x1.6522222222222p-48, -0x1.F337777777777p-47, -0x1.F360000000000p-46, -0x1.A1B1111111111p-45, -0x1.3FA7777777777p-44, -0x1.CC62222222222p-44, -0x1.40ACCCCCCCCCDp-43, -0x1.B3D1111111111p-43, -0x1.2A6DDDDDDDDDEp-42,
+		  -0x1.26FDDDDDDDDDEp-45, -0x1.6E9999999999Ap-46, -0x1.1722222222222p-47, -0x1.F502222222222p-50, -0x1.1007777777777p-52, -0x1.253CCCCCCCCCDp-56, -0x1.54B5555555555p-61, -0x1.1BC1111111111p-67, -0x1.302EEEEEEEEEFp-75, -0x1.4020000000000p-86 },
+		{ -0x1.132C444444444p-50, -0x1.33C2222222222p-47, -0x1.ACD4444444444p-46, -0x1.A9CDDDDDDDDDEp-45, -0x1.6633333333333p-44, -0x1.12A9111111111p-43, -0x1.8C00000000000p-43, -0x1.12CBBBBBBBBBCp-42, -0x1.7683333333333p-42, -0x1.FFFDDDDDDDDDEp-42,
+		  -0x1.FC47777777777p-45, -0x1.3723BBBBBBBBCp-45, -0x1.E164444444444p-47, -0x1.AFB3333333333p-49, -0x1.CA44444444444p-52, -0x1.FD4AAAAAAAAABp-56, -0x1.136B333333333p-60, -0x1.ECA8888888889p-67, -0x1.ED2CCCCCCCCCDp-75, -0x1.0CEBBBBBBBBBCp-85 }
+	},
+	{
+		{ 0x1.DE26B23ADA34Ep-11, 0x1.0E05A00859460p-7, 0x1.7A0F30A90E946p-6, 0x1.77287439DA00Cp-5, 0x1.3B928C7F6A1FDp-4, 0x1.E2AC2EF77A595p-4, 0x1.5BCAAB49AF5FCp-3, 0x1.E2DE1BE1E1065p-3, 0x1.48D391FF607C0p-2, 0x1.C2539596DFBF9p-2,
+		  0x1.D21C4E0E72551p-5, 0x1.2112DD31329F7p-5, 0x1.B7B77D4EC8DBCp-7, 0x1.904A0728109AFp-9, 0x1.A2AD267A9E0DBp-12, 0x1.D78CAF50934B4p-16, 0x1.01D021C6091FBp-20, 0x1.CB575CBF3BCF3p-27, 0x1.DC53CAE3F6779p-35, 0x1.EE599CDF014B2p-46 },
+		{ -0x1.CFA965690F531p-16, -0x1.05D6E7D932C37p-12, -0x1.6E9A5C6FEA6D1p-11, -0x1.6BCA21D03FCDFp-10, -0x1.32027794E8E73p-9, -0x1.D40BCE9F753C7p-9, -0x1.5140A4B24466Ap-8, -0x1.D43C37F46F89Dp-8, -0x1.3EDCAAFBE4EF4p-7, -0x1.B4AE21C322C8Dp-7,
+		  -0x1.C3FC6958A38E3p-11, -0x1.18505A6FFFE1Bp-11, -0x1.AA645D7D11A37p-13, -0x1.8428C8106A805p-15, -0x1.95FD4A3E16B0Ep-18, -0x1.C942B406D5FEAp-22, -0x1.F4006D21C9147p-27, -0x1.BD6C382663F7Dp-33, -0x1.CDE50499C89C9p-41, -0x1.DF5F4B57FA60Ap-52 },
+		{ 0x1.C19C5FB82D184p-21, 0x1.FBCF2EBF92CDDp-18, 0x1.637E4DEDC4F26p-16, 0x1.60C3E616157D0p-15, 0x1.28BC7AE745FD8p-14, 0x1.C5DCC0CE40ACAp-14, 0x1.4708440D6CC13p-13, 0x1.C60BAC6E28A72p-13, 0x1.3532EFFBCA08Cp-12, 0x1.A77253CEFEC95p-12,
+		  0x1.48B775DA72134p-16, 0x1.97BAB4F4C9154p-17, 0x1.361AB10D98319p-18, 0x1.1A4CC4C85BF8Dp-20, 0x1.2744F52262834p-23, 0x1.4C8FAE5908BE3p-27, 0x1.6BA6C6A9D1E06p-32, 0x1.43F675B956B7Fp-38, 0x1.4FF4288DAC9C0p-46, 0x1.5CAFE9D197D24p-57 },
+		{ -0x1.B3FAAB526D915p-26, -0x1.EC69BF8508906p-23, -0x1.58B71199D924Dp-21, -0x1.5611CD3FEA617p-20, -0x1.1FBD3983F2C49p-19, -0x1.B819CB4EAF893p-19, -0x1.3D1DAF2721D91p-18, -0x1.B846F30C1FC5Ap-18, -0x1.2BD26CB7C6742p-17, -0x1.9A9A3E98CA9A2p-17,
+		  -0x1.099FA82F6751Ap-21, -0x1.497A94920190Dp-22, -0x1.F5346173C4C55p-24, -0x1.C84D658341966p-26, -0x1.DD524AE42CE55p-29, -0x1.0CD8EDF120EAFp-32, -0x1.260CD0EBE4EE6p-37, -0x1.060C47CF1119Ap-43, -0x1.0FE595703FE2Bp-51, -0x1.1A8034BC7C6C0p-62 },
+		{ 0x1.A6B215BE1CDDEp-31, 0x1.DD68D2241599Ap-28, 0x1.4E35FA11E0333p-26, 0x1.4BA4F776A3444p-25, 0x1.16F7CED006800p-24, 0x1.AAAE61ACE8DDEp-24, 0x1.33713CF5C8777p-23, 0x1.AAD68B1FB5555p-23, 0x1.22A92FF0AB222p-22, 0x1.8E081687D6AABp-22,
+		  0x1.C2A2D76BBFBBCp-27, 0x1.1790592FAB111p-27, 0x1.A986A75CF2EEFp-29, 0x1.83C51F4CCE889p-31, 0x1.9631257B89111p-34, 0x1.CA768B3EF2EEFp-38, 0x1.F6D603FD9B333p-43, 0x1.C1F302D503777p-49, 0x1.D5EBE3314B333p-57, 0x1.EE6EF6ABC2AABp-68 },
+		{ -0x1.9952EF2CD1111p-36, -0x1.CE4D421151111p-33, -0x1.43A0800273333p-31, -0x1.41212B86D1111p-30, -0x1.0E1BB28D8CCCDp-29, -0x1.9D18E601D1111p-29, -0x1.299EDEFD40000p-28, -0x1.9D21BD6066666p-28, -0x1.193FE4B6A2222p-27, -0x1.80EE76B722222p-27,
+		  -0x1.88646BB4AAAABp-32, -0x1.E81F02BE9999Ap-33, -0x1.757923B222222p-34, -0x1.5738FC4022222p-36, -0x1.6BF17EF69999Ap-39, -0x1.A1D6DC6722222p-43, -0x1.D5508C01AAAABp-48, -0x1.B28546BC55555p-54, -0x1.DE2BA366EEEEFp-62, -0x1.145BFB4B08889p-72 },
+		{ 0x1.88BF96B3BBBBCp-41, 0x1.BB88F47111111p-38, 0x1.366F4E16EEEEFp-36, 0x1.33F503F222222p-35, 0x1.02ED628333333p-34, 0x1.8BC6A7919999Ap-34, 0x1.1CE97744CCCCDp-33, 0x1.8B01E67E66666p-33, 0x1.0C60547911111p-32, 0x1.6DD3EAC555555p-32,
+		  0x1.5514FD599999Ap-37, 0x1.B06F6B1555555p-38, 0x1.579628CCCCCCDp-39, 0x1.4E4230B333333p-41, 0x1.7E67ED9555555p-44, 0x1.E39A348888889p-48, 0x1.31BDD66333333p-52, 0x1.47AAEE8000000p-58, 0x1.B115C2D444444p-66, 0x1.41B9F10088889p-76 },
+		{ -0x1.4250511111111p-46, -0x1.6B49E33333333p-43, -0x1.FC2F11999999Ap-42, -0x1.F6FCEC4444444p-41, -0x1.A5CCD4CCCCCCDp-40, -0x1.41163E6666666p-39, -0x1.CB8E0F7777777p-39, -0x1.3B9102AAAAAABp-38, -0x1.A68D033333333p-38, -0x1.1702811111111p-37,
+		  -0x1.FB87000000000p-44, -0x1.A270400000000p-44, -0x1.DFF4EEEEEEEEFp-45, -0x1.5245444444444p-46, -0x1.0ADD708888889p-48, -0x1.C1EE811111111p-52, -0x1.6824600000000p-56, -0x1.DF5E84CCCCCCDp-62, -0x1.7CB30F3333333p-69, -0x1.517B9C6666666p-79 },
+		{ 0x1.877AB55555555p-49, 0x1.C27BD55555555p-46, 0x1.3CA2711111111p-44, 0x1.394CE66666666p-43, 0x1.0692044444444p-42, 0x1.8F3A5BBBBBBBCp-42, 0x1.1CF1355555555p-41, 0x1.8A00F9999999Ap-41, 0x1.06C2F55555555p-40, 0x1.5A3EF33333333p-40,
+		  0x1.4BFD155555555p-43, 0x1.A37BD9999999Ap-44, 0x1.5C87800000000p-45, 0x1.58A7CCCCCCCCDp-47, 0x1.A97A5DDDDDDDEp-50, 0x1.10FF19999999Ap-53, 0x1.8264B88888889p-58, 0x1.9F38E22222222p-64, 0x1.2C1A0C4444444p-71, 0x1.E5D4F4CCCCCCDp-82 },
+		{ -0x1.AD46C44444444p-49, -0x1.EB3C622222222p-46, -0x1.56856EEEEEEEFp-44, -0x1.5505D11111111p-43, -0x1.1E2E888888889p-42, -0x1.B52FF33333333p-42, -0x1.3AF53BBBBBBBCp-41, -0x1.B71BD55555555p-41, -0x1.2973B77777777p-40, -0x1.94F2444444444p-40,
+		  -0x1.A0D16EEEEEEEFp-43, -0x1.035CA00000000p-43, -0x1.8EB4911111111p-45, -0x1.6C2C911111111p-47, -0x1.8CDF555555555p-50, -0x1.BA5DC00000000p-54, -0x1.06E4C88888889p-58, -0x1.C01E000000000p-65, -0x1.03CBD9999999Ap-72, -0x1.429E022222222p-83 },
+		{ -0x1.0464022222222p-48, -0x1.2CEFB33333333p-45, -0x1.A768F33333333p-44, -0x1.A3CD888888889p-43, -0x1.6120BBBBBBBBCp-42, -0x1.0DB46CCCCCCCDp-41, -0x1.83A5D11111111p-41, -0x1.0EED933333333p-40, -0x1.6FE39DDDDDDDEp-40, -0x1.F7E24CCCCCCCDp-40,
+		  -0x1.0234955555555p-42, -0x1.3ADCD11111111p-43, -0x1.E639333333333p-45, -0x1.AF72088888889p-47, -0x1.D15E222222222p-50, -0x1.EEEADDDDDDDDEp-54, -0x1.27CF466666666p-58, -0x1.CD2E333333333p-65, -0x1.F1E7EAAAAAAABp-73, -0x1.FF1FA66666666p-84 },
+		{ 0x1.1F14222222222p-49, 0x1.495DCCCCCCCCDp-46, 0x1.CB68000000000p-45, 0x1.C9D9777777777p-44, 0x1.8022666666666p-43, 0x1.2583444444444p-42, 0x1.A751111111111p-42, 0x1.27D2CCCCCCCCDp-41, 0x1.916C222222222p-41, 0x1.127F777777777p-40,
+		  0x1.1766888888889p-43, 0x1.5ACBEEEEEEEEFp-44, 0x1.0804222222222p-45, 0x1.DB8C000000000p-48, 0x1.0036CCCCCCCCDp-50, 0x1.13EABBBBBBBBCp-54, 0x1.4130AAAAAAAABp-59, 0x1.F36AAAAAAAAABp-66, 0x1.0CE0222222222p-73, 0x1.205499999999Ap-84 },
+		{ 0x1.974FDDDDDDDDEp-49, 0x1.D675555555555p-46, 0x1.4A9DBBBBBBBBCp-44, 0x1.47C6AAAAAAAABp-43, 0x1.13C7DDDDDDDDEp-42, 0x1.A54ACCCCCCCCDp-42, 0x1.2ED4222222222p-41, 0x1.A6FCEEEEEEEEFp-41, 0x1.1F34AAAAAAAABp-40, 0x1.892D99999999Ap-40,
+		  0x1.9354444444444p-43, 0x1.ECE6666666666p-44, 0x1.7C1B777777777p-45, 0x1.5272000000000p-47, 0x1.6C56666666666p-50, 0x1.86D0444444444p-54, 0x1.D020222222222p-59, 0x1.7047333333333p-65, 0x1.8F35333333333p-73, 0x1.A296CCCCCCCCDp-84 },
+		{ -0x1.23EEEEEEEEEEFp-51, -0x1.502999999999Ap-48, -0x1.D4DDDDDDDDDDEp-47, -0x1.D3B5555555555p-46, -0x1.8815555555555p-45, -0x1.2B7CCCCCCCCCDp-44, -0x1.B000000000000p-44, -0x1.2E57777777777p-43, -0x1.99E8888888889p-43, -0x1.182EEEEEEEEEFp-42,
+		  -0x1.1D28888888889p-45, -0x1.6276666666666p-46, -0x1.0D4AAAAAAAAABp-47, -0x1.E42EEEEEEEEEFp-50, -0x1.06DBBBBBBBBBCp-52, -0x1.18C5555555555p-56, -0x1.4B5DDDDDDDDDEp-61, -0x1.F3E2222222222p-68, -0x1.103999999999Ap-75, -0x1.279AAAAAAAAABp-86 },
+		{ -0x1.F205555555555p-51, -0x1.1F64444444444p-47, -0x1.93A3333333333p-46, -0x1.902AAAAAAAAABp-45, -0x1.50BBBBBBBBBBCp-44, -0x1.013D555555555p-43, -0x1.71E7777777777p-43, -0x1.0238000000000p-42, -0x1.5EBCCCCCCCCCDp-42, -0x1.E024444444444p-42,
+		  -0x1.EC4AAAAAAAAABp-45, -0x1.2D4DDDDDDDDDEp-45, -0x1.CFF7777777777p-47, -0x1.9DC2222222222p-49, -0x1.BC73333333333p-52, -0x1.DEAEEEEEEEEEFp-56, -0x1.1A35DDDDDDDDEp-60, -0x1.C373333333333p-67, -0x1.E776666666666p-75, -0x1.FF36666666666p-86 }
+	},
+	{
+		{ 0x1.C2D4072A010EDp-11, 0x1.FD2F2DD038DFBp-8, 0x1.6474B8E0BF3A2p-6, 0x1.61B86D9C92DE6p-5, 0x1.298A2CB8AE79Bp-4, 0x1.C7175F8544C9Ap-4, 0x1.47EAF94CD9F89p-3, 0x1.C746721A9778Fp-3, 0x1.36094F2C79272p-2, 0x1.A897F37F02281p-2,
+		  0x1.C498E45A2785Bp-5, 0x1.18B16567F6F68p-5, 0x1.AAF7F7C6B384Cp-7, 0x1.84AF21F677513p-9, 0x1.9689C98DE8E40p-12, 0x1.C9E0E74267B93p-16, 0x1.F4AD5A0560F68p-21, 0x1.BE063014414A8p-27, 0x1.CE848C5B2FA6Cp-35, 0x1.E0049A6FB5AEEp-46 },
+		{ -0x1.9C2F916AF577Ep-16, -0x1.D18A3865AFD11p-13, -0x1.45E70F58F8E0Ep-11, -0x1.4366CA880B855p-10, -0x1.10094D62C9572p-9, -0x1.A0155E87A0CB7p-9, -0x1.2BCF84C197D2Ep-8, -0x1.A040683067B5Ap-8, -0x1.1B7639A81D7FEp-7, -0x1.84332799EDBE9p-7,
+		  -0x1.9DCD9D7CC85CEp-11, -0x1.00A230D548529p-11, -0x1.865F0E9FE4F80p-13, -0x1.635E4B66529A7p-15, -0x1.73B12E36E21DEp-18, -0x1.A2A1BF2FD3274p-22, -0x1.C9C3135B48A45p-27, -0x1.97CB28895B0AAp-33, -0x1.A6DF9C7141ECEp-41, -0x1.B6DFAD9EE5A07p-52 },
+		{ 0x1.78DB0659A7C48p-21, 0x1.A9A2EF29DBBD2p-18, 0x1.29F7D1B10B36Fp-16, 0x1.27AE6E2CD3E33p-15, 0x1.F1701541DEFC9p-15, 0x1.7C6B4C8AA5BE2p-14, 0x1.121CCF2F58285p-13, 0x1.7C92A5738D9D5p-13, 0x1.032A411875B22p-12, 0x1.62ECED51CA64Ep-12,
+		  0x1.1BC02F7F6F59Dp-16, 0x1.5FF4606DD17AAp-17, 0x1.0BAEE9C939A73p-18, 0x1.E75CD32394212p-21, 0x1.FDBFF191439A5p-24, 0x1.1F0FF828D03F4p-27, 0x1.39E518722D722p-32, 0x1.17A194D50634Dp-38, 0x1.21F8F1A2F0361p-46, 0x1.2CF20BE661A2Ep-57 },
+		{ -0x1.588D9C1610944p-26, -0x1.85271C00D92C2p-23, -0x1.106D723005B7Ep-21, -0x1.0E563B5D8E6B3p-20, -0x1.C6CCB1C3505D3p-20, -0x1.5BCFABCDFFA1Ap-19, -0x1.F53BC5B38C0B7p-19, -0x1.5BF39FB710564p-18, -0x1.D9E69C14F9F5Ap-18, -0x1.4480A31086300p-17,
+		  -0x1.B06195C8FD489p-22, -0x1.0C27EA7F0AD91p-22, -0x1.97E67112B9909p-24, -0x1.7354054FD7C2Bp-26, -0x1.8463A86F260C4p-29, -0x1.B571BCAEE9B00p-33, -0x1.DE57DA63C1880p-38, -0x1.AA243785C5311p-44, -0x1.B9EBE95078389p-52, -0x1.CAAF3BE9ECED5p-63 },
+		{ 0x1.3B03CBF612889p-31, 0x1.63CA785054333p-28, 0x1.F2250F8101555p-27, 0x1.EE52591ACEEEFp-26, 0x1.9FCF2FABE799Ap-25, 0x1.3DFE2C535D333p-24, 0x1.CA42F02784AABp-24, 0x1.3E1ECDCDA1EEFp-23, 0x1.B1452886BFEEFp-23, 0x1.28ADDE0F2C666p-22,
+		  0x1.59E56C0F1A222p-27, 0x1.AD0CF94381DDEp-28, 0x1.46570EECFC444p-29, 0x1.291BB80489777p-31, 0x1.36CD19545F555p-34, 0x1.5E1F87E0CEAABp-38, 0x1.7EF608D460CCDp-43, 0x1.554D817753333p-49, 0x1.62293908B8889p-57, 0x1.700680EBF2222p-68 },
+		{ -0x1.1FFB59FFD5555p-36, -0x1.454223DC66666p-33, -0x1.C7651883D5555p-32, -0x1.C3E5ED303BBBCp-31, -0x1.7C1F28EDB3333p-30, -0x1.22B2BFA55999Ap-29, -0x1.A2EC1B15BBBBCp-29, -0x1.22CE7F3AC0000p-28, -0x1.8C0F2A44DDDDEp-28, -0x1.0F2F7817C0000p-27,
+		  -0x1.1C98F885BBBBCp-32, -0x1.611DA6B355555p-33, -0x1.0CBD98EEEEEEFp-34, -0x1.E9CB096B11111p-37, -0x1.0087F753CCCCDp-39, -0x1.218A77D966666p-43, -0x1.3D8E4A0BDDDDEp-48, -0x1.1C22F9F077777p-54, -0x1.28B0BF6C88889p-62, -0x1.37F67DF500000p-73 },
+		{ 0x1.0698279BBBBBCp-41, 0x1.289312E222222p-38, 0x1.9F3A75999999Ap-37, 0x1.9C0692B666666p-36, 0x1.5A90A37222222p-35, 0x1.0905A36B33333p-34, 0x1.7DE2CD6222222p-34, 0x1.090FA59CCCCCDp-33, 0x1.68EBD00444444p-33, 0x1.EE0D15A444444p-33,
+		  0x1.D8CD72E222222p-38, 0x1.25FE239333333p-38, 0x1.C1955C4000000p-40, 0x1.9CC7F93333333p-42, 0x1.B54867E222222p-45, 0x1.F4D7D6EAAAAABp-49, 0x1.1889BDE666666p-53, 0x1.02B6940444444p-59, 0x1.1AC1606888889p-67, 0x1.427774BDDDDDEp-78 },
+		{ -0x1.943ACCCCCCCCDp-47, -0x1.C861A11111111p-44, -0x1.3F7719999999Ap-42, -0x1.3CE57BBBBBBBCp-41, -0x1.0A8034CCCCCCDp-40, -0x1.975CDCCCCCCCDp-40, -0x1.2547C9999999Ap-39, -0x1.96B76DDDDDDDEp-39, -0x1.146EA00000000p-38, -0x1.791BDBBBBBBBCp-38,
+		  -0x1.B34E777777777p-45, -0x1.1EAFE66666666p-45, -0x1.EDFF111111111p-47, -0x1.0A9B222222222p-48, -0x1.554C19999999Ap-51, -0x1.E3E2222222222p-55, -0x1.587F99999999Ap-59, -0x1.98E3D11111111p-65, -0x1.2B01688888889p-72, -0x1.E73DD55555555p-83 },
+		{ 0x1.69BD488888889p-49, 0x1.A0084CCCCCCCDp-46, 0x1.2298622222222p-44, 0x1.20F3466666666p-43, 0x1.E7E6D11111111p-43, 0x1.72D6B55555555p-42, 0x1.0B63DDDDDDDDEp-41, 0x1.73F1488888889p-41, 0x1.F904888888889p-41, 0x1.58E5BBBBBBBBCp-40,
+		  0x1.4351D33333333p-43, 0x1.91E6E88888889p-44, 0x1.386CDBBBBBBBCp-45, 0x1.20FA1DDDDDDDEp-47, 0x1.2329D77777777p-50, 0x1.66986CCCCCCCDp-54, 0x1.8FC31DDDDDDDEp-59, 0x1.6B4E911111111p-65, 0x1.9CA0422222222p-73, 0x1.E9BCFDDDDDDDEp-84 },
+		{ -0x1.9A87444444444p-49, -0x1.D059C88888889p-46, -0x1.4492EAAAAAAABp-44, -0x1.4291CCCCCCCCDp-43, -0x1.0F01755555555p-42, -0x1.9E84CCCCCCCCDp-42, -0x1.2AC6622222222p-41, -0x1.9EDC844444444p-41, -0x1.1A5F400000000p-40, -0x1.82A5777777777p-40,
+		  -0x1.9522444444444p-43, -0x1.F6FFA22222222p-44, -0x1.7F18A66666666p-45, -0x1.5C9EF33333333p-47, -0x1.6DA12EEEEEEEFp-50, -0x1.9EDE088888889p-54, -0x1.C6822EEEEEEEFp-59, -0x1.971DAAAAAAAABp-65, -0x1.AAD33BBBBBBBCp-73, -0x1.C1C36AAAAAAABp-84 },
+		{ -0x1.E9E919999999Ap-49, -0x1.1B4ECCCCCCCCDp-45, -0x1.8BB1888888889p-44, -0x1.8979C88888889p-43, -0x1.4C91FBBBBBBBCp-42, -0x1.F95F9DDDDDDDEp-42, -0x1.6C9FA22222222p-41, -0x1.FBDFA22222222p-41, -0x1.5936F77777777p-40, -0x1.D8E1CCCCCCCCDp-40,
+		  -0x1.F1992EEEEEEEFp-43, -0x1.33C03DDDDDDDEp-43, -0x1.DB801DDDDDDDEp-45, -0x1.B2D1AAAAAAAABp-47, -0x1.ADD00CCCCCCCDp-50, -0x1.032E755555555p-53, -0x1.1852E22222222p-58, -0x1.E34F333333333p-65, -0x1.00517DDDDDDDEp-72, -0x1.0C91533333333p-83 },
+		{ 0x1.11F1DDDDDDDDEp-49, 0x1.35D1444444444p-46, 0x1.B0A399999999Ap-45, 0x1.AE6D555555555p-44, 0x1.6983666666666p-43, 0x1.146EAAAAAAAABp-42, 0x1.8E9B111111111p-42, 0x1.14E6111111111p-41, 0x1.78E4666666666p-41, 0x1.021E222222222p-40,
+		  0x1.0F0D99999999Ap-43, 0x1.4FFB111111111p-44, 0x1.0015000000000p-45, 0x1.D122CCCCCCCCDp-48, 0x1.E67B111111111p-51, 0x1.13EE888888889p-54, 0x1.2D54BBBBBBBBCp-59, 0x1.0A8BBBBBBBBBCp-65, 0x1.1591333333333p-73, 0x1.1FC5AAAAAAAABp-84 },
+		{ 0x1.7E7D111111111p-49, 0x1.BB05111111111p-46, 0x1.3560888888889p-44, 0x1.338A888888889p-43, 0x1.03F2CCCCCCCCDp-42, 0x1.8B1D777777777p-42, 0x1.1D08888888889p-41, 0x1.8CF5DDDDDDDDEp-41, 0x1.0DD8AAAAAAAABp-40, 0x1.719DDDDDDDDDEp-40,
+		  0x1.84EF555555555p-43, 0x1.E0B4AAAAAAAABp-44, 0x1.7383111111111p-45, 0x1.53A2888888889p-47, 0x1.5053777777777p-50, 0x1.949E000000000p-54, 0x1.B658000000000p-59, 0x1.7A66EEEEEEEEFp-65, 0x1.90F4222222222p-73, 0x1.A490EEEEEEEEFp-84 },
+		{ -0x1.17D999999999Ap-51, -0x1.3C6BBBBBBBBBCp-48, -0x1.B94AAAAAAAAABp-47, -0x1.B78CCCCCCCCCDp-46, -0x1.710999999999Ap-45, -0x1.1A20000000000p-44, -0x1.96E8888888889p-44, -0x1.1ACBBBBBBBBBCp-43, -0x1.80CAAAAAAAAABp-43, -0x1.0782222222222p-42,
+		  -0x1.14DDDDDDDDDDEp-45, -0x1.56BDDDDDDDDDEp-46, -0x1.05B0000000000p-47, -0x1.DB0AAAAAAAAABp-50, -0x1.F03999999999Ap-53, -0x1.1A55555555555p-56, -0x1.3463333333333p-61, -0x1.0F0EEEEEEEEEFp-67, -0x1.1B13333333333p-75, -0x1.2656666666666p-86 },
+		{ -0x1.D2D3333333333p-51, -0x1.0E91111111111p-47, -0x1.79E2222222222p-46, -0x1.7790000000000p-45, -0x1.3D6DDDDDDDDDEp-44, -0x1.E29EEEEEEEEEFp-44, -0x1.5C20000000000p-43, -0x1.E4BDDDDDDDDDEp-43, -0x1.498EEEEEEEEEFp-42, -0x1.C366666666666p-42,
+		  -0x1.DAF6666666666p-45, -0x1.255A222222222p-45, -0x1.C583333333333p-47, -0x1.9E62222222222p-49, -0x1.9B14444444444p-52, -0x1.ED50000000000p-56, -0x1.0B50000000000p-60, -0x1.CE6AAAAAAAAABp-67, -0x1.E8F2222222222p-75, -0x1.0032AAAAAAAABp-85 }
+	},
+	{
+		{ 0x1.AA758A3D06524p-11, 0x1.E1A92B56DF2E4p-8, 0x1.5130248200B71p-6, 0x1.4E99B3CBE6280p-5, 0x1.1974DE3289A41p-4, 0x1.AE7DE4BCF0B5Cp-4, 0x1.36314CB0F1267p-3, 0x1.AEAA6BF054AE1p-3, 0x1.2547138B74FE8p-2, 0x1.91A47E8DBFBF2p-2,
+		  0x1.B831E83F553B4p-5, 0x1.1100535C5EAEBp-5, 0x1.9F44C4C57396Ap-7, 0x1.7A088024A0054p-9, 0x1.8B65E86F2B197p-12, 0x1.BD54DEBB2C563p-16, 0x1.E6F515A0CA7B5p-21, 0x1.B1CD5028DE7D2p-27, 0x1.C1D7F869BD32Bp-35, 0x1.D2DD42B694F95p-46 },
+		{ -0x1.70D45BE02DA32p-16, -0x1.A0924EFD3C763p-13, -0x1.239F4229FA1BBp-11, -0x1.2162564E31D7Ep-10, -0x1.E6D7FCDF913DEp-10, -0x1.74513485F594Ep-9, -0x1.0C465028FB1FBp-8, -0x1.7477B74A625EBp-8, -0x1.FB4A82A9010BFp-8, -0x1.5B5DD539E332Fp-7,
+		  -0x1.7CB58A9635C37p-11, -0x1.D837EA2362A76p-12, -0x1.6726B807D9BB7p-13, -0x1.46F2985E3D0BAp-15, -0x1.55F7459EB5051p-18, -0x1.8126CE92A616Bp-22, -0x1.A526FE1F6B353p-27, -0x1.772E1C0C43DBBp-33, -0x1.850DD04B1A372p-41, -0x1.93C648271D2B5p-52 },
+		{ 0x1.3EFCD9B332989p-21, 0x1.68472F669C2D1p-18, 0x1.F86D6B4DAF129p-17, 0x1.F48E6B8B8C660p-16, 0x1.A50DD396048ACp-15, 0x1.42010AACB1947p-14, 0x1.D00AEB4840C8Cp-14, 0x1.42225927968E6p-13, 0x1.B6BCFB1CFBA98p-13, 0x1.2C6CD3DEDE033p-12,
+		  0x1.EDE497DCD4912p-17, 0x1.324DC851756A6p-17, 0x1.D1ED0AF66222Ap-19, 0x1.A825F75A6A92Ap-21, 0x1.BBA1A8E2A0953p-24, 0x1.F3A7FBCF2BB93p-28, 0x1.112E1082164D2p-32, 0x1.E6B86636C8638p-39, 0x1.F8B809FE42896p-47, 0x1.05E8740DC21D2p-57 },
+		{ -0x1.13E1978673D5Cp-26, -0x1.3797807B1CDE0p-23, -0x1.B442F1875FA7Cp-22, -0x1.B0E9DCEF8B49Ep-21, -0x1.6C279F2C935B7p-20, -0x1.167D6E9447BF5p-19, -0x1.91558983A2100p-19, -0x1.169A3C81925E2p-18, -0x1.7B72FE860D4ADp-18, -0x1.03D3BACB3A0F7p-17,
+		  -0x1.63F574DD78F66p-22, -0x1.B984DFF97CD11p-23, -0x1.4FCD77423362Bp-24, -0x1.31B157EC977F7p-26, -0x1.3FBC258F771CDp-29, -0x1.681D1420F7955p-33, -0x1.89C64DF24DB5Ep-38, -0x1.5ECAB12BA38ABp-44, -0x1.6BC3DD819D81Ap-52, -0x1.7988086DE0FC4p-63 },
+		{ 0x1.DD330A24C0AABp-32, 0x1.0D7C06A75DAABp-28, 0x1.794E88CE21EEFp-27, 0x1.766945F877AABp-26, 0x1.3AF1BA93C3000p-25, 0x1.E1B632A3EFBBCp-25, 0x1.5B1969FC24CCDp-24, 0x1.E1E7FE3F0B111p-24, 0x1.482BF2F6AA777p-23, 0x1.C16DFA6F8ADDEp-23,
+		  0x1.0D5FB5B45C889p-27, 0x1.4E1F73CDACCCDp-28, 0x1.FC3EB04074444p-30, 0x1.CEAD374350444p-32, 0x1.E3EF855182EEFp-35, 0x1.1087A4254A666p-38, 0x1.2A02D1DDD4444p-43, 0x1.097D76325F333p-49, 0x1.1352ABE55E666p-57, 0x1.1DC4F46586222p-68 },
+		{ -0x1.9CBACE1666666p-37, -0x1.D227AEDA3BBBCp-34, -0x1.46554359E6666p-32, -0x1.43D41C0133333p-31, -0x1.1065392440000p-30, -0x1.A0A1E219A2222p-30, -0x1.2C34AED788889p-29, -0x1.A0CCB268EEEEFp-29, -0x1.1BD593D1E6666p-28, -0x1.84B54773DDDDEp-28,
+		  -0x1.A36F20C111111p-33, -0x1.04224A3933333p-33, -0x1.8BB8382800000p-35, -0x1.6845AB5AAAAABp-37, -0x1.78DFF47222222p-40, -0x1.A88D4DACCCCCDp-44, -0x1.D05DECA577777p-49, -0x1.9DD7F76A44444p-55, -0x1.AD6B8AA844444p-63, -0x1.BE310D5E22222p-74 },
+		{ 0x1.641F516888889p-42, 0x1.923C8A3BBBBBCp-39, 0x1.1996E2C888889p-37, 0x1.176DCFF777777p-36, 0x1.D61732EBBBBBCp-36, 0x1.6781824222222p-35, 0x1.030A825DDDDDEp-34, 0x1.67A2858BBBBBCp-34, 0x1.E9CEDBB888889p-34, 0x1.4F622AF777777p-33,
+		  0x1.4943E93333333p-38, 0x1.98A880AEEEEEFp-39, 0x1.36E7924444444p-40, 0x1.1B6084E222222p-42, 0x1.28AFD2DDDDDDEp-45, 0x1.4EE9AAC000000p-49, 0x1.6EB7A42666666p-54, 0x1.489EA99111111p-60, 0x1.569CE82666666p-68, 0x1.6738630000000p-79 },
+		{ -0x1.E312377777777p-48, -0x1.0DECC66666666p-44, -0x1.7A278DDDDDDDEp-43, -0x1.777F066666666p-42, -0x1.3BBC766666666p-41, -0x1.E2D77DDDDDDDEp-41, -0x1.5BDE611111111p-40, -0x1.E2C9400000000p-40, -0x1.48C8B9999999Ap-39, -0x1.C21EF55555555p-39,
+		  0x1.B85999999999Ap-48, 0x1.40F3777777777p-48, 0x1.81BC888888889p-50, 0x1.3B46EEEEEEEEFp-52, 0x1.1864CCCCCCCCDp-55, 0x1.5733333333333p-61, 0x1.5144444444444p-68, -0x1.AF1999999999Ap-70, -0x1.874999999999Ap-77, -0x1.77EE444444444p-87 },
+		{ 0x1.5351DDDDDDDDEp-49, 0x1.790F444444444p-46, 0x1.06F9911111111p-44, 0x1.045EAAAAAAAABp-43, 0x1.B73EF9999999Ap-43, 0x1.4ED1A22222222p-42, 0x1.E26C3BBBBBBBCp-42, 0x1.51B2711111111p-41, 0x1.C9EAB55555555p-41, 0x1.38B0C88888889p-40,
+		  0x1.3B6F4CCCCCCCDp-43, 0x1.7C9C688888889p-44, 0x1.28BB888888889p-45, 0x1.05B0BDDDDDDDEp-47, 0x1.1AAB955555555p-50, 0x1.31588EEEEEEEFp-54, 0x1.76A2311111111p-59, 0x1.10A9A66666666p-65, 0x1.2AB4A00000000p-73, 0x1.4FF119999999Ap-84 },
+		{ -0x1.74C7C88888889p-49, -0x1.B79D6AAAAAAABp-46, -0x1.3311844444444p-44, -0x1.2FBF6AAAAAAABp-43, -0x1.FFCA6EEEEEEEFp-43, -0x1.8786FBBBBBBBCp-42, -0x1.1A30CCCCCCCCDp-41, -0x1.8848A22222222p-41, -0x1.0ADA577777777p-40, -0x1.6D45333333333p-40,
+		  -0x1.8794B33333333p-43, -0x1.EC11555555555p-44, -0x1.72662EEEEEEEFp-45, -0x1.527D844444444p-47, -0x1.629D4CCCCCCCDp-50, -0x1.8BE1444444444p-54, -0x1.B564155555555p-59, -0x1.7A6E222222222p-65, -0x1.8B97733333333p-73, -0x1.A1F0AEEEEEEEFp-84 },
+		{ -0x1.E485888888889p-49, -0x1.0D20EEEEEEEEFp-45, -0x1.7791D55555555p-44, -0x1.73CC800000000p-43, -0x1.39C28AAAAAAABp-42, -0x1.DE61444444444p-42, -0x1.58A46EEEEEEEFp-41, -0x1.E286044444444p-41, -0x1.4731F11111111p-40, -0x1.BEEC222222222p-40,
+		  -0x1.E8A2AAAAAAAABp-43, -0x1.28052CCCCCCCDp-43, -0x1.CC7F777777777p-45, -0x1.9659511111111p-47, -0x1.B5AABBBBBBBBCp-50, -0x1.D815622222222p-54, -0x1.1ED7533333333p-58, -0x1.A5A7911111111p-65, -0x1.C893B77777777p-73, -0x1.F8FB333333333p-84 },
+		{ 0x1.EE15333333333p-50, 0x1.2585EEEEEEEEFp-46, 0x1.9A10222222222p-45, 0x1.9538222222222p-44, 0x1.558ECCCCCCCCDp-43, 0x1.0547222222222p-42, 0x1.78B199999999Ap-42, 0x1.05F9BBBBBBBBCp-41, 0x1.6451222222222p-41, 0x1.E79AAAAAAAAABp-41,
+		  0x1.057CEEEEEEEEFp-43, 0x1.4985555555555p-44, 0x1.EEC799999999Ap-46, 0x1.C519777777777p-48, 0x1.D97C888888889p-51, 0x1.0908444444444p-54, 0x1.248C99999999Ap-59, 0x1.F515DDDDDDDDEp-66, 0x1.05F5000000000p-73, 0x1.16ADAAAAAAAABp-84 },
+		{ 0x1.79E5111111111p-49, 0x1.A456AAAAAAAABp-46, 0x1.257B111111111p-44, 0x1.2292CCCCCCCCDp-43, 0x1.EA72888888889p-43, 0x1.7604CCCCCCCCDp-42, 0x1.0D72666666666p-41, 0x1.78F2000000000p-41, 0x1.FF6B111111111p-41, 0x1.5D5A888888889p-40,
+		  0x1.7D31555555555p-43, 0x1.CF7BDDDDDDDDEp-44, 0x1.67F4444444444p-45, 0x1.3E30000000000p-47, 0x1.5622000000000p-50, 0x1.718ACCCCCCCCDp-54, 0x1.BD8A888888889p-59, 0x1.4D5199999999Ap-65, 0x1.6724222222222p-73, 0x1.8ABB777777777p-84 },
+		{ -0x1.F3D7777777777p-52, -0x1.2BC999999999Ap-48, -0x1.A2DBBBBBBBBBCp-47, -0x1.9D64444444444p-46, -0x1.5CAEEEEEEEEEFp-45, -0x1.0AB2222222222p-44, -0x1.8095555555555p-44, -0x1.0BA8888888889p-43, -0x1.6BE5555555555p-43, -0x1.F1CCCCCCCCCCDp-43,
+		  -0x1.0A82222222222p-45, -0x1.5108888888889p-46, -0x1.F88AAAAAAAAABp-48, -0x1.CF46666666666p-50, -0x1.E2AEEEEEEEEEFp-53, -0x1.0F11111111111p-56, -0x1.2B3CCCCCCCCCDp-61, -0x1.F9C0000000000p-68, -0x1.08DEEEEEEEEEFp-75, -0x1.1CC3333333333p-86 },
+		{ -0x1.CC9999999999Ap-51, -0x1.0077777777777p-47, -0x1.664EEEEEEEEEFp-46, -0x1.62CEEEEEEEEEFp-45, -0x1.2B6D555555555p-44, -0x1.C8D5555555555p-44, -0x1.4917777777777p-43, -0x1.CC12222222222p-43, -0x1.3835DDDDDDDDEp-42, -0x1.AAA2222222222p-42,
+		  -0x1.D0D5555555555p-45, -0x1.1B5199999999Ap-45, -0x1.B791111111111p-47, -0x1.8518888888889p-49, -0x1.A1D1111111111p-52, -0x1.C3C7777777777p-56, -0x1.0E90888888889p-60, -0x1.9B06666666666p-67, -0x1.B907777777777p-75, -0x1.E1EEEEEEEEEEFp-86 }
+	},
+	{
+		{ 0x1.9496E59C6346Ep-11, 0x1.C8F5D3C89B20Bp-8, 0x1.3FE577F81436Fp-6, 0x1.3D70FFE8DA47Bp-5, 0x1.0B05D95DEAAA2p-4, 0x1.986A4F297096Ap-4, 0x1.2649071E0C644p-3, 0x1.98948DC9CA0A2p-3, 0x1.163CDE079DFC1p-2, 0x1.7D0BA6033ED0Fp-2,
+		  0x1.ACC26573923D9p-5, 0x1.09E8BBF075700p-5, 0x1.947B07A7FCDD5p-7, 0x1.703665416B7F4p-9, 0x1.8120516BCE363p-12, 0x1.B1C332CA60708p-16, 0x1.DA4E94AB03A56p-21, 0x1.A68851826E9E9p-27, 0x1.B6284A7D60E51p-35, 0x1.C6BC62AF21AC2p-46 },
+		{ -0x1.4BF887E2B1C02p-16, -0x1.76F116CBE327Fp-13, -0x1.067AA413B0329p-11, -0x1.0476F95C8701Ep-10, -0x1.B630FBADB0FD4p-10, -0x1.4F1C26B250FBCp-9, -0x1.E2EDFE8D0FF99p-9, -0x1.4F3ED03C6FE39p-8, -0x1.C89865CAB277Bp-8, -0x1.38A718A0129C9p-7,
+		  -0x1.5FCD740FFAE57p-11, -0x1.B45D1A28261D1p-12, -0x1.4BE1AA62A1749p-13, -0x1.2E1F810823417p-15, -0x1.3C0042CF6839Ep-18, -0x1.63E85E3160A26p-22, -0x1.852CC8C354B4Cp-27, -0x1.5AB17DF836556p-33, -0x1.67838558695ABp-41, -0x1.751DDAD9FD645p-52 },
+		{ 0x1.1062E5A443E6Dp-21, 0x1.33A4FF00DD4BEp-18, 0x1.AEBC20EF10071p-17, 0x1.AB6DE7F6F6D72p-16, 0x1.678AA71C0A646p-15, 0x1.12F647206E093p-14, 0x1.8C3FFECC2B5AAp-14, 0x1.1312B7FA7F9C3p-13, 0x1.76A46DC3466C9p-13, 0x1.00891AC1E96F5p-12,
+		  0x1.B0FCDD999D0BBp-17, 0x1.0C881018C4F7Dp-17, 0x1.9878343286F5Ep-19, 0x1.73D8015784303p-21, 0x1.84ECA1237CE3Bp-24, 0x1.B60A4CCEF3F95p-28, 0x1.DEFC0B3B40E3Dp-33, 0x1.AAB311CAC6FC6p-39, 0x1.BA7A7DABE6B3Ap-47, 0x1.CB3871607E7CCp-58 },
+		{ -0x1.BEFE30310A59Ap-27, -0x1.F8DA3F7E60304p-24, -0x1.616C696E5B95Ap-22, -0x1.5EB6134D1C2FCp-21, -0x1.27022CE8A5D86p-20, -0x1.C3383FB972FB3p-20, -0x1.4520D0B4BC331p-19, -0x1.C366EBC10B0C4p-19, -0x1.3366180BD6715p-18, -0x1.A4FB3F0948544p-18,
+		  -0x1.280F5BC78C933p-22, -0x1.6F38F908BE36Fp-23, -0x1.174BA076BE055p-24, -0x1.FC811B55F3CCDp-27, -0x1.09EE62CC88C44p-29, -0x1.2B83C64A29509p-33, -0x1.4782CA21EDCE6p-38, -0x1.23C2ADFC19922p-44, -0x1.2E8CB28819744p-52, -0x1.39FF4CD147C9Ap-63 },
+		{ 0x1.6EC3743FD6EEFp-32, 0x1.9E3CF0C885333p-29, 0x1.21FD11B928444p-27, 0x1.1FC35B61D7AABp-26, 0x1.E41DD8FFCC222p-26, 0x1.723B4C0D9EEEFp-25, 0x1.0AC59A61A1666p-24, 0x1.7261972AB6CCDp-24, 0x1.F8730B24EF99Ap-24, 0x1.596BB2E754AABp-23,
+		  0x1.A91CB65251111p-28, 0x1.07A5B1E93EAABp-28, 0x1.910A473FCB777p-30, 0x1.6D14AE62F0000p-32, 0x1.7DD9DFCCFA222p-35, 0x1.AE13044AE8000p-39, 0x1.D6465E1F7A222p-44, 0x1.A2F111FE21111p-50, 0x1.B26F82271B333p-58, 0x1.C2E068EAB4CCDp-69 },
+		{ -0x1.2CF4B7EC11111p-37, -0x1.53E98B732AAABp-34, -0x1.DBE9C34A55555p-33, -0x1.D842C8BA77777p-32, -0x1.8D40ACC077777p-31, -0x1.2FCD425600000p-30, -0x1.B5CFA821D5555p-30, -0x1.2FECA8B46EEEFp-29, -0x1.9DEFDE1C5DDDEp-29, -0x1.1B71437CBBBBCp-28,
+		  -0x1.3A056C3C00000p-33, -0x1.8580A386AAAABp-34, -0x1.283DE97C88889p-35, -0x1.0DAE56A4EEEEFp-37, -0x1.1A12A79C44444p-40, -0x1.3DB2F9B266666p-44, -0x1.5B67396155555p-49, -0x1.357E24DECCCCDp-55, -0x1.40F4462DBBBBCp-63, -0x1.4D20ABAB9999Ap-74 },
+		{ 0x1.EC64ED2888889p-43, 0x1.1613BE0555555p-39, 0x1.85559FFDDDDDEp-38, 0x1.82589EA222222p-37, 0x1.44FD090333333p-36, 0x1.F111C37333333p-36, 0x1.6629D78EEEEEFp-35, 0x1.F145022888889p-35, 0x1.52A2197555555p-34, 0x1.CFC14EC222222p-34,
+		  0x1.D256474444444p-39, 0x1.2120DB7777777p-39, 0x1.B8078A999999Ap-41, 0x1.908C66C444444p-43, 0x1.A2CEC14444444p-46, 0x1.D7F6CD8000000p-50, 0x1.0225BB2222222p-54, 0x1.CBFE89B333333p-61, 0x1.DD4A049111111p-69, 0x1.EFDCF62AAAAABp-80 },
+		{ -0x1.124C5DDDDDDDEp-48, -0x1.3578644444444p-45, -0x1.B17AC44444444p-44, -0x1.AE113DDDDDDDEp-43, -0x1.69CCFDDDDDDDEp-42, -0x1.1495AAAAAAAABp-41, -0x1.8EA9711111111p-41, -0x1.14E8E66666666p-40, -0x1.790A2AAAAAAABp-40, -0x1.02142BBBBBBBCp-39,
+		  0x1.79632AAAAAAABp-45, 0x1.DB58222222222p-46, 0x1.638C000000000p-47, 0x1.407FDDDDDDDDEp-49, 0x1.5944000000000p-52, 0x1.73E4222222222p-56, 0x1.99B8555555555p-61, 0x1.790D888888889p-67, 0x1.878C333333333p-75, 0x1.7BA3777777777p-86 },
+		{ 0x1.32DABDDDDDDDEp-49, 0x1.5735C66666666p-46, 0x1.E124D9999999Ap-45, 0x1.DE15222222222p-44, 0x1.904AFDDDDDDDEp-43, 0x1.331F8CCCCCCCDp-42, 0x1.BAFDD9999999Ap-42, 0x1.32ECF55555555p-41, 0x1.A22D7BBBBBBBCp-41, 0x1.1E6B1BBBBBBBCp-40,
+		  0x1.29E1A22222222p-43, 0x1.7A82888888889p-44, 0x1.168A7BBBBBBBCp-45, 0x1.FF70AEEEEEEEFp-48, 0x1.1598C88888889p-50, 0x1.2CBB822222222p-54, 0x1.46824CCCCCCCDp-59, 0x1.292AB55555555p-65, 0x1.3333066666666p-73, 0x1.3B2B022222222p-84 },
+		{ -0x1.6E65444444444p-49, -0x1.9EF3266666666p-46, -0x1.221E8CCCCCCCDp-44, -0x1.20080CCCCCCCDp-43, -0x1.E46EEAAAAAAABp-43, -0x1.72DCF77777777p-42, -0x1.0B16755555555p-41, -0x1.72495DDDDDDDEp-41, -0x1.F89BA22222222p-41, -0x1.59D04CCCCCCCDp-40,
+		  -0x1.7F7F2AAAAAAABp-43, -0x1.DEE32EEEEEEEFp-44, -0x1.69BBE66666666p-45, -0x1.4814555555555p-47, -0x1.5C22000000000p-50, -0x1.8029733333333p-54, -0x1.A72C622222222p-59, -0x1.7DFEA22222222p-65, -0x1.8E305DDDDDDDEp-73, -0x1.94BFF77777777p-84 },
+		{ -0x1.C4CB266666666p-49, -0x1.FB71F33333333p-46, -0x1.6382EAAAAAAABp-44, -0x1.6178EEEEEEEEFp-43, -0x1.27F5F55555555p-42, -0x1.C645B33333333p-42, -0x1.4780C00000000p-41, -0x1.C5A3C88888889p-41, -0x1.351BD9999999Ap-40, -0x1.A7807BBBBBBBCp-40,
+		  -0x1.D217333333333p-43, -0x1.27F35DDDDDDDEp-43, -0x1.B44DCCCCCCCCDp-45, -0x1.8FF80CCCCCCCDp-47, -0x1.B27BC44444444p-50, -0x1.D4948CCCCCCCDp-54, -0x1.FE55DDDDDDDDEp-59, -0x1.D2D16AAAAAAABp-65, -0x1.E2B0EAAAAAAABp-73, -0x1.EC767BBBBBBBCp-84 },
+		{ 0x1.E94E666666666p-50, 0x1.1540555555555p-46, 0x1.8384666666666p-45, 0x1.80CECCCCCCCCDp-44, 0x1.438B222222222p-43, 0x1.EF90CCCCCCCCDp-43, 0x1.64D6555555555p-42, 0x1.EE9EAAAAAAAABp-42, 0x1.5108AAAAAAAABp-41, 0x1.CE03333333333p-41,
+		  0x1.006CCCCCCCCCDp-43, 0x1.40C4333333333p-44, 0x1.E3D4000000000p-46, 0x1.B615555555555p-48, 0x1.D367777777777p-51, 0x1.FF72888888889p-55, 0x1.1B28777777777p-59, 0x1.FF0599999999Ap-66, 0x1.0AF0222222222p-73, 0x1.0E3ACCCCCCCCDp-84 },
+		{ 0x1.613C666666666p-49, 0x1.8C9FDDDDDDDDEp-46, 0x1.15CB99999999Ap-44, 0x1.1441777777777p-43, 0x1.CEC9BBBBBBBBCp-43, 0x1.6327333333333p-42, 0x1.FFEF777777777p-42, 0x1.6279BBBBBBBBCp-41, 0x1.E32999999999Ap-41, 0x1.4B05333333333p-40,
+		  0x1.6C80888888889p-43, 0x1.CE6F333333333p-44, 0x1.5572888888889p-45, 0x1.38C5BBBBBBBBCp-47, 0x1.536E666666666p-50, 0x1.6DBB99999999Ap-54, 0x1.8ED2666666666p-59, 0x1.6E92444444444p-65, 0x1.7B04666666666p-73, 0x1.8172000000000p-84 },
+		{ -0x1.F355555555555p-52, -0x1.1B27777777777p-48, -0x1.8B8AAAAAAAAABp-47, -0x1.88E8888888889p-46, -0x1.4A41111111111p-45, -0x1.FA15555555555p-45, -0x1.6C54444444444p-44, -0x1.F8E6666666666p-44, -0x1.580CCCCCCCCCDp-43, -0x1.D7B7777777777p-43,
+		  -0x1.05B999999999Ap-45, -0x1.4823333333333p-46, -0x1.EE04444444444p-48, -0x1.BE2EEEEEEEEEFp-50, -0x1.DFAAAAAAAAAABp-53, -0x1.0381111111111p-56, -0x1.2174444444444p-61, -0x1.04F3333333333p-67, -0x1.116EEEEEEEEEFp-75, -0x1.136EEEEEEEEEFp-86 },
+		{ -0x1.AEB8888888889p-51, -0x1.E44DDDDDDDDDEp-48, -0x1.532DDDDDDDDDEp-46, -0x1.514CCCCCCCCCDp-45, -0x1.1AA199999999Ap-44, -0x1.B1C2222222222p-44, -0x1.388DDDDDDDDDEp-43, -0x1.B0C3333333333p-43, -0x1.26FAAAAAAAAABp-42, -0x1.9438888888889p-42,
+		  -0x1.BD5999999999Ap-45, -0x1.1A3999999999Ap-45, -0x1.A15DDDDDDDDDEp-47, -0x1.7E2999999999Ap-49, -0x1.9E13333333333p-52, -0x1.BE74444444444p-56, -0x1.E6DDDDDDDDDDEp-61, -0x1.C163333333333p-67, -0x1.D06DDDDDDDDDEp-75, -0x1.D73CCCCCCCCCDp-86 }
+	},
+	{
+		{ 0x1.80DA76820772Ep-11, 0x1.B2AB658CDEF9Ap-8, 0x1.304AAA4FE19F8p-6, 0x1.2DF4DA7359591p-5, 0x1.FBFEA3C567A02p-5, 0x1.847E19595F16Bp-4, 0x1.17EE0D039BC2Bp-3, 0x1.84A6486EC6F79p-3, 0x1.08AA49D54BC10p-2, 0x1.6A753A0316ED2p-2,
+		  0x1.A22BCB98EC63Fp-5, 0x1.0357AA9AB200Ap-5, 0x1.8A7DEB1EFC18Dp-7, 0x1.671E91D6D9A10p-9, 0x1.779D90649D44Bp-12, 0x1.A70CF7C098236p-16, 0x1.CE98078DE9F39p-21, 0x1.9C19155B80C68p-27, 0x1.AB5646A844D74p-35, 0x1.BB818FD75E806p-46 },
+		{ -0x1.2C5F94B068DC3p-16, -0x1.5341171049267p-13, -0x1.DAFDEAA2269B7p-12, -0x1.D758BF247114Dp-11, -0x1.8C7BD0FDF83BDp-10, -0x1.2F36B620493ACp-9, -0x1.B4F6B6A7F7DF8p-9, -0x1.2F561311C5DD4p-8, -0x1.9D22CAAA99FD3p-8, -0x1.1AE4DC1B61AB7p-7,
+		  -0x1.46609EE7BE426p-11, -0x1.94D3C5A04EEAEp-12, -0x1.33E56656A241Ap-13, -0x1.1849CF7C01088p-15, -0x1.2529CE5B0F5CAp-18, -0x1.4A2F95A9210FAp-22, -0x1.690C82C64F5D8p-27, -0x1.41A32FE3B0F4Cp-33, -0x1.4D8805326F436p-41, -0x1.5A26AEB50706Ap-52 },
+		{ 0x1.D4E0204B42D14p-22, 0x1.08C8A7DA96793p-18, 0x1.72B9B0E237543p-17, 0x1.6FE15CFCFA6ABp-16, 0x1.35735E6E98987p-15, 0x1.D94F28C7EC3F0p-15, 0x1.550B7BD405C2Dp-14, 0x1.D9801DC3F8888p-14, 0x1.427291B099766p-13, 0x1.B997321DDB74Cp-13,
+		  0x1.7E19B3CA3A12Fp-17, 0x1.D9F1AF2BD7BD1p-18, 0x1.6876B640343C1p-19, 0x1.48247608A4EAAp-21, 0x1.573730087D17Ap-24, 0x1.828F1F9DB859Cp-28, 0x1.A6B0FD070E591p-33, 0x1.788D18E09F674p-39, 0x1.8679C7B1C3AA4p-47, 0x1.954004CFB664Fp-58 },
+		{ -0x1.6DF39C1C4012Bp-27, -0x1.9D52317AC6C51p-24, -0x1.2158BBD6014E2p-22, -0x1.1F2048680991Ap-21, -0x1.E30B806351066p-21, -0x1.71697D44BBE44p-20, -0x1.0A2E6CF9CAA04p-19, -0x1.718FB31B96EC9p-19, -0x1.F7552E0AB2C2Fp-19, -0x1.58A7F4F4358E2p-18,
+		  -0x1.F10A893C59811p-23, -0x1.34419D1A1F511p-23, -0x1.D4E55887FA39Ap-25, -0x1.AADA17DED6355p-27, -0x1.BE75934731D89p-30, -0x1.F6D75039C4889p-34, -0x1.12EBD45396000p-38, -0x1.E9D2993B5D555p-45, -0x1.FBEF961FCB522p-53, -0x1.0793C9AC70ABCp-63 },
+		{ 0x1.1D9EF0E1D6666p-32, 0x1.42979822EE889p-29, 0x1.C3A9C56B0F99Ap-28, 0x1.C0326ED0DCCCDp-27, 0x1.7902C44019777p-26, 0x1.20525BDCE4111p-25, 0x1.9F80B398C3555p-25, 0x1.20702E78F4444p-24, 0x1.88D85ED0F1111p-24, 0x1.0CFFFD75C2111p-23,
+		  0x1.537173EC42AABp-28, 0x1.A5089640C6666p-29, 0x1.4038D55E82AABp-30, 0x1.23824F94F0CCDp-32, 0x1.30E642044AEEFp-35, 0x1.576778D9E8889p-39, 0x1.7780B43578889p-44, 0x1.4E837D1C2AAABp-50, 0x1.5AE23D5576666p-58, 0x1.68024903B3333p-69 },
+		{ -0x1.BDE3B4E6BBBBCp-38, -0x1.F79B23D3CCCCDp-35, -0x1.608D080B91111p-33, -0x1.5DD8699766666p-32, -0x1.2647BA841999Ap-31, -0x1.C21B0BFB9999Ap-31, -0x1.4453503A5DDDEp-30, -0x1.C249A05F9999Ap-30, -0x1.32A3CD1A4CCCDp-29, -0x1.A3F129BA9999Ap-29,
+		  -0x1.DD0EBFB5DDDDEp-34, -0x1.27DCC5DB9999Ap-34, -0x1.C20B49AE22222p-36, -0x1.99B0D74488889p-38, -0x1.AC821EAA22222p-41, -0x1.E2A0393844444p-45, -0x1.07DED89CAAAABp-49, -0x1.D620F172EEEEFp-56, -0x1.E784F14E22222p-64, -0x1.F9F7C0C99999Ap-75 },
+		{ 0x1.5A9BAD1333333p-43, 0x1.877FD26CCCCCDp-40, 0x1.1211122EEEEEFp-38, 0x1.0FF6AF6CCCCCDp-37, 0x1.C989936AAAAABp-37, 0x1.5DE8418000000p-36, 0x1.F8409B7777777p-36, 0x1.5E0C42B111111p-35, 0x1.DCC19F2000000p-35, 0x1.46750AA222222p-34,
+		  0x1.4F5EBCAAAAAABp-39, 0x1.9FFADD0000000p-40, 0x1.3C5B5A4444444p-41, 0x1.200A000000000p-43, 0x1.2D6321DDDDDDEp-46, 0x1.532E75DDDDDDEp-50, 0x1.7319CB4444444p-55, 0x1.4A7DCEDDDDDDEp-61, 0x1.56D3696EEEEEFp-69, 0x1.63D4E66666666p-80 },
+		{ -0x1.254F79999999Ap-49, -0x1.4C92BBBBBBBBCp-46, -0x1.D115D55555555p-45, -0x1.CD5DAEEEEEEEFp-44, -0x1.8392B33333333p-43, -0x1.29223BBBBBBBCp-42, -0x1.AC31088888889p-42, -0x1.28BB800000000p-41, -0x1.94A0EEEEEEEEFp-41, -0x1.14F6488888889p-40,
+		  0x1.2017666666666p-44, 0x1.628AF77777777p-45, 0x1.0F7C800000000p-46, 0x1.EE85000000000p-49, 0x1.F924BBBBBBBBCp-52, 0x1.223C1DDDDDDDEp-55, 0x1.47676EEEEEEEFp-60, 0x1.10BB400000000p-66, 0x1.281899999999Ap-74, 0x1.2C7319999999Ap-85 },
+		{ 0x1.1E571BBBBBBBCp-49, 0x1.3E771BBBBBBBCp-46, 0x1.BF49F77777777p-45, 0x1.BBA5511111111p-44, 0x1.7516155555555p-43, 0x1.1CF4AAAAAAAABp-42, 0x1.9AD2AAAAAAAABp-42, 0x1.1CC8FDDDDDDDEp-41, 0x1.8402DBBBBBBBCp-41, 0x1.09F0488888889p-40,
+		  0x1.247B99999999Ap-43, 0x1.6B4AAEEEEEEEFp-44, 0x1.141EC44444444p-45, 0x1.F581EEEEEEEEFp-48, 0x1.FF81088888889p-51, 0x1.2CEA777777777p-54, 0x1.3E48E22222222p-59, 0x1.2695EAAAAAAABp-65, 0x1.2C485BBBBBBBCp-73, 0x1.3359155555555p-84 },
+		{ -0x1.5DAD111111111p-49, -0x1.8939FBBBBBBBCp-46, -0x1.13A8044444444p-44, -0x1.11A2333333333p-43, -0x1.CD28444444444p-43, -0x1.5F83EEEEEEEEFp-42, -0x1.FA7DB33333333p-42, -0x1.6055A66666666p-41, -0x1.DF28511111111p-41, -0x1.4853F33333333p-40,
+		  -0x1.763B488888889p-43, -0x1.CE6CBBBBBBBBCp-44, -0x1.60DB2AAAAAAABp-45, -0x1.415DB33333333p-47, -0x1.4B682EEEEEEEFp-50, -0x1.7972D55555555p-54, -0x1.A537888888889p-59, -0x1.6A206EEEEEEEFp-65, -0x1.8243AEEEEEEEFp-73, -0x1.89C02AAAAAAABp-84 },
+		{ -0x1.B14DAEEEEEEEFp-49, -0x1.E1A4D11111111p-46, -0x1.524E5DDDDDDDEp-44, -0x1.4F7F0CCCCCCCDp-43, -0x1.1A2EF33333333p-42, -0x1.AF1FE66666666p-42, -0x1.36B54CCCCCCCDp-41, -0x1.AE6D955555555p-41, -0x1.25597DDDDDDDEp-40, -0x1.923AD55555555p-40,
+		  -0x1.CBB3111111111p-43, -0x1.1D966AAAAAAABp-43, -0x1.B122222222222p-45, -0x1.8AD5888888889p-47, -0x1.91F5F77777777p-50, -0x1.D852AAAAAAAABp-54, -0x1.F2A74CCCCCCCDp-59, -0x1.D374E66666666p-65, -0x1.DC02622222222p-73, -0x1.E3BAC44444444p-84 },
+		{ 0x1.D36A666666666p-50, 0x1.06DBEEEEEEEEFp-46, 0x1.7088222222222p-45, 0x1.6DCC888888889p-44, 0x1.3451DDDDDDDDEp-43, 0x1.D5D0888888889p-43, 0x1.526B555555555p-42, 0x1.D6DA000000000p-42, 0x1.4024BBBBBBBBCp-41, 0x1.B6DA444444444p-41,
+		  0x1.F477111111111p-44, 0x1.3554000000000p-44, 0x1.D7E8444444444p-46, 0x1.ADE6222222222p-48, 0x1.BA50666666666p-51, 0x1.F87F777777777p-55, 0x1.1A41DDDDDDDDEp-59, 0x1.E5B6666666666p-66, 0x1.0404111111111p-73, 0x1.0741333333333p-84 },
+		{ 0x1.52A2CCCCCCCCDp-49, 0x1.7872888888889p-46, 0x1.086D333333333p-44, 0x1.0637DDDDDDDDEp-43, 0x1.B926EEEEEEEEFp-43, 0x1.510DBBBBBBBBCp-42, 0x1.E5C0CCCCCCCCDp-42, 0x1.504D333333333p-41, 0x1.CA86444444444p-41, 0x1.3A64EEEEEEEEFp-40,
+		  0x1.6752666666666p-43, 0x1.BE6AEEEEEEEEFp-44, 0x1.5235111111111p-45, 0x1.34F6444444444p-47, 0x1.3A4E444444444p-50, 0x1.70C2222222222p-54, 0x1.84E9DDDDDDDDEp-59, 0x1.6F72EEEEEEEEFp-65, 0x1.75F7DDDDDDDDEp-73, 0x1.7A81DDDDDDDDEp-84 },
+		{ -0x1.DD40000000000p-52, -0x1.0C6DDDDDDDDDEp-48, -0x1.785999999999Ap-47, -0x1.7584444444444p-46, -0x1.3AECCCCCCCCCDp-45, -0x1.DF9999999999Ap-45, -0x1.596AAAAAAAAABp-44, -0x1.E09BBBBBBBBBCp-44, -0x1.46BEEEEEEEEEFp-43, -0x1.C00AAAAAAAAABp-43,
+		  -0x1.FED3333333333p-46, -0x1.3BDBBBBBBBBBCp-46, -0x1.E1B3333333333p-48, -0x1.B6F7777777777p-50, -0x1.C23DDDDDDDDDEp-53, -0x1.0166666666666p-56, -0x1.20BDDDDDDDDDEp-61, -0x1.F15DDDDDDDDDEp-68, -0x1.0B6BBBBBBBBBCp-75, -0x1.0C9BBBBBBBBBCp-86 },
+		{ -0x1.9D78888888889p-51, -0x1.CBABBBBBBBBBCp-48, -0x1.42E4444444444p-46, -0x1.4032222222222p-45, -0x1.0D5EEEEEEEEEFp-44, -0x1.9BA8888888889p-44, -0x1.289BBBBBBBBBCp-43, -0x1.9A94444444444p-43, -0x1.17F2AAAAAAAABp-42, -0x1.7FECCCCCCCCCDp-42,
+		  -0x1.B6CCCCCCCCCCDp-45, -0x1.1081111111111p-45, -0x1.9CCCCCCCCCCCDp-47, -0x1.798CCCCCCCCCDp-49, -0x1.7FF999999999Ap-52, -0x1.C1DDDDDDDDDDEp-56, -0x1.DA3999999999Ap-61, -0x1.C231111111111p-67, -0x1.CA14444444444p-75, -0x1.CE8AAAAAAAAABp-86 }
+	},
+	{
+		{ 0x1.6EF405D5489CCp-11, 0x1.9E73CBFD63834p-8, 0x1.222378B7542B7p-6, 0x1.1FE976FCDE23Ep-5, 0x1.E45DF574C80BAp-5, 0x1.726C53B478752p-4, 0x1.0AE8EEA42F532p-3, 0x1.7292A451CF99Bp-3, 0x1.F8B5DA318A8C4p-3, 0x1.599972D94584Fp-2,
+		  0x1.9854939F3E14Ap-5, 0x1.FA7A94D892232p-6, 0x1.81355A279B1A4p-7, 0x1.5EAB19AC8DAB4p-9, 0x1.6EC6B7555E493p-12, 0x1.9D185A4BB23A5p-16, 0x1.C3B530FEC09A6p-21, 0x1.9266738BFA587p-27, 0x1.A147D69B37F6Ap-35, 0x1.B111B72FE40BFp-46 },
+		{ -0x1.1114DAAAA16A0p-16, -0x1.346DFD0402DAEp-13, -0x1.AFD589FF0096Cp-12, -0x1.AC85282AF79C3p-11, -0x1.68758CFD9B1A2p-10, -0x1.13A9EAF1779EDp-9, -0x1.8D42E035DB92Ap-9, -0x1.13C66E609AB27p-8, -0x1.77993142A2E8Dp-8, -0x1.0130B4B9814E3p-7,
+		  -0x1.2FDFAF58BD9EDp-11, -0x1.78EA1B6B972ABp-12, -0x1.1EAAAE41329C1p-13, -0x1.04F6667482060p-15, -0x1.10F3233994A02p-18, -0x1.336B6CDF092ECp-22, -0x1.50279593EAF1Ap-27, -0x1.2B75EAD357DA3p-33, -0x1.3688CF55C2789p-41, -0x1.4248B7F409261p-52 },
+		{ 0x1.9672633964C13p-22, 0x1.CB0EDDCA5260Ap-19, 0x1.415D6CA5E02E7p-17, 0x1.3EE611FC2D269p-16, 0x1.0C3FAA69509BFp-15, 0x1.9A4A4BD2746E0p-15, 0x1.27A2E2638AB29p-14, 0x1.9A74BC189C555p-14, 0x1.1783DD3779063p-13, 0x1.7ECB7825DCD01p-13,
+		  0x1.53353ACE04407p-17, 0x1.A4BDE312A66EAp-18, 0x1.400004012EBFBp-19, 0x1.234E9616C67DAp-21, 0x1.30B0275210BA5p-24, 0x1.572A857006C57p-28, 0x1.773E0C2E22ECDp-33, 0x1.4E4817FDFFEDCp-39, 0x1.5AA4A000E87DFp-47, 0x1.67C24A5EA1E80p-58 },
+		{ -0x1.2E78D887EA595p-27, -0x1.559FE65282C49p-24, -0x1.DE4F83A24E995p-23, -0x1.DAA3D305BD7F7p-22, -0x1.8F40FD611ABD1p-21, -0x1.31550E8E25C55p-20, -0x1.B8044AB70559Ep-20, -0x1.3174A39898680p-19, -0x1.A005C00E1E63Cp-19, -0x1.1CDEDC34C0915p-18,
+		  -0x1.A4B91678CECCDp-23, -0x1.04ECD3BC29FDEp-23, -0x1.8CE637C494B77p-25, -0x1.694F9BA9DF811p-27, -0x1.79E85FA3E2055p-30, -0x1.A9A1E23307E89p-34, -0x1.D16AB8DD43E77p-39, -0x1.9E9CE371AF9ABp-45, -0x1.ADF1E372D26CDp-53, -0x1.BE366F518ACEFp-64 },
+		{ 0x1.C230F0284A889p-33, 0x1.FC76FA21BE222p-30, 0x1.63F3C565FB111p-28, 0x1.61387768EACCDp-27, 0x1.291E8971BECCDp-26, 0x1.C672BD4763DDEp-26, 0x1.477458A99799Ap-25, 0x1.C6A1BEDD64666p-25, 0x1.3599268D6FDDEp-24, 0x1.A7FE59ABCF99Ap-24,
+		  0x1.11F5A7B397BBCp-28, 0x1.53CF5A777D555p-29, 0x1.027249AFD9DDEp-30, 0x1.D68B95D47C444p-33, 0x1.EC28DDEE50889p-36, 0x1.15280925C8889p-39, 0x1.2F10090D4DDDEp-44, 0x1.0DFB1AC6CD111p-50, 0x1.17F6ED165B333p-58, 0x1.228EBB3AB2AABp-69 },
+		{ -0x1.4F10F01F44444p-38, -0x1.7A70143677777p-35, -0x1.08ED2DB377777p-33, -0x1.06E4AFE988889p-32, -0x1.BA46EE8322222p-32, -0x1.523C0E64BBBBCp-31, -0x1.E76EBBEDAAAABp-31, -0x1.525F0B8DBBBBCp-30, -0x1.CCDA49009999Ap-30, -0x1.3B916366CCCCDp-29,
+		  -0x1.6F27B54E22222p-34, -0x1.C767FB2B33333p-35, -0x1.5A5D3D16EEEEFp-36, -0x1.3B4ED6AD11111p-38, -0x1.49CAFA0733333p-41, -0x1.736FCB15DDDDEp-45, -0x1.9628E8EA22222p-50, -0x1.69D1D5BAAAAABp-56, -0x1.77334DBEAAAABp-64, -0x1.856644B666666p-75 },
+		{ 0x1.F001BAA222222p-44, 0x1.18218EAAAAAABp-40, 0x1.8837D3C000000p-39, 0x1.85375B4888889p-38, 0x1.4765BBB555555p-37, 0x1.F4C436A666666p-37, 0x1.68D3B51111111p-36, 0x1.F4F65F2222222p-36, 0x1.552694BBBBBBCp-35, 0x1.D334A50000000p-35,
+		  0x1.E95591DDDDDDEp-40, 0x1.2F6E942222222p-40, 0x1.CE016EEEEEEEFp-42, 0x1.A43A75CCCCCCDp-44, 0x1.B7B05E3333333p-47, 0x1.EF07998888889p-51, 0x1.0EB495DDDDDDEp-55, 0x1.E2841B5555555p-62, 0x1.F43C804444444p-70, 0x1.0380271111111p-80 },
+		{ -0x1.0B6A6AAAAAAABp-50, -0x1.2D68911111111p-47, -0x1.A699888888889p-46, -0x1.A4E8CCCCCCCCDp-45, -0x1.61A52AAAAAAABp-44, -0x1.0DDA1DDDDDDDEp-43, -0x1.8557BBBBBBBBCp-43, -0x1.0E126EEEEEEEFp-42, -0x1.6FEA6EEEEEEEFp-42, -0x1.F865B33333333p-42,
+		  0x1.5C4DA66666666p-44, 0x1.AE87111111111p-45, 0x1.47B28CCCCCCCDp-46, 0x1.2BFE1DDDDDDDEp-48, 0x1.3EAE7BBBBBBBCp-51, 0x1.584DB77777777p-55, 0x1.83E3777777777p-60, 0x1.5117777777777p-66, 0x1.5DF259999999Ap-74, 0x1.72504CCCCCCCDp-85 },
+		{ 0x1.0E25111111111p-49, 0x1.2D8A4CCCCCCCDp-46, 0x1.A4B6E22222222p-45, 0x1.A04DA66666666p-44, 0x1.5E2DF11111111p-43, 0x1.0B35822222222p-42, 0x1.81A5E66666666p-42, 0x1.0BE6E66666666p-41, 0x1.6C985DDDDDDDEp-41, 0x1.F305911111111p-41,
+		  0x1.1CAA155555555p-43, 0x1.630E088888889p-44, 0x1.03FD088888889p-45, 0x1.E9B759999999Ap-48, 0x1.F87EAEEEEEEEFp-51, 0x1.2194CEEEEEEEFp-54, 0x1.36A9A22222222p-59, 0x1.122399999999Ap-65, 0x1.1D70D11111111p-73, 0x1.2D16622222222p-84 },
+		{ -0x1.4C48266666666p-49, -0x1.77B99DDDDDDDEp-46, -0x1.06B2C22222222p-44, -0x1.041A2EEEEEEEFp-43, -0x1.B5C0044444444p-43, -0x1.4F58F77777777p-42, -0x1.E2F3E22222222p-42, -0x1.4F396EEEEEEEFp-41, -0x1.C8A7E66666666p-41, -0x1.3880D9999999Ap-40,
+		  -0x1.6C60E66666666p-43, -0x1.C273444444444p-44, -0x1.578AA22222222p-45, -0x1.39861DDDDDDDEp-47, -0x1.4C18733333333p-50, -0x1.6AFEDDDDDDDDEp-54, -0x1.940E59999999Ap-59, -0x1.652D6AAAAAAABp-65, -0x1.7135666666666p-73, -0x1.84415DDDDDDDEp-84 },
+		{ -0x1.9D6CAAAAAAAABp-49, -0x1.CF0D222222222p-46, -0x1.42BE1DDDDDDDEp-44, -0x1.3F88622222222p-43, -0x1.0CC0F9999999Ap-42, -0x1.9A417BBBBBBBCp-42, -0x1.281DB33333333p-41, -0x1.9B48111111111p-41, -0x1.17EA6EEEEEEEFp-40, -0x1.7F15C44444444p-40,
+		  -0x1.C099AAAAAAAABp-43, -0x1.177E555555555p-43, -0x1.9AC5B33333333p-45, -0x1.822DEAAAAAAABp-47, -0x1.8D8D488888889p-50, -0x1.C9D57BBBBBBBCp-54, -0x1.E793333333333p-59, -0x1.B10A3BBBBBBBCp-65, -0x1.C0FEF77777777p-73, -0x1.DA45F77777777p-84 },
+		{ 0x1.BC9B111111111p-50, 0x1.F6AD777777777p-47, 0x1.5F4B222222222p-45, 0x1.5BBF111111111p-44, 0x1.248C555555555p-43, 0x1.C074444444444p-43, 0x1.42EC99999999Ap-42, 0x1.C00E222222222p-42, 0x1.3146CCCCCCCCDp-41, 0x1.A1CCEEEEEEEEFp-41,
+		  0x1.E74B333333333p-44, 0x1.2CD999999999Ap-44, 0x1.CBFC444444444p-46, 0x1.A346888888889p-48, 0x1.BD34666666666p-51, 0x1.E548444444444p-55, 0x1.0D9899999999Ap-59, 0x1.E079333333333p-66, 0x1.EEAF333333333p-74, 0x1.045B555555555p-84 },
+		{ 0x1.423A888888889p-49, 0x1.69E7333333333p-46, 0x1.F840888888889p-45, 0x1.F371111111111p-44, 0x1.A40FDDDDDDDDEp-43, 0x1.40AD99999999Ap-42, 0x1.CEF6AAAAAAAABp-42, 0x1.416F99999999Ap-41, 0x1.B599DDDDDDDDEp-41, 0x1.2B6F555555555p-40,
+		  0x1.5E88AAAAAAAABp-43, 0x1.B464000000000p-44, 0x1.41BA000000000p-45, 0x1.2DF0888888889p-47, 0x1.369AAAAAAAAABp-50, 0x1.669F111111111p-54, 0x1.7C19111111111p-59, 0x1.532B99999999Ap-65, 0x1.5EBCCCCCCCCCDp-73, 0x1.72AEEEEEEEEEFp-84 },
+		{ -0x1.C657777777777p-52, -0x1.00C999999999Ap-48, -0x1.66B8888888889p-47, -0x1.62FDDDDDDDDDEp-46, -0x1.2A8DDDDDDDDDEp-45, -0x1.C9EEEEEEEEEEFp-45, -0x1.49C1111111111p-44, -0x1.C948888888889p-44, -0x1.37AAAAAAAAAABp-43, -0x1.AA82222222222p-43,
+		  -0x1.F155555555555p-46, -0x1.329DDDDDDDDDEp-46, -0x1.D615555555555p-48, -0x1.ABE4444444444p-50, -0x1.C7B999999999Ap-53, -0x1.EEE6666666666p-57, -0x1.128BBBBBBBBBCp-61, -0x1.ED06666666666p-68, -0x1.F973333333333p-76, -0x1.0A86666666666p-86 },
+		{ -0x1.88A6666666666p-51, -0x1.B9E2222222222p-48, -0x1.33C3333333333p-46, -0x1.30E999999999Ap-45, -0x1.0073BBBBBBBBCp-44, -0x1.879AAAAAAAAABp-44, -0x1.1AB1111111111p-43, -0x1.887BBBBBBBBBCp-43, -0x1.0B31111111111p-42, -0x1.6DA8888888889p-42,
+		  -0x1.ABF3333333333p-45, -0x1.0A2EEEEEEEEEFp-45, -0x1.8993333333333p-47, -0x1.70CBBBBBBBBBCp-49, -0x1.7B23333333333p-52, -0x1.B6A3333333333p-56, -0x1.CF77777777777p-61, -0x1.9EFDDDDDDDDDEp-67, -0x1.AC6CCCCCCCCCDp-75, -0x1.C4CEEEEEEEEEFp-86 }
+	},
+	{
+		{ 0x1.5EA4E9212340Cp-11, 0x1.8C08401442A58p-8, 0x1.153E56E811DA1p-6, 0x1.131DAA969B611p-5, 0x1.CED6F03C64224p-5, 0x1.61F5BC12D9814p-4, 0x1.FE182E785A71Dp-4, 0x1.621A58BFF3E2Dp-3, 0x1.E2475EB7DF6A1p-3, 0x1.4A3D4B9C6A40Ep-2,
+		  0x1.8F273ADFB3F79p-5, 0x1.EF188887FAFAEp-6, 0x1.788D09EC5A8BFp-7, 0x1.56C983B9A6AA9p-9, 0x1.668873FB07621p-12, 0x1.93CF978337812p-16, 0x1.B98E455C57C5Cp-21, 0x1.895B396618A51p-27, 0x1.97E6FEFBE9FA1p-35, 0x1.A756087280F22p-46 },
+		{ -0x1.F2B1A69587F9Cp-17, -0x1.199F7785E0093p-13, -0x1.8A4D48668030Dp-12, -0x1.8746A2F854D98p-11, -0x1.492160E0FD95Fp-10, -0x1.F768DDF8AD51Ap-10, -0x1.6ABBDCC75D212p-9, -0x1.F79CEFFFEF48Ap-9, -0x1.56F42C9982C6Bp-8, -0x1.D5AC824A8C36Dp-8,
+		  -0x1.1BD7A1551FD7Dp-11, -0x1.60117227CFA24p-12, -0x1.0BC5015E1ECEBp-13, -0x1.E784FF9BF3BC0p-16, -0x1.FDE9E38728086p-19, -0x1.1F27882FCD146p-22, -0x1.39FEC53BFADFEp-27, -0x1.17B85653FB6E5p-33, -0x1.22105A4CBDE23p-41, -0x1.2D09FAA1129B7p-52 },
+		{ 0x1.62A07675A0615p-22, 0x1.9087C66EA914Ep-19, 0x1.186477C049CE8p-17, 0x1.163D9BB636861p-16, 0x1.D418B74B409F2p-16, 0x1.65FAED7D8D050p-15, 0x1.01F1AE108D570p-14, 0x1.661FF49F2838Cp-14, 0x1.E7C1AB84E04E6p-14, 0x1.4DFD847932A8Ep-13,
+		  0x1.2EC3DF498A80Ap-17, 0x1.778A135D6DA25p-18, 0x1.1D9EF064376DCp-19, 0x1.0402AA75268E5p-21, 0x1.0FF43514B69A9p-24, 0x1.324C4CFF99C48p-28, 0x1.4EED9F2EBA7E1p-33, 0x1.2A5E39F2FB9B7p-39, 0x1.3566C6B813A4Bp-47, 0x1.411BB600FD8F8p-58 },
+		{ -0x1.F85BADCC21611p-28, -0x1.1CD2540277BBCp-24, -0x1.8EC7C6771CA80p-23, -0x1.8BB854A222F80p-22, -0x1.4CDE5FF71A4C0p-21, -0x1.FD209B58DCC91p-21, -0x1.6EDA90E3E5DD1p-20, -0x1.FD5544C73581Ap-20, -0x1.5AD95D455BD51p-19, -0x1.DB022825D7189p-19,
+		  -0x1.66D52DBA47433p-23, -0x1.BD156B41A4AABp-24, -0x1.52837AF06A611p-25, -0x1.3429152AC89CDp-27, -0x1.4250D5DE7DFABp-30, -0x1.6B05180CA1477p-34, -0x1.8CF3B241531CDp-39, -0x1.619F1473ABFABp-45, -0x1.6EB2B1C54A655p-53, -0x1.7C929DF0DABBCp-64 },
+		{ 0x1.66A7A41E0F777p-33, 0x1.95146E52FD111p-30, 0x1.1B93C9F4FDBBCp-28, 0x1.1966AC2114EEFp-27, 0x1.D969D700BAEEFp-27, 0x1.6A0BDB6DD8889p-26, 0x1.04DFB9CEC1111p-25, 0x1.6A314E29D2EEFp-25, 0x1.ED4BF600F2AABp-25, 0x1.51C8B0835B777p-24,
+		  0x1.BE8C58C912222p-29, 0x1.14F103F54EEEFp-29, 0x1.A5431BE32BBBCp-31, 0x1.7F7D42B51DDDEp-33, 0x1.911AD6B307777p-36, 0x1.C3C2498F2A222p-40, 0x1.EDFC4D9E20000p-45, 0x1.B81026C7BC444p-51, 0x1.C85613AA32AABp-59, 0x1.D99A3D769999Ap-70 },
+		{ -0x1.FE29C26755555p-39, -0x1.2019A51E66666p-35, -0x1.935EDEA633333p-34, -0x1.90466C8A22222p-33, -0x1.50B3419B66666p-32, -0x1.017E6F0CAAAABp-31, -0x1.731392C5DDDDEp-31, -0x1.01990DFC77777p-30, -0x1.5ED76ACB11111p-30, -0x1.E079DFBA88889p-30,
+		  -0x1.1DF6EB0C88889p-34, -0x1.62B2D1D5DDDDEp-35, -0x1.0DC547D777777p-36, -0x1.EB2941F911111p-39, -0x1.00DCA99266666p-41, -0x1.214CABC3BBBBCp-45, -0x1.3C57B40266666p-50, -0x1.19D035D333333p-56, -0x1.243C7B459999Ap-64, -0x1.2F4A1F43BBBBCp-75 },
+		{ 0x1.684839B333333p-44, 0x1.96ED92C888889p-41, 0x1.1CDAC6ACCCCCDp-39, 0x1.1AABA89777777p-38, 0x1.DB91531555555p-38, 0x1.6BAF29B777777p-37, 0x1.060E8B8444444p-36, 0x1.6BD6AF4444444p-36, 0x1.EF892C0444444p-36, 0x1.534F9CEEEEEEFp-35,
+		  0x1.6988D04444444p-40, 0x1.C069962222222p-41, 0x1.551F061111111p-42, 0x1.369E1E1111111p-44, 0x1.4452CB999999Ap-47, 0x1.6DEB836666666p-51, 0x1.8F9A7EAAAAAABp-56, 0x1.63A9C23333333p-62, 0x1.70BAFB5555555p-70, 0x1.7F62276666666p-81 },
+		{ -0x1.0975222222222p-52, -0x1.169E777777777p-49, -0x1.8EBEAAAAAAAABp-48, -0x1.8948444444444p-47, -0x1.4A60666666666p-46, -0x1.FB43333333333p-46, -0x1.7072000000000p-45, -0x1.016F444444444p-44, -0x1.5E07333333333p-44, -0x1.DB04222222222p-44,
+		  0x1.85EE2AAAAAAABp-44, 0x1.DC6F3BBBBBBBCp-45, 0x1.6C65377777777p-46, 0x1.498F59999999Ap-48, 0x1.5A0D800000000p-51, 0x1.8347622222222p-55, 0x1.ACB75DDDDDDDEp-60, 0x1.87F8488888889p-66, 0x1.9B37044444444p-74, 0x1.9C026AAAAAAABp-85 },
+		{ 0x1.F3F1088888889p-50, 0x1.1969244444444p-46, 0x1.8C92466666666p-45, 0x1.890C200000000p-44, 0x1.4927B9999999Ap-43, 0x1.F90BD9999999Ap-43, 0x1.6B440CCCCCCCDp-42, 0x1.F86C3BBBBBBBCp-42, 0x1.577B0AAAAAAABp-41, 0x1.D770F77777777p-41,
+		  0x1.1497D9999999Ap-43, 0x1.57BA5DDDDDDDEp-44, 0x1.03A7CAAAAAAABp-45, 0x1.D58AF33333333p-48, 0x1.02E5733333333p-50, 0x1.12465BBBBBBBCp-54, 0x1.3DD8844444444p-59, 0x1.1A557DDDDDDDEp-65, 0x1.2A080CCCCCCCDp-73, 0x1.26A0533333333p-84 },
+		{ -0x1.39FAEEEEEEEEFp-49, -0x1.67035DDDDDDDEp-46, -0x1.F4D56EEEEEEEFp-45, -0x1.F14DE66666666p-44, -0x1.A29A6AAAAAAABp-43, -0x1.3FF159999999Ap-42, -0x1.CC728CCCCCCCDp-42, -0x1.3F458CCCCCCCDp-41, -0x1.B2FFD9999999Ap-41, -0x1.2A49B33333333p-40,
+		  -0x1.6713A66666666p-43, -0x1.B70E444444444p-44, -0x1.4FEFAEEEEEEEFp-45, -0x1.305B377777777p-47, -0x1.3EC32EEEEEEEFp-50, -0x1.6534E22222222p-54, -0x1.8A47511111111p-59, -0x1.67F0155555555p-65, -0x1.7884044444444p-73, -0x1.7AF3A22222222p-84 },
+		{ -0x1.83EE5DDDDDDDEp-49, -0x1.B4DA7BBBBBBBCp-46, -0x1.336A2CCCCCCCDp-44, -0x1.30A7644444444p-43, -0x1.FE9F0CCCCCCCDp-43, -0x1.879A8CCCCCCCDp-42, -0x1.199E955555555p-41, -0x1.876819999999Ap-41, -0x1.0A65711111111p-40, -0x1.6D8BB33333333p-40,
+		  -0x1.B4AD088888889p-43, -0x1.0F7199999999Ap-43, -0x1.9A4C6AAAAAAABp-45, -0x1.735859999999Ap-47, -0x1.9875555555555p-50, -0x1.AFDEF33333333p-54, -0x1.F870088888889p-59, -0x1.B85DAEEEEEEEFp-65, -0x1.D357111111111p-73, -0x1.D110622222222p-84 },
+		{ 0x1.A345111111111p-50, 0x1.E075555555555p-47, 0x1.4EE5BBBBBBBBCp-45, 0x1.4C7799999999Ap-44, 0x1.1802777777777p-43, 0x1.ABF799999999Ap-43, 0x1.33E3000000000p-42, 0x1.AAE9777777777p-42, 0x1.22D9888888889p-41, 0x1.8EEF333333333p-41,
+		  0x1.E118666666666p-44, 0x1.2511DDDDDDDDEp-44, 0x1.C190666666666p-46, 0x1.9737DDDDDDDDEp-48, 0x1.A9ADBBBBBBBBCp-51, 0x1.DD26CCCCCCCCDp-55, 0x1.0776111111111p-59, 0x1.E26FDDDDDDDDEp-66, 0x1.F8CA888888889p-74, 0x1.FA56EEEEEEEEFp-85 },
+		{ 0x1.2F68CCCCCCCCDp-49, 0x1.55C5BBBBBBBBCp-46, 0x1.E076CCCCCCCCDp-45, 0x1.DC2ACCCCCCCCDp-44, 0x1.8F46000000000p-43, 0x1.321CEEEEEEEEFp-42, 0x1.B841DDDDDDDDEp-42, 0x1.321AAAAAAAAABp-41, 0x1.A090AAAAAAAABp-41, 0x1.1DBC444444444p-40,
+		  0x1.552D555555555p-43, 0x1.A854444444444p-44, 0x1.40DA000000000p-45, 0x1.2289BBBBBBBBCp-47, 0x1.3EC2666666666p-50, 0x1.5108888888889p-54, 0x1.8B05111111111p-59, 0x1.5568444444444p-65, 0x1.6B3B111111111p-73, 0x1.6B5B99999999Ap-84 },
+		{ -0x1.AB48888888889p-52, -0x1.EAEAAAAAAAAABp-49, -0x1.55EAAAAAAAAABp-47, -0x1.535BBBBBBBBBCp-46, -0x1.1E01111111111p-45, -0x1.B506666666666p-45, -0x1.3A54444444444p-44, -0x1.B3CEEEEEEEEEFp-44, -0x1.28EBBBBBBBBBCp-43, -0x1.9751111111111p-43,
+		  -0x1.EC17777777777p-46, -0x1.2A6AAAAAAAAABp-46, -0x1.CB42222222222p-48, -0x1.9FBDDDDDDDDDEp-50, -0x1.B197777777777p-53, -0x1.E65BBBBBBBBBCp-57, -0x1.0CD0000000000p-61, -0x1.ED20000000000p-68, -0x1.022BBBBBBBBBCp-75, -0x1.020EEEEEEEEEFp-86 },
+		{ -0x1.72B1111111111p-51, -0x1.A1A7777777777p-48, -0x1.254D555555555p-46, -0x1.22B4CCCCCCCCDp-45, -0x1.E7BAAAAAAAAABp-45, -0x1.75D6666666666p-44, -0x1.0CD4444444444p-43, -0x1.75F1111111111p-43, -0x1.FCCDDDDDDDDDEp-43, -0x1.5CF1111111111p-42,
+		  -0x1.A082222222222p-45, -0x1.031999999999Ap-45, -0x1.8801111111111p-47, -0x1.630DDDDDDDDDEp-49, -0x1.84A6666666666p-52, -0x1.9B4DDDDDDDDDEp-56, -0x1.E2A8888888889p-61, -0x1.9EB4444444444p-67, -0x1.B9AEEEEEEEEEFp-75, -0x1.BBA5555555555p-86 }
+	}
+};
+
+const double *const rys_table[RYS_TABLE_MAXQP - RYS_TABLE_MINQP + 1] = {
+	&rys_table_6[0][0][0], &rys_table_7[0][0][0], &rys_table_8[0][0][0], &rys_table_9[0][0][0], &rys_table_10[0][0][0]
+};
+
+const double rys_table_tmax[RYS_TABLE_MAXQP - RYS_TABLE_MINQP + 1] = {
+	68.0, 76.0, 80.0, 84.0, 92.0
+};
+
+/* T >= tmax: roots H (j)^2 / T and weights W (j) / sqrt(T), with H (j) the
+   positive roots and W (j) the weights of the 2*NGQP point Gauss-Hermite rule */
+const double rys_table_asymptotic[RYS_TABLE_MAXQP - RYS_TABLE_MINQP + 1][2 * RYS_TABLE_MAXQP] = {
+	{ 0x1.9477BFC007490p-4, 0x1.CBEE5960C2DEDp-1, 0x1.46BB433D480CCp+1, 0x1.4C8DC35767244p+2, 0x1.23F9D705393C3p+3, 0x1.E428A16A34F21p+3,
+	  0x1.23E8C40416D39p-1, 0x1.0ABE7F05C6B6Fp-2, 0x1.A6C5CA4DD8599p-5, 0x1.FFE329AD9CF5Fp-9, 0x1.679B437E4BBDCp-14, 0x1.1D75B65601410p-22 },
+	{ 0x1.5CA202C0F28F3p-4, 0x1.8B55A9552B9E1p-1, 0x1.171DA28F68A73p+1, 0x1.18F25DDD2E47Ep+2, 0x1.E3763B7726AF1p+2, 0x1.7FAE05E229F54p+3, 0x1.2873D31A7E634p+4,
+	  0x1.12A3CB9F3069Ap-1, 0x1.17A8FF2D23F15p-2, 0x1.189942515B4EAp-4, 0x1.013B082935900p-7, 0x1.745772989A757p-12, 0x1.3C84958FF0C41p-18, 0x1.2879E3FC189A4p-27 },
+	{ 0x1.3258F91C2758Ap-4, 0x1.5AC0647566296p-1, 0x1.E7B586F59FA88p+0, 0x1.E79CEBE1BB3B6p+1, 0x1.9EEBDACDCA993p+2, 0x1.42FC81EEA0951p+3, 0x1.DF1FC2D7FFD78p+3, 0x1.5FBF94E0E468Dp+4,
+	  0x1.040F552A19F20p-1, 0x1.1F620C20579F4p-2, 0x1.574932AE292A7p-4, 0x1.A60FE26755D4Fp-7, 0x1.E8C90A9EF9AA7p-11, 0x1.C6F9810BE5860p-16, 0x1.F26D457674892p-23, 0x1.23E62FEBCE393p-32 },
+	{ 0x1.11365BC892291p-4, 0x1.34DB6552D93C6p-1, 0x1.B140CDCF9F7DDp+0, 0x1.AF412B0393B98p+1, 0x1.6C716E9AE5488p+2, 0x1.18A1D8DDCC253p+3, 0x1.98B2CB162C608p+3, 0x1.20BE7C846FB2Dp+4, 0x1.97C692170EED2p+4,
+	  0x1.EF197ED269183p-2, 0x1.23A4856675DAAp-2, 0x1.8E8C46FF68D63p-4, 0x1.3166011CD5F16p-6, 0x1.EF109BBD31662p-10, 0x1.8115995E51ECAp-14, 0x1.E60B3A7E595E1p-20, 0x1.67A6840F8E9B6p-27, 0x1.136E27B821883p-37 },
+	{ 0x1.ED17E7D699930p-5, 0x1.1675CD0E3EDC6p-1, 0x1.85DFAA36591AAp+0, 0x1.82E1B7E3CA808p+1, 0x1.456F20EA76681p+2, 0x1.F1C1907A81DDCp+2, 0x1.66A900AC9F980p+3, 0x1.F1F50CCDEEF6Fp+3, 0x1.531A2E9949169p+4, 0x1.D0663253F56B3p+4,
+	  0x1.D956678EDEDF9p-2, 0x1.258E438063FD2p-2, 0x1.BE88D368EAADAp-4, 0x1.967EDDF3BC842p-6, 0x1.A92AF8D752191p-9, 0x1.DEDC5F2BDB140p-13, 0x1.05CF73262822Dp-17, 0x1.D276971597922p-24, 0x1.E3B670B9BE891p-32, 0x1.F603CB3708D0Ep-43 }
+};
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(pop)
+#endif
@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <math.h>
+
+#include "erd.h"
+#include "erdutil.h"
+#include "rys.h"
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(push, target(mic))
+#endif
+
+
+/* Roots and weights for one NGQP, inlined below with NGQP constant so the */
+/* 2*NGQP-wide Horner steps compile to straight vector code. */
+static ERD_FORCE_INLINE void rys_table_kernel(const uint32_t ngqp, uint32_t nt,
+    const double tval[restrict], double rts[restrict], double wts[restrict])
+{
+    const uint32_t nrw = 2 * ngqp;
+    const double *restrict table = rys_table[ngqp - RYS_TABLE_MINQP];
+    const double *restrict asym = rys_table_asymptotic[ngqp - RYS_TABLE_MINQP];
+    const double tmax = rys_table_tmax[ngqp - RYS_TABLE_MINQP];
+
+    for (uint32_t n = 0; n < nt; n++) {
+        const double t = tval[n];
+        double *restrict r = &rts[n * ngqp];
+        double *restrict w = &wts[n * ngqp];
+        if (t < tmax) {
+/*             ...Horner in the local variable u of the T-interval, */
+/*                for all roots and weights at once. */
+            const uint32_t tgrid = (uint32_t) (t * rys_table_tvstep);
+            const double u = 2.0 * (t * rys_table_tvstep - tgrid) - 1.0;
+            const double *restrict c = &table[tgrid * RYS_TABLE_NCOEF * nrw];
+            ERD_SIMD_ALIGN double p[nrw];
+            for (uint32_t j = 0; j < nrw; j++) {
+                p[j] = c[(RYS_TABLE_NCOEF - 1) * nrw + j];
+            }
+            for (int k = RYS_TABLE_NCOEF - 2; k >= 0; k--) {
+                for (uint32_t j = 0; j < nrw; j++) {
+                    p[j] = p[j] * u + c[k * nrw + j];
+                }
+            }
+            for (uint32_t j = 0; j < ngqp; j++) {
+                r[j] = p[j];
+                w[j] *= p[ngqp + j];
+            }
+        } else {
+/*             ...T >= tmax: Gauss-Hermite limit. */
+            const double tinv = 1.0 / t;
+            const double tsqrtinv = sqrt(tinv);
+            for (uint32_t j = 0; j < ngqp; j++) {
+                r[j] = asym[j] * tinv;
+                w[j] *= asym[ngqp + j] * tsqrtinv;
+            }
+        }
+    }
+}
+
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__RYS_TABLE_ROOTS_WEIGHTS */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation returns Rys polynomial roots and weights */
+/*                in case the number of roots and weights required */
+/*                is between 6 and 10. All T's are treated at once so */
+/*                the complete set of roots and weights is returned. */
+/*                Below a NGQP dependent tmax (68 for 6 roots up to 92 */
+/*                for 10) the roots and weights are piecewise polynomials */
+/*                of degree 14 on T-intervals of width 4, which were */
+/*                fitted to extended precision Rys quadratures (see */
+/*                rys.h); above it the Gauss-Hermite limit is exact to */
+/*                machine precision. The roots are accurate to about */
+/*                1.D-15 relative, the weights to about 1.D-14 relative */
+/*                to F0 (T). As in the 1...5 root routines the weights */
+/*                are multiplied into WTS. */
+/*                  Input: */
+/*                    NT           =  # of T-exponents */
+/*                    NGQP         =  # of roots and weights per T, */
+/*                                    6 <= NGQP <= 10 */
+/*                    TVAL         =  the set of NT T-exponents defining */
+/*                                    the Rys weight functions */
+/*                  Output: */
+/*                    RTS          =  all NT * NGQP quadrature roots */
+/*                    WTS          =  all NT * NGQP quadrature weights */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__rys_table_roots_weights(uint32_t nt, uint32_t ngqp,
+    const double tval[restrict], double rts[restrict], double wts[restrict])
+{
+    switch (ngqp) {
+        case 6:
+            rys_table_kernel(6, nt, tval, rts, wts);
+            break;
+        case 7:
+            rys_table_kernel(7, nt, tval, rts, wts);
+            break;
+        case 8:
+            rys_table_kernel(8, nt, tval, rts, wts);
+            break;
+        case 9:
+            rys_table_kernel(9, nt, tval, rts, wts);
+            break;
+        case 10:
+            rys_table_kernel(10, nt, tval, rts, wts);
+            break;
+        default:
+            assert(0);
+    }
+}
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(pop)
+#endif
@@ -233,11 +233,13 @@ ERD_OFFLOAD void erd__set_abcd(
     *nxyzet_ptr = nxyzet;
     *nxyzft_ptr = nxyzft;
     
-    if (shell[A] < shell[B]) {
+    /* ...equal shells are ordered by descending index, so that every */
+    /*    shell pair has one HRR matrix (see ERD__HRR_PAIR_MATRIX). */
+    if ((shell[A] < shell[B]) || ((shell[A] == shell[B]) && (A < B))) {
         ERD_SWAP(A, B);
         ERD_SWAP(indexa, indexb);
     }
-    if (shell[C] < shell[D]) {
+    if ((shell[C] < shell[D]) || ((shell[C] == shell[D]) && (C < D))) {
         ERD_SWAP(C, D);
         ERD_SWAP(indexc, indexd);
     }
@@ -265,84 +267,16 @@ ERD_OFFLOAD void erd__set_abcd(
     const uint32_t shella = shell[A], shellb = shell[B], shellc = shell[C], shelld = shell[D];
     const uint32_t shellp = shella + shellb;
     const uint32_t shellq = shellc + shelld;
-    const uint32_t nxyzp = (shellp + 1) * (shellp + 2) / 2;
-    const uint32_t nxyzq = (shellq + 1) * (shellq + 2) / 2;
     
     *ncolhrr = 0;
     *nrothrr = 0;
     if (shellb != 0) {
-        const uint32_t ngh = nxyzet;
-        uint32_t nxyzgo = nxyzet;
-        uint32_t nxyzho = 1;
-        uint32_t nxyzi = nxyzp;
-        uint32_t shellg = shellp;
-        uint32_t nrow = 1;
-        uint32_t ncol = ngh;
-        uint32_t nrot = ngh;
-        for (uint32_t shellh = 1; shellh <= shellb; shellh++) {
-            nxyzgo -= nxyzi;
-            nxyzho += shellh + 1;
-            const uint32_t ngho = nxyzgo * nxyzho;
-            switch (nabcoor) {
-                case 3:
-                {
-                    const uint32_t m = shellh / 3 + 1;
-                    nrow += m * m;
-                    if (shellh % 3 == 2)
-                        nrow += m;
-                    break;
-                }
-                case 2:
-                    nrow += shellh / 2 + 1;
-                    break;
-                case 1:
-                    ++nrow;
-                    break;
-            }
-            ncol = max32u(ngho, ncol);
-            nrot = max32u(nrow * ngho, nrot);
-            nxyzi = nxyzi - shellg - 1;
-            --shellg;
-        }
-        *ncolhrr = ncol;
-        *nrothrr = nrot;
+        uint32_t nrow;
+        erd__hrr_matrix_size(nxyzet, shellp, shellb, nabcoor, ncolhrr, nrothrr, &nrow);
     }
-/*             ...next find maximum values for the HRR on the CD-part */
-/*                and set overall maximum values. */
     if (shelld != 0) {
-        const uint32_t ngh = nxyzft;
-        uint32_t nxyzgo = nxyzft;
-        uint32_t nxyzho = 1;
-        uint32_t nxyzi = nxyzq;
-        uint32_t shellg = shellq;
-        uint32_t nrow = 1;
-        uint32_t ncol = ngh;
-        uint32_t nrot = ngh;
-        for (uint32_t shellh = 1; shellh <= shelld; shellh++) {
-            nxyzgo -= nxyzi;
-            nxyzho += shellh + 1;
-            const uint32_t ngho = nxyzgo * nxyzho;
-            switch (ncdcoor) {
-                case 3:
-                {
-                    const uint32_t m = shellh / 3 + 1;
-                    nrow += m * m;
-                    if (shellh % 3 == 2)
-                        nrow += m;
-                    break;
-                }
-                case 2:
-                    nrow += shellh / 2 + 1;
-                    break;
-                case 1:
-                    nrow += 1;
-                    break;
-            }
-            ncol = max32u(ngho, ncol);
-            nrot = max32u(nrow * ngho, nrot);
-            nxyzi -= shellg + 1;
-            --shellg;
-        }
+        uint32_t ncol, nrot, nrow;
+        erd__hrr_matrix_size(nxyzft, shellq, shelld, ncdcoor, &ncol, &nrot, &nrow);
         *ncolhrr = max32u(ncol, *ncolhrr);
         *nrothrr = max32u(nrot, *nrothrr);
     }
@@ -20,8 +20,6 @@ ERD_OFFLOAD static inline double square(double x) {
     return x * x;
 }
 
-ERD_OFFLOAD static const double TOL = 1.0e-14;
-
 ERD_OFFLOAD static const double c0 = 0x1.0B1A240FD5AF4p-8;
 ERD_OFFLOAD static const double c1 = 0x1.352866F31ED93p+0;
 ERD_OFFLOAD static const double c2 = -0x1.567450B98A180p-1;
@@ -88,9 +86,11 @@ ERD_OFFLOAD __attribute__((noinline)) uint32_t set_pairs(
     const double alphaa[restrict static npgtoa], const double alphab[restrict static npgtoa],
     uint32_t prima[restrict static npgtoa*npgtob], uint32_t primb[restrict static npgtoa*npgtob],
     double rho[restrict static npgtoa*npgtob],
-    double qmin, double smaxcd, double rminsq)
+    double qmin, double smaxcd, double rminsq, double tol)
 {
-    const double csmaxcd = smaxcd * (0x1.C5BF891B4EF6Bp-1 / TOL);
+    /* A non-positive tolerance keeps every primitive pair */
+    const bool screen = tol > 0.0;
+    const double csmaxcd = screen ? smaxcd * (0x1.C5BF891B4EF6Bp-1 / tol) : 0.0;
     uint32_t nij = 0;
     if (npgtoa > npgtob) {
         const double *restrict alphaa_copy = alphaa;
@@ -121,7 +121,7 @@ ERD_OFFLOAD __attribute__((noinline)) uint32_t set_pairs(
             /* approximates square(erf(sqrt(x))) on [0, 5] */
             const double f0 = c0 + x * (c1 + x * (c2 + x * (c3 + x * (c4 + x * c5))));
             const double f = f0 < 1.0 ? f0 : 1.0;
-            if (1){//ab*square(square(rhoab*csmaxcd) * (ab*f)) >= square((x*pqp)*square(p))) {
+            if (!screen || (ab*square(square(rhoab*csmaxcd) * (ab*f)) >= square((x*pqp)*square(p)))) {
                 rho[nij] = rhoab;
                 prima[nij] = i;
                 primb[nij] = j;
@@ -139,7 +139,7 @@ ERD_OFFLOAD void erd__set_ij_kl_pairs(
     double xb, double yb, double zb,
     double xc, double yc, double zc,
     double xd, double yd, double zd,
-    double rnabsq, double rncdsq, double prefact,
+    double rnabsq, double rncdsq, double prefact, double tol,
     const double alphaa[restrict static npgtoa],
     const double alphab[restrict static npgtob],
     const double alphac[restrict static npgtoc],
@@ -163,14 +163,14 @@ ERD_OFFLOAD void erd__set_ij_kl_pairs(
     const double smaxcd = prefact * pow3o4(cdmin) * __builtin_exp(-cdmin * rncdsq * qinv) * qinv;
 
     /* ...perform K2 primitive screening on A,B part. */
-    uint32_t nij = set_pairs(npgtoa, npgtob, rnabsq, alphaa, alphab, prima, primb, rhoab, qmin, smaxcd, rminsq);
+    uint32_t nij = set_pairs(npgtoa, npgtob, rnabsq, alphaa, alphab, prima, primb, rhoab, qmin, smaxcd, rminsq, tol);
     if (nij == 0) {
         *nij_ptr = 0;
         *nkl_ptr = 0;
         return;
     }
 
-    uint32_t nkl = set_pairs(npgtoc, npgtod, rncdsq, alphac, alphad, primc, primd, rhocd, pmin, smaxab, rminsq);
+    uint32_t nkl = set_pairs(npgtoc, npgtod, rncdsq, alphac, alphad, primc, primd, rhocd, pmin, smaxab, rminsq, tol);
     if (nkl == 0) {
         *nij_ptr = 0;
         *nkl_ptr = 0;
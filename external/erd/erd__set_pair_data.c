@@ -0,0 +1,314 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "erd.h"
+#include "erdutil.h"
+
+/* Estimate of the contribution of the primitive pair (a, b) of shells with
+   angular momenta la, lb: the [ss|ss] factor sqrt(PREFACT/sqrt(2)) |scale|
+   / p^(5/4) times the size (|PA| + 1/sqrt(2p))^la (|PB| + 1/sqrt(2p))^lb of
+   the angular part of the charge distribution. */
+ERD_OFFLOAD static inline double pair_bound(double a, double b, double rnabsq,
+    uint32_t la, uint32_t lb, double scale)
+{
+    const double p = a + b;
+    const double pinv = 1.0 / p;
+    const double width = sqrt(0.5 * pinv);
+    const double rnab = sqrt(rnabsq);
+    const double pa = b * pinv * rnab + width;
+    const double pb = a * pinv * rnab + width;
+    double angular = 1.0;
+    for (uint32_t l = 0; l < la; l++) {
+        angular *= pa;
+    }
+    for (uint32_t l = 0; l < lb; l++) {
+        angular *= pb;
+    }
+    return sqrt(PREFACT * M_SQRT1_2) * fabs(scale) * angular / (p * sqrt(sqrt(p)));
+}
+
+/* Coefficient of primitive i of a shell for the pair bounds: the only one
+   of a segmented contraction, the largest one in magnitude over the NCGTO
+   contractions (of NPGTO primitives each) of a general one */
+ERD_OFFLOAD static inline double bound_coefficient(const double cc[restrict],
+    uint32_t npgto, uint32_t ncgto, uint32_t i)
+{
+    double value = cc[i];
+    for (uint32_t r = 1; r < ncgto; r++) {
+        value = MAX(fabs(value), fabs(cc[r * npgto + i]));
+    }
+    return value;
+}
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__PAIR_DATA_SIZE */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation returns the # of flp words needed to */
+/*                hold the data of NPAIR primitive pairs as produced by */
+/*                ERD__SET_PAIR_DATA for a shell pair with NCTR */
+/*                contraction pairs. The data consists of ERD_PAIR_ARRAYS */
+/*                arrays, plus NCTR coefficient arrays if NCTR > 1, each */
+/*                padded to the SIMD length so that every array starts */
+/*                on a SIMD aligned address if the first one does. */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD size_t erd__pair_data_size(uint32_t npair, uint32_t nctr) {
+    return (ERD_PAIR_ARRAYS + ((nctr > 1) ? nctr : 0)) * PAD_LEN(npair);
+}
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__SET_PAIR_DATA */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation sets the primitive pair data of a list */
+/*                of NPAIR primitive pairs i,j for the shells A and B: */
+/*                       P      =  exponent sum a + b */
+/*                       PX..PZ =  gaussian product center */
+/*                       PINVHF =  1 / 2P */
+/*                       SCALE  =  norms * coefficients * exp(-ab/P AB^2) */
+/*                       BOUND  =  estimate of the pair contribution */
+/*                If A or B has more than one contraction, SCALE holds */
+/*                no coefficients and is followed by NCGTOA*NCGTOB */
+/*                arrays CTR, in which CTR (r + NCGTOA*s) holds the */
+/*                products of the coefficients of contraction r of A */
+/*                and s of B. The BOUND then takes the coefficients of */
+/*                largest magnitude over the contractions. */
+/*                The arrays are stored one after another in DATA with */
+/*                PAD_LEN (NPAIR) elements each and zeroed tails. The */
+/*                pairs are ordered by decreasing BOUND, which lets */
+/*                ERD__SCREEN_PAIR_DATA stop at the first pair that is */
+/*                screened out. */
+/*                  Input: */
+/*                    NPAIR       =  # of primitive pairs */
+/*                    PRIMA,PRIMB =  primitive indices i,j of the pairs */
+/*                    RHO         =  exponential prefactors of the pairs */
+/*                    XYZA,XYZB   =  the centers of shells A and B */
+/*                    SHELLA(B)   =  the shell types of A and B */
+/*                    NPGTOx      =  # of primitives of shell x */
+/*                    NCGTOx      =  # of contractions of shell x */
+/*                    ALPHAx      =  primitive exponents of shell x */
+/*                    CCx         =  contraction coefficients of shell x, */
+/*                                   the (i,r) element for primitive i */
+/*                                   and contraction r */
+/*                    NORMx       =  primitive norms of shell x */
+/*                  Output: */
+/*                    DATA        =  the primitive pair data */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__set_pair_data(uint32_t npair,
+    const uint32_t prima[restrict static npair], const uint32_t primb[restrict static npair], const double rho[restrict static npair],
+    const double xyza[restrict static 3], const double xyzb[restrict static 3],
+    uint32_t shella, uint32_t shellb,
+    uint32_t npgtoa, uint32_t npgtob, uint32_t ncgtoa, uint32_t ncgtob,
+    const double alphaa[restrict], const double alphab[restrict],
+    const double cca[restrict], const double ccb[restrict],
+    const double norma[restrict], const double normb[restrict],
+    double data[restrict])
+{
+    const size_t simd_npair = PAD_LEN(npair);
+    const uint32_t nctr = ncgtoa * ncgtob;
+    double *restrict p = &data[ERD_PAIR_P * simd_npair];
+    double *restrict px = &data[ERD_PAIR_PX * simd_npair];
+    double *restrict py = &data[ERD_PAIR_PY * simd_npair];
+    double *restrict pz = &data[ERD_PAIR_PZ * simd_npair];
+    double *restrict pinvhf = &data[ERD_PAIR_PINVHF * simd_npair];
+    double *restrict scale = &data[ERD_PAIR_SCALE * simd_npair];
+    double *restrict bound = &data[ERD_PAIR_BOUND * simd_npair];
+    ERD_ASSUME_ALIGNED(p, ERD_SIMD_SIZE)
+    ERD_ASSUME_ALIGNED(px, ERD_SIMD_SIZE)
+    ERD_ASSUME_ALIGNED(py, ERD_SIMD_SIZE)
+    ERD_ASSUME_ALIGNED(pz, ERD_SIMD_SIZE)
+    ERD_ASSUME_ALIGNED(pinvhf, ERD_SIMD_SIZE)
+    ERD_ASSUME_ALIGNED(scale, ERD_SIMD_SIZE)
+    ERD_ASSUME_ALIGNED(bound, ERD_SIMD_SIZE)
+    const double xa = xyza[0], ya = xyza[1], za = xyza[2];
+    const double xb = xyzb[0], yb = xyzb[1], zb = xyzb[2];
+    const double rnabsq = (xa - xb) * (xa - xb) + (ya - yb) * (ya - yb) + (za - zb) * (za - zb);
+
+/*             ...order the pairs by decreasing bound (insertion sort, */
+/*                the lists are short and often nearly sorted already). */
+    uint32_t order[npair];
+    double pbound[npair];
+    for (uint32_t ij = 0; ij < npair; ++ij) {
+        const uint32_t i = prima[ij];
+        const uint32_t j = primb[ij];
+        const double value = pair_bound(alphaa[i], alphab[j], rnabsq, shella, shellb,
+            norma[i] * normb[j] * rho[ij]
+            * bound_coefficient(cca, npgtoa, ncgtoa, i) * bound_coefficient(ccb, npgtob, ncgtob, j));
+        uint32_t n = ij;
+        while ((n > 0) && (pbound[n - 1] < value)) {
+            pbound[n] = pbound[n - 1];
+            order[n] = order[n - 1];
+            n--;
+        }
+        pbound[n] = value;
+        order[n] = ij;
+    }
+
+    for (uint32_t n = 0; n < npair; ++n) {
+        const uint32_t ij = order[n];
+        const uint32_t i = prima[ij];
+        const uint32_t j = primb[ij];
+        const double expa = alphaa[i];
+        const double expb = alphab[j];
+        const double pval = expa + expb;
+        const double pinv = 1.0 / pval;
+        p[n] = pval;
+        px[n] = (expa * xa + expb * xb) * pinv;
+        py[n] = (expa * ya + expb * yb) * pinv;
+        pz[n] = (expa * za + expb * zb) * pinv;
+        pinvhf[n] = pinv * 0.5;
+        if (nctr == 1) {
+            scale[n] = norma[i] * normb[j] * rho[ij] * cca[i] * ccb[j];
+        } else {
+            scale[n] = norma[i] * normb[j] * rho[ij];
+        }
+        bound[n] = pbound[n];
+    }
+    for (uint32_t n = npair; n < simd_npair; ++n) {
+        p[n] = 0.0;
+        px[n] = 0.0;
+        py[n] = 0.0;
+        pz[n] = 0.0;
+        pinvhf[n] = 0.0;
+        scale[n] = 0.0;
+        bound[n] = 0.0;
+    }
+
+/*             ...the coefficient products of the contraction pairs. */
+    if (nctr > 1) {
+        for (uint32_t s = 0; s < ncgtob; ++s) {
+            for (uint32_t r = 0; r < ncgtoa; ++r) {
+                double *restrict ctr = &data[(ERD_PAIR_ARRAYS + r + ncgtoa * s) * simd_npair];
+                for (uint32_t n = 0; n < npair; ++n) {
+                    const uint32_t ij = order[n];
+                    ctr[n] = cca[r * npgtoa + prima[ij]] * ccb[s * npgtob + primb[ij]];
+                }
+                for (uint32_t n = npair; n < simd_npair; ++n) {
+                    ctr[n] = 0.0;
+                }
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__SCREEN_PAIR_DATA */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation performs the primitive screening of a */
+/*                list of primitive pairs against the other pair of the */
+/*                quartet. A pair ij is kept if */
+/*                          BOUND (ij) * BOUND  >=  TOL */
+/*                where BOUND is the largest bound of the other pair. */
+/*                As the pairs are ordered by decreasing bound, the */
+/*                surviving pairs are the leading ones and the scan */
+/*                stops at the first pair screened out. */
+/*                  Input: */
+/*                    NPAIR       =  # of primitive pairs in DATA */
+/*                    DATA        =  the primitive pair data */
+/*                    BOUND       =  largest bound of the other pair */
+/*                    TOL         =  screening threshold, =< 0 keeps */
+/*                                   all pairs */
+/*                  Output: */
+/*                    Return      =  # of leading pairs to be kept */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD uint32_t erd__screen_pair_data(uint32_t npair, const double data[restrict static 1],
+    double bound, double tol)
+{
+    if (tol <= 0.0) {
+        return npair;
+    }
+    const double *restrict pbound = &data[ERD_PAIR_BOUND * PAD_LEN(npair)];
+    const double cutoff = tol / bound;
+    uint32_t n = 0;
+    while ((n < npair) && (pbound[n] >= cutoff)) {
+        n++;
+    }
+    return n;
+}
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__SHELL_PAIR_DATA */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : ERD__SET_PAIR_DATA */
+/*  DESCRIPTION : This operation determines the surviving primitive */
+/*                pairs of the shell pair A,B and sets their data. */
+/*                A primitive pair is dropped if its bound (see */
+/*                ERD__SET_PAIR_DATA) is below TOL. As 1/(PQ sqrt(P+Q)) */
+/*                =< 1/(sqrt(2) (PQ)^(5/4)), the product of the bounds */
+/*                of two pairs estimates their primitive integrals, */
+/*                hence TOL should contain the largest bound any other */
+/*                pair can have. The pair data depends only on the shell */
+/*                pair and is symmetric under A <-> B, so it can be */
+/*                computed once and used for every quartet. */
+/*                  Input: */
+/*                    A,B         =  the shell indices */
+/*                    NPGTO       =  # of primitives per shell */
+/*                    NCGTO       =  # of contractions per shell */
+/*                    SHELL       =  the shell types */
+/*                    XYZ0        =  the shell centers */
+/*                    ALPHA,CC    =  exponents and coefficients, the */
+/*                                   latter contraction by contraction */
+/*                    NORM        =  primitive norms */
+/*                    TOL         =  primitive pair bound threshold */
+/*                  Output: */
+/*                    DATA        =  the primitive pair data (may be */
+/*                                   NULL to count the pairs only) */
+/*                    BOUND       =  the largest primitive pair bound, */
+/*                                   including dropped pairs */
+/*                    Return      =  # of surviving primitive pairs */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD uint32_t erd__shell_pair_data(uint32_t A, uint32_t B,
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    double tol, double data[restrict], double bound[restrict static 1])
+{
+    const uint32_t npgtoa = npgto[A], npgtob = npgto[B];
+    const uint32_t ncgtoa = ncgto[A], ncgtob = ncgto[B];
+    const double *restrict alphaa = alpha[A], *restrict alphab = alpha[B];
+    const double *restrict cca = cc[A], *restrict ccb = cc[B];
+    const double *restrict norma = norm[A], *restrict normb = norm[B];
+    const double abx = xyz0[A*4] - xyz0[B*4];
+    const double aby = xyz0[A*4+1] - xyz0[B*4+1];
+    const double abz = xyz0[A*4+2] - xyz0[B*4+2];
+    const double rnabsq = abx * abx + aby * aby + abz * abz;
+
+    ERD_SIMD_ALIGN uint32_t prima[npgtoa * npgtob], primb[npgtoa * npgtob];
+    ERD_SIMD_ALIGN double rho[npgtoa * npgtob];
+    uint32_t npair = 0;
+    double maxbound = 0.0;
+    for (uint32_t i = 0; i < npgtoa; i++) {
+        const double a = alphaa[i];
+        const double cci = bound_coefficient(cca, npgtoa, ncgtoa, i);
+        for (uint32_t j = 0; j < npgtob; j++) {
+            const double b = alphab[j];
+            const double rhoab = exp(-a * b * rnabsq / (a + b));
+            const double pbound = pair_bound(a, b, rnabsq, shell[A], shell[B],
+                norma[i] * normb[j] * rhoab * cci * bound_coefficient(ccb, npgtob, ncgtob, j));
+            maxbound = MAX(maxbound, pbound);
+            if (pbound >= tol) {
+                prima[npair] = i;
+                primb[npair] = j;
+                rho[npair] = rhoab;
+                npair++;
+            }
+        }
+    }
+    *bound = maxbound;
+
+    if (data != NULL) {
+        erd__set_pair_data(npair, prima, primb, rho,
+            &xyz0[A*4], &xyz0[B*4], shell[A], shell[B],
+            npgtoa, npgtob, ncgtoa, ncgtob,
+            alphaa, alphab, cca, ccb, norma, normb,
+            data);
+    }
+    return npair;
+}
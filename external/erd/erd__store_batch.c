@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "erd.h"
+#include "erdutil.h"
+
+/* ------------------------------------------------------------------------ */
+/*  OPERATION   : ERD__STORE_BATCH */
+/*  MODULE      : ELECTRON REPULSION INTEGRALS DIRECT */
+/*  MODULE-ID   : ERD */
+/*  SUBROUTINES : none */
+/*  DESCRIPTION : This operation stores a finished batch of contracted */
+/*                integrals (1,2,3,4) into a caller supplied array with */
+/*                arbitrary strides for each of the four indices. The */
+/*                source batch may itself be strided, which allows the */
+/*                last ry-move of the HRR/spherical stage to be fused */
+/*                with the store: */
+/*                   x (i1*s1 + i2*s2 + i3*s3 + i4*s4) --> */
+/*                             y (i1*ld1 + i2*ld2 + i3*ld3 + i4*ld4) */
+/*                  Input: */
+/*                    N1,N2,N3,N4 =  # of functions for each index */
+/*                    S           =  strides of the four indices in X */
+/*                    X           =  batch of finished integrals */
+/*                    LD          =  strides of the four indices in Y */
+/*                  Output: */
+/*                    Y           =  caller array holding the batch */
+/* ------------------------------------------------------------------------ */
+ERD_OFFLOAD void erd__store_batch(uint32_t n1, uint32_t n2, uint32_t n3, uint32_t n4,
+    const uint32_t s[restrict static 4], const double x[restrict],
+    const size_t ld[restrict static 4], double y[restrict])
+{
+    const uint32_t s1 = s[0], s2 = s[1], s3 = s[2], s4 = s[3];
+    const size_t ld1 = ld[0], ld2 = ld[1], ld3 = ld[2], ld4 = ld[3];
+    for (uint32_t i4 = 0; i4 < n4; i4++) {
+        for (uint32_t i3 = 0; i3 < n3; i3++) {
+            for (uint32_t i2 = 0; i2 < n2; i2++) {
+                const double *restrict xrow = &x[i2 * s2 + i3 * s3 + i4 * s4];
+                double *restrict yrow = &y[i2 * ld2 + i3 * ld3 + i4 * ld4];
+                if ((s1 == 1) && (ld1 == 1)) {
+                    for (uint32_t i1 = 0; i1 < n1; i1++) {
+                        yrow[i1] = xrow[i1];
+                    }
+                } else {
+                    for (uint32_t i1 = 0; i1 < n1; i1++) {
+                        yrow[i1 * ld1] = xrow[i1 * s1];
+                    }
+                }
+            }
+        }
+    }
+}
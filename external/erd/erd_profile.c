@@ -24,7 +24,7 @@ static char ticks_name[erd__num_ticks][128] =
     "erd__ctr_4index_block",
     "erd__xyz_to_ry_abcd",
     "erd__hrr_matrix",
-    "erd__hrr_transform",
+    "erd__hrr_ry_transform",
     "erd__move_ry",
     "erd__spherical_transform",
     "@erd__csgto",
@@ -36,8 +36,13 @@ static char ticks_name[erd__num_ticks][128] =
     "erd__sspp_pcgto_block",
     "erd__sppp_pcgto_block",
     "erd__pppp_pcgto_block",
+    "erd__llll_pcgto_block",
     "erd__1111_ctr_4index_block",
-    "@erd__1111_csgto"
+    "@erd__1111_csgto",
+
+    "erd__2222_set_ij_kl_pairs",
+    "erd__2222_pcgto_block",
+    "@erd__2222_csgto"
 };
 
 
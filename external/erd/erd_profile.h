@@ -22,7 +22,7 @@ typedef enum
     
     erd__xyz_to_ry_abcd_ticks           = 8,
     erd__hrr_matrix_ticks               = 9,
-    erd__hrr_transform_ticks            = 10,
+    erd__hrr_ry_transform_ticks         = 10,
     erd__move_ry_ticks                  = 11,
     erd__spherical_transform_ticks      = 12,
     erd__csgto_ticks                    = 13,
@@ -35,8 +35,14 @@ typedef enum
     erd__sspp_pcgto_block_ticks         = 18,
     erd__sppp_pcgto_block_ticks         = 19,
     erd__pppp_pcgto_block_ticks         = 20,
-    erd__1111_ctr_4index_block_ticks    = 21,
-    erd__1111_csgto_ticks               = 22,
+    erd__llll_pcgto_block_ticks         = 21,
+    erd__1111_ctr_4index_block_ticks    = 22,
+    erd__1111_csgto_ticks               = 23,
+
+    // 2222 case
+    erd__2222_set_ij_kl_pairs_ticks     = 24,
+    erd__2222_pcgto_block_ticks         = 25,
+    erd__2222_csgto_ticks               = 26,
     erd__num_ticks
 } ErdTicks_t;
 
@@ -27,7 +27,11 @@
     #define ERD_PROFILE_END(function)
 #endif
 
-#if defined(__MIC__) || defined(__AVX512F__)
+/* Padding and alignment must follow SIMDW in erd.h */
+#if defined(ERD_DISPATCH)
+    #define ERD_SIMD_SIZE 32
+    #define ERD_SIMD_WIDTH 4
+#elif defined(__MIC__)
     #define ERD_SIMD_SIZE 64
     #define ERD_SIMD_WIDTH 8
 #elif defined(__AVX__)
@@ -44,13 +48,19 @@
 #define ERD_ALIGN(alignment) __attribute__((aligned(alignment)))
 #define ERD_SIMD_ALIGN ERD_ALIGN(ERD_SIMD_SIZE)
 
+#define ERD_FORCE_INLINE inline __attribute__((always_inline))
+
 #ifdef __INTEL_COMPILER
     #define ERD_ASSUME_ALIGNED(pointer, alignment) __assume_aligned(pointer, alignment);
 #else
     #define ERD_ASSUME_ALIGNED(pointer, alignment) pointer = __builtin_assume_aligned(pointer, alignment);
 #endif
 
-#if defined(__MIC__) || defined(__AVX512F__)
+#if defined(ERD_DISPATCH)
+    #define ERD_SIMD_ZERO_TAIL_64f(array, simd_length) \
+        _mm_store_pd(&array[simd_length - 4], _mm_setzero_pd()); \
+        _mm_store_pd(&array[simd_length - 2], _mm_setzero_pd())
+#elif defined(__MIC__)
     #define ERD_SIMD_ZERO_TAIL_64f(array, simd_length) _mm512_store_pd(&array[simd_length - ERD_SIMD_WIDTH], _mm512_setzero_pd())
 #elif defined(__AVX__)
     #define ERD_SIMD_ZERO_TAIL_64f(array, simd_length) _mm256_store_pd(&array[simd_length - ERD_SIMD_WIDTH], _mm256_setzero_pd())
@@ -60,11 +70,25 @@
     #define ERD_SIMD_ZERO_TAIL_64f(array, simd_length)
 #endif
 
+/* Scratch arenas: the kernels carve their per-call temporaries out of a
+   caller-owned arena instead of the stack. Blocks are handed out in steps
+   of ERD_SCRATCH_ALIGN bytes, so each keeps the alignment of the arena, and
+   a scope releases its blocks by restoring the arena pointer it started
+   with. ERD_SCRATCH_SIZE is the arena space of one block. */
+#define ERD_SCRATCH_ALIGN 64
+#define ERD_SCRATCH_SIZE(bytes) (((bytes) + ERD_SCRATCH_ALIGN - 1) / ERD_SCRATCH_ALIGN * ERD_SCRATCH_ALIGN)
+
 #define ERD_SWAP(x, y) \
     ({ __typeof__(x) __temp = x; \
     x = y; \
     y = __temp; })
 
+ERD_OFFLOAD static inline void *erd__scratch_alloc(char **arena, size_t bytes) {
+    void *block = *arena;
+    *arena += ERD_SCRATCH_SIZE(bytes);
+    return __builtin_assume_aligned(block, ERD_SCRATCH_ALIGN);
+}
+
 ERD_OFFLOAD static inline uint32_t max32u(uint32_t a, uint32_t b) {
     return a > b ? a : b;
 }
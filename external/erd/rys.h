@@ -0,0 +1,25 @@
+#pragma once
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(push, target(mic))
+#endif
+
+/* Piecewise polynomial fits of the Rys roots and weights for NGQP = 6...10.
+   The T-range [0,tmax) is cut into intervals of width rys_table_tstep, on each
+   the NGQP roots and NGQP weights are polynomials of degree RYS_TABLE_NCOEF-1 in
+   u = 2 * (T * rys_table_tvstep - tgrid) - 1, stored coefficient by coefficient:
+   rys_table[NGQP-6][(tgrid * RYS_TABLE_NCOEF + k) * 2*NGQP + j]. */
+#define RYS_TABLE_MINQP      6
+#define RYS_TABLE_MAXQP     10
+#define RYS_TABLE_NCOEF     15
+
+static const double rys_table_tstep = 4.0;
+static const double rys_table_tvstep = 0.25;
+
+extern const double *const rys_table[RYS_TABLE_MAXQP - RYS_TABLE_MINQP + 1];
+extern const double rys_table_tmax[RYS_TABLE_MAXQP - RYS_TABLE_MINQP + 1];
+extern const double rys_table_asymptotic[RYS_TABLE_MAXQP - RYS_TABLE_MINQP + 1][2 * RYS_TABLE_MAXQP];
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(pop)
+#endif
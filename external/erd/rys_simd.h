@@ -0,0 +1,149 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "erd.h"
+#include "erdutil.h"
+
+/* Explicit SIMD evaluation of the 1...5 root routines: the T-values of a
+   batch are binned by the T-range of the scalar code, and each bin is run
+   through that range's formulas RYS_SIMDW T-values at a time. The range
+   formulas are the scalar ones on the vector type rys_vd. */
+#if !defined (__MIC__) && (defined (__AVX512F__) || (defined (__AVX2__) && defined (__FMA__)))
+#define RYS_SIMD
+
+#if defined (__AVX512F__)
+#define RYS_SIMDW 8
+#else
+#define RYS_SIMDW 4
+#endif
+
+#define RYS_MAXRANGE ERD_RYS_MAXRANGE
+#define RYS_BLOCK ERD_RYS_BLOCK
+
+#if RYS_SIMDW > ERD_RYS_MAXSIMDW
+#error "erd__rys_scratch_size does not cover RYS_SIMDW"
+#endif
+
+typedef double rys_vd __attribute__((vector_size(8 * RYS_SIMDW)));
+typedef int64_t rys_vl __attribute__((vector_size(8 * RYS_SIMDW)));
+
+typedef void (*rys_range_kernel_t) (rys_vd t, rys_vd r[], rys_vd w[]);
+
+static ERD_FORCE_INLINE rys_vd rys_sqrt (rys_vd x)
+{
+#if defined (__AVX512F__)
+    return (rys_vd) _mm512_sqrt_pd((__m512d) x);
+#else
+    return (rys_vd) _mm256_sqrt_pd((__m256d) x);
+#endif
+}
+
+
+/* exp (x) for -708 < x < 709 to about 1 ulp: x = k*ln2 + y with |y| <= ln2/2,
+   exp (y) by its Taylor series to y^13, and 2^k built in the exponent bits. */
+static ERD_FORCE_INLINE rys_vd rys_exp (rys_vd x)
+{
+    const double shift = 0x1.8p52;
+    rys_vd k = x * 0x1.71547652B82FEp0 + shift;
+    const rys_vl kbits = (rys_vl) k;
+    k = k - shift;
+    rys_vd y = x - k * 0x1.62E42FEFA3800p-1;
+    y = y - k * 0x1.EF35793C76730p-45;
+
+    rys_vd p = y * (1.0 / 6227020800.0) + (1.0 / 479001600.0);
+    p = p * y + (1.0 / 39916800.0);
+    p = p * y + (1.0 / 3628800.0);
+    p = p * y + (1.0 / 362880.0);
+    p = p * y + (1.0 / 40320.0);
+    p = p * y + (1.0 / 5040.0);
+    p = p * y + (1.0 / 720.0);
+    p = p * y + (1.0 / 120.0);
+    p = p * y + (1.0 / 24.0);
+    p = p * y + (1.0 / 6.0);
+    p = p * y + 0.5;
+    p = p * y + 1.0;
+    p = p * y + 1.0;
+
+    const rys_vl scale = (kbits - 0x4338000000000000LL + 1023) << 52;
+    return p * (rys_vd) scale;
+}
+
+
+/* Bins the T-values by RANGE (t) and evaluates each bin with its range
+   kernel, which returns the NROOTS roots and weights of RYS_SIMDW T-values.
+   The T-values are copied bin by bin into TS, each bin padded with its first
+   T-value to whole vectors, and the results are copied back from RS and WS
+   in one pass, so that no vector is assembled from or split into lanes. The
+   NT T-values go through this in blocks of RYS_BLOCK, which bounds the
+   buffers; they are taken from SCRATCH (see erd__rys_scratch_size). As in
+   the scalar routines the weights are multiplied into WTS. */
+static ERD_FORCE_INLINE void rys_simd_roots_weights (const int nroots, const int nrange,
+                                                     int (*range) (double t),
+                                                     const rys_range_kernel_t kernel[],
+                                                     int nt, const double tval[restrict],
+                                                     double rts[restrict], double wts[restrict],
+                                                     void *restrict scratch)
+{
+    const int mb = nt < RYS_BLOCK ? nt : RYS_BLOCK;
+    const int mp = mb + RYS_MAXRANGE * RYS_SIMDW;
+    char *arena = scratch;
+    int *restrict bin = erd__scratch_alloc(&arena, sizeof(int) * mb);
+    int *restrict index = erd__scratch_alloc(&arena, sizeof(int) * mb);
+    double *restrict ts = erd__scratch_alloc(&arena, sizeof(double) * mp);
+    double *restrict rs = erd__scratch_alloc(&arena, sizeof(double) * nroots * mp);
+    double *restrict ws = erd__scratch_alloc(&arena, sizeof(double) * nroots * mp);
+
+    for (int n0 = 0; n0 < nt; n0 += RYS_BLOCK) {
+        const int nb = nt - n0 < RYS_BLOCK ? nt - n0 : RYS_BLOCK;
+        const double *restrict tb = &tval[n0];
+        double *restrict rb = &rts[n0 * nroots];
+        double *restrict wb = &wts[n0 * nroots];
+
+        int count[RYS_MAXRANGE] = { 0 };
+        for (int n = 0; n < nb; n++) {
+            bin[n] = range(tb[n]);
+            count[bin[n]]++;
+        }
+        int start[RYS_MAXRANGE + 1];
+        start[0] = 0;
+        for (int b = 0; b < nrange; b++) {
+            start[b + 1] = start[b] + (count[b] + RYS_SIMDW - 1) / RYS_SIMDW * RYS_SIMDW;
+        }
+        const int np = start[nrange];
+
+        int next[RYS_MAXRANGE];
+        memcpy(next, start, sizeof(next));
+        for (int n = 0; n < nb; n++) {
+            const int p = next[bin[n]]++;
+            index[n] = p;
+            ts[p] = tb[n];
+        }
+        for (int b = 0; b < nrange; b++) {
+            for (int p = next[b]; p < start[b + 1]; p++) {
+                ts[p] = ts[start[b]];
+            }
+        }
+
+        for (int b = 0; b < nrange; b++) {
+            for (int k = start[b]; k < start[b + 1]; k += RYS_SIMDW) {
+                rys_vd r[nroots], w[nroots];
+                kernel[b](*(const rys_vd *) &ts[k], r, w);
+                for (int j = 0; j < nroots; j++) {
+                    *(rys_vd *) &rs[j * np + k] = r[j];
+                    *(rys_vd *) &ws[j * np + k] = w[j];
+                }
+            }
+        }
+
+        for (int n = 0; n < nb; n++) {
+            const int p = index[n];
+            for (int j = 0; j < nroots; j++) {
+                rb[n * nroots + j] = rs[j * np + p];
+                wb[n * nroots + j] *= ws[j * np + p];
+            }
+        }
+    }
+}
+#endif
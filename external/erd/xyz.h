@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(push, target(mic))
+#endif
+
+/* Number of cartesian monomials of a shell and of all shells below it */
+#define NXYZ(l)         (((l) + 1) * ((l) + 2) / 2)
+#define NXYZ_BELOW(l)   ((l) * ((l) + 1) * ((l) + 2) / 6)
+
+/* Cartesian monomials of the s- to g-shells in ERD order, numbered
+   consecutively across the shells */
+static const uint8_t xyz_exponent[35][3] = {
+    {0, 0, 0},
+    {1, 0, 0}, {0, 1, 0}, {0, 0, 1},
+    {2, 0, 0}, {1, 1, 0}, {1, 0, 1}, {0, 2, 0}, {0, 1, 1}, {0, 0, 2},
+    {3, 0, 0}, {2, 1, 0}, {2, 0, 1}, {1, 2, 0}, {1, 1, 1}, {1, 0, 2}, {0, 3, 0}, {0, 2, 1}, {0, 1, 2}, {0, 0, 3},
+    {4, 0, 0}, {3, 1, 0}, {3, 0, 1}, {2, 2, 0}, {2, 1, 1}, {2, 0, 2}, {1, 3, 0}, {1, 2, 1}, {1, 1, 2}, {1, 0, 3},
+    {0, 4, 0}, {0, 3, 1}, {0, 2, 2}, {0, 1, 3}, {0, 0, 4}
+};
+
+/* Direction in which a monomial is reached by the recurrences: the one
+   with the largest exponent, which has the fewest terms */
+static const uint8_t xyz_axis[35] = {
+    0,
+    0, 1, 2,
+    0, 0, 0, 1, 1, 2,
+    0, 0, 0, 1, 0, 2, 1, 1, 2, 2,
+    0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 1, 2, 2
+};
+
+/* Monomial with the exponent in x,y,z lowered by one (0 if that exponent is 0) */
+static const uint8_t xyz_lower[35][3] = {
+    {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {1, 0, 0}, {2, 1, 0}, {3, 0, 1}, {0, 2, 0}, {0, 3, 2}, {0, 0, 3},
+    {4, 0, 0}, {5, 4, 0}, {6, 0, 4}, {7, 5, 0}, {8, 6, 5}, {9, 0, 6}, {0, 7, 0}, {0, 8, 7}, {0, 9, 8}, {0, 0, 9},
+    {10, 0, 0}, {11, 10, 0}, {12, 0, 10}, {13, 11, 0}, {14, 12, 11}, {15, 0, 12}, {16, 13, 0}, {17, 14, 13}, {18, 15, 14}, {19, 0, 15},
+    {0, 16, 0}, {0, 17, 16}, {0, 18, 17}, {0, 19, 18}, {0, 0, 19}
+};
+
+/* Monomial with the exponent in x,y,z raised by one, up to the f-shell */
+static const uint8_t xyz_raise[20][3] = {
+    {1, 2, 3},
+    {4, 5, 6}, {5, 7, 8}, {6, 8, 9},
+    {10, 11, 12}, {11, 13, 14}, {12, 14, 15}, {13, 16, 17}, {14, 17, 18}, {15, 18, 19},
+    {20, 21, 22}, {21, 23, 24}, {22, 24, 25}, {23, 26, 27}, {24, 27, 28}, {25, 28, 29}, {26, 30, 31}, {27, 31, 32}, {28, 32, 33}, {29, 33, 34}
+};
+
+#ifdef __INTEL_OFFLOAD
+#pragma offload_attribute(pop)
+#endif
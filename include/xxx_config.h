@@ -27,9 +27,11 @@
 #define ERD_RECORD_CPI_RATIO 1
 #define ERD_RECORD_BRMISS_RATIO 0
 #define ERD_RECORD_BRANCH_RATIO 0
+#define ERD_RECORD_LLCREF_RATIO 0
 #define ERD_RECORD_GPINSTR_RATIO 0
 #define ERD_RECORD_RATIO \
     (ERD_RECORD_CPI_RATIO || \
     ERD_RECORD_BRMISS_RATIO || \
     ERD_RECORD_BRANCH_RATIO || \
+    ERD_RECORD_LLCREF_RATIO || \
     ERD_RECORD_GPINSTR_RATIO)
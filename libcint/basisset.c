@@ -99,6 +99,129 @@ static void normalization (BasisSet_t basis)
 }
 
 
+/* Merges every s-shell of an element that is followed by a p-shell of the
+   same exponents into one L-shell of momentum 1: its cc and norm hold the
+   s-values of the exponents and then the p-values. */
+static void merge_lshells (BasisSet_t basis)
+{
+    int nshells = 0;
+    int totnexp = 0;
+    for (int a = 0; a < basis->bs_natoms; a++)
+    {
+        const int start = basis->bs_atom_start[a];
+        const int end = basis->bs_atom_start[a + 1];
+        basis->bs_atom_start[a] = nshells;
+        for (int i = start; i < end; i++)
+        {
+            const int nexp = basis->bs_nexp[i];
+            if (i + 1 < end &&
+                basis->bs_momentum[i] == 0 &&
+                basis->bs_momentum[i + 1] == 1 &&
+                basis->bs_ncgto[i] == 1 &&
+                basis->bs_ncgto[i + 1] == 1 &&
+                basis->bs_nexp[i + 1] == nexp &&
+                memcmp (basis->bs_exp[i], basis->bs_exp[i + 1],
+                        sizeof(double) * nexp) == 0)
+            {
+                double *cc = (double *)ALIGNED_MALLOC (sizeof(double) * 2 * nexp);
+                double *norm = (double *)ALIGNED_MALLOC (sizeof(double) * 2 * nexp);
+                CINT_ASSERT(cc != NULL);
+                CINT_ASSERT(norm != NULL);
+                memcpy (cc, basis->bs_cc[i], sizeof(double) * nexp);
+                memcpy (&cc[nexp], basis->bs_cc[i + 1], sizeof(double) * nexp);
+                memcpy (norm, basis->bs_norm[i], sizeof(double) * nexp);
+                memcpy (&norm[nexp], basis->bs_norm[i + 1], sizeof(double) * nexp);
+                ALIGNED_FREE (basis->bs_cc[i]);
+                ALIGNED_FREE (basis->bs_cc[i + 1]);
+                ALIGNED_FREE (basis->bs_norm[i]);
+                ALIGNED_FREE (basis->bs_norm[i + 1]);
+                ALIGNED_FREE (basis->bs_exp[i + 1]);
+                basis->bs_nexp[nshells] = nexp;
+                basis->bs_ncgto[nshells] = 1;
+                basis->bs_lshell[nshells] = 1;
+                basis->bs_momentum[nshells] = 1;
+                basis->bs_cc[nshells] = cc;
+                basis->bs_exp[nshells] = basis->bs_exp[i];
+                basis->bs_norm[nshells] = norm;
+                i++;
+            }
+            else
+            {
+                basis->bs_nexp[nshells] = nexp;
+                basis->bs_ncgto[nshells] = basis->bs_ncgto[i];
+                basis->bs_lshell[nshells] = basis->bs_lshell[i];
+                basis->bs_momentum[nshells] = basis->bs_momentum[i];
+                basis->bs_cc[nshells] = basis->bs_cc[i];
+                basis->bs_exp[nshells] = basis->bs_exp[i];
+                basis->bs_norm[nshells] = basis->bs_norm[i];
+            }
+            totnexp += nexp;
+            nshells++;
+        }
+    }
+    basis->bs_atom_start[basis->bs_natoms] = nshells;
+    basis->bs_nshells = nshells;
+    basis->bs_totnexp = totnexp;
+}
+
+
+/* Merges the consecutive shells of every element that have the same momentum
+   and exponents into one generally contracted shell: the coefficients of
+   each merged shell are appended to its cc as another contraction. The
+   norms only depend on the exponents and the momentum. L-shells are left
+   as they are. */
+static void merge_contractions (BasisSet_t basis)
+{
+    int nshells = 0;
+    int totnexp = 0;
+    for (int a = 0; a < basis->bs_natoms; a++)
+    {
+        const int start = basis->bs_atom_start[a];
+        const int end = basis->bs_atom_start[a + 1];
+        basis->bs_atom_start[a] = nshells;
+        for (int i = start; i < end; i++)
+        {
+            const int last = nshells - 1;
+            const int nexp = basis->bs_nexp[i];
+            if (nshells > basis->bs_atom_start[a] &&
+                !basis->bs_lshell[last] && !basis->bs_lshell[i] &&
+                basis->bs_momentum[last] == basis->bs_momentum[i] &&
+                basis->bs_nexp[last] == nexp &&
+                memcmp (basis->bs_exp[last], basis->bs_exp[i],
+                        sizeof(double) * nexp) == 0)
+            {
+                const int ncgto = basis->bs_ncgto[last];
+                double *cc = (double *)ALIGNED_MALLOC (sizeof(double) * nexp * (ncgto + 1));
+                CINT_ASSERT(cc != NULL);
+                memcpy (cc, basis->bs_cc[last], sizeof(double) * nexp * ncgto);
+                memcpy (&cc[nexp * ncgto], basis->bs_cc[i], sizeof(double) * nexp);
+                ALIGNED_FREE (basis->bs_cc[last]);
+                ALIGNED_FREE (basis->bs_cc[i]);
+                ALIGNED_FREE (basis->bs_exp[i]);
+                ALIGNED_FREE (basis->bs_norm[i]);
+                basis->bs_cc[last] = cc;
+                basis->bs_ncgto[last] = ncgto + 1;
+            }
+            else
+            {
+                basis->bs_nexp[nshells] = nexp;
+                basis->bs_ncgto[nshells] = basis->bs_ncgto[i];
+                basis->bs_lshell[nshells] = basis->bs_lshell[i];
+                basis->bs_momentum[nshells] = basis->bs_momentum[i];
+                basis->bs_cc[nshells] = basis->bs_cc[i];
+                basis->bs_exp[nshells] = basis->bs_exp[i];
+                basis->bs_norm[nshells] = basis->bs_norm[i];
+                totnexp += nexp;
+                nshells++;
+            }
+        }
+    }
+    basis->bs_atom_start[basis->bs_natoms] = nshells;
+    basis->bs_nshells = nshells;
+    basis->bs_totnexp = totnexp;
+}
+
+
 void _maxMomentum (BasisSet_t basis, int *max_momentum)
 {
     *max_momentum = basis->max_momentum;
@@ -131,6 +254,17 @@ static inline double vector_min(size_t length, const double vector[restrict stat
 }
 
 
+/* # of functions of shell i of the basis set: those of each contraction and
+   the s-function of an L-shell */
+static inline int shell_nfuncs (BasisSet_t basis, int i)
+{
+    const int momentum = basis->bs_momentum[i];
+    const int nfuncs = (basis->basistype == SPHERICAL) ?
+        2 * momentum + 1 : (momentum + 1) * (momentum + 2) / 2;
+    return nfuncs * basis->bs_ncgto[i] + basis->bs_lshell[i];
+}
+
+
 CIntStatus_t CInt_createBasisSet (BasisSet_t *_basis)
 {
     BasisSet_t basis;
@@ -174,11 +308,18 @@ CIntStatus_t CInt_destroyBasisSet (BasisSet_t basis)
     free (basis->bs_eptr);
     free (basis->bs_atom_start);
     free (basis->bs_nexp);
+    free (basis->bs_ncgto);
+    free (basis->bs_lshell);
     free (basis->bs_momentum);
+    free (basis->ncgto);
+    free (basis->lshell);
     free (basis->cc);
     free (basis->exp);
     free (basis->minexp);
     free (basis->norm);
+    free (basis->atom_perm);
+    free (basis->shell_perm);
+    free (basis->func_perm);
 
     free (basis);
 
@@ -186,6 +327,271 @@ CIntStatus_t CInt_destroyBasisSet (BasisSet_t basis)
 }
 
 
+/* Position of integer point (x, y, z), 0 <= x, y, z < 2^bits, along the
+   Z-order (Morton) curve: the bits of x, y and z interleaved */
+static uint64_t morton_key (uint32_t x, uint32_t y, uint32_t z, int bits)
+{
+    uint64_t key = 0;
+    for (int b = bits - 1; b >= 0; b--)
+    {
+        key = (key << 3) | (((x >> b) & 1) << 2) | (((y >> b) & 1) << 1) | ((z >> b) & 1);
+    }
+    return key;
+}
+
+
+/* Position along the Hilbert curve: Skilling's transform of the coordinates
+   into the transposed Hilbert index, which is then read as a Morton key */
+static uint64_t hilbert_key (uint32_t x, uint32_t y, uint32_t z, int bits)
+{
+    uint32_t X[3] = {x, y, z};
+    const uint32_t M = 1u << (bits - 1);
+    // inverse undo
+    for (uint32_t Q = M; Q > 1; Q >>= 1)
+    {
+        const uint32_t P = Q - 1;
+        for (int i = 0; i < 3; i++)
+        {
+            if (X[i] & Q)
+            {
+                X[0] ^= P;
+            }
+            else
+            {
+                const uint32_t t = (X[0] ^ X[i]) & P;
+                X[0] ^= t;
+                X[i] ^= t;
+            }
+        }
+    }
+    // Gray encode
+    for (int i = 1; i < 3; i++)
+    {
+        X[i] ^= X[i - 1];
+    }
+    uint32_t t = 0;
+    for (uint32_t Q = M; Q > 1; Q >>= 1)
+    {
+        if (X[2] & Q)
+        {
+            t ^= Q - 1;
+        }
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        X[i] ^= t;
+    }
+    return morton_key(X[0], X[1], X[2], bits);
+}
+
+
+typedef struct
+{
+    uint64_t key;
+    int id;
+} AtomKey;
+
+
+static int compare_atom_keys (const void *a, const void *b)
+{
+    const AtomKey *x = (const AtomKey *)a;
+    const AtomKey *y = (const AtomKey *)b;
+    if (x->key != y->key)
+    {
+        return (x->key < y->key) ? -1 : 1;
+    }
+    return x->id - y->id;
+}
+
+
+/* Renumbers the atoms along the requested curve through their bounding box
+   and records the input index of every atom in atom_perm */
+static CIntStatus_t order_atoms (BasisSet_t basis)
+{
+    const int natoms = basis->natoms;
+    const int bits = 21;
+    free (basis->atom_perm);
+    basis->atom_perm = (int *)malloc (sizeof(int) * natoms);
+    CINT_ASSERT(basis->atom_perm != NULL);
+    if (basis->ordering == CINT_ORDER_INPUT)
+    {
+        for (int i = 0; i < natoms; i++)
+        {
+            basis->atom_perm[i] = i;
+        }
+        return CINT_STATUS_SUCCESS;
+    }
+
+    double lo[3] = {basis->xn[0], basis->yn[0], basis->zn[0]};
+    double hi[3] = {basis->xn[0], basis->yn[0], basis->zn[0]};
+    for (int i = 1; i < natoms; i++)
+    {
+        const double r[3] = {basis->xn[i], basis->yn[i], basis->zn[i]};
+        for (int k = 0; k < 3; k++)
+        {
+            lo[k] = (r[k] < lo[k]) ? r[k] : lo[k];
+            hi[k] = (r[k] > hi[k]) ? r[k] : hi[k];
+        }
+    }
+    // one scale for all axes keeps the curve isotropic
+    double extent = 0.0;
+    for (int k = 0; k < 3; k++)
+    {
+        extent = (hi[k] - lo[k] > extent) ? hi[k] - lo[k] : extent;
+    }
+    const double scale = (extent > 0.0) ? ((double)((1u << bits) - 1) / extent) : 0.0;
+
+    AtomKey *keys = (AtomKey *)malloc (sizeof(AtomKey) * natoms);
+    double *buf = (double *)malloc (sizeof(double) * natoms * 4);
+    int *ibuf = (int *)malloc (sizeof(int) * natoms);
+    CINT_ASSERT(keys != NULL && buf != NULL && ibuf != NULL);
+    for (int i = 0; i < natoms; i++)
+    {
+        const uint32_t x = (uint32_t)((basis->xn[i] - lo[0]) * scale);
+        const uint32_t y = (uint32_t)((basis->yn[i] - lo[1]) * scale);
+        const uint32_t z = (uint32_t)((basis->zn[i] - lo[2]) * scale);
+        keys[i].key = (basis->ordering == CINT_ORDER_HILBERT) ?
+            hilbert_key (x, y, z, bits) : morton_key (x, y, z, bits);
+        keys[i].id = i;
+    }
+    qsort (keys, natoms, sizeof(AtomKey), compare_atom_keys);
+
+    for (int i = 0; i < natoms; i++)
+    {
+        const int a = keys[i].id;
+        basis->atom_perm[i] = a;
+        buf[4 * i + 0] = basis->xn[a];
+        buf[4 * i + 1] = basis->yn[a];
+        buf[4 * i + 2] = basis->zn[a];
+        buf[4 * i + 3] = basis->charge[a];
+        ibuf[i] = basis->eid[a];
+    }
+    for (int i = 0; i < natoms; i++)
+    {
+        basis->xn[i] = buf[4 * i + 0];
+        basis->yn[i] = buf[4 * i + 1];
+        basis->zn[i] = buf[4 * i + 2];
+        basis->charge[i] = buf[4 * i + 3];
+        basis->eid[i] = ibuf[i];
+    }
+    free (keys);
+    free (buf);
+    free (ibuf);
+
+    return CINT_STATUS_SUCCESS;
+}
+
+
+/* Shell and function permutations from atom_perm and the shell numbering */
+static CIntStatus_t set_permutations (BasisSet_t basis)
+{
+    const int natoms = basis->natoms;
+    const int nshells = basis->nshells;
+    free (basis->shell_perm);
+    free (basis->func_perm);
+    basis->shell_perm = (int *)malloc (sizeof(int) * nshells);
+    basis->func_perm = (int *)malloc (sizeof(int) * basis->nfunctions);
+    int *atom_shell = (int *)malloc (sizeof(int) * (natoms + 1));
+    int *shell_func = (int *)malloc (sizeof(int) * (nshells + 1));
+    CINT_ASSERT(basis->shell_perm != NULL && basis->func_perm != NULL);
+    CINT_ASSERT(atom_shell != NULL && shell_func != NULL);
+
+    // first shell of every atom in the input order
+    atom_shell[0] = 0;
+    for (int a = 0; a < natoms; a++)
+    {
+        atom_shell[a + 1] = 0;
+    }
+    for (int i = 0; i < natoms; i++)
+    {
+        atom_shell[basis->atom_perm[i] + 1] =
+            basis->s_start_id[i + 1] - basis->s_start_id[i];
+    }
+    for (int a = 0; a < natoms; a++)
+    {
+        atom_shell[a + 1] += atom_shell[a];
+    }
+    for (int i = 0; i < natoms; i++)
+    {
+        const int start = atom_shell[basis->atom_perm[i]];
+        for (uint32_t s = basis->s_start_id[i]; s < basis->s_start_id[i + 1]; s++)
+        {
+            basis->shell_perm[s] = start + s - basis->s_start_id[i];
+        }
+    }
+
+    // first function of every shell in the input order
+    shell_func[0] = 0;
+    for (int s = 0; s < nshells; s++)
+    {
+        shell_func[basis->shell_perm[s] + 1] =
+            basis->f_end_id[s] - basis->f_start_id[s] + 1;
+    }
+    for (int s = 0; s < nshells; s++)
+    {
+        shell_func[s + 1] += shell_func[s];
+    }
+    for (int s = 0; s < nshells; s++)
+    {
+        const int start = shell_func[basis->shell_perm[s]];
+        for (uint32_t f = basis->f_start_id[s]; f <= basis->f_end_id[s]; f++)
+        {
+            basis->func_perm[f] = start + f - basis->f_start_id[s];
+        }
+    }
+    free (atom_shell);
+    free (shell_func);
+
+    return CINT_STATUS_SUCCESS;
+}
+
+
+CIntStatus_t CInt_setBasisOrdering (BasisSet_t basis, CIntOrdering_t ordering)
+{
+    if (ordering != CINT_ORDER_INPUT &&
+        ordering != CINT_ORDER_MORTON &&
+        ordering != CINT_ORDER_HILBERT)
+    {
+        CINT_PRINTF (1, "invalid basis ordering %d\n", ordering);
+        return CINT_STATUS_INVALID_VALUE;
+    }
+    basis->ordering = ordering;
+    return CINT_STATUS_SUCCESS;
+}
+
+
+CIntStatus_t CInt_setGeneralContraction (BasisSet_t basis, int enable)
+{
+    basis->general = (enable != 0);
+    return CINT_STATUS_SUCCESS;
+}
+
+
+CIntStatus_t CInt_setLShells (BasisSet_t basis, int enable)
+{
+    basis->lshells = (enable != 0);
+    return CINT_STATUS_SUCCESS;
+}
+
+
+const int *CInt_getAtomPermutation (BasisSet_t basis)
+{
+    return basis->atom_perm;
+}
+
+
+const int *CInt_getShellPermutation (BasisSet_t basis)
+{
+    return basis->shell_perm;
+}
+
+
+const int *CInt_getFuncPermutation (BasisSet_t basis)
+{
+    return basis->func_perm;
+}
+
+
 CIntStatus_t parse_molecule (BasisSet_t basis)
 {
     int natoms;
@@ -195,10 +601,18 @@ CIntStatus_t parse_molecule (BasisSet_t basis)
     int max_momentum;
     int max_nexp;
     int max_nexp_id;
+    int max_ncgto;
     int eid;
     int atom_start;
     int atom_end;
 
+    // renumber atoms
+    CIntStatus_t status = order_atoms (basis);
+    if (status != CINT_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
     // get lengths
     natoms = basis->natoms;
     nshells = 0;
@@ -218,6 +632,8 @@ CIntStatus_t parse_molecule (BasisSet_t basis)
     basis->xyz0 = (double *)ALIGNED_MALLOC(sizeof(double) * nshells * 4);
 #endif
     basis->nexp = (uint32_t *)malloc(sizeof(uint32_t) * nshells);
+    basis->ncgto = (uint32_t *)malloc(sizeof(uint32_t) * nshells);
+    basis->lshell = (uint32_t *)malloc(sizeof(uint32_t) * nshells);
     basis->cc = (double **)malloc(sizeof(double *) * nshells);
     basis->exp = (double **)malloc(sizeof(double *) * nshells);
     basis->minexp = (double*)malloc(sizeof(double) * nshells);
@@ -228,6 +644,8 @@ CIntStatus_t parse_molecule (BasisSet_t basis)
     CINT_ASSERT(basis->f_end_id != NULL);
     CINT_ASSERT(basis->xyz0 != NULL);
     CINT_ASSERT(basis->nexp != NULL);
+    CINT_ASSERT(basis->ncgto != NULL);
+    CINT_ASSERT(basis->lshell != NULL);
     CINT_ASSERT(basis->cc != NULL);
     CINT_ASSERT(basis->minexp != NULL);
     CINT_ASSERT(basis->norm != NULL);
@@ -241,6 +659,7 @@ CIntStatus_t parse_molecule (BasisSet_t basis)
     max_momentum = 0;
     max_nexp = 0;
     max_nexp_id = 0;
+    max_ncgto = 0;
     for (uint32_t i = 0; i < natoms; i++) {
         eid = basis->eid[i];    
         atom_start = basis->bs_atom_start[basis->bs_eptr[eid - 1]];
@@ -251,6 +670,8 @@ CIntStatus_t parse_molecule (BasisSet_t basis)
         for (uint32_t j = atom_start; j < atom_end; j++) {
             basis->f_start_id[nshells + j - atom_start] = nfunctions;
             basis->nexp[nshells + j - atom_start] = basis->bs_nexp[j];
+            basis->ncgto[nshells + j - atom_start] = basis->bs_ncgto[j];
+            basis->lshell[nshells + j - atom_start] = basis->bs_lshell[j];
             basis->xyz0[(nshells + j - atom_start) * 4 + 0] = basis->xn[i];
             basis->xyz0[(nshells + j - atom_start) * 4 + 1] = basis->yn[i];
             basis->xyz0[(nshells + j - atom_start) * 4 + 2] = basis->zn[i];
@@ -261,20 +682,15 @@ CIntStatus_t parse_molecule (BasisSet_t basis)
                 max_nexp = basis->bs_nexp[j];
                 max_nexp_id = nshells + j - atom_start;
             }
+            max_ncgto = (max_ncgto > basis->bs_ncgto[j] ?
+                max_ncgto : basis->bs_ncgto[j]);
             basis->cc[nshells + j - atom_start] = basis->bs_cc[j];
             basis->exp[nshells + j - atom_start] = basis->bs_exp[j];
             basis->minexp[nshells + j - atom_start] = vector_min(basis->nexp[nshells + j - atom_start], basis->exp[nshells + j - atom_start]);
             basis->norm[nshells + j - atom_start] = basis->bs_norm[j];
-            if (basis->basistype == SPHERICAL) {
-                nfunctions += 2 * basis->bs_momentum[j] + 1;
-                maxdim = (2 * basis->bs_momentum[j] + 1) > maxdim ?
-                    (2 * basis->bs_momentum[j] + 1) : maxdim;
-            }
-            else if (basis->basistype == CARTESIAN) {
-                nfunctions += (basis->bs_momentum[j] + 1)*(basis->bs_momentum[j] + 2)/2;
-                maxdim = ((basis->bs_momentum[j] + 1)*(basis->bs_momentum[j] + 2)/2) > maxdim ?
-                    ((basis->bs_momentum[j] + 1)*(basis->bs_momentum[j] + 2)/2) : maxdim;
-            }
+            const int nfuncs = shell_nfuncs (basis, j);
+            nfunctions += nfuncs;
+            maxdim = (nfuncs > maxdim ? nfuncs : maxdim);
             basis->f_end_id[nshells + j - atom_start] = nfunctions - 1;
         }
         nshells += atom_end - atom_start;
@@ -285,8 +701,9 @@ CIntStatus_t parse_molecule (BasisSet_t basis)
     basis->max_momentum = max_momentum;
     basis->max_nexp = max_nexp;
     basis->max_nexp_id = max_nexp_id;
+    basis->max_ncgto = max_ncgto;
     
-    return CINT_STATUS_SUCCESS;
+    return set_permutations (basis);
 }
 
 
@@ -338,6 +755,8 @@ CIntStatus_t CInt_unpackBasisSet (BasisSet_t basis, void *buf)
     basis->bs_atom_start = (int *)malloc(sizeof(int) * (basis->bs_natoms + 1)); 
     basis->bs_momentum = (int *)malloc(sizeof(int) * basis->bs_nshells);
     basis->bs_nexp = (int *)malloc(sizeof(int) * basis->bs_nshells);
+    basis->bs_ncgto = (int *)malloc(sizeof(int) * basis->bs_nshells);
+    basis->bs_lshell = (int *)malloc(sizeof(int) * basis->bs_nshells);
     CINT_ASSERT(basis->bs_cc != NULL);
     CINT_ASSERT(basis->bs_exp != NULL);
     CINT_ASSERT(basis->bs_norm != NULL);
@@ -345,23 +764,31 @@ CIntStatus_t CInt_unpackBasisSet (BasisSet_t basis, void *buf)
     CINT_ASSERT(basis->bs_atom_start != NULL);
     CINT_ASSERT(basis->bs_momentum != NULL);
     CINT_ASSERT(basis->bs_nexp != NULL);
+    CINT_ASSERT(basis->bs_ncgto != NULL);
+    CINT_ASSERT(basis->bs_lshell != NULL);
 
     memcpy(basis->bs_nexp, &(_buf[offset]), sizeof(int) * basis->bs_nshells);
     offset += sizeof(int) * basis->bs_nshells;
+    memcpy(basis->bs_ncgto, &(_buf[offset]), sizeof(int) * basis->bs_nshells);
+    offset += sizeof(int) * basis->bs_nshells;
+    memcpy(basis->bs_lshell, &(_buf[offset]), sizeof(int) * basis->bs_nshells);
+    offset += sizeof(int) * basis->bs_nshells;
     for (int i = 0; i < basis->bs_nshells; i++) {
         int nexp = basis->bs_nexp[i];
-        basis->bs_cc[i] = (double *)ALIGNED_MALLOC(sizeof(double) * nexp);
+        int ncc = nexp * (basis->bs_ncgto[i] + basis->bs_lshell[i]);
+        int nnorm = nexp * (1 + basis->bs_lshell[i]);
+        basis->bs_cc[i] = (double *)ALIGNED_MALLOC(sizeof(double) * ncc);
         basis->bs_exp[i] = (double *)ALIGNED_MALLOC(sizeof(double) * nexp);
-        basis->bs_norm[i] = (double *)ALIGNED_MALLOC(sizeof(double) * nexp);
+        basis->bs_norm[i] = (double *)ALIGNED_MALLOC(sizeof(double) * nnorm);
         CINT_ASSERT(basis->bs_cc[i] != NULL);
         CINT_ASSERT(basis->bs_exp[i] != NULL);
         CINT_ASSERT(basis->bs_norm[i] != NULL);
         memcpy(basis->bs_exp[i], &(_buf[offset]), sizeof(double) * nexp);
         offset += sizeof(double) * nexp;
-        memcpy(basis->bs_cc[i], &(_buf[offset]), sizeof(double) * nexp);
-        offset += sizeof(double) * nexp;
-        memcpy(basis->bs_norm[i], &(_buf[offset]), sizeof(double) * nexp);
-        offset += sizeof(double) * nexp;
+        memcpy(basis->bs_cc[i], &(_buf[offset]), sizeof(double) * ncc);
+        offset += sizeof(double) * ncc;
+        memcpy(basis->bs_norm[i], &(_buf[offset]), sizeof(double) * nnorm);
+        offset += sizeof(double) * nnorm;
     }
     memcpy(basis->bs_eptr, &(_buf[offset]), sizeof(int) * basis->bs_nelements);
     offset += sizeof(int) * basis->bs_nelements;
@@ -575,6 +1002,8 @@ CIntStatus_t import_basis (char *file, BasisSet_t basis)
     basis->bs_eptr = (int *)malloc (sizeof(int) * basis->bs_nelements);
     basis->bs_atom_start = (int *)malloc (sizeof(int) * (natoms + 1));
     basis->bs_nexp = (int *)malloc (sizeof(int) * nshells);
+    basis->bs_ncgto = (int *)malloc (sizeof(int) * nshells);
+    basis->bs_lshell = (int *)malloc (sizeof(int) * nshells);
     basis->bs_cc = (double **)malloc (sizeof(double *) * nshells);
     basis->bs_norm = (double **)malloc (sizeof(double *) * nshells);
     basis->bs_exp = (double **)malloc (sizeof(double *) * nshells);
@@ -583,6 +1012,8 @@ CIntStatus_t import_basis (char *file, BasisSet_t basis)
     CINT_ASSERT(basis->bs_eptr != NULL);
     CINT_ASSERT(basis->bs_atom_start != NULL);
     CINT_ASSERT(basis->bs_nexp != NULL);
+    CINT_ASSERT(basis->bs_ncgto != NULL);
+    CINT_ASSERT(basis->bs_lshell != NULL);
     CINT_ASSERT(basis->bs_cc != NULL);
     CINT_ASSERT(basis->bs_norm != NULL);
     CINT_ASSERT(basis->bs_exp != NULL);
@@ -637,6 +1068,8 @@ CIntStatus_t import_basis (char *file, BasisSet_t basis)
                     for (i = 0; i < ns; i++)
                     {
                         basis->bs_nexp[nshells] = nexp;
+                        basis->bs_ncgto[nshells] = 1;
+                        basis->bs_lshell[nshells] = 0;
                         basis->bs_cc[nshells] = (double *)ALIGNED_MALLOC (sizeof(double) * nexp);
                         basis->bs_exp[nshells] = (double *)ALIGNED_MALLOC (sizeof(double) * nexp);
                         basis->bs_norm[nshells] = (double *)ALIGNED_MALLOC (sizeof(double) * nexp);
@@ -693,6 +1126,14 @@ CIntStatus_t import_basis (char *file, BasisSet_t basis)
     fclose (fp);
 
     normalization (basis);
+    if (basis->lshells)
+    {
+        merge_lshells (basis);
+    }
+    if (basis->general)
+    {
+        merge_contractions (basis);
+    }
     
     return CINT_STATUS_SUCCESS;
 }
@@ -723,16 +1164,7 @@ CIntStatus_t import_guess(char *file, BasisSet_t basis)
         int nfunctions = 0;
         for (int j = atom_start; j < atom_end; j++)
         {
-            if (basis->basistype == SPHERICAL)
-            {
-                nfunctions +=
-                    2 * basis->bs_momentum[j] + 1;
-            }
-            else if (basis->basistype == CARTESIAN)
-            {
-                nfunctions +=
-                    (basis->bs_momentum[j] + 1)*(basis->bs_momentum[j] + 2)/2;
-            }
+            nfunctions += shell_nfuncs (basis, j);
         }
         basis->guess[i] =
             (double *)malloc(sizeof(double) * nfunctions * nfunctions);
@@ -786,11 +1218,21 @@ CIntStatus_t CInt_packBasisSet (BasisSet_t basis,
     int offset;
     int i;
     int nexp;
-    
+    int ncc;
+    int nnorm;
+    int totncc;
+
+    // an L-shell has an s- and a p-value of cc and norm per exponent
+    totncc = 0;
+    for (i = 0; i < basis->bs_nshells; i++)
+    {
+        totncc += basis->bs_nexp[i] *
+            (basis->bs_ncgto[i] + 2 * basis->bs_lshell[i]);
+    }
     _bufsize = 6 * sizeof(int) + (4 * basis->natoms) * sizeof(double) +                
-               (2 * basis->bs_nshells + basis->bs_nelements + basis->natoms
+               (4 * basis->bs_nshells + basis->bs_nelements + basis->natoms
                 + basis->bs_natoms + 3) * sizeof(int) +
-                basis->bs_totnexp * 3 * sizeof(double);
+                (basis->bs_totnexp * 2 + totncc) * sizeof(double);
     _buf = (char *)malloc(_bufsize);
     assert(_buf != NULL);
     offset = 0;
@@ -822,15 +1264,21 @@ CIntStatus_t CInt_packBasisSet (BasisSet_t basis,
     offset += sizeof(int) * basis->natoms;
     memcpy(&(_buf[offset]), basis->bs_nexp, sizeof(int) * basis->bs_nshells);
     offset += sizeof(int) * basis->bs_nshells;
+    memcpy(&(_buf[offset]), basis->bs_ncgto, sizeof(int) * basis->bs_nshells);
+    offset += sizeof(int) * basis->bs_nshells;
+    memcpy(&(_buf[offset]), basis->bs_lshell, sizeof(int) * basis->bs_nshells);
+    offset += sizeof(int) * basis->bs_nshells;
     for (i = 0; i < basis->bs_nshells; i++)
     {
         nexp = basis->bs_nexp[i];
+        ncc = nexp * (basis->bs_ncgto[i] + basis->bs_lshell[i]);
+        nnorm = nexp * (1 + basis->bs_lshell[i]);
         memcpy(&(_buf[offset]), basis->bs_exp[i], sizeof(double) * nexp);
         offset += sizeof(double) * nexp;
-        memcpy(&(_buf[offset]), basis->bs_cc[i], sizeof(double) * nexp);
-        offset += sizeof(double) * nexp;
-        memcpy(&(_buf[offset]), basis->bs_norm[i], sizeof(double) * nexp);
-        offset += sizeof(double) * nexp;
+        memcpy(&(_buf[offset]), basis->bs_cc[i], sizeof(double) * ncc);
+        offset += sizeof(double) * ncc;
+        memcpy(&(_buf[offset]), basis->bs_norm[i], sizeof(double) * nnorm);
+        offset += sizeof(double) * nnorm;
         assert (offset < _bufsize);
     }
     memcpy(&(_buf[offset]), basis->bs_eptr, sizeof(int) * basis->bs_nelements);
@@ -878,6 +1326,8 @@ CIntStatus_t CInt_importBasisSet(BasisSet_t basis,
     basis->bs_eptr = (int *)malloc(sizeof(int) * basis->bs_nelements);
     basis->bs_atom_start = (int *)malloc(sizeof(int) * (natoms + 1));
     basis->bs_nexp = (int *)malloc(sizeof(int) * nshells);
+    basis->bs_ncgto = (int *)malloc(sizeof(int) * nshells);
+    basis->bs_lshell = (int *)malloc(sizeof(int) * nshells);
     basis->bs_cc = (double **)malloc(sizeof(double *) * nshells);
     basis->bs_norm = (double **)malloc(sizeof(double *) * nshells);
     basis->bs_exp = (double **)malloc(sizeof(double *) * nshells);
@@ -886,6 +1336,8 @@ CIntStatus_t CInt_importBasisSet(BasisSet_t basis,
     CINT_ASSERT(basis->bs_eptr != NULL);
     CINT_ASSERT(basis->bs_atom_start != NULL);
     CINT_ASSERT(basis->bs_nexp != NULL);
+    CINT_ASSERT(basis->bs_ncgto != NULL);
+    CINT_ASSERT(basis->bs_lshell != NULL);
     CINT_ASSERT(basis->bs_cc != NULL);
     CINT_ASSERT(basis->bs_norm != NULL);
     CINT_ASSERT(basis->bs_exp != NULL);
@@ -906,6 +1358,8 @@ CIntStatus_t CInt_importBasisSet(BasisSet_t basis,
             CINT_ASSERT(j < nshells);
             int nexp = prims_p_shell[j];
             basis->bs_nexp[j] = nexp;
+            basis->bs_ncgto[j] = 1;
+            basis->bs_lshell[j] = 0;
             basis->bs_momentum[j] = L[j];
             // copy cc, alpha and norm
             basis->bs_cc[j] =
@@ -925,6 +1379,12 @@ CIntStatus_t CInt_importBasisSet(BasisSet_t basis,
     }
     CINT_ASSERT(num_prims == basis->bs_totnexp);
     normalization(basis);
+    if (basis->lshells) {
+        merge_lshells(basis);
+    }
+    if (basis->general) {
+        merge_contractions(basis);
+    }
     
     // import molecule
     basis->natoms = natoms;
@@ -2,12 +2,16 @@
 #define __CINT_DEF_H__
 
 #include "cint_type.h"
+#include <stddef.h>
 #include <stdint.h>
 #include <unistd.h>
 
 typedef struct OED *OED_t;
 typedef struct ERD *ERD_t;
 typedef struct BasisSet *BasisSet_t;
+typedef struct Schwarz *Schwarz_t;
+typedef struct Scheduler *Scheduler_t;
+typedef struct FockPlan *FockPlan_t;
 
 
 typedef enum
@@ -23,6 +27,26 @@ typedef enum
 } CIntStatus_t;
 
 
+/* Numbering of atoms, and with them shells and functions, at basis load */
+typedef enum
+{
+    CINT_ORDER_INPUT = 0,
+    CINT_ORDER_MORTON = 1,
+    CINT_ORDER_HILBERT = 2
+} CIntOrdering_t;
+
+
+/* Instruction set level of the ERD kernels (see CInt_getERDISA) */
+typedef enum
+{
+    CINT_ISA_SSE4 = 1,
+    CINT_ISA_AVX = 2,
+    CINT_ISA_AVX2 = 3,
+    CINT_ISA_AVX512 = 4,
+    CINT_ISA_MIC = 5
+} CIntISA_t;
+
+
 #ifdef __INTEL_OFFLOAD
 extern __declspec(target(mic)) ERD_t erd_mic;
 extern __declspec(target(mic)) BasisSet_t basis_mic;
@@ -64,6 +88,40 @@ CIntStatus_t CInt_packBasisSet( BasisSet_t basis,
                                 void **buf,
                                 int *bufsize );
 
+/* Numbers the atoms along a space-filling curve through the molecule when
+   the basis set is loaded or imported, so that shells close in space get
+   close indices and screened shell pair lists become block banded. Must be
+   called before CInt_loadBasisSet or CInt_importBasisSet. Integrals, D, J
+   and K then use the internal numbering; CInt_get*Permutation map it back
+   to the input order. */
+CIntStatus_t CInt_setBasisOrdering( BasisSet_t basis,
+                                    CIntOrdering_t ordering );
+
+/* Merges consecutive shells of an element with the same angular momentum and
+   the same exponents into one generally contracted shell when the basis set
+   is loaded or imported, so that the primitive integrals of the exponents are
+   computed once for all its contractions. The functions keep their numbers;
+   the contractions of a merged shell follow each other in it. Must be called
+   before CInt_loadBasisSet or CInt_importBasisSet. */
+CIntStatus_t CInt_setGeneralContraction( BasisSet_t basis,
+                                         int enable );
+
+/* Keeps the SP shells of the basis set, that is an s-shell followed by a
+   p-shell of the same exponents, together as one L-shell of 4 functions
+   (s, px, py, pz) when the basis set is loaded or imported, so that the
+   quartets of s-, p- and L-shells evaluate all their s- and p-parts at once.
+   The functions keep their numbers. Must be called before
+   CInt_loadBasisSet or CInt_importBasisSet. */
+CIntStatus_t CInt_setLShells( BasisSet_t basis,
+                              int enable );
+
+/* perm[i] is the input-order index of internal atom/shell/function i */
+const int *CInt_getAtomPermutation( BasisSet_t basis );
+
+const int *CInt_getShellPermutation( BasisSet_t basis );
+
+const int *CInt_getFuncPermutation( BasisSet_t basis );
+
 int CInt_getNumShells( BasisSet_t basis );
 
 int CInt_getNumFuncs( BasisSet_t basis );
@@ -144,6 +202,12 @@ double CInt_getNucEnergy (BasisSet_t basis);
 #pragma offload_attribute(push, target(mic))
 #endif
 
+/* Libraries built for the x86 architecture carry the hot ERD kernels for
+   every ISA level and pick the best one for the CPU here. The CINT_ISA
+   environment variable (sse4, avx, avx2 or avx512) caps the level, e.g.
+   for benchmarking. The primitive quartets of a batch are evaluated in
+   blocks sized for the L2 cache of the CPU, which CINT_L2_CACHE (in KB)
+   overrides. Both selections apply to all ERD handles. */
 CIntStatus_t CInt_createERD( BasisSet_t basis,
                              ERD_t *erd,
                              int nthreads );
@@ -161,24 +225,195 @@ CIntStatus_t CInt_computeShellQuartet( BasisSet_t basis,
                                        double **integrals,
                                        int *nints );
 
+/* Computes the quartet (A, B, C, D) straight into caller memory: integral
+   (a, b, c, d) is stored at dst[a*ld[0] + b*ld[1] + c*ld[2] + d*ld[3]].
+   Screened-out quartets set *nints to 0 and leave dst untouched. */
+CIntStatus_t CInt_computeShellQuartetInto( BasisSet_t basis,
+                                           ERD_t erd,
+                                           int tid,
+                                           int A,
+                                           int B,
+                                           int C,
+                                           int D,
+                                           double *dst,
+                                           const size_t ld[4],
+                                           int *nints );
+
+/* Computes the quartets (A, B[i], C, D[i]) for i < shellIndicesCount and stores
+   them back to back in integrals. Quartet i occupies integralsCounts[i] values
+   starting at integrals[integralsOffsets[i]]; screened-out quartets get count 0.
+   A capacity of shellIndicesCount * maxdim^4 (CInt_getMaxShellDim) always
+   suffices; with less, CINT_STATUS_INVALID_VALUE is returned once a quartet
+   does not fit, and that and all later quartets get count 0. Listing the
+   quartets with B outer and D inner shares the AB pair setup across them. */
 CIntStatus_t CInt_computeShellQuartets(BasisSet_t basis,
                                        ERD_t erd,
                                        uint32_t threadId,
-                                       uint32_t shellIndixA,
+                                       uint32_t shellIndexA,
                                        const uint32_t* shellIndicesB,
-                                       uint32_t shellIndixC,
+                                       uint32_t shellIndexC,
                                        const uint32_t* shellIndicesD,
                                        uint32_t shellIndicesCount,
-                                       double **integrals,
-                                       int *integralsCount);
+                                       double *integrals,
+                                       size_t integralsCapacity,
+                                       size_t *integralsOffsets,
+                                       uint32_t *integralsCounts);
+
+/* Computes the diagonal elements (mn|mn) of the quartet (M, N, M, N), as needed
+   for Schwarz bounds: *integrals points to *nints values, with (mn|mn) at
+   m + dimM * n for the functions m of M and n of N. Screened-out quartets set
+   *nints to 0. */
+CIntStatus_t CInt_computeShellPairDiagonal(BasisSet_t basis,
+                                           ERD_t erd,
+                                           int tid,
+                                           int M,
+                                           int N,
+                                           double **integrals,
+                                           int *nints);
 
 void CInt_getMaxMemory( ERD_t erd,
                         double *memsize );
 
+/* Primitive screening threshold: primitive quartets whose estimated
+   contribution is below tolerance are skipped. 0 evaluates all of them
+   (default ERD_PRIMITIVE_TOL); negative values are rejected. */
+CIntStatus_t CInt_setPrimitiveScreening( ERD_t erd,
+                                         double tolerance );
+
+double CInt_getPrimitiveScreening( ERD_t erd );
+
+/* ISA level of the kernels chosen by CInt_createERD */
+CIntISA_t CInt_getERDISA( ERD_t erd );
+
+/* Relative cost of CInt_computeShellQuartet(A, B, C, D) from the angular
+   momenta, the primitive pairs surviving in the pair cache and the number
+   of Rys roots, in units of about one floating-point operation */
+double CInt_getQuartetCost( BasisSet_t basis,
+                            ERD_t erd,
+                            int A,
+                            int B,
+                            int C,
+                            int D );
+
 #ifdef __INTEL_OFFLOAD
 #pragma offload_attribute(pop)
 #endif
 
+// Schwarz screening
+/* Computes max |(mn|mn)| for every shell pair (M, N) in parallel with the
+   threads of erd and keeps the pairs whose product with the largest value
+   reaches tolerance^2. A quartet (MN|PQ) is significant if
+   value(M, N) * value(P, Q) >= tolerance^2. */
+CIntStatus_t CInt_createSchwarz( BasisSet_t basis,
+                                 ERD_t erd,
+                                 double tolerance,
+                                 Schwarz_t *schwarz );
+
+CIntStatus_t CInt_destroySchwarz( Schwarz_t schwarz );
+
+/* Returns the number of pairs. The shells N of shell M are
+   shellid[shellptr[M] .. shellptr[M+1]-1] in descending order of
+   shellvalue, so loops over a row can stop at the first insignificant
+   pair; shellrid holds M for every pair. The arrays belong to schwarz. */
+int CInt_getSchwarzPairs( Schwarz_t schwarz,
+                          const int **shellptr,
+                          const int **shellid,
+                          const int **shellrid,
+                          const double **shellvalue );
+
+double CInt_getSchwarzMaxValue( Schwarz_t schwarz );
+
+double CInt_getSchwarzTolerance( Schwarz_t schwarz );
+
+// Task scheduling
+/* Partitions tasks 0 .. ntasks-1 with the given relative costs over
+   nthreads threads by longest processing time first: tasks are taken by
+   descending cost and each goes to the least loaded thread. Every thread
+   then works through its own deque and steals from the others when it
+   runs dry. */
+CIntStatus_t CInt_createScheduler( int ntasks,
+                                   const double *cost,
+                                   int nthreads,
+                                   Scheduler_t *scheduler );
+
+CIntStatus_t CInt_destroyScheduler( Scheduler_t scheduler );
+
+/* Refills the deques and clears the measurements for another pass */
+CIntStatus_t CInt_resetScheduler( Scheduler_t scheduler );
+
+/* Next task of thread tid (0 <= tid < nthreads), or -1 once all tasks of
+   the pass have been handed out */
+int CInt_getNextTask( Scheduler_t scheduler,
+                      int tid );
+
+/* Imbalance of the last pass as max / mean thread load, predicted from the
+   costs and measured from the time each thread spent fetching and running
+   tasks, and the number of stolen tasks */
+void CInt_getSchedulerImbalance( Scheduler_t scheduler,
+                                 double *predicted,
+                                 double *measured,
+                                 int *nstolen );
+
+// Fock matrix
+/* Counts the modelled cost of every Fock build task over the Schwarz pairs
+   of schwarz, in parallel with the threads of erd. The plan only refers to
+   schwarz, which must outlive it, and is read-only in the builds, so it
+   may be shared by any number of them. */
+CIntStatus_t CInt_createFockPlan( BasisSet_t basis,
+                                  ERD_t erd,
+                                  Schwarz_t schwarz,
+                                  FockPlan_t *plan );
+
+CIntStatus_t CInt_destroyFockPlan( FockPlan_t plan );
+
+/* Builds the Coulomb and exchange matrices of the symmetric nbf x nbf
+   density D (row-major, leading dimension ldd):
+       J(m,n) = sum_pq (mn|pq) D(p,q)    K(m,p) = sum_nq (mn|pq) D(n,q)
+   from the unique quartets that pass the Schwarz screening of plan. J and
+   K are overwritten (leading dimension ldf). The quartets are distributed
+   over the threads of erd by the task costs of plan; each thread
+   accumulates into private shell-blocked J/K copies that are reduced at
+   the end. For closed shells with
+   D = C_occ C_occ^T the Fock matrix is F = H + 2J - K. */
+CIntStatus_t CInt_buildFock( BasisSet_t basis,
+                             ERD_t erd,
+                             FockPlan_t plan,
+                             const double *D,
+                             int ldd,
+                             double *J,
+                             double *K,
+                             int ldf );
+
+/* CInt_buildFock for the ndens densities D[0..ndens-1] at once: every
+   quartet is computed once and digested into all J[d] and K[d], the
+   densities being interleaved so that the digestion runs over d in the
+   innermost loop. The per-thread accumulators take 2 * ndens * nbf^2
+   doubles. */
+CIntStatus_t CInt_buildFockMulti( BasisSet_t basis,
+                                  ERD_t erd,
+                                  FockPlan_t plan,
+                                  int ndens,
+                                  const double *const D[],
+                                  int ldd,
+                                  double *const J[],
+                                  double *const K[],
+                                  int ldf );
+
+/* Incremental CInt_buildFock: adds J(dD) and K(dD) of the density change
+   dD = D - Dprev to the J and K of Dprev held in J and K on input. Besides
+   the Schwarz bound, quartets are screened by the largest |dD| of the
+   shell blocks they contribute through, so late SCF iterations with a
+   small dD skip most quartets. Rebuild from the full density every few
+   iterations to keep the accumulated screening error bounded. */
+CIntStatus_t CInt_buildFockIncremental( BasisSet_t basis,
+                                        ERD_t erd,
+                                        FockPlan_t plan,
+                                        const double *dD,
+                                        int ldd,
+                                        double *J,
+                                        double *K,
+                                        int ldf );
+
 
 #ifdef __INTEL_OFFLOAD
 CIntStatus_t CInt_offload_createBasisSet( BasisSet_t *_basis );
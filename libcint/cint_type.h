@@ -29,13 +29,15 @@ struct OED
     double *charge;
     double *cc;
     double *alpha;
-    int cc_beg[2];
-    int cc_end[2];
+    int *cc_beg;
+    int *cc_end;
     int imax;
     int zmax;
     double *zcore;
     double *zcore2;
     int *icore;
+    /* Batch of a pair with L-shells, assembled from its part pairs */
+    double *lbuffer;
 
     int fp_memory_opt;
     int int_memory_opt;
@@ -44,21 +46,111 @@ struct OED
 };
 
 
+/* ERD_HRR_LRU_SLOTS HRR matrices of one thread, least recently used first
+   to be replaced; key is (A << 32 | B) + 1, 0 for an empty slot */
+struct HRRCache
+{
+    uint64_t *key;
+    uint64_t *stamp;
+    uint64_t clock;
+    size_t nindex;
+    size_t nvalue;
+    uint32_t *index;
+    double *value;
+};
+
 struct ERD
 {
     /* The number of threads used for computation */
     uint32_t nthreads;
     size_t capacity;
     double **buffer;    
+    /* Per-thread scratch arenas of erd__csgto, scratch_size bytes each */
+    size_t scratch_size;
+    char **scratch;
+    /* Per-thread batches of the L-shell quartets that are split into
+       their parts, capacity doubles each (NULL without such quartets) */
+    double **lbuffer;
     /* Used for vrrtable */
     int max_shella;
     /* 2D array */
     int **vrrtable;
+    /* Cartesian -> spherical matrices and cartesian norms of the shells
+       up to max_shella - 1 (see erd__ry_table) */
+    uint32_t *ry_index;
+    double *ry_value;
+    /* Primitive screening threshold, 0 disables primitive screening */
+    double primitive_tol;
+    /* ISA level of the ERD kernels (CIntISA_t) */
+    int isa;
+    /* Bytes of scratch a primitive block of erd__csgto aims for */
+    size_t block_size;
+    /* Shell pair cache: CSR over shell A of the cached pairs (A, B <= A) */
+    uint32_t *pair_ptr;
+    uint32_t *pair_id;
+    /* # of surviving primitive pairs, data offset and bound of each pair */
+    uint32_t *pair_nprim;
+    size_t *pair_offset;
+    double *pair_bound;
+    double *pair_data;
+    /* HRR matrices of the cached pairs with no s-shell (see
+       erd__hrr_pair_matrix), SIZE_MAX offsets if not set up */
+    size_t *hrr_ioffset;
+    size_t *hrr_zoffset;
+    uint32_t *hrr_index;
+    double *hrr_value;
+    /* Per-thread cache of the HRR matrices of the other pairs */
+    struct HRRCache *hrr_lru;
 #ifdef __INTEL_OFFLOAD
     int mic_numdevs;
 #endif    
 };
 
+struct Schwarz
+{
+    int nshells;
+    /* Pairs (M, N) survive if value(M, N) * maxvalue > tolerance^2 */
+    double tolerance;
+    double maxvalue;
+    /* CSR over shell M of the surviving shells N, max |(mn|mn)| of each pair;
+       every row is sorted by descending value */
+    int nnz;
+    int *shellptr;
+    int *shellid;
+    int *shellrid;
+    double *shellvalue;
+};
+
+struct FockPlan
+{
+    /* Schwarz pairs the Fock builds run over */
+    struct Schwarz *schwarz;
+    /* Integral and per density digestion cost of task t < ntasks at
+       taskcost[2 * t] and taskcost[2 * t + 1] */
+    int ntasks;
+    double *taskcost;
+};
+
+struct Scheduler
+{
+    int ntasks;
+    int nthreads;
+    /* Tasks of thread t by descending cost: task[start[t] .. start[t+1]-1];
+       the remaining ones are task[head[t] .. tail[t]-1] */
+    int *task;
+    int *start;
+    int *head;
+    int *tail;
+    /* Cost assigned to every thread by the LPT partition */
+    double *predicted;
+    /* Per-thread clock start, measured busy time and stolen task count */
+    double *begin;
+    double *busy;
+    int *nstolen;
+    /* omp_lock_t per deque */
+    void *lock;
+};
+
 struct BasisSet
 {
     // atom
@@ -84,6 +176,11 @@ struct BasisSet
     int bs_nshells;
     int bs_totnexp;
     int *bs_nexp;
+    // # of contractions of a shell, its cc holds nexp coefficients for each
+    int *bs_ncgto;
+    // SP shells (L-shells): p-shells with an s-part of the same exponents,
+    // whose nexp coefficients and norms come first in cc and norm
+    int *bs_lshell;
     double **bs_exp;
     double **bs_cc;
     double **bs_norm;
@@ -96,6 +193,8 @@ struct BasisSet
     uint32_t *f_end_id;
     uint32_t *s_start_id;
     uint32_t *nexp;
+    uint32_t *ncgto;
+    uint32_t *lshell;
     double **exp;
     double *minexp;
     double **cc;
@@ -107,6 +206,18 @@ struct BasisSet
     uint32_t max_momentum;
     uint32_t max_nexp;
     uint32_t max_nexp_id;
+    uint32_t max_ncgto;
+    // merge shells into generally contracted ones when loading
+    int general;
+    // merge s- and p-shells of the same exponents into L-shells when loading
+    int lshells;
+
+    // ordering: internal atom/shell/function i is number *_perm[i] in the
+    // order of the input
+    int ordering;
+    int *atom_perm;
+    int *shell_perm;
+    int *func_perm;
     
     char str_buf[512];
 
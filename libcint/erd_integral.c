@@ -3,6 +3,8 @@
 #include <string.h>
 #include <assert.h>
 #include <math.h>
+#include <stdbool.h>
+#include <unistd.h>
 
 #include "erd_integral.h"
 #include "basisset.h"
@@ -14,21 +16,49 @@
 #endif
 
 
+/* Whether the basis set has L-shells */
+static bool has_lshells(BasisSet_t basis) {
+    for (uint32_t i = 0; i < basis->nshells; i++) {
+        if (basis->lshell[i] != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
 static void erd_max_scratch(BasisSet_t basis, ERD_t erd) {
     const int max_momentum = basis->max_momentum;
     const int max_primid = basis->max_nexp_id;
     const int maxnpgto = basis->nexp[max_primid];
+    const int maxncgto = basis->max_ncgto;
         
-    if (max_momentum < 2) {
+    if ((max_momentum < 2) && (maxncgto == 1)) {
         erd->capacity = 81;
+        erd->scratch_size = 0;
     } else {
+        /* Quartets of generally contracted s- and p-shells go through
+           erd__csgto as well, next to the 81 integrals of erd__1111_csgto */
         erd->capacity = erd__memory_csgto(
             maxnpgto, maxnpgto, maxnpgto, maxnpgto,
+            maxncgto, maxncgto, maxncgto, maxncgto,
             max_momentum, max_momentum,
             max_momentum, max_momentum,
             1.0, 1.0, 1.0, 2.0, 2.0, 2.0,
             3.0, 3.0, 3.0, 4.0, 4.0, 4.0,
             basis->basistype);
+        erd->capacity = MAX(erd->capacity, 81);
+        erd->scratch_size = erd__scratch_csgto(
+            maxnpgto, maxnpgto, maxnpgto, maxnpgto,
+            maxncgto, maxncgto, maxncgto, maxncgto,
+            max_momentum, max_momentum,
+            max_momentum, max_momentum,
+            basis->basistype);
+    }
+    /* L-shell batches are up to 256 integrals in erd__1111_csgto, and the
+       quartets split into their parts are handed on whole */
+    if (has_lshells(basis)) {
+        erd->capacity = MAX(erd->capacity, (size_t)basis->maxdim * basis->maxdim * basis->maxdim * basis->maxdim);
     }
 }
 
@@ -75,6 +105,441 @@ static CIntStatus_t destroy_vrrtable(ERD_t erd) {
 }
 
 
+static CIntStatus_t create_ry_table(BasisSet_t basis, ERD_t erd) {
+    size_t nindex, nvalue;
+    erd__ry_table_size(basis->max_momentum, &nindex, &nvalue);
+    erd->ry_index = (uint32_t *)ALIGNED_MALLOC(nindex * sizeof(uint32_t));
+    erd->ry_value = (double *)ALIGNED_MALLOC(nvalue * sizeof(double));
+    CINT_ASSERT((erd->ry_index != NULL) && (erd->ry_value != NULL));
+    erd__ry_table(basis->max_momentum, erd->ry_index, erd->ry_value);
+    return CINT_STATUS_SUCCESS;
+}
+
+static CIntStatus_t destroy_ry_table(ERD_t erd) {
+    ALIGNED_FREE(erd->ry_index);
+    ALIGNED_FREE(erd->ry_value);
+    return CINT_STATUS_SUCCESS;
+}
+
+
+static CIntStatus_t create_pair_cache(BasisSet_t basis, ERD_t erd) {
+    const uint32_t nshells = basis->nshells;
+    const double **exp = (const double**)basis->exp;
+    const double **cc = (const double**)basis->cc;
+    const double **norm = (const double**)basis->norm;
+
+    /* Largest primitive pair bound: a pair survives if its bound times
+       this one (and the largest s/p norm factor 16) reaches ERD_PAIR_TOL */
+    double maxbound = 0.0;
+    #pragma omp parallel for schedule(dynamic) reduction(max:maxbound)
+    for (uint32_t A = 0; A < nshells; A++) {
+        for (uint32_t B = 0; B <= A; B++) {
+            if ((basis->lshell[A] | basis->lshell[B]) != 0) {
+                continue;
+            }
+            double bound;
+            erd__shell_pair_data(A, B, basis->nexp, basis->ncgto, basis->momentum, basis->xyz0, exp, cc, norm, INFINITY, NULL, &bound);
+            maxbound = MAX(maxbound, bound);
+        }
+    }
+    const double tol = ERD_PAIR_TOL / (16.0 * maxbound);
+
+    /* Count the surviving primitive pairs of every shell pair. Pairs with
+       L-shells only go through erd__1111_csgto or are split into their
+       parts, so they are not cached. */
+    uint32_t *row_count = (uint32_t *)calloc(nshells, sizeof(uint32_t));
+    uint32_t **row_id = (uint32_t **)calloc(nshells, sizeof(uint32_t *));
+    uint32_t **row_nprim = (uint32_t **)calloc(nshells, sizeof(uint32_t *));
+    double **row_bound = (double **)calloc(nshells, sizeof(double *));
+    CINT_ASSERT((row_count != NULL) && (row_id != NULL) && (row_nprim != NULL) && (row_bound != NULL));
+    #pragma omp parallel for schedule(dynamic)
+    for (uint32_t A = 0; A < nshells; A++) {
+        uint32_t *id = (uint32_t *)malloc(sizeof(uint32_t) * (A + 1));
+        uint32_t *nprim = (uint32_t *)malloc(sizeof(uint32_t) * (A + 1));
+        double *bound = (double *)malloc(sizeof(double) * (A + 1));
+        CINT_ASSERT((id != NULL) && (nprim != NULL) && (bound != NULL));
+        uint32_t count = 0;
+        for (uint32_t B = 0; B <= A; B++) {
+            if ((basis->lshell[A] | basis->lshell[B]) != 0) {
+                continue;
+            }
+            const uint32_t n = erd__shell_pair_data(A, B, basis->nexp, basis->ncgto, basis->momentum, basis->xyz0, exp, cc, norm, tol, NULL, &bound[count]);
+            if (n != 0) {
+                id[count] = B;
+                nprim[count] = n;
+                count++;
+            }
+        }
+        row_count[A] = count;
+        row_id[A] = id;
+        row_nprim[A] = nprim;
+        row_bound[A] = bound;
+    }
+
+    /* Lay out the cache row by row until the memory limit is reached */
+    size_t npairs = 0;
+    for (uint32_t A = 0; A < nshells; A++) {
+        npairs += row_count[A];
+    }
+    erd->pair_ptr = (uint32_t *)malloc(sizeof(uint32_t) * (nshells + 1));
+    erd->pair_id = (uint32_t *)malloc(sizeof(uint32_t) * (npairs + 1));
+    erd->pair_nprim = (uint32_t *)malloc(sizeof(uint32_t) * (npairs + 1));
+    erd->pair_offset = (size_t *)malloc(sizeof(size_t) * (npairs + 1));
+    erd->pair_bound = (double *)malloc(sizeof(double) * (npairs + 1));
+    CINT_ASSERT((erd->pair_ptr != NULL) && (erd->pair_id != NULL) && (erd->pair_nprim != NULL) &&
+        (erd->pair_offset != NULL) && (erd->pair_bound != NULL));
+    const size_t max_length = ERD_PAIR_MAX_MEMORY / sizeof(double);
+    size_t length = 0;
+    uint32_t n = 0;
+    for (uint32_t A = 0; A < nshells; A++) {
+        erd->pair_ptr[A] = n;
+        for (uint32_t i = 0; i < row_count[A]; i++) {
+            const size_t pair_length = erd__pair_data_size(row_nprim[A][i],
+                basis->ncgto[A] * basis->ncgto[row_id[A][i]]);
+            if (length + pair_length <= max_length) {
+                erd->pair_id[n] = row_id[A][i];
+                erd->pair_nprim[n] = row_nprim[A][i];
+                erd->pair_bound[n] = row_bound[A][i];
+                erd->pair_offset[n] = length;
+                length += pair_length;
+                n++;
+            }
+        }
+        free(row_id[A]);
+        free(row_nprim[A]);
+        free(row_bound[A]);
+    }
+    erd->pair_ptr[nshells] = n;
+    free(row_count);
+    free(row_id);
+    free(row_nprim);
+    free(row_bound);
+
+    erd->pair_data = (double *)ALIGNED_MALLOC(MAX(length, 1) * sizeof(double));
+    CINT_ASSERT(erd->pair_data != NULL);
+    #pragma omp parallel for schedule(dynamic)
+    for (uint32_t A = 0; A < nshells; A++) {
+        for (uint32_t i = erd->pair_ptr[A]; i < erd->pair_ptr[A + 1]; i++) {
+            double bound;
+            erd__shell_pair_data(A, erd->pair_id[i], basis->nexp, basis->ncgto, basis->momentum, basis->xyz0, exp, cc, norm, tol,
+                &erd->pair_data[erd->pair_offset[i]], &bound);
+        }
+    }
+    return CINT_STATUS_SUCCESS;
+}
+
+static CIntStatus_t destroy_pair_cache(ERD_t erd) {
+    free(erd->pair_ptr);
+    free(erd->pair_id);
+    free(erd->pair_nprim);
+    free(erd->pair_offset);
+    free(erd->pair_bound);
+    ALIGNED_FREE(erd->pair_data);
+    return CINT_STATUS_SUCCESS;
+}
+
+/* # of nonzero coordinate differences between the centers of shells A and B */
+static inline uint32_t pair_ncoor(BasisSet_t basis, uint32_t A, uint32_t B) {
+    const double *xyz0 = basis->xyz0;
+    return (uint32_t)(xyz0[A*4] != xyz0[B*4]) + (uint32_t)(xyz0[A*4+1] != xyz0[B*4+1]) + (uint32_t)(xyz0[A*4+2] != xyz0[B*4+2]);
+}
+
+/* Sets up the HRR matrices of the cached shell pairs without s-shells, in
+   cache order until ERD_HRR_MAX_MEMORY is reached, and the per-thread LRU
+   caches for the others; only used by erd__csgto, i.e. with d-shells */
+static CIntStatus_t create_hrr_cache(BasisSet_t basis, ERD_t erd) {
+    const uint32_t nshells = basis->nshells;
+    const uint32_t npairs = erd->pair_ptr[nshells];
+    const uint32_t *momentum = basis->momentum;
+    erd->hrr_ioffset = (size_t *)malloc(sizeof(size_t) * (npairs + 1));
+    erd->hrr_zoffset = (size_t *)malloc(sizeof(size_t) * (npairs + 1));
+    CINT_ASSERT((erd->hrr_ioffset != NULL) && (erd->hrr_zoffset != NULL));
+    size_t nindex = 0, nvalue = 0;
+    for (uint32_t A = 0; A < nshells; A++) {
+        for (uint32_t i = erd->pair_ptr[A]; i < erd->pair_ptr[A + 1]; i++) {
+            const uint32_t B = erd->pair_id[i];
+            erd->hrr_ioffset[i] = SIZE_MAX;
+            erd->hrr_zoffset[i] = SIZE_MAX;
+            if ((basis->max_momentum < 2) || (momentum[A] == 0) || (momentum[B] == 0)) {
+                continue;
+            }
+            size_t ni, nv;
+            erd__hrr_pair_size(MAX(momentum[A], momentum[B]), MIN(momentum[A], momentum[B]), pair_ncoor(basis, A, B), &ni, &nv);
+            if ((nindex + ni) * sizeof(uint32_t) + (nvalue + nv) * sizeof(double) <= ERD_HRR_MAX_MEMORY) {
+                erd->hrr_ioffset[i] = nindex;
+                erd->hrr_zoffset[i] = nvalue;
+                nindex += ni;
+                nvalue += nv;
+            }
+        }
+    }
+    erd->hrr_index = (uint32_t *)ALIGNED_MALLOC(MAX(nindex, 1) * sizeof(uint32_t));
+    erd->hrr_value = (double *)ALIGNED_MALLOC(MAX(nvalue, 1) * sizeof(double));
+    CINT_ASSERT((erd->hrr_index != NULL) && (erd->hrr_value != NULL));
+    #pragma omp parallel for schedule(dynamic)
+    for (uint32_t A = 0; A < nshells; A++) {
+        for (uint32_t i = erd->pair_ptr[A]; i < erd->pair_ptr[A + 1]; i++) {
+            if (erd->hrr_ioffset[i] != SIZE_MAX) {
+                /* B <= A, so A goes first unless B has the higher shell */
+                const uint32_t B = erd->pair_id[i];
+                const bool swap = momentum[B] > momentum[A];
+                erd__hrr_pair_matrix(swap ? B : A, swap ? A : B, momentum, basis->xyz0,
+                    &erd->hrr_index[erd->hrr_ioffset[i]], &erd->hrr_value[erd->hrr_zoffset[i]]);
+            }
+        }
+    }
+
+    /* LRU slots fit the largest pair, two shells of max_momentum */
+    size_t lru_nindex, lru_nvalue;
+    erd__hrr_pair_size(basis->max_momentum, basis->max_momentum, 3, &lru_nindex, &lru_nvalue);
+    erd->hrr_lru = (struct HRRCache *)malloc(erd->nthreads * sizeof(struct HRRCache));
+    CINT_ASSERT(erd->hrr_lru != NULL);
+    for (uint32_t t = 0; t < erd->nthreads; t++) {
+        struct HRRCache *lru = &erd->hrr_lru[t];
+        lru->key = (uint64_t *)calloc(ERD_HRR_LRU_SLOTS, sizeof(uint64_t));
+        lru->stamp = (uint64_t *)calloc(ERD_HRR_LRU_SLOTS, sizeof(uint64_t));
+        lru->clock = 0;
+        lru->nindex = lru_nindex;
+        lru->nvalue = lru_nvalue;
+        lru->index = (uint32_t *)ALIGNED_MALLOC(ERD_HRR_LRU_SLOTS * lru_nindex * sizeof(uint32_t));
+        lru->value = (double *)ALIGNED_MALLOC(ERD_HRR_LRU_SLOTS * lru_nvalue * sizeof(double));
+        CINT_ASSERT((lru->key != NULL) && (lru->stamp != NULL) && (lru->index != NULL) && (lru->value != NULL));
+    }
+    return CINT_STATUS_SUCCESS;
+}
+
+static CIntStatus_t destroy_hrr_cache(ERD_t erd) {
+    free(erd->hrr_ioffset);
+    free(erd->hrr_zoffset);
+    ALIGNED_FREE(erd->hrr_index);
+    ALIGNED_FREE(erd->hrr_value);
+    for (uint32_t t = 0; t < erd->nthreads; t++) {
+        free(erd->hrr_lru[t].key);
+        free(erd->hrr_lru[t].stamp);
+        ALIGNED_FREE(erd->hrr_lru[t].index);
+        ALIGNED_FREE(erd->hrr_lru[t].value);
+    }
+    free(erd->hrr_lru);
+    return CINT_STATUS_SUCCESS;
+}
+
+/* Returns the position of the pair of shells A and B (in any order) in the
+   shell pair cache, or UINT32_MAX if the pair is not cached */
+static inline uint32_t find_pair(ERD_t erd, uint32_t A, uint32_t B) {
+    if (A < B) {
+        const uint32_t C = A;
+        A = B;
+        B = C;
+    }
+    uint32_t first = erd->pair_ptr[A];
+    uint32_t last = erd->pair_ptr[A + 1];
+    while (first < last) {
+        const uint32_t middle = (first + last) / 2;
+        if (erd->pair_id[middle] < B) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    if ((first < erd->pair_ptr[A + 1]) && (erd->pair_id[first] == B)) {
+        return first;
+    }
+    return UINT32_MAX;
+}
+
+/* Returns the cached primitive pair data of shells A and B (in any order),
+   or NULL if the pair is not cached and must be set up on the fly */
+static inline const double *get_pair(ERD_t erd, uint32_t A, uint32_t B, uint32_t *npair) {
+    const uint32_t i = find_pair(erd, A, B);
+    if (i != UINT32_MAX) {
+        *npair = erd->pair_nprim[i];
+        return &erd->pair_data[erd->pair_offset[i]];
+    }
+    *npair = 0;
+    return NULL;
+}
+
+/* Returns the HRR matrix data of shells A and B (in any order), from the
+   shell pair cache or else from the thread's LRU cache, where it is set up
+   if missing; NULL if the pair has an s-shell and needs no HRR */
+static inline const uint32_t *get_hrr(BasisSet_t basis, ERD_t erd, int tid, uint32_t A, uint32_t B, const double **value) {
+    const uint32_t *momentum = basis->momentum;
+    if ((momentum[A] == 0) || (momentum[B] == 0)) {
+        *value = NULL;
+        return NULL;
+    }
+    /* The order of erd__set_abcd: higher shell first, then higher index */
+    if ((momentum[A] < momentum[B]) || ((momentum[A] == momentum[B]) && (A < B))) {
+        const uint32_t C = A;
+        A = B;
+        B = C;
+    }
+    const uint32_t i = find_pair(erd, A, B);
+    if ((i != UINT32_MAX) && (erd->hrr_ioffset[i] != SIZE_MAX)) {
+        *value = &erd->hrr_value[erd->hrr_zoffset[i]];
+        return &erd->hrr_index[erd->hrr_ioffset[i]];
+    }
+
+    struct HRRCache *lru = &erd->hrr_lru[tid];
+    const uint64_t key = (((uint64_t)A << 32) | B) + 1;
+    uint32_t slot = 0;
+    for (uint32_t s = 0; s < ERD_HRR_LRU_SLOTS; s++) {
+        if (lru->key[s] == key) {
+            slot = s;
+            break;
+        }
+        if (lru->stamp[s] < lru->stamp[slot]) {
+            slot = s;
+        }
+    }
+    uint32_t *index = &lru->index[slot * lru->nindex];
+    double *hrr_value = &lru->value[slot * lru->nvalue];
+    if (lru->key[slot] != key) {
+        erd__hrr_pair_matrix(A, B, momentum, basis->xyz0, index, hrr_value);
+        lru->key[slot] = key;
+    }
+    lru->stamp[slot] = ++lru->clock;
+    *value = hrr_value;
+    return index;
+}
+
+/* Quartets of s-, p- and d-shells with at least one d-shell and a total
+   angular momentum of at most 4 have their own kernels in erd__2222_csgto */
+static inline bool is_2222_class(uint32_t shell1, uint32_t shell2, uint32_t shell3, uint32_t shell4) {
+    return (MAX(MAX(shell1, shell2), MAX(shell3, shell4)) == 2) && (shell1 + shell2 + shell3 + shell4 <= 4);
+}
+
+
+/* Quartets with L-shells that erd__1111_csgto does not take (those with
+   d- or higher or generally contracted shells): every part quartet goes
+   through erd__csgto_into straight into its place in the L-buffer of the
+   thread. Returns the # of integrals, 0 if all parts were screened. */
+static uint32_t compute_lshell_parts(BasisSet_t basis, ERD_t erd, int tid,
+                                     uint32_t A, uint32_t B, uint32_t C, uint32_t D)
+{
+    const uint32_t index[4] = { A, B, C, D };
+    uint32_t npgto[4], ncgto[4], shell[4];
+    double xyz0[16], minalpha[4];
+    const double *alpha[4], *cc[4], *norm[4];
+    size_t ld[4];
+    size_t nbatch = 1;
+    for (uint32_t i = 0; i < 4; i++) {
+        npgto[i] = basis->nexp[index[i]];
+        ncgto[i] = basis->ncgto[index[i]];
+        memcpy(&xyz0[i * 4], &basis->xyz0[index[i] * 4], 4 * sizeof(double));
+        alpha[i] = basis->exp[index[i]];
+        minalpha[i] = basis->minexp[index[i]];
+        ld[i] = nbatch;
+        nbatch *= CInt_getShellDim(basis, index[i]);
+    }
+    double *lbuffer = erd->lbuffer[tid];
+    memset(lbuffer, 0, nbatch * sizeof(double));
+
+    /* ...bit i of parts selects the s- (0) or p-part (1) of an L-shell i,
+       whose p-part has its coefficients and norms after the s-part ones */
+    const bool atomic = ((A ^ B) | (B ^ C) | (C ^ D)) == 0;
+    bool nonzero = false;
+    for (uint32_t parts = 0; parts < 16; parts++) {
+        bool valid = true;
+        size_t offset = 0;
+        uint32_t shellt = 0;
+        for (uint32_t i = 0; i < 4; i++) {
+            const uint32_t part = (parts >> i) & 1;
+            const uint32_t X = index[i];
+            if (basis->lshell[X] != 0) {
+                shell[i] = part;
+                offset += part * ld[i];
+            } else {
+                shell[i] = basis->momentum[X];
+                valid = valid && (part == 0);
+            }
+            cc[i] = &basis->cc[X][part * npgto[i]];
+            norm[i] = &basis->norm[X][part * npgto[i]];
+            shellt += shell[i];
+        }
+        if (!valid || (atomic && (shellt % 2 == 1))) {
+            continue;
+        }
+        uint32_t integrals_count = 0;
+        erd__csgto_into(
+            0, 1, 2, 3,
+            npgto, ncgto, shell, xyz0,
+            alpha, minalpha, cc, norm,
+            erd->vrrtable, erd->ry_index, erd->ry_value,
+            basis->basistype,
+            NULL, 0, NULL, 0,
+            NULL, NULL, NULL, NULL,
+            erd->primitive_tol,
+            erd->capacity, &integrals_count, erd->buffer[tid],
+            erd->scratch[tid], &lbuffer[offset], ld);
+        nonzero = nonzero || (integrals_count != 0);
+    }
+    return nonzero ? nbatch : 0;
+}
+
+
+static const char *isa_names[] = {"auto", "sse4", "avx", "avx2", "avx512", "mic"};
+
+/* Selects the ERD kernels, capped by the CINT_ISA environment variable */
+static int select_isa(BasisSet_t basis) {
+    int requested = 0;
+    const char *env = getenv("CINT_ISA");
+    if ((env != NULL) && (env[0] != '\0')) {
+        for (int i = CINT_ISA_SSE4; i <= CINT_ISA_AVX512; i++) {
+            if (strcmp(env, isa_names[i]) == 0) {
+                requested = i;
+            }
+        }
+        if (requested == 0) {
+            CINT_PRINTF(1, "unknown CINT_ISA \"%s\", using the best ISA of the CPU\n", env);
+        }
+    }
+    const int isa = erd__select_isa(requested);
+    if ((requested != 0) && (isa != requested)) {
+        CINT_PRINTF(1, "CINT_ISA=%s is not available, using %s\n", env, isa_names[isa]);
+    }
+    return isa;
+}
+
+
+/* L2 cache size of the CPU in bytes, 0 if unknown */
+static size_t detect_l2_cache(void) {
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    const long size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (size > 0) {
+        return (size_t)size;
+    }
+#endif
+    size_t kb = 0;
+    FILE *file = fopen("/sys/devices/system/cpu/cpu0/cache/index2/size", "r");
+    if (file != NULL) {
+        if (fscanf(file, "%zuK", &kb) != 1) {
+            kb = 0;
+        }
+        fclose(file);
+    }
+    return kb * 1024;
+}
+
+
+/* Sizes the primitive blocks of the ERD kernels for the L2 cache, whose
+   size the CINT_L2_CACHE environment variable (in KB) overrides */
+static size_t select_block_size(BasisSet_t basis) {
+    size_t cache = detect_l2_cache();
+    const char *env = getenv("CINT_L2_CACHE");
+    if ((env != NULL) && (env[0] != '\0')) {
+        char *end;
+        const long kb = strtol(env, &end, 10);
+        if ((*end == '\0') && (kb > 0)) {
+            cache = (size_t)kb * 1024;
+        } else {
+            CINT_PRINTF(1, "invalid CINT_L2_CACHE \"%s\", using %zu KB\n", env, cache / 1024);
+        }
+    }
+    return erd__select_block_size(cache);
+}
+
+
 CIntStatus_t CInt_createERD(BasisSet_t basis, ERD_t *erd, int nthreads) {      
     CINT_ASSERT(nthreads > 0);
 
@@ -85,15 +550,55 @@ CIntStatus_t CInt_createERD(BasisSet_t basis, ERD_t *erd, int nthreads) {
 
     // memory scratch memory
     e->nthreads = nthreads;
+    e->primitive_tol = ERD_PRIMITIVE_TOL;
+    e->isa = select_isa(basis);
+    e->block_size = select_block_size(basis);
     e->buffer = (double **)malloc(nthreads * sizeof(double *));
     CINT_ASSERT(e->buffer != NULL);
+    e->scratch = (char **)malloc(nthreads * sizeof(char *));
+    CINT_ASSERT(e->scratch != NULL);
+    /* Thread i allocates and first touches the buffers of tid i, so that
+       they are placed on its NUMA node */
+    #pragma omp parallel for num_threads(nthreads) schedule(static, 1)
     for (int i = 0; i < nthreads; i++) {
         e->buffer[i] = (double *)ALIGNED_MALLOC(e->capacity * sizeof(double));
+        e->scratch[i] = (e->scratch_size != 0) ? (char *)ALIGNED_MALLOC(e->scratch_size) : NULL;
+        if (e->buffer[i] != NULL) {
+            memset(e->buffer[i], 0, e->capacity * sizeof(double));
+        }
+        if (e->scratch[i] != NULL) {
+            memset(e->scratch[i], 0, e->scratch_size);
+        }
+    }
+    for (int i = 0; i < nthreads; i++) {
         CINT_ASSERT(e->buffer[i] != NULL);
+        CINT_ASSERT((e->scratch_size == 0) || (e->scratch[i] != NULL));
+    }
+    /* L-shell quartets are split into their parts with the erd__csgto
+       scratch, which is only there beyond the s/p segmented case */
+    if ((e->scratch_size != 0) && has_lshells(basis)) {
+        e->lbuffer = (double **)malloc(nthreads * sizeof(double *));
+        CINT_ASSERT(e->lbuffer != NULL);
+        for (int i = 0; i < nthreads; i++) {
+            e->lbuffer[i] = (double *)ALIGNED_MALLOC(e->capacity * sizeof(double));
+            CINT_ASSERT(e->lbuffer[i] != NULL);
+        }
     }
 
     // create vrr table
-    const CIntStatus_t status = create_vrrtable(basis, e);
+    CIntStatus_t status = create_vrrtable(basis, e);
+    CINT_ASSERT(status == CINT_STATUS_SUCCESS);
+
+    // create cartesian -> spherical tables
+    status = create_ry_table(basis, e);
+    CINT_ASSERT(status == CINT_STATUS_SUCCESS);
+
+    // create shell pair cache
+    status = create_pair_cache(basis, e);
+    CINT_ASSERT(status == CINT_STATUS_SUCCESS);
+
+    // create HRR matrix cache of the shell pairs
+    status = create_hrr_cache(basis, e);
     CINT_ASSERT(status == CINT_STATUS_SUCCESS);
     CINT_INFO("totally use %.3lf MB (%.3lf MB per thread)",
         (e->fp_memory_opt * sizeof(double)
@@ -108,10 +613,21 @@ CIntStatus_t CInt_createERD(BasisSet_t basis, ERD_t *erd, int nthreads) {
 CIntStatus_t CInt_destroyERD(ERD_t erd) {
     for (uint32_t i = 0; i < erd->nthreads; i++) {
         ALIGNED_FREE(erd->buffer[i]);
+        ALIGNED_FREE(erd->scratch[i]);
     }
     free(erd->buffer);
+    free(erd->scratch);
+    if (erd->lbuffer != NULL) {
+        for (uint32_t i = 0; i < erd->nthreads; i++) {
+            ALIGNED_FREE(erd->lbuffer[i]);
+        }
+        free(erd->lbuffer);
+    }
 
     destroy_vrrtable(erd);
+    destroy_ry_table(erd);
+    destroy_hrr_cache(erd);
+    destroy_pair_cache(erd);
     free(erd);
 
     return CINT_STATUS_SUCCESS;
@@ -150,28 +666,58 @@ CIntStatus_t CInt_computeShellQuartet( BasisSet_t basis, ERD_t erd, int tid,
     const uint32_t shell3 = basis->momentum[C];
     const uint32_t shell4 = basis->momentum[D];
     const uint32_t orshell = shell1 | shell2 | shell3 | shell4;
-    if (orshell < 2) {
+    /* Generally contracted shells only have the general kernel */
+    const bool general = (basis->ncgto[A] | basis->ncgto[B] | basis->ncgto[C] | basis->ncgto[D]) > 1;
+    const uint32_t orlshell = basis->lshell[A] | basis->lshell[B] | basis->lshell[C] | basis->lshell[D];
+    *integrals = erd->buffer[tid];
+    if ((orshell < 2) && !general) {
         uint32_t integrals_count = 0;
         erd__1111_csgto(
+            A, B, C, D,
+            basis->nexp, basis->momentum, basis->lshell, basis->xyz0,
+            (const double**)basis->exp, basis->minexp, (const double**)basis->cc, (const double**)basis->norm,
+            erd->primitive_tol,
+            erd->capacity, &integrals_count, erd->buffer[tid]);
+        *nints = integrals_count;
+    } else if (orlshell != 0) {
+        *nints = compute_lshell_parts(basis, erd, tid, A, B, C, D);
+        *integrals = erd->lbuffer[tid];
+    } else if (!general && is_2222_class(shell1, shell2, shell3, shell4)) {
+        uint32_t integrals_count = 0;
+        uint32_t npairab, npaircd;
+        const double *pairab = get_pair(erd, A, B, &npairab);
+        const double *paircd = get_pair(erd, C, D, &npaircd);
+        erd__2222_csgto(
             A, B, C, D,
             basis->nexp, basis->momentum, basis->xyz0,
             (const double**)basis->exp, basis->minexp, (const double**)basis->cc, (const double**)basis->norm,
+            basis->basistype,
+            pairab, npairab, paircd, npaircd,
+            erd->primitive_tol,
             erd->capacity, &integrals_count, erd->buffer[tid]);
         *nints = integrals_count;
     } else {
         uint32_t integrals_count = 0;
+        uint32_t npairab, npaircd;
+        const double *pairab = get_pair(erd, A, B, &npairab);
+        const double *paircd = get_pair(erd, C, D, &npaircd);
+        const double *hrrab_value, *hrrcd_value;
+        const uint32_t *hrrab_index = get_hrr(basis, erd, tid, A, B, &hrrab_value);
+        const uint32_t *hrrcd_index = get_hrr(basis, erd, tid, C, D, &hrrcd_value);
         erd__csgto(
             A, B, C, D,
-            basis->nexp, basis->momentum, basis->xyz0,
+            basis->nexp, basis->ncgto, basis->momentum, basis->xyz0,
             (const double**)basis->exp, basis->minexp, (const double**)basis->cc, (const double**)basis->norm,
-            erd->vrrtable,
+            erd->vrrtable, erd->ry_index, erd->ry_value,
             basis->basistype,
-            erd->capacity, &integrals_count, erd->buffer[tid]);
+            pairab, npairab, paircd, npaircd,
+            hrrab_index, hrrab_value, hrrcd_index, hrrcd_value,
+            erd->primitive_tol,
+            erd->capacity, &integrals_count, erd->buffer[tid],
+            erd->scratch[tid]);
         *nints = integrals_count;
     }
 
-    *integrals = erd->buffer[tid];
-
     if (*nints != 0 && isnan((*integrals)[0]))
     {
         printf ("NAN %d %d %d %d\n", A, B, C, D);
@@ -179,37 +725,319 @@ CIntStatus_t CInt_computeShellQuartet( BasisSet_t basis, ERD_t erd, int tid,
     return CINT_STATUS_SUCCESS;
 }
 
+CIntStatus_t CInt_computeShellQuartetInto( BasisSet_t basis, ERD_t erd, int tid,
+                                            int A, int B, int C, int D,
+                                            double *dst, const size_t ld[4], int *nints)
+{
+    const uint32_t shell1 = basis->momentum[A];
+    const uint32_t shell2 = basis->momentum[B];
+    const uint32_t shell3 = basis->momentum[C];
+    const uint32_t shell4 = basis->momentum[D];
+    const uint32_t orshell = shell1 | shell2 | shell3 | shell4;
+    const bool general = (basis->ncgto[A] | basis->ncgto[B] | basis->ncgto[C] | basis->ncgto[D]) > 1;
+    const uint32_t orlshell = basis->lshell[A] | basis->lshell[B] | basis->lshell[C] | basis->lshell[D];
+    uint32_t integrals_count = 0;
+    if ((orshell < 2) && !general) {
+        /* s/p batches are at most 81 integrals (256 with L-shells), so the
+           store is the only pass */
+        erd__1111_csgto(
+            A, B, C, D,
+            basis->nexp, basis->momentum, basis->lshell, basis->xyz0,
+            (const double**)basis->exp, basis->minexp, (const double**)basis->cc, (const double**)basis->norm,
+            erd->primitive_tol,
+            erd->capacity, &integrals_count, erd->buffer[tid]);
+        if (integrals_count != 0) {
+            const uint32_t n1 = 2 * shell1 + 1 + basis->lshell[A];
+            const uint32_t n2 = 2 * shell2 + 1 + basis->lshell[B];
+            const uint32_t n3 = 2 * shell3 + 1 + basis->lshell[C];
+            const uint32_t n4 = 2 * shell4 + 1 + basis->lshell[D];
+            const uint32_t stride[4] = { 1, n1, n1 * n2, n1 * n2 * n3 };
+            erd__store_batch(n1, n2, n3, n4, stride, erd->buffer[tid], ld, dst);
+        }
+    } else if (orlshell != 0) {
+        integrals_count = compute_lshell_parts(basis, erd, tid, A, B, C, D);
+        if (integrals_count != 0) {
+            const uint32_t n1 = CInt_getShellDim(basis, A);
+            const uint32_t n2 = CInt_getShellDim(basis, B);
+            const uint32_t n3 = CInt_getShellDim(basis, C);
+            const uint32_t n4 = CInt_getShellDim(basis, D);
+            const uint32_t stride[4] = { 1, n1, n1 * n2, n1 * n2 * n3 };
+            erd__store_batch(n1, n2, n3, n4, stride, erd->lbuffer[tid], ld, dst);
+        }
+    } else if (!general && is_2222_class(shell1, shell2, shell3, shell4)) {
+        uint32_t npairab, npaircd;
+        const double *pairab = get_pair(erd, A, B, &npairab);
+        const double *paircd = get_pair(erd, C, D, &npaircd);
+        erd__2222_csgto(
+            A, B, C, D,
+            basis->nexp, basis->momentum, basis->xyz0,
+            (const double**)basis->exp, basis->minexp, (const double**)basis->cc, (const double**)basis->norm,
+            basis->basistype,
+            pairab, npairab, paircd, npaircd,
+            erd->primitive_tol,
+            erd->capacity, &integrals_count, erd->buffer[tid]);
+        if (integrals_count != 0) {
+            const uint32_t n1 = CInt_getShellDim(basis, A);
+            const uint32_t n2 = CInt_getShellDim(basis, B);
+            const uint32_t n3 = CInt_getShellDim(basis, C);
+            const uint32_t n4 = CInt_getShellDim(basis, D);
+            const uint32_t stride[4] = { 1, n1, n1 * n2, n1 * n2 * n3 };
+            erd__store_batch(n1, n2, n3, n4, stride, erd->buffer[tid], ld, dst);
+        }
+    } else {
+        uint32_t npairab, npaircd;
+        const double *pairab = get_pair(erd, A, B, &npairab);
+        const double *paircd = get_pair(erd, C, D, &npaircd);
+        const double *hrrab_value, *hrrcd_value;
+        const uint32_t *hrrab_index = get_hrr(basis, erd, tid, A, B, &hrrab_value);
+        const uint32_t *hrrcd_index = get_hrr(basis, erd, tid, C, D, &hrrcd_value);
+        erd__csgto_into(
+            A, B, C, D,
+            basis->nexp, basis->ncgto, basis->momentum, basis->xyz0,
+            (const double**)basis->exp, basis->minexp, (const double**)basis->cc, (const double**)basis->norm,
+            erd->vrrtable, erd->ry_index, erd->ry_value,
+            basis->basistype,
+            pairab, npairab, paircd, npaircd,
+            hrrab_index, hrrab_value, hrrcd_index, hrrcd_value,
+            erd->primitive_tol,
+            erd->capacity, &integrals_count, erd->buffer[tid],
+            erd->scratch[tid], dst, ld);
+    }
+    *nints = integrals_count;
+    return CINT_STATUS_SUCCESS;
+}
+
 CIntStatus_t CInt_computeShellQuartets(BasisSet_t basis,
                                        ERD_t erd,
                                        uint32_t threadId,
-                                       uint32_t shellIndicexA,
+                                       uint32_t shellIndexA,
                                        const uint32_t*restrict shellIndicesB,
-                                       uint32_t shellIndicexC,
+                                       uint32_t shellIndexC,
                                        const uint32_t*restrict shellIndicesD,
                                        uint32_t shellIndicesCount,
-                                       double **integrals,
-                                       int *integralsCountPtr)
+                                       double *restrict integrals,
+                                       size_t integralsCapacity,
+                                       size_t *restrict integralsOffsets,
+                                       uint32_t *restrict integralsCounts)
 {
-    int totalIntegralsCount = 0;
+    /* A and C are fixed, so their class bits are merged once, and the
+       cached AB pair data is looked up once per run of equal B */
+    const uint32_t *restrict momentum = basis->momentum;
+    const uint32_t *restrict ncgto = basis->ncgto;
+    const uint32_t orshellAC = momentum[shellIndexA] | momentum[shellIndexC];
+    const uint32_t orcgtoAC = ncgto[shellIndexA] | ncgto[shellIndexC];
+    const uint32_t *restrict lshell = basis->lshell;
+    const uint32_t orlshellAC = lshell[shellIndexA] | lshell[shellIndexC];
+    const double **exp = (const double**)basis->exp;
+    const double **cc = (const double**)basis->cc;
+    const double **norm = (const double**)basis->norm;
+    const size_t capacity = erd->capacity;
+    double *restrict scratch = erd->buffer[threadId];
+    uint32_t pairB = UINT32_MAX, npairab = 0;
+    const double *pairab = NULL;
+
+    size_t offset = 0;
     for (uint32_t shellIndicesIndex = 0; shellIndicesIndex != shellIndicesCount; shellIndicesIndex += 1) {
-        int integralsCount = 0;
-        CIntStatus_t status = CInt_computeShellQuartet(basis, erd, threadId,
-            shellIndicexA, shellIndicesB[shellIndicesIndex], shellIndicexC, shellIndicesD[shellIndicesIndex],
-            integrals, &integralsCount);
-        if (status != CINT_STATUS_SUCCESS) {
-            *integralsCountPtr = totalIntegralsCount;
-            return status;
+        const uint32_t shellIndexB = shellIndicesB[shellIndicesIndex];
+        const uint32_t shellIndexD = shellIndicesD[shellIndicesIndex];
+        if (shellIndexB != pairB) {
+            pairab = get_pair(erd, shellIndexA, shellIndexB, &npairab);
+            pairB = shellIndexB;
+        }
+        const uint32_t orshell = orshellAC | momentum[shellIndexB] | momentum[shellIndexD];
+        const bool general = (orcgtoAC | ncgto[shellIndexB] | ncgto[shellIndexD]) > 1;
+        const uint32_t orlshell = orlshellAC | lshell[shellIndexB] | lshell[shellIndexD];
+
+        /* The kernels use their output buffer as scratch and leave the result at its head,
+           so write straight into the caller's buffer whenever a full scratch fits there */
+        const bool direct = integralsCapacity - offset >= capacity;
+        double *restrict output = direct ? &integrals[offset] : scratch;
+        uint32_t integralsCount = 0;
+        if ((orshell < 2) && !general) {
+            erd__1111_csgto(
+                shellIndexA, shellIndexB, shellIndexC, shellIndexD,
+                basis->nexp, momentum, lshell, basis->xyz0,
+                exp, basis->minexp, cc, norm,
+                erd->primitive_tol,
+                capacity, &integralsCount, output);
+        } else if (orlshell != 0) {
+            integralsCount = compute_lshell_parts(basis, erd, threadId,
+                shellIndexA, shellIndexB, shellIndexC, shellIndexD);
+            memcpy(output, erd->lbuffer[threadId], integralsCount * sizeof(double));
+        } else if (!general && is_2222_class(momentum[shellIndexA], momentum[shellIndexB], momentum[shellIndexC], momentum[shellIndexD])) {
+            uint32_t npaircd;
+            const double *paircd = get_pair(erd, shellIndexC, shellIndexD, &npaircd);
+            erd__2222_csgto(
+                shellIndexA, shellIndexB, shellIndexC, shellIndexD,
+                basis->nexp, momentum, basis->xyz0,
+                exp, basis->minexp, cc, norm,
+                basis->basistype,
+                pairab, npairab, paircd, npaircd,
+                erd->primitive_tol,
+                capacity, &integralsCount, output);
+        } else {
+            uint32_t npaircd;
+            const double *paircd = get_pair(erd, shellIndexC, shellIndexD, &npaircd);
+            const double *hrrab_value, *hrrcd_value;
+            const uint32_t *hrrab_index = get_hrr(basis, erd, threadId, shellIndexA, shellIndexB, &hrrab_value);
+            const uint32_t *hrrcd_index = get_hrr(basis, erd, threadId, shellIndexC, shellIndexD, &hrrcd_value);
+            erd__csgto(
+                shellIndexA, shellIndexB, shellIndexC, shellIndexD,
+                basis->nexp, ncgto, momentum, basis->xyz0,
+                exp, basis->minexp, cc, norm,
+                erd->vrrtable, erd->ry_index, erd->ry_value,
+                basis->basistype,
+                pairab, npairab, paircd, npaircd,
+                hrrab_index, hrrab_value, hrrcd_index, hrrcd_value,
+                erd->primitive_tol,
+                capacity, &integralsCount, output,
+                erd->scratch[threadId]);
+        }
+        if (!direct) {
+            if (integralsCapacity - offset < integralsCount) {
+                for (uint32_t i = shellIndicesIndex; i != shellIndicesCount; i += 1) {
+                    integralsOffsets[i] = offset;
+                    integralsCounts[i] = 0;
+                }
+                return CINT_STATUS_INVALID_VALUE;
+            }
+            memcpy(&integrals[offset], scratch, integralsCount * sizeof(double));
         }
-        totalIntegralsCount += integralsCount;
+        integralsOffsets[shellIndicesIndex] = offset;
+        integralsCounts[shellIndicesIndex] = integralsCount;
+        offset += integralsCount;
     }
-    *integralsCountPtr = totalIntegralsCount;
+    return CINT_STATUS_SUCCESS;
+}
+
+
+CIntStatus_t CInt_computeShellPairDiagonal(BasisSet_t basis, ERD_t erd, int tid,
+                                           int M, int N,
+                                           double **integrals, int *nints)
+{
+    const uint32_t shell1 = basis->momentum[M];
+    const uint32_t shell2 = basis->momentum[N];
+    const bool general = (basis->ncgto[M] | basis->ncgto[N]) > 1;
+    const uint32_t orlshell = basis->lshell[M] | basis->lshell[N];
+    if ((((shell1 | shell2) < 2) && !general) || (orlshell != 0) ||
+        (!general && is_2222_class(shell1, shell2, shell1, shell2))) {
+        /* ...the classes with their own kernels are cheap enough to take
+           the diagonal from the full batch, compacted in place */
+        CInt_computeShellQuartet(basis, erd, tid, M, N, M, N, integrals, nints);
+        if (*nints != 0) {
+            const int dimM = CInt_getShellDim(basis, M);
+            const int dimN = CInt_getShellDim(basis, N);
+            const size_t strideM = 1 + (size_t)dimM * dimN;
+            const size_t strideN = dimM * strideM;
+            double *batch = *integrals;
+            for (int iN = 0; iN < dimN; iN++) {
+                for (int iM = 0; iM < dimM; iM++) {
+                    batch[iM + dimM * iN] = batch[iM * strideM + iN * strideN];
+                }
+            }
+            *nints = dimM * dimN;
+        }
+        return CINT_STATUS_SUCCESS;
+    }
+
+    uint32_t integrals_count = 0;
+    uint32_t npair;
+    const double *pair = get_pair(erd, M, N, &npair);
+    const double *hrr_value;
+    const uint32_t *hrr_index = get_hrr(basis, erd, tid, M, N, &hrr_value);
+    erd__csgto_diagonal(
+        M, N,
+        basis->nexp, basis->ncgto, basis->momentum, basis->xyz0,
+        (const double**)basis->exp, basis->minexp, (const double**)basis->cc, (const double**)basis->norm,
+        erd->vrrtable, erd->ry_index, erd->ry_value,
+        basis->basistype,
+        pair, npair,
+        hrr_index, hrr_value,
+        erd->primitive_tol,
+        erd->capacity, &integrals_count, erd->buffer[tid],
+        erd->scratch[tid]);
+    *integrals = erd->buffer[tid];
+    *nints = integrals_count;
     return CINT_STATUS_SUCCESS;
 }
 
 
 void CInt_getMaxMemory(ERD_t erd, double *memsize)
 {
-    *memsize = erd->capacity * sizeof(double) * erd->nthreads;
+    *memsize = (erd->capacity * sizeof(double) + erd->scratch_size) * erd->nthreads;
+}
+
+
+CIntStatus_t CInt_setPrimitiveScreening(ERD_t erd, double tolerance)
+{
+    if (!(tolerance >= 0.0)) {
+        return CINT_STATUS_INVALID_VALUE;
+    }
+    erd->primitive_tol = tolerance;
+    return CINT_STATUS_SUCCESS;
+}
+
+
+double CInt_getPrimitiveScreening(ERD_t erd)
+{
+    return erd->primitive_tol;
+}
+
+
+CIntISA_t CInt_getERDISA(ERD_t erd)
+{
+    return (CIntISA_t)erd->isa;
+}
+
+
+/* Cartesian components of all momenta from lmin to lmax */
+static inline double ncart_range(uint32_t lmin, uint32_t lmax)
+{
+    double n = 0.0;
+    for (uint32_t l = lmin; l <= lmax; l++) {
+        n += (l + 1) * (l + 2) / 2;
+    }
+    return n;
+}
+
+
+double CInt_getQuartetCost(BasisSet_t basis, ERD_t erd, int A, int B, int C, int D)
+{
+    const uint32_t la = basis->momentum[A];
+    const uint32_t lb = basis->momentum[B];
+    const uint32_t lc = basis->momentum[C];
+    const uint32_t ld = basis->momentum[D];
+    uint32_t npairab, npaircd;
+    if (get_pair(erd, A, B, &npairab) == NULL) {
+        npairab = basis->nexp[A] * basis->nexp[B];
+    }
+    if (get_pair(erd, C, D, &npaircd) == NULL) {
+        npaircd = basis->nexp[C] * basis->nexp[D];
+    }
+    /* ...an L-shell has its s-function on top */
+    const double nabcd = (ncart_range(la, la) + basis->lshell[A]) * (ncart_range(lb, lb) + basis->lshell[B]) *
+        (ncart_range(lc, lc) + basis->lshell[C]) * (ncart_range(ld, ld) + basis->lshell[D]);
+    const double call = 64.0;
+    const double nrs = (double)basis->ncgto[A] * basis->ncgto[B];
+    const double ntu = (double)basis->ncgto[C] * basis->ncgto[D];
+    if (((la | lb | lc | ld) < 2) && (nrs * ntu == 1.0)) {
+        return call + (double)npairab * npaircd * (16.0 + 2.0 * nabcd);
+    }
+    /* Per primitive quartet: Rys roots and 2D integrals, then the
+       contraction of the 2D integrals into the (e0|f0) batch over ngqp
+       roots; per contracted quartet: the HRR and spherical transforms */
+    const uint32_t shellp = la + lb;
+    const uint32_t shellq = lc + ld;
+    const double ngqp = (shellp + shellq) / 2 + 1;
+    const double nxyzet = ncart_range(MAX(la, lb), shellp);
+    const double nxyzft = ncart_range(MAX(lc, ld), shellq);
+    const double primitive = ngqp * (32.0 + 3.0 * (shellp + 1) * (shellq + 1) + nxyzet * nxyzft);
+    /* Generally contracted shells: the primitive batch is contracted into
+       all rstu quadruplets, each of which goes through the HRR */
+    const double contraction = (nrs * ntu == 1.0) ? 0.0 :
+        nxyzet * nxyzft * npairab * (npaircd * ntu + nrs * ntu);
+    return call + (double)npairab * npaircd * primitive + contraction +
+        2.0 * nxyzet * nxyzft * (shellp + shellq) * nrs * ntu;
 }
 
 #ifdef __INTEL_OFFLOAD
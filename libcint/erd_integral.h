@@ -9,6 +9,29 @@
 
 
 #define MAX(a,b)    ((a) < (b) ? (b) : (a))
+#define MIN(a,b)    ((a) > (b) ? (b) : (a))
+
+/* Primitive pairs whose estimated contribution with any other pair is below
+   ERD_PAIR_TOL are dropped from the shell pair cache */
+#define ERD_PAIR_TOL 1.0e-15
+/* Default primitive screening threshold of a new ERD handle (see
+   CInt_setPrimitiveScreening) */
+#ifndef ERD_PRIMITIVE_TOL
+#define ERD_PRIMITIVE_TOL 0.0
+#endif
+/* Memory limit for the shell pair cache; pairs beyond it are computed on the fly */
+#ifndef ERD_PAIR_MAX_MEMORY
+#define ERD_PAIR_MAX_MEMORY ((size_t)512 << 20)
+#endif
+/* Memory limit for the HRR matrices set up with the shell pair cache; the
+   pairs beyond it go through a per-thread cache of ERD_HRR_LRU_SLOTS
+   recently used matrices */
+#ifndef ERD_HRR_MAX_MEMORY
+#define ERD_HRR_MAX_MEMORY ((size_t)128 << 20)
+#endif
+#ifndef ERD_HRR_LRU_SLOTS
+#define ERD_HRR_LRU_SLOTS 16
+#endif
 
 
 #ifdef __INTEL_OFFLOAD
@@ -17,19 +40,90 @@
 
 extern uint32_t erd__1111_csgto(
     uint32_t A, uint32_t B, uint32_t C, uint32_t D,
-    const uint32_t npgto[restrict static 1], const uint32_t shell[restrict static 1], const double xyz0[restrict static 1],
+    const uint32_t npgto[restrict static 1], const uint32_t shell[restrict static 1], const uint32_t lshell[restrict static 1], const double xyz0[restrict static 1],
     const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    double tol,
     uint32_t buffer_capacity, uint32_t integral_counts[restrict static 1], double output_buffer[restrict static 81]);
 
+extern void erd__2222_csgto(
+    uint32_t A, uint32_t B, uint32_t C, uint32_t D,
+    const uint32_t npgto[restrict static 1], const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    bool spheric,
+    const double *restrict pairab, uint32_t npairab, const double *restrict paircd, uint32_t npaircd,
+    double tol,
+    uint32_t buffer_capacity, uint32_t integral_counts[restrict static 1], double output_buffer[restrict static 1]);
+
 extern uint32_t erd__csgto(
     uint32_t A, uint32_t B, uint32_t C, uint32_t D,
-    const uint32_t npgto[restrict static 1], const uint32_t shell[restrict static 1], const double xyz0[restrict static 1],
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
     const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
     int **vrrtab,
+    const uint32_t ryindex[restrict static 1], const double ryvalue[restrict static 1],
     bool spheric,
-    uint32_t buffer_capacity, uint32_t integral_counts[restrict static 1], double output_buffer[restrict static 1]);
+    const double *restrict pairab, uint32_t npairab, const double *restrict paircd, uint32_t npaircd,
+    const uint32_t *restrict hrrab_index, const double *restrict hrrab_value,
+    const uint32_t *restrict hrrcd_index, const double *restrict hrrcd_value,
+    double tol,
+    uint32_t buffer_capacity, uint32_t integral_counts[restrict static 1], double output_buffer[restrict static 1],
+    void *restrict scratch);
+
+extern void erd__csgto_into(
+    uint32_t A, uint32_t B, uint32_t C, uint32_t D,
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    int **vrrtab,
+    const uint32_t ryindex[restrict static 1], const double ryvalue[restrict static 1],
+    bool spheric,
+    const double *restrict pairab, uint32_t npairab, const double *restrict paircd, uint32_t npaircd,
+    const uint32_t *restrict hrrab_index, const double *restrict hrrab_value,
+    const uint32_t *restrict hrrcd_index, const double *restrict hrrcd_value,
+    double tol,
+    uint32_t buffer_capacity, uint32_t integral_counts[restrict static 1], double output_buffer[restrict static 1],
+    void *restrict scratch,
+    double dst[restrict static 1], const size_t ld[restrict static 4]);
+
+extern void erd__csgto_diagonal(
+    uint32_t A, uint32_t B,
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double minalpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    int **vrrtab,
+    const uint32_t ryindex[restrict static 1], const double ryvalue[restrict static 1],
+    bool spheric,
+    const double *restrict pairab, uint32_t npairab,
+    const uint32_t *restrict hrrab_index, const double *restrict hrrab_value,
+    double tol,
+    uint32_t buffer_capacity, uint32_t integral_counts[restrict static 1], double output_buffer[restrict static 1],
+    void *restrict scratch);
+
+extern void erd__store_batch(uint32_t n1, uint32_t n2, uint32_t n3, uint32_t n4,
+    const uint32_t s[restrict static 4], const double x[restrict],
+    const size_t ld[restrict static 4], double y[restrict]);
+
+extern void erd__ry_table_size(uint32_t maxshell, size_t nindex[restrict static 1], size_t nvalue[restrict static 1]);
+
+extern void erd__ry_table(uint32_t maxshell, uint32_t index[restrict], double value[restrict]);
+
+extern void erd__hrr_pair_size(uint32_t shella, uint32_t shellb, uint32_t nabcoor,
+    size_t nindex[restrict static 1], size_t nvalue[restrict static 1]);
+
+extern void erd__hrr_pair_matrix(uint32_t A, uint32_t B,
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 1],
+    uint32_t index[restrict], double value[restrict]);
+
+extern size_t erd__pair_data_size(uint32_t npair, uint32_t nctr);
+
+extern uint32_t erd__shell_pair_data(uint32_t A, uint32_t B,
+    const uint32_t npgto[restrict static 1], const uint32_t ncgto[restrict static 1],
+    const uint32_t shell[restrict static 1], const double xyz0[restrict static 4],
+    const double *restrict alpha[restrict static 1], const double *restrict cc[restrict static 1], const double *restrict norm[restrict static 1],
+    double tol, double data[restrict], double bound[restrict static 1]);
 
 extern size_t erd__memory_csgto(uint32_t npgto1, uint32_t npgto2, uint32_t npgto3, uint32_t npgto4,
+    uint32_t ncgto1, uint32_t ncgto2, uint32_t ncgto3, uint32_t ncgto4,
     uint32_t shell1, uint32_t shell2, uint32_t shell3, uint32_t shell4,
     double x1, double y1, double z1,
     double x2, double y2, double z2,
@@ -37,6 +131,19 @@ extern size_t erd__memory_csgto(uint32_t npgto1, uint32_t npgto2, uint32_t npgto
     double x4, double y4, double z4,
     bool spheric);
 
+extern size_t erd__scratch_csgto(uint32_t npgto1, uint32_t npgto2, uint32_t npgto3, uint32_t npgto4,
+    uint32_t ncgto1, uint32_t ncgto2, uint32_t ncgto3, uint32_t ncgto4,
+    uint32_t shell1, uint32_t shell2, uint32_t shell3, uint32_t shell4,
+    bool spheric);
+
+/* Selects the ERD kernels of ISA level isa (a CIntISA_t, 0 for the best the
+   CPU supports) in builds with runtime dispatch; returns the level in use */
+extern int erd__select_isa(int isa);
+
+/* Sizes the primitive blocks for a cache of cache bytes (0 for a default);
+   returns the block size in bytes */
+extern size_t erd__select_block_size(size_t cache);
+
 #ifdef __INTEL_OFFLOAD
 #pragma offload_attribute(pop)
 #endif
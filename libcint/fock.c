@@ -0,0 +1,475 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "config.h"
+#include "cint_def.h"
+
+
+/* The thread-private accumulators are shell blocked: block (M, N) is a
+   row-major dimM x dimN array at f_start_id[M] * nbf + dimM * f_start_id[N].
+   Block row M thus covers the same contiguous range as the function rows
+   of M, and every quartet updates a few contiguous blocks. */
+static inline size_t block_offset(BasisSet_t basis, size_t nbf, int M, int N) {
+    return basis->f_start_id[M] * nbf + (size_t)CInt_getShellDim(basis, M) * basis->f_start_id[N];
+}
+
+
+/* Adds the unique quartet (MN|PQ), scaled by its degeneracy factor, to the
+   unsymmetrized accumulators Jt and Kt, where J = Jt + Jt^T and K = Kt + Kt^T:
+       Jt(m,n) += 2 (mn|pq) D(p,q)       Jt(p,q) += 2 (mn|pq) D(m,n)
+       Kt(m,p) += (mn|pq) D(n,q)         Kt(p,n) += (mn|pq) D(m,q)
+       Kt(m,q) += (mn|pq) D(n,p)         Kt(n,q) += (mn|pq) D(m,p)
+   These are the contributions of all eight permutations of (mn|pq). D, Jt
+   and Kt hold the NDENS densities interleaved, D(p,q) of density d being
+   D[(p * nbf + q) * ndens + d], so the innermost loops run over d. */
+static inline void digest_quartet(BasisSet_t basis, size_t nbf, int ndens,
+                                  int M, int N, int P, int Q, double scale,
+                                  const double *restrict integrals,
+                                  const double *restrict D,
+                                  double *Jt, double *Kt)
+{
+    const int dimM = CInt_getShellDim(basis, M);
+    const int dimN = CInt_getShellDim(basis, N);
+    const int dimP = CInt_getShellDim(basis, P);
+    const int dimQ = CInt_getShellDim(basis, Q);
+    const size_t startM = CInt_getFuncStartInd(basis, M);
+    const size_t startN = CInt_getFuncStartInd(basis, N);
+    const size_t startP = CInt_getFuncStartInd(basis, P);
+    const size_t startQ = CInt_getFuncStartInd(basis, Q);
+    double *JMN = Jt + block_offset(basis, nbf, M, N) * ndens;
+    double *JPQ = Jt + block_offset(basis, nbf, P, Q) * ndens;
+    double *KMP = Kt + block_offset(basis, nbf, M, P) * ndens;
+    double *KPN = Kt + block_offset(basis, nbf, P, N) * ndens;
+    double *KMQ = Kt + block_offset(basis, nbf, M, Q) * ndens;
+    double *KNQ = Kt + block_offset(basis, nbf, N, Q) * ndens;
+    double jpq[ndens], kpn[ndens], knq[ndens];
+
+    for (int iQ = 0; iQ < dimQ; iQ++) {
+        const size_t q = startQ + iQ;
+        for (int iP = 0; iP < dimP; iP++) {
+            const size_t p = startP + iP;
+            const double *restrict dpq = &D[(p * nbf + q) * ndens];
+            for (int d = 0; d < ndens; d++) {
+                jpq[d] = 0.0;
+            }
+            for (int iN = 0; iN < dimN; iN++) {
+                const size_t n = startN + iN;
+                const double *restrict dnq = &D[(n * nbf + q) * ndens];
+                const double *restrict dnp = &D[(n * nbf + p) * ndens];
+                const double *restrict I = &integrals[dimM * (iN + dimN * (iP + dimP * iQ))];
+                for (int d = 0; d < ndens; d++) {
+                    kpn[d] = 0.0;
+                    knq[d] = 0.0;
+                }
+                for (int iM = 0; iM < dimM; iM++) {
+                    const size_t m = startM + iM;
+                    const double *restrict dmn = &D[(m * nbf + n) * ndens];
+                    const double *restrict dmq = &D[(m * nbf + q) * ndens];
+                    const double *restrict dmp = &D[(m * nbf + p) * ndens];
+                    double *jmn = &JMN[(iM * dimN + iN) * ndens];
+                    double *kmp = &KMP[(iM * dimP + iP) * ndens];
+                    double *kmq = &KMQ[(iM * dimQ + iQ) * ndens];
+                    const double v = scale * I[iM];
+                    for (int d = 0; d < ndens; d++) {
+                        jmn[d] += 2.0 * v * dpq[d];
+                        jpq[d] += v * dmn[d];
+                        kmp[d] += v * dnq[d];
+                        kpn[d] += v * dmq[d];
+                        kmq[d] += v * dnp[d];
+                        knq[d] += v * dmp[d];
+                    }
+                }
+                double *kpn_out = &KPN[(iP * dimN + iN) * ndens];
+                double *knq_out = &KNQ[(iN * dimQ + iQ) * ndens];
+                for (int d = 0; d < ndens; d++) {
+                    kpn_out[d] += kpn[d];
+                    knq_out[d] += knq[d];
+                }
+            }
+            double *jpq_out = &JPQ[(iP * dimQ + iQ) * ndens];
+            for (int d = 0; d < ndens; d++) {
+                jpq_out[d] += 2.0 * jpq[d];
+            }
+        }
+    }
+}
+
+
+typedef struct {
+    BasisSet_t basis;
+    ERD_t erd;
+    int nshells;
+    size_t nbf;
+    int ndens;
+    double tol2;
+    const int *shellptr;
+    const int *shellid;
+    const double *shellvalue;
+    /* Interleaved densities */
+    const double *D;
+    /* Incremental mode only: max |D| of every shell pair and shell row */
+    const double *Dshell;
+    const double *Drow;
+} FockBuild;
+
+
+/* digest_quartet of the densities of fock. Both calls inline the same
+   loops; the literal ndens = 1 of the first lets the compiler fold away
+   the density loops of the common single density case. */
+static inline void digest(const FockBuild *fock, int M, int N, int P, int Q, double scale,
+                          const double *restrict integrals, double *Jt, double *Kt)
+{
+    if (fock->ndens == 1) {
+        digest_quartet(fock->basis, fock->nbf, 1, M, N, P, Q, scale, integrals, fock->D, Jt, Kt);
+    } else {
+        digest_quartet(fock->basis, fock->nbf, fock->ndens, M, N, P, Q, scale, integrals, fock->D, Jt, Kt);
+    }
+}
+
+
+/* Task t covers the row pair (M, P), P <= M, with t = M (M + 1) / 2 + P */
+static inline void task_shells(int t, int *M, int *P) {
+    int m = (int)((sqrt(8.0 * t + 1.0) - 1.0) / 2.0);
+    while (m * (m + 1) / 2 > t) {
+        m--;
+    }
+    while ((m + 1) * (m + 2) / 2 <= t) {
+        m++;
+    }
+    *M = m;
+    *P = t - m * (m + 1) / 2;
+}
+
+
+/* Processes the unique quartets (MN|PQ) of row pair (M, P): N <= M, Q <= P
+   and (P, Q) <= (M, N). The Schwarz rows are sorted by descending value,
+   hence the early breaks. With cost given, the quartets are only counted:
+   cost[0] and cost[1] get the sums of their modelled integral and per
+   density digestion costs, which hold for every build of a plan (see
+   CInt_createFockPlan). */
+static void fock_task(const FockBuild *fock, int tid, int M, int P,
+                      double *cost, double *Jt, double *Kt)
+{
+    BasisSet_t basis = fock->basis;
+    const int nshells = fock->nshells;
+    const int *shellptr = fock->shellptr;
+    const int *shellid = fock->shellid;
+    const double *shellvalue = fock->shellvalue;
+    const double *Dshell = fock->Dshell;
+    const double *Drow = fock->Drow;
+    const double tol2 = fock->tol2;
+    if (cost != NULL) {
+        cost[0] = 0.0;
+        cost[1] = 0.0;
+    }
+    for (int i = shellptr[M]; i < shellptr[M + 1]; i++) {
+        const int N = shellid[i];
+        const double valueMN = shellvalue[i];
+        if ((shellptr[P] == shellptr[P + 1]) || (valueMN * shellvalue[shellptr[P]] < tol2)) {
+            break;
+        }
+        if (N > M) {
+            continue;
+        }
+        /* Coulomb terms count twice. DMNP bounds the weight of every
+           quartet (MN|PQ) of this row, DMNPQ that of the quartet. */
+        double DMNP = 1.0;
+        if (Dshell != NULL) {
+            DMNP = fmax(fmax(2.0 * Dshell[M * nshells + N], Dshell[N * nshells + P]),
+                        fmax(Dshell[M * nshells + P], fmax(2.0 * Drow[P], fmax(Drow[M], Drow[N]))));
+        }
+        for (int j = shellptr[P]; j < shellptr[P + 1]; j++) {
+            const int Q = shellid[j];
+            if (valueMN * shellvalue[j] * DMNP * DMNP < tol2) {
+                break;
+            }
+            if ((Q > P) || ((P == M) && (Q > N))) {
+                continue;
+            }
+            if (Dshell != NULL) {
+                const double DMNPQ = fmax(fmax(2.0 * Dshell[M * nshells + N], 2.0 * Dshell[P * nshells + Q]),
+                                          fmax(fmax(Dshell[N * nshells + Q], Dshell[M * nshells + Q]),
+                                               fmax(Dshell[N * nshells + P], Dshell[M * nshells + P])));
+                if (valueMN * shellvalue[j] * DMNPQ * DMNPQ < tol2) {
+                    continue;
+                }
+            }
+            if (cost != NULL) {
+                cost[0] += CInt_getQuartetCost(basis, fock->erd, M, N, P, Q);
+                cost[1] += (double)(CInt_getShellDim(basis, M) * CInt_getShellDim(basis, N)) *
+                    (CInt_getShellDim(basis, P) * CInt_getShellDim(basis, Q)) * 6;
+                continue;
+            }
+            double *integrals;
+            int nints;
+            CInt_computeShellQuartet(basis, fock->erd, tid, M, N, P, Q, &integrals, &nints);
+            if (nints == 0) {
+                continue;
+            }
+            double scale = 1.0;
+            if (M == N) {
+                scale *= 0.5;
+            }
+            if (P == Q) {
+                scale *= 0.5;
+            }
+            if ((M == P) && (N == Q)) {
+                scale *= 0.5;
+            }
+            digest(fock, M, N, P, Q, scale, integrals, Jt, Kt);
+        }
+    }
+}
+
+
+CIntStatus_t CInt_createFockPlan(BasisSet_t basis, ERD_t erd, Schwarz_t schwarz,
+                                 FockPlan_t *plan)
+{
+    const int nshells = CInt_getNumShells(basis);
+    if (schwarz->nshells != nshells) {
+        return CINT_STATUS_INVALID_VALUE;
+    }
+    FockPlan_t p = (FockPlan_t)calloc(1, sizeof(struct FockPlan));
+    if (p == NULL) {
+        return CINT_STATUS_ALLOC_FAILED;
+    }
+    p->schwarz = schwarz;
+    p->ntasks = nshells * (nshells + 1) / 2;
+    p->taskcost = (double *)malloc(sizeof(double) * 2 * p->ntasks);
+    if (p->taskcost == NULL) {
+        free(p);
+        return CINT_STATUS_ALLOC_FAILED;
+    }
+
+    /* Quartets are only counted, so there are no densities */
+    const FockBuild fock = {
+        basis, erd, nshells, CInt_getNumFuncs(basis), 1, schwarz->tolerance * schwarz->tolerance,
+        schwarz->shellptr, schwarz->shellid, schwarz->shellvalue, NULL, NULL, NULL
+    };
+    #pragma omp parallel for schedule(dynamic, 64) num_threads(erd->nthreads)
+    for (int t = 0; t < p->ntasks; t++) {
+        int M, P;
+        task_shells(t, &M, &P);
+        fock_task(&fock, 0, M, P, &p->taskcost[2 * t], NULL, NULL);
+    }
+
+    *plan = p;
+    return CINT_STATUS_SUCCESS;
+}
+
+
+CIntStatus_t CInt_destroyFockPlan(FockPlan_t plan) {
+    free(plan->taskcost);
+    free(plan);
+    return CINT_STATUS_SUCCESS;
+}
+
+
+/* Builds J[d] and K[d] of the ndens densities D[d]. In incremental mode D
+   holds density differences, quartets are also screened by the largest
+   |D| of the shell blocks they touch, and the result is added to J/K. */
+static CIntStatus_t build_fock(BasisSet_t basis, ERD_t erd, FockPlan_t plan,
+                               int ndens, const double *const D[], int ldd,
+                               double *const J[], double *const K[], int ldf,
+                               int incremental)
+{
+    const int nshells = CInt_getNumShells(basis);
+    const size_t nbf = CInt_getNumFuncs(basis);
+    const Schwarz_t schwarz = plan->schwarz;
+    const int ntasks = nshells * (nshells + 1) / 2;
+    if ((ndens < 1) || (ldd < (int)nbf) || (ldf < (int)nbf) || (schwarz->nshells != nshells) ||
+        (plan->ntasks != ntasks)) {
+        return CINT_STATUS_INVALID_VALUE;
+    }
+    const int nthreads = erd->nthreads;
+
+    /* The interleaved densities, then Jt and Kt of every thread, each padded
+       to a multiple of 8 doubles */
+    const size_t stride = (nbf * nbf * ndens + 7) / 8 * 8;
+    double *accumulators = (double *)ALIGNED_MALLOC(sizeof(double) * (2 * nthreads + 1) * stride);
+    if (accumulators == NULL) {
+        return CINT_STATUS_ALLOC_FAILED;
+    }
+    double *Dall = &accumulators[2 * nthreads * stride];
+    /* max |D| over the densities and functions of every shell pair, and
+       over the shell pairs of every shell row */
+    double *Dshell = NULL;
+    double *Drow = NULL;
+    if (incremental) {
+        Dshell = (double *)malloc(sizeof(double) * nshells * (nshells + 1));
+        if (Dshell == NULL) {
+            ALIGNED_FREE(accumulators);
+            return CINT_STATUS_ALLOC_FAILED;
+        }
+        Drow = &Dshell[nshells * nshells];
+    }
+    double *cost = (double *)malloc(sizeof(double) * (ntasks + 1));
+    if (cost == NULL) {
+        free(Dshell);
+        ALIGNED_FREE(accumulators);
+        return CINT_STATUS_ALLOC_FAILED;
+    }
+    const double *taskcost = plan->taskcost;
+    const FockBuild fock = {
+        basis, erd, nshells, nbf, ndens, schwarz->tolerance * schwarz->tolerance,
+        schwarz->shellptr, schwarz->shellid, schwarz->shellvalue, Dall, Dshell, Drow
+    };
+    Scheduler_t scheduler = NULL;
+    CIntStatus_t status = CINT_STATUS_SUCCESS;
+
+    #pragma omp parallel num_threads(nthreads)
+    {
+        /* The team may be smaller than nthreads (OMP_DYNAMIC, a thread
+           limit or a nested call), so only its accumulators are used */
+        #ifdef _OPENMP
+        const int tid = omp_get_thread_num();
+        const int nteam = omp_get_num_threads();
+        #else
+        const int tid = 0;
+        const int nteam = 1;
+        #endif
+        double *Jt = &accumulators[2 * stride * tid];
+        double *Kt = Jt + stride;
+        memset(Jt, 0, sizeof(double) * 2 * stride);
+
+        #pragma omp for
+        for (size_t p = 0; p < nbf; p++) {
+            for (size_t q = 0; q < nbf; q++) {
+                for (int d = 0; d < ndens; d++) {
+                    Dall[(p * nbf + q) * ndens + d] = D[d][p * ldd + q];
+                }
+            }
+        }
+
+        if (incremental) {
+            #pragma omp for schedule(dynamic)
+            for (int M = 0; M < nshells; M++) {
+                const int dimM = CInt_getShellDim(basis, M);
+                const size_t startM = CInt_getFuncStartInd(basis, M);
+                double rowmax = 0.0;
+                for (int N = 0; N < nshells; N++) {
+                    const int dimN = CInt_getShellDim(basis, N);
+                    const size_t startN = CInt_getFuncStartInd(basis, N);
+                    double value = 0.0;
+                    for (int iM = 0; iM < dimM; iM++) {
+                        const double *restrict row = &Dall[((startM + iM) * nbf + startN) * ndens];
+                        for (int k = 0; k < dimN * ndens; k++) {
+                            value = fmax(value, fabs(row[k]));
+                        }
+                    }
+                    Dshell[M * nshells + N] = value;
+                    rowmax = fmax(rowmax, value);
+                }
+                Drow[M] = rowmax;
+            }
+        }
+
+        /* Task costs of the plan for ndens densities, then an LPT partition
+           of the tasks with work stealing. The density screening of
+           incremental builds only drops work, which the stealing evens
+           out. */
+        #pragma omp for
+        for (int t = 0; t < ntasks; t++) {
+            cost[t] = taskcost[2 * t] + ndens * taskcost[2 * t + 1];
+        }
+        #pragma omp single
+        {
+            status = CInt_createScheduler(ntasks, cost, nteam, &scheduler);
+        }
+        if (status == CINT_STATUS_SUCCESS) {
+            for (int t = CInt_getNextTask(scheduler, tid); t >= 0; t = CInt_getNextTask(scheduler, tid)) {
+                int M, P;
+                task_shells(t, &M, &P);
+                fock_task(&fock, tid, M, P, NULL, Jt, Kt);
+            }
+        }
+        #pragma omp barrier
+
+        /* Blocked reduction into the accumulators of thread 0: block row M
+           is the contiguous range of the function rows of M */
+        #pragma omp for schedule(dynamic)
+        for (int M = 0; M < nshells; M++) {
+            const size_t start = basis->f_start_id[M] * nbf * ndens;
+            const size_t end = start + (size_t)CInt_getShellDim(basis, M) * nbf * ndens;
+            for (int t = 1; t < nteam; t++) {
+                const double *restrict Jt_t = &accumulators[2 * stride * t];
+                const double *restrict Kt_t = Jt_t + stride;
+                for (size_t k = start; k < end; k++) {
+                    accumulators[k] += Jt_t[k];
+                    accumulators[stride + k] += Kt_t[k];
+                }
+            }
+        }
+
+        /* J = Jt + Jt^T and K = Kt + Kt^T in the caller's layout, added to
+           the previous J/K in incremental mode */
+        #pragma omp for schedule(dynamic)
+        for (int M = 0; M < nshells; M++) {
+            const int dimM = CInt_getShellDim(basis, M);
+            const int startM = CInt_getFuncStartInd(basis, M);
+            for (int N = 0; N < nshells; N++) {
+                const int dimN = CInt_getShellDim(basis, N);
+                const int startN = CInt_getFuncStartInd(basis, N);
+                const double *restrict JMN = &accumulators[block_offset(basis, nbf, M, N) * ndens];
+                const double *restrict JNM = &accumulators[block_offset(basis, nbf, N, M) * ndens];
+                const double *restrict KMN = JMN + stride;
+                const double *restrict KNM = JNM + stride;
+                for (int d = 0; d < ndens; d++) {
+                    for (int iM = 0; iM < dimM; iM++) {
+                        double *restrict Jrow = &J[d][(size_t)(startM + iM) * ldf + startN];
+                        double *restrict Krow = &K[d][(size_t)(startM + iM) * ldf + startN];
+                        for (int iN = 0; iN < dimN; iN++) {
+                            const double Jnew = JMN[(iM * dimN + iN) * ndens + d] + JNM[(iN * dimM + iM) * ndens + d];
+                            const double Knew = KMN[(iM * dimN + iN) * ndens + d] + KNM[(iN * dimM + iM) * ndens + d];
+                            Jrow[iN] = incremental ? Jrow[iN] + Jnew : Jnew;
+                            Krow[iN] = incremental ? Krow[iN] + Knew : Knew;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (scheduler != NULL) {
+        double predicted, measured;
+        int nstolen;
+        CInt_getSchedulerImbalance(scheduler, &predicted, &measured, &nstolen);
+        CINT_INFO("Fock build: %d tasks, imbalance predicted %.3lf measured %.3lf, %d stolen\n",
+            ntasks, predicted, measured, nstolen);
+        CInt_destroyScheduler(scheduler);
+    }
+    free(cost);
+    free(Dshell);
+    ALIGNED_FREE(accumulators);
+    return status;
+}
+
+
+CIntStatus_t CInt_buildFock(BasisSet_t basis, ERD_t erd, FockPlan_t plan,
+                            const double *D, int ldd,
+                            double *J, double *K, int ldf)
+{
+    return build_fock(basis, erd, plan, 1, &D, ldd, &J, &K, ldf, 0);
+}
+
+
+CIntStatus_t CInt_buildFockMulti(BasisSet_t basis, ERD_t erd, FockPlan_t plan,
+                                 int ndens, const double *const D[], int ldd,
+                                 double *const J[], double *const K[], int ldf)
+{
+    return build_fock(basis, erd, plan, ndens, D, ldd, J, K, ldf, 0);
+}
+
+
+CIntStatus_t CInt_buildFockIncremental(BasisSet_t basis, ERD_t erd, FockPlan_t plan,
+                                       const double *dD, int ldd,
+                                       double *J, double *K, int ldf)
+{
+    return build_fock(basis, erd, plan, 1, &dD, ldd, &J, &K, ldf, 1);
+}
@@ -4,8 +4,8 @@ header=CInt.h
 file=cint_def.h
 olddef=CINT_DEF_H
 newdef=__CINT_H__
-include=("#include <stdint.h>")
-struct=(ERD OED BasisSet)
+include=("#include <stddef.h>" "#include <stdint.h>")
+struct=(ERD OED BasisSet Schwarz Scheduler FockPlan)
 
 cp -r ${file} _temp
 sed -i '/'"$olddef"'/d' _temp
@@ -20,7 +20,7 @@ echo "" >> ${header}
 
 for str in "${include[@]}"
 do
-    echo ${include} >> ${header}
+    echo ${str} >> ${header}
 done
 echo "" >> ${header}
 echo "" >> ${header}
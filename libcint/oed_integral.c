@@ -9,37 +9,56 @@
 #include "config.h"
 
 
-static void config_oed (OED_t  oed, int A, int B, BasisSet_t basis)
+/* Sets up the pair A,B with the shell types shellA, shellB, those of the
+   s- or p-part for L-shells */
+static void config_oed (OED_t  oed, int A, int B, int shellA, int shellB,
+                        BasisSet_t basis)
 {
     int cc_offset_A;
     int cc_offset_B;
     int alpha_offset_A;
     int alpha_offset_B;
+    int ncc_A;
+    int ncc_B;
 
+    // the coefficients of a shell are (npgto, ncgto) in column order
+    ncc_A = basis->nexp[A] * basis->ncgto[A];
+    ncc_B = basis->nexp[B] * basis->ncgto[B];
     alpha_offset_A = 0;
     cc_offset_A = 0;
     alpha_offset_B = basis->nexp[A];
-    cc_offset_B = basis->nexp[A];
-    oed->ncoeff = alpha_offset_B + basis->nexp[B];
-    oed->nalpha = cc_offset_B + basis->nexp[B];
+    cc_offset_B = ncc_A;
+    oed->ncoeff = cc_offset_B + ncc_B;
+    oed->nalpha = alpha_offset_B + basis->nexp[B];
     
     memcpy (&(oed->alpha[alpha_offset_A]), basis->exp[A], sizeof(double) * basis->nexp[A]);
     memcpy (&(oed->alpha[alpha_offset_B]), basis->exp[B], sizeof(double) * basis->nexp[B]);
-    memcpy (&(oed->cc[cc_offset_A]), basis->cc[A], sizeof(double) * basis->nexp[A]);
-    memcpy (&(oed->cc[cc_offset_B]), basis->cc[B], sizeof(double) * basis->nexp[B]);
+    // the p-part coefficients of an L-shell follow those of the s-part
+    memcpy (&(oed->cc[cc_offset_A]),
+            &(basis->cc[A][basis->lshell[A] ? shellA * ncc_A : 0]),
+            sizeof(double) * ncc_A);
+    memcpy (&(oed->cc[cc_offset_B]),
+            &(basis->cc[B][basis->lshell[B] ? shellB * ncc_B : 0]),
+            sizeof(double) * ncc_B);
 
     oed->npgto1 = basis->nexp[A];
     oed->npgto2 = basis->nexp[B];
-    oed->cc_end[0] = oed->npgto1;
-    oed->cc_end[1] = oed->npgto2;    
+    oed->ncgto1 = basis->ncgto[A];
+    oed->ncgto2 = basis->ncgto[B];
+    oed->ncsum = oed->ncgto1 + oed->ncgto2;
+    for (int i = 0; i < oed->ncsum; i++)
+    {
+        oed->cc_beg[i] = 1;
+        oed->cc_end[i] = (i < oed->ncgto1) ? oed->npgto1 : oed->npgto2;
+    }
     oed->x1 = basis->xyz0[A*4];
     oed->y1 = basis->xyz0[A*4+1];
     oed->z1 = basis->xyz0[A*4+2];
     oed->x2 = basis->xyz0[B*4];
     oed->y2 = basis->xyz0[B*4+1];
     oed->z2 = basis->xyz0[B*4+2];
-    oed->shell1 = basis->momentum[A];
-    oed->shell2 = basis->momentum[B];
+    oed->shell1 = shellA;
+    oed->shell2 = shellB;
 }
 
 
@@ -57,10 +76,15 @@ static void oed_max_scratch (BasisSet_t basis, OED_t oed)
     
     config_oed (oed,
                 max_primid, max_primid,
+                basis->momentum[max_primid], basis->momentum[max_primid],
                 basis); 
 
     oed->shell1 = max_momentum;
     oed->shell2 = max_momentum;
+    oed->ncgto1 = basis->max_ncgto;
+    oed->ncgto2 = basis->max_ncgto;
+    oed->ncsum = oed->ncgto1 + oed->ncgto2;
+    oed->ncoeff = oed->npgto1 * oed->ncgto1 + oed->npgto2 * oed->ncgto2;
     oed->x1 = 1.0;
     oed->x2 = 2.0;
     oed->y1 = 1.0;
@@ -122,8 +146,6 @@ CIntStatus_t CInt_createOED (BasisSet_t basis, OED_t *oed)
     o->ncsum = 2;
     o->ncgto1 = 1;
     o->ncgto2 = 1;
-    o->cc_beg[0] = 1;
-    o->cc_beg[1] = 1;
     o->natoms = basis->natoms;
     o->xn = basis->xn;
     o->yn = basis->yn;
@@ -133,10 +155,14 @@ CIntStatus_t CInt_createOED (BasisSet_t basis, OED_t *oed)
     o->screen = OED_SCREEN;
     
     _maxnumExp (basis, &max_nexp);
-    o->cc = (double *)malloc (2 * max_nexp * sizeof(double));
+    o->cc = (double *)calloc (2 * max_nexp * basis->max_ncgto, sizeof(double));
     o->alpha = (double *)malloc (2 * max_nexp * sizeof(double));
+    o->cc_beg = (int *)malloc (2 * basis->max_ncgto * sizeof(int));
+    o->cc_end = (int *)malloc (2 * basis->max_ncgto * sizeof(int));
     CINT_ASSERT(o->cc != NULL);
     CINT_ASSERT(o->alpha != NULL);
+    CINT_ASSERT(o->cc_beg != NULL);
+    CINT_ASSERT(o->cc_end != NULL);
     o->coef_offset = (int *)malloc (basis->nshells * sizeof(int));
     o->exp_offset = (int *)malloc (basis->nshells * sizeof(int));
     CINT_ASSERT(o->coef_offset != NULL);
@@ -146,9 +172,11 @@ CIntStatus_t CInt_createOED (BasisSet_t basis, OED_t *oed)
     o->zcore = (double *)malloc (o->fp_memory_opt * sizeof(double));
     o->zcore2 = (double *)malloc (o->fp_memory_opt * sizeof(double));
     o->icore = (int *)malloc (o->int_memory_opt * sizeof(int));
+    o->lbuffer = (double *)malloc (basis->maxdim * basis->maxdim * sizeof(double));
     CINT_ASSERT(o->zcore != NULL);
     CINT_ASSERT(o->zcore2 != NULL);
     CINT_ASSERT(o->icore != NULL);
+    CINT_ASSERT(o->lbuffer != NULL);
     
     o->zmax = o->fp_memory_opt;
     o->imax = o->int_memory_opt;
@@ -164,8 +192,11 @@ CIntStatus_t CInt_destroyOED (OED_t  oed)
     free (oed->zcore);
     free (oed->zcore2);
     free (oed->icore);
+    free (oed->lbuffer);
     free (oed->alpha);
     free (oed->cc);
+    free (oed->cc_beg);
+    free (oed->cc_end);
     free (oed->coef_offset);
     free (oed->exp_offset);
     free (oed);
@@ -174,20 +205,61 @@ CIntStatus_t CInt_destroyOED (OED_t  oed)
 }
 
 
-CIntStatus_t CInt_computePairKin (BasisSet_t basis, OED_t oed,
-                                  int A, int B,
-                                  double **integrals, int *nints)
+typedef CIntStatus_t (*oed_pair_t) (BasisSet_t basis, OED_t oed,
+                                     int A, int B, int shellA, int shellB,
+                                     double **integrals, int *nints);
+
+
+/* Pairs with L-shells: every part pair goes through COMPUTE into its place
+   in the L-buffer, the s-part of an L-shell ahead of its p-part */
+static CIntStatus_t compute_lshell_parts (BasisSet_t basis, OED_t oed,
+                                          int A, int B, oed_pair_t compute,
+                                          double **integrals, int *nints)
 {
-    int nfirst;
-    
-    if (A < 0 || A >= basis->nshells ||
-        B < 0 || B >= basis->nshells)
+    const int dimA = CInt_getShellDim (basis, A);
+    const int dimB = CInt_getShellDim (basis, B);
+    int nonzero = 0;
+
+    memset (oed->lbuffer, 0, sizeof(double) * dimA * dimB);
+    for (int partA = 0; partA <= (int)basis->lshell[A]; partA++)
     {
-        CINT_PRINTF (1, "invalid shell indices\n");
-        return CINT_STATUS_INVALID_VALUE;
+        const int shellA = basis->lshell[A] ? partA : (int)basis->momentum[A];
+        const int na = basis->lshell[A] ? 2 * shellA + 1 : dimA;
+        for (int partB = 0; partB <= (int)basis->lshell[B]; partB++)
+        {
+            const int shellB = basis->lshell[B] ? partB : (int)basis->momentum[B];
+            const int nb = basis->lshell[B] ? 2 * shellB + 1 : dimB;
+            double *batch;
+            int n;
+            compute (basis, oed, A, B, shellA, shellB, &batch, &n);
+            if (n == 0)
+            {
+                continue;
+            }
+            nonzero = 1;
+            for (int j = 0; j < nb; j++)
+            {
+                for (int i = 0; i < na; i++)
+                {
+                    oed->lbuffer[(partA + i) + dimA * (partB + j)] =
+                        batch[i + na * j];
+                }
+            }
+        }
     }
+    *integrals = oed->lbuffer;
+    *nints = nonzero ? dimA * dimB : 0;
+    return CINT_STATUS_SUCCESS;
+}
 
-    config_oed (oed, A, B, basis);
+
+static CIntStatus_t compute_kin (BasisSet_t basis, OED_t oed,
+                                 int A, int B, int shellA, int shellB,
+                                 double **integrals, int *nints)
+{
+    int nfirst;
+
+    config_oed (oed, A, B, shellA, shellB, basis);
 
 #if ( _DEBUG_LEVEL_ == 3 )
     int int_memory_min;
@@ -224,20 +296,35 @@ CIntStatus_t CInt_computePairKin (BasisSet_t basis, OED_t oed,
 }
 
 
-CIntStatus_t CInt_computePairOvl (BasisSet_t basis, OED_t oed,
+CIntStatus_t CInt_computePairKin (BasisSet_t basis, OED_t oed,
                                   int A, int B,
                                   double **integrals, int *nints)
 {
-    int nfirst;
-    
     if (A < 0 || A >= basis->nshells ||
         B < 0 || B >= basis->nshells)
     {
         CINT_PRINTF (1, "invalid shell indices\n");
         return CINT_STATUS_INVALID_VALUE;
     }
+
+    if ((basis->lshell[A] | basis->lshell[B]) != 0)
+    {
+        return compute_lshell_parts (basis, oed, A, B, compute_kin,
+                                     integrals, nints);
+    }
+    return compute_kin (basis, oed, A, B,
+                        basis->momentum[A], basis->momentum[B],
+                        integrals, nints);
+}
+
+
+static CIntStatus_t compute_ovl (BasisSet_t basis, OED_t oed,
+                                 int A, int B, int shellA, int shellB,
+                                 double **integrals, int *nints)
+{
+    int nfirst;
     
-    config_oed (oed, A, B, basis);
+    config_oed (oed, A, B, shellA, shellB, basis);
 
 #if ( _DEBUG_LEVEL_ == 3 )
     int int_memory_min;
@@ -274,19 +361,35 @@ CIntStatus_t CInt_computePairOvl (BasisSet_t basis, OED_t oed,
 }
 
 
-CIntStatus_t CInt_computePairPot (BasisSet_t basis, OED_t oed,
+CIntStatus_t CInt_computePairOvl (BasisSet_t basis, OED_t oed,
                                   int A, int B,
                                   double **integrals, int *nints)
 {
-    int nfirst;
     if (A < 0 || A >= basis->nshells ||
         B < 0 || B >= basis->nshells)
     {
         CINT_PRINTF (1, "invalid shell indices\n");
         return CINT_STATUS_INVALID_VALUE;
     }
+
+    if ((basis->lshell[A] | basis->lshell[B]) != 0)
+    {
+        return compute_lshell_parts (basis, oed, A, B, compute_ovl,
+                                     integrals, nints);
+    }
+    return compute_ovl (basis, oed, A, B,
+                        basis->momentum[A], basis->momentum[B],
+                        integrals, nints);
+}
+
+
+static CIntStatus_t compute_pot (BasisSet_t basis, OED_t oed,
+                                 int A, int B, int shellA, int shellB,
+                                 double **integrals, int *nints)
+{
+    int nfirst;
     
-    config_oed (oed, A, B, basis);
+    config_oed (oed, A, B, shellA, shellB, basis);
 
 #if ( _DEBUG_LEVEL_ == 3 )
     int int_memory_min;
@@ -326,24 +429,39 @@ CIntStatus_t CInt_computePairPot (BasisSet_t basis, OED_t oed,
 }
 
 
-CIntStatus_t CInt_computePairCoreH (BasisSet_t basis, OED_t oed,
-                                    int A, int B,
-                                    double **integrals, int *nints)
+CIntStatus_t CInt_computePairPot (BasisSet_t basis, OED_t oed,
+                                  int A, int B,
+                                  double **integrals, int *nints)
 {
-    int nfirst;
-    int nfirst2;
-    int ni;
-    int ni2;
-    int i;
-
     if (A < 0 || A >= basis->nshells ||
         B < 0 || B >= basis->nshells)
     {
         CINT_PRINTF (1, "invalid shell indices\n");
         return CINT_STATUS_INVALID_VALUE;
     }
+
+    if ((basis->lshell[A] | basis->lshell[B]) != 0)
+    {
+        return compute_lshell_parts (basis, oed, A, B, compute_pot,
+                                     integrals, nints);
+    }
+    return compute_pot (basis, oed, A, B,
+                        basis->momentum[A], basis->momentum[B],
+                        integrals, nints);
+}
+
+
+static CIntStatus_t compute_coreh (BasisSet_t basis, OED_t oed,
+                                   int A, int B, int shellA, int shellB,
+                                   double **integrals, int *nints)
+{
+    int nfirst;
+    int nfirst2;
+    int ni;
+    int ni2;
+    int i;
     
-    config_oed (oed, A, B, basis);
+    config_oed (oed, A, B, shellA, shellB, basis);
 
 #if ( _DEBUG_LEVEL_ == 3 )
     int int_memory_min;
@@ -437,3 +555,25 @@ CIntStatus_t CInt_computePairCoreH (BasisSet_t basis, OED_t oed,
     
     return CINT_STATUS_SUCCESS;
 }
+
+
+CIntStatus_t CInt_computePairCoreH (BasisSet_t basis, OED_t oed,
+                                    int A, int B,
+                                    double **integrals, int *nints)
+{
+    if (A < 0 || A >= basis->nshells ||
+        B < 0 || B >= basis->nshells)
+    {
+        CINT_PRINTF (1, "invalid shell indices\n");
+        return CINT_STATUS_INVALID_VALUE;
+    }
+
+    if ((basis->lshell[A] | basis->lshell[B]) != 0)
+    {
+        return compute_lshell_parts (basis, oed, A, B, compute_coreh,
+                                     integrals, nints);
+    }
+    return compute_coreh (basis, oed, A, B,
+                          basis->momentum[A], basis->momentum[B],
+                          integrals, nints);
+}
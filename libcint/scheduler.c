@@ -0,0 +1,222 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <sys/time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "config.h"
+#include "cint_def.h"
+
+
+/* Per-thread counters are spread over cache lines */
+#define SCHED_STRIDE 16
+
+
+typedef struct {
+    int id;
+    double cost;
+} TaskCost;
+
+
+/* Descending cost; equal costs keep ascending task order */
+static int compare_task_costs(const void *a, const void *b) {
+    const TaskCost *x = (const TaskCost *)a;
+    const TaskCost *y = (const TaskCost *)b;
+    if (x->cost != y->cost) {
+        return (x->cost < y->cost) ? 1 : -1;
+    }
+    return x->id - y->id;
+}
+
+
+static double wall_time(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1.0e-6 * tv.tv_usec;
+}
+
+
+/* Restores the min-heap property of the thread loads below position i */
+static void sift_down(int *heap, const double *load, int n, int i) {
+    for (;;) {
+        const int left = 2 * i + 1;
+        const int right = left + 1;
+        int smallest = i;
+        if ((left < n) && (load[heap[left]] < load[heap[smallest]])) {
+            smallest = left;
+        }
+        if ((right < n) && (load[heap[right]] < load[heap[smallest]])) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            return;
+        }
+        const int t = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = t;
+        i = smallest;
+    }
+}
+
+
+CIntStatus_t CInt_createScheduler(int ntasks, const double *cost, int nthreads, Scheduler_t *scheduler) {
+    if ((ntasks < 0) || (nthreads < 1)) {
+        return CINT_STATUS_INVALID_VALUE;
+    }
+    Scheduler_t s = (Scheduler_t)calloc(1, sizeof(struct Scheduler));
+    CINT_ASSERT(s != NULL);
+    s->ntasks = ntasks;
+    s->nthreads = nthreads;
+    s->task = (int *)malloc(sizeof(int) * (ntasks + 1));
+    s->start = (int *)malloc(sizeof(int) * (nthreads + 1));
+    s->predicted = (double *)calloc(nthreads, sizeof(double));
+    s->head = (int *)malloc(sizeof(int) * nthreads * SCHED_STRIDE);
+    s->tail = (int *)malloc(sizeof(int) * nthreads * SCHED_STRIDE);
+    s->begin = (double *)malloc(sizeof(double) * nthreads * SCHED_STRIDE);
+    s->busy = (double *)malloc(sizeof(double) * nthreads * SCHED_STRIDE);
+    s->nstolen = (int *)malloc(sizeof(int) * nthreads * SCHED_STRIDE);
+    CINT_ASSERT((s->task != NULL) && (s->start != NULL) && (s->predicted != NULL));
+    CINT_ASSERT((s->head != NULL) && (s->tail != NULL) && (s->begin != NULL) && (s->busy != NULL) && (s->nstolen != NULL));
+    #ifdef _OPENMP
+    omp_lock_t *lock = (omp_lock_t *)malloc(sizeof(omp_lock_t) * nthreads);
+    CINT_ASSERT(lock != NULL);
+    for (int t = 0; t < nthreads; t++) {
+        omp_init_lock(&lock[t]);
+    }
+    s->lock = lock;
+    #endif
+
+    /* LPT: the most expensive remaining task goes to the least loaded thread */
+    TaskCost *order = (TaskCost *)malloc(sizeof(TaskCost) * (ntasks + 1));
+    int *owner = (int *)malloc(sizeof(int) * (ntasks + 1));
+    int *heap = (int *)malloc(sizeof(int) * nthreads);
+    CINT_ASSERT((order != NULL) && (owner != NULL) && (heap != NULL));
+    for (int i = 0; i < ntasks; i++) {
+        order[i].id = i;
+        order[i].cost = fmax(cost[i], 0.0);
+    }
+    qsort(order, ntasks, sizeof(TaskCost), compare_task_costs);
+    for (int t = 0; t < nthreads; t++) {
+        heap[t] = t;
+    }
+    for (int i = 0; i < ntasks; i++) {
+        const int t = heap[0];
+        owner[i] = t;
+        s->predicted[t] += order[i].cost;
+        sift_down(heap, s->predicted, nthreads, 0);
+    }
+
+    /* Every thread's deque holds its tasks by descending cost: the owner
+       pops the expensive end, thieves take the cheap end */
+    memset(s->start, 0, sizeof(int) * (nthreads + 1));
+    for (int i = 0; i < ntasks; i++) {
+        s->start[owner[i] + 1]++;
+    }
+    for (int t = 0; t < nthreads; t++) {
+        s->start[t + 1] += s->start[t];
+    }
+    memcpy(heap, s->start, sizeof(int) * nthreads);
+    for (int i = 0; i < ntasks; i++) {
+        const int k = heap[owner[i]]++;
+        s->task[k] = order[i].id;
+    }
+    free(order);
+    free(owner);
+    free(heap);
+
+    CInt_resetScheduler(s);
+    *scheduler = s;
+    return CINT_STATUS_SUCCESS;
+}
+
+
+CIntStatus_t CInt_destroyScheduler(Scheduler_t scheduler) {
+    #ifdef _OPENMP
+    for (int t = 0; t < scheduler->nthreads; t++) {
+        omp_destroy_lock(&((omp_lock_t *)scheduler->lock)[t]);
+    }
+    free(scheduler->lock);
+    #endif
+    free(scheduler->task);
+    free(scheduler->start);
+    free(scheduler->predicted);
+    free(scheduler->head);
+    free(scheduler->tail);
+    free(scheduler->begin);
+    free(scheduler->busy);
+    free(scheduler->nstolen);
+    free(scheduler);
+    return CINT_STATUS_SUCCESS;
+}
+
+
+CIntStatus_t CInt_resetScheduler(Scheduler_t scheduler) {
+    for (int t = 0; t < scheduler->nthreads; t++) {
+        scheduler->head[t * SCHED_STRIDE] = scheduler->start[t];
+        scheduler->tail[t * SCHED_STRIDE] = scheduler->start[t + 1];
+        scheduler->begin[t * SCHED_STRIDE] = 0.0;
+        scheduler->busy[t * SCHED_STRIDE] = 0.0;
+        scheduler->nstolen[t * SCHED_STRIDE] = 0;
+    }
+    return CINT_STATUS_SUCCESS;
+}
+
+
+/* Takes the next task of thread tid from the front of its own deque or,
+   once that is empty, from the back of the first non-empty deque after
+   it. Returns -1 when no task is left. The time from the first call of
+   tid to the call that finds no task is its measured load. */
+int CInt_getNextTask(Scheduler_t scheduler, int tid) {
+    const double now = wall_time();
+    double *begin = &scheduler->begin[tid * SCHED_STRIDE];
+    if (*begin == 0.0) {
+        *begin = now;
+    }
+
+    const int nthreads = scheduler->nthreads;
+    int task = -1;
+    for (int k = 0; (k < nthreads) && (task < 0); k++) {
+        const int victim = (tid + k) % nthreads;
+        int *head = &scheduler->head[victim * SCHED_STRIDE];
+        int *tail = &scheduler->tail[victim * SCHED_STRIDE];
+        #ifdef _OPENMP
+        omp_set_lock(&((omp_lock_t *)scheduler->lock)[victim]);
+        #endif
+        if (*head < *tail) {
+            task = (k == 0) ? scheduler->task[(*head)++] : scheduler->task[--(*tail)];
+        }
+        #ifdef _OPENMP
+        omp_unset_lock(&((omp_lock_t *)scheduler->lock)[victim]);
+        #endif
+        if ((task >= 0) && (k != 0)) {
+            scheduler->nstolen[tid * SCHED_STRIDE]++;
+        }
+    }
+    if ((task < 0) && (*begin > 0.0)) {
+        scheduler->busy[tid * SCHED_STRIDE] = now - *begin;
+        *begin = -1.0;
+    }
+    return task;
+}
+
+
+void CInt_getSchedulerImbalance(Scheduler_t scheduler, double *predicted, double *measured, int *nstolen) {
+    const int nthreads = scheduler->nthreads;
+    double pmax = 0.0, psum = 0.0, mmax = 0.0, msum = 0.0;
+    int stolen = 0;
+    for (int t = 0; t < nthreads; t++) {
+        const double busy = scheduler->busy[t * SCHED_STRIDE];
+        pmax = fmax(pmax, scheduler->predicted[t]);
+        psum += scheduler->predicted[t];
+        mmax = fmax(mmax, busy);
+        msum += busy;
+        stolen += scheduler->nstolen[t * SCHED_STRIDE];
+    }
+    *predicted = (psum > 0.0) ? pmax * nthreads / psum : 1.0;
+    *measured = (msum > 0.0) ? mmax * nthreads / msum : 1.0;
+    *nstolen = stolen;
+}
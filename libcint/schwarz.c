@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "config.h"
+#include "cint_def.h"
+
+
+typedef struct {
+    int id;
+    double value;
+} ShellPairValue;
+
+
+/* Descending value; equal values keep ascending shell order */
+static int compare_pair_values(const void *a, const void *b) {
+    const ShellPairValue *x = (const ShellPairValue *)a;
+    const ShellPairValue *y = (const ShellPairValue *)b;
+    if (x->value != y->value) {
+        return (x->value < y->value) ? 1 : -1;
+    }
+    return x->id - y->id;
+}
+
+
+/* max |(mn|mn)| over the functions m of M and n of N. Only the diagonal
+   elements are evaluated, and as (MN|MN) = (NM|NM) only M >= N is needed. */
+static double shell_pair_value(BasisSet_t basis, ERD_t erd, int tid, int M, int N) {
+    double *integrals;
+    int nints;
+    CInt_computeShellPairDiagonal(basis, erd, tid, M, N, &integrals, &nints);
+    double value = 0.0;
+    for (int i = 0; i < nints; i++) {
+        value = fmax(value, fabs(integrals[i]));
+    }
+    return value;
+}
+
+
+CIntStatus_t CInt_createSchwarz(BasisSet_t basis, ERD_t erd, double tolerance, Schwarz_t *schwarz) {
+    if (!(tolerance >= 0.0)) {
+        return CINT_STATUS_INVALID_VALUE;
+    }
+    Schwarz_t s = (Schwarz_t)calloc(1, sizeof(struct Schwarz));
+    CINT_ASSERT(s != NULL);
+    const int nshells = CInt_getNumShells(basis);
+    s->nshells = nshells;
+    s->tolerance = tolerance;
+
+    /* Diagonal values of the lower triangle, keeping only non-zero ones */
+    int *row_count = (int *)calloc(nshells, sizeof(int));
+    ShellPairValue **row = (ShellPairValue **)calloc(nshells, sizeof(ShellPairValue *));
+    CINT_ASSERT((row_count != NULL) && (row != NULL));
+    double maxvalue = 0.0;
+    #pragma omp parallel num_threads(erd->nthreads) reduction(max:maxvalue)
+    {
+        #ifdef _OPENMP
+        const int tid = omp_get_thread_num();
+        #else
+        const int tid = 0;
+        #endif
+        #pragma omp for schedule(dynamic)
+        for (int M = nshells - 1; M >= 0; M--) {
+            ShellPairValue *values = (ShellPairValue *)malloc(sizeof(ShellPairValue) * (M + 1));
+            CINT_ASSERT(values != NULL);
+            int count = 0;
+            for (int N = 0; N <= M; N++) {
+                const double value = shell_pair_value(basis, erd, tid, M, N);
+                if (value > 0.0) {
+                    values[count].id = N;
+                    values[count].value = value;
+                    count++;
+                    maxvalue = fmax(maxvalue, value);
+                }
+            }
+            row_count[M] = count;
+            row[M] = values;
+        }
+    }
+    s->maxvalue = maxvalue;
+
+    /* A pair survives if its product with the largest value reaches tolerance^2 */
+    const double eta = tolerance * tolerance / maxvalue;
+    s->shellptr = (int *)calloc(nshells + 1, sizeof(int));
+    CINT_ASSERT(s->shellptr != NULL);
+    for (int M = 0; M < nshells; M++) {
+        for (int i = 0; i < row_count[M]; i++) {
+            if (row[M][i].value > eta) {
+                const int N = row[M][i].id;
+                s->shellptr[M + 1]++;
+                if (N != M) {
+                    s->shellptr[N + 1]++;
+                }
+            }
+        }
+    }
+    for (int M = 0; M < nshells; M++) {
+        s->shellptr[M + 1] += s->shellptr[M];
+    }
+    const int nnz = s->shellptr[nshells];
+    s->nnz = nnz;
+
+    int *fill = (int *)malloc(sizeof(int) * (nshells + 1));
+    ShellPairValue *pairs = (ShellPairValue *)malloc(sizeof(ShellPairValue) * (nnz + 1));
+    CINT_ASSERT((fill != NULL) && (pairs != NULL));
+    memcpy(fill, s->shellptr, sizeof(int) * nshells);
+    for (int M = 0; M < nshells; M++) {
+        for (int i = 0; i < row_count[M]; i++) {
+            if (row[M][i].value > eta) {
+                const int N = row[M][i].id;
+                pairs[fill[M]].id = N;
+                pairs[fill[M]].value = row[M][i].value;
+                fill[M]++;
+                if (N != M) {
+                    pairs[fill[N]].id = M;
+                    pairs[fill[N]].value = row[M][i].value;
+                    fill[N]++;
+                }
+            }
+        }
+        free(row[M]);
+    }
+    free(fill);
+    free(row);
+    free(row_count);
+
+    /* Sort every row by descending value so that quartet loops can stop early */
+    s->shellid = (int *)malloc(sizeof(int) * (nnz + 1));
+    s->shellrid = (int *)malloc(sizeof(int) * (nnz + 1));
+    s->shellvalue = (double *)malloc(sizeof(double) * (nnz + 1));
+    CINT_ASSERT((s->shellid != NULL) && (s->shellrid != NULL) && (s->shellvalue != NULL));
+    #pragma omp parallel for schedule(dynamic) num_threads(erd->nthreads)
+    for (int M = 0; M < nshells; M++) {
+        const int start = s->shellptr[M];
+        const int end = s->shellptr[M + 1];
+        qsort(&pairs[start], end - start, sizeof(ShellPairValue), compare_pair_values);
+        for (int i = start; i < end; i++) {
+            s->shellid[i] = pairs[i].id;
+            s->shellrid[i] = M;
+            s->shellvalue[i] = pairs[i].value;
+        }
+    }
+    free(pairs);
+
+    *schwarz = s;
+    return CINT_STATUS_SUCCESS;
+}
+
+
+CIntStatus_t CInt_destroySchwarz(Schwarz_t schwarz) {
+    free(schwarz->shellptr);
+    free(schwarz->shellid);
+    free(schwarz->shellrid);
+    free(schwarz->shellvalue);
+    free(schwarz);
+    return CINT_STATUS_SUCCESS;
+}
+
+
+int CInt_getSchwarzPairs(Schwarz_t schwarz,
+                         const int **shellptr,
+                         const int **shellid,
+                         const int **shellrid,
+                         const double **shellvalue)
+{
+    *shellptr = schwarz->shellptr;
+    *shellid = schwarz->shellid;
+    *shellrid = schwarz->shellrid;
+    *shellvalue = schwarz->shellvalue;
+    return schwarz->nnz;
+}
+
+
+double CInt_getSchwarzMaxValue(Schwarz_t schwarz) {
+    return schwarz->maxvalue;
+}
+
+
+double CInt_getSchwarzTolerance(Schwarz_t schwarz) {
+    return schwarz->tolerance;
+}
@@ -0,0 +1,129 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <math.h>
+#include <sys/time.h>
+#include <immintrin.h>
+
+#include "erd.h"
+
+
+static inline uint32_t xorshift_rand(uint32_t* state) {
+    uint32_t y = *state;
+    y ^= y << 13;
+    y ^= y >> 17;
+    y ^= y << 5;
+    *state = y;
+    return y;
+}
+
+static double get_time(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1.0e-6 * tv.tv_usec;
+}
+
+/* Monomials (x, y, z, offset) of every shell, as built by CInt_createERD */
+static int **create_vrrtable(int max_shellp) {
+    const int total_combinations = (max_shellp + 1) * (max_shellp + 2) * (max_shellp + 3) / 6;
+    int **vrrtable = (int **)malloc(sizeof(int *) * (max_shellp + 1));
+    int *table = (int *)malloc(sizeof(int) * 4 * total_combinations);
+    assert((vrrtable != NULL) && (table != NULL));
+    int n = 0;
+    for (int shell = 0; shell <= max_shellp; shell++) {
+        vrrtable[shell] = &table[n];
+        int count = 0;
+        for (int x = shell; x >= 0; x--) {
+            for (int y = shell - x; y >= 0; y--) {
+                table[n + count + 0] = x;
+                table[n + count + 1] = y;
+                table[n + count + 2] = shell - x - y;
+                table[n + count + 3] = count;
+                count += 4;
+            }
+        }
+        n += count;
+    }
+    return vrrtable;
+}
+
+static int ncart(int l) {
+    return (l + 1) * (l + 2) / 2;
+}
+
+/* Times erd__int2d_to_e0f0 against the compiler-vectorized
+   erd__int2d_to_e0f0_scalar for the quartet classes (la lb|lc ld) */
+int main(int argc, char **argv) {
+    const int nprim = (argc > 1) ? atoi(argv[1]) : 9;
+    const int repeat = (argc > 2) ? atoi(argv[2]) : 2000;
+    static const int classes[][4] = {
+        {1, 1, 1, 1}, {2, 0, 2, 0}, {2, 1, 1, 0}, {2, 1, 2, 1}, {2, 2, 1, 1},
+        {2, 2, 2, 0}, {2, 2, 2, 2}, {3, 0, 3, 0}, {3, 2, 2, 1}, {3, 3, 3, 3}
+    };
+    const int nclasses = sizeof(classes) / sizeof(classes[0]);
+    int **vrrtable = create_vrrtable(12);
+    uint32_t rng_state = 1;
+    int errcount = 0;
+
+    printf("# primitive quartets %d, %d repetitions\n", nprim * nprim, repeat);
+    printf("class          ngqexq  outputs  scalar(us)  kernel(us)  speedup  max rel err\n");
+    for (int c = 0; c < nclasses; c++) {
+        const int la = classes[c][0], lb = classes[c][1], lc = classes[c][2], ld = classes[c][3];
+        const int shellp = la + lb;
+        const int shellq = lc + ld;
+        const int ngqp = (shellp + shellq) / 2 + 1;
+        const int ngqexq = PAD_LEN(ngqp * nprim * nprim);
+        int nxyzet = 0, nxyzft = 0;
+        for (int l = la; l <= shellp; l++) {
+            nxyzet += ncart(l);
+        }
+        for (int l = lc; l <= shellq; l++) {
+            nxyzft += ncart(l);
+        }
+        const size_t nint2d = (size_t)(shellp + 1) * (shellq + 1) * ngqexq;
+        double *int2dx = (double *)_mm_malloc(sizeof(double) * nint2d, 64);
+        double *int2dy = (double *)_mm_malloc(sizeof(double) * nint2d, 64);
+        double *int2dz = (double *)_mm_malloc(sizeof(double) * nint2d, 64);
+        double *batch0 = (double *)malloc(sizeof(double) * nxyzet * nxyzft);
+        double *batch1 = (double *)malloc(sizeof(double) * nxyzet * nxyzft);
+        assert((int2dx != NULL) && (int2dy != NULL) && (int2dz != NULL) && (batch0 != NULL) && (batch1 != NULL));
+        for (size_t i = 0; i < nint2d; i++) {
+            int2dx[i] = (double)xorshift_rand(&rng_state) / 4294967296.0;
+            int2dy[i] = (double)xorshift_rand(&rng_state) / 4294967296.0;
+            int2dz[i] = (double)xorshift_rand(&rng_state) / 4294967296.0;
+        }
+
+        double start = get_time();
+        for (int r = 0; r < repeat; r++) {
+            erd__int2d_to_e0f0_scalar(la, shellp, lc, shellq, ngqexq, nxyzet, nxyzft,
+                int2dx, int2dy, int2dz, vrrtable, batch0);
+        }
+        const double scalar_time = (get_time() - start) / repeat;
+        start = get_time();
+        for (int r = 0; r < repeat; r++) {
+            erd__int2d_to_e0f0(la, shellp, lc, shellq, ngqexq, nxyzet, nxyzft,
+                int2dx, int2dy, int2dz, vrrtable, batch1);
+        }
+        const double kernel_time = (get_time() - start) / repeat;
+
+        double error = 0.0;
+        for (int i = 0; i < nxyzet * nxyzft; i++) {
+            error = fmax(error, fabs(batch1[i] - batch0[i]) / fabs(batch0[i]));
+        }
+        if (error > 1.0e-12) {
+            errcount++;
+        }
+        printf("(%d %d|%d %d)  %10d  %7d  %10.3lf  %10.3lf  %7.2lf  %11.3le\n", la, lb, lc, ld,
+            ngqexq, nxyzet * nxyzft, 1.0e6 * scalar_time, 1.0e6 * kernel_time, scalar_time / kernel_time, error);
+
+        _mm_free(int2dx);
+        _mm_free(int2dy);
+        _mm_free(int2dz);
+        free(batch0);
+        free(batch1);
+    }
+    free(vrrtable[0]);
+    free(vrrtable);
+    return errcount;
+}
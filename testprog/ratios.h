@@ -51,6 +51,18 @@
         #define RATIO_NAME "Branch ratio"
         #define RATIO_UNITS "%%"
         #define RATIO_MULTIPLIER 100.0
+    #elif ERD_RECORD_LLCREF_RATIO
+        /* Last level cache references. The generic perf events have no L2
+           event; on CPUs with a shared L3 these are roughly the L2 misses. */
+        #define NUMERATOR_PERF_ATTR_TYPE PERF_TYPE_HARDWARE
+        #define NUMERATOR_PERF_ATTR_CONFIG PERF_COUNT_HW_CACHE_REFERENCES
+        #define NUMERATOR_PERF_COUNTER_NAME "LLC references"
+        #define DENOMINATOR_PERF_ATTR_TYPE PERF_TYPE_HARDWARE
+        #define DENOMINATOR_PERF_ATTR_CONFIG PERF_COUNT_HW_INSTRUCTIONS
+        #define DENOMINATOR_PERF_COUNTER_NAME "Instructions"
+        #define RATIO_NAME "LLC references per 1000 instructions"
+        #define RATIO_UNITS ""
+        #define RATIO_MULTIPLIER 1000.0
     #elif ERD_RECORD_GPINSTR_RATIO
         #error "Implement me"
     #else
@@ -25,8 +25,8 @@ static uint64_t getTimerFrequency(void) {
 
 int main(int argc, char **argv) {
 
-    if (argc != 3) {
-        printf("Usage: %s <basisset> <xyz>\n", argv[0]);
+    if ((argc != 3) && (argc != 4)) {
+        printf("Usage: %s <basisset> <xyz> [primitive screening tolerance]\n", argv[0]);
         return 0;
     }
     FILE *ref_data_file = fopen ("ivalues.ref", "r");
@@ -53,12 +53,21 @@ int main(int argc, char **argv) {
 
     ERD_t erd;
     CInt_createERD(basis, &erd, 1);
+    if (argc == 4) {
+        if (CInt_setPrimitiveScreening(erd, atof(argv[3])) != CINT_STATUS_SUCCESS) {
+            fprintf(stderr, "invalid primitive screening tolerance %s\n", argv[3]);
+            return 0;
+        }
+    }
+    printf("  PrimTol\t= %.1le\n", CInt_getPrimitiveScreening(erd));
 
     printf("Computing integrals ...\n");
     const uint32_t shellCount = CInt_getNumShells(basis);
     int dimMax = CInt_getMaxShellDim(basis);
     double *referenceIntegrals = (double *)malloc(sizeof(double) * dimMax * dimMax * dimMax * dimMax);
     assert(referenceIntegrals != NULL);
+    double *intoIntegrals = (double *)malloc(sizeof(double) * dimMax * dimMax * dimMax * dimMax);
+    assert(intoIntegrals != NULL);
 #if 0
     int nshells = shellCount;
     for (int M = 0; M < nshells; M++)
@@ -109,6 +118,7 @@ int main(int argc, char **argv) {
     uint64_t totalIntegralsCount = 0;
     uint64_t totalTicks = 0;
     uint32_t errcount = 0;
+    double maxError = 0.0;
     for (uint32_t shellIndexM = 0; shellIndexM != shellCount; shellIndexM++) {
         const uint32_t shellIndexNStart = shellptr[shellIndexM];
         const uint32_t shellIndexNEnd = shellptr[shellIndexM+1];
@@ -145,20 +155,25 @@ int main(int argc, char **argv) {
                 }
             }
 
+            /* Process batch of indices */
+            const size_t batchCapacity = (size_t)shellIndicesCount * dimMax * dimMax * dimMax * dimMax;
+            double* batchIntegrals = memalign(64, sizeof(double) * (batchCapacity + 1));
+            size_t* integralsOffsets = memalign(64, sizeof(size_t) * (shellIndicesCount + 1));
+            uint32_t* integralsCounts = memalign(64, sizeof(uint32_t) * (shellIndicesCount + 1));
+            totalCalls += 1;
+            const uint64_t startTicks = getTimerTicks();
+
+            CInt_computeShellQuartets(basis, erd, 0 /* Thread ID */,
+                shellIndexM, shellIndicesN, shellIndexP, shellIndicesQ, shellIndicesCount,
+                batchIntegrals, batchCapacity, integralsOffsets, integralsCounts);
+
+            const uint64_t endTicks = getTimerTicks();
+            totalTicks += endTicks - startTicks;
+
             /* Validate results */
             for (uint32_t shellIndexIndex = 0; shellIndexIndex != shellIndicesCount; shellIndexIndex++) {
-                /* Process batch of indices */
-                totalCalls += 1;
-                const uint64_t startTicks = getTimerTicks();
-
-                double *integrals;
-                int integralsCount;
-                CInt_computeShellQuartets(basis, erd, 0 /* Thread ID */,
-                    shellIndexM, &shellIndicesN[shellIndexIndex], shellIndexP, &shellIndicesQ[shellIndexIndex], 1,
-                    &integrals, &integralsCount);
-
-                const uint64_t endTicks = getTimerTicks();
-                totalTicks += endTicks - startTicks;
+                const double *integrals = &batchIntegrals[integralsOffsets[shellIndexIndex]];
+                const int integralsCount = integralsCounts[shellIndexIndex];
                 totalIntegralsCount += integralsCount;
 
                 const uint32_t shellIndexN = shellIndicesN[shellIndexIndex];
@@ -178,6 +193,15 @@ int main(int argc, char **argv) {
                     }
                 }
 
+                if (integralsCount == 0 || referenceIntegralsCount == 0 || integralsCount == referenceIntegralsCount) {
+                    const int count = integralsCount > referenceIntegralsCount ? integralsCount : referenceIntegralsCount;
+                    for (int k = 0; k < count; k++) {
+                        const double value = (integralsCount != 0) ? integrals[k] : 0.0;
+                        const double reference = (referenceIntegralsCount != 0) ? referenceIntegrals[k] : 0.0;
+                        maxError = fmax(maxError, fabs(value - reference));
+                    }
+                }
+
                 if (integralsCount == 0 && referenceIntegralsCount == 0) {
                     continue;
                 } else if (integralsCount != 0 && referenceIntegralsCount == 0) {
@@ -221,6 +245,33 @@ int main(int argc, char **argv) {
                 } else {
                     printf ("ERROR: nints0 %d nints %d\n", referenceIntegralsCount, integralsCount);
                 }
+
+                /* The strided API must produce the same values, here stored with reversed index order */
+                if (integralsCount != 0) {
+                    const size_t dimM = CInt_getShellDim(basis, shellIndexM);
+                    const size_t dimN = CInt_getShellDim(basis, shellIndexN);
+                    const size_t dimP = CInt_getShellDim(basis, shellIndexP);
+                    const size_t dimQ = CInt_getShellDim(basis, shellIndexQ);
+                    const size_t ld[4] = { dimQ * dimP * dimN, dimQ * dimP, dimQ, 1 };
+                    int intoIntegralsCount;
+                    CInt_computeShellQuartetInto(basis, erd, 0,
+                        shellIndexM, shellIndexN, shellIndexP, shellIndexQ,
+                        intoIntegrals, ld, &intoIntegralsCount);
+                    if (intoIntegralsCount != integralsCount) {
+                        printf ("ERROR: Into nints %d nints %d\n", intoIntegralsCount, integralsCount);
+                        errcount++;
+                    } else {
+                        for (size_t k = 0; k < (size_t)integralsCount; k++) {
+                            const size_t iM = k % dimM, iN = k / dimM % dimN, iP = k / (dimM * dimN) % dimP, iQ = k / (dimM * dimN * dimP);
+                            if (intoIntegrals[iM * ld[0] + iN * ld[1] + iP * ld[2] + iQ * ld[3]] != integrals[k]) {
+                                printf ("ERROR: Into %"PRIu32" %"PRIu32" %"PRIu32" %"PRIu32"\n",
+                                    shellIndexM, shellIndexN, shellIndexP, shellIndexQ);
+                                errcount++;
+                                break;
+                            }
+                        }
+                    }
+                }
                 if (errcount > 0) {
                     goto end;
                 }
@@ -228,6 +279,9 @@ int main(int argc, char **argv) {
             
             free(shellIndicesN);
             free(shellIndicesQ);
+            free(batchIntegrals);
+            free(integralsOffsets);
+            free(integralsCounts);
 
         }
     }
@@ -237,9 +291,11 @@ int main(int argc, char **argv) {
     printf("Number of calls: %"PRIu64", Number of integrals: %"PRIu64"\n", totalCalls, totalIntegralsCount);
     printf("Total time: %.4lf secs\n", totalTime);
     printf("Average time per call: %.3lf us\n", totalTime / totalCalls * 1.0e+6);
+    printf("Max abs error vs ivalues.ref: %.3le\n", maxError);
 
 end:
     free(referenceIntegrals);
+    free(intoIntegrals);
     CInt_destroyERD(erd);
     CInt_destroyBasisSet(basis);
     free(shellptr);
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <assert.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #include <unistd.h>
 #ifdef _OPENMP
@@ -33,13 +34,70 @@ static inline uint32_t xorshift_rand(uint32_t* state) {
     return y;
 }
 
+static const int *shellptr;
+static const int *shellid;
+static const int *shellrid;
+static const double *shellvalue;
+
+/* Computes the significant quartets of task MP = M * shellCount + P, or with
+   estimate only sums their modelled costs. Returns the number of quartets
+   computed, or the cost. */
+static double process_task(BasisSet_t basis, ERD_t erd, int tid, uint32_t shellIndexMP,
+    uint32_t computationThreshold, bool estimate, double *nintls)
+{
+    const uint32_t shellCount = CInt_getNumShells(basis);
+    const uint32_t computationThresholdMax = 0xFFFFFFFEu;
+    const uint32_t shellIndexM = shellIndexMP / shellCount;
+    const uint32_t shellIndexP = shellIndexMP % shellCount;
+    
+    const uint32_t shellIndexNStart = shellptr[shellIndexM];
+    const uint32_t shellIndexNEnd = shellptr[shellIndexM+1];
+    const uint32_t shellIndexQStart = shellptr[shellIndexP];
+    const uint32_t shellIndexQEnd = shellptr[shellIndexP+1];
+
+    /* Should depend only on loop iteration to guarantee the same value in optimized and reference versions regardless of thread order */
+    uint32_t rng_state = shellIndexMP;
+    /* Do several iteration to make starting value less uniform */
+    xorshift_rand(&rng_state);
+    xorshift_rand(&rng_state);
+    xorshift_rand(&rng_state);
+
+    double result = 0.0;
+    /* Prepare indices */
+    for (uint32_t shellIndexNOffset = shellIndexNStart; shellIndexNOffset != shellIndexNEnd; shellIndexNOffset++) {
+        const uint32_t shellIndexN = shellid[shellIndexNOffset];
+        if (shellIndexM > shellIndexN)
+            continue;
+
+        const double shellValueMN = shellvalue[shellIndexNOffset];
+        for (uint32_t shellIndexQOffset = shellIndexQStart; shellIndexQOffset != shellIndexQEnd; shellIndexQOffset++) {
+            const uint32_t shellIndexQ = shellid[shellIndexQOffset];
+            if (shellIndexP > shellIndexQ)
+                continue;
+
+            if (shellIndexM + shellIndexN > shellIndexP + shellIndexQ)
+                continue;
+
+            /* Sample random integer. With probability (fraction) process the shell quartet. */
+            if ((computationThreshold == computationThresholdMax) || (xorshift_rand(&rng_state) <= computationThreshold)) {
+                if (estimate) {
+                    result += CInt_getQuartetCost(basis, erd, shellIndexM, shellIndexN, shellIndexP, shellIndexQ);
+                    continue;
+                }
+                double *integrals;
+                int nints;
+                CInt_computeShellQuartet(basis, erd, tid, shellIndexM, shellIndexN, shellIndexP, shellIndexQ, &integrals, &nints);
+
+                result += 1;
+                *nintls += nints;
+            }
+        }
+    }
+    return result;
+}
+
 int main (int argc, char **argv)
 {
-    int nnz;
-    int *shellptr;
-    int *shellid;
-    int *shellrid;
-    double *shellvalue;
     if (argc != 5) {
         printf ("Usage: %s <basisset> <xyz> <fraction> <nthreads>\n", argv[0]);
         return -1;
@@ -60,7 +118,6 @@ int main (int argc, char **argv)
     BasisSet_t basis;
     CInt_createBasisSet(&basis);
     CInt_loadBasisSet(basis, argv[1], argv[2]);
-    schwartz_screening(basis, &shellptr, &shellid, &shellrid, &shellvalue, &nnz);
 
     printf("Molecule info:\n");
     printf("  #Atoms\t= %d\n", CInt_getNumAtoms(basis));
@@ -71,6 +128,13 @@ int main (int argc, char **argv)
 
     ERD_t erd;
     CInt_createERD(basis, &erd, nthreads);
+    static const char *isa_names[] = {"", "sse4", "avx", "avx2", "avx512", "mic"};
+    printf("  ERD ISA\t= %s\n", isa_names[CInt_getERDISA(erd)]);
+
+    Schwarz_t schwarz;
+    CInt_createSchwarz(basis, erd, TOLSRC, &schwarz);
+    const int nnz = CInt_getSchwarzPairs(schwarz, &shellptr, &shellid, &shellrid, &shellvalue);
+    printf("  #Pairs\t= %d\n", nnz);
 
     double* totalcalls = (double *) malloc(sizeof (double) * nthreads * 64);
     assert(totalcalls != NULL);
@@ -96,6 +160,17 @@ int main (int argc, char **argv)
     const uint32_t computationThresholdMax = 0xFFFFFFFEu;
     const uint32_t computationThreshold = lround(fraction * computationThresholdMax);
 
+    /* Cost-balanced task lists over the shell pairs (M, P) */
+    double *taskcost = (double *) malloc(sizeof(double) * shellCount * shellCount);
+    assert(taskcost != NULL);
+    #pragma omp parallel for schedule(dynamic)
+    for (uint32_t shellIndexMP = 0; shellIndexMP < shellCount * shellCount; shellIndexMP++) {
+        taskcost[shellIndexMP] = process_task(basis, erd, 0, shellIndexMP, computationThreshold, true, NULL);
+    }
+    Scheduler_t scheduler;
+    CInt_createScheduler(shellCount * shellCount, taskcost, nthreads, &scheduler);
+    free(taskcost);
+
     const uint64_t start_clock = __rdtsc();
         
     #pragma omp parallel
@@ -109,49 +184,11 @@ int main (int argc, char **argv)
         BEGIN_RECORD_FLOPS
         BEGIN_RECORD_RATIO
 
-        #pragma omp for schedule(dynamic)
-        for (uint32_t shellIndexMP = 0; shellIndexMP < shellCount * shellCount; shellIndexMP++) {
-            const uint32_t shellIndexM = shellIndexMP / shellCount;
-            const uint32_t shellIndexP = shellIndexMP % shellCount;
-            
-            const uint32_t shellIndexNStart = shellptr[shellIndexM];
-            const uint32_t shellIndexNEnd = shellptr[shellIndexM+1];
-            const uint32_t shellIndexQStart = shellptr[shellIndexP];
-            const uint32_t shellIndexQEnd = shellptr[shellIndexP+1];
-
-            /* Should depend only on loop iteration to guarantee the same value in optimized and reference versions regardless of thread order */
-            uint32_t rng_state = shellIndexMP;
-            /* Do several iteration to make starting value less uniform */
-            xorshift_rand(&rng_state);
-            xorshift_rand(&rng_state);
-            xorshift_rand(&rng_state);
-
-            /* Prepare indices */
-            for (uint32_t shellIndexNOffset = shellIndexNStart; shellIndexNOffset != shellIndexNEnd; shellIndexNOffset++) {
-                const uint32_t shellIndexN = shellid[shellIndexNOffset];
-                if (shellIndexM > shellIndexN)
-                    continue;
-
-                const double shellValueMN = shellvalue[shellIndexNOffset];
-                for (uint32_t shellIndexQOffset = shellIndexQStart; shellIndexQOffset != shellIndexQEnd; shellIndexQOffset++) {
-                    const uint32_t shellIndexQ = shellid[shellIndexQOffset];
-                    if (shellIndexP > shellIndexQ)
-                        continue;
-
-                    if (shellIndexM + shellIndexN > shellIndexP + shellIndexQ)
-                        continue;
-
-                    /* Sample random integer. With probability (fraction) process the shell quartet. */
-                    if ((computationThreshold == computationThresholdMax) || (xorshift_rand(&rng_state) <= computationThreshold)) {
-                        double *integrals;
-                        int nints;
-                        CInt_computeShellQuartet(basis, erd, tid, shellIndexM, shellIndexN, shellIndexP, shellIndexQ, &integrals, &nints);
-
-                        totalcalls[tid * 64] += 1;
-                        totalnintls[tid * 64] += nints;
-                    }
-                }
-            }
+        for (int task = CInt_getNextTask(scheduler, tid); task >= 0; task = CInt_getNextTask(scheduler, tid)) {
+            const uint32_t shellIndexMP = task;
+            double totalnints = 0.0;
+            totalcalls[tid * 64] += process_task(basis, erd, tid, shellIndexMP, computationThreshold, false, &totalnints);
+            totalnintls[tid * 64] += totalnints;
         }
         
         END_RECORD_FLOPS
@@ -172,6 +209,10 @@ int main (int argc, char **argv)
     printf("Total GigaTicks: %.3lf, freq = %.3lf GHz\n", (double) (total_ticks) * 1.0e-9, (double)freq/1.0e9);
     printf("Total time: %.4lf secs\n", timepass);
     printf("Average time per call: %.3le us\n", 1000.0 * 1000.0 * timepass / totalcalls[0]);
+    double predicted, measured;
+    int nstolen;
+    CInt_getSchedulerImbalance(scheduler, &predicted, &measured, &nstolen);
+    printf("Load imbalance (max/mean): predicted %.3lf, measured %.3lf, %d tasks stolen\n", predicted, measured, nstolen);
 
     // use 1 if thread timing is not required
     erd_print_profile(1);
@@ -179,13 +220,11 @@ int main (int argc, char **argv)
     REPORT_FLOPS
     REPORT_RATIO
 
+    CInt_destroyScheduler(scheduler);
+    CInt_destroySchwarz(schwarz);
     CInt_destroyERD(erd);
     free(totalcalls);
     free(totalnintls);
-    free(shellptr);
-    free(shellid);
-    free(shellvalue);
-    free(shellrid);
 
     CInt_destroyBasisSet(basis);
 
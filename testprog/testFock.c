@@ -0,0 +1,221 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <screening.h>
+
+
+static inline uint32_t xorshift_rand(uint32_t* state) {
+    uint32_t y = *state;
+    y ^= y << 13;
+    y ^= y >> 17;
+    y ^= y << 5;
+    *state = y;
+    return y;
+}
+
+/* J and K from every Schwarz-significant quartet, without permutational symmetry */
+static void reference_fock(BasisSet_t basis, ERD_t erd, Schwarz_t schwarz,
+    const double *D, double *J, double *K, int nbf)
+{
+    const int *shellptr;
+    const int *shellid;
+    const int *shellrid;
+    const double *shellvalue;
+    CInt_getSchwarzPairs(schwarz, &shellptr, &shellid, &shellrid, &shellvalue);
+    const double tol2 = CInt_getSchwarzTolerance(schwarz) * CInt_getSchwarzTolerance(schwarz);
+    const int nshells = CInt_getNumShells(basis);
+
+    memset(J, 0, sizeof(double) * nbf * nbf);
+    memset(K, 0, sizeof(double) * nbf * nbf);
+    for (int M = 0; M < nshells; M++) {
+        for (int i = shellptr[M]; i < shellptr[M + 1]; i++) {
+            const int N = shellid[i];
+            for (int P = 0; P < nshells; P++) {
+                for (int j = shellptr[P]; j < shellptr[P + 1]; j++) {
+                    const int Q = shellid[j];
+                    if (shellvalue[i] * shellvalue[j] < tol2)
+                        break;
+
+                    double *integrals;
+                    int nints;
+                    CInt_computeShellQuartet(basis, erd, 0, M, N, P, Q, &integrals, &nints);
+                    if (nints == 0)
+                        continue;
+
+                    const int dimM = CInt_getShellDim(basis, M);
+                    const int dimN = CInt_getShellDim(basis, N);
+                    const int dimP = CInt_getShellDim(basis, P);
+                    const int dimQ = CInt_getShellDim(basis, Q);
+                    const int startM = CInt_getFuncStartInd(basis, M);
+                    const int startN = CInt_getFuncStartInd(basis, N);
+                    const int startP = CInt_getFuncStartInd(basis, P);
+                    const int startQ = CInt_getFuncStartInd(basis, Q);
+                    for (int iQ = 0; iQ < dimQ; iQ++) {
+                        for (int iP = 0; iP < dimP; iP++) {
+                            for (int iN = 0; iN < dimN; iN++) {
+                                for (int iM = 0; iM < dimM; iM++) {
+                                    const double ivalue = integrals[iM + dimM * (iN + dimN * (iP + dimP * iQ))];
+                                    J[(startM + iM) * nbf + startN + iN] += ivalue * D[(startP + iP) * nbf + startQ + iQ];
+                                    K[(startM + iM) * nbf + startP + iP] += ivalue * D[(startN + iN) * nbf + startQ + iQ];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    if ((argc != 4) && (argc != 5)) {
+        printf("Usage: %s <basisset> <xyz> <nthreads> [validate (0/1)]\n", argv[0]);
+        return 0;
+    }
+    const int nthreads = atoi(argv[3]);
+    const int validate = (argc == 5) ? atoi(argv[4]) : 1;
+
+    BasisSet_t basis;
+    CInt_createBasisSet(&basis);
+    CInt_loadBasisSet(basis, argv[1], argv[2]);
+    const int nbf = CInt_getNumFuncs(basis);
+
+    printf("Molecule info:\n");
+    printf("  #Atoms\t= %d\n", CInt_getNumAtoms(basis));
+    printf("  #Shells\t= %d\n", CInt_getNumShells(basis));
+    printf("  #Funcs\t= %d\n", nbf);
+    printf("  nthreads\t= %d\n", nthreads);
+
+    ERD_t erd;
+    CInt_createERD(basis, &erd, nthreads);
+    Schwarz_t schwarz;
+    CInt_createSchwarz(basis, erd, TOLSRC, &schwarz);
+    FockPlan_t plan;
+    CInt_createFockPlan(basis, erd, schwarz, &plan);
+
+    double *D = (double *)malloc(sizeof(double) * nbf * nbf);
+    double *J = (double *)malloc(sizeof(double) * nbf * nbf);
+    double *K = (double *)malloc(sizeof(double) * nbf * nbf);
+    assert((D != NULL) && (J != NULL) && (K != NULL));
+    uint32_t rng_state = 1;
+    for (int i = 0; i < nbf; i++) {
+        for (int j = 0; j <= i; j++) {
+            D[i * nbf + j] = D[j * nbf + i] = (double)xorshift_rand(&rng_state) / 4294967296.0 - 0.5;
+        }
+    }
+
+    printf("Building Fock matrix ...\n");
+    #ifdef _OPENMP
+    const double start = omp_get_wtime();
+    #endif
+    CIntStatus_t status = CInt_buildFock(basis, erd, plan, D, nbf, J, K, nbf);
+    assert(status == CINT_STATUS_SUCCESS);
+    #ifdef _OPENMP
+    printf("Total time: %.4lf secs\n", omp_get_wtime() - start);
+    #endif
+
+    int errcount = 0;
+    if (validate) {
+        double *J0 = (double *)malloc(sizeof(double) * nbf * nbf);
+        double *K0 = (double *)malloc(sizeof(double) * nbf * nbf);
+        assert((J0 != NULL) && (K0 != NULL));
+        reference_fock(basis, erd, schwarz, D, J0, K0, nbf);
+        double errJ = 0.0, errK = 0.0;
+        for (int i = 0; i < nbf * nbf; i++) {
+            errJ = fmax(errJ, fabs(J[i] - J0[i]));
+            errK = fmax(errK, fabs(K[i] - K0[i]));
+        }
+        printf("Max abs error: J %.3le K %.3le\n", errJ, errK);
+        if ((errJ > 1.0e-10) || (errK > 1.0e-10)) {
+            printf("ERROR: J/K differ from the reference\n");
+            errcount++;
+        }
+
+        /* A batch of densities must give the same J/K as separate builds */
+        const int ndens = 3;
+        double *Dm[3], *Jm[3], *Km[3];
+        for (int d = 0; d < ndens; d++) {
+            Dm[d] = (double *)malloc(sizeof(double) * nbf * nbf);
+            Jm[d] = (double *)malloc(sizeof(double) * nbf * nbf);
+            Km[d] = (double *)malloc(sizeof(double) * nbf * nbf);
+            assert((Dm[d] != NULL) && (Jm[d] != NULL) && (Km[d] != NULL));
+            for (int i = 0; i < nbf; i++) {
+                for (int j = 0; j <= i; j++) {
+                    Dm[d][i * nbf + j] = Dm[d][j * nbf + i] = (d == 0) ? D[i * nbf + j] :
+                        (double)xorshift_rand(&rng_state) / 4294967296.0 - 0.5;
+                }
+            }
+        }
+        status = CInt_buildFockMulti(basis, erd, plan, ndens, (const double *const *)Dm, nbf, Jm, Km, nbf);
+        assert(status == CINT_STATUS_SUCCESS);
+        double errMulti = 0.0;
+        for (int d = 0; d < ndens; d++) {
+            CInt_buildFock(basis, erd, plan, Dm[d], nbf, J0, K0, nbf);
+            for (int i = 0; i < nbf * nbf; i++) {
+                errMulti = fmax(errMulti, fabs(Jm[d][i] - J0[i]));
+                errMulti = fmax(errMulti, fabs(Km[d][i] - K0[i]));
+            }
+            free(Dm[d]);
+            free(Jm[d]);
+            free(Km[d]);
+        }
+        printf("Max abs error of %d densities vs single builds: %.3le\n", ndens, errMulti);
+        if (errMulti > 1.0e-10) {
+            printf("ERROR: multi-density J/K differ from single builds\n");
+            errcount++;
+        }
+
+        /* Incremental update for a small density change against a full build */
+        double *dD = (double *)malloc(sizeof(double) * nbf * nbf);
+        assert(dD != NULL);
+        for (int i = 0; i < nbf; i++) {
+            for (int j = 0; j <= i; j++) {
+                dD[i * nbf + j] = dD[j * nbf + i] = 1.0e-4 * ((double)xorshift_rand(&rng_state) / 4294967296.0 - 0.5);
+            }
+        }
+        for (int i = 0; i < nbf * nbf; i++) {
+            D[i] += dD[i];
+        }
+        #ifdef _OPENMP
+        double t = omp_get_wtime();
+        #endif
+        CInt_buildFock(basis, erd, plan, D, nbf, J0, K0, nbf);
+        #ifdef _OPENMP
+        printf("Full build: %.4lf secs, ", omp_get_wtime() - t);
+        t = omp_get_wtime();
+        #endif
+        status = CInt_buildFockIncremental(basis, erd, plan, dD, nbf, J, K, nbf);
+        assert(status == CINT_STATUS_SUCCESS);
+        #ifdef _OPENMP
+        printf("incremental build: %.4lf secs\n", omp_get_wtime() - t);
+        #endif
+        double errInc = 0.0;
+        for (int i = 0; i < nbf * nbf; i++) {
+            errInc = fmax(errInc, fabs(J[i] - J0[i]));
+            errInc = fmax(errInc, fabs(K[i] - K0[i]));
+        }
+        printf("Max abs error of the incremental build: %.3le\n", errInc);
+        if (errInc > 1.0e-8) {
+            printf("ERROR: incremental J/K differ from the full build\n");
+            errcount++;
+        }
+        free(dD);
+        free(J0);
+        free(K0);
+    }
+
+    free(D);
+    free(J);
+    free(K);
+    CInt_destroyFockPlan(plan);
+    CInt_destroySchwarz(schwarz);
+    CInt_destroyERD(erd);
+    CInt_destroyBasisSet(basis);
+    return errcount;
+}
@@ -0,0 +1,114 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <math.h>
+#include <sys/time.h>
+#include <immintrin.h>
+
+#include "erd.h"
+
+
+static inline uint32_t xorshift_rand(uint32_t* state) {
+    uint32_t y = *state;
+    y ^= y << 13;
+    y ^= y >> 17;
+    y ^= y << 5;
+    *state = y;
+    return y;
+}
+
+static double get_time(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1.0e-6 * tv.tv_usec;
+}
+
+typedef void (*rys_scalar_t)(int nt, const double tval[restrict], double rts[restrict], double wts[restrict]);
+
+/* Checks the 1...5 root Rys routines, as erd__rys_roots_weights dispatches
+   them, against their scalar loops erd__rys_N_roots_weights_scalar on
+   shuffled T in [0, 50] and on the T-range boundaries of the scalar code,
+   and times both */
+int main(int argc, char **argv) {
+    const int nt = (argc > 1) ? atoi(argv[1]) : 100000;
+    const int repeat = (argc > 2) ? atoi(argv[2]) : 20;
+    static const double edges[] = {
+        0.0, 3.0e-7, 1.0, 3.0, 5.0, 10.0, 15.0, 20.0, 25.0, 33.0, 35.0, 40.0, 47.0, 53.0, 59.0
+    };
+    const int nedges = sizeof(edges) / sizeof(edges[0]);
+    static const rys_scalar_t scalar[5] = {
+        erd__rys_1_roots_weights_scalar, erd__rys_2_roots_weights_scalar, erd__rys_3_roots_weights_scalar,
+        erd__rys_4_roots_weights_scalar, erd__rys_5_roots_weights_scalar
+    };
+    erd__select_isa(ERD_ISA_AUTO);
+
+/*             ...the T's: the range boundaries and their neighbours, */
+/*                then a dense grid on [0, 50] in random order. */
+    const int ntval = nt + 3 * nedges;
+    double *tval = (double *)_mm_malloc(sizeof(double) * ntval, 64);
+    assert(tval != NULL);
+    for (int i = 0; i < nedges; i++) {
+        tval[3 * i + 0] = edges[i];
+        tval[3 * i + 1] = nextafter(edges[i], 0.0);
+        tval[3 * i + 2] = nextafter(edges[i], INFINITY);
+    }
+    double *grid = &tval[3 * nedges];
+    for (int i = 0; i < nt; i++) {
+        grid[i] = 50.0 * i / (nt - 1);
+    }
+    uint32_t rng_state = 1;
+    for (int i = nt - 1; i > 0; i--) {
+        const int j = xorshift_rand(&rng_state) % (i + 1);
+        const double t = grid[i];
+        grid[i] = grid[j];
+        grid[j] = t;
+    }
+
+    int errcount = 0;
+    printf("# %d T-values in [0, 50], %d repetitions\n", ntval, repeat);
+    printf("ngqp  scalar(ns/T)  kernel(ns/T)  speedup  max rel err roots  max rel err weights\n");
+    for (int ngqp = 1; ngqp <= 5; ngqp++) {
+        const int n = ntval * ngqp;
+        double *rts0 = (double *)_mm_malloc(sizeof(double) * n, 64);
+        double *wts0 = (double *)_mm_malloc(sizeof(double) * n, 64);
+        double *rts1 = (double *)_mm_malloc(sizeof(double) * n, 64);
+        double *wts1 = (double *)_mm_malloc(sizeof(double) * n, 64);
+        void *scratch = _mm_malloc(erd__rys_scratch_size(ntval, ngqp), 64);
+        assert((rts0 != NULL) && (wts0 != NULL) && (rts1 != NULL) && (wts1 != NULL) && (scratch != NULL));
+
+        double scalar_time = 0.0, kernel_time = 0.0;
+        for (int r = 0; r < repeat; r++) {
+            for (int i = 0; i < n; i++) {
+                wts0[i] = 1.0;
+                wts1[i] = 1.0;
+            }
+            double start = get_time();
+            scalar[ngqp - 1](ntval, tval, rts0, wts0);
+            scalar_time += get_time() - start;
+            start = get_time();
+            erd__rys_roots_weights(ntval, ngqp, 2 * ngqp - 1, tval, rts1, wts1, scratch);
+            kernel_time += get_time() - start;
+        }
+
+        double rts_error = 0.0, wts_error = 0.0;
+        for (int i = 0; i < n; i++) {
+            rts_error = fmax(rts_error, fabs(rts1[i] - rts0[i]) / fabs(rts0[i]));
+            wts_error = fmax(wts_error, fabs(wts1[i] - wts0[i]) / fabs(wts0[i]));
+        }
+        if (!(rts_error <= 1.0e-13) || !(wts_error <= 1.0e-13)) {
+            errcount++;
+        }
+        printf("%4d  %12.3lf  %12.3lf  %7.2lf  %17.3le  %19.3le\n", ngqp,
+            1.0e9 * scalar_time / (repeat * ntval), 1.0e9 * kernel_time / (repeat * ntval),
+            scalar_time / kernel_time, rts_error, wts_error);
+
+        _mm_free(rts0);
+        _mm_free(wts0);
+        _mm_free(rts1);
+        _mm_free(wts1);
+        _mm_free(scratch);
+    }
+    _mm_free(tval);
+    return errcount;
+}